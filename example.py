@@ -3,7 +3,8 @@ from overload import overload, NoMatchingOverloadError
 
 
 class Text:
-    @overload
+    # With several matching overloads, the most specific one is picked: Text(True) initializes from a boolean
+    @overload(resolution="best")
     def __init__(self, val: int):
         """Initialize text from an integer."""
         self.text = str(val)
@@ -1,5 +1,5 @@
 """Create overloaded functions using simple function decorators."""
-from inspect import signature
+import inspect
 
 __all__ = [
     # Decorators
@@ -40,7 +40,7 @@ class AmbiguousOverloadError(OverloadError):
         shortname = self.qualname[self.qualname.rfind(".")+1:]
 
         title = f"ambiguous overloaded call to {self.module}.{self.qualname}\nPossible candidates:\n"
-        reasons = "\n".join(f"  {shortname}{signature(candidate)}" for candidate in self.candidates)
+        reasons = "\n".join(f"  {shortname}{inspect.signature(candidate)}" for candidate in self.candidates)
         
         return title + reasons
 
@@ -51,8 +51,16 @@ class NoMatchingOverloadError(OverloadError):
         super().__init__(module, qualname, arguments)
         
         self.overloads = overloads
-        self.fail_reasons = fail_reasons
-        """A list of reasons (TypeErrors) why each function did not match the overload."""
+        self._fail_reasons = fail_reasons
+
+    @property
+    def fail_reasons(self):
+        """A list of reasons (TypeErrors) why each function did not match the overload.  
+        Reasons may be passed to the constructor as a callable, in which case they are only produced on first access.
+        """
+        if callable(self._fail_reasons):
+            self._fail_reasons = self._fail_reasons()
+        return self._fail_reasons
     
     def __str__(self):
         shortname = self.qualname[self.qualname.rfind(".")+1:]
@@ -60,8 +68,8 @@ class NoMatchingOverloadError(OverloadError):
         title = f"no matching overload found for {self.module}.{self.qualname}\nReason:\n"
 
         def generate_reasons():
-            for func, reason in zip((func for func, _ in self.overloads), self.fail_reasons):
-                yield f"  {shortname}{signature(func)}: {reason}"
+            for func, reason in zip(self.overloads, self.fail_reasons):
+                yield f"  {shortname}{inspect.signature(func)}: {reason}"
         
         reasons = "\n".join(generate_reasons())
 
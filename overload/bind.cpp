@@ -1,33 +1,38 @@
-/* Generated by Cython 0.29.22 */
-
-/* BEGIN: Cython Metadata
-{
-    "distutils": {
-        "language": "c++",
-        "name": "overload.bind",
-        "sources": [
-            "D:\\OneDrive\\Develop\\overload\\overload\\bind.pyx"
-        ]
-    },
-    "module_name": "overload.bind"
-}
-END: Cython Metadata */
+/* Generated by Cython 3.3.0 */
 
+#ifndef PY_SSIZE_T_CLEAN
 #define PY_SSIZE_T_CLEAN
+#endif /* PY_SSIZE_T_CLEAN */
+/* InitLimitedAPI */
+#if defined(Py_LIMITED_API)
+  #if !defined(CYTHON_LIMITED_API)
+  #define CYTHON_LIMITED_API 1
+  #endif
+#elif defined(CYTHON_LIMITED_API)
+  #ifdef _MSC_VER
+  #pragma message ("Limited API usage is enabled with 'CYTHON_LIMITED_API' but 'Py_LIMITED_API' does not define a Python target version. Consider setting 'Py_LIMITED_API' instead.")
+  #else
+  #warning Limited API usage is enabled with 'CYTHON_LIMITED_API' but 'Py_LIMITED_API' does not define a Python target version. Consider setting 'Py_LIMITED_API' instead.
+  #endif
+#endif
+
 #include "Python.h"
 #ifndef Py_PYTHON_H
     #error Python headers needed to compile C extensions, please install development version of Python.
-#elif PY_VERSION_HEX < 0x02060000 || (0x03000000 <= PY_VERSION_HEX && PY_VERSION_HEX < 0x03030000)
-    #error Cython requires Python 2.6+ or Python 3.3+.
+#elif PY_VERSION_HEX < 0x03090000
+    #error Cython requires Python 3.9+.
+#elif defined(Py_LIMITED_API) && (Py_LIMITED_API & 0xFFFF0000) > (PY_VERSION_HEX & 0xFFFF0000)
+    #error 'Py_LIMITED_API' can only select past Python X.Y versions, not future ones.
 #else
-#define CYTHON_ABI "0_29_22"
-#define CYTHON_HEX_VERSION 0x001D16F0
+#define __PYX_ABI_VERSION "3_3_0"
+#define CYTHON_HEX_VERSION 0x030300F0
 #define CYTHON_FUTURE_DIVISION 1
+/* CModulePreamble */
 #include <stddef.h>
 #ifndef offsetof
   #define offsetof(type, member) ( (size_t) & ((type*)0) -> member )
 #endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
+#if !defined(_WIN32) && !defined(WIN32) && !defined(MS_WINDOWS)
   #ifndef __stdcall
     #define __stdcall
   #endif
@@ -38,6 +43,11 @@ END: Cython Metadata */
     #define __fastcall
   #endif
 #endif
+#ifdef __has_builtin
+  #define __Pyx_has_cbuiltin(name) __has_builtin(name)
+#else
+  #define __Pyx_has_cbuiltin(name) (0)
+#endif
 #ifndef DL_IMPORT
   #define DL_IMPORT(t) t
 #endif
@@ -45,31 +55,124 @@ END: Cython Metadata */
   #define DL_EXPORT(t) t
 #endif
 #define __PYX_COMMA ,
-#ifndef HAVE_LONG_LONG
-  #if PY_VERSION_HEX >= 0x02070000
-    #define HAVE_LONG_LONG
-  #endif
-#endif
 #ifndef PY_LONG_LONG
   #define PY_LONG_LONG LONG_LONG
 #endif
 #ifndef Py_HUGE_VAL
   #define Py_HUGE_VAL HUGE_VAL
 #endif
-#ifdef PYPY_VERSION
-  #define CYTHON_COMPILING_IN_PYPY 1
-  #define CYTHON_COMPILING_IN_PYSTON 0
+#define __PYX_LIMITED_VERSION_HEX PY_VERSION_HEX
+#if defined(CYTHON_LIMITED_API)
+  #ifdef Py_LIMITED_API
+    #undef __PYX_LIMITED_VERSION_HEX
+    #define __PYX_LIMITED_VERSION_HEX Py_LIMITED_API
+    #if Py_LIMITED_API < 0x03090000
+      #error "Cython 3.3 requires the Python Limited API version to be 3.9 or greater."
+    #endif
+  #endif
+  #if defined(GRAALVM_PYTHON) || defined(PYPY_VERSION)
+    #ifdef _MSC_VER
+      #pragma message ("Py_LIMITED_API is defined on PyPy or GraalPy. This takes precedence over Cython's specialized\
+        code for PyPy and GraalPy and is unlikely to work.")
+    #else
+      #warning "Py_LIMITED_API is defined on PyPy or GraalPy. This takes precedence over Cython's specialized\
+        code for PyPy and GraalPy and is unlikely to work."
+    #endif
+  #endif
+  #define CYTHON_COMPILING_IN_PYPY 0
   #define CYTHON_COMPILING_IN_CPYTHON 0
+  #define CYTHON_COMPILING_IN_LIMITED_API 1
+  #define CYTHON_COMPILING_IN_GRAAL 0
+  #define CYTHON_COMPILING_IN_CPYTHON_FREETHREADING 0
   #undef CYTHON_USE_TYPE_SLOTS
   #define CYTHON_USE_TYPE_SLOTS 0
+  #undef CYTHON_USE_TYPE_SPECS
+  #define CYTHON_USE_TYPE_SPECS 1
   #undef CYTHON_USE_PYTYPE_LOOKUP
   #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #if PY_VERSION_HEX < 0x03050000
-    #undef CYTHON_USE_ASYNC_SLOTS
-    #define CYTHON_USE_ASYNC_SLOTS 0
-  #elif !defined(CYTHON_USE_ASYNC_SLOTS)
-    #define CYTHON_USE_ASYNC_SLOTS 1
+  #undef CYTHON_USE_PYLIST_INTERNALS
+  #define CYTHON_USE_PYLIST_INTERNALS 0
+  #undef CYTHON_USE_UNICODE_INTERNALS
+  #define CYTHON_USE_UNICODE_INTERNALS 0
+  #ifndef CYTHON_USE_UNICODE_WRITER
+    #define CYTHON_USE_UNICODE_WRITER 0
+  #endif
+  #undef CYTHON_USE_PYLONG_INTERNALS
+  #define CYTHON_USE_PYLONG_INTERNALS 0
+  #ifndef CYTHON_AVOID_BORROWED_REFS
+    #define CYTHON_AVOID_BORROWED_REFS 0
+  #endif
+  #ifndef CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+    #define CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS 0
+  #endif
+  #undef CYTHON_ASSUME_SAFE_MACROS
+  #define CYTHON_ASSUME_SAFE_MACROS 0
+  #undef CYTHON_ASSUME_SAFE_SIZE
+  #define CYTHON_ASSUME_SAFE_SIZE 0
+  #undef CYTHON_UNPACK_METHODS
+  #define CYTHON_UNPACK_METHODS 0
+  #undef CYTHON_FAST_THREAD_STATE
+  #define CYTHON_FAST_THREAD_STATE 0
+  #undef CYTHON_FAST_GIL
+  #define CYTHON_FAST_GIL 0
+  #undef CYTHON_VECTORCALL
+  #define CYTHON_VECTORCALL (__PYX_LIMITED_VERSION_HEX >= 0x030C0000)
+  #ifndef CYTHON_VECTORCALL_TPNEW
+    #define CYTHON_VECTORCALL_TPNEW (CYTHON_VECTORCALL && __PYX_LIMITED_VERSION_HEX >= 0x030E0000)
+  #endif
+  #ifndef CYTHON_PEP487_INIT_SUBCLASS
+    #define CYTHON_PEP487_INIT_SUBCLASS 1
+  #endif
+  #ifndef CYTHON_PEP489_MULTI_PHASE_INIT
+    #define CYTHON_PEP489_MULTI_PHASE_INIT 1
+  #endif
+  #ifndef CYTHON_USE_MODULE_STATE
+    #define CYTHON_USE_MODULE_STATE 0
+  #endif
+  #undef CYTHON_USE_SYS_MONITORING
+  #define CYTHON_USE_SYS_MONITORING 0
+  #ifndef CYTHON_USE_TP_FINALIZE
+    #define CYTHON_USE_TP_FINALIZE (__PYX_LIMITED_VERSION_HEX >= 0x030F0000 && PY_VERSION_HEX > 0x030F00A8)
+  #endif
+  #ifndef CYTHON_USE_AM_SEND
+    #define CYTHON_USE_AM_SEND (__PYX_LIMITED_VERSION_HEX >= 0x030A0000)
+  #endif
+  #undef CYTHON_USE_DICT_VERSIONS
+  #define CYTHON_USE_DICT_VERSIONS 0
+  #undef CYTHON_USE_EXC_INFO_STACK
+  #define CYTHON_USE_EXC_INFO_STACK 0
+  #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
+    #define CYTHON_UPDATE_DESCRIPTOR_DOC 0
+  #endif
+  #ifndef CYTHON_USE_OWN_PREP_RERAISE_STAR
+    #define CYTHON_USE_OWN_PREP_RERAISE_STAR 1
+  #endif
+  #ifndef CYTHON_USE_FREELISTS
+  #define CYTHON_USE_FREELISTS 1
+  #endif
+  #undef CYTHON_IMMORTAL_CONSTANTS
+  #define CYTHON_IMMORTAL_CONSTANTS 0
+  #if __PYX_LIMITED_VERSION_HEX < 0x030E0000
+  #undef CYTHON_OPAQUE_OBJECTS
+  #define CYTHON_OPAQUE_OBJECTS 0
+  #elif !defined(CYTHON_OPAQUE_OBJECTS)
+  #define CYTHON_OPAQUE_OBJECTS (__PYX_LIMITED_VERSION_HEX >= 0x030F0000)
+  #endif
+#elif defined(GRAALVM_PYTHON)
+  /* For very preliminary testing purposes. Most variables are set the same as PyPy.
+     The existence of this section does not imply that anything works or is even tested */
+  #define CYTHON_COMPILING_IN_PYPY 0
+  #define CYTHON_COMPILING_IN_CPYTHON 0
+  #define CYTHON_COMPILING_IN_LIMITED_API 0
+  #define CYTHON_COMPILING_IN_GRAAL 1
+  #define CYTHON_COMPILING_IN_CPYTHON_FREETHREADING 0
+  #ifndef CYTHON_USE_TYPE_SLOTS
+    #define CYTHON_USE_TYPE_SLOTS 0
   #endif
+  #undef CYTHON_USE_TYPE_SPECS
+  #define CYTHON_USE_TYPE_SPECS 0
+  #undef CYTHON_USE_PYTYPE_LOOKUP
+  #define CYTHON_USE_PYTYPE_LOOKUP 0
   #undef CYTHON_USE_PYLIST_INTERNALS
   #define CYTHON_USE_PYLIST_INTERNALS 0
   #undef CYTHON_USE_UNICODE_INTERNALS
@@ -80,95 +183,167 @@ END: Cython Metadata */
   #define CYTHON_USE_PYLONG_INTERNALS 0
   #undef CYTHON_AVOID_BORROWED_REFS
   #define CYTHON_AVOID_BORROWED_REFS 1
+  #undef CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+  #define CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS 0
   #undef CYTHON_ASSUME_SAFE_MACROS
   #define CYTHON_ASSUME_SAFE_MACROS 0
+  #undef CYTHON_ASSUME_SAFE_SIZE
+  #define CYTHON_ASSUME_SAFE_SIZE 0
   #undef CYTHON_UNPACK_METHODS
   #define CYTHON_UNPACK_METHODS 0
   #undef CYTHON_FAST_THREAD_STATE
   #define CYTHON_FAST_THREAD_STATE 0
-  #undef CYTHON_FAST_PYCALL
-  #define CYTHON_FAST_PYCALL 0
+  #undef CYTHON_FAST_GIL
+  #define CYTHON_FAST_GIL 0
+  #ifndef CYTHON_VECTORCALL
+    #define CYTHON_VECTORCALL 1
+  #endif
+  #if CYTHON_USE_TYPE_SPECS && PY_VERSION_HEX < 0x030E0000
+    #undef CYTHON_VECTORCALL_TPNEW
+    #define CYTHON_VECTORCALL_TPNEW 0
+  #elif !defined(CYTHON_VECTORCALL_TPNEW)
+    #define CYTHON_VECTORCALL_TPNEW CYTHON_VECTORCALL
+  #endif
+  #ifndef CYTHON_PEP487_INIT_SUBCLASS
+    #define CYTHON_PEP487_INIT_SUBCLASS 1
+  #endif
   #undef CYTHON_PEP489_MULTI_PHASE_INIT
-  #define CYTHON_PEP489_MULTI_PHASE_INIT 0
+  #define CYTHON_PEP489_MULTI_PHASE_INIT 1
+  #undef CYTHON_USE_MODULE_STATE
+  #define CYTHON_USE_MODULE_STATE 0
+  #undef CYTHON_USE_SYS_MONITORING
+  #define CYTHON_USE_SYS_MONITORING 0
   #undef CYTHON_USE_TP_FINALIZE
   #define CYTHON_USE_TP_FINALIZE 0
+  #undef CYTHON_USE_AM_SEND
+  #define CYTHON_USE_AM_SEND 0
   #undef CYTHON_USE_DICT_VERSIONS
   #define CYTHON_USE_DICT_VERSIONS 0
   #undef CYTHON_USE_EXC_INFO_STACK
-  #define CYTHON_USE_EXC_INFO_STACK 0
-#elif defined(PYSTON_VERSION)
-  #define CYTHON_COMPILING_IN_PYPY 0
-  #define CYTHON_COMPILING_IN_PYSTON 1
+  #define CYTHON_USE_EXC_INFO_STACK 1
+  #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
+    #define CYTHON_UPDATE_DESCRIPTOR_DOC 0
+  #endif
+  #ifndef CYTHON_USE_OWN_PREP_RERAISE_STAR
+    #define CYTHON_USE_OWN_PREP_RERAISE_STAR 1
+  #endif
+  #undef CYTHON_USE_FREELISTS
+  #define CYTHON_USE_FREELISTS 0
+  #undef CYTHON_IMMORTAL_CONSTANTS
+  #define CYTHON_IMMORTAL_CONSTANTS 0
+  #undef CYTHON_OPAQUE_OBJECTS
+  #define CYTHON_OPAQUE_OBJECTS 0
+#elif defined(PYPY_VERSION)
+  #define CYTHON_COMPILING_IN_PYPY 1
   #define CYTHON_COMPILING_IN_CPYTHON 0
-  #ifndef CYTHON_USE_TYPE_SLOTS
-    #define CYTHON_USE_TYPE_SLOTS 1
+  #define CYTHON_COMPILING_IN_LIMITED_API 0
+  #define CYTHON_COMPILING_IN_GRAAL 0
+  #define CYTHON_COMPILING_IN_CPYTHON_FREETHREADING 0
+  #undef CYTHON_USE_TYPE_SLOTS
+  #define CYTHON_USE_TYPE_SLOTS 1
+  #ifndef CYTHON_USE_TYPE_SPECS
+    #define CYTHON_USE_TYPE_SPECS 0
   #endif
   #undef CYTHON_USE_PYTYPE_LOOKUP
   #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #undef CYTHON_USE_ASYNC_SLOTS
-  #define CYTHON_USE_ASYNC_SLOTS 0
   #undef CYTHON_USE_PYLIST_INTERNALS
   #define CYTHON_USE_PYLIST_INTERNALS 0
-  #ifndef CYTHON_USE_UNICODE_INTERNALS
-    #define CYTHON_USE_UNICODE_INTERNALS 1
-  #endif
+  #undef CYTHON_USE_UNICODE_INTERNALS
+  #define CYTHON_USE_UNICODE_INTERNALS 0
   #undef CYTHON_USE_UNICODE_WRITER
   #define CYTHON_USE_UNICODE_WRITER 0
   #undef CYTHON_USE_PYLONG_INTERNALS
   #define CYTHON_USE_PYLONG_INTERNALS 0
-  #ifndef CYTHON_AVOID_BORROWED_REFS
-    #define CYTHON_AVOID_BORROWED_REFS 0
-  #endif
-  #ifndef CYTHON_ASSUME_SAFE_MACROS
-    #define CYTHON_ASSUME_SAFE_MACROS 1
-  #endif
-  #ifndef CYTHON_UNPACK_METHODS
-    #define CYTHON_UNPACK_METHODS 1
+  #undef CYTHON_AVOID_BORROWED_REFS
+  #define CYTHON_AVOID_BORROWED_REFS 1
+  #undef CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+  #define CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS 1
+  #undef CYTHON_ASSUME_SAFE_MACROS
+  #define CYTHON_ASSUME_SAFE_MACROS 0
+  #ifndef CYTHON_ASSUME_SAFE_SIZE
+    #define CYTHON_ASSUME_SAFE_SIZE 1
   #endif
+  #undef CYTHON_UNPACK_METHODS
+  #define CYTHON_UNPACK_METHODS 0
   #undef CYTHON_FAST_THREAD_STATE
   #define CYTHON_FAST_THREAD_STATE 0
-  #undef CYTHON_FAST_PYCALL
-  #define CYTHON_FAST_PYCALL 0
-  #undef CYTHON_PEP489_MULTI_PHASE_INIT
-  #define CYTHON_PEP489_MULTI_PHASE_INIT 0
-  #undef CYTHON_USE_TP_FINALIZE
-  #define CYTHON_USE_TP_FINALIZE 0
+  #undef CYTHON_FAST_GIL
+  #define CYTHON_FAST_GIL 0
+  #ifndef CYTHON_VECTORCALL
+    #define CYTHON_VECTORCALL 1
+  #endif
+  #if CYTHON_USE_TYPE_SPECS && PY_VERSION_HEX < 0x030E0000
+    #undef CYTHON_VECTORCALL_TPNEW
+    #define CYTHON_VECTORCALL_TPNEW 0
+  #elif !defined(CYTHON_VECTORCALL_TPNEW)
+    #define CYTHON_VECTORCALL_TPNEW (PYPY_VERSION_NUM >= 0x07030800 && CYTHON_VECTORCALL)
+  #endif
+  #ifndef CYTHON_PEP487_INIT_SUBCLASS
+    #define CYTHON_PEP487_INIT_SUBCLASS 1
+  #endif
+  #ifndef CYTHON_PEP489_MULTI_PHASE_INIT
+    #define CYTHON_PEP489_MULTI_PHASE_INIT 1
+  #endif
+  #undef CYTHON_USE_MODULE_STATE
+  #define CYTHON_USE_MODULE_STATE 0
+  #undef CYTHON_USE_SYS_MONITORING
+  #define CYTHON_USE_SYS_MONITORING 0
+  #ifndef CYTHON_USE_TP_FINALIZE
+    #define CYTHON_USE_TP_FINALIZE (PYPY_VERSION_NUM >= 0x07030C00)
+  #endif
+  #undef CYTHON_USE_AM_SEND
+  #define CYTHON_USE_AM_SEND 0
   #undef CYTHON_USE_DICT_VERSIONS
   #define CYTHON_USE_DICT_VERSIONS 0
   #undef CYTHON_USE_EXC_INFO_STACK
   #define CYTHON_USE_EXC_INFO_STACK 0
+  #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
+    #define CYTHON_UPDATE_DESCRIPTOR_DOC (PYPY_VERSION_NUM >= 0x07031100)
+  #endif
+  #ifndef CYTHON_USE_OWN_PREP_RERAISE_STAR
+    #define CYTHON_USE_OWN_PREP_RERAISE_STAR 1
+  #endif
+  #undef CYTHON_USE_FREELISTS
+  #define CYTHON_USE_FREELISTS 0
+  #undef CYTHON_IMMORTAL_CONSTANTS
+  #define CYTHON_IMMORTAL_CONSTANTS 0
+  #undef CYTHON_OPAQUE_OBJECTS
+  #define CYTHON_OPAQUE_OBJECTS 0
 #else
   #define CYTHON_COMPILING_IN_PYPY 0
-  #define CYTHON_COMPILING_IN_PYSTON 0
   #define CYTHON_COMPILING_IN_CPYTHON 1
-  #ifndef CYTHON_USE_TYPE_SLOTS
+  #define CYTHON_COMPILING_IN_LIMITED_API 0
+  #define CYTHON_COMPILING_IN_GRAAL 0
+  #ifdef Py_GIL_DISABLED
+    #define CYTHON_COMPILING_IN_CPYTHON_FREETHREADING 1
+  #else
+    #define CYTHON_COMPILING_IN_CPYTHON_FREETHREADING 0
+  #endif
+  #if PY_VERSION_HEX < 0x030A0000
+    #undef CYTHON_USE_TYPE_SLOTS
+    #define CYTHON_USE_TYPE_SLOTS 1
+  #elif !defined(CYTHON_USE_TYPE_SLOTS)
     #define CYTHON_USE_TYPE_SLOTS 1
   #endif
-  #if PY_VERSION_HEX < 0x02070000
-    #undef CYTHON_USE_PYTYPE_LOOKUP
-    #define CYTHON_USE_PYTYPE_LOOKUP 0
-  #elif !defined(CYTHON_USE_PYTYPE_LOOKUP)
-    #define CYTHON_USE_PYTYPE_LOOKUP 1
+  #ifndef CYTHON_USE_TYPE_SPECS
+    #define CYTHON_USE_TYPE_SPECS 0
   #endif
-  #if PY_MAJOR_VERSION < 3
-    #undef CYTHON_USE_ASYNC_SLOTS
-    #define CYTHON_USE_ASYNC_SLOTS 0
-  #elif !defined(CYTHON_USE_ASYNC_SLOTS)
-    #define CYTHON_USE_ASYNC_SLOTS 1
+  #ifndef CYTHON_USE_PYTYPE_LOOKUP
+    #define CYTHON_USE_PYTYPE_LOOKUP 1
   #endif
-  #if PY_VERSION_HEX < 0x02070000
-    #undef CYTHON_USE_PYLONG_INTERNALS
-    #define CYTHON_USE_PYLONG_INTERNALS 0
-  #elif !defined(CYTHON_USE_PYLONG_INTERNALS)
+  #ifndef CYTHON_USE_PYLONG_INTERNALS
     #define CYTHON_USE_PYLONG_INTERNALS 1
   #endif
-  #ifndef CYTHON_USE_PYLIST_INTERNALS
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    #undef CYTHON_USE_PYLIST_INTERNALS
+    #define CYTHON_USE_PYLIST_INTERNALS 0
+  #elif !defined(CYTHON_USE_PYLIST_INTERNALS)
     #define CYTHON_USE_PYLIST_INTERNALS 1
   #endif
   #ifndef CYTHON_USE_UNICODE_INTERNALS
     #define CYTHON_USE_UNICODE_INTERNALS 1
   #endif
-  #if PY_VERSION_HEX < 0x030300F0
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING || PY_VERSION_HEX >= 0x030B00A2
     #undef CYTHON_USE_UNICODE_WRITER
     #define CYTHON_USE_UNICODE_WRITER 0
   #elif !defined(CYTHON_USE_UNICODE_WRITER)
@@ -177,36 +352,86 @@ END: Cython Metadata */
   #ifndef CYTHON_AVOID_BORROWED_REFS
     #define CYTHON_AVOID_BORROWED_REFS 0
   #endif
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    #undef CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+    #define CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS 1
+  #elif !defined(CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS)
+    #define CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS 0
+  #endif
   #ifndef CYTHON_ASSUME_SAFE_MACROS
     #define CYTHON_ASSUME_SAFE_MACROS 1
   #endif
+  #ifndef CYTHON_ASSUME_SAFE_SIZE
+    #define CYTHON_ASSUME_SAFE_SIZE 1
+  #endif
   #ifndef CYTHON_UNPACK_METHODS
     #define CYTHON_UNPACK_METHODS 1
   #endif
   #ifndef CYTHON_FAST_THREAD_STATE
     #define CYTHON_FAST_THREAD_STATE 1
   #endif
-  #ifndef CYTHON_FAST_PYCALL
-    #define CYTHON_FAST_PYCALL 1
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    #undef CYTHON_FAST_GIL
+    #define CYTHON_FAST_GIL 0
+  #elif !defined(CYTHON_FAST_GIL)
+    #define CYTHON_FAST_GIL (PY_VERSION_HEX < 0x030C00A6)
+  #endif
+  #ifndef CYTHON_VECTORCALL
+    #define CYTHON_VECTORCALL 1
+  #endif
+  #if CYTHON_USE_TYPE_SPECS && PY_VERSION_HEX < 0x030E0000
+    #undef CYTHON_VECTORCALL_TPNEW
+    #define CYTHON_VECTORCALL_TPNEW 0
+  #elif !defined(CYTHON_VECTORCALL_TPNEW)
+    #define CYTHON_VECTORCALL_TPNEW CYTHON_VECTORCALL
+  #endif
+  #ifndef CYTHON_PEP487_INIT_SUBCLASS
+    #define CYTHON_PEP487_INIT_SUBCLASS 1
   #endif
   #ifndef CYTHON_PEP489_MULTI_PHASE_INIT
-    #define CYTHON_PEP489_MULTI_PHASE_INIT (PY_VERSION_HEX >= 0x03050000)
+    #define CYTHON_PEP489_MULTI_PHASE_INIT 1
+  #endif
+  #ifndef CYTHON_USE_MODULE_STATE
+    #define CYTHON_USE_MODULE_STATE 0
+  #endif
+  #ifndef CYTHON_USE_SYS_MONITORING
+    #define CYTHON_USE_SYS_MONITORING (PY_VERSION_HEX >= 0x030d00B1)
   #endif
   #ifndef CYTHON_USE_TP_FINALIZE
-    #define CYTHON_USE_TP_FINALIZE (PY_VERSION_HEX >= 0x030400a1)
+    #define CYTHON_USE_TP_FINALIZE 1
+  #endif
+  #ifndef CYTHON_USE_AM_SEND
+    #define CYTHON_USE_AM_SEND 1
   #endif
-  #ifndef CYTHON_USE_DICT_VERSIONS
-    #define CYTHON_USE_DICT_VERSIONS (PY_VERSION_HEX >= 0x030600B1)
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    #undef CYTHON_USE_DICT_VERSIONS
+    #define CYTHON_USE_DICT_VERSIONS 0
+  #elif !defined(CYTHON_USE_DICT_VERSIONS)
+    #define CYTHON_USE_DICT_VERSIONS  (PY_VERSION_HEX < 0x030C00A5 && !CYTHON_USE_MODULE_STATE)
   #endif
   #ifndef CYTHON_USE_EXC_INFO_STACK
-    #define CYTHON_USE_EXC_INFO_STACK (PY_VERSION_HEX >= 0x030700A3)
+    #define CYTHON_USE_EXC_INFO_STACK 1
+  #endif
+  #ifndef CYTHON_UPDATE_DESCRIPTOR_DOC
+    #define CYTHON_UPDATE_DESCRIPTOR_DOC 1
+  #endif
+  #ifndef CYTHON_USE_OWN_PREP_RERAISE_STAR
+    #define CYTHON_USE_OWN_PREP_RERAISE_STAR (PY_VERSION_HEX < 0x030C00B2)
+  #endif
+  #ifndef CYTHON_USE_FREELISTS
+    #define CYTHON_USE_FREELISTS (!CYTHON_COMPILING_IN_CPYTHON_FREETHREADING)
+  #endif
+  #if defined(CYTHON_IMMORTAL_CONSTANTS) && PY_VERSION_HEX < 0x030C0000
+    #undef CYTHON_IMMORTAL_CONSTANTS
+    #define CYTHON_IMMORTAL_CONSTANTS 0  // definitely won't work
+  #elif !defined(CYTHON_IMMORTAL_CONSTANTS)
+    #define CYTHON_IMMORTAL_CONSTANTS (PY_VERSION_HEX >= 0x030C0000 && !CYTHON_USE_MODULE_STATE && CYTHON_COMPILING_IN_CPYTHON_FREETHREADING)
+  #endif
+  #ifndef CYTHON_OPAQUE_OBJECTS
+    #define CYTHON_OPAQUE_OBJECTS 0
   #endif
-#endif
-#if !defined(CYTHON_FAST_PYCCALL)
-#define CYTHON_FAST_PYCCALL  (CYTHON_FAST_PYCALL && PY_VERSION_HEX >= 0x030600B1)
 #endif
 #if CYTHON_USE_PYLONG_INTERNALS
-  #include "longintrepr.h"
   #undef SHIFT
   #undef BASE
   #undef MASK
@@ -231,6 +456,19 @@ END: Cython Metadata */
     #define CYTHON_RESTRICT
   #endif
 #endif
+#ifndef CYTHON_UNUSED
+  #if defined(__cplusplus)
+    /* for clang __has_cpp_attribute(maybe_unused) is true even before C++17
+     * but leads to warnings with -pedantic, since it is a C++17 feature */
+    #if ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+      #if __has_cpp_attribute(maybe_unused)
+        #define CYTHON_UNUSED [[maybe_unused]]
+      #endif
+    #endif
+  #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L
+    #define CYTHON_UNUSED [[maybe_unused]]
+  #endif
+#endif
 #ifndef CYTHON_UNUSED
 # if defined(__GNUC__)
 #   if !(defined(__cplusplus)) || (__GNUC__ > 3 || (__GNUC__ == 3 && __GNUC_MINOR__ >= 4))
@@ -244,42 +482,49 @@ END: Cython Metadata */
 #   define CYTHON_UNUSED
 # endif
 #endif
-#ifndef CYTHON_MAYBE_UNUSED_VAR
+#ifndef CYTHON_UNUSED_VAR
 #  if defined(__cplusplus)
-     template<class T> void CYTHON_MAYBE_UNUSED_VAR( const T& ) { }
+     template<class T> void CYTHON_UNUSED_VAR( const T& ) { }
 #  else
-#    define CYTHON_MAYBE_UNUSED_VAR(x) (void)(x)
+#    define CYTHON_UNUSED_VAR(x) (void)(x)
 #  endif
 #endif
+#ifndef CYTHON_MAYBE_UNUSED_VAR
+  #define CYTHON_MAYBE_UNUSED_VAR(x) CYTHON_UNUSED_VAR(x)
+#endif
 #ifndef CYTHON_NCP_UNUSED
-# if CYTHON_COMPILING_IN_CPYTHON
+# if CYTHON_COMPILING_IN_CPYTHON && !CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
 #  define CYTHON_NCP_UNUSED
 # else
 #  define CYTHON_NCP_UNUSED CYTHON_UNUSED
 # endif
 #endif
-#define __Pyx_void_to_None(void_result) ((void)(void_result), Py_INCREF(Py_None), Py_None)
-#ifdef _MSC_VER
-    #ifndef _MSC_STDINT_H_
-        #if _MSC_VER < 1300
-           typedef unsigned char     uint8_t;
-           typedef unsigned int      uint32_t;
-        #else
-           typedef unsigned __int8   uint8_t;
-           typedef unsigned __int32  uint32_t;
-        #endif
-    #endif
-#else
-   #include <stdint.h>
+#ifndef CYTHON_USE_CPP_STD_MOVE
+  #if defined(__cplusplus) && (\
+    __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600))
+    #define CYTHON_USE_CPP_STD_MOVE 1
+  #else
+    #define CYTHON_USE_CPP_STD_MOVE 0
+  #endif
 #endif
+#define __Pyx_void_to_None(void_result) ((void)(void_result), Py_INCREF(Py_None), Py_None)
+#include <stdint.h>
+typedef uintptr_t  __pyx_uintptr_t;
 #ifndef CYTHON_FALLTHROUGH
-  #if defined(__cplusplus) && __cplusplus >= 201103L
-    #if __has_cpp_attribute(fallthrough)
-      #define CYTHON_FALLTHROUGH [[fallthrough]]
-    #elif __has_cpp_attribute(clang::fallthrough)
-      #define CYTHON_FALLTHROUGH [[clang::fallthrough]]
-    #elif __has_cpp_attribute(gnu::fallthrough)
-      #define CYTHON_FALLTHROUGH [[gnu::fallthrough]]
+  #if defined(__cplusplus)
+    /* for clang __has_cpp_attribute(fallthrough) is true even before C++17
+     * but leads to warnings with -pedantic, since it is a C++17 feature */
+    #if ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+      #if __has_cpp_attribute(fallthrough)
+        #define CYTHON_FALLTHROUGH [[fallthrough]]
+      #endif
+    #endif
+    #ifndef CYTHON_FALLTHROUGH
+      #if __has_cpp_attribute(clang::fallthrough)
+        #define CYTHON_FALLTHROUGH [[clang::fallthrough]]
+      #elif __has_cpp_attribute(gnu::fallthrough)
+        #define CYTHON_FALLTHROUGH [[gnu::fallthrough]]
+      #endif
     #endif
   #endif
   #ifndef CYTHON_FALLTHROUGH
@@ -289,14 +534,49 @@ END: Cython Metadata */
       #define CYTHON_FALLTHROUGH
     #endif
   #endif
-  #if defined(__clang__ ) && defined(__apple_build_version__)
+  #if defined(__clang__) && defined(__apple_build_version__)
     #if __apple_build_version__ < 7000000
       #undef  CYTHON_FALLTHROUGH
       #define CYTHON_FALLTHROUGH
     #endif
   #endif
 #endif
+#ifdef Py_UNREACHABLE
+  #define __Pyx_UNREACHABLE() Py_UNREACHABLE()
+#elif __Pyx_has_cbuiltin(__builtin_unreachable)
+  #define __Pyx_UNREACHABLE() __builtin_unreachable()
+#elif defined(__clang__) || defined(__INTEL_COMPILER) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 5)))
+  #define __Pyx_UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+  #define __Pyx_UNREACHABLE() __assume(0)
+#else
+  #define __Pyx_UNREACHABLE() Py_FatalError("Unreachable C code path reached")
+#endif
+#ifndef Py_UNREACHABLE
+  #define Py_UNREACHABLE() __Pyx_UNREACHABLE()
+#endif
+#ifdef __cplusplus
+  template <typename T>
+  struct __PYX_IS_UNSIGNED_IMPL {static const bool value = T(0) < T(-1);};
+  #define __PYX_IS_UNSIGNED(type) (__PYX_IS_UNSIGNED_IMPL<type>::value)
+#else
+  #define __PYX_IS_UNSIGNED(type) (((type)-1) > 0)
+#endif
+#if CYTHON_COMPILING_IN_PYPY == 1
+  #define __PYX_NEED_TP_PRINT_SLOT  (PY_VERSION_HEX < 0x030A0000)
+#else
+  #define __PYX_NEED_TP_PRINT_SLOT  0
+#endif
+#define __PYX_REINTERPRET_FUNCION(func_pointer, other_pointer) ((func_pointer)(void(*)(void))(other_pointer))
+#if __PYX_LIMITED_VERSION_HEX < 0x030C0000
+#define __Pyx_PyErr_FetchException(petype, peval, petb) PyErr_Fetch(petype, peval, petb)
+#define __Pyx_PyErr_RestoreException(etype, eval, etb) PyErr_Restore(etype, eval, etb)
+#else
+#define __Pyx_PyErr_FetchException(petype, peval, petb) *(petype)=NULL; *(peval)=PyErr_GetRaisedException(); *(petb)=NULL
+#define __Pyx_PyErr_RestoreException(etype, eval, etb) PyErr_SetRaisedException(eval)
+#endif
 
+/* CppInitCode */
 #ifndef __cplusplus
   #error "Cython files generated with the C++ option must be compiled with a C++ compiler."
 #endif
@@ -319,49 +599,103 @@ class __Pyx_FakeReference {
     T *operator->() { return ptr; }
     T *operator&() { return ptr; }
     operator T&() { return *ptr; }
-    template<typename U> bool operator ==(U other) { return *ptr == other; }
-    template<typename U> bool operator !=(U other) { return *ptr != other; }
+    template<typename U> bool operator ==(const U& other) const { return *ptr == other; }
+    template<typename U> bool operator !=(const U& other) const { return *ptr != other; }
+    template<typename U> bool operator==(const __Pyx_FakeReference<U>& other) const { return *ptr == *other.ptr; }
+    template<typename U> bool operator!=(const __Pyx_FakeReference<U>& other) const { return *ptr != *other.ptr; }
   private:
     T *ptr;
 };
 
-#if CYTHON_COMPILING_IN_PYPY && PY_VERSION_HEX < 0x02070600 && !defined(Py_OptimizeFlag)
-  #define Py_OptimizeFlag 0
-#endif
+/* PythonCompatibility */
 #define __PYX_BUILD_PY_SSIZE_T "n"
 #define CYTHON_FORMAT_SSIZE_T "z"
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-  #define __Pyx_PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
-          PyCode_New(a+k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
-  #define __Pyx_DefaultClassType PyClass_Type
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#if PY_VERSION_HEX >= 0x030800A4 && PY_VERSION_HEX < 0x030800B2
-  #define __Pyx_PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
-          PyCode_New(a, 0, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
-#else
-  #define __Pyx_PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
-          PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
+#define __Pyx_BUILTIN_MODULE_NAME "builtins"
+#define __Pyx_DefaultClassType PyType_Type
+#if CYTHON_COMPILING_IN_LIMITED_API
+    #ifndef CO_OPTIMIZED
+    static int CO_OPTIMIZED;
+    #endif
+    #ifndef CO_NEWLOCALS
+    static int CO_NEWLOCALS;
+    #endif
+    #ifndef CO_VARARGS
+    static int CO_VARARGS;
+    #endif
+    #ifndef CO_VARKEYWORDS
+    static int CO_VARKEYWORDS;
+    #endif
+    #ifndef CO_ASYNC_GENERATOR
+    static int CO_ASYNC_GENERATOR;
+    #endif
+    #ifndef CO_GENERATOR
+    static int CO_GENERATOR;
+    #endif
+    #ifndef CO_COROUTINE
+    static int CO_COROUTINE;
+    #endif
+#else
+    #ifndef CO_COROUTINE
+      #define CO_COROUTINE 0x80
+    #endif
+    #ifndef CO_ASYNC_GENERATOR
+      #define CO_ASYNC_GENERATOR 0x200
+    #endif
+#endif
+static int __Pyx_init_co_variables(void);
+#if PY_VERSION_HEX >= 0x030A00B1 || defined(Py_Is)
+  #define __Pyx_Py_Is(x, y)  Py_Is(x, y)
+#else
+  #define __Pyx_Py_Is(x, y) ((x) == (y))
+#endif
+#if PY_VERSION_HEX >= 0x030A00B1 || defined(Py_IsNone)
+  #define __Pyx_Py_IsNone(ob) Py_IsNone(ob)
+#else
+  #define __Pyx_Py_IsNone(ob) __Pyx_Py_Is((ob), Py_None)
 #endif
-  #define __Pyx_DefaultClassType PyType_Type
+#if PY_VERSION_HEX >= 0x030A00B1 || defined(Py_IsTrue)
+  #define __Pyx_Py_IsTrue(ob) Py_IsTrue(ob)
+#else
+  #define __Pyx_Py_IsTrue(ob) __Pyx_Py_Is((ob), Py_True)
 #endif
-#ifndef Py_TPFLAGS_CHECKTYPES
-  #define Py_TPFLAGS_CHECKTYPES 0
+#if PY_VERSION_HEX >= 0x030A00B1 || defined(Py_IsFalse)
+  #define __Pyx_Py_IsFalse(ob) Py_IsFalse(ob)
+#else
+  #define __Pyx_Py_IsFalse(ob) __Pyx_Py_Is((ob), Py_False)
 #endif
-#ifndef Py_TPFLAGS_HAVE_INDEX
-  #define Py_TPFLAGS_HAVE_INDEX 0
+#define __Pyx_NoneAsNull(obj)  (__Pyx_Py_IsNone(obj) ? NULL : (obj))
+#if CYTHON_COMPILING_IN_PYPY
+  #define __Pyx_PyObject_GC_IsFinalized(o) _PyGC_FINALIZED(o)
+#else
+  #define __Pyx_PyObject_GC_IsFinalized(o) PyObject_GC_IsFinalized(o)
 #endif
-#ifndef Py_TPFLAGS_HAVE_NEWBUFFER
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
+#if CYTHON_COMPILING_IN_LIMITED_API
+static unsigned long __Pyx_Runtime_TPFLAGS_SEQUENCE;
+static unsigned long __Pyx_Runtime_TPFLAGS_MAPPING;
+#else
+#define __Pyx_Runtime_TPFLAGS_SEQUENCE Py_TPFLAGS_SEQUENCE
+#define __Pyx_Runtime_TPFLAGS_MAPPING Py_TPFLAGS_MAPPING
 #endif
+static int __Pyx_init_tpflags_variables(void);
 #ifndef Py_TPFLAGS_HAVE_FINALIZE
   #define Py_TPFLAGS_HAVE_FINALIZE 0
 #endif
+#ifndef Py_TPFLAGS_SEQUENCE
+  #define Py_TPFLAGS_SEQUENCE (CYTHON_COMPILING_IN_LIMITED_API ? 0 : 1 << 5)
+#endif
+#ifndef Py_TPFLAGS_MAPPING
+  #define Py_TPFLAGS_MAPPING (CYTHON_COMPILING_IN_LIMITED_API ? 0 : 1 << 6)
+#endif
+#ifndef Py_TPFLAGS_IMMUTABLETYPE
+  #define Py_TPFLAGS_IMMUTABLETYPE (1UL << 8)
+#endif
+#ifndef Py_TPFLAGS_DISALLOW_INSTANTIATION
+  #define Py_TPFLAGS_DISALLOW_INSTANTIATION (1UL << 7)
+#endif
 #ifndef METH_STACKLESS
   #define METH_STACKLESS 0
 #endif
-#if PY_VERSION_HEX <= 0x030700A3 || !defined(METH_FASTCALL)
+#if !defined(METH_FASTCALL) || CYTHON_COMPILING_IN_PYPY
   #ifndef METH_FASTCALL
      #define METH_FASTCALL 0x80
   #endif
@@ -369,118 +703,220 @@ class __Pyx_FakeReference {
   typedef PyObject *(*__Pyx_PyCFunctionFastWithKeywords) (PyObject *self, PyObject *const *args,
                                                           Py_ssize_t nargs, PyObject *kwnames);
 #else
-  #define __Pyx_PyCFunctionFast _PyCFunctionFast
-  #define __Pyx_PyCFunctionFastWithKeywords _PyCFunctionFastWithKeywords
+  #if PY_VERSION_HEX >= 0x030d00A4
+  #  define __Pyx_PyCFunctionFast PyCFunctionFast
+  #  define __Pyx_PyCFunctionFastWithKeywords PyCFunctionFastWithKeywords
+  #else
+  #  define __Pyx_PyCFunctionFast _PyCFunctionFast
+  #  define __Pyx_PyCFunctionFastWithKeywords _PyCFunctionFastWithKeywords
+  #endif
+#endif
+#if CYTHON_VECTORCALL
+  #define __Pyx_METH_FASTCALL METH_FASTCALL
+  #define __Pyx_PyCFunction_FastCall __Pyx_PyCFunctionFast
+  #define __Pyx_PyCFunction_FastCallWithKeywords __Pyx_PyCFunctionFastWithKeywords
+#else
+  #define __Pyx_METH_FASTCALL METH_VARARGS
+  #define __Pyx_PyCFunction_FastCall PyCFunction
+  #define __Pyx_PyCFunction_FastCallWithKeywords PyCFunctionWithKeywords
 #endif
-#if CYTHON_FAST_PYCCALL
-#define __Pyx_PyFastCFunction_Check(func)\
-    ((PyCFunction_Check(func) && (METH_FASTCALL == (PyCFunction_GET_FLAGS(func) & ~(METH_CLASS | METH_STATIC | METH_COEXIST | METH_KEYWORDS | METH_STACKLESS)))))
+#if CYTHON_VECTORCALL
+  #define __pyx_vectorcallfunc vectorcallfunc
+  #define __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET  PY_VECTORCALL_ARGUMENTS_OFFSET
+  #define __Pyx_PyVectorcall_NARGS(n)  PyVectorcall_NARGS((size_t)(n))
 #else
-#define __Pyx_PyFastCFunction_Check(func) 0
+  #define __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET  0
+  #define __Pyx_PyVectorcall_NARGS(n)  ((Py_ssize_t)(n))
+#endif
+#define __Pyx_PyCFunction_CheckExact(func) PyCFunction_CheckExact(func)
+#define __Pyx_CyOrPyCFunction_Check(func)  PyCFunction_Check(func)
+#if CYTHON_COMPILING_IN_CPYTHON
+#define __Pyx_CyOrPyCFunction_GET_FUNCTION(func)  (((PyCFunctionObject*)(func))->m_ml->ml_meth)
+#elif !CYTHON_COMPILING_IN_LIMITED_API
+#define __Pyx_CyOrPyCFunction_GET_FUNCTION(func)  PyCFunction_GET_FUNCTION(func)
+#endif
+#if CYTHON_COMPILING_IN_CPYTHON
+#define __Pyx_CyOrPyCFunction_GET_FLAGS(func)  (((PyCFunctionObject*)(func))->m_ml->ml_flags)
+static CYTHON_INLINE PyObject* __Pyx_CyOrPyCFunction_GET_SELF(PyObject *func) {
+    return (__Pyx_CyOrPyCFunction_GET_FLAGS(func) & METH_STATIC) ? NULL : ((PyCFunctionObject*)func)->m_self;
+}
+#endif
+static CYTHON_INLINE int __Pyx__IsSameCFunction(PyObject *func, void (*cfunc)(void)) {
+#if CYTHON_COMPILING_IN_LIMITED_API
+    return PyCFunction_Check(func) && PyCFunction_GetFunction(func) == (PyCFunction) cfunc;
+#else
+    return PyCFunction_Check(func) && PyCFunction_GET_FUNCTION(func) == (PyCFunction) cfunc;
+#endif
+}
+#define __Pyx_IsSameCFunction(func, cfunc)   __Pyx__IsSameCFunction(func, cfunc)
+#if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030A0000
+  #define __Pyx_PyType_FromModuleAndSpec(m, s, b)  ((void)m, PyType_FromSpecWithBases(s, b))
+#else
+  #define __Pyx_PyType_FromModuleAndSpec(m, s, b)  PyType_FromModuleAndSpec(m, s, b)
+#endif
+#if CYTHON_COMPILING_IN_PYPY
+  typedef PyObject *(*__Pyx_PyCMethod)(PyObject *, PyTypeObject *, PyObject *const *, size_t, PyObject *);
+#else
+  #define __Pyx_PyCMethod  PyCMethod
+#endif
+#ifndef METH_METHOD
+  #define METH_METHOD 0x200
 #endif
 #if CYTHON_COMPILING_IN_PYPY && !defined(PyObject_Malloc)
   #define PyObject_Malloc(s)   PyMem_Malloc(s)
   #define PyObject_Free(p)     PyMem_Free(p)
   #define PyObject_Realloc(p)  PyMem_Realloc(p)
 #endif
-#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX < 0x030400A1
-  #define PyMem_RawMalloc(n)           PyMem_Malloc(n)
-  #define PyMem_RawRealloc(p, n)       PyMem_Realloc(p, n)
-  #define PyMem_RawFree(p)             PyMem_Free(p)
-#endif
-#if CYTHON_COMPILING_IN_PYSTON
-  #define __Pyx_PyCode_HasFreeVars(co)  PyCode_HasFreeVars(co)
-  #define __Pyx_PyFrame_SetLineNumber(frame, lineno) PyFrame_SetLineNumber(frame, lineno)
+#if CYTHON_COMPILING_IN_LIMITED_API
+  #define __Pyx_PyFrame_SetLineNumber(frame, lineno)
+#elif CYTHON_COMPILING_IN_GRAAL && defined(GRAALPY_VERSION_NUM) && GRAALPY_VERSION_NUM > 0x19000000
+  #define __Pyx_PyCode_HasFreeVars(co)  (PyCode_GetNumFree(co) > 0)
+  #define __Pyx_PyFrame_SetLineNumber(frame, lineno) GraalPyFrame_SetLineNumber((frame), (lineno))
+#elif CYTHON_COMPILING_IN_GRAAL
+  #define __Pyx_PyCode_HasFreeVars(co)  (PyCode_GetNumFree(co) > 0)
+  #define __Pyx_PyFrame_SetLineNumber(frame, lineno) _PyFrame_SetLineNumber((frame), (lineno))
 #else
   #define __Pyx_PyCode_HasFreeVars(co)  (PyCode_GetNumFree(co) > 0)
   #define __Pyx_PyFrame_SetLineNumber(frame, lineno)  (frame)->f_lineno = (lineno)
 #endif
-#if !CYTHON_FAST_THREAD_STATE || PY_VERSION_HEX < 0x02070000
+#if CYTHON_COMPILING_IN_LIMITED_API
+  #define __Pyx_PyThreadState_Current PyThreadState_Get()
+#elif !CYTHON_FAST_THREAD_STATE
   #define __Pyx_PyThreadState_Current PyThreadState_GET()
-#elif PY_VERSION_HEX >= 0x03060000
+#elif PY_VERSION_HEX >= 0x030d00A1
+  #define __Pyx_PyThreadState_Current PyThreadState_GetUnchecked()
+#else
   #define __Pyx_PyThreadState_Current _PyThreadState_UncheckedGet()
-#elif PY_VERSION_HEX >= 0x03000000
-  #define __Pyx_PyThreadState_Current PyThreadState_GET()
+#endif
+#if CYTHON_OPAQUE_OBJECTS && CYTHON_COMPILING_IN_LIMITED_API
+    #define __PYX_SHARED_SIZEOF(T) -((int)sizeof(T))
+    #define __PYX_SHARED_RELATIVE_OFFSET Py_RELATIVE_OFFSET
+    #define CYTHON_OPAQUE_SHARED_TYPES 1
 #else
-  #define __Pyx_PyThreadState_Current _PyThreadState_Current
+    #define __PYX_SHARED_SIZEOF(T) sizeof(T)
+    #define __PYX_SHARED_RELATIVE_OFFSET 0
+    #define CYTHON_OPAQUE_SHARED_TYPES 0
 #endif
-#if PY_VERSION_HEX < 0x030700A2 && !defined(PyThread_tss_create) && !defined(Py_tss_NEEDS_INIT)
-#include "pythread.h"
-#define Py_tss_NEEDS_INIT 0
-typedef int Py_tss_t;
-static CYTHON_INLINE int PyThread_tss_create(Py_tss_t *key) {
-  *key = PyThread_create_key();
-  return 0;
-}
-static CYTHON_INLINE Py_tss_t * PyThread_tss_alloc(void) {
-  Py_tss_t *key = (Py_tss_t *)PyObject_Malloc(sizeof(Py_tss_t));
-  *key = Py_tss_NEEDS_INIT;
-  return key;
-}
-static CYTHON_INLINE void PyThread_tss_free(Py_tss_t *key) {
-  PyObject_Free(key);
-}
-static CYTHON_INLINE int PyThread_tss_is_created(Py_tss_t *key) {
-  return *key != Py_tss_NEEDS_INIT;
-}
-static CYTHON_INLINE void PyThread_tss_delete(Py_tss_t *key) {
-  PyThread_delete_key(*key);
-  *key = Py_tss_NEEDS_INIT;
-}
-static CYTHON_INLINE int PyThread_tss_set(Py_tss_t *key, void *value) {
-  return PyThread_set_key_value(*key, value);
-}
-static CYTHON_INLINE void * PyThread_tss_get(Py_tss_t *key) {
-  return PyThread_get_key_value(*key);
+#if CYTHON_USE_MODULE_STATE
+static CYTHON_INLINE void *__Pyx__PyModule_GetState(PyObject *op)
+{
+    void *result;
+    result = PyModule_GetState(op);
+    if (!result)
+        Py_FatalError("Couldn't find the module state");
+    return result;
 }
+#define __Pyx_PyModule_GetState(o) (__pyx_mstatetype *)__Pyx__PyModule_GetState(o)
+#else
+#define __Pyx_PyModule_GetState(op) ((void)op,__pyx_mstate_global)
+#endif
+#define __Pyx_PyObject_GetSlot(obj, name, func_ctype)  __Pyx_PyType_GetSlot(Py_TYPE((PyObject *) obj), name, func_ctype)
+#define __Pyx_PyObject_TryGetSlot(obj, name, func_ctype) __Pyx_PyType_TryGetSlot(Py_TYPE(obj), name, func_ctype)
+#define __Pyx_PyObject_GetSubSlot(obj, sub, name, func_ctype) __Pyx_PyType_GetSubSlot(Py_TYPE(obj), sub, name, func_ctype)
+#define __Pyx_PyObject_TryGetSubSlot(obj, sub, name, func_ctype) __Pyx_PyType_TryGetSubSlot(Py_TYPE(obj), sub, name, func_ctype)
+#if CYTHON_USE_TYPE_SLOTS
+  #define __Pyx_PyType_GetSlot(type, name, func_ctype)  ((type)->name)
+  #define __Pyx_PyType_TryGetSlot(type, name, func_ctype) __Pyx_PyType_GetSlot(type, name, func_ctype)
+  #define __Pyx_PyType_GetSubSlot(type, sub, name, func_ctype) (((type)->sub) ? ((type)->sub->name) : NULL)
+  #define __Pyx_PyType_TryGetSubSlot(type, sub, name, func_ctype) __Pyx_PyType_GetSubSlot(type, sub, name, func_ctype)
+#else
+  #define __Pyx_PyType_GetSlot(type, name, func_ctype)  ((func_ctype) PyType_GetSlot((type), Py_##name))
+  #define __Pyx_PyType_TryGetSlot(type, name, func_ctype)\
+    ((__PYX_LIMITED_VERSION_HEX >= 0x030A0000 ||\
+     (PyType_GetFlags(type) & Py_TPFLAGS_HEAPTYPE) || __Pyx_get_runtime_version() >= 0x030A0000) ?\
+     __Pyx_PyType_GetSlot(type, name, func_ctype) : NULL)
+  #define __Pyx_PyType_GetSubSlot(obj, sub, name, func_ctype) __Pyx_PyType_GetSlot(obj, name, func_ctype)
+  #define __Pyx_PyType_TryGetSubSlot(obj, sub, name, func_ctype) __Pyx_PyType_TryGetSlot(obj, name, func_ctype)
 #endif
 #if CYTHON_COMPILING_IN_CPYTHON || defined(_PyDict_NewPresized)
 #define __Pyx_PyDict_NewPresized(n)  ((n <= 8) ? PyDict_New() : _PyDict_NewPresized(n))
 #else
 #define __Pyx_PyDict_NewPresized(n)  PyDict_New()
 #endif
-#if PY_MAJOR_VERSION >= 3 || CYTHON_FUTURE_DIVISION
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceTrueDivide(x,y)
+#define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
+#define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceTrueDivide(x,y)
+#if CYTHON_COMPILING_IN_CPYTHON && CYTHON_USE_UNICODE_INTERNALS
+#define __Pyx_PyDict_GetItemStrWithError(dict, name)  _PyDict_GetItem_KnownHash(dict, name, ((PyASCIIObject *) name)->hash)
+static CYTHON_INLINE PyObject * __Pyx_PyDict_GetItemStr(PyObject *dict, PyObject *name) {
+    PyObject *res = __Pyx_PyDict_GetItemStrWithError(dict, name);
+    if (res == NULL && PyErr_Occurred()) {
+        PyErr_WriteUnraisable(NULL);
+    }
+    return res;
+}
+#elif !CYTHON_COMPILING_IN_PYPY || PYPY_VERSION_NUM >= 0x07020000
+#define __Pyx_PyDict_GetItemStrWithError  PyDict_GetItemWithError
+#define __Pyx_PyDict_GetItemStr           PyDict_GetItem
+#else
+static CYTHON_INLINE PyObject * __Pyx_PyDict_GetItemStrWithError(PyObject *dict, PyObject *name) {
+#if CYTHON_COMPILING_IN_PYPY
+    return PyDict_GetItem(dict, name);
+#else
+    PyDictEntry *ep;
+    PyDictObject *mp = (PyDictObject*) dict;
+    long hash = ((PyStringObject *) name)->ob_shash;
+    assert(hash != -1);
+    ep = (mp->ma_lookup)(mp, name, hash);
+    if (ep == NULL) {
+        return NULL;
+    }
+    return ep->me_value;
+#endif
+}
+#define __Pyx_PyDict_GetItemStr           PyDict_GetItem
+#endif
+#if CYTHON_USE_TYPE_SLOTS
+  #define __Pyx_PyType_GetFlags(tp)   (((PyTypeObject *)tp)->tp_flags)
+  #define __Pyx_PyType_HasFeature(type, feature)  ((__Pyx_PyType_GetFlags(type) & (feature)) != 0)
 #else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceDivide(x,y)
+  #define __Pyx_PyType_GetFlags(tp)   (PyType_GetFlags((PyTypeObject *)tp))
+  #define __Pyx_PyType_HasFeature(type, feature)  PyType_HasFeature(type, feature)
 #endif
-#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030500A1 && CYTHON_USE_UNICODE_INTERNALS
-#define __Pyx_PyDict_GetItemStr(dict, name)  _PyDict_GetItem_KnownHash(dict, name, ((PyASCIIObject *) name)->hash)
+#define __Pyx_PyObject_GetIterNextFunc(iterator)  __Pyx_PyObject_GetSlot(iterator, tp_iternext, iternextfunc)
+#if CYTHON_USE_TYPE_SPECS
+#define __Pyx_PyHeapTypeObject_GC_Del(obj)  {\
+    PyTypeObject *type = Py_TYPE((PyObject*)obj);\
+    assert(__Pyx_PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE));\
+    PyObject_GC_Del(obj);\
+    Py_DECREF(type);\
+}
 #else
-#define __Pyx_PyDict_GetItemStr(dict, name)  PyDict_GetItem(dict, name)
+#define __Pyx_PyHeapTypeObject_GC_Del(obj)  PyObject_GC_Del(obj)
 #endif
-#if PY_VERSION_HEX > 0x03030000 && defined(PyUnicode_KIND)
-  #define CYTHON_PEP393_ENABLED 1
-  #define __Pyx_PyUnicode_READY(op)       (likely(PyUnicode_IS_READY(op)) ?\
-                                              0 : _PyUnicode_Ready((PyObject *)(op)))
-  #define __Pyx_PyUnicode_GET_LENGTH(u)   PyUnicode_GET_LENGTH(u)
+#if CYTHON_COMPILING_IN_LIMITED_API
+  #define __Pyx_PyUnicode_READY(op)       (0)
+  #define __Pyx_PyUnicode_READ_CHAR(u, i) PyUnicode_ReadChar(u, i)
+  #define __Pyx_PyUnicode_MAX_CHAR_VALUE(u)   ((void)u, 1114111U)
+  #define __Pyx_PyUnicode_KIND(u)         ((void)u, (0))
+  #define __Pyx_PyUnicode_KIND_04(u)      __Pyx_PyUnicode_KIND(u)
+  #define __Pyx_PyUnicode_DATA(u)         ((void*)u)
+  #define __Pyx_PyUnicode_READ(k, d, i)   ((void)k, PyUnicode_ReadChar((PyObject*)(d), i))
+  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != PyUnicode_GetLength(u))
+#else
+  #if PY_VERSION_HEX >= 0x030C0000
+    #define __Pyx_PyUnicode_READY(op)       (0)
+  #else
+    #define __Pyx_PyUnicode_READY(op)       (likely(PyUnicode_IS_READY(op)) ?\
+                                                0 : _PyUnicode_Ready((PyObject *)(op)))
+  #endif
   #define __Pyx_PyUnicode_READ_CHAR(u, i) PyUnicode_READ_CHAR(u, i)
   #define __Pyx_PyUnicode_MAX_CHAR_VALUE(u)   PyUnicode_MAX_CHAR_VALUE(u)
-  #define __Pyx_PyUnicode_KIND(u)         PyUnicode_KIND(u)
+  #define __Pyx_PyUnicode_KIND(u)         ((int)PyUnicode_KIND(u))
   #define __Pyx_PyUnicode_DATA(u)         PyUnicode_DATA(u)
   #define __Pyx_PyUnicode_READ(k, d, i)   PyUnicode_READ(k, d, i)
-  #define __Pyx_PyUnicode_WRITE(k, d, i, ch)  PyUnicode_WRITE(k, d, i, ch)
-  #if defined(PyUnicode_IS_READY) && defined(PyUnicode_GET_SIZE)
-  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != (likely(PyUnicode_IS_READY(u)) ? PyUnicode_GET_LENGTH(u) : PyUnicode_GET_SIZE(u)))
+  #define __Pyx_PyUnicode_WRITE(k, d, i, ch)  PyUnicode_WRITE(k, d, i, (Py_UCS4) ch)
+  #if PY_VERSION_HEX >= 0x030C0000
+    #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != PyUnicode_GET_LENGTH(u))
   #else
-  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != PyUnicode_GET_LENGTH(u))
+    #if CYTHON_COMPILING_IN_CPYTHON
+    #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != (likely(PyUnicode_IS_READY(u)) ? PyUnicode_GET_LENGTH(u) : ((PyCompactUnicodeObject *)(u))->wstr_length))
+    #else
+    #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != (likely(PyUnicode_IS_READY(u)) ? PyUnicode_GET_LENGTH(u) : PyUnicode_GET_SIZE(u)))
+    #endif
   #endif
-#else
-  #define CYTHON_PEP393_ENABLED 0
-  #define PyUnicode_1BYTE_KIND  1
-  #define PyUnicode_2BYTE_KIND  2
-  #define PyUnicode_4BYTE_KIND  4
-  #define __Pyx_PyUnicode_READY(op)       (0)
-  #define __Pyx_PyUnicode_GET_LENGTH(u)   PyUnicode_GET_SIZE(u)
-  #define __Pyx_PyUnicode_READ_CHAR(u, i) ((Py_UCS4)(PyUnicode_AS_UNICODE(u)[i]))
-  #define __Pyx_PyUnicode_MAX_CHAR_VALUE(u)   ((sizeof(Py_UNICODE) == 2) ? 65535 : 1114111)
-  #define __Pyx_PyUnicode_KIND(u)         (sizeof(Py_UNICODE))
-  #define __Pyx_PyUnicode_DATA(u)         ((void*)PyUnicode_AS_UNICODE(u))
-  #define __Pyx_PyUnicode_READ(k, d, i)   ((void)(k), (Py_UCS4)(((Py_UNICODE*)d)[i]))
-  #define __Pyx_PyUnicode_WRITE(k, d, i, ch)  (((void)(k)), ((Py_UNICODE*)d)[i] = ch)
-  #define __Pyx_PyUnicode_IS_TRUE(u)      (0 != PyUnicode_GET_SIZE(u))
+  static CYTHON_INLINE int __Pyx_PyUnicode_KIND_04(PyObject *o) {
+      return __Pyx_PyUnicode_KIND(o) - (int) !!PyUnicode_IS_ASCII(o);
+  }
 #endif
 #if CYTHON_COMPILING_IN_PYPY
   #define __Pyx_PyUnicode_Concat(a, b)      PyNumber_Add(a, b)
@@ -490,148 +926,470 @@ static CYTHON_INLINE void * PyThread_tss_get(Py_tss_t *key) {
   #define __Pyx_PyUnicode_ConcatSafe(a, b)  ((unlikely((a) == Py_None) || unlikely((b) == Py_None)) ?\
       PyNumber_Add(a, b) : __Pyx_PyUnicode_Concat(a, b))
 #endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyUnicode_Contains)
-  #define PyUnicode_Contains(u, s)  PySequence_Contains(u, s)
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyByteArray_Check)
-  #define PyByteArray_Check(obj)  PyObject_TypeCheck(obj, &PyByteArray_Type)
-#endif
-#if CYTHON_COMPILING_IN_PYPY && !defined(PyObject_Format)
-  #define PyObject_Format(obj, fmt)  PyObject_CallMethod(obj, "__format__", "O", fmt)
+#if CYTHON_COMPILING_IN_PYPY
+  #if !defined(PyUnicode_DecodeUnicodeEscape)
+    #define PyUnicode_DecodeUnicodeEscape(s, size, errors)  PyUnicode_Decode(s, size, "unicode_escape", errors)
+  #endif
+  #if !defined(PyUnicode_Contains)
+    #define PyUnicode_Contains(u, s)  PySequence_Contains(u, s)
+  #endif
+  #if !defined(PyByteArray_Check)
+    #define PyByteArray_Check(obj)  PyObject_TypeCheck(obj, &PyByteArray_Type)
+  #endif
+  #if !defined(PyObject_Format)
+    #define PyObject_Format(obj, fmt)  PyObject_CallMethod(obj, "__format__", "O", fmt)
+  #endif
 #endif
-#define __Pyx_PyString_FormatSafe(a, b)   ((unlikely((a) == Py_None || (PyString_Check(b) && !PyString_CheckExact(b)))) ? PyNumber_Remainder(a, b) : __Pyx_PyString_Format(a, b))
 #define __Pyx_PyUnicode_FormatSafe(a, b)  ((unlikely((a) == Py_None || (PyUnicode_Check(b) && !PyUnicode_CheckExact(b)))) ? PyNumber_Remainder(a, b) : PyUnicode_Format(a, b))
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyString_Format(a, b)  PyUnicode_Format(a, b)
+#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030E0000
+  #define __Pyx_PySequence_ListKeepNew(obj)\
+    (likely(PyList_CheckExact(obj) && PyUnstable_Object_IsUniquelyReferenced(obj)) ? __Pyx_NewRef(obj) : PySequence_List(obj))
+#elif CYTHON_COMPILING_IN_CPYTHON
+  #define __Pyx_PySequence_ListKeepNew(obj)\
+    (likely(PyList_CheckExact(obj) && Py_REFCNT(obj) == 1) ? __Pyx_NewRef(obj) : PySequence_List(obj))
 #else
-  #define __Pyx_PyString_Format(a, b)  PyString_Format(a, b)
+  #define __Pyx_PySequence_ListKeepNew(obj)  PySequence_List(obj)
 #endif
-#if PY_MAJOR_VERSION < 3 && !defined(PyObject_ASCII)
-  #define PyObject_ASCII(o)            PyObject_Repr(o)
+#ifndef PySet_CheckExact
+  #define PySet_CheckExact(obj)        Py_IS_TYPE(obj, &PySet_Type)
 #endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyStringObject               PyUnicodeObject
-  #define PyString_Type                PyUnicode_Type
-  #define PyString_Check               PyUnicode_Check
-  #define PyString_CheckExact          PyUnicode_CheckExact
-#ifndef PyObject_Unicode
-  #define PyObject_Unicode             PyObject_Str
+enum __Pyx_ReferenceSharing {
+  __Pyx_ReferenceSharing_DefinitelyUnique, // We created it so we know it's unshared - no need to check
+  __Pyx_ReferenceSharing_OwnStrongReference,
+  __Pyx_ReferenceSharing_FunctionArgument,
+  __Pyx_ReferenceSharing_SharedReference, // Never trust it to be unshared because it's a global or similar
+};
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && PY_VERSION_HEX >= 0x030E0000
+#define __Pyx_IS_UNIQUELY_REFERENCED(o, sharing)\
+    (sharing == __Pyx_ReferenceSharing_DefinitelyUnique ? 1 :\
+      (sharing == __Pyx_ReferenceSharing_FunctionArgument ? PyUnstable_Object_IsUniqueReferencedTemporary(o) :\
+      (sharing == __Pyx_ReferenceSharing_OwnStrongReference ? PyUnstable_Object_IsUniquelyReferenced(o) : 0)))
+#elif (CYTHON_COMPILING_IN_CPYTHON && !CYTHON_COMPILING_IN_CPYTHON_FREETHREADING) || CYTHON_COMPILING_IN_LIMITED_API
+#define __Pyx_IS_UNIQUELY_REFERENCED(o, sharing) (((void)sharing), Py_REFCNT(o) == 1)
+#else
+#define __Pyx_IS_UNIQUELY_REFERENCED(o, sharing) (((void)o), ((void)sharing), 0)
 #endif
+#if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+  #define __Pyx_PyList_GetItemRef(o, i) PyList_GetItemRef(o, i)
+#elif CYTHON_AVOID_BORROWED_REFS || CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+  #if CYTHON_COMPILING_IN_LIMITED_API || !CYTHON_ASSUME_SAFE_MACROS
+    #define __Pyx_PyList_GetItemRef(o, i) (likely((i) >= 0) ? PySequence_GetItem(o, i) : (PyErr_SetString(PyExc_IndexError, "list index out of range"), (PyObject*)NULL))
+  #else
+    #define __Pyx_PyList_GetItemRef(o, i) PySequence_ITEM(o, i)
+  #endif
+#elif CYTHON_COMPILING_IN_LIMITED_API || !(CYTHON_ASSUME_SAFE_MACROS && CYTHON_ASSUME_SAFE_SIZE)
+  #define __Pyx_PyList_GetItemRef(o, i) __Pyx_XNewRef(PyList_GetItem(o, i))
+#else
+  #define __Pyx_PyList_GetItemRef(o, i) (likely(__Pyx_is_valid_index(i, PyList_GET_SIZE(o))) ?\
+    __Pyx_NewRef(PyList_GET_ITEM(o, i)) : (PyErr_SetString(PyExc_IndexError, "list index out of range"), (PyObject*)NULL))
 #endif
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyBaseString_Check(obj) PyUnicode_Check(obj)
-  #define __Pyx_PyBaseString_CheckExact(obj) PyUnicode_CheckExact(obj)
+#if CYTHON_AVOID_BORROWED_REFS || CYTHON_COMPILING_IN_LIMITED_API
+  #define __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared)  ((void)(unsafe_shared),\
+      __Pyx_PyList_GetItemRef(o, i))
+#elif CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+  #if CYTHON_ASSUME_SAFE_MACROS
+  #define __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared) (\
+      __Pyx_IS_UNIQUELY_REFERENCED(o, unsafe_shared) ?\
+      __Pyx_NewRef(PyList_GET_ITEM(o, i)) : __Pyx_PyList_GetItemRef(o, i))
+  #else
+  #define __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared) (\
+      __Pyx_IS_UNIQUELY_REFERENCED(o, unsafe_shared) ?\
+      __Pyx_XNewRef(PyList_GetItem(o, i)) : __Pyx_PyList_GetItemRef(o, i))
+  #endif
+#elif CYTHON_ASSUME_SAFE_MACROS
+  #define __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared)  ((void)(unsafe_shared),\
+      __Pyx_NewRef(PyList_GET_ITEM(o, i)))
 #else
-  #define __Pyx_PyBaseString_Check(obj) (PyString_Check(obj) || PyUnicode_Check(obj))
-  #define __Pyx_PyBaseString_CheckExact(obj) (PyString_CheckExact(obj) || PyUnicode_CheckExact(obj))
+  #define __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared)  ((void)(unsafe_shared),\
+      __Pyx_XNewRef(PyList_GetItem(o, i)))
 #endif
-#ifndef PySet_CheckExact
-  #define PySet_CheckExact(obj)        (Py_TYPE(obj) == &PySet_Type)
+#if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+#define __Pyx_PyDict_GetItemRef(dict, key, result) PyDict_GetItemRef(dict, key, result)
+#elif CYTHON_AVOID_BORROWED_REFS || CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+static CYTHON_INLINE int __Pyx_PyDict_GetItemRef(PyObject *dict, PyObject *key, PyObject **result) {
+  *result = PyObject_GetItem(dict, key);
+  if (*result == NULL) {
+    if (PyErr_ExceptionMatches(PyExc_KeyError)) {
+      PyErr_Clear();
+      return 0;
+    }
+    return -1;
+  }
+  return 1;
+}
+#else
+static CYTHON_INLINE int __Pyx_PyDict_GetItemRef(PyObject *dict, PyObject *key, PyObject **result) {
+  *result = PyDict_GetItemWithError(dict, key);
+  if (*result == NULL) {
+    return PyErr_Occurred() ? -1 : 0;
+  }
+  Py_INCREF(*result);
+  return 1;
+}
 #endif
-#if PY_VERSION_HEX >= 0x030900A4
-  #define __Pyx_SET_REFCNT(obj, refcnt) Py_SET_REFCNT(obj, refcnt)
-  #define __Pyx_SET_SIZE(obj, size) Py_SET_SIZE(obj, size)
+#if defined(CYTHON_DEBUG_VISIT_CONST) && CYTHON_DEBUG_VISIT_CONST
+  #define __Pyx_VISIT_CONST(obj)  Py_VISIT(obj)
 #else
-  #define __Pyx_SET_REFCNT(obj, refcnt) Py_REFCNT(obj) = (refcnt)
-  #define __Pyx_SET_SIZE(obj, size) Py_SIZE(obj) = (size)
+  #define __Pyx_VISIT_CONST(obj)
 #endif
 #if CYTHON_ASSUME_SAFE_MACROS
+  #define __Pyx_PySequence_ITEM(o, i) PySequence_ITEM(o, i)
   #define __Pyx_PySequence_SIZE(seq)  Py_SIZE(seq)
+  #define __Pyx_PyTuple_SET_ITEM(o, i, v) (PyTuple_SET_ITEM(o, i, v), (0))
+  #define __Pyx_PyTuple_GET_ITEM(o, i) PyTuple_GET_ITEM(o, i)
+  #define __Pyx_PyList_SET_ITEM(o, i, v) (PyList_SET_ITEM(o, i, v), (0))
+  #define __Pyx_PyList_GET_ITEM(o, i) PyList_GET_ITEM(o, i)
 #else
+  #define __Pyx_PySequence_ITEM(o, i) PySequence_GetItem(o, i)
   #define __Pyx_PySequence_SIZE(seq)  PySequence_Size(seq)
+  #define __Pyx_PyTuple_SET_ITEM(o, i, v) PyTuple_SetItem(o, i, v)
+  #define __Pyx_PyTuple_GET_ITEM(o, i) PyTuple_GetItem(o, i)
+  #define __Pyx_PyList_SET_ITEM(o, i, v) PyList_SetItem(o, i, v)
+  #define __Pyx_PyList_GET_ITEM(o, i) PyList_GetItem(o, i)
 #endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyIntObject                  PyLongObject
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define PyNumber_Int                 PyNumber_Long
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBoolObject                 PyLongObject
-#endif
-#if PY_MAJOR_VERSION >= 3 && CYTHON_COMPILING_IN_PYPY
-  #ifndef PyUnicode_InternFromString
-    #define PyUnicode_InternFromString(s) PyUnicode_FromString(s)
-  #endif
-#endif
-#if PY_VERSION_HEX < 0x030200A4
-  typedef long Py_hash_t;
-  #define __Pyx_PyInt_FromHash_t PyInt_FromLong
-  #define __Pyx_PyInt_AsHash_t   PyInt_AsLong
-#else
-  #define __Pyx_PyInt_FromHash_t PyInt_FromSsize_t
-  #define __Pyx_PyInt_AsHash_t   PyInt_AsSsize_t
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyMethod_New(func, self, klass) ((self) ? ((void)(klass), PyMethod_New(func, self)) : __Pyx_NewRef(func))
-#else
-  #define __Pyx_PyMethod_New(func, self, klass) PyMethod_New(func, self, klass)
-#endif
-#if CYTHON_USE_ASYNC_SLOTS
-  #if PY_VERSION_HEX >= 0x030500B1
-    #define __Pyx_PyAsyncMethodsStruct PyAsyncMethods
-    #define __Pyx_PyType_AsAsync(obj) (Py_TYPE(obj)->tp_as_async)
-  #else
-    #define __Pyx_PyType_AsAsync(obj) ((__Pyx_PyAsyncMethodsStruct*) (Py_TYPE(obj)->tp_reserved))
-  #endif
+#if CYTHON_ASSUME_SAFE_SIZE
+  #define __Pyx_PyTuple_GET_SIZE(o) PyTuple_GET_SIZE(o)
+  #define __Pyx_PyList_GET_SIZE(o) PyList_GET_SIZE(o)
+  #define __Pyx_PySet_GET_SIZE(o) PySet_GET_SIZE(o)
+  #define __Pyx_PyDict_GET_SIZE(o) PyDict_GET_SIZE(o)
+  #define __Pyx_PyBytes_GET_SIZE(o) PyBytes_GET_SIZE(o)
+  #define __Pyx_PyByteArray_GET_SIZE(o) PyByteArray_GET_SIZE(o)
+  #define __Pyx_PyUnicode_GET_LENGTH(o) PyUnicode_GET_LENGTH(o)
+#else
+  #define __Pyx_PyTuple_GET_SIZE(o) PyTuple_Size(o)
+  #define __Pyx_PyList_GET_SIZE(o) PyList_Size(o)
+  #define __Pyx_PySet_GET_SIZE(o) PySet_Size(o)
+  #define __Pyx_PyDict_GET_SIZE(o) PyDict_Size(o)
+  #define __Pyx_PyBytes_GET_SIZE(o) PyBytes_Size(o)
+  #define __Pyx_PyByteArray_GET_SIZE(o) PyByteArray_Size(o)
+  #define __Pyx_PyUnicode_GET_LENGTH(o) PyUnicode_GetLength(o)
+#endif
+#if CYTHON_COMPILING_IN_PYPY && !defined(PyUnicode_InternFromString)
+  #define PyUnicode_InternFromString(s) PyUnicode_FromString(s)
+#endif
+#define __Pyx_PyLong_FromHash_t PyLong_FromSsize_t
+#define __Pyx_PyLong_AsHash_t   __Pyx_PyIndex_AsSsize_t
+#if __PYX_LIMITED_VERSION_HEX >= 0x030A0000
+    #define __Pyx_PySendResult PySendResult
+#else
+    typedef enum {
+        PYGEN_RETURN = 0,
+        PYGEN_ERROR = -1,
+        PYGEN_NEXT = 1,
+    } __Pyx_PySendResult;
+#endif
+#if CYTHON_COMPILING_IN_LIMITED_API || PY_VERSION_HEX < 0x030A00A3
+  typedef __Pyx_PySendResult (*__Pyx_pyiter_sendfunc)(PyObject *iter, PyObject *value, PyObject **result);
+#else
+  #define __Pyx_pyiter_sendfunc sendfunc
+#endif
+#if !CYTHON_USE_AM_SEND
+#define __PYX_HAS_PY_AM_SEND 0
+#elif __PYX_LIMITED_VERSION_HEX >= 0x030A0000
+#define __PYX_HAS_PY_AM_SEND 1
 #else
-  #define __Pyx_PyType_AsAsync(obj) NULL
+#define __PYX_HAS_PY_AM_SEND 2  // our own backported implementation
 #endif
-#ifndef __Pyx_PyAsyncMethodsStruct
+#if __PYX_HAS_PY_AM_SEND < 2
+    #define __Pyx_PyAsyncMethodsStruct PyAsyncMethods
+#else
     typedef struct {
         unaryfunc am_await;
         unaryfunc am_aiter;
         unaryfunc am_anext;
+        __Pyx_pyiter_sendfunc am_send;
     } __Pyx_PyAsyncMethodsStruct;
+    #define __Pyx_SlotTpAsAsync(s) ((PyAsyncMethods*)(s))
 #endif
-
-#if defined(WIN32) || defined(MS_WINDOWS)
-  #define _USE_MATH_DEFINES
+#if CYTHON_USE_AM_SEND && PY_VERSION_HEX < 0x030A00F0
+    #define __Pyx_TPFLAGS_HAVE_AM_SEND (1UL << 21)
+#else
+    #define __Pyx_TPFLAGS_HAVE_AM_SEND (0)
 #endif
-#include <math.h>
-#ifdef NAN
-#define __PYX_NAN() ((float) NAN)
+#if CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX < 0x030A0000
+#ifdef __cplusplus
+extern "C"
+#endif
+PyAPI_FUNC(void *) PyMem_Calloc(size_t nelem, size_t elsize);
+#endif
+#if CYTHON_COMPILING_IN_LIMITED_API
+static int __Pyx_init_co_variable(PyObject *inspect, const char* name, int *write_to) {
+    int value;
+    PyObject *py_value = PyObject_GetAttrString(inspect, name);
+    if (!py_value) return 0;
+    value = (int) PyLong_AsLong(py_value);
+    Py_DECREF(py_value);
+    *write_to = value;
+    return value != -1 || !PyErr_Occurred();
+}
+static int __Pyx_init_co_variables(void) {
+    PyObject *inspect;
+    int result;
+    inspect = PyImport_ImportModule("inspect");
+    result =
+#if !defined(CO_OPTIMIZED)
+        __Pyx_init_co_variable(inspect, "CO_OPTIMIZED", &CO_OPTIMIZED) &&
+#endif
+#if !defined(CO_NEWLOCALS)
+        __Pyx_init_co_variable(inspect, "CO_NEWLOCALS", &CO_NEWLOCALS) &&
+#endif
+#if !defined(CO_VARARGS)
+        __Pyx_init_co_variable(inspect, "CO_VARARGS", &CO_VARARGS) &&
+#endif
+#if !defined(CO_VARKEYWORDS)
+        __Pyx_init_co_variable(inspect, "CO_VARKEYWORDS", &CO_VARKEYWORDS) &&
+#endif
+#if !defined(CO_ASYNC_GENERATOR)
+        __Pyx_init_co_variable(inspect, "CO_ASYNC_GENERATOR", &CO_ASYNC_GENERATOR) &&
+#endif
+#if !defined(CO_GENERATOR)
+        __Pyx_init_co_variable(inspect, "CO_GENERATOR", &CO_GENERATOR) &&
+#endif
+#if !defined(CO_COROUTINE)
+        __Pyx_init_co_variable(inspect, "CO_COROUTINE", &CO_COROUTINE) &&
+#endif
+        1;
+    Py_DECREF(inspect);
+    return result ? 0 : -1;
+}
+static int __Pyx_init_tpflags_bitcount(unsigned long flag) {
+    int count = 0;
+    while (flag) {
+        count += (int) (flag & 1);
+        flag >>= 1;
+    }
+    return count;
+}
+static int __Pyx_init_tpflags_variables(void) {
+    if (__Pyx_Runtime_TPFLAGS_SEQUENCE != 0 && __Pyx_Runtime_TPFLAGS_MAPPING != 0) {
+        return 0;
+    }
+    PyObject *collections_abc = PyImport_ImportModule("collections.abc");
+    if (!collections_abc) return -1;
+    int result = 0;
+    PyObject *sequence = NULL, *mapping = NULL;
+#if __PYX_LIMITED_VERSION_HEX >= 0x030D0000
+    if (PyObject_GetOptionalAttrString(collections_abc, "Sequence", &sequence) != 1) goto fail;
+    if (PyObject_GetOptionalAttrString(collections_abc, "Mapping", &mapping) != 1) goto fail;
 #else
-static CYTHON_INLINE float __PYX_NAN() {
-  float value;
-  memset(&value, 0xFF, sizeof(value));
-  return value;
+    sequence = PyObject_GetAttrString(collections_abc, "Sequence");
+    if (!sequence) goto fail_attr_lookup;
+    mapping = PyObject_GetAttrString(collections_abc, "Mapping");
+    if (!mapping) goto fail_attr_lookup;
+#endif
+    if (!PyType_Check(sequence) || !PyType_Check(mapping)) goto fail;
+    {
+        unsigned long sequence_flags = PyType_GetFlags((PyTypeObject*)sequence);
+        unsigned long mapping_flags = PyType_GetFlags((PyTypeObject*)mapping);
+        unsigned long mutual_flags = sequence_flags & mapping_flags;
+        sequence_flags = sequence_flags ^ mutual_flags;
+        mapping_flags = mapping_flags ^ mutual_flags;
+        if (__Pyx_Runtime_TPFLAGS_SEQUENCE == 0 && __Pyx_init_tpflags_bitcount(sequence_flags) == 1) {
+            __Pyx_Runtime_TPFLAGS_SEQUENCE = sequence_flags;
+        }
+        if (__Pyx_Runtime_TPFLAGS_MAPPING == 0 && __Pyx_init_tpflags_bitcount(mapping_flags) == 1) {
+            __Pyx_Runtime_TPFLAGS_MAPPING = mapping_flags;
+        }
+    }
+    cleanup:
+    Py_XDECREF(mapping);
+    Py_XDECREF(sequence);
+    Py_DECREF(collections_abc);
+    return result;
+#if __PYX_LIMITED_VERSION_HEX < 0x030D0000
+    fail_attr_lookup:
+    if (PyErr_ExceptionMatches(PyExc_AttributeError)) {
+        PyErr_Clear();
+    }
+#endif
+    fail:
+    result = PyErr_Occurred() ? -1 : 0;
+    goto cleanup;
+}
+#else
+static int __Pyx_init_co_variables(void) {
+    return 0;  // It's a limited API-only feature
+}
+static int __Pyx_init_tpflags_variables(void) {
+    return 0;  // It's a limited API-only feature
 }
 #endif
+
+/* MathInitCode */
+#if defined(_WIN32) || defined(WIN32) || defined(MS_WINDOWS)
+  #ifndef _USE_MATH_DEFINES
+    #define _USE_MATH_DEFINES
+  #endif
+#endif
+#include <math.h>
 #if defined(__CYGWIN__) && defined(_LDBL_EQ_DBL)
 #define __Pyx_truncl trunc
 #else
 #define __Pyx_truncl truncl
 #endif
 
-#define __PYX_MARK_ERR_POS(f_index, lineno) \
-    { __pyx_filename = __pyx_f[f_index]; (void)__pyx_filename; __pyx_lineno = lineno; (void)__pyx_lineno; __pyx_clineno = __LINE__; (void)__pyx_clineno; }
+#ifndef CYTHON_CLINE_IN_TRACEBACK_RUNTIME
+#define CYTHON_CLINE_IN_TRACEBACK_RUNTIME 0
+#endif
+#ifndef CYTHON_CLINE_IN_TRACEBACK
+#define CYTHON_CLINE_IN_TRACEBACK CYTHON_CLINE_IN_TRACEBACK_RUNTIME
+#endif
+#if CYTHON_CLINE_IN_TRACEBACK
+#define __PYX_MARK_ERR_POS(f_index, lineno)  { __pyx_filename = __pyx_f[f_index]; (void) __pyx_filename; __pyx_lineno = lineno; (void) __pyx_lineno; __pyx_clineno = __LINE__; (void) __pyx_clineno; }
+#else
+#define __PYX_MARK_ERR_POS(f_index, lineno)  { __pyx_filename = __pyx_f[f_index]; (void) __pyx_filename; __pyx_lineno = lineno; (void) __pyx_lineno; (void) __pyx_clineno; }
+#endif
 #define __PYX_ERR(f_index, lineno, Ln_error) \
     { __PYX_MARK_ERR_POS(f_index, lineno) goto Ln_error; }
 
-#ifndef __PYX_EXTERN_C
-  #ifdef __cplusplus
-    #define __PYX_EXTERN_C extern "C"
-  #else
-    #define __PYX_EXTERN_C extern
-  #endif
+#ifdef CYTHON_EXTERN_C
+    #undef __PYX_EXTERN_C
+    #define __PYX_EXTERN_C CYTHON_EXTERN_C
+#elif defined(__PYX_EXTERN_C)
+    #ifdef _MSC_VER
+    #pragma message ("Please do not define the '__PYX_EXTERN_C' macro externally. Use 'CYTHON_EXTERN_C' instead.")
+    #else
+    #warning Please do not define the '__PYX_EXTERN_C' macro externally. Use 'CYTHON_EXTERN_C' instead.
+    #endif
+#else
+    #define __PYX_EXTERN_C extern "C++"
 #endif
 
 #define __PYX_HAVE__overload__bind
 #define __PYX_HAVE_API__overload__bind
 /* Early includes */
+#include <string.h>
+#include <stdio.h>
+
+    #if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+    static CYTHON_INLINE PyObject *
+    __Pyx_CAPI_PyList_GetItemRef(PyObject *list, Py_ssize_t index)
+    {
+        PyObject *item = PyList_GetItem(list, index);
+        Py_XINCREF(item);
+        return item;
+    }
+    #else
+    #define __Pyx_CAPI_PyList_GetItemRef PyList_GetItemRef
+    #endif
+
+    #if CYTHON_COMPILING_IN_LIMITED_API || PY_VERSION_HEX < 0x030d0000
+    static CYTHON_INLINE int
+    __Pyx_CAPI_PyList_Extend(PyObject *list, PyObject *iterable)
+    {
+        return PyList_SetSlice(list, PY_SSIZE_T_MAX, PY_SSIZE_T_MAX, iterable);
+    }
+
+    static CYTHON_INLINE int
+    __Pyx_CAPI_PyList_Clear(PyObject *list)
+    {
+        return PyList_SetSlice(list, 0, PY_SSIZE_T_MAX, NULL);
+    }
+    #else
+    #define __Pyx_CAPI_PyList_Extend PyList_Extend
+    #define __Pyx_CAPI_PyList_Clear PyList_Clear
+    #endif
+    
+#include <stdint.h>
+#include <stddef.h>
+
+    #if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+    static CYTHON_INLINE int
+    __Pyx_CAPI_PyDict_GetItemStringRef(PyObject *mp, const char *key, PyObject **result)
+    {
+        int res;
+        PyObject *key_obj = PyUnicode_FromString(key);
+        if (key_obj == NULL) {
+            *result = NULL;
+            return -1;
+        }
+        res = __Pyx_PyDict_GetItemRef(mp, key_obj, result);
+        Py_DECREF(key_obj);
+        return res;
+    }
+    #else
+    #define __Pyx_CAPI_PyDict_GetItemStringRef PyDict_GetItemStringRef
+    #endif
+    #if PY_VERSION_HEX < 0x030d0000 || (CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030F0000)
+    static CYTHON_INLINE int
+    __Pyx_CAPI_PyDict_SetDefaultRef(PyObject *d, PyObject *key, PyObject *default_value,
+                        PyObject **result)
+    {
+        PyObject *value;
+        if (__Pyx_PyDict_GetItemRef(d, key, &value) < 0) {
+            // get error
+            if (result) {
+                *result = NULL;
+            }
+            return -1;
+        }
+        if (value != NULL) {
+            // present
+            if (result) {
+                *result = value;
+            }
+            else {
+                Py_DECREF(value);
+            }
+            return 1;
+        }
+
+        // missing: set the item
+        if (PyDict_SetItem(d, key, default_value) < 0) {
+            // set error
+            if (result) {
+                *result = NULL;
+            }
+            return -1;
+        }
+        if (result) {
+            Py_INCREF(default_value);
+            *result = default_value;
+        }
+        return 0;
+    }
+    #else
+    #define __Pyx_CAPI_PyDict_SetDefaultRef PyDict_SetDefaultRef
+    #endif
+    
+
+    #if PY_VERSION_HEX < 0x030d0000
+    static CYTHON_INLINE int __Pyx_PyWeakref_GetRef(PyObject *ref, PyObject **pobj)
+    {
+        PyObject *obj = PyWeakref_GetObject(ref);
+        if (obj == NULL) {
+            // SystemError if ref is NULL
+            *pobj = NULL;
+            return -1;
+        }
+        if (obj == Py_None) {
+            *pobj = NULL;
+            return 0;
+        }
+        Py_INCREF(obj);
+        *pobj = obj;
+        return 1;
+    }
+    #else
+    #define __Pyx_PyWeakref_GetRef PyWeakref_GetRef
+    #endif
+    
+#include "pythread.h"
+
+    #if (CYTHON_COMPILING_IN_PYPY && PYPY_VERSION_NUM < 0x07030600) && !defined(PyContextVar_Get)
+    #define PyContextVar_Get(var, d, v)         ((d) ?             ((void)(var), Py_INCREF(d), (v)[0] = (d), 0) :             ((v)[0] = NULL, 0)         )
+    #endif
+    
+#include "ios"
+#include "new"
+#include "stdexcept"
+#include "typeinfo"
+#include <vector>
+
+    static PyObject* ovl_type_mro(PyTypeObject *type) {
+        return type->tp_mro;
+    }
+    
 #ifdef _OPENMP
 #include <omp.h>
 #endif /* _OPENMP */
@@ -640,12 +1398,17 @@ static CYTHON_INLINE float __PYX_NAN() {
 #define CYTHON_WITHOUT_ASSERTIONS
 #endif
 
-typedef struct {PyObject **p; const char *s; const Py_ssize_t n; const char* encoding;
-                const char is_unicode; const char is_str; const char intern; } __Pyx_StringTabEntry;
-
+#ifdef CYTHON_FREETHREADING_COMPATIBLE
+#if CYTHON_FREETHREADING_COMPATIBLE
+#define __Pyx_FREETHREADING_COMPATIBLE Py_MOD_GIL_NOT_USED
+#else
+#define __Pyx_FREETHREADING_COMPATIBLE Py_MOD_GIL_USED
+#endif
+#else
+#define __Pyx_FREETHREADING_COMPATIBLE Py_MOD_GIL_USED
+#endif
 #define __PYX_DEFAULT_STRING_ENCODING_IS_ASCII 0
 #define __PYX_DEFAULT_STRING_ENCODING_IS_UTF8 0
-#define __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT (PY_MAJOR_VERSION >= 3 && __PYX_DEFAULT_STRING_ENCODING_IS_UTF8)
 #define __PYX_DEFAULT_STRING_ENCODING ""
 #define __Pyx_PyObject_FromString __Pyx_PyBytes_FromString
 #define __Pyx_PyObject_FromStringAndSize __Pyx_PyBytes_FromStringAndSize
@@ -680,139 +1443,150 @@ static CYTHON_INLINE int __Pyx_is_valid_index(Py_ssize_t i, Py_ssize_t limit) {
 #else
     #define __Pyx_sst_abs(value) ((value<0) ? -value : value)
 #endif
+static CYTHON_INLINE Py_ssize_t __Pyx_ssize_strlen(const char *s);
 static CYTHON_INLINE const char* __Pyx_PyObject_AsString(PyObject*);
 static CYTHON_INLINE const char* __Pyx_PyObject_AsStringAndSize(PyObject*, Py_ssize_t* length);
-#define __Pyx_PyByteArray_FromString(s) PyByteArray_FromStringAndSize((const char*)s, strlen((const char*)s))
+static CYTHON_INLINE PyObject* __Pyx_PyByteArray_FromString(const char*);
 #define __Pyx_PyByteArray_FromStringAndSize(s, l) PyByteArray_FromStringAndSize((const char*)s, l)
 #define __Pyx_PyBytes_FromString        PyBytes_FromString
 #define __Pyx_PyBytes_FromStringAndSize PyBytes_FromStringAndSize
 static CYTHON_INLINE PyObject* __Pyx_PyUnicode_FromString(const char*);
-#if PY_MAJOR_VERSION < 3
-    #define __Pyx_PyStr_FromString        __Pyx_PyBytes_FromString
-    #define __Pyx_PyStr_FromStringAndSize __Pyx_PyBytes_FromStringAndSize
-#else
-    #define __Pyx_PyStr_FromString        __Pyx_PyUnicode_FromString
-    #define __Pyx_PyStr_FromStringAndSize __Pyx_PyUnicode_FromStringAndSize
-#endif
-#define __Pyx_PyBytes_AsWritableString(s)     ((char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyBytes_AsWritableSString(s)    ((signed char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyBytes_AsWritableUString(s)    ((unsigned char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyBytes_AsString(s)     ((const char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyBytes_AsSString(s)    ((const signed char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyBytes_AsUString(s)    ((const unsigned char*) PyBytes_AS_STRING(s))
-#define __Pyx_PyObject_AsWritableString(s)    ((char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsWritableSString(s)    ((signed char*) __Pyx_PyObject_AsString(s))
-#define __Pyx_PyObject_AsWritableUString(s)    ((unsigned char*) __Pyx_PyObject_AsString(s))
+#if CYTHON_ASSUME_SAFE_MACROS
+    #define __Pyx_PyBytes_AsWritableString(s)     ((char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyBytes_AsWritableSString(s)    ((signed char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyBytes_AsWritableUString(s)    ((unsigned char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyBytes_AsString(s)     ((const char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyBytes_AsSString(s)    ((const signed char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyBytes_AsUString(s)    ((const unsigned char*) PyBytes_AS_STRING(s))
+    #define __Pyx_PyByteArray_AsString(s) PyByteArray_AS_STRING(s)
+#else
+    #define __Pyx_PyBytes_AsWritableString(s)     ((char*) PyBytes_AsString(s))
+    #define __Pyx_PyBytes_AsWritableSString(s)    ((signed char*) PyBytes_AsString(s))
+    #define __Pyx_PyBytes_AsWritableUString(s)    ((unsigned char*) PyBytes_AsString(s))
+    #define __Pyx_PyBytes_AsString(s)     ((const char*) PyBytes_AsString(s))
+    #define __Pyx_PyBytes_AsSString(s)    ((const signed char*) PyBytes_AsString(s))
+    #define __Pyx_PyBytes_AsUString(s)    ((const unsigned char*) PyBytes_AsString(s))
+    #define __Pyx_PyByteArray_AsString(s) PyByteArray_AsString(s)
+#endif
+#define __Pyx_PyObject_AsWritableString(s)    ((char*)(__pyx_uintptr_t) __Pyx_PyObject_AsString(s))
+#define __Pyx_PyObject_AsWritableSString(s)    ((signed char*)(__pyx_uintptr_t) __Pyx_PyObject_AsString(s))
+#define __Pyx_PyObject_AsWritableUString(s)    ((unsigned char*)(__pyx_uintptr_t) __Pyx_PyObject_AsString(s))
 #define __Pyx_PyObject_AsSString(s)    ((const signed char*) __Pyx_PyObject_AsString(s))
 #define __Pyx_PyObject_AsUString(s)    ((const unsigned char*) __Pyx_PyObject_AsString(s))
 #define __Pyx_PyObject_FromCString(s)  __Pyx_PyObject_FromString((const char*)s)
 #define __Pyx_PyBytes_FromCString(s)   __Pyx_PyBytes_FromString((const char*)s)
 #define __Pyx_PyByteArray_FromCString(s)   __Pyx_PyByteArray_FromString((const char*)s)
-#define __Pyx_PyStr_FromCString(s)     __Pyx_PyStr_FromString((const char*)s)
 #define __Pyx_PyUnicode_FromCString(s) __Pyx_PyUnicode_FromString((const char*)s)
-static CYTHON_INLINE size_t __Pyx_Py_UNICODE_strlen(const Py_UNICODE *u) {
-    const Py_UNICODE *u_end = u;
-    while (*u_end++) ;
-    return (size_t)(u_end - u - 1);
-}
-#define __Pyx_PyUnicode_FromUnicode(u)       PyUnicode_FromUnicode(u, __Pyx_Py_UNICODE_strlen(u))
-#define __Pyx_PyUnicode_FromUnicodeAndLength PyUnicode_FromUnicode
+#define __Pyx_PyUnicode_FromOrdinal(o)       PyUnicode_FromOrdinal((int)o)
 #define __Pyx_PyUnicode_AsUnicode            PyUnicode_AsUnicode
-#define __Pyx_NewRef(obj) (Py_INCREF(obj), obj)
-#define __Pyx_Owned_Py_None(b) __Pyx_NewRef(Py_None)
+static CYTHON_INLINE PyObject *__Pyx_NewRef(PyObject *obj) {
+#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030a0000 || defined(Py_NewRef)
+    return Py_NewRef(obj);
+#else
+    Py_INCREF(obj);
+    return obj;
+#endif
+}
+static CYTHON_INLINE PyObject *__Pyx_XNewRef(PyObject *obj) {
+#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030a0000 || defined(Py_XNewRef)
+    return Py_XNewRef(obj);
+#else
+    Py_XINCREF(obj);
+    return obj;
+#endif
+}
+static CYTHON_INLINE PyObject *__Pyx_Owned_Py_None(int b);
 static CYTHON_INLINE PyObject * __Pyx_PyBool_FromLong(long b);
 static CYTHON_INLINE int __Pyx_PyObject_IsTrue(PyObject*);
 static CYTHON_INLINE int __Pyx_PyObject_IsTrueAndDecref(PyObject*);
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_IntOrLong(PyObject* x);
+static CYTHON_INLINE PyObject* __Pyx_PyNumber_Long(PyObject* x);
+#define __Pyx_PyObject_RichCompareBool(a,b,cmp)  __Pyx_PyObject_IsTrueAndDecref(PyObject_RichCompare((a),(b),(cmp)))
 #define __Pyx_PySequence_Tuple(obj)\
     (likely(PyTuple_CheckExact(obj)) ? __Pyx_NewRef(obj) : PySequence_Tuple(obj))
 static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
+static CYTHON_INLINE PyObject * __Pyx_PyLong_FromSize_t(size_t);
+static CYTHON_INLINE Py_hash_t __Pyx_PyIndex_AsHash_t(PyObject*);
 #if CYTHON_ASSUME_SAFE_MACROS
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
+#define __Pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
+#define __Pyx_PyFloat_AS_DOUBLE(x) PyFloat_AS_DOUBLE(x)
+#define __Pyx_PyFloat_IsNonZero(x) (PyFloat_AS_DOUBLE(x) != 0.0)
 #else
-#define __pyx_PyFloat_AsDouble(x) PyFloat_AsDouble(x)
+#define __Pyx_PyFloat_AsDouble(x) PyFloat_AsDouble(x)
+#define __Pyx_PyFloat_AS_DOUBLE(x) PyFloat_AsDouble(x)
+#define __Pyx_PyFloat_IsNonZero(x) PyObject_IsTrue(x)
 #endif
-#define __pyx_PyFloat_AsFloat(x) ((float) __pyx_PyFloat_AsDouble(x))
-#if PY_MAJOR_VERSION >= 3
+#define __Pyx_PyFloat_AsFloat(x) ((float) __Pyx_PyFloat_AsDouble(x))
 #define __Pyx_PyNumber_Int(x) (PyLong_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Long(x))
+#if CYTHON_USE_PYLONG_INTERNALS
+  #if PY_VERSION_HEX >= 0x030C00A7
+  #ifndef _PyLong_SIGN_MASK
+    #define _PyLong_SIGN_MASK 3
+  #endif
+  #ifndef _PyLong_NON_SIZE_BITS
+    #define _PyLong_NON_SIZE_BITS 3
+  #endif
+  #define __Pyx_PyLong_SignBits(x)  ((int) (((PyLongObject*)x)->long_value.lv_tag & _PyLong_SIGN_MASK))
+  #define __Pyx_PyLong_Sign(x)  (1 - __Pyx_PyLong_SignBits(x))
+  #define __Pyx_PyLong_IsNeg(x)  ((__Pyx_PyLong_SignBits(x) & 2) != 0)
+  #define __Pyx_PyLong_IsNonNeg(x)  (!__Pyx_PyLong_IsNeg(x))
+  #define __Pyx_PyLong_IsZero(x)  (__Pyx_PyLong_SignBits(x) & 1)
+  #define __Pyx_PyLong_IsPos(x)  (__Pyx_PyLong_SignBits(x) == 0)
+  #define __Pyx_PyLong_CompactValueUnsigned(x)  (__Pyx_PyLong_Digits(x)[0])
+  #define __Pyx_PyLong_DigitCount(x)  ((Py_ssize_t) (((PyLongObject*)x)->long_value.lv_tag >> _PyLong_NON_SIZE_BITS))
+  #define __Pyx_PyLong_SignedDigitCount(x)\
+        (((Py_ssize_t) __Pyx_PyLong_Sign(x)) * __Pyx_PyLong_DigitCount(x))
+  #if defined(PyUnstable_Long_IsCompact) && defined(PyUnstable_Long_CompactValue)
+    #define __Pyx_PyLong_IsCompact(x)     PyUnstable_Long_IsCompact((PyLongObject*) x)
+    #define __Pyx_PyLong_CompactValue(x)  PyUnstable_Long_CompactValue((PyLongObject*) x)
+  #else
+    #define __Pyx_PyLong_IsCompact(x)     (((PyLongObject*)x)->long_value.lv_tag < (2 << _PyLong_NON_SIZE_BITS))
+    #define __Pyx_PyLong_CompactValue(x)  (((Py_ssize_t) __Pyx_PyLong_Sign(x)) * (Py_ssize_t) __Pyx_PyLong_Digits(x)[0])
+  #endif
+  static CYTHON_INLINE Py_ssize_t __Pyx_PyLong_CompareSignAndSize(PyObject *a, PyObject *b) {
+      uintptr_t tag_a = ((PyLongObject*)a)->long_value.lv_tag;
+      uintptr_t tag_b = ((PyLongObject*)b)->long_value.lv_tag;
+      if (tag_a == tag_b) return 0;
+      int sign_a = (int) (tag_a & _PyLong_SIGN_MASK);
+      int sign_b = (int) (tag_b & _PyLong_SIGN_MASK);
+      if (sign_a > sign_b) return -1;
+      if (sign_a < sign_b) return 1;
+      Py_ssize_t size_a = (Py_ssize_t) (tag_a >> _PyLong_NON_SIZE_BITS);
+      Py_ssize_t size_b = (Py_ssize_t) (tag_b >> _PyLong_NON_SIZE_BITS);
+      return (1 - sign_a) * (size_a - size_b);
+  }
+  typedef Py_ssize_t  __Pyx_compact_pylong;
+  typedef size_t  __Pyx_compact_upylong;
+  #else
+  #define __Pyx_PyLong_Sign(x)  ((int) ((Py_SIZE(x) == 0) ? 0 : (Py_SIZE(x) < 0) ? -1 : 1))
+  #define __Pyx_PyLong_IsNeg(x)  (Py_SIZE(x) < 0)
+  #define __Pyx_PyLong_IsNonNeg(x)  (Py_SIZE(x) >= 0)
+  #define __Pyx_PyLong_IsZero(x)  (Py_SIZE(x) == 0)
+  #define __Pyx_PyLong_IsPos(x)  (Py_SIZE(x) > 0)
+  #define __Pyx_PyLong_CompactValueUnsigned(x)  ((Py_SIZE(x) == 0) ? 0 : __Pyx_PyLong_Digits(x)[0])
+  #define __Pyx_PyLong_DigitCount(x)  __Pyx_sst_abs(Py_SIZE(x))
+  #define __Pyx_PyLong_SignedDigitCount(x)  Py_SIZE(x)
+  #define __Pyx_PyLong_IsCompact(x)  (Py_SIZE(x) == 0 || Py_SIZE(x) == 1 || Py_SIZE(x) == -1)
+  #define __Pyx_PyLong_CompactValue(x)\
+        ((Py_SIZE(x) == 0) ? (sdigit) 0 : ((Py_SIZE(x) < 0) ? -(sdigit)__Pyx_PyLong_Digits(x)[0] : (sdigit)__Pyx_PyLong_Digits(x)[0]))
+  #define __Pyx_PyLong_CompareSignAndSize(a, b)  (Py_SIZE(a) - Py_SIZE(b))
+  typedef sdigit  __Pyx_compact_pylong;
+  typedef digit  __Pyx_compact_upylong;
+  #endif
+  #if PY_VERSION_HEX >= 0x030C00A5
+  #define __Pyx_PyLong_Digits(x)  (((PyLongObject*)x)->long_value.ob_digit)
+  #else
+  #define __Pyx_PyLong_Digits(x)  (((PyLongObject*)x)->ob_digit)
+  #endif
+  #define __Pyx_PyLong_IsNonZero(x)  (!__Pyx_PyLong_IsZero(x))
 #else
-#define __Pyx_PyNumber_Int(x) (PyInt_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Int(x))
-#endif
-#define __Pyx_PyNumber_Float(x) (PyFloat_CheckExact(x) ? __Pyx_NewRef(x) : PyNumber_Float(x))
-#if PY_MAJOR_VERSION < 3 && __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-static int __Pyx_sys_getdefaultencoding_not_ascii;
-static int __Pyx_init_sys_getdefaultencoding_params(void) {
-    PyObject* sys;
-    PyObject* default_encoding = NULL;
-    PyObject* ascii_chars_u = NULL;
-    PyObject* ascii_chars_b = NULL;
-    const char* default_encoding_c;
-    sys = PyImport_ImportModule("sys");
-    if (!sys) goto bad;
-    default_encoding = PyObject_CallMethod(sys, (char*) "getdefaultencoding", NULL);
-    Py_DECREF(sys);
-    if (!default_encoding) goto bad;
-    default_encoding_c = PyBytes_AsString(default_encoding);
-    if (!default_encoding_c) goto bad;
-    if (strcmp(default_encoding_c, "ascii") == 0) {
-        __Pyx_sys_getdefaultencoding_not_ascii = 0;
-    } else {
-        char ascii_chars[128];
-        int c;
-        for (c = 0; c < 128; c++) {
-            ascii_chars[c] = c;
-        }
-        __Pyx_sys_getdefaultencoding_not_ascii = 1;
-        ascii_chars_u = PyUnicode_DecodeASCII(ascii_chars, 128, NULL);
-        if (!ascii_chars_u) goto bad;
-        ascii_chars_b = PyUnicode_AsEncodedString(ascii_chars_u, default_encoding_c, NULL);
-        if (!ascii_chars_b || !PyBytes_Check(ascii_chars_b) || memcmp(ascii_chars, PyBytes_AS_STRING(ascii_chars_b), 128) != 0) {
-            PyErr_Format(
-                PyExc_ValueError,
-                "This module compiled with c_string_encoding=ascii, but default encoding '%.200s' is not a superset of ascii.",
-                default_encoding_c);
-            goto bad;
-        }
-        Py_DECREF(ascii_chars_u);
-        Py_DECREF(ascii_chars_b);
-    }
-    Py_DECREF(default_encoding);
-    return 0;
-bad:
-    Py_XDECREF(default_encoding);
-    Py_XDECREF(ascii_chars_u);
-    Py_XDECREF(ascii_chars_b);
-    return -1;
-}
-#endif
-#if __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT && PY_MAJOR_VERSION >= 3
-#define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_DecodeUTF8(c_str, size, NULL)
-#else
-#define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_Decode(c_str, size, __PYX_DEFAULT_STRING_ENCODING, NULL)
-#if __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT
-static char* __PYX_DEFAULT_STRING_ENCODING;
-static int __Pyx_init_sys_getdefaultencoding_params(void) {
-    PyObject* sys;
-    PyObject* default_encoding = NULL;
-    char* default_encoding_c;
-    sys = PyImport_ImportModule("sys");
-    if (!sys) goto bad;
-    default_encoding = PyObject_CallMethod(sys, (char*) (const char*) "getdefaultencoding", NULL);
-    Py_DECREF(sys);
-    if (!default_encoding) goto bad;
-    default_encoding_c = PyBytes_AsString(default_encoding);
-    if (!default_encoding_c) goto bad;
-    __PYX_DEFAULT_STRING_ENCODING = (char*) malloc(strlen(default_encoding_c) + 1);
-    if (!__PYX_DEFAULT_STRING_ENCODING) goto bad;
-    strcpy(__PYX_DEFAULT_STRING_ENCODING, default_encoding_c);
-    Py_DECREF(default_encoding);
-    return 0;
-bad:
-    Py_XDECREF(default_encoding);
-    return -1;
-}
+  #define __Pyx_PyLong_IsNonZero(x)  PyObject_IsTrue(x)
 #endif
+#if __PYX_DEFAULT_STRING_ENCODING_IS_UTF8
+  #define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_DecodeUTF8(c_str, size, NULL)
+#elif __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
+  #define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_DecodeASCII(c_str, size, NULL)
+#else
+  #define __Pyx_PyUnicode_FromStringAndSize(c_str, size) PyUnicode_Decode(c_str, size, __PYX_DEFAULT_STRING_ENCODING, NULL)
 #endif
 
 
@@ -824,56 +1598,364 @@ bad:
   #define likely(x)   (x)
   #define unlikely(x) (x)
 #endif /* __GNUC__ */
+/* PretendToInitialize */
+#ifdef __cplusplus
+#if __cplusplus > 201103L
+#include <type_traits>
+#endif
+template <typename T>
+static void __Pyx_pretend_to_initialize(T* ptr) {
+#if __cplusplus > 201103L
+    if ((std::is_trivially_default_constructible<T>::value))
+#endif
+        *ptr = T();
+    (void)ptr;
+}
+#else
 static CYTHON_INLINE void __Pyx_pretend_to_initialize(void* ptr) { (void)ptr; }
+#endif
 
+
+#if !CYTHON_USE_MODULE_STATE
 static PyObject *__pyx_m = NULL;
-static PyObject *__pyx_d;
-static PyObject *__pyx_b;
-static PyObject *__pyx_cython_runtime = NULL;
-static PyObject *__pyx_empty_tuple;
-static PyObject *__pyx_empty_bytes;
-static PyObject *__pyx_empty_unicode;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-
-
-static const char *__pyx_f[] = {
-  "overload\\bind.pyx",
+#endif
+static const char * const __pyx_cfilenm = __FILE__;
+
+/* #### Code section: filename_table ### */
+
+static const char* const __pyx_f[] = {
+  "overload/bind.pyx",
+  "cpython/contextvars.pxd",
+  "overload/bind.pxd",
+  "cpython/type.pxd",
+  "cpython/bool.pxd",
+  "cpython/complex.pxd",
 };
+/* #### Code section: utility_code_proto_before_types ### */
+/* Profile_config.proto (used by Profile) */
+#ifndef CYTHON_PROFILE
+#if CYTHON_COMPILING_IN_LIMITED_API || CYTHON_COMPILING_IN_PYPY
+  #define CYTHON_PROFILE 0
+#else
+  #define CYTHON_PROFILE 1
+#endif
+#endif
+#ifndef CYTHON_TRACE_NOGIL
+  #define CYTHON_TRACE_NOGIL 0
+#else
+  #if CYTHON_TRACE_NOGIL && !defined(CYTHON_TRACE)
+    #define CYTHON_TRACE 1
+  #endif
+#endif
+#ifndef CYTHON_TRACE
+  #define CYTHON_TRACE 0
+#endif
+#if CYTHON_PROFILE || CYTHON_TRACE
+#if CYTHON_USE_SYS_MONITORING
+    typedef enum {
+        __Pyx_Monitoring_PY_START = 0,
+        __Pyx_Monitoring_PY_RETURN,
+        __Pyx_Monitoring_PY_UNWIND,
+        __Pyx_Monitoring_LINE,
+        __Pyx_Monitoring_RAISE,
+        __Pyx_Monitoring_RERAISE,
+        __Pyx_Monitoring_EXCEPTION_HANDLED,
+        __Pyx_Monitoring_PY_RESUME,
+        __Pyx_Monitoring_PY_YIELD,
+        __Pyx_Monitoring_STOP_ITERATION,
+    } __Pyx_Monitoring_Event_Index;
+    static const unsigned char __Pyx_MonitoringEventTypes[] = {
+        PY_MONITORING_EVENT_PY_START,
+        PY_MONITORING_EVENT_PY_RETURN,
+        PY_MONITORING_EVENT_PY_UNWIND,
+        PY_MONITORING_EVENT_LINE,
+        PY_MONITORING_EVENT_RAISE,
+        PY_MONITORING_EVENT_RERAISE,
+        PY_MONITORING_EVENT_EXCEPTION_HANDLED,
+        PY_MONITORING_EVENT_PY_RESUME,
+        PY_MONITORING_EVENT_PY_YIELD,
+        PY_MONITORING_EVENT_STOP_ITERATION,
+    };
+    #define __Pyx_MonitoringEventTypes_CyFunc_count (sizeof(__Pyx_MonitoringEventTypes) - 3)
+    #define __Pyx_MonitoringEventTypes_CyGen_count (sizeof(__Pyx_MonitoringEventTypes))
+#endif
+#endif
+
+/* Atomics.proto (used by CodeObjectCache) */
+#include <pythread.h>
+#ifndef CYTHON_ATOMICS
+    #define CYTHON_ATOMICS 1
+#endif
+#define __PYX_CYTHON_ATOMICS_ENABLED() CYTHON_ATOMICS
+#define __PYX_GET_CYTHON_COMPILING_IN_CPYTHON_FREETHREADING() CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+#define __pyx_atomic_int_type int
+#define __pyx_nonatomic_int_type int
+#if CYTHON_ATOMICS && (defined(__STDC_VERSION__) &&\
+                        (__STDC_VERSION__ >= 201112L) &&\
+                        !defined(__STDC_NO_ATOMICS__))
+    #include <stdatomic.h>
+#elif CYTHON_ATOMICS && (defined(__cplusplus) && (\
+                    (__cplusplus >= 201103L) ||\
+                    (defined(_MSC_VER) && _MSC_VER >= 1700)))
+    #include <atomic>
+#endif
+#if CYTHON_ATOMICS && (defined(__STDC_VERSION__) &&\
+                        (__STDC_VERSION__ >= 201112L) &&\
+                        !defined(__STDC_NO_ATOMICS__) &&\
+                       ATOMIC_INT_LOCK_FREE == 2)
+    #undef __pyx_atomic_int_type
+    #define __pyx_atomic_int_type atomic_int
+    #define __pyx_atomic_ptr_type atomic_uintptr_t
+    #define __pyx_nonatomic_ptr_type uintptr_t
+    #define __pyx_atomic_incr_relaxed(value) atomic_fetch_add_explicit(value, 1, memory_order_relaxed)
+    #define __pyx_atomic_incr_acq_rel(value) atomic_fetch_add_explicit(value, 1, memory_order_acq_rel)
+    #define __pyx_atomic_decr_acq_rel(value) atomic_fetch_sub_explicit(value, 1, memory_order_acq_rel)
+    #define __pyx_atomic_sub(value, arg) atomic_fetch_sub(value, arg)
+    #define __pyx_atomic_int_cmp_exchange(value, expected, desired) atomic_compare_exchange_strong(value, expected, desired)
+    #define __pyx_atomic_load(value) atomic_load(value)
+    #define __pyx_atomic_store(value, new_value) atomic_store(value, new_value)
+    #define __pyx_atomic_pointer_load_relaxed(value) atomic_load_explicit(value, memory_order_relaxed)
+    #define __pyx_atomic_pointer_load_acquire(value) atomic_load_explicit(value, memory_order_acquire)
+    #define __pyx_atomic_pointer_exchange(value, new_value) atomic_exchange(value, (__pyx_nonatomic_ptr_type)new_value)
+    #define __pyx_atomic_pointer_cmp_exchange(value, expected, desired) atomic_compare_exchange_strong(value, expected, desired)
+    #if defined(__PYX_DEBUG_ATOMICS) && defined(_MSC_VER)
+        #pragma message ("Using standard C atomics")
+    #elif defined(__PYX_DEBUG_ATOMICS)
+        #warning "Using standard C atomics"
+    #endif
+#elif CYTHON_ATOMICS && (defined(__cplusplus) && (\
+                    (__cplusplus >= 201103L) ||\
+\
+                    (defined(_MSC_VER) && _MSC_VER >= 1700)) &&\
+                    ATOMIC_INT_LOCK_FREE == 2)
+    #undef __pyx_atomic_int_type
+    #define __pyx_atomic_int_type std::atomic_int
+    #define __pyx_atomic_ptr_type std::atomic_uintptr_t
+    #define __pyx_nonatomic_ptr_type uintptr_t
+    #define __pyx_atomic_incr_relaxed(value) std::atomic_fetch_add_explicit(value, 1, std::memory_order_relaxed)
+    #define __pyx_atomic_incr_acq_rel(value) std::atomic_fetch_add_explicit(value, 1, std::memory_order_acq_rel)
+    #define __pyx_atomic_decr_acq_rel(value) std::atomic_fetch_sub_explicit(value, 1, std::memory_order_acq_rel)
+    #define __pyx_atomic_sub(value, arg) std::atomic_fetch_sub(value, arg)
+    #define __pyx_atomic_int_cmp_exchange(value, expected, desired) std::atomic_compare_exchange_strong(value, expected, desired)
+    #define __pyx_atomic_load(value) std::atomic_load(value)
+    #define __pyx_atomic_store(value, new_value) std::atomic_store(value, new_value)
+    #define __pyx_atomic_pointer_load_relaxed(value) std::atomic_load_explicit(value, std::memory_order_relaxed)
+    #define __pyx_atomic_pointer_load_acquire(value) std::atomic_load_explicit(value, std::memory_order_acquire)
+    #define __pyx_atomic_pointer_exchange(value, new_value) std::atomic_exchange(value, (__pyx_nonatomic_ptr_type)new_value)
+    #define __pyx_atomic_pointer_cmp_exchange(value, expected, desired) std::atomic_compare_exchange_strong(value, expected, desired)
+    #if defined(__PYX_DEBUG_ATOMICS) && defined(_MSC_VER)
+        #pragma message ("Using standard C++ atomics")
+    #elif defined(__PYX_DEBUG_ATOMICS)
+        #warning "Using standard C++ atomics"
+    #endif
+#elif CYTHON_ATOMICS && (__GNUC__ >= 5 || (__GNUC__ == 4 &&\
+                    (__GNUC_MINOR__ > 1 ||\
+                    (__GNUC_MINOR__ == 1 && __GNUC_PATCHLEVEL__ >= 2))))
+    #define __pyx_atomic_ptr_type void*
+    #define __pyx_nonatomic_ptr_type void*
+    #define __pyx_atomic_incr_relaxed(value) __sync_fetch_and_add(value, 1)
+    #define __pyx_atomic_incr_acq_rel(value) __sync_fetch_and_add(value, 1)
+    #define __pyx_atomic_decr_acq_rel(value) __sync_fetch_and_sub(value, 1)
+    #define __pyx_atomic_sub(value, arg) __sync_fetch_and_sub(value, arg)
+    static CYTHON_INLINE int __pyx_atomic_int_cmp_exchange(__pyx_atomic_int_type* value, __pyx_nonatomic_int_type* expected, __pyx_nonatomic_int_type desired) {
+        __pyx_nonatomic_int_type old = __sync_val_compare_and_swap(value, *expected, desired);
+        int result = old == *expected;
+        *expected = old;
+        return result;
+    }
+    #define __pyx_atomic_load(value) __sync_fetch_and_add(value, 0)
+    #define __pyx_atomic_store(value, new_value) __sync_lock_test_and_set(value, new_value)
+    #define __pyx_atomic_pointer_load_relaxed(value) __sync_fetch_and_add(value, 0)
+    #define __pyx_atomic_pointer_load_acquire(value) __sync_fetch_and_add(value, 0)
+    #define __pyx_atomic_pointer_exchange(value, new_value) __sync_lock_test_and_set(value, (__pyx_atomic_ptr_type)new_value)
+    static CYTHON_INLINE int __pyx_atomic_pointer_cmp_exchange(__pyx_atomic_ptr_type* value, __pyx_nonatomic_ptr_type* expected, __pyx_nonatomic_ptr_type desired) {
+        __pyx_nonatomic_ptr_type old = __sync_val_compare_and_swap(value, *expected, desired);
+        int result = old == *expected;
+        *expected = old;
+        return result;
+    }
+    #ifdef __PYX_DEBUG_ATOMICS
+        #warning "Using GNU atomics"
+    #endif
+#elif CYTHON_ATOMICS && defined(_MSC_VER)
+    #include <intrin.h>
+    #undef __pyx_atomic_int_type
+    #define __pyx_atomic_int_type long
+    #define __pyx_atomic_ptr_type void*
+    #undef __pyx_nonatomic_int_type
+    #define __pyx_nonatomic_int_type long
+    #define __pyx_nonatomic_ptr_type void*
+    #pragma intrinsic (_InterlockedExchangeAdd, _InterlockedExchange, _InterlockedCompareExchange, _InterlockedCompareExchangePointer, _InterlockedExchangePointer)
+    #define __pyx_atomic_incr_relaxed(value) _InterlockedExchangeAdd(value, 1)
+    #define __pyx_atomic_incr_acq_rel(value) _InterlockedExchangeAdd(value, 1)
+    #define __pyx_atomic_decr_acq_rel(value) _InterlockedExchangeAdd(value, -1)
+    #define __pyx_atomic_sub(value, arg) _InterlockedExchangeAdd(value, -arg)
+    static CYTHON_INLINE int __pyx_atomic_int_cmp_exchange(__pyx_atomic_int_type* value, __pyx_nonatomic_int_type* expected, __pyx_nonatomic_int_type desired) {
+        __pyx_nonatomic_int_type old = _InterlockedCompareExchange(value, desired, *expected);
+        int result = old == *expected;
+        *expected = old;
+        return result;
+    }
+    #define __pyx_atomic_load(value) _InterlockedExchangeAdd(value, 0)
+    #define __pyx_atomic_store(value, new_value) _InterlockedExchange(value, new_value)
+    #define __pyx_atomic_pointer_load_relaxed(value) *(void * volatile *)value
+    #define __pyx_atomic_pointer_load_acquire(value) _InterlockedCompareExchangePointer(value, 0, 0)
+    #define __pyx_atomic_pointer_exchange(value, new_value) _InterlockedExchangePointer(value, (__pyx_atomic_ptr_type)new_value)
+    static CYTHON_INLINE int __pyx_atomic_pointer_cmp_exchange(__pyx_atomic_ptr_type* value, __pyx_nonatomic_ptr_type* expected, __pyx_nonatomic_ptr_type desired) {
+        __pyx_atomic_ptr_type old = _InterlockedCompareExchangePointer(value, desired, *expected);
+        int result = old == *expected;
+        *expected = old;
+        return result;
+    }
+    #ifdef __PYX_DEBUG_ATOMICS
+        #pragma message ("Using MSVC atomics")
+    #endif
+#else
+    #undef CYTHON_ATOMICS
+    #define CYTHON_ATOMICS 0
+    #ifdef __PYX_DEBUG_ATOMICS
+        #warning "Not using atomics"
+    #endif
+#endif
+
+/* #### Code section: numeric_typedefs ### */
+/* #### Code section: complex_type_declarations ### */
+/* #### Code section: type_declarations ### */
 
 /*--- Type declarations ---*/
-struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation;
-struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr;
+struct __pyx_opt_args_7cpython_11contextvars_get_value;
+struct __pyx_opt_args_7cpython_11contextvars_get_value_no_default;
 
-/* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
+/* "cpython/contextvars.pxd":116
  * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
-struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation {
-  PyObject_HEAD
-  PyObject *__pyx_v_ann;
-  PyObject *__pyx_v_obj;
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ * cdef inline object get_value(var, default_value=None):             # <<<<<<<<<<<<<<
+ *     """Return a new reference to the value of the context variable,
+ *     or the default value of the context variable,
+*/
+struct __pyx_opt_args_7cpython_11contextvars_get_value {
+  int __pyx_n;
+  PyObject *default_value;
 };
 
+/* "cpython/contextvars.pxd":134
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ * cdef inline object get_value_no_default(var, default_value=None):             # <<<<<<<<<<<<<<
+ *     """Return a new reference to the value of the context variable,
+ *     or the provided default value if no such value was found.
+*/
+struct __pyx_opt_args_7cpython_11contextvars_get_value_no_default {
+  int __pyx_n;
+  PyObject *default_value;
+};
+struct __pyx_t_8overload_4bind_ContainerCheck;
+struct __pyx_t_8overload_4bind_Instruction;
+struct __pyx_t_8overload_4bind_Matcher;
 
-/* "overload/bind.pyx":14
- *         # typing annotations
- *         if ann.__origin__ is Union:
- *             return any(matchesannotation(obj, x) for x in ann.__args__)             # <<<<<<<<<<<<<<
- *         print("unknown typing annotation")
- *         return False
- */
-struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr {
-  PyObject_HEAD
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *__pyx_outer_scope;
-  PyObject *__pyx_v_x;
+/* "overload/bind.pxd":17
+ * 
+ * 
+ * cdef enum MatcherKind:             # <<<<<<<<<<<<<<
+ * 	MATCH_ANY  # Unannotated or `object`: every argument matches
+ * 	MATCH_TYPE  # Plain class: compare the type pointer, then walk the MRO
+*/
+enum __pyx_t_8overload_4bind_MatcherKind {
+  __pyx_e_8overload_4bind_MATCH_ANY,
+  __pyx_e_8overload_4bind_MATCH_TYPE,
+  __pyx_e_8overload_4bind_MATCH_INSTANCE,
+  __pyx_e_8overload_4bind_MATCH_PROGRAM
+};
+
+/* "overload/bind.pxd":24
+ * 
+ * 
+ * cdef enum ContainerCheckMode:             # <<<<<<<<<<<<<<
+ * 	CHECK_SHALLOW  # Only check the type of the container
+ * 	CHECK_FIRST  # Check the first `items` elements
+*/
+enum __pyx_t_8overload_4bind_ContainerCheckMode {
+  __pyx_e_8overload_4bind_CHECK_SHALLOW,
+  __pyx_e_8overload_4bind_CHECK_FIRST,
+  __pyx_e_8overload_4bind_CHECK_SAMPLE,
+  __pyx_e_8overload_4bind_CHECK_FULL
+};
+
+/* "overload/bind.pxd":36
+ * 
+ * 
+ * cdef enum Opcode:             # <<<<<<<<<<<<<<
+ * 	OP_ANY
+ * 	OP_TYPE  # Argument is an instance of a plain class
+*/
+enum __pyx_t_8overload_4bind_Opcode {
+  __pyx_e_8overload_4bind_OP_ANY,
+  __pyx_e_8overload_4bind_OP_TYPE,
+  __pyx_e_8overload_4bind_OP_INSTANCE,
+  __pyx_e_8overload_4bind_OP_LITERAL,
+  __pyx_e_8overload_4bind_OP_SUBCLASS,
+  __pyx_e_8overload_4bind_OP_UNION,
+  __pyx_e_8overload_4bind_OP_TUPLE,
+  __pyx_e_8overload_4bind_OP_COLLECTION,
+  __pyx_e_8overload_4bind_OP_MAPPING
+};
+
+/* "overload/bind.pxd":31
+ * 
+ * 
+ * cdef struct ContainerCheck:             # <<<<<<<<<<<<<<
+ * 	int mode
+ * 	Py_ssize_t items
+*/
+struct __pyx_t_8overload_4bind_ContainerCheck {
+  int mode;
+  Py_ssize_t items;
+};
+
+/* "overload/bind.pxd":48
+ * 
+ * 
+ * cdef struct Instruction:             # <<<<<<<<<<<<<<
+ * 	int op
+ * 	Py_ssize_t size  # Number of instructions in this node, including all of its children
+*/
+struct __pyx_t_8overload_4bind_Instruction {
+  int op;
+  Py_ssize_t size;
+  Py_ssize_t count;
+  PyObject *value;
+  struct __pyx_t_8overload_4bind_ContainerCheck check;
+};
+
+/* "overload/bind.pxd":56
+ * 
+ * 
+ * cdef struct Matcher:             # <<<<<<<<<<<<<<
+ * 	int kind
+ * 	PyObject* annotation
+*/
+struct __pyx_t_8overload_4bind_Matcher {
+  int kind;
+  PyObject *annotation;
+  PyTypeObject *type;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction>  program;
+  int type_based;
+  PyObject *guards;
 };
 
+/* "overload/bind.pyx":479
+ * 
+ * 
+ * cdef enum TypeMatch:             # <<<<<<<<<<<<<<
+ *     TYPE_MISMATCH
+ *     TYPE_MATCH
+*/
+enum __pyx_t_8overload_4bind_TypeMatch {
+  __pyx_e_8overload_4bind_TYPE_MISMATCH,
+  __pyx_e_8overload_4bind_TYPE_MATCH,
+  __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE
+};
+/* #### Code section: utility_code_proto ### */
 
 /* --- Runtime support code (head) --- */
 /* Refnanny.proto */
@@ -882,42 +1964,48 @@ struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr {
 #endif
 #if CYTHON_REFNANNY
   typedef struct {
-    void (*INCREF)(void*, PyObject*, int);
-    void (*DECREF)(void*, PyObject*, int);
-    void (*GOTREF)(void*, PyObject*, int);
-    void (*GIVEREF)(void*, PyObject*, int);
-    void* (*SetupContext)(const char*, int, const char*);
+    void (*INCREF)(void*, PyObject*, Py_ssize_t);
+    void (*DECREF)(void*, PyObject*, Py_ssize_t);
+    void (*GOTREF)(void*, PyObject*, Py_ssize_t);
+    void (*GIVEREF)(void*, PyObject*, Py_ssize_t);
+    void* (*SetupContext)(const char*, Py_ssize_t, const char*);
     void (*FinishContext)(void**);
   } __Pyx_RefNannyAPIStruct;
   static __Pyx_RefNannyAPIStruct *__Pyx_RefNanny = NULL;
   static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname);
   #define __Pyx_RefNannyDeclarations void *__pyx_refnanny = NULL;
-#ifdef WITH_THREAD
   #define __Pyx_RefNannySetupContext(name, acquire_gil)\
           if (acquire_gil) {\
               PyGILState_STATE __pyx_gilstate_save = PyGILState_Ensure();\
-              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__);\
+              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), (__LINE__), (__FILE__));\
               PyGILState_Release(__pyx_gilstate_save);\
           } else {\
-              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__);\
+              __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), (__LINE__), (__FILE__));\
+          }
+  #define __Pyx_RefNannyFinishContextNogil() {\
+              PyGILState_STATE __pyx_gilstate_save = PyGILState_Ensure();\
+              __Pyx_RefNannyFinishContext();\
+              PyGILState_Release(__pyx_gilstate_save);\
+          }
+  #define __Pyx_RefNannyFinishContextNogil() {\
+              PyGILState_STATE __pyx_gilstate_save = PyGILState_Ensure();\
+              __Pyx_RefNannyFinishContext();\
+              PyGILState_Release(__pyx_gilstate_save);\
           }
-#else
-  #define __Pyx_RefNannySetupContext(name, acquire_gil)\
-          __pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__)
-#endif
   #define __Pyx_RefNannyFinishContext()\
           __Pyx_RefNanny->FinishContext(&__pyx_refnanny)
-  #define __Pyx_INCREF(r)  __Pyx_RefNanny->INCREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_DECREF(r)  __Pyx_RefNanny->DECREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GOTREF(r)  __Pyx_RefNanny->GOTREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GIVEREF(r) __Pyx_RefNanny->GIVEREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_XINCREF(r)  do { if((r) != NULL) {__Pyx_INCREF(r); }} while(0)
-  #define __Pyx_XDECREF(r)  do { if((r) != NULL) {__Pyx_DECREF(r); }} while(0)
-  #define __Pyx_XGOTREF(r)  do { if((r) != NULL) {__Pyx_GOTREF(r); }} while(0)
-  #define __Pyx_XGIVEREF(r) do { if((r) != NULL) {__Pyx_GIVEREF(r);}} while(0)
+  #define __Pyx_INCREF(r)  __Pyx_RefNanny->INCREF(__pyx_refnanny, (PyObject *)(r), (__LINE__))
+  #define __Pyx_DECREF(r)  __Pyx_RefNanny->DECREF(__pyx_refnanny, (PyObject *)(r), (__LINE__))
+  #define __Pyx_GOTREF(r)  __Pyx_RefNanny->GOTREF(__pyx_refnanny, (PyObject *)(r), (__LINE__))
+  #define __Pyx_GIVEREF(r) __Pyx_RefNanny->GIVEREF(__pyx_refnanny, (PyObject *)(r), (__LINE__))
+  #define __Pyx_XINCREF(r)  do { if((r) == NULL); else {__Pyx_INCREF(r); }} while(0)
+  #define __Pyx_XDECREF(r)  do { if((r) == NULL); else {__Pyx_DECREF(r); }} while(0)
+  #define __Pyx_XGOTREF(r)  do { if((r) == NULL); else {__Pyx_GOTREF(r); }} while(0)
+  #define __Pyx_XGIVEREF(r) do { if((r) == NULL); else {__Pyx_GIVEREF(r);}} while(0)
 #else
   #define __Pyx_RefNannyDeclarations
   #define __Pyx_RefNannySetupContext(name, acquire_gil)
+  #define __Pyx_RefNannyFinishContextNogil()
   #define __Pyx_RefNannyFinishContext()
   #define __Pyx_INCREF(r) Py_INCREF(r)
   #define __Pyx_DECREF(r) Py_DECREF(r)
@@ -928,6 +2016,10 @@ struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr {
   #define __Pyx_XGOTREF(r)
   #define __Pyx_XGIVEREF(r)
 #endif
+#define __Pyx_Py_XDECREF_SET(r, v) do {\
+        PyObject *tmp = (PyObject *) r;\
+        r = v; Py_XDECREF(tmp);\
+    } while (0)
 #define __Pyx_XDECREF_SET(r, v) do {\
         PyObject *tmp = (PyObject *) r;\
         r = v; __Pyx_XDECREF(tmp);\
@@ -939,40 +2031,38 @@ struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr {
 #define __Pyx_CLEAR(r)    do { PyObject* tmp = ((PyObject*)(r)); r = NULL; __Pyx_DECREF(tmp);} while(0)
 #define __Pyx_XCLEAR(r)   do { if((r) != NULL) {PyObject* tmp = ((PyObject*)(r)); r = NULL; __Pyx_DECREF(tmp);}} while(0)
 
-/* PyObjectGetAttrStr.proto */
-#if CYTHON_USE_TYPE_SLOTS
-static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject* attr_name);
+/* FastTypeChecks.proto (used by GivenExceptionMatches) */
+#if CYTHON_COMPILING_IN_CPYTHON
+#define __Pyx_TypeCheck(obj, type) __Pyx_IsSubtype(Py_TYPE(obj), (PyTypeObject *)type)
+#define __Pyx_TypeCheck2(obj, type1, type2) __Pyx_IsAnySubtype2(Py_TYPE(obj), (PyTypeObject *)type1, (PyTypeObject *)type2)
+static CYTHON_INLINE int __Pyx_IsSubtype(PyTypeObject *a, PyTypeObject *b);
+static CYTHON_INLINE int __Pyx_IsAnySubtype2(PyTypeObject *cls, PyTypeObject *a, PyTypeObject *b);
+#define __Pyx_PyAnySet_Check(obj)  __Pyx_TypeCheck2(obj, &PySet_Type, &PyFrozenSet_Type)
 #else
-#define __Pyx_PyObject_GetAttrStr(o,n) PyObject_GetAttr(o,n)
+#define __Pyx_TypeCheck(obj, type) PyObject_TypeCheck(obj, (PyTypeObject *)type)
+#define __Pyx_TypeCheck2(obj, type1, type2) (PyObject_TypeCheck(obj, (PyTypeObject *)type1) || PyObject_TypeCheck(obj, (PyTypeObject *)type2))
+#define __Pyx_PyAnySet_Check(obj)  PyAnySet_Check(obj)
 #endif
 
-/* GetBuiltinName.proto */
-static PyObject *__Pyx_GetBuiltinName(PyObject *name);
-
-/* RaiseArgTupleInvalid.proto */
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found);
-
-/* RaiseDoubleKeywords.proto */
-static void __Pyx_RaiseDoubleKeywordsError(const char* func_name, PyObject* kw_name);
-
-/* ParseKeywords.proto */
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],\
-    PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,\
-    const char* function_name);
-
-/* PyThreadStateGet.proto */
+/* PyThreadStateGet.proto (used by PyErrFetchRestore) */
 #if CYTHON_FAST_THREAD_STATE
 #define __Pyx_PyThreadState_declare  PyThreadState *__pyx_tstate;
 #define __Pyx_PyThreadState_assign  __pyx_tstate = __Pyx_PyThreadState_Current;
-#define __Pyx_PyErr_Occurred()  __pyx_tstate->curexc_type
+#if PY_VERSION_HEX >= 0x030C00A6
+#define __Pyx_PyErr_Occurred()  (__pyx_tstate->current_exception != NULL)
+#define __Pyx_PyErr_CurrentExceptionType()  (__pyx_tstate->current_exception ? (PyObject*) Py_TYPE(__pyx_tstate->current_exception) : (PyObject*) NULL)
+#else
+#define __Pyx_PyErr_Occurred()  (__pyx_tstate->curexc_type != NULL)
+#define __Pyx_PyErr_CurrentExceptionType()  (__pyx_tstate->curexc_type)
+#endif
 #else
 #define __Pyx_PyThreadState_declare
 #define __Pyx_PyThreadState_assign
-#define __Pyx_PyErr_Occurred()  PyErr_Occurred()
+#define __Pyx_PyErr_Occurred()  (PyErr_Occurred() != NULL)
+#define __Pyx_PyErr_CurrentExceptionType()  PyErr_Occurred()
 #endif
 
-/* PyErrFetchRestore.proto */
+/* PyErrFetchRestore.proto (used by GivenExceptionMatches) */
 #if CYTHON_FAST_THREAD_STATE
 #define __Pyx_PyErr_Clear() __Pyx_ErrRestore(NULL, NULL, NULL)
 #define __Pyx_ErrRestoreWithState(type, value, tb)  __Pyx_ErrRestoreInState(PyThreadState_GET(), type, value, tb)
@@ -981,7 +2071,7 @@ static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],\
 #define __Pyx_ErrFetch(type, value, tb)    __Pyx_ErrFetchInState(__pyx_tstate, type, value, tb)
 static CYTHON_INLINE void __Pyx_ErrRestoreInState(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb);
 static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb);
-#if CYTHON_COMPILING_IN_CPYTHON
+#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX < 0x030C00A6
 #define __Pyx_PyErr_SetNone(exc) (Py_INCREF(exc), __Pyx_ErrRestore((exc), NULL, NULL))
 #else
 #define __Pyx_PyErr_SetNone(exc) PyErr_SetNone(exc)
@@ -997,34 +2087,232 @@ static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject
 #define __Pyx_ErrFetch(type, value, tb)  PyErr_Fetch(type, value, tb)
 #endif
 
-/* Profile.proto */
-#ifndef CYTHON_PROFILE
-#if CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_PYSTON
-  #define CYTHON_PROFILE 0
+/* GivenExceptionMatches.proto (used by PyErrExceptionMatches) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches(PyObject *err, PyObject *type);
+static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches2(PyObject *err, PyObject *type1, PyObject *type2);
 #else
-  #define CYTHON_PROFILE 1
-#endif
+#define __Pyx_PyErr_GivenExceptionMatches(err, type) PyErr_GivenExceptionMatches(err, type)
+static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches2(PyObject *err, PyObject *type1, PyObject *type2) {
+    return PyErr_GivenExceptionMatches(err, type1) || PyErr_GivenExceptionMatches(err, type2);
+}
 #endif
-#ifndef CYTHON_TRACE_NOGIL
-  #define CYTHON_TRACE_NOGIL 0
+#define __Pyx_PyErr_ExceptionMatches2(err1, err2)  __Pyx_PyErr_GivenExceptionMatches2(__Pyx_PyErr_CurrentExceptionType(), err1, err2)
+
+/* PyErrExceptionMatches.proto (used by PyObjectGetAttrStrNoError) */
+#if CYTHON_FAST_THREAD_STATE
+#define __Pyx_PyErr_ExceptionMatches(err) __Pyx_PyErr_ExceptionMatchesInState(__pyx_tstate, err)
+static CYTHON_INLINE int __Pyx_PyErr_ExceptionMatchesInState(PyThreadState* tstate, PyObject* err);
 #else
-  #if CYTHON_TRACE_NOGIL && !defined(CYTHON_TRACE)
-    #define CYTHON_TRACE 1
-  #endif
+#define __Pyx_PyErr_ExceptionMatches(err)  PyErr_ExceptionMatches(err)
 #endif
-#ifndef CYTHON_TRACE
-  #define CYTHON_TRACE 0
+
+/* PyObjectGetAttrStr.proto (used by PyObjectGetAttrStrNoError) */
+#if CYTHON_USE_TYPE_SLOTS
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject* attr_name);
+#else
+#define __Pyx_PyObject_GetAttrStr(o,n) PyObject_GetAttr(o,n)
 #endif
+
+/* PyObjectGetAttrStrNoError.proto (used by GetBuiltinName) */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStrNoError(PyObject* obj, PyObject* attr_name);
+
+/* GetBuiltinName.proto */
+static PyObject *__Pyx_GetBuiltinName(PyObject *name);
+
+/* Profile.proto */
 #if CYTHON_TRACE
   #undef CYTHON_PROFILE_REUSE_FRAME
 #endif
+#if CYTHON_USE_MODULE_STATE
+  #undef CYTHON_PROFILE_REUSE_CODEOBJ
+  #define CYTHON_PROFILE_REUSE_CODEOBJ 0
+  #undef CYTHON_PROFILE_REUSE_FRAME
+#endif
+#ifndef CYTHON_PROFILE_REUSE_CODEOBJ
+  #define CYTHON_PROFILE_REUSE_CODEOBJ 1
+#endif
 #ifndef CYTHON_PROFILE_REUSE_FRAME
   #define CYTHON_PROFILE_REUSE_FRAME 0
 #endif
+#if CYTHON_USE_SYS_MONITORING && (CYTHON_PROFILE || CYTHON_TRACE)
+  #define __PYX_MONITORING_ABI_SUFFIX  "_mon"
+#else
+  #define __PYX_MONITORING_ABI_SUFFIX
+#endif
 #if CYTHON_PROFILE || CYTHON_TRACE
+#if CYTHON_USE_SYS_MONITORING
+  typedef uint64_t __pyx_monitoring_version_type;
+  #define __Pyx_TraceDeclarationsFunc\
+      PyObject *__pyx_frame_code = NULL;\
+      PyMonitoringState __pyx_pymonitoring_state[__Pyx_MonitoringEventTypes_CyFunc_count];\
+      int __pyx_exception_already_reported = 0;\
+      const int __pyx_sys_monitoring_disabled_in_parallel = 0; CYTHON_UNUSED_VAR(__pyx_sys_monitoring_disabled_in_parallel);
+  #define __Pyx_TraceDeclarationsGen\
+      PyObject *__pyx_frame_code = Py_NewRef(__pyx_generator->gi_code);\
+      PyMonitoringState* __pyx_pymonitoring_state = __pyx_generator->__pyx_pymonitoring_state;\
+      __pyx_monitoring_version_type __pyx_pymonitoring_version = __pyx_generator->__pyx_pymonitoring_version;\
+      int __pyx_exception_already_reported = 0;\
+      const int __pyx_sys_monitoring_disabled_in_parallel = 0; CYTHON_UNUSED_VAR(__pyx_sys_monitoring_disabled_in_parallel);
+  #define __Pyx_IsTracing(event_id)  ((!__pyx_sys_monitoring_disabled_in_parallel) && (__pyx_pymonitoring_state[event_id]).active)
+  #define __Pyx_TraceFrameInit(codeobj)\
+      if (codeobj) __pyx_frame_code = codeobj;
+  #define __Pyx_TurnOffSysMonitoringInParallel\
+    const int __pyx_sys_monitoring_disabled_in_parallel = 1;\
+    CYTHON_UNUSED_VAR(__pyx_sys_monitoring_disabled_in_parallel);
+  CYTHON_UNUSED static PyCodeObject *__Pyx_createFrameCodeObject(const char *funcname, const char *srcfile, int firstlineno);
+  CYTHON_UNUSED static int __Pyx__TraceStartFunc(PyMonitoringState *state_array, PyObject *code_obj, int offset, int skip_event);
+  CYTHON_UNUSED static int __Pyx__TraceStartGen(PyMonitoringState *state_array, __pyx_monitoring_version_type *version, PyObject *code_obj, int offset);
+  CYTHON_UNUSED static int __Pyx__TraceResumeGen(PyMonitoringState *state_array, __pyx_monitoring_version_type *version, PyObject *code_obj, int offset);
+  CYTHON_UNUSED static void __Pyx__TraceException(PyMonitoringState *monitoring_state, PyObject *code_obj, int offset, int reraised);
+  #define __Pyx_PyMonitoring_ExitScope(nogil)\
+    if (nogil) {\
+        (void) __pyx_exception_already_reported;\
+        if (CYTHON_TRACE_NOGIL) {\
+            PyGILState_STATE state = PyGILState_Ensure();\
+            PyMonitoring_ExitScope();\
+            Py_XDECREF(__pyx_frame_code);\
+            PyGILState_Release(state);\
+        }\
+    } else {\
+        PyMonitoring_ExitScope();\
+        Py_XDECREF(__pyx_frame_code);\
+    }
+  #define __Pyx_TraceStartFunc(funcname, srcfile, firstlineno, offset, nogil, skip_event, goto_error)\
+  if ((0) ); else {\
+      int ret = 0;\
+      memset(__pyx_pymonitoring_state, 0, sizeof(__pyx_pymonitoring_state));\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              if (!__Pyx_PyThreadState_Current->tracing) {\
+                  if (likely(__pyx_frame_code)) Py_INCREF(__pyx_frame_code);\
+                  else __pyx_frame_code = (PyObject*) __Pyx_createFrameCodeObject(funcname, srcfile, firstlineno);\
+                  if (unlikely(!__pyx_frame_code)) ret = -1;\
+                  else ret = __Pyx__TraceStartFunc(__pyx_pymonitoring_state, __pyx_frame_code, offset, skip_event);\
+              } else __pyx_frame_code = NULL;\
+              PyGILState_Release(state);\
+          } else __pyx_frame_code = NULL;\
+      } else {\
+          if (!__Pyx_PyThreadState_Current->tracing) {\
+              if (likely(__pyx_frame_code)) Py_INCREF(__pyx_frame_code);\
+              else __pyx_frame_code = (PyObject*) __Pyx_createFrameCodeObject(funcname, srcfile, firstlineno);\
+              if (unlikely(!__pyx_frame_code)) ret = -1;\
+              else ret = __Pyx__TraceStartFunc(__pyx_pymonitoring_state, __pyx_frame_code, offset, skip_event);\
+          } else __pyx_frame_code = NULL;\
+      }\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceStartGen(funcname, srcfile, firstlineno, offset, nogil, skip_event, goto_error)\
+  if ((0) ); else {\
+      int ret = __Pyx__TraceStartGen(__pyx_pymonitoring_state, &__pyx_pymonitoring_version, __pyx_frame_code, offset);\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceResumeGen(funcname, srcfile, firstlineno, offset, goto_error)\
+  if ((0) ); else {\
+      int ret = __Pyx__TraceResumeGen(__pyx_pymonitoring_state, &__pyx_pymonitoring_version, __pyx_frame_code, offset);\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceYield(result, offset, goto_error)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_PY_YIELD)); else {\
+      int ret = PyMonitoring_FirePyYieldEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_RETURN], __pyx_frame_code, offset, result);\
+      PyMonitoring_ExitScope();\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceException(offset, reraised, fresh)\
+  if (!__Pyx_IsTracing((reraised) ? __Pyx_Monitoring_RERAISE : __Pyx_Monitoring_RAISE)); else {\
+      if (fresh || reraised || !__pyx_exception_already_reported) {\
+          __Pyx__TraceException(&__pyx_pymonitoring_state[(reraised) ? __Pyx_Monitoring_RERAISE : __Pyx_Monitoring_RAISE], __pyx_frame_code, offset, reraised);\
+      }\
+      __pyx_exception_already_reported = 1;\
+  }
+  #define __Pyx_TraceExceptionDone()  __pyx_exception_already_reported = 0
+  #define __Pyx_TraceExceptionHandled(offset)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_EXCEPTION_HANDLED)); else {\
+      (void) PyMonitoring_FireExceptionHandledEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_EXCEPTION_HANDLED], __pyx_frame_code, offset);\
+      __pyx_exception_already_reported = 0;\
+  }
+  #define __Pyx_TraceReturnValue(result, offset, nogil, goto_error)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_PY_RETURN)); else {\
+      int ret = 0;\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              ret = PyMonitoring_FirePyReturnEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_RETURN], __pyx_frame_code, offset, result);\
+              PyGILState_Release(state);\
+          }\
+      } else {\
+          ret = PyMonitoring_FirePyReturnEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_RETURN], __pyx_frame_code, offset, result);\
+      }\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceReturnCValue(cresult, convert_function, offset, nogil, goto_error)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_PY_RETURN)); else {\
+      int ret = 0;\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              PyObject *pyvalue = convert_function(cresult);\
+              if (unlikely(!pyvalue)) {\
+                  if (!PyErr_ExceptionMatches(PyExc_Exception)) goto_error;\
+                  PyErr_Clear();\
+                  pyvalue = Py_None; Py_INCREF(Py_None);\
+              }\
+              ret = PyMonitoring_FirePyReturnEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_RETURN], __pyx_frame_code, offset, pyvalue);\
+              Py_DECREF(pyvalue);\
+              PyGILState_Release(state);\
+          }\
+      } else {\
+          PyObject *pyvalue = convert_function(cresult);\
+          if (unlikely(!pyvalue)) {\
+              if (!PyErr_ExceptionMatches(PyExc_Exception)) goto_error;\
+              PyErr_Clear();\
+              pyvalue = Py_None; Py_INCREF(Py_None);\
+          }\
+          ret = PyMonitoring_FirePyReturnEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_RETURN], __pyx_frame_code, offset, pyvalue);\
+          Py_DECREF(pyvalue);\
+      }\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #define __Pyx_TraceExceptionUnwind(offset, nogil)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_PY_UNWIND)); else {\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              (void) PyMonitoring_FirePyUnwindEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_UNWIND], __pyx_frame_code, offset);\
+              PyGILState_Release(state);\
+          }\
+      } else {\
+          (void) PyMonitoring_FirePyUnwindEvent(&__pyx_pymonitoring_state[__Pyx_Monitoring_PY_UNWIND], __pyx_frame_code, offset);\
+      }\
+  }
+  #if CYTHON_TRACE
+  CYTHON_UNUSED static int __Pyx__TraceLine(PyMonitoringState *monitoring_state, PyObject *code_obj, int line, int offset);
+  #define __Pyx_TraceLine(line, offset, nogil, goto_error)\
+  if (!__Pyx_IsTracing(__Pyx_Monitoring_LINE)); else {\
+      int ret = 0;\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              ret = __Pyx__TraceLine(&__pyx_pymonitoring_state[__Pyx_Monitoring_LINE], __pyx_frame_code, line, offset);\
+              PyGILState_Release(state);\
+          }\
+      } else {\
+          ret = __Pyx__TraceLine(&__pyx_pymonitoring_state[__Pyx_Monitoring_LINE], __pyx_frame_code, line, offset);\
+      }\
+      if (unlikely(ret == -1)) goto_error;\
+  }
+  #endif
+#else
   #include "compile.h"
   #include "frameobject.h"
   #include "traceback.h"
+#if PY_VERSION_HEX >= 0x030b00a6 && !defined(PYPY_VERSION)
+  #ifndef Py_BUILD_CORE
+    #define Py_BUILD_CORE 1
+  #endif
+  #include "internal/pycore_frame.h"
+#endif
   #if CYTHON_PROFILE_REUSE_FRAME
     #define CYTHON_FRAME_MODIFIER static
     #define CYTHON_FRAME_DEL(frame)
@@ -1032,177 +2320,241 @@ static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject
     #define CYTHON_FRAME_MODIFIER
     #define CYTHON_FRAME_DEL(frame) Py_CLEAR(frame)
   #endif
-  #define __Pyx_TraceDeclarations\
-  static PyCodeObject *__pyx_frame_code = NULL;\
-  CYTHON_FRAME_MODIFIER PyFrameObject *__pyx_frame = NULL;\
-  int __Pyx_use_tracing = 0;
+  #if CYTHON_PROFILE_REUSE_CODEOBJ
+    #define CYTHON_CODEOBJ_MODIFIER static
+  #else
+    #define CYTHON_CODEOBJ_MODIFIER
+  #endif
+  #define __Pyx_TraceDeclarationsFunc\
+      CYTHON_CODEOBJ_MODIFIER PyCodeObject *__pyx_frame_code = NULL;\
+      CYTHON_FRAME_MODIFIER PyFrameObject *__pyx_frame = NULL;\
+      int __Pyx_use_tracing = 0;
+  #define __Pyx_TraceDeclarationsGen\
+      PyObject *__pyx_frame_code = __pyx_generator->gi_code;\
+      CYTHON_FRAME_MODIFIER PyFrameObject *__pyx_frame = NULL;\
+      int __Pyx_use_tracing = 0;
   #define __Pyx_TraceFrameInit(codeobj)\
-  if (codeobj) __pyx_frame_code = (PyCodeObject*) codeobj;
-  #ifdef WITH_THREAD
-  #define __Pyx_TraceCall(funcname, srcfile, firstlineno, nogil, goto_error)\
+      if (codeobj) __pyx_frame_code = (PyCodeObject*) codeobj;
+  #define __Pyx_PyMonitoring_ExitScope(nogil)\
+    if (!CYTHON_PROFILE_REUSE_FRAME && nogil) {\
+        PyGILState_STATE state = PyGILState_Ensure();\
+        CYTHON_FRAME_DEL(__pyx_frame);\
+        PyGILState_Release(state);\
+    } else {\
+        CYTHON_FRAME_DEL(__pyx_frame);\
+    }
+  #define __Pyx_TraceException(offset, reraised, fresh)  {}
+  #define __Pyx_TraceExceptionHandled(offset)  {}
+  #define __Pyx_TraceExceptionDone()  {}
+  #define __Pyx_TurnOffSysMonitoringInParallel {} // Only needed for freethreading
+#if PY_VERSION_HEX >= 0x030b00a2
+  #if PY_VERSION_HEX >= 0x030C00b1
+  #define __Pyx_IsTracing(tstate, check_tracing, check_funcs)\
+     ((!(check_tracing) || !(tstate)->tracing) &&\
+         (!(check_funcs) || (tstate)->c_profilefunc || (CYTHON_TRACE && (tstate)->c_tracefunc)))
+  #else
+  #define __Pyx_IsTracing(tstate, check_tracing, check_funcs)\
+     (unlikely((tstate)->cframe->use_tracing) &&\
+         (!(check_tracing) || !(tstate)->tracing) &&\
+         (!(check_funcs) || (tstate)->c_profilefunc || (CYTHON_TRACE && (tstate)->c_tracefunc)))
+  #endif
+  #define __Pyx_EnterTracing(tstate)  PyThreadState_EnterTracing(tstate)
+  #define __Pyx_LeaveTracing(tstate)  PyThreadState_LeaveTracing(tstate)
+#elif PY_VERSION_HEX >= 0x030a00b1
+  #define __Pyx_IsTracing(tstate, check_tracing, check_funcs)\
+     (unlikely((tstate)->cframe->use_tracing) &&\
+         (!(check_tracing) || !(tstate)->tracing) &&\
+         (!(check_funcs) || (tstate)->c_profilefunc || (CYTHON_TRACE && (tstate)->c_tracefunc)))
+  #define __Pyx_EnterTracing(tstate)\
+      do { tstate->tracing++; tstate->cframe->use_tracing = 0; } while (0)
+  #define __Pyx_LeaveTracing(tstate)\
+      do {\
+          tstate->tracing--;\
+          tstate->cframe->use_tracing = ((CYTHON_TRACE && tstate->c_tracefunc != NULL)\
+                                 || tstate->c_profilefunc != NULL);\
+      } while (0)
+#else
+  #define __Pyx_IsTracing(tstate, check_tracing, check_funcs)\
+     (unlikely((tstate)->use_tracing) &&\
+         (!(check_tracing) || !(tstate)->tracing) &&\
+         (!(check_funcs) || (tstate)->c_profilefunc || (CYTHON_TRACE && (tstate)->c_tracefunc)))
+  #define __Pyx_EnterTracing(tstate)\
+      do { tstate->tracing++; tstate->use_tracing = 0; } while (0)
+  #define __Pyx_LeaveTracing(tstate)\
+      do {\
+          tstate->tracing--;\
+          tstate->use_tracing = ((CYTHON_TRACE && tstate->c_tracefunc != NULL)\
+                                         || tstate->c_profilefunc != NULL);\
+      } while (0)
+#endif
+  #define __Pyx_TraceStartFunc(funcname, srcfile, firstlineno, offset, nogil, skip_event, goto_error)\
   if (nogil) {\
       if (CYTHON_TRACE_NOGIL) {\
           PyThreadState *tstate;\
           PyGILState_STATE state = PyGILState_Ensure();\
           tstate = __Pyx_PyThreadState_Current;\
-          if (unlikely(tstate->use_tracing) && !tstate->tracing &&\
-                  (tstate->c_profilefunc || (CYTHON_TRACE && tstate->c_tracefunc))) {\
-              __Pyx_use_tracing = __Pyx_TraceSetupAndCall(&__pyx_frame_code, &__pyx_frame, tstate, funcname, srcfile, firstlineno);\
+          if (__Pyx_IsTracing(tstate, 1, 1)) {\
+              __Pyx_use_tracing = __Pyx_TraceSetupAndCall((PyCodeObject**)&__pyx_frame_code, &__pyx_frame, tstate, funcname, srcfile, firstlineno, skip_event);\
           }\
           PyGILState_Release(state);\
           if (unlikely(__Pyx_use_tracing < 0)) goto_error;\
       }\
   } else {\
       PyThreadState* tstate = PyThreadState_GET();\
-      if (unlikely(tstate->use_tracing) && !tstate->tracing &&\
-              (tstate->c_profilefunc || (CYTHON_TRACE && tstate->c_tracefunc))) {\
-          __Pyx_use_tracing = __Pyx_TraceSetupAndCall(&__pyx_frame_code, &__pyx_frame, tstate, funcname, srcfile, firstlineno);\
-          if (unlikely(__Pyx_use_tracing < 0)) goto_error;\
-      }\
-  }
-  #else
-  #define __Pyx_TraceCall(funcname, srcfile, firstlineno, nogil, goto_error)\
-  {   PyThreadState* tstate = PyThreadState_GET();\
-      if (unlikely(tstate->use_tracing) && !tstate->tracing &&\
-              (tstate->c_profilefunc || (CYTHON_TRACE && tstate->c_tracefunc))) {\
-          __Pyx_use_tracing = __Pyx_TraceSetupAndCall(&__pyx_frame_code, &__pyx_frame, tstate, funcname, srcfile, firstlineno);\
+      if (__Pyx_IsTracing(tstate, 1, 1)) {\
+          __Pyx_use_tracing = __Pyx_TraceSetupAndCall((PyCodeObject**)&__pyx_frame_code, &__pyx_frame, tstate, funcname, srcfile, firstlineno, skip_event);\
           if (unlikely(__Pyx_use_tracing < 0)) goto_error;\
       }\
   }
-  #endif
-  #define __Pyx_TraceException()\
+  #define __Pyx_TraceStartGen __Pyx_TraceStartFunc
+  #define __Pyx_TraceYield(result, offset, goto_error)\
   if (likely(!__Pyx_use_tracing)); else {\
       PyThreadState* tstate = __Pyx_PyThreadState_Current;\
-      if (tstate->use_tracing &&\
-              (tstate->c_profilefunc || (CYTHON_TRACE && tstate->c_tracefunc))) {\
-          tstate->tracing++;\
-          tstate->use_tracing = 0;\
-          PyObject *exc_info = __Pyx_GetExceptionTuple(tstate);\
-          if (exc_info) {\
-              if (CYTHON_TRACE && tstate->c_tracefunc)\
-                  tstate->c_tracefunc(\
-                      tstate->c_traceobj, __pyx_frame, PyTrace_EXCEPTION, exc_info);\
-              tstate->c_profilefunc(\
-                  tstate->c_profileobj, __pyx_frame, PyTrace_EXCEPTION, exc_info);\
-              Py_DECREF(exc_info);\
-          }\
-          tstate->use_tracing = 1;\
-          tstate->tracing--;\
+      if (__Pyx_IsTracing(tstate, 0, 0)) {\
+          __Pyx_call_return_trace_func(tstate, __pyx_frame, (PyObject*)result);\
       }\
+      if ((1)); else goto_error;\
   }
-  static void __Pyx_call_return_trace_func(PyThreadState *tstate, PyFrameObject *frame, PyObject *result) {
+  #define __Pyx_TraceResumeGen(funcname, srcfile, firstlineno, offset, goto_error)\
+      __Pyx_TraceStartFunc(funcname, srcfile, firstlineno, offset, 0, 0, goto_error)
+  CYTHON_UNUSED static void __Pyx_call_return_trace_func(PyThreadState *tstate, PyFrameObject *frame, PyObject *result) {
       PyObject *type, *value, *traceback;
       __Pyx_ErrFetchInState(tstate, &type, &value, &traceback);
-      tstate->tracing++;
-      tstate->use_tracing = 0;
+      __Pyx_EnterTracing(tstate);
       if (CYTHON_TRACE && tstate->c_tracefunc)
           tstate->c_tracefunc(tstate->c_traceobj, frame, PyTrace_RETURN, result);
       if (tstate->c_profilefunc)
           tstate->c_profilefunc(tstate->c_profileobj, frame, PyTrace_RETURN, result);
-      CYTHON_FRAME_DEL(frame);
-      tstate->use_tracing = 1;
-      tstate->tracing--;
+      __Pyx_LeaveTracing(tstate);
       __Pyx_ErrRestoreInState(tstate, type, value, traceback);
   }
-  #ifdef WITH_THREAD
-  #define __Pyx_TraceReturn(result, nogil)\
+  #define __Pyx_TraceReturnValue(result, offset, nogil, goto_error)\
   if (likely(!__Pyx_use_tracing)); else {\
       if (nogil) {\
           if (CYTHON_TRACE_NOGIL) {\
               PyThreadState *tstate;\
               PyGILState_STATE state = PyGILState_Ensure();\
               tstate = __Pyx_PyThreadState_Current;\
-              if (tstate->use_tracing) {\
+              if (__Pyx_IsTracing(tstate, 0, 0)) {\
                   __Pyx_call_return_trace_func(tstate, __pyx_frame, (PyObject*)result);\
               }\
               PyGILState_Release(state);\
           }\
       } else {\
           PyThreadState* tstate = __Pyx_PyThreadState_Current;\
-          if (tstate->use_tracing) {\
+          if (__Pyx_IsTracing(tstate, 0, 0)) {\
               __Pyx_call_return_trace_func(tstate, __pyx_frame, (PyObject*)result);\
           }\
       }\
+      if ((1)); else goto_error;\
   }
-  #else
-  #define __Pyx_TraceReturn(result, nogil)\
+  #define __Pyx_TraceReturnCValue(cresult, convert_function, offset, nogil, goto_error)\
   if (likely(!__Pyx_use_tracing)); else {\
-      PyThreadState* tstate = __Pyx_PyThreadState_Current;\
-      if (tstate->use_tracing) {\
-          __Pyx_call_return_trace_func(tstate, __pyx_frame, (PyObject*)result);\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyThreadState *tstate;\
+              PyGILState_STATE state = PyGILState_Ensure();\
+              tstate = __Pyx_PyThreadState_Current;\
+              if (__Pyx_IsTracing(tstate, 0, 0)) {\
+                  PyObject *pyvalue = convert_function(cresult);\
+                  if (unlikely(!pyvalue)) {\
+                    if (!PyErr_ExceptionMatches(PyExc_Exception)) goto_error\
+                    PyErr_Clear();\
+                    pyvalue = Py_None; Py_INCREF(Py_None);\
+                  }\
+                  __Pyx_call_return_trace_func(tstate, __pyx_frame, pyvalue);\
+                  Py_DECREF(pyvalue);\
+              }\
+              PyGILState_Release(state);\
+          }\
+      } else {\
+          PyThreadState* tstate = __Pyx_PyThreadState_Current;\
+          if (__Pyx_IsTracing(tstate, 0, 0)) {\
+              PyObject *pyvalue = convert_function(cresult);\
+              if (unlikely(!pyvalue)) {\
+                  if (!PyErr_ExceptionMatches(PyExc_Exception)) goto_error\
+                  PyErr_Clear();\
+                  pyvalue = Py_None; Py_INCREF(Py_None);\
+              }\
+              __Pyx_call_return_trace_func(tstate, __pyx_frame, pyvalue);\
+              Py_DECREF(pyvalue);\
+          }\
       }\
+      if ((1)); else goto_error;\
   }
-  #endif
-  static PyCodeObject *__Pyx_createFrameCodeObject(const char *funcname, const char *srcfile, int firstlineno);
-  static int __Pyx_TraceSetupAndCall(PyCodeObject** code, PyFrameObject** frame, PyThreadState* tstate, const char *funcname, const char *srcfile, int firstlineno);
-#else
-  #define __Pyx_TraceDeclarations
-  #define __Pyx_TraceFrameInit(codeobj)
-  #define __Pyx_TraceCall(funcname, srcfile, firstlineno, nogil, goto_error)   if ((1)); else goto_error;
-  #define __Pyx_TraceException()
-  #define __Pyx_TraceReturn(result, nogil)
-#endif
-#if CYTHON_TRACE
-  static int __Pyx_call_line_trace_func(PyThreadState *tstate, PyFrameObject *frame, int lineno) {
-      int ret;
-      PyObject *type, *value, *traceback;
-      __Pyx_ErrFetchInState(tstate, &type, &value, &traceback);
-      __Pyx_PyFrame_SetLineNumber(frame, lineno);
-      tstate->tracing++;
-      tstate->use_tracing = 0;
-      ret = tstate->c_tracefunc(tstate->c_traceobj, frame, PyTrace_LINE, NULL);
-      tstate->use_tracing = 1;
-      tstate->tracing--;
-      if (likely(!ret)) {
-          __Pyx_ErrRestoreInState(tstate, type, value, traceback);
-      } else {
-          Py_XDECREF(type);
-          Py_XDECREF(value);
-          Py_XDECREF(traceback);
-      }
-      return ret;
-  }
-  #ifdef WITH_THREAD
-  #define __Pyx_TraceLine(lineno, nogil, goto_error)\
+  #define __Pyx_TraceExceptionUnwind(offset, nogil)\
   if (likely(!__Pyx_use_tracing)); else {\
       if (nogil) {\
           if (CYTHON_TRACE_NOGIL) {\
-              int ret = 0;\
               PyThreadState *tstate;\
               PyGILState_STATE state = PyGILState_Ensure();\
               tstate = __Pyx_PyThreadState_Current;\
-              if (unlikely(tstate->use_tracing && tstate->c_tracefunc && __pyx_frame->f_trace)) {\
-                  ret = __Pyx_call_line_trace_func(tstate, __pyx_frame, lineno);\
+              if (__Pyx_IsTracing(tstate, 0, 0)) {\
+                  __Pyx_call_return_trace_func(tstate, __pyx_frame, Py_None);\
               }\
               PyGILState_Release(state);\
-              if (unlikely(ret)) goto_error;\
           }\
       } else {\
           PyThreadState* tstate = __Pyx_PyThreadState_Current;\
-          if (unlikely(tstate->use_tracing && tstate->c_tracefunc && __pyx_frame->f_trace)) {\
-              int ret = __Pyx_call_line_trace_func(tstate, __pyx_frame, lineno);\
-              if (unlikely(ret)) goto_error;\
+          if (__Pyx_IsTracing(tstate, 0, 0)) {\
+              __Pyx_call_return_trace_func(tstate, __pyx_frame, Py_None);\
           }\
       }\
   }
-  #else
-  #define __Pyx_TraceLine(lineno, nogil, goto_error)\
+  static int __Pyx_TraceSetupAndCall(PyCodeObject** code, PyFrameObject** frame, PyThreadState* tstate, const char *funcname, const char *srcfile, int firstlineno, int skip_event);
+#if CYTHON_TRACE
+  CYTHON_UNUSED static int __Pyx_call_line_trace_func(PyThreadState *tstate, PyFrameObject *frame, int line);
+  #define __Pyx_TraceLine(line, offset, nogil, goto_error)\
   if (likely(!__Pyx_use_tracing)); else {\
-      PyThreadState* tstate = __Pyx_PyThreadState_Current;\
-      if (unlikely(tstate->use_tracing && tstate->c_tracefunc && __pyx_frame->f_trace)) {\
-          int ret = __Pyx_call_line_trace_func(tstate, __pyx_frame, lineno);\
-          if (unlikely(ret)) goto_error;\
+      int ret = 0;\
+      if (nogil) {\
+          if (CYTHON_TRACE_NOGIL) {\
+              PyThreadState *tstate;\
+              PyGILState_STATE state = __Pyx_PyGILState_Ensure();\
+              tstate = __Pyx_PyThreadState_Current;\
+              if (__Pyx_IsTracing(tstate, 0, 0) && tstate->c_tracefunc && __pyx_frame->f_trace) {\
+                  ret = __Pyx_call_line_trace_func(tstate, __pyx_frame, line);\
+              }\
+              __Pyx_PyGILState_Release(state);\
+          }\
+      } else {\
+          PyThreadState* tstate = __Pyx_PyThreadState_Current;\
+          if (__Pyx_IsTracing(tstate, 0, 0) && tstate->c_tracefunc && __pyx_frame->f_trace) {\
+              ret = __Pyx_call_line_trace_func(tstate, __pyx_frame, line);\
+          }\
       }\
+      if (unlikely(ret)) goto_error;\
   }
-  #endif
+#endif
+#endif
 #else
-  #define __Pyx_TraceLine(lineno, nogil, goto_error)   if ((1)); else goto_error;
+  #define __Pyx_TraceDeclarationsFunc
+  #define __Pyx_TraceDeclarationsGen
+  #define __Pyx_TraceExceptionDone()  {}
+  #define __Pyx_TraceFrameInit(codeobj)  {}
+  #define __Pyx_TurnOffSysMonitoringInParallel {}
+  #define __Pyx_PyMonitoring_ExitScope(nogil)  {}
+  #define __Pyx_TraceException(offset, reraised, fresh)  {}
+  #define __Pyx_TraceExceptionUnwind(offset, nogil)  {}
+  #define __Pyx_TraceExceptionHandled(offset)  {}
+  #define __Pyx_TraceStartFunc(funcname, srcfile, firstlineno, offset, nogil, skip_event, goto_error)   if ((1)); else goto_error;
+  #define __Pyx_TraceStartGen __Pyx_TraceStartFunc
+  #define __Pyx_TraceResumeGen(funcname, srcfile, firstlineno, offset, goto_error)   if ((1)); else goto_error;
+  #define __Pyx_TraceYield(result, offset, goto_error)   if ((1)); else goto_error;
+  #define __Pyx_TraceReturnValue(result, offset, nogil, goto_error)\
+      if ((1)); else goto_error;
+  #define __Pyx_TraceReturnCValue(cresult, convert_function, offset, nogil, goto_error)\
+      if ((1)); else { (void) convert_function; goto_error }
+#endif
+#if !CYTHON_TRACE
+  #define __Pyx_TraceLine(line, offset, nogil, goto_error)   if ((1)); else goto_error;
 #endif
 
-/* None.proto */
-static CYTHON_INLINE void __Pyx_RaiseClosureNameError(const char *varname);
+/* IgnoreException.proto (used by GetModuleGlobalName) */
+static CYTHON_INLINE int __Pyx_IgnoreGivenException(PyObject *given_exception, PyObject *ignorable_exception);
+#define __Pyx_IgnoreException(ignorable_exception) __Pyx_IgnoreGivenException(NULL, ignorable_exception)
 
-/* PyDictVersioning.proto */
+/* PyDictVersioning.proto (used by GetModuleGlobalName) */
 #if CYTHON_USE_DICT_VERSIONS && CYTHON_USE_TYPE_SLOTS
 #define __PYX_DICT_VERSION_INIT  ((PY_UINT64_T) -1)
 #define __PYX_GET_DICT_VERSION(dict)  (((PyDictObject*)(dict))->ma_version_tag)
@@ -1213,7 +2565,7 @@ static CYTHON_INLINE void __Pyx_RaiseClosureNameError(const char *varname);
     static PY_UINT64_T __pyx_dict_version = 0;\
     static PyObject *__pyx_dict_cached_value = NULL;\
     if (likely(__PYX_GET_DICT_VERSION(DICT) == __pyx_dict_version)) {\
-        (VAR) = __pyx_dict_cached_value;\
+        (VAR) = __Pyx_XNewRef(__pyx_dict_cached_value);\
     } else {\
         (VAR) = __pyx_dict_cached_value = (LOOKUP);\
         __pyx_dict_version = __PYX_GET_DICT_VERSION(DICT);\
@@ -1230,18 +2582,18 @@ static CYTHON_INLINE int __Pyx_object_dict_version_matches(PyObject* obj, PY_UIN
 
 /* GetModuleGlobalName.proto */
 #if CYTHON_USE_DICT_VERSIONS
-#define __Pyx_GetModuleGlobalName(var, name)  {\
+#define __Pyx_GetModuleGlobalName(var, name)  do {\
     static PY_UINT64_T __pyx_dict_version = 0;\
     static PyObject *__pyx_dict_cached_value = NULL;\
-    (var) = (likely(__pyx_dict_version == __PYX_GET_DICT_VERSION(__pyx_d))) ?\
+    (var) = (likely(__pyx_dict_version == __PYX_GET_DICT_VERSION(__pyx_mstate_global->__pyx_d))) ?\
         (likely(__pyx_dict_cached_value) ? __Pyx_NewRef(__pyx_dict_cached_value) : __Pyx_GetBuiltinName(name)) :\
         __Pyx__GetModuleGlobalName(name, &__pyx_dict_version, &__pyx_dict_cached_value);\
-}
-#define __Pyx_GetModuleGlobalNameUncached(var, name)  {\
+} while(0)
+#define __Pyx_GetModuleGlobalNameUncached(var, name)  do {\
     PY_UINT64_T __pyx_dict_version;\
     PyObject *__pyx_dict_cached_value;\
     (var) = __Pyx__GetModuleGlobalName(name, &__pyx_dict_version, &__pyx_dict_cached_value);\
-}
+} while(0)
 static PyObject *__Pyx__GetModuleGlobalName(PyObject *name, PY_UINT64_T *dict_version, PyObject **dict_cached_value);
 #else
 #define __Pyx_GetModuleGlobalName(var, name)  (var) = __Pyx__GetModuleGlobalName(name)
@@ -1249,120 +2601,283 @@ static PyObject *__Pyx__GetModuleGlobalName(PyObject *name, PY_UINT64_T *dict_ve
 static CYTHON_INLINE PyObject *__Pyx__GetModuleGlobalName(PyObject *name);
 #endif
 
-/* PyFunctionFastCall.proto */
-#if CYTHON_FAST_PYCALL
-#define __Pyx_PyFunction_FastCall(func, args, nargs)\
-    __Pyx_PyFunction_FastCallDict((func), (args), (nargs), NULL)
-#if 1 || PY_VERSION_HEX < 0x030600B1
-static PyObject *__Pyx_PyFunction_FastCallDict(PyObject *func, PyObject **args, Py_ssize_t nargs, PyObject *kwargs);
-#else
-#define __Pyx_PyFunction_FastCallDict(func, args, nargs, kwargs) _PyFunction_FastCallDict(func, args, nargs, kwargs)
-#endif
-#define __Pyx_BUILD_ASSERT_EXPR(cond)\
-    (sizeof(char [1 - 2*!(cond)]) - 1)
-#ifndef Py_MEMBER_SIZE
-#define Py_MEMBER_SIZE(type, member) sizeof(((type *)0)->member)
-#endif
-  static size_t __pyx_pyframe_localsplus_offset = 0;
-  #include "frameobject.h"
-  #define __Pxy_PyFrame_Initialize_Offsets()\
-    ((void)__Pyx_BUILD_ASSERT_EXPR(sizeof(PyFrameObject) == offsetof(PyFrameObject, f_localsplus) + Py_MEMBER_SIZE(PyFrameObject, f_localsplus)),\
-     (void)(__pyx_pyframe_localsplus_offset = ((size_t)PyFrame_Type.tp_basicsize) - Py_MEMBER_SIZE(PyFrameObject, f_localsplus)))
-  #define __Pyx_PyFrame_GetLocalsplus(frame)\
-    (assert(__pyx_pyframe_localsplus_offset), (PyObject **)(((char *)(frame)) + __pyx_pyframe_localsplus_offset))
-#endif
-
-/* PyCFunctionFastCall.proto */
-#if CYTHON_FAST_PYCCALL
-static CYTHON_INLINE PyObject *__Pyx_PyCFunction_FastCall(PyObject *func, PyObject **args, Py_ssize_t nargs);
+/* ListAppend.proto */
+#if CYTHON_USE_PYLIST_INTERNALS && CYTHON_ASSUME_SAFE_MACROS && CYTHON_ASSUME_SAFE_SIZE
+static CYTHON_INLINE int __Pyx_PyList_Append(PyObject* list, PyObject* x);
 #else
-#define __Pyx_PyCFunction_FastCall(func, args, nargs)  (assert(0), NULL)
+#define __Pyx_PyList_Append(L,x) PyList_Append(L,x)
 #endif
 
-/* PyObjectCall.proto */
+/* PyObjectCall.proto (used by PyObjectFastCall) */
 #if CYTHON_COMPILING_IN_CPYTHON
 static CYTHON_INLINE PyObject* __Pyx_PyObject_Call(PyObject *func, PyObject *arg, PyObject *kw);
 #else
 #define __Pyx_PyObject_Call(func, arg, kw) PyObject_Call(func, arg, kw)
 #endif
 
-/* IncludeStringH.proto */
-#include <string.h>
+/* PyObjectCallMethO.proto (used by PyObjectFastCall) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg);
+#endif
 
-/* PyObject_GenericGetAttrNoDict.proto */
-#if CYTHON_USE_TYPE_SLOTS && CYTHON_USE_PYTYPE_LOOKUP && PY_VERSION_HEX < 0x03070000
-static CYTHON_INLINE PyObject* __Pyx_PyObject_GenericGetAttrNoDict(PyObject* obj, PyObject* attr_name);
-#else
-#define __Pyx_PyObject_GenericGetAttrNoDict PyObject_GenericGetAttr
+/* PyObjectFastCall.proto */
+#define __Pyx_PyObject_FastCall(func, args, nargs)  __Pyx_PyObject_FastCallDict(func, args, (size_t)(nargs), NULL)
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FastCallDict(PyObject *func, PyObject * const*args, size_t nargsf, PyObject *kwargs);
+
+/* FormatTypeName.proto (used by RaiseErrorWithObjectType1) */
+#if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+typedef PyObject *__Pyx_TypeName;
+#define __Pyx_FMT_TYPENAME "%N"
+#define __Pyx_PyType_GetFullyQualifiedName(tp) Py_NewRef((PyObject*)tp)
+#define __Pyx_DECREF_TypeName(obj) Py_DECREF(obj)
+#elif CYTHON_COMPILING_IN_LIMITED_API
+typedef PyObject *__Pyx_TypeName;
+#define __Pyx_FMT_TYPENAME "%U"
+#define __Pyx_DECREF_TypeName(obj) Py_XDECREF(obj)
+static __Pyx_TypeName __Pyx_PyType_GetFullyQualifiedName(PyTypeObject* tp);
+#else  // !LIMITED_API
+typedef const char *__Pyx_TypeName;
+#define __Pyx_FMT_TYPENAME "%.200s"
+#define __Pyx_PyType_GetFullyQualifiedName(tp) ((tp)->tp_name)
+#define __Pyx_DECREF_TypeName(obj)
 #endif
 
-/* Import.proto */
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list, int level);
+/* RaiseErrorWithObjectType1.proto (used by RaiseUnexpectedTypeError) */
+#define __Pyx_RaiseTypeErrorWithObjectType1(message, arg, obj) __Pyx_RaiseErrorWithObjectType1(PyExc_TypeError, message, arg, obj)
+#define __Pyx_RaiseErrorWithObjectType1(exc_type, message, arg, obj) __Pyx_RaiseErrorWithType1(exc_type, message, arg, Py_TYPE(obj))
+CYTHON_UNUSED
+static void __Pyx_RaiseErrorWithType1(PyObject* exc_type, const char* message, const char *arg, PyTypeObject *type_obj);
 
-/* ImportFrom.proto */
-static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name);
+/* RaiseUnexpectedTypeError.proto */
+CYTHON_UNUSED
+static int __Pyx_RaiseUnexpectedTypeError(const char *expected, PyObject *obj);
 
-/* CLineInTraceback.proto */
-#ifdef CYTHON_CLINE_IN_TRACEBACK
-#define __Pyx_CLineForTraceback(tstate, c_line)  (((CYTHON_CLINE_IN_TRACEBACK)) ? c_line : 0)
+/* PyFrozenDict.proto (used by GetItemInt) */
+#if CYTHON_COMPILING_IN_LIMITED_API
+#define __Pyx_PyFrozenDict_TypePtr  ((PyTypeObject*) __pyx_mstate_global->__Pyx_PyFrozenDictType)
+#define __Pyx_PyFrozenDict_New(it)  __Pyx__PyFrozenDict_New(__pyx_mstate_global->__Pyx_PyFrozenDictType, it)
+static CYTHON_INLINE PyObject* __Pyx__PyFrozenDict_New(PyObject* frozendict_type, PyObject* it);
+#define __Pyx_PyFrozenDict_NewEmpty()  __Pyx_PyFrozenDict_New(NULL)
+#define __Pyx_PyFrozenDict_Check(obj)  PyObject_TypeCheck((obj), __Pyx_PyFrozenDict_TypePtr)
+#define __Pyx_PyFrozenDict_CheckExact(obj)  Py_IS_TYPE((obj), __Pyx_PyFrozenDict_TypePtr)
+#define __Pyx_PyAnyDict_Check(obj)   __Pyx__PyAnyDict_Check(obj, __Pyx_PyFrozenDict_TypePtr)
+static CYTHON_INLINE int __Pyx__PyAnyDict_Check(PyObject *obj, PyTypeObject* frozendict_type) {
+    return PyObject_TypeCheck(obj, &PyDict_Type) || PyObject_TypeCheck(obj, frozendict_type);
+}
+#define __Pyx_PyAnyDict_CheckExact(obj)  __Pyx__PyAnyDict_CheckExact(obj, __Pyx_PyFrozenDict_TypePtr)
+static CYTHON_INLINE int __Pyx__PyAnyDict_CheckExact(PyObject *obj, PyTypeObject* frozendict_type) {
+    return Py_IS_TYPE(obj, &PyDict_Type) || Py_IS_TYPE(obj, frozendict_type);
+}
+#elif PY_VERSION_HEX >= 0x030f00a6 ||\
+    (defined(PyFrozenDict_Check) && defined(PyAnyDict_Check) && defined(PyFrozenDict_New))
+#define __Pyx_PyFrozenDict_TypePtr  (&PyFrozenDict_Type)
+#define __Pyx_PyFrozenDict_New(it)  PyFrozenDict_New(it)
+#define __Pyx_PyFrozenDict_NewEmpty()  PyFrozenDict_New(NULL)
+#define __Pyx_PyFrozenDict_Check(obj)  PyFrozenDict_Check(obj)
+#define __Pyx_PyFrozenDict_CheckExact(obj)  PyFrozenDict_CheckExact(obj)
+#define __Pyx_PyAnyDict_Check(obj)  PyAnyDict_Check(obj)
+#define __Pyx_PyAnyDict_CheckExact(obj)  PyAnyDict_CheckExact(obj)
 #else
-static int __Pyx_CLineForTraceback(PyThreadState *tstate, int c_line);
+#define __Pyx_PyFrozenDict_TypePtr  (&PyDict_Type)
+static CYTHON_INLINE PyObject* __Pyx_PyFrozenDict_New(PyObject* it) {
+    if (!it) {
+        return PyDict_New();
+    } else if (PyDict_Check(it)) {
+        return PyDict_Copy(it);
+    } else {
+        PyObject *dict = PyDict_New();
+        if (!dict) return NULL;
+        PyObject *result = PyNumber_InPlaceOr(dict, it);
+        Py_DECREF(dict);
+        return result;
+    }
+}
+#define __Pyx_PyFrozenDict_NewEmpty()  PyDict_New()
+#define __Pyx_PyFrozenDict_Check(obj)  PyDict_Check(obj)
+#define __Pyx_PyFrozenDict_CheckExact(obj)  PyDict_CheckExact(obj)
+#define __Pyx_PyAnyDict_Check(obj)  PyDict_Check(obj)
+#define __Pyx_PyAnyDict_CheckExact(obj)  PyDict_CheckExact(obj)
 #endif
 
-/* CodeObjectCache.proto */
-typedef struct {
-    PyCodeObject* code_object;
-    int code_line;
-} __Pyx_CodeObjectCacheEntry;
-struct __Pyx_CodeObjectCache {
-    int count;
-    int max_count;
-    __Pyx_CodeObjectCacheEntry* entries;
-};
-static struct __Pyx_CodeObjectCache __pyx_code_cache = {0,0,NULL};
-static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line);
-static PyCodeObject *__pyx_find_code_object(int code_line);
-static void __pyx_insert_code_object(int code_line, PyCodeObject* code_object);
+/* GetItemInt.proto */
+#define __Pyx_GetItemInt(o, i, type, is_signed, to_py_func, wraparound, boundscheck, has_gil, unsafe_shared)\
+    (__Pyx_fits_Py_ssize_t(i, type, is_signed) ?\
+    __Pyx_GetItemInt_Fast(o, (Py_ssize_t)i, wraparound, boundscheck, unsafe_shared) :\
+    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
+#define __Pyx_GetItemInt_List(o, i, type, is_signed, to_py_func, wraparound, boundscheck, has_gil, unsafe_shared)\
+    (__Pyx_fits_Py_ssize_t(i, type, is_signed) ?\
+    __Pyx_GetItemInt_List_Fast(o, (Py_ssize_t)i, wraparound, boundscheck, unsafe_shared) :\
+    (PyErr_SetString(PyExc_IndexError, "list index out of range"), (PyObject*)NULL))
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_List_Fast(PyObject *o, Py_ssize_t i,
+                                                              int wraparound, int boundscheck, int unsafe_shared);
+#define __Pyx_GetItemInt_Tuple(o, i, type, is_signed, to_py_func, wraparound, boundscheck, has_gil, unsafe_shared)\
+    (__Pyx_fits_Py_ssize_t(i, type, is_signed) ?\
+    __Pyx_GetItemInt_Tuple_Fast(o, (Py_ssize_t)i, wraparound, boundscheck, unsafe_shared) :\
+    (PyErr_SetString(PyExc_IndexError, "tuple index out of range"), (PyObject*)NULL))
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Tuple_Fast(PyObject *o, Py_ssize_t i,
+                                                              int wraparound, int boundscheck, int unsafe_shared);
+static PyObject *__Pyx_GetItemInt_Generic(PyObject *o, PyObject* j);
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Fast(PyObject *o, Py_ssize_t i,
+                                                     int wraparound, int boundscheck, int unsafe_shared);
 
-/* AddTraceback.proto */
-static void __Pyx_AddTraceback(const char *funcname, int c_line,
-                               int py_line, const char *filename);
+/* GetAttr3.proto */
+static CYTHON_INLINE PyObject *__Pyx_GetAttr3(PyObject *, PyObject *, PyObject *);
 
-/* GCCDiagnostics.proto */
-#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
-#define __Pyx_HAS_GCC_DIAGNOSTIC
+/* CopyObjectArray.proto (used by TupleOrListFromArrayImpl) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE void __Pyx_copy_object_array(PyObject *const *CYTHON_RESTRICT src, PyObject** CYTHON_RESTRICT dest, Py_ssize_t length);
 #endif
 
-/* CIntToPy.proto */
-static CYTHON_INLINE PyObject* __Pyx_PyInt_From_long(long value);
+/* TupleOrListFromArrayImpl.proto (used by TupleFromArray) */
+#if PY_VERSION_HEX >= 0x030F0000 && !CYTHON_COMPILING_IN_LIMITED_API
+#define __Pyx_PyTuple_FromArray(src, n) PyTuple_FromArray(src, ((n)<0) ? 0 : (n))
+#else
+CYTHON_UNUSED static PyObject *
+__Pyx_PyTuple_FromArray(PyObject *const *src, Py_ssize_t n);
+#endif
 
-/* CIntFromPy.proto */
-static CYTHON_INLINE long __Pyx_PyInt_As_long(PyObject *);
+/* TupleFromArray.proto */
 
-/* CIntFromPy.proto */
-static CYTHON_INLINE int __Pyx_PyInt_As_int(PyObject *);
 
-/* FastTypeChecks.proto */
-#if CYTHON_COMPILING_IN_CPYTHON
-#define __Pyx_TypeCheck(obj, type) __Pyx_IsSubtype(Py_TYPE(obj), (PyTypeObject *)type)
-static CYTHON_INLINE int __Pyx_IsSubtype(PyTypeObject *a, PyTypeObject *b);
-static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches(PyObject *err, PyObject *type);
-static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches2(PyObject *err, PyObject *type1, PyObject *type2);
+/* HasAttr.proto */
+#if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+#define __Pyx_HasAttr(o, n)  PyObject_HasAttrWithError(o, n)
 #else
-#define __Pyx_TypeCheck(obj, type) PyObject_TypeCheck(obj, (PyTypeObject *)type)
-#define __Pyx_PyErr_GivenExceptionMatches(err, type) PyErr_GivenExceptionMatches(err, type)
-#define __Pyx_PyErr_GivenExceptionMatches2(err, type1, type2) (PyErr_GivenExceptionMatches(err, type1) || PyErr_GivenExceptionMatches(err, type2))
+static CYTHON_INLINE int __Pyx_HasAttr(PyObject *, PyObject *);
 #endif
-#define __Pyx_PyException_Check(obj) __Pyx_TypeCheck(obj, PyExc_Exception)
 
-/* FetchCommonType.proto */
-static PyTypeObject* __Pyx_FetchCommonType(PyTypeObject* type);
+/* RaiseErrorWithObjectType.proto (used by SliceObject) */
+#define __Pyx_RaiseTypeErrorWithObjectType(message, obj)  __Pyx_RaiseErrorWithObjectType(PyExc_TypeError, message, obj)
+#define __Pyx_RaiseErrorWithObjectType(exc_type, message, obj)  __Pyx_RaiseErrorWithType(exc_type, message, Py_TYPE(obj))
+CYTHON_UNUSED
+static void __Pyx_RaiseErrorWithType(PyObject* exc_type, const char* message, PyTypeObject *type_obj);
+
+/* SliceObject.proto */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetSlice(
+        PyObject* obj, Py_ssize_t cstart, Py_ssize_t cstop,
+        PyObject** py_start, PyObject** py_stop, PyObject** py_slice,
+        int has_cstart, int has_cstop, int wraparound);
 
-/* RaiseException.proto */
+/* PyTypeError_Check.proto */
+#define __Pyx_PyExc_TypeError_Check(obj)  __Pyx_TypeCheck(obj, PyExc_TypeError)
+
+/* PyObjectFormatAndDecref.proto */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FormatSimpleAndDecref(PyObject* s, PyObject* f);
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FormatAndDecref(PyObject* s, PyObject* f);
+
+/* RaiseException.export */
 static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb, PyObject *cause);
 
-/* GetTopmostException.proto */
-#if CYTHON_USE_EXC_INFO_STACK
+/* PySequenceContains.proto */
+static CYTHON_INLINE int __Pyx_PySequence_ContainsTF(PyObject* item, PyObject* seq, int eq) {
+    int result = PySequence_Contains(seq, item);
+    return unlikely(result < 0) ? result : (result == (eq == Py_EQ));
+}
+
+/* IncludeStringH.proto (used by JoinPyUnicode) */
+#include <string.h>
+
+/* JoinPyUnicode.proto */
+#define __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH\
+    (!CYTHON_COMPILING_IN_GRAAL && !CYTHON_COMPILING_IN_PYPY && !CYTHON_COMPILING_IN_LIMITED_API)
+
+/* JoinPyUnicode.export */
+static PyObject* __Pyx_PyUnicode_Join(PyObject** values, Py_ssize_t value_count, Py_ssize_t result_ulength, int kind);
+
+/* DivInt[Py_ssize_t].proto */
+static CYTHON_INLINE Py_ssize_t __Pyx_div_Py_ssize_t(Py_ssize_t, Py_ssize_t, int b_is_constant);
+
+/* UnaryNegOverflows.proto */
+#define __Pyx_UNARY_NEG_WOULD_OVERFLOW(x)\
+        (((x) < 0) & ((unsigned long)(x) == 0-(unsigned long)(x)))
+
+/* PyRuntimeError_Check.proto */
+#define __Pyx_PyExc_RuntimeError_Check(obj)  __Pyx_TypeCheck(obj, PyExc_RuntimeError)
+
+/* IterFinish.proto (used by dict_iter_common) */
+static CYTHON_INLINE int __Pyx_IterFinish(void);
+
+/* PyObjectCallMethod0.proto (used by dict_iter_common) */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethod0(PyObject* obj, PyObject* method_name);
+
+/* RaiseNeedMoreValuesToUnpack.proto (used by UnpackTuple2) */
+static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index);
+
+/* RaiseTooManyValuesToUnpack.proto (used by UnpackItemEndCheck) */
+static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected);
+
+/* UnpackItemEndCheck.proto (used by UnpackTuple2) */
+static int __Pyx_IternextUnpackEndCheck(PyObject *retval, Py_ssize_t expected);
+
+/* RaiseNoneIterError.proto (used by UnpackTupleError) */
+static CYTHON_INLINE void __Pyx_RaiseNoneNotIterableError(void);
+
+/* UnpackTupleError.proto (used by UnpackTuple2) */
+static void __Pyx_UnpackTupleError(PyObject *, Py_ssize_t index);
+
+/* UnpackTuple2.proto (used by dict_iter_common) */
+static CYTHON_INLINE int __Pyx_unpack_tuple2(
+    PyObject* tuple, PyObject** value1, PyObject** value2, int is_tuple, int has_known_size, int decref_tuple);
+static CYTHON_INLINE int __Pyx_unpack_tuple2_exact(
+    PyObject* tuple, PyObject** value1, PyObject** value2, int decref_tuple);
+static int __Pyx_unpack_tuple2_generic(
+    PyObject* tuple, PyObject** value1, PyObject** value2, int has_known_size, int decref_tuple);
+
+/* dict_iter_common.proto (used by dict_iter) */
+static PyObject *__Pyx_dict_call_to_get_iterable(PyObject* iterable, PyObject* method_name);
+static CYTHON_INLINE int __Pyx_dict_iter_next(PyObject* dict_or_iter, Py_ssize_t orig_length, Py_ssize_t* ppos,
+                                              PyObject** pkey, PyObject** pvalue, PyObject** pitem, int is_dict);
+
+/* dict_iter.proto */
+static CYTHON_INLINE PyObject* __Pyx_dict_iterator(PyObject* dict, int is_dict, PyObject* method_name,
+                                                   Py_ssize_t* p_orig_length, int* p_is_dict);
+
+/* FunctionExport.proto */
+static int __Pyx_ExportFunction(PyObject *api_dict, const char *name, void (*f)(void), const char *sig);
+
+/* GetApiDict.proto */
+static PyObject *__Pyx_ApiExport_GetApiDict(void);
+
+/* TypeImport.proto */
+#ifndef __PYX_HAVE_RT_ImportType_proto_3_3_0
+#define __PYX_HAVE_RT_ImportType_proto_3_3_0
+#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#include <stdalign.h>
+#endif
+#if (defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L) || __cplusplus >= 201103L
+#define __PYX_GET_STRUCT_ALIGNMENT_3_3_0(s) alignof(s)
+#else
+#define __PYX_GET_STRUCT_ALIGNMENT_3_3_0(s) sizeof(void*)
+#endif
+enum __Pyx_ImportType_CheckSize_3_3_0 {
+   __Pyx_ImportType_CheckSize_Error_3_3_0 = 0,
+   __Pyx_ImportType_CheckSize_Warn_3_3_0 = 1,
+   __Pyx_ImportType_CheckSize_Ignore_3_3_0 = 2
+};
+static PyTypeObject *__Pyx_ImportType_3_3_0(PyObject* module, const char *module_name, const char *class_name, size_t size, size_t alignment, enum __Pyx_ImportType_CheckSize_3_3_0 check_size);
+#endif
+
+/* TupleOrListFromArrayImpl.proto (used by ListFromArray) */
+CYTHON_UNUSED static PyObject *
+__Pyx_PyList_FromArray(PyObject *const *src, Py_ssize_t n);
+
+/* ListFromArray.proto (used by ImportImpl) */
+
+
+/* PyObjectCallOneArg.proto (used by ImportImpl) */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg);
+
+/* ImportImpl.export */
+static PyObject *__Pyx__Import(PyObject *name, PyObject *const *imported_names, Py_ssize_t len_imported_names, PyObject *qualname, PyObject *moddict, int level);
+
+/* Import.proto */
+static CYTHON_INLINE PyObject *__Pyx_Import(PyObject *name, PyObject *const *imported_names, Py_ssize_t len_imported_names, PyObject *qualname, int level);
+
+/* ImportFrom.export */
+static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name);
+
+/* GetTopmostException.proto (used by SaveResetException) */
+#if CYTHON_USE_EXC_INFO_STACK && CYTHON_FAST_THREAD_STATE
 static _PyErr_StackItem * __Pyx_PyErr_GetTopmostException(PyThreadState *tstate);
 #endif
 
@@ -1377,4336 +2892,14424 @@ static CYTHON_INLINE void __Pyx__ExceptionReset(PyThreadState *tstate, PyObject
 #define __Pyx_ExceptionReset(type, value, tb)  PyErr_SetExcInfo(type, value, tb)
 #endif
 
-/* SwapException.proto */
+/* PyImportError_Check.proto */
+#define __Pyx_PyExc_ImportError_Check(obj)  __Pyx_TypeCheck(obj, PyExc_ImportError)
+
+/* GetException.proto */
 #if CYTHON_FAST_THREAD_STATE
-#define __Pyx_ExceptionSwap(type, value, tb)  __Pyx__ExceptionSwap(__pyx_tstate, type, value, tb)
-static CYTHON_INLINE void __Pyx__ExceptionSwap(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb);
+#define __Pyx_GetException(type, value, tb)  __Pyx__GetException(__pyx_tstate, type, value, tb)
+static int __Pyx__GetException(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb);
 #else
-static CYTHON_INLINE void __Pyx_ExceptionSwap(PyObject **type, PyObject **value, PyObject **tb);
+static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb);
 #endif
 
-/* PyObjectCall2Args.proto */
-static CYTHON_UNUSED PyObject* __Pyx_PyObject_Call2Args(PyObject* function, PyObject* arg1, PyObject* arg2);
+/* dict_setdefault.proto (used by CLineInTraceback) */
+static CYTHON_INLINE PyObject *__Pyx_PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *default_value);
 
-/* PyObjectCallMethO.proto */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg);
+/* CLineInTraceback.proto (used by AddTraceback) */
+#if CYTHON_CLINE_IN_TRACEBACK && CYTHON_CLINE_IN_TRACEBACK_RUNTIME
+static int __Pyx_CLineForTraceback(PyThreadState *tstate, int c_line);
+#else
+#define __Pyx_CLineForTraceback(tstate, c_line)  (((CYTHON_CLINE_IN_TRACEBACK)) ? c_line : 0)
 #endif
 
-/* PyObjectCallOneArg.proto */
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg);
-
-/* PyObjectGetMethod.proto */
-static int __Pyx_PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method);
-
-/* PyObjectCallMethod1.proto */
-static PyObject* __Pyx_PyObject_CallMethod1(PyObject* obj, PyObject* method_name, PyObject* arg);
-
-/* CoroutineBase.proto */
-typedef PyObject *(*__pyx_coroutine_body_t)(PyObject *, PyThreadState *, PyObject *);
-#if CYTHON_USE_EXC_INFO_STACK
-#define __Pyx_ExcInfoStruct  _PyErr_StackItem
+/* CodeObjectCache.proto (used by AddTraceback) */
+#if CYTHON_COMPILING_IN_LIMITED_API
+typedef PyObject __Pyx_CachedCodeObjectType;
 #else
-typedef struct {
-    PyObject *exc_type;
-    PyObject *exc_value;
-    PyObject *exc_traceback;
-} __Pyx_ExcInfoStruct;
+typedef PyCodeObject __Pyx_CachedCodeObjectType;
 #endif
 typedef struct {
-    PyObject_HEAD
-    __pyx_coroutine_body_t body;
-    PyObject *closure;
-    __Pyx_ExcInfoStruct gi_exc_state;
-    PyObject *gi_weakreflist;
-    PyObject *classobj;
-    PyObject *yieldfrom;
-    PyObject *gi_name;
-    PyObject *gi_qualname;
-    PyObject *gi_modulename;
-    PyObject *gi_code;
-    int resume_label;
-    char is_running;
-} __pyx_CoroutineObject;
-static __pyx_CoroutineObject *__Pyx__Coroutine_New(
-    PyTypeObject *type, __pyx_coroutine_body_t body, PyObject *code, PyObject *closure,
-    PyObject *name, PyObject *qualname, PyObject *module_name);
-static __pyx_CoroutineObject *__Pyx__Coroutine_NewInit(
-            __pyx_CoroutineObject *gen, __pyx_coroutine_body_t body, PyObject *code, PyObject *closure,
-            PyObject *name, PyObject *qualname, PyObject *module_name);
-static CYTHON_INLINE void __Pyx_Coroutine_ExceptionClear(__Pyx_ExcInfoStruct *self);
-static int __Pyx_Coroutine_clear(PyObject *self);
-static PyObject *__Pyx_Coroutine_Send(PyObject *self, PyObject *value);
-static PyObject *__Pyx_Coroutine_Close(PyObject *self);
-static PyObject *__Pyx_Coroutine_Throw(PyObject *gen, PyObject *args);
-#if CYTHON_USE_EXC_INFO_STACK
-#define __Pyx_Coroutine_SwapException(self)
-#define __Pyx_Coroutine_ResetAndClearException(self)  __Pyx_Coroutine_ExceptionClear(&(self)->gi_exc_state)
-#else
-#define __Pyx_Coroutine_SwapException(self) {\
-    __Pyx_ExceptionSwap(&(self)->gi_exc_state.exc_type, &(self)->gi_exc_state.exc_value, &(self)->gi_exc_state.exc_traceback);\
-    __Pyx_Coroutine_ResetFrameBackpointer(&(self)->gi_exc_state);\
-    }
-#define __Pyx_Coroutine_ResetAndClearException(self) {\
-    __Pyx_ExceptionReset((self)->gi_exc_state.exc_type, (self)->gi_exc_state.exc_value, (self)->gi_exc_state.exc_traceback);\
-    (self)->gi_exc_state.exc_type = (self)->gi_exc_state.exc_value = (self)->gi_exc_state.exc_traceback = NULL;\
-    }
+    __Pyx_CachedCodeObjectType* code_object;
+    int code_line;
+} __Pyx_CodeObjectCacheEntry;
+struct __Pyx_CodeObjectCache {
+    int count;
+    int max_count;
+    __Pyx_CodeObjectCacheEntry* entries;
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_atomic_int_type accessor_count;
+  #endif
+};
+static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line);
+static __Pyx_CachedCodeObjectType *__pyx_find_code_object(int code_line);
+static void __pyx_insert_code_object(int code_line, __Pyx_CachedCodeObjectType* code_object);
+
+/* AddTraceback.proto */
+static void __Pyx_AddTraceback(const char *funcname, int c_line,
+                               int py_line, const char *filename);
+
+/* CppExceptionConversion.proto */
+#ifndef __Pyx_CppExn2PyErr
+#include <new>
+#include <typeinfo>
+#include <stdexcept>
+#include <ios>
+static void __Pyx_CppExn2PyErr() {
+  try {
+    if (PyErr_Occurred())
+      ; // let the latest Python exn pass through and ignore the current one
+    else
+      throw;
+  } catch (const std::bad_alloc& exn) {
+    PyErr_SetString(PyExc_MemoryError, exn.what());
+  } catch (const std::bad_cast& exn) {
+    PyErr_SetString(PyExc_TypeError, exn.what());
+  } catch (const std::bad_typeid& exn) {
+    PyErr_SetString(PyExc_TypeError, exn.what());
+  } catch (const std::domain_error& exn) {
+    PyErr_SetString(PyExc_ValueError, exn.what());
+  } catch (const std::invalid_argument& exn) {
+    PyErr_SetString(PyExc_ValueError, exn.what());
+  } catch (const std::ios_base::failure& exn) {
+    PyErr_SetString(PyExc_IOError, exn.what());
+  } catch (const std::out_of_range& exn) {
+    PyErr_SetString(PyExc_IndexError, exn.what());
+  } catch (const std::overflow_error& exn) {
+    PyErr_SetString(PyExc_OverflowError, exn.what());
+  } catch (const std::range_error& exn) {
+    PyErr_SetString(PyExc_ArithmeticError, exn.what());
+  } catch (const std::underflow_error& exn) {
+    PyErr_SetString(PyExc_ArithmeticError, exn.what());
+  } catch (const std::exception& exn) {
+    PyErr_SetString(PyExc_RuntimeError, exn.what());
+  }
+  catch (...)
+  {
+    PyErr_SetString(PyExc_RuntimeError, "Unknown exception");
+  }
+}
 #endif
-#if CYTHON_FAST_THREAD_STATE
-#define __Pyx_PyGen_FetchStopIterationValue(pvalue)\
-    __Pyx_PyGen__FetchStopIterationValue(__pyx_tstate, pvalue)
+
+/* GCCDiagnostics.proto */
+#if !defined(__INTEL_COMPILER) && defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
+#define __Pyx_HAS_GCC_DIAGNOSTIC
+#endif
+
+/* PyObjectVectorcallKwds.proto (used by PyObjectVectorcallMethodKwds) */
+#if CYTHON_VECTORCALL
+#define __Pyx_Object_VectorcallKwds PyObject_Vectorcall
+CYTHON_UNUSED static int __Pyx_CheckVectorcallKwarg(PyObject *kwnames, Py_ssize_t i);
+#else
+#define __Pyx_Object_VectorcallKwds __Pyx_PyObject_FastCallDict
+CYTHON_UNUSED static PyObject *__Pyx_MakeKwargDict(PyObject **keys, PyObject **values, Py_ssize_t n);
+CYTHON_UNUSED static int __Pyx_CheckVectorcallKwarg(PyObject **kwnames, Py_ssize_t i);
+#endif
+
+/* PyObjectVectorcallMethodKwds.proto (used by CIntToPy) */
+#if CYTHON_VECTORCALL
+#define __Pyx_Object_VectorcallMethodKwds PyObject_VectorcallMethod
 #else
-#define __Pyx_PyGen_FetchStopIterationValue(pvalue)\
-    __Pyx_PyGen__FetchStopIterationValue(__Pyx_PyThreadState_Current, pvalue)
+static PyObject *__Pyx_Object_VectorcallMethodKwds(PyObject *name, PyObject *const *args, size_t nargsf, PyObject *kwnames);
 #endif
-static int __Pyx_PyGen__FetchStopIterationValue(PyThreadState *tstate, PyObject **pvalue);
-static CYTHON_INLINE void __Pyx_Coroutine_ResetFrameBackpointer(__Pyx_ExcInfoStruct *exc_state);
 
-/* PatchModuleWithCoroutine.proto */
-static PyObject* __Pyx_Coroutine_patch_module(PyObject* module, const char* py_code);
+/* CIntToPy.proto */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_long(long value);
+
+/* CIntFromPy.proto */
+static CYTHON_INLINE size_t __Pyx_PyLong_As_size_t(PyObject *);
+
+/* CIntToPy.proto */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_int(int value);
+
+/* CIntToPy.proto */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_unsigned_long(unsigned long value);
+
+/* CIntFromPy.proto */
+static CYTHON_INLINE long __Pyx_PyLong_As_long(PyObject *);
+
+/* CIntFromPy.proto */
+static CYTHON_INLINE int __Pyx_PyLong_As_int(PyObject *);
 
-/* PatchGeneratorABC.proto */
-static int __Pyx_patch_abc(void);
+/* GetRuntimeVersion.proto */
+#if __PYX_LIMITED_VERSION_HEX < 0x030b0000
+static unsigned long __Pyx_cached_runtime_version = 0;
+static void __Pyx_init_runtime_version(void);
+#else
+#define __Pyx_init_runtime_version()
+#endif
+static unsigned long __Pyx_get_runtime_version(void);
 
-/* Generator.proto */
-#define __Pyx_Generator_USED
-static PyTypeObject *__pyx_GeneratorType = 0;
-#define __Pyx_Generator_CheckExact(obj) (Py_TYPE(obj) == __pyx_GeneratorType)
-#define __Pyx_Generator_New(body, code, closure, name, qualname, module_name)\
-    __Pyx__Coroutine_New(__pyx_GeneratorType, body, code, closure, name, qualname, module_name)
-static PyObject *__Pyx_Generator_Next(PyObject *self);
-static int __pyx_Generator_init(void);
+/* AddModuleRef.proto */
+#if ((CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && PY_VERSION_HEX < 0x030F00a3) ||\
+     __PYX_LIMITED_VERSION_HEX < 0x030d0000)
+  static PyObject *__Pyx_PyImport_AddModuleRef(const char *name);
+#else
+  #define __Pyx_PyImport_AddModuleRef(name) PyImport_AddModuleRef(name)
+#endif
 
 /* CheckBinaryVersion.proto */
-static int __Pyx_check_binary_version(void);
+static int __Pyx_check_binary_version(unsigned long ct_version, unsigned long rt_version, int allow_newer);
+
+/* DecompressString.proto */
+static PyObject *__Pyx_DecompressString(const char *s, Py_ssize_t length, int algo);
+
+/* DecompressString_LZSS.proto */
+static PyObject *__Pyx_DecompressString_LZSS(const char *s, size_t compressed_length, size_t uncompressed_length);
+
+/* MultiPhaseInitModuleState.proto */
+#if CYTHON_PEP489_MULTI_PHASE_INIT && CYTHON_USE_MODULE_STATE
+#include <stdlib.h>
+static PyObject *__Pyx_State_FindModule(void*);
+static int __Pyx_State_AddModule(PyObject* module, void*);
+static int __Pyx_State_RemoveModule(void*);
+#elif CYTHON_USE_MODULE_STATE
+#define __Pyx_State_FindModule PyState_FindModule
+#define __Pyx_State_AddModule PyState_AddModule
+#define __Pyx_State_RemoveModule PyState_RemoveModule
+#endif
+
+/* #### Code section: module_declarations ### */
+/* CythonABIVersion.proto */
+#if CYTHON_COMPILING_IN_LIMITED_API
+    #if CYTHON_VECTORCALL
+        #define __PYX_VECTORCALL_ABI_SUFFIX  "_vectorcall"
+    #else
+        #define __PYX_VECTORCALL_ABI_SUFFIX
+    #endif
+    #define __PYX_LIMITED_ABI_SUFFIX "limited" __PYX_VECTORCALL_ABI_SUFFIX __PYX_AM_SEND_ABI_SUFFIX
+#else
+    #define __PYX_LIMITED_ABI_SUFFIX
+#endif
+#if __PYX_HAS_PY_AM_SEND == 1
+    #define __PYX_AM_SEND_ABI_SUFFIX
+#elif __PYX_HAS_PY_AM_SEND == 2
+    #define __PYX_AM_SEND_ABI_SUFFIX "amsendbackport"
+#else
+    #define __PYX_AM_SEND_ABI_SUFFIX "noamsend"
+#endif
+#ifndef __PYX_MONITORING_ABI_SUFFIX
+    #define __PYX_MONITORING_ABI_SUFFIX
+#endif
+#if CYTHON_USE_TP_FINALIZE
+    #define __PYX_TP_FINALIZE_ABI_SUFFIX
+#else
+    #define __PYX_TP_FINALIZE_ABI_SUFFIX "nofinalize"
+#endif
+#if CYTHON_USE_FREELISTS || !defined(__Pyx_AsyncGen_USED)
+    #define __PYX_FREELISTS_ABI_SUFFIX
+#else
+    #define __PYX_FREELISTS_ABI_SUFFIX "nofreelists"
+#endif
+#if CYTHON_OPAQUE_OBJECTS && CYTHON_COMPILING_IN_LIMITED_API
+    #define __PYX_OPAQUE_OBJECTS_ABI_SUFFIX "opaque"
+#else
+    #define __PYX_OPAQUE_OBJECTS_ABI_SUFFIX
+#endif
+#define CYTHON_ABI  __PYX_ABI_VERSION __PYX_LIMITED_ABI_SUFFIX __PYX_MONITORING_ABI_SUFFIX __PYX_TP_FINALIZE_ABI_SUFFIX __PYX_FREELISTS_ABI_SUFFIX __PYX_AM_SEND_ABI_SUFFIX __PYX_OPAQUE_OBJECTS_ABI_SUFFIX
+#define __PYX_ABI_MODULE_NAME "_cython_" CYTHON_ABI
+#define __PYX_TYPE_MODULE_PREFIX __PYX_ABI_MODULE_NAME "."
+
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE double __pyx_f_7cpython_7complex_7complex_4real___get__(PyComplexObject *__pyx_v_self); /* proto*/
+#endif
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE double __pyx_f_7cpython_7complex_7complex_4imag___get__(PyComplexObject *__pyx_v_self); /* proto*/
+#endif
+
+/* Module declarations from "cpython.version" */
+
+/* Module declarations from "__builtin__" */
+
+/* Module declarations from "cpython.type" */
+
+/* Module declarations from "libc.string" */
+
+/* Module declarations from "libc.stdio" */
+
+/* Module declarations from "cpython.object" */
+
+/* Module declarations from "cpython.ref" */
+
+/* Module declarations from "cpython.exc" */
+
+/* Module declarations from "cpython.module" */
+
+/* Module declarations from "cpython.mem" */
+
+/* Module declarations from "cpython.tuple" */
+
+/* Module declarations from "cpython.list" */
+
+/* Module declarations from "cpython.sequence" */
+
+/* Module declarations from "cpython.mapping" */
+
+/* Module declarations from "cpython.iterator" */
+
+/* Module declarations from "cpython.number" */
+
+/* Module declarations from "__builtin__" */
+
+/* Module declarations from "cpython.bool" */
+
+/* Module declarations from "libc.stdint" */
+
+/* Module declarations from "cpython.long" */
+
+/* Module declarations from "cpython.float" */
+
+/* Module declarations from "cython" */
+
+/* Module declarations from "__builtin__" */
+
+/* Module declarations from "cpython.complex" */
+
+/* Module declarations from "libc.stddef" */
+
+/* Module declarations from "cpython.unicode" */
+
+/* Module declarations from "cpython.pyport" */
+
+/* Module declarations from "cpython.dict" */
+
+/* Module declarations from "cpython.instance" */
+
+/* Module declarations from "cpython.function" */
+
+/* Module declarations from "cpython.method" */
 
-/* InitStrings.proto */
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t);
+/* Module declarations from "cpython.weakref" */
 
+/* Module declarations from "cpython.getargs" */
 
-/* Module declarations from 'overload.bind' */
-static PyTypeObject *__pyx_ptype_8overload_4bind___pyx_scope_struct__matchesannotation = 0;
-static PyTypeObject *__pyx_ptype_8overload_4bind___pyx_scope_struct_1_genexpr = 0;
+/* Module declarations from "cpython.pythread" */
+
+/* Module declarations from "cpython.pystate" */
+
+/* Module declarations from "cpython.set" */
+
+/* Module declarations from "cpython.buffer" */
+
+/* Module declarations from "cpython.bytes" */
+
+/* Module declarations from "cpython.pycapsule" */
+
+/* Module declarations from "cpython.contextvars" */
+
+/* Module declarations from "cpython" */
+
+/* Module declarations from "libcpp.vector" */
+
+/* Module declarations from "overload.bind" */
+static int __pyx_f_8overload_4bind_runProgram(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static void __pyx_f_8overload_4bind_compileAnnotation(PyObject *, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, PyObject *, struct __pyx_t_8overload_4bind_ContainerCheck); /*proto*/
+static void __pyx_f_8overload_4bind_compileNode(int, PyObject *, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, PyObject *, struct __pyx_t_8overload_4bind_ContainerCheck); /*proto*/
+static void __pyx_f_8overload_4bind_compileContainer(int, PyObject *, PyObject *, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, PyObject *, struct __pyx_t_8overload_4bind_ContainerCheck); /*proto*/
+static void __pyx_f_8overload_4bind_compileClass(PyObject *, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, PyObject *); /*proto*/
+static void __pyx_f_8overload_4bind_compileSubclass(PyObject *, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, PyObject *); /*proto*/
+static void __pyx_f_8overload_4bind_simplifyUnion(std::vector<struct __pyx_t_8overload_4bind_Instruction>  &, Py_ssize_t); /*proto*/
+static int __pyx_f_8overload_4bind_isTypeBased(std::vector<struct __pyx_t_8overload_4bind_Instruction>  const &); /*proto*/
+static CYTHON_INLINE int __pyx_f_8overload_4bind_isInstance(PyObject *, PyObject *); /*proto*/
+static CYTHON_INLINE Py_ssize_t __pyx_f_8overload_4bind_checkedCount(struct __pyx_t_8overload_4bind_ContainerCheck const *, Py_ssize_t); /*proto*/
+static CYTHON_INLINE Py_ssize_t __pyx_f_8overload_4bind_checkedIndex(struct __pyx_t_8overload_4bind_ContainerCheck const *, Py_ssize_t, Py_ssize_t); /*proto*/
+static int __pyx_f_8overload_4bind_runCollection(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static int __pyx_f_8overload_4bind_runMapping(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static Py_ssize_t __pyx_f_8overload_4bind_programDistance(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static int __pyx_f_8overload_4bind_runTypeProgram(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static Py_ssize_t __pyx_f_8overload_4bind_typeProgramDistance(struct __pyx_t_8overload_4bind_Instruction const *, PyObject *); /*proto*/
+static Py_ssize_t __pyx_f_8overload_4bind_mroDistance(PyTypeObject *, PyObject *); /*proto*/
+static PyObject *__pyx_f_8overload_4bind_matcherCover(struct __pyx_t_8overload_4bind_Matcher const *); /*proto*/
+static PyObject *__pyx_f_8overload_4bind_programCover(struct __pyx_t_8overload_4bind_Instruction const *); /*proto*/
+static int __pyx_f_8overload_4bind_typesDisjoint(PyTypeObject *, PyTypeObject *); /*proto*/
+static PyTypeObject *__pyx_f_8overload_4bind_layoutBase(PyTypeObject *); /*proto*/
+/* #### Code section: typeinfo ### */
+/* #### Code section: before_global_var ### */
 #define __Pyx_MODULE_NAME "overload.bind"
 extern int __pyx_module_is_main_overload__bind;
 int __pyx_module_is_main_overload__bind = 0;
 
-/* Implementation of 'overload.bind' */
-static PyObject *__pyx_builtin_print;
-static const char __pyx_k_Any[] = "Any";
-static const char __pyx_k_ann[] = "ann";
-static const char __pyx_k_obj[] = "obj";
-static const char __pyx_k_args[] = "__args__";
-static const char __pyx_k_main[] = "__main__";
-static const char __pyx_k_name[] = "__name__";
-static const char __pyx_k_send[] = "send";
-static const char __pyx_k_test[] = "__test__";
-static const char __pyx_k_Union[] = "Union";
-static const char __pyx_k_close[] = "close";
-static const char __pyx_k_print[] = "print";
-static const char __pyx_k_throw[] = "throw";
-static const char __pyx_k_args_2[] = "args";
-static const char __pyx_k_import[] = "__import__";
-static const char __pyx_k_origin[] = "__origin__";
-static const char __pyx_k_typing[] = "typing";
-static const char __pyx_k_genexpr[] = "genexpr";
-static const char __pyx_k_GenericAlias[] = "_GenericAlias";
-static const char __pyx_k_overload_bind[] = "overload.bind";
-static const char __pyx_k_matchesannotation[] = "matchesannotation";
-static const char __pyx_k_overload_bind_pyx[] = "overload\\bind.pyx";
-static const char __pyx_k_cline_in_traceback[] = "cline_in_traceback";
-static const char __pyx_k_unknown_typing_annotation[] = "unknown typing annotation";
-static const char __pyx_k_matchesannotation_locals_genexpr[] = "matchesannotation.<locals>.genexpr";
-static PyObject *__pyx_n_s_Any;
-static PyObject *__pyx_n_s_GenericAlias;
-static PyObject *__pyx_n_s_Union;
-static PyObject *__pyx_n_s_ann;
-static PyObject *__pyx_n_s_args;
-static PyObject *__pyx_n_s_args_2;
-static PyObject *__pyx_n_s_cline_in_traceback;
-static PyObject *__pyx_n_s_close;
-static PyObject *__pyx_n_s_genexpr;
-static PyObject *__pyx_n_s_import;
-static PyObject *__pyx_n_s_main;
-static PyObject *__pyx_n_s_matchesannotation;
-static PyObject *__pyx_n_s_matchesannotation_locals_genexpr;
-static PyObject *__pyx_n_s_name;
-static PyObject *__pyx_n_s_obj;
-static PyObject *__pyx_n_s_origin;
-static PyObject *__pyx_n_s_overload_bind;
-static PyObject *__pyx_kp_s_overload_bind_pyx;
-static PyObject *__pyx_n_s_print;
-static PyObject *__pyx_n_s_send;
-static PyObject *__pyx_n_s_test;
-static PyObject *__pyx_n_s_throw;
-static PyObject *__pyx_n_s_typing;
-static PyObject *__pyx_kp_u_unknown_typing_annotation;
-static PyObject *__pyx_pf_8overload_4bind_17matchesannotation_genexpr(PyObject *__pyx_self); /* proto */
-static PyObject *__pyx_pf_8overload_4bind_matchesannotation(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_v_obj, PyObject *__pyx_v_ann); /* proto */
-static PyObject *__pyx_tp_new_8overload_4bind___pyx_scope_struct__matchesannotation(PyTypeObject *t, PyObject *a, PyObject *k); /*proto*/
-static PyObject *__pyx_tp_new_8overload_4bind___pyx_scope_struct_1_genexpr(PyTypeObject *t, PyObject *a, PyObject *k); /*proto*/
-static PyObject *__pyx_codeobj_;
-static PyObject *__pyx_tuple__2;
-static PyObject *__pyx_tuple__3;
-/* Late includes */
-
-/* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
- * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
+/* Implementation of "overload.bind" */
+/* #### Code section: global_var ### */
+static PyObject *__pyx_builtin_object;
+static PyObject *__pyx_builtin_Ellipsis;
+/* #### Code section: string_decls ### */
+/* #### Code section: decls ### */
+/* #### Code section: late_includes ### */
+/* #### Code section: module_state ### */
+/* SmallCodeConfig */
+#ifndef CYTHON_SMALL_CODE
+#if defined(__clang__)
+    #define CYTHON_SMALL_CODE
+#elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+    #define CYTHON_SMALL_CODE __attribute__((cold))
+#else
+    #define CYTHON_SMALL_CODE
+#endif
+#endif
 
-/* Python wrapper */
-static PyObject *__pyx_pw_8overload_4bind_1matchesannotation(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_8overload_4bind_matchesannotation[] = "Return True if the object matches the annotation, including annotations from typing module.";
-static PyMethodDef __pyx_mdef_8overload_4bind_1matchesannotation = {"matchesannotation", (PyCFunction)(void*)(PyCFunctionWithKeywords)__pyx_pw_8overload_4bind_1matchesannotation, METH_VARARGS|METH_KEYWORDS, __pyx_doc_8overload_4bind_matchesannotation};
-static PyObject *__pyx_pw_8overload_4bind_1matchesannotation(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_obj = 0;
-  PyObject *__pyx_v_ann = 0;
-  int __pyx_lineno = 0;
-  const char *__pyx_filename = NULL;
-  int __pyx_clineno = 0;
-  PyObject *__pyx_r = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("matchesannotation (wrapper)", 0);
+#ifdef __cplusplus
+namespace {
+  #endif
+  typedef struct {
+    PyObject *__pyx_d;
+    PyObject *__pyx_b;
+    PyObject *__pyx_cython_runtime;
+    PyObject *__pyx_empty_tuple;
+    PyObject *__pyx_empty_bytes;
+    PyObject *__pyx_empty_unicode;
+    PyTypeObject *__pyx_ptype_7cpython_4type_type;
+    PyTypeObject *__pyx_ptype_7cpython_4bool_bool;
+    PyTypeObject *__pyx_ptype_7cpython_7complex_complex;
+    PyObject *__pyx_slice[1];
+    PyObject *__pyx_tuple[1];
+    PyObject *__pyx_codeobj_tab[29];
+    PyObject *__pyx_string_tab[125];
+    PyObject *__pyx_number_tab[1];
+/* #### Code section: module_state_contents ### */
+/* PyFrozenDict.module_state_decls */
+#if CYTHON_COMPILING_IN_LIMITED_API
+PyObject *__Pyx_PyFrozenDictType;
+#endif
+
+/* CodeObjectCache.module_state_decls */
+struct __Pyx_CodeObjectCache __pyx_code_cache;
+
+/* #### Code section: module_state_end ### */
+} __pyx_mstatetype;
+#ifdef __cplusplus
+} /* anonymous namespace */
+#endif
+
+#if CYTHON_USE_MODULE_STATE
+#ifdef __cplusplus
+namespace {
+extern struct PyModuleDef __pyx_moduledef;
+} /* anonymous namespace */
+#else
+static struct PyModuleDef __pyx_moduledef;
+#endif
+
+#define __pyx_mstate_global (__Pyx_PyModule_GetState(__Pyx_State_FindModule(&__pyx_moduledef)))
+
+#define __pyx_m (__Pyx_State_FindModule(&__pyx_moduledef))
+#else
+static __pyx_mstatetype __pyx_mstate_global_static =
+#ifdef __cplusplus
+    {};
+#else
+    {0};
+#endif
+static __pyx_mstatetype * const __pyx_mstate_global = &__pyx_mstate_global_static;
+#endif
+/* #### Code section: constant_name_defines ### */
+#define __pyx_kp_u_can_not_be_matched_by_type_for __pyx_string_tab[0]
+#define __pyx_kp_u_use_resolve_for_with_values_of __pyx_string_tab[1]
+#define __pyx_kp_u__3 __pyx_string_tab[2]
+#define __pyx_kp_u_ __pyx_string_tab[3]
+#define __pyx_kp_u__2 __pyx_string_tab[4]
+#define __pyx_kp_u_annotation __pyx_string_tab[5]
+#define __pyx_kp_u_container_changed_size_during_ov __pyx_string_tab[6]
+#define __pyx_kp_u_overload_bind_pxd __pyx_string_tab[7]
+#define __pyx_kp_u_overload_bind_pyx __pyx_string_tab[8]
+#define __pyx_kp_u_unsupported_annotation __pyx_string_tab[9]
+#define __pyx_kp_u_unsupported_annotation_Type __pyx_string_tab[10]
+#define __pyx_n_u_ABCMeta __pyx_string_tab[11]
+#define __pyx_n_u_Annotated __pyx_string_tab[12]
+#define __pyx_n_u_Any __pyx_string_tab[13]
+#define __pyx_n_u_Ellipsis __pyx_string_tab[14]
+#define __pyx_n_u_Iterable __pyx_string_tab[15]
+#define __pyx_n_u_Literal __pyx_string_tab[16]
+#define __pyx_n_u_Mapping __pyx_string_tab[17]
+#define __pyx_n_u_NoneType __pyx_string_tab[18]
+#define __pyx_n_u_PY_SSIZE_T_MAX __pyx_string_tab[19]
+#define __pyx_n_u_PyTuple_Type __pyx_string_tab[20]
+#define __pyx_n_u_PyType_Type __pyx_string_tab[21]
+#define __pyx_n_u_TypeVar __pyx_string_tab[22]
+#define __pyx_n_u_Union __pyx_string_tab[23]
+#define __pyx_n_u_UnionType __pyx_string_tab[24]
+#define __pyx_n_u_args __pyx_string_tab[25]
+#define __pyx_n_u_bound __pyx_string_tab[26]
+#define __pyx_n_u_constraints __pyx_string_tab[27]
+#define __pyx_n_u_instancecheck __pyx_string_tab[28]
+#define __pyx_n_u_main __pyx_string_tab[29]
+#define __pyx_n_u_module __pyx_string_tab[30]
+#define __pyx_n_u_name __pyx_string_tab[31]
+#define __pyx_n_u_origin __pyx_string_tab[32]
+#define __pyx_n_u_pyx_capi __pyx_string_tab[33]
+#define __pyx_n_u_qualname __pyx_string_tab[34]
+#define __pyx_n_u_supertype __pyx_string_tab[35]
+#define __pyx_n_u_test __pyx_string_tab[36]
+#define __pyx_n_u_empty __pyx_string_tab[37]
+#define __pyx_n_u_abc __pyx_string_tab[38]
+#define __pyx_n_u_annotation_2 __pyx_string_tab[39]
+#define __pyx_n_u_arg __pyx_string_tab[40]
+#define __pyx_n_u_check __pyx_string_tab[41]
+#define __pyx_n_u_checkedCount __pyx_string_tab[42]
+#define __pyx_n_u_checkedIndex __pyx_string_tab[43]
+#define __pyx_n_u_children __pyx_string_tab[44]
+#define __pyx_n_u_cline_in_traceback __pyx_string_tab[45]
+#define __pyx_n_u_cls __pyx_string_tab[46]
+#define __pyx_n_u_collections_abc __pyx_string_tab[47]
+#define __pyx_n_u_compileAnnotation __pyx_string_tab[48]
+#define __pyx_n_u_compileClass __pyx_string_tab[49]
+#define __pyx_n_u_compileContainer __pyx_string_tab[50]
+#define __pyx_n_u_compileNode __pyx_string_tab[51]
+#define __pyx_n_u_compileSubclass __pyx_string_tab[52]
+#define __pyx_n_u_createMatcher __pyx_string_tab[53]
+#define __pyx_n_u_destroyMatcher __pyx_string_tab[54]
+#define __pyx_n_u_get_args __pyx_string_tab[55]
+#define __pyx_n_u_get_origin __pyx_string_tab[56]
+#define __pyx_n_u_guards __pyx_string_tab[57]
+#define __pyx_n_u_hasTypeBasedInstanceCheck __pyx_string_tab[58]
+#define __pyx_n_u_i __pyx_string_tab[59]
+#define __pyx_n_u_inspect __pyx_string_tab[60]
+#define __pyx_n_u_instruction __pyx_string_tab[61]
+#define __pyx_n_u_isInstance __pyx_string_tab[62]
+#define __pyx_n_u_isTypeBased __pyx_string_tab[63]
+#define __pyx_n_u_items __pyx_string_tab[64]
+#define __pyx_n_u_layoutBase __pyx_string_tab[65]
+#define __pyx_n_u_lhs __pyx_string_tab[66]
+#define __pyx_n_u_matchDistance __pyx_string_tab[67]
+#define __pyx_n_u_matchType __pyx_string_tab[68]
+#define __pyx_n_u_matcher __pyx_string_tab[69]
+#define __pyx_n_u_matcherCover __pyx_string_tab[70]
+#define __pyx_n_u_matchersDisjoint __pyx_string_tab[71]
+#define __pyx_n_u_metaclass __pyx_string_tab[72]
+#define __pyx_n_u_mroDistance __pyx_string_tab[73]
+#define __pyx_n_u_object __pyx_string_tab[74]
+#define __pyx_n_u_op __pyx_string_tab[75]
+#define __pyx_n_u_program __pyx_string_tab[76]
+#define __pyx_n_u_programCover __pyx_string_tab[77]
+#define __pyx_n_u_programDistance __pyx_string_tab[78]
+#define __pyx_n_u_rhs __pyx_string_tab[79]
+#define __pyx_n_u_runCollection __pyx_string_tab[80]
+#define __pyx_n_u_runMapping __pyx_string_tab[81]
+#define __pyx_n_u_runMatcher __pyx_string_tab[82]
+#define __pyx_n_u_runProgram __pyx_string_tab[83]
+#define __pyx_n_u_runTypeProgram __pyx_string_tab[84]
+#define __pyx_n_u_setdefault __pyx_string_tab[85]
+#define __pyx_n_u_simplifyUnion __pyx_string_tab[86]
+#define __pyx_n_u_size __pyx_string_tab[87]
+#define __pyx_n_u_start __pyx_string_tab[88]
+#define __pyx_n_u_type __pyx_string_tab[89]
+#define __pyx_n_u_typeDistance __pyx_string_tab[90]
+#define __pyx_n_u_typeProgramDistance __pyx_string_tab[91]
+#define __pyx_n_u_types __pyx_string_tab[92]
+#define __pyx_n_u_typesDisjoint __pyx_string_tab[93]
+#define __pyx_n_u_typing __pyx_string_tab[94]
+#define __pyx_kp_b_Py_ssize_t_struct___pyx_t_8overl __pyx_string_tab[95]
+#define __pyx_kp_b_iso88591_awa_awa __pyx_string_tab[96]
+#define __pyx_kp_b_iso88591_vQ_xq_y_y_A_Zq_T_Ks_AV9A_6_G3a __pyx_string_tab[97]
+#define __pyx_kp_b_iso88591_xq_y_y_A_t3a_6_Qe3a_6_6_4q_WA_a __pyx_string_tab[98]
+#define __pyx_kp_b_iso88591_Q_s_Q_A_s_Q_AYk_s_Q_s_Q_s_3c_A __pyx_string_tab[99]
+#define __pyx_kp_b_iso88591_wavT_A_F_A_U_7_6_7_6_S_7_6_1_1F __pyx_string_tab[100]
+#define __pyx_kp_b_iso88591_wfCq_wfCq_1G85_1 __pyx_string_tab[101]
+#define __pyx_kp_b_iso88591_G5_vQ_xq_y_1A_y_Qa_1F_c_1 __pyx_string_tab[102]
+#define __pyx_kp_b_iso88591_G5_uF_4uF_E_PSST_AU_1_q_Jixq_av __pyx_string_tab[103]
+#define __pyx_kp_b_iso88591_q_Q_81_q_gZxq_7_2T_A_81_HARt3a __pyx_string_tab[104]
+#define __pyx_kp_b_iso88591_G5_vQ_xq_y_y_Zq_81A_WC_T_Ks_z_C __pyx_string_tab[105]
+#define __pyx_kp_b_iso88591_Q_U_uA_WARq_3c_Cs_Cs_3c_NZ_ccd __pyx_string_tab[106]
+#define __pyx_kp_b_iso88591_q_1E_c_Qe1_q_uCz_0_5_Rq_q_AQ_AQ __pyx_string_tab[107]
+#define __pyx_kp_b_iso88591_1_X_U_1A_q_S_1_2Rq_1E_1 __pyx_string_tab[108]
+#define __pyx_kp_b_iso88591_Q_j_d_is_t1_is_t4_S_HNRS_M_D_t1 __pyx_string_tab[109]
+#define __pyx_kp_b_iso88591_1_uF_5_5_q_5 __pyx_string_tab[110]
+#define __pyx_kp_b_iso88591_1_uF_e2U_r_5_Q_1 __pyx_string_tab[111]
+#define __pyx_kp_b_iso88591_a_IQ_D_33nCwa __pyx_string_tab[112]
+#define __pyx_kp_b_iso88591_B_5_1A_5_34s_Na_Z_aaqqr_5 __pyx_string_tab[113]
+#define __pyx_kp_b_iso88591_DA_wfCq_q_wfCq_1_4F_wfCq_avWA_N __pyx_string_tab[114]
+#define __pyx_kp_b_iso88591_K1_G6_A_G6_A_WF_9_G1_G6_A_gQ_7 __pyx_string_tab[115]
+#define __pyx_kp_b_iso88591_K1_AQ_AQ_z_E_Jc_q_A_L_t_1_K1_q __pyx_string_tab[116]
+#define __pyx_kp_b_iso88591_LA_b_L_Q_1_t_q_q_L_XS_Yawd_6_A __pyx_string_tab[117]
+#define __pyx_kp_b_iso88591_LA_Q_s_Q_q_s_Q_aq_y_gS_TTU_k_s __pyx_string_tab[118]
+#define __pyx_kp_b_iso88591_MQ_wfCq_q_wfC_WF_Q_6_awhe4q __pyx_string_tab[119]
+#define __pyx_kp_b_iso88591_MQ_wfCq_q_wfC_WF_Q_avWA_7_t1 __pyx_string_tab[120]
+#define __pyx_kp_b_iso88591_Oq_L_q_1_1_1_1E_M_s_1_AWA_5_Cq __pyx_string_tab[121]
+#define __pyx_kp_b_iso88591_PPQ_Q_s_Q_q_s_Q_q_0_6FkQR_1_q_s __pyx_string_tab[122]
+#define __pyx_kp_b_iso88591_WWX_Q_s_Q_q_s_Q_q_s_Q_5_1_s_Q_a __pyx_string_tab[123]
+#define __pyx_kp_b_iso88591_q_c_q_c_6_A_L_U_a_s_8_a_1 __pyx_string_tab[124]
+#define __pyx_int_1 __pyx_number_tab[0]
+/* #### Code section: module_state_clear ### */
+#if CYTHON_USE_MODULE_STATE
+static CYTHON_SMALL_CODE int __pyx_m_clear(PyObject *m) {
+  __pyx_mstatetype *clear_module_state = __Pyx_PyModule_GetState(m);
+  if (!clear_module_state) return 0;
+  Py_CLEAR(clear_module_state->__pyx_d);
+  Py_CLEAR(clear_module_state->__pyx_b);
+  Py_CLEAR(clear_module_state->__pyx_cython_runtime);
+  Py_CLEAR(clear_module_state->__pyx_empty_tuple);
+  Py_CLEAR(clear_module_state->__pyx_empty_bytes);
+  Py_CLEAR(clear_module_state->__pyx_empty_unicode);
+  #if CYTHON_PEP489_MULTI_PHASE_INIT
+  __Pyx_State_RemoveModule(NULL);
+  #endif
+  Py_CLEAR(clear_module_state->__pyx_ptype_7cpython_4type_type);
+  Py_CLEAR(clear_module_state->__pyx_ptype_7cpython_4bool_bool);
+  Py_CLEAR(clear_module_state->__pyx_ptype_7cpython_7complex_complex);
+  for (int i=0; i<1; ++i) { Py_CLEAR(clear_module_state->__pyx_slice[i]); }
+  for (int i=0; i<1; ++i) { Py_CLEAR(clear_module_state->__pyx_tuple[i]); }
+  for (int i=0; i<29; ++i) { Py_CLEAR(clear_module_state->__pyx_codeobj_tab[i]); }
+  for (int i=0; i<125; ++i) { Py_CLEAR(clear_module_state->__pyx_string_tab[i]); }
+  for (int i=0; i<1; ++i) { Py_CLEAR(clear_module_state->__pyx_number_tab[i]); }
+/* #### Code section: module_state_clear_contents ### */
+/* #### Code section: module_state_clear_end ### */
+return 0;
+}
+#endif
+/* #### Code section: module_state_traverse ### */
+#if CYTHON_USE_MODULE_STATE
+static CYTHON_SMALL_CODE int __pyx_m_traverse(PyObject *m, visitproc visit, void *arg) {
+  __pyx_mstatetype *traverse_module_state = __Pyx_PyModule_GetState(m);
+  if (!traverse_module_state) return 0;
+  Py_VISIT(traverse_module_state->__pyx_d);
+  Py_VISIT(traverse_module_state->__pyx_b);
+  Py_VISIT(traverse_module_state->__pyx_cython_runtime);
+  __Pyx_VISIT_CONST(traverse_module_state->__pyx_empty_tuple);
+  __Pyx_VISIT_CONST(traverse_module_state->__pyx_empty_bytes);
+  __Pyx_VISIT_CONST(traverse_module_state->__pyx_empty_unicode);
+  Py_VISIT(traverse_module_state->__pyx_ptype_7cpython_4type_type);
+  Py_VISIT(traverse_module_state->__pyx_ptype_7cpython_4bool_bool);
+  Py_VISIT(traverse_module_state->__pyx_ptype_7cpython_7complex_complex);
+  for (int i=0; i<1; ++i) { __Pyx_VISIT_CONST(traverse_module_state->__pyx_slice[i]); }
+  for (int i=0; i<1; ++i) { __Pyx_VISIT_CONST(traverse_module_state->__pyx_tuple[i]); }
+  for (int i=0; i<29; ++i) { __Pyx_VISIT_CONST(traverse_module_state->__pyx_codeobj_tab[i]); }
+  for (int i=0; i<125; ++i) { __Pyx_VISIT_CONST(traverse_module_state->__pyx_string_tab[i]); }
+  for (int i=0; i<1; ++i) { __Pyx_VISIT_CONST(traverse_module_state->__pyx_number_tab[i]); }
+/* #### Code section: module_state_traverse_contents ### */
+/* #### Code section: module_state_traverse_end ### */
+return 0;
+}
+#endif
+/* #### Code section: module_code ### */
+
+/* "cpython/complex.pxd":20
+ * 
+ *         # unavailable in limited API
+ *         @property             # <<<<<<<<<<<<<<
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double real(self) noexcept:
+*/
+
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE double __pyx_f_7cpython_7complex_7complex_4real___get__(PyComplexObject *__pyx_v_self) {
+  double __pyx_r;
+
+  /* "cpython/complex.pxd":23
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double real(self) noexcept:
+ *             return self.cval.real             # <<<<<<<<<<<<<<
+ * 
+ *         # unavailable in limited API
+*/
   {
-    static PyObject **__pyx_pyargnames[] = {&__pyx_n_s_obj,&__pyx_n_s_ann,0};
-    PyObject* values[2] = {0,0};
-    if (unlikely(__pyx_kwds)) {
-      Py_ssize_t kw_args;
-      const Py_ssize_t pos_args = PyTuple_GET_SIZE(__pyx_args);
-      switch (pos_args) {
-        case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-        CYTHON_FALLTHROUGH;
-        case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-        CYTHON_FALLTHROUGH;
-        case  0: break;
-        default: goto __pyx_L5_argtuple_error;
-      }
-      kw_args = PyDict_Size(__pyx_kwds);
-      switch (pos_args) {
-        case  0:
-        if (likely((values[0] = __Pyx_PyDict_GetItemStr(__pyx_kwds, __pyx_n_s_obj)) != 0)) kw_args--;
-        else goto __pyx_L5_argtuple_error;
-        CYTHON_FALLTHROUGH;
-        case  1:
-        if (likely((values[1] = __Pyx_PyDict_GetItemStr(__pyx_kwds, __pyx_n_s_ann)) != 0)) kw_args--;
-        else {
-          __Pyx_RaiseArgtupleInvalid("matchesannotation", 1, 2, 2, 1); __PYX_ERR(0, 9, __pyx_L3_error)
-        }
-      }
-      if (unlikely(kw_args > 0)) {
-        if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, pos_args, "matchesannotation") < 0)) __PYX_ERR(0, 9, __pyx_L3_error)
-      }
-    } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-      goto __pyx_L5_argtuple_error;
-    } else {
-      values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-    }
-    __pyx_v_obj = values[0];
-    __pyx_v_ann = values[1];
+
+    __pyx_r = __pyx_v_self->cval.real;
   }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("matchesannotation", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); __PYX_ERR(0, 9, __pyx_L3_error)
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("overload.bind.matchesannotation", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_r = __pyx_pf_8overload_4bind_matchesannotation(__pyx_self, __pyx_v_obj, __pyx_v_ann);
+  goto __pyx_L0;
+
+  /* "cpython/complex.pxd":20
+ * 
+ *         # unavailable in limited API
+ *         @property             # <<<<<<<<<<<<<<
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double real(self) noexcept:
+*/
 
   /* function exit code */
-  __Pyx_RefNannyFinishContext();
+  __pyx_L0:;
+
   return __pyx_r;
 }
-static PyObject *__pyx_gb_8overload_4bind_17matchesannotation_2generator(__pyx_CoroutineObject *__pyx_generator, CYTHON_UNUSED PyThreadState *__pyx_tstate, PyObject *__pyx_sent_value); /* proto */
+#endif /*!(#if !CYTHON_COMPILING_IN_LIMITED_API)*/
 
-/* "overload/bind.pyx":14
- *         # typing annotations
- *         if ann.__origin__ is Union:
- *             return any(matchesannotation(obj, x) for x in ann.__args__)             # <<<<<<<<<<<<<<
- *         print("unknown typing annotation")
- *         return False
- */
+/* "cpython/complex.pxd":26
+ * 
+ *         # unavailable in limited API
+ *         @property             # <<<<<<<<<<<<<<
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double imag(self) noexcept:
+*/
+
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE double __pyx_f_7cpython_7complex_7complex_4imag___get__(PyComplexObject *__pyx_v_self) {
+  double __pyx_r;
+
+  /* "cpython/complex.pxd":29
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double imag(self) noexcept:
+ *             return self.cval.imag             # <<<<<<<<<<<<<<
+ * 
+ *     # PyTypeObject PyComplex_Type
+*/
+  {
+
+    __pyx_r = __pyx_v_self->cval.imag;
+  }
+  goto __pyx_L0;
+
+  /* "cpython/complex.pxd":26
+ * 
+ *         # unavailable in limited API
+ *         @property             # <<<<<<<<<<<<<<
+ *         @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ *         cdef inline double imag(self) noexcept:
+*/
+
+  /* function exit code */
+  __pyx_L0:;
+
+  return __pyx_r;
+}
+#endif /*!(#if !CYTHON_COMPILING_IN_LIMITED_API)*/
+
+/* "cpython/contextvars.pxd":115
+ * 
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")             # <<<<<<<<<<<<<<
+ * cdef inline object get_value(var, default_value=None):
+ *     """Return a new reference to the value of the context variable,
+*/
 
-static PyObject *__pyx_pf_8overload_4bind_17matchesannotation_genexpr(PyObject *__pyx_self) {
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *__pyx_cur_scope;
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE PyObject *__pyx_f_7cpython_11contextvars_get_value(PyObject *__pyx_v_var, struct __pyx_opt_args_7cpython_11contextvars_get_value *__pyx_optional_args) {
+
+  /* "cpython/contextvars.pxd":116
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ * cdef inline object get_value(var, default_value=None):             # <<<<<<<<<<<<<<
+ *     """Return a new reference to the value of the context variable,
+ *     or the default value of the context variable,
+*/
+  PyObject *__pyx_v_default_value = ((PyObject *)Py_None);
+  PyObject *__pyx_v_value;
+  PyObject *__pyx_v_pyvalue = NULL;
   PyObject *__pyx_r = NULL;
   __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
+  int __pyx_t_2;
+  PyObject *__pyx_t_3 = NULL;
   int __pyx_lineno = 0;
   const char *__pyx_filename = NULL;
   int __pyx_clineno = 0;
-  __Pyx_RefNannySetupContext("genexpr", 0);
-  __pyx_cur_scope = (struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)__pyx_tp_new_8overload_4bind___pyx_scope_struct_1_genexpr(__pyx_ptype_8overload_4bind___pyx_scope_struct_1_genexpr, __pyx_empty_tuple, NULL);
-  if (unlikely(!__pyx_cur_scope)) {
-    __pyx_cur_scope = ((struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)Py_None);
-    __Pyx_INCREF(Py_None);
-    __PYX_ERR(0, 14, __pyx_L1_error)
-  } else {
-    __Pyx_GOTREF(__pyx_cur_scope);
+  __Pyx_RefNannySetupContext("get_value", 0);
+  if (__pyx_optional_args) {
+    if (__pyx_optional_args->__pyx_n > 0) {
+      __pyx_v_default_value = __pyx_optional_args->default_value;
+    }
+  }
+
+  /* "cpython/contextvars.pxd":121
+ *     or None if no such value or default was found.
+ *     """
+ *     cdef PyObject *value = NULL             # <<<<<<<<<<<<<<
+ *     PyContextVar_Get(var, NULL, &value)
+ *     if value is NULL:
+*/
+  __pyx_v_value = NULL;
+
+  /* "cpython/contextvars.pxd":122
+ *     """
+ *     cdef PyObject *value = NULL
+ *     PyContextVar_Get(var, NULL, &value)             # <<<<<<<<<<<<<<
+ *     if value is NULL:
+ *         # context variable does not have a default
+*/
+  __pyx_t_1 = PyContextVar_Get(__pyx_v_var, NULL, (&__pyx_v_value)); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(1, 122, __pyx_L1_error)
+
+
+  /* "cpython/contextvars.pxd":123
+ *     cdef PyObject *value = NULL
+ *     PyContextVar_Get(var, NULL, &value)
+ *     if value is NULL:             # <<<<<<<<<<<<<<
+ *         # context variable does not have a default
+ *         pyvalue = default_value
+*/
+  __pyx_t_2 = (__pyx_v_value == NULL);
+
+  if (__pyx_t_2) {
+
+
+    /* "cpython/contextvars.pxd":125
+ *     if value is NULL:
+ *         # context variable does not have a default
+ *         pyvalue = default_value             # <<<<<<<<<<<<<<
+ *     else:
+ *         # value or default value of context variable
+*/
+    __Pyx_INCREF(__pyx_v_default_value);
+    __pyx_v_pyvalue = __pyx_v_default_value;
+
+    /* "cpython/contextvars.pxd":123
+ *     cdef PyObject *value = NULL
+ *     PyContextVar_Get(var, NULL, &value)
+ *     if value is NULL:             # <<<<<<<<<<<<<<
+ *         # context variable does not have a default
+ *         pyvalue = default_value
+*/
+    goto __pyx_L3;
+  }
+
+  /* "cpython/contextvars.pxd":128
+ *     else:
+ *         # value or default value of context variable
+ *         pyvalue = <object>value             # <<<<<<<<<<<<<<
+ *         Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'
+ *     return pyvalue
+*/
+  /*else*/ {
+    __pyx_t_3 = ((PyObject *)__pyx_v_value);
+    __Pyx_INCREF(__pyx_t_3);
+    __pyx_v_pyvalue = __pyx_t_3;
+    __pyx_t_3 = 0;
+
+    /* "cpython/contextvars.pxd":129
+ *         # value or default value of context variable
+ *         pyvalue = <object>value
+ *         Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'             # <<<<<<<<<<<<<<
+ *     return pyvalue
+ * 
+*/
+    Py_XDECREF(__pyx_v_value);
   }
-  __pyx_cur_scope->__pyx_outer_scope = (struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *) __pyx_self;
-  __Pyx_INCREF(((PyObject *)__pyx_cur_scope->__pyx_outer_scope));
-  __Pyx_GIVEREF(__pyx_cur_scope->__pyx_outer_scope);
+  __pyx_L3:;
+
+  /* "cpython/contextvars.pxd":130
+ *         pyvalue = <object>value
+ *         Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'
+ *     return pyvalue             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
   {
-    __pyx_CoroutineObject *gen = __Pyx_Generator_New((__pyx_coroutine_body_t) __pyx_gb_8overload_4bind_17matchesannotation_2generator, NULL, (PyObject *) __pyx_cur_scope, __pyx_n_s_genexpr, __pyx_n_s_matchesannotation_locals_genexpr, __pyx_n_s_overload_bind); if (unlikely(!gen)) __PYX_ERR(0, 14, __pyx_L1_error)
-    __Pyx_DECREF(__pyx_cur_scope);
-    __Pyx_RefNannyFinishContext();
-    return (PyObject *) gen;
+    PyObject *__pyx_temp;
+    {
+      __pyx_temp = __pyx_r;
+      __Pyx_INCREF(__pyx_v_pyvalue);
+      __pyx_r = __pyx_v_pyvalue;
+    }
+    __Pyx_XDECREF(__pyx_temp);
   }
+  goto __pyx_L0;
+
+  /* "cpython/contextvars.pxd":115
+ * 
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")             # <<<<<<<<<<<<<<
+ * cdef inline object get_value(var, default_value=None):
+ *     """Return a new reference to the value of the context variable,
+*/
 
   /* function exit code */
   __pyx_L1_error:;
-  __Pyx_AddTraceback("overload.bind.matchesannotation.genexpr", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
-  __Pyx_DECREF(((PyObject *)__pyx_cur_scope));
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_AddTraceback("cpython.contextvars.get_value", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = 0;
+  __pyx_L0:;
+
+  __Pyx_XDECREF(__pyx_v_pyvalue);
   __Pyx_XGIVEREF(__pyx_r);
   __Pyx_RefNannyFinishContext();
   return __pyx_r;
 }
+#endif /*!(#if !CYTHON_COMPILING_IN_LIMITED_API)*/
 
-static PyObject *__pyx_gb_8overload_4bind_17matchesannotation_2generator(__pyx_CoroutineObject *__pyx_generator, CYTHON_UNUSED PyThreadState *__pyx_tstate, PyObject *__pyx_sent_value) /* generator body */
-{
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *__pyx_cur_scope = ((struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)__pyx_generator->closure);
+/* "cpython/contextvars.pxd":133
+ * 
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")             # <<<<<<<<<<<<<<
+ * cdef inline object get_value_no_default(var, default_value=None):
+ *     """Return a new reference to the value of the context variable,
+*/
+
+#if !CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE PyObject *__pyx_f_7cpython_11contextvars_get_value_no_default(PyObject *__pyx_v_var, struct __pyx_opt_args_7cpython_11contextvars_get_value_no_default *__pyx_optional_args) {
+
+  /* "cpython/contextvars.pxd":134
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")
+ * cdef inline object get_value_no_default(var, default_value=None):             # <<<<<<<<<<<<<<
+ *     """Return a new reference to the value of the context variable,
+ *     or the provided default value if no such value was found.
+*/
+  PyObject *__pyx_v_default_value = ((PyObject *)Py_None);
+  PyObject *__pyx_v_value;
+  PyObject *__pyx_v_pyvalue = NULL;
   PyObject *__pyx_r = NULL;
-  __Pyx_TraceDeclarations
-  PyObject *__pyx_t_1 = NULL;
+  __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
   PyObject *__pyx_t_2 = NULL;
-  Py_ssize_t __pyx_t_3;
-  PyObject *(*__pyx_t_4)(PyObject *);
-  PyObject *__pyx_t_5 = NULL;
-  PyObject *__pyx_t_6 = NULL;
-  int __pyx_t_7;
-  PyObject *__pyx_t_8 = NULL;
-  int __pyx_t_9;
   int __pyx_lineno = 0;
   const char *__pyx_filename = NULL;
   int __pyx_clineno = 0;
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("genexpr", 0);
-  __Pyx_TraceCall("genexpr", __pyx_f[0], 14, 0, __PYX_ERR(0, 14, __pyx_L1_error));
-  switch (__pyx_generator->resume_label) {
-    case 0: goto __pyx_L3_first_run;
-    default: /* CPython raises the right error here */
-    __Pyx_TraceReturn(Py_None, 0);
-    __Pyx_RefNannyFinishContext();
-    return NULL;
+  __Pyx_RefNannySetupContext("get_value_no_default", 0);
+  if (__pyx_optional_args) {
+    if (__pyx_optional_args->__pyx_n > 0) {
+      __pyx_v_default_value = __pyx_optional_args->default_value;
+    }
   }
-  __pyx_L3_first_run:;
-  if (unlikely(!__pyx_sent_value)) __PYX_ERR(0, 14, __pyx_L1_error)
-  if (unlikely(!__pyx_cur_scope->__pyx_outer_scope->__pyx_v_ann)) { __Pyx_RaiseClosureNameError("ann"); __PYX_ERR(0, 14, __pyx_L1_error) }
-  __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_cur_scope->__pyx_outer_scope->__pyx_v_ann, __pyx_n_s_args); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (likely(PyList_CheckExact(__pyx_t_1)) || PyTuple_CheckExact(__pyx_t_1)) {
-    __pyx_t_2 = __pyx_t_1; __Pyx_INCREF(__pyx_t_2); __pyx_t_3 = 0;
-    __pyx_t_4 = NULL;
-  } else {
-    __pyx_t_3 = -1; __pyx_t_2 = PyObject_GetIter(__pyx_t_1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 14, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_4 = Py_TYPE(__pyx_t_2)->tp_iternext; if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 14, __pyx_L1_error)
+
+  /* "cpython/contextvars.pxd":140
+ *     Ignores the default value of the context variable, if any.
+ *     """
+ *     cdef PyObject *value = NULL             # <<<<<<<<<<<<<<
+ *     PyContextVar_Get(var, <PyObject*>default_value, &value)
+ *     # value of context variable or 'default_value'
+*/
+  __pyx_v_value = NULL;
+
+  /* "cpython/contextvars.pxd":141
+ *     """
+ *     cdef PyObject *value = NULL
+ *     PyContextVar_Get(var, <PyObject*>default_value, &value)             # <<<<<<<<<<<<<<
+ *     # value of context variable or 'default_value'
+ *     pyvalue = <object>value
+*/
+  __pyx_t_1 = PyContextVar_Get(__pyx_v_var, ((PyObject *)__pyx_v_default_value), (&__pyx_v_value)); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(1, 141, __pyx_L1_error)
+
+
+  /* "cpython/contextvars.pxd":143
+ *     PyContextVar_Get(var, <PyObject*>default_value, &value)
+ *     # value of context variable or 'default_value'
+ *     pyvalue = <object>value             # <<<<<<<<<<<<<<
+ *     Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'
+ *     return pyvalue
+*/
+  __pyx_t_2 = ((PyObject *)__pyx_v_value);
+  __Pyx_INCREF(__pyx_t_2);
+  __pyx_v_pyvalue = __pyx_t_2;
+  __pyx_t_2 = 0;
+
+  /* "cpython/contextvars.pxd":144
+ *     # value of context variable or 'default_value'
+ *     pyvalue = <object>value
+ *     Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'             # <<<<<<<<<<<<<<
+ *     return pyvalue
+*/
+  Py_XDECREF(__pyx_v_value);
+
+  /* "cpython/contextvars.pxd":145
+ *     pyvalue = <object>value
+ *     Py_XDECREF(value)  # PyContextVar_Get() returned an owned reference as 'PyObject*'
+ *     return pyvalue             # <<<<<<<<<<<<<<
+*/
+  {
+    PyObject *__pyx_temp;
+    {
+      __pyx_temp = __pyx_r;
+      __Pyx_INCREF(__pyx_v_pyvalue);
+      __pyx_r = __pyx_v_pyvalue;
+    }
+    __Pyx_XDECREF(__pyx_temp);
   }
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  for (;;) {
-    if (likely(!__pyx_t_4)) {
-      if (likely(PyList_CheckExact(__pyx_t_2))) {
-        if (__pyx_t_3 >= PyList_GET_SIZE(__pyx_t_2)) break;
-        #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
-        __pyx_t_1 = PyList_GET_ITEM(__pyx_t_2, __pyx_t_3); __Pyx_INCREF(__pyx_t_1); __pyx_t_3++; if (unlikely(0 < 0)) __PYX_ERR(0, 14, __pyx_L1_error)
-        #else
-        __pyx_t_1 = PySequence_ITEM(__pyx_t_2, __pyx_t_3); __pyx_t_3++; if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-        __Pyx_GOTREF(__pyx_t_1);
-        #endif
-      } else {
-        if (__pyx_t_3 >= PyTuple_GET_SIZE(__pyx_t_2)) break;
-        #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
-        __pyx_t_1 = PyTuple_GET_ITEM(__pyx_t_2, __pyx_t_3); __Pyx_INCREF(__pyx_t_1); __pyx_t_3++; if (unlikely(0 < 0)) __PYX_ERR(0, 14, __pyx_L1_error)
-        #else
-        __pyx_t_1 = PySequence_ITEM(__pyx_t_2, __pyx_t_3); __pyx_t_3++; if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-        __Pyx_GOTREF(__pyx_t_1);
-        #endif
-      }
-    } else {
-      __pyx_t_1 = __pyx_t_4(__pyx_t_2);
-      if (unlikely(!__pyx_t_1)) {
-        PyObject* exc_type = PyErr_Occurred();
-        if (exc_type) {
-          if (likely(__Pyx_PyErr_GivenExceptionMatches(exc_type, PyExc_StopIteration))) PyErr_Clear();
-          else __PYX_ERR(0, 14, __pyx_L1_error)
-        }
-        break;
-      }
-      __Pyx_GOTREF(__pyx_t_1);
-    }
-    __Pyx_XGOTREF(__pyx_cur_scope->__pyx_v_x);
-    __Pyx_XDECREF_SET(__pyx_cur_scope->__pyx_v_x, __pyx_t_1);
-    __Pyx_GIVEREF(__pyx_t_1);
-    __pyx_t_1 = 0;
-    __Pyx_GetModuleGlobalName(__pyx_t_5, __pyx_n_s_matchesannotation); if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 14, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_5);
-    if (unlikely(!__pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj)) { __Pyx_RaiseClosureNameError("obj"); __PYX_ERR(0, 14, __pyx_L1_error) }
-    __pyx_t_6 = NULL;
-    __pyx_t_7 = 0;
-    if (CYTHON_UNPACK_METHODS && unlikely(PyMethod_Check(__pyx_t_5))) {
-      __pyx_t_6 = PyMethod_GET_SELF(__pyx_t_5);
-      if (likely(__pyx_t_6)) {
-        PyObject* function = PyMethod_GET_FUNCTION(__pyx_t_5);
-        __Pyx_INCREF(__pyx_t_6);
-        __Pyx_INCREF(function);
-        __Pyx_DECREF_SET(__pyx_t_5, function);
-        __pyx_t_7 = 1;
-      }
-    }
-    #if CYTHON_FAST_PYCALL
-    if (PyFunction_Check(__pyx_t_5)) {
-      PyObject *__pyx_temp[3] = {__pyx_t_6, __pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj, __pyx_cur_scope->__pyx_v_x};
-      __pyx_t_1 = __Pyx_PyFunction_FastCall(__pyx_t_5, __pyx_temp+1-__pyx_t_7, 2+__pyx_t_7); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_XDECREF(__pyx_t_6); __pyx_t_6 = 0;
-      __Pyx_GOTREF(__pyx_t_1);
-    } else
-    #endif
-    #if CYTHON_FAST_PYCCALL
-    if (__Pyx_PyFastCFunction_Check(__pyx_t_5)) {
-      PyObject *__pyx_temp[3] = {__pyx_t_6, __pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj, __pyx_cur_scope->__pyx_v_x};
-      __pyx_t_1 = __Pyx_PyCFunction_FastCall(__pyx_t_5, __pyx_temp+1-__pyx_t_7, 2+__pyx_t_7); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_XDECREF(__pyx_t_6); __pyx_t_6 = 0;
-      __Pyx_GOTREF(__pyx_t_1);
-    } else
-    #endif
-    {
-      __pyx_t_8 = PyTuple_New(2+__pyx_t_7); if (unlikely(!__pyx_t_8)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_GOTREF(__pyx_t_8);
-      if (__pyx_t_6) {
-        __Pyx_GIVEREF(__pyx_t_6); PyTuple_SET_ITEM(__pyx_t_8, 0, __pyx_t_6); __pyx_t_6 = NULL;
-      }
-      __Pyx_INCREF(__pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj);
-      __Pyx_GIVEREF(__pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj);
-      PyTuple_SET_ITEM(__pyx_t_8, 0+__pyx_t_7, __pyx_cur_scope->__pyx_outer_scope->__pyx_v_obj);
-      __Pyx_INCREF(__pyx_cur_scope->__pyx_v_x);
-      __Pyx_GIVEREF(__pyx_cur_scope->__pyx_v_x);
-      PyTuple_SET_ITEM(__pyx_t_8, 1+__pyx_t_7, __pyx_cur_scope->__pyx_v_x);
-      __pyx_t_1 = __Pyx_PyObject_Call(__pyx_t_5, __pyx_t_8, NULL); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_GOTREF(__pyx_t_1);
-      __Pyx_DECREF(__pyx_t_8); __pyx_t_8 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-    __pyx_t_9 = __Pyx_PyObject_IsTrue(__pyx_t_1); if (unlikely(__pyx_t_9 < 0)) __PYX_ERR(0, 14, __pyx_L1_error)
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    if (__pyx_t_9) {
-      __Pyx_XDECREF(__pyx_r);
-      __Pyx_INCREF(Py_True);
-      __pyx_r = Py_True;
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-      goto __pyx_L0;
-    }
-  }
-  /*else*/ {
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(Py_False);
-    __pyx_r = Py_False;
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    goto __pyx_L0;
-  }
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  CYTHON_MAYBE_UNUSED_VAR(__pyx_cur_scope);
+  goto __pyx_L0;
+
+  /* "cpython/contextvars.pxd":133
+ * 
+ * 
+ * @_cython.c_compile_guard("!CYTHON_COMPILING_IN_LIMITED_API")             # <<<<<<<<<<<<<<
+ * cdef inline object get_value_no_default(var, default_value=None):
+ *     """Return a new reference to the value of the context variable,
+*/
 
   /* function exit code */
-  goto __pyx_L0;
   __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
   __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_8);
-  __Pyx_AddTraceback("genexpr", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __Pyx_AddTraceback("cpython.contextvars.get_value_no_default", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = 0;
   __pyx_L0:;
+
+  __Pyx_XDECREF(__pyx_v_pyvalue);
   __Pyx_XGIVEREF(__pyx_r);
-  #if !CYTHON_USE_EXC_INFO_STACK
-  __Pyx_Coroutine_ResetAndClearException(__pyx_generator);
-  #endif
-  __pyx_generator->resume_label = -1;
-  __Pyx_Coroutine_clear((PyObject*)__pyx_generator);
-  __Pyx_TraceReturn(__pyx_r, 0);
   __Pyx_RefNannyFinishContext();
   return __pyx_r;
 }
+#endif /*!(#if !CYTHON_COMPILING_IN_LIMITED_API)*/
 
-/* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
+/* "overload/bind.pxd":75
  * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
+ * 
+ * cdef inline bint runMatcher(const Matcher* matcher, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ * 	"""Return True if `arg` matches the annotation `matcher` was compiled from."""
+ * 	cdef PyTypeObject* arg_type
+*/
 
-static PyObject *__pyx_pf_8overload_4bind_matchesannotation(CYTHON_UNUSED PyObject *__pyx_self, PyObject *__pyx_v_obj, PyObject *__pyx_v_ann) {
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *__pyx_cur_scope;
-  PyObject *__pyx_r = NULL;
-  __Pyx_TraceDeclarations
-  __Pyx_RefNannyDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
+static CYTHON_INLINE int __pyx_f_8overload_4bind_runMatcher(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_matcher, PyObject *__pyx_v_arg) {
+  PyTypeObject *__pyx_v_arg_type;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
   int __pyx_t_3;
-  int __pyx_t_4;
   int __pyx_lineno = 0;
   const char *__pyx_filename = NULL;
   int __pyx_clineno = 0;
-  __Pyx_TraceFrameInit(__pyx_codeobj_)
-  __Pyx_RefNannySetupContext("matchesannotation", 0);
-  __pyx_cur_scope = (struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)__pyx_tp_new_8overload_4bind___pyx_scope_struct__matchesannotation(__pyx_ptype_8overload_4bind___pyx_scope_struct__matchesannotation, __pyx_empty_tuple, NULL);
-  if (unlikely(!__pyx_cur_scope)) {
-    __pyx_cur_scope = ((struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)Py_None);
-    __Pyx_INCREF(Py_None);
-    __PYX_ERR(0, 9, __pyx_L1_error)
-  } else {
-    __Pyx_GOTREF(__pyx_cur_scope);
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[0]))
+  __Pyx_TraceStartFunc("runMatcher", __pyx_f[2], 75, 0, 0, 0, __PYX_ERR(2, 75, __pyx_L1_error));
+
+  /* "overload/bind.pxd":79
+ * 	cdef PyTypeObject* arg_type
+ * 
+ * 	if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ * 		return True
+ * 	if matcher.kind == MATCH_TYPE:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_ANY);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pxd":80
+ * 
+ * 	if matcher.kind == MATCH_ANY:
+ * 		return True             # <<<<<<<<<<<<<<
+ * 	if matcher.kind == MATCH_TYPE:
+ * 		arg_type = Py_TYPE_PTR(arg)
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 7, 0, __PYX_ERR(2, 80, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pxd":79
+ * 	cdef PyTypeObject* arg_type
+ * 
+ * 	if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ * 		return True
+ * 	if matcher.kind == MATCH_TYPE:
+*/
   }
-  __Pyx_TraceCall("matchesannotation", __pyx_f[0], 9, 0, __PYX_ERR(0, 9, __pyx_L1_error));
-  __pyx_cur_scope->__pyx_v_obj = __pyx_v_obj;
-  __Pyx_INCREF(__pyx_cur_scope->__pyx_v_obj);
-  __Pyx_GIVEREF(__pyx_cur_scope->__pyx_v_obj);
-  __pyx_cur_scope->__pyx_v_ann = __pyx_v_ann;
-  __Pyx_INCREF(__pyx_cur_scope->__pyx_v_ann);
-  __Pyx_GIVEREF(__pyx_cur_scope->__pyx_v_ann);
 
-  /* "overload/bind.pyx":11
- * def matchesannotation(obj, ann):
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):             # <<<<<<<<<<<<<<
- *         # typing annotations
- *         if ann.__origin__ is Union:
- */
-  __pyx_t_1 = __pyx_cur_scope->__pyx_v_ann;
-  __Pyx_INCREF(__pyx_t_1);
-  __Pyx_GetModuleGlobalName(__pyx_t_2, __pyx_n_s_GenericAlias); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 11, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyObject_IsInstance(__pyx_t_1, __pyx_t_2); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 11, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_4 = (__pyx_t_3 != 0);
-  if (__pyx_t_4) {
+  /* "overload/bind.pxd":81
+ * 	if matcher.kind == MATCH_ANY:
+ * 		return True
+ * 	if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ * 		arg_type = Py_TYPE_PTR(arg)
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_TYPE);
 
-    /* "overload/bind.pyx":13
- *     if isinstance(ann, _GenericAlias):
- *         # typing annotations
- *         if ann.__origin__ is Union:             # <<<<<<<<<<<<<<
- *             return any(matchesannotation(obj, x) for x in ann.__args__)
- *         print("unknown typing annotation")
- */
-    __pyx_t_2 = __Pyx_PyObject_GetAttrStr(__pyx_cur_scope->__pyx_v_ann, __pyx_n_s_origin); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 13, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_n_s_Union); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 13, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
-    __pyx_t_4 = (__pyx_t_2 == __pyx_t_1);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __pyx_t_3 = (__pyx_t_4 != 0);
-    if (__pyx_t_3) {
+  if (__pyx_t_1) {
 
-      /* "overload/bind.pyx":14
- *         # typing annotations
- *         if ann.__origin__ is Union:
- *             return any(matchesannotation(obj, x) for x in ann.__args__)             # <<<<<<<<<<<<<<
- *         print("unknown typing annotation")
- *         return False
- */
-      __Pyx_XDECREF(__pyx_r);
-      __pyx_t_1 = __pyx_pf_8overload_4bind_17matchesannotation_genexpr(((PyObject*)__pyx_cur_scope)); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_GOTREF(__pyx_t_1);
-      __pyx_t_2 = __Pyx_Generator_Next(__pyx_t_1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 14, __pyx_L1_error)
-      __Pyx_GOTREF(__pyx_t_2);
-      __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-      __pyx_r = __pyx_t_2;
-      __pyx_t_2 = 0;
-      goto __pyx_L0;
 
-      /* "overload/bind.pyx":13
- *     if isinstance(ann, _GenericAlias):
- *         # typing annotations
- *         if ann.__origin__ is Union:             # <<<<<<<<<<<<<<
- *             return any(matchesannotation(obj, x) for x in ann.__args__)
- *         print("unknown typing annotation")
- */
+    /* "overload/bind.pxd":82
+ * 		return True
+ * 	if matcher.kind == MATCH_TYPE:
+ * 		arg_type = Py_TYPE_PTR(arg)             # <<<<<<<<<<<<<<
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+ * 	if matcher.kind == MATCH_INSTANCE:
+*/
+    __pyx_v_arg_type = Py_TYPE(__pyx_v_arg);
+
+    /* "overload/bind.pxd":83
+ * 	if matcher.kind == MATCH_TYPE:
+ * 		arg_type = Py_TYPE_PTR(arg)
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)             # <<<<<<<<<<<<<<
+ * 	if matcher.kind == MATCH_INSTANCE:
+ * 		return PyObject_IsInstance_PTR(arg, matcher.annotation)
+*/
+    __pyx_t_2 = (__pyx_v_arg_type == __pyx_v_matcher->type);
+
+    if (!__pyx_t_2) {
+
+    } else {
+
+      __pyx_t_1 = __pyx_t_2;
+
+      goto __pyx_L5_bool_binop_done;
     }
+    __pyx_t_2 = PyType_IsSubtype(__pyx_v_arg_type, __pyx_v_matcher->type);
 
-    /* "overload/bind.pyx":15
- *         if ann.__origin__ is Union:
- *             return any(matchesannotation(obj, x) for x in ann.__args__)
- *         print("unknown typing annotation")             # <<<<<<<<<<<<<<
- *         return False
- *     elif ann is Any:
- */
-    __pyx_t_2 = __Pyx_PyObject_Call(__pyx_builtin_print, __pyx_tuple__2, NULL); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 15, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
 
-    /* "overload/bind.pyx":16
- *             return any(matchesannotation(obj, x) for x in ann.__args__)
- *         print("unknown typing annotation")
- *         return False             # <<<<<<<<<<<<<<
- *     elif ann is Any:
- *         return True
- */
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(Py_False);
-    __pyx_r = Py_False;
+    __pyx_t_1 = __pyx_t_2;
+
+    __pyx_L5_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 18, 0, __PYX_ERR(2, 83, __pyx_L1_error));
     goto __pyx_L0;
 
-    /* "overload/bind.pyx":11
- * def matchesannotation(obj, ann):
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):             # <<<<<<<<<<<<<<
- *         # typing annotations
- *         if ann.__origin__ is Union:
- */
+    /* "overload/bind.pxd":81
+ * 	if matcher.kind == MATCH_ANY:
+ * 		return True
+ * 	if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ * 		arg_type = Py_TYPE_PTR(arg)
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+*/
   }
 
-  /* "overload/bind.pyx":17
- *         print("unknown typing annotation")
- *         return False
- *     elif ann is Any:             # <<<<<<<<<<<<<<
- *         return True
- *     else:
- */
-  __Pyx_GetModuleGlobalName(__pyx_t_2, __pyx_n_s_Any); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 17, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = (__pyx_cur_scope->__pyx_v_ann == __pyx_t_2);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_4 = (__pyx_t_3 != 0);
-  if (__pyx_t_4) {
+  /* "overload/bind.pxd":84
+ * 		arg_type = Py_TYPE_PTR(arg)
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+ * 	if matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ * 		return PyObject_IsInstance_PTR(arg, matcher.annotation)
+ * 	return runProgram(matcher.program.data(), arg)
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_INSTANCE);
 
-    /* "overload/bind.pyx":18
- *         return False
- *     elif ann is Any:
- *         return True             # <<<<<<<<<<<<<<
- *     else:
- *         return isinstance(obj, ann)
- */
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(Py_True);
-    __pyx_r = Py_True;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pxd":85
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+ * 	if matcher.kind == MATCH_INSTANCE:
+ * 		return PyObject_IsInstance_PTR(arg, matcher.annotation)             # <<<<<<<<<<<<<<
+ * 	return runProgram(matcher.program.data(), arg)
+*/
+    __pyx_t_3 = PyObject_IsInstance(__pyx_v_arg, __pyx_v_matcher->annotation); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(2, 85, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 34, 0, __PYX_ERR(2, 85, __pyx_L1_error));
     goto __pyx_L0;
 
-    /* "overload/bind.pyx":17
- *         print("unknown typing annotation")
- *         return False
- *     elif ann is Any:             # <<<<<<<<<<<<<<
- *         return True
- *     else:
- */
+    /* "overload/bind.pxd":84
+ * 		arg_type = Py_TYPE_PTR(arg)
+ * 		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+ * 	if matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ * 		return PyObject_IsInstance_PTR(arg, matcher.annotation)
+ * 	return runProgram(matcher.program.data(), arg)
+*/
   }
 
-  /* "overload/bind.pyx":20
- *         return True
- *     else:
- *         return isinstance(obj, ann)             # <<<<<<<<<<<<<<
- */
-  /*else*/ {
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_2 = __pyx_cur_scope->__pyx_v_obj;
-    __Pyx_INCREF(__pyx_t_2);
-    __pyx_t_1 = __pyx_cur_scope->__pyx_v_ann;
-    __Pyx_INCREF(__pyx_t_1);
-    __pyx_t_4 = PyObject_IsInstance(__pyx_t_2, __pyx_t_1); if (unlikely(__pyx_t_4 == ((int)-1))) __PYX_ERR(0, 20, __pyx_L1_error)
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __pyx_t_1 = __Pyx_PyBool_FromLong(__pyx_t_4); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 20, __pyx_L1_error)
-    __Pyx_GOTREF(__pyx_t_1);
+  /* "overload/bind.pxd":86
+ * 	if matcher.kind == MATCH_INSTANCE:
+ * 		return PyObject_IsInstance_PTR(arg, matcher.annotation)
+ * 	return runProgram(matcher.program.data(), arg)             # <<<<<<<<<<<<<<
+*/
+  __pyx_t_1 = __pyx_f_8overload_4bind_runProgram(__pyx_v_matcher->program.data(), __pyx_v_arg); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(2, 86, __pyx_L1_error)
+  {
     __pyx_r = __pyx_t_1;
-    __pyx_t_1 = 0;
-    goto __pyx_L0;
   }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 40, 0, __PYX_ERR(2, 86, __pyx_L1_error));
+  goto __pyx_L0;
 
-  /* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
+  /* "overload/bind.pxd":75
  * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
+ * 
+ * cdef inline bint runMatcher(const Matcher* matcher, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ * 	"""Return True if `arg` matches the annotation `matcher` was compiled from."""
+ * 	cdef PyTypeObject* arg_type
+*/
 
   /* function exit code */
   __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("overload.bind.matchesannotation", __pyx_clineno, __pyx_lineno, __pyx_filename);
-  __pyx_r = NULL;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(2, 75, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.runMatcher", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
   __pyx_L0:;
-  __Pyx_DECREF(((PyObject *)__pyx_cur_scope));
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_TraceReturn(__pyx_r, 0);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
 
-static struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *__pyx_freelist_8overload_4bind___pyx_scope_struct__matchesannotation[8];
-static int __pyx_freecount_8overload_4bind___pyx_scope_struct__matchesannotation = 0;
 
-static PyObject *__pyx_tp_new_8overload_4bind___pyx_scope_struct__matchesannotation(PyTypeObject *t, CYTHON_UNUSED PyObject *a, CYTHON_UNUSED PyObject *k) {
-  PyObject *o;
-  if (CYTHON_COMPILING_IN_CPYTHON && likely((__pyx_freecount_8overload_4bind___pyx_scope_struct__matchesannotation > 0) & (t->tp_basicsize == sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation)))) {
-    o = (PyObject*)__pyx_freelist_8overload_4bind___pyx_scope_struct__matchesannotation[--__pyx_freecount_8overload_4bind___pyx_scope_struct__matchesannotation];
-    memset(o, 0, sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation));
-    (void) PyObject_INIT(o, t);
-    PyObject_GC_Track(o);
-  } else {
-    o = (*t->tp_alloc)(t, 0);
-    if (unlikely(!o)) return 0;
-  }
-  return o;
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
 }
 
-static void __pyx_tp_dealloc_8overload_4bind___pyx_scope_struct__matchesannotation(PyObject *o) {
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *p = (struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)o;
-  PyObject_GC_UnTrack(o);
-  Py_CLEAR(p->__pyx_v_ann);
-  Py_CLEAR(p->__pyx_v_obj);
-  if (CYTHON_COMPILING_IN_CPYTHON && ((__pyx_freecount_8overload_4bind___pyx_scope_struct__matchesannotation < 8) & (Py_TYPE(o)->tp_basicsize == sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation)))) {
-    __pyx_freelist_8overload_4bind___pyx_scope_struct__matchesannotation[__pyx_freecount_8overload_4bind___pyx_scope_struct__matchesannotation++] = ((struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)o);
-  } else {
-    (*Py_TYPE(o)->tp_free)(o);
-  }
-}
+/* "overload/bind.pyx":42
+ * 
+ * 
+ * cdef Matcher createMatcher(object annotation, bint typing, ContainerCheck check) except *:             # <<<<<<<<<<<<<<
+ *     """Compile a parameter annotation into a Matcher, which decides if an argument matches the annotation.
+ *     Classes created by `type` itself are checked natively. Such checks only look at the type of the argument, and do
+*/
 
-static int __pyx_tp_traverse_8overload_4bind___pyx_scope_struct__matchesannotation(PyObject *o, visitproc v, void *a) {
-  int e;
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *p = (struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)o;
-  if (p->__pyx_v_ann) {
-    e = (*v)(p->__pyx_v_ann, a); if (e) return e;
-  }
-  if (p->__pyx_v_obj) {
-    e = (*v)(p->__pyx_v_obj, a); if (e) return e;
-  }
-  return 0;
-}
+static struct __pyx_t_8overload_4bind_Matcher __pyx_f_8overload_4bind_createMatcher(PyObject *__pyx_v_annotation, int __pyx_v_typing, struct __pyx_t_8overload_4bind_ContainerCheck __pyx_v_check) {
+  struct __pyx_t_8overload_4bind_Matcher __pyx_v_matcher;
+  PyObject *__pyx_v_guards = 0;
+  PyObject *__pyx_v_guards_tuple = NULL;
+  struct __pyx_t_8overload_4bind_Matcher __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  int __pyx_t_4;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[1]))
+  __Pyx_RefNannySetupContext("createMatcher", 0);
+  __Pyx_TraceStartFunc("createMatcher", __pyx_f[0], 42, 0, 0, 0, __PYX_ERR(0, 42, __pyx_L1_error));
 
-static int __pyx_tp_clear_8overload_4bind___pyx_scope_struct__matchesannotation(PyObject *o) {
-  PyObject* tmp;
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *p = (struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation *)o;
-  tmp = ((PyObject*)p->__pyx_v_ann);
-  p->__pyx_v_ann = Py_None; Py_INCREF(Py_None);
-  Py_XDECREF(tmp);
-  tmp = ((PyObject*)p->__pyx_v_obj);
-  p->__pyx_v_obj = Py_None; Py_INCREF(Py_None);
-  Py_XDECREF(tmp);
-  return 0;
-}
+  /* "overload/bind.pyx":52
+ *     """
+ *     cdef Matcher matcher
+ *     cdef list guards = []             # <<<<<<<<<<<<<<
+ *     matcher.annotation = <PyObject*> annotation
+ *     matcher.type = NULL
+*/
+  __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 52, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_v_guards = ((PyObject*)__pyx_t_1);
+  __pyx_t_1 = 0;
 
-static PyTypeObject __pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation = {
-  PyVarObject_HEAD_INIT(0, 0)
-  "overload.bind.__pyx_scope_struct__matchesannotation", /*tp_name*/
-  sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct__matchesannotation), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_8overload_4bind___pyx_scope_struct__matchesannotation, /*tp_dealloc*/
-  #if PY_VERSION_HEX < 0x030800b4
-  0, /*tp_print*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b4
-  0, /*tp_vectorcall_offset*/
-  #endif
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #endif
-  #if PY_MAJOR_VERSION >= 3
-  0, /*tp_as_async*/
-  #endif
-  0, /*tp_repr*/
-  0, /*tp_as_number*/
-  0, /*tp_as_sequence*/
-  0, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  0, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_VERSION_TAG|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_HAVE_GC, /*tp_flags*/
-  0, /*tp_doc*/
-  __pyx_tp_traverse_8overload_4bind___pyx_scope_struct__matchesannotation, /*tp_traverse*/
-  __pyx_tp_clear_8overload_4bind___pyx_scope_struct__matchesannotation, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  0, /*tp_methods*/
-  0, /*tp_members*/
-  0, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  0, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_8overload_4bind___pyx_scope_struct__matchesannotation, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  0, /*tp_version_tag*/
-  #if PY_VERSION_HEX >= 0x030400a1
-  0, /*tp_finalize*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b1
-  0, /*tp_vectorcall*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b4 && PY_VERSION_HEX < 0x03090000
-  0, /*tp_print*/
-  #endif
-};
+  /* "overload/bind.pyx":53
+ *     cdef Matcher matcher
+ *     cdef list guards = []
+ *     matcher.annotation = <PyObject*> annotation             # <<<<<<<<<<<<<<
+ *     matcher.type = NULL
+ *     matcher.type_based = True
+*/
+  __pyx_v_matcher.annotation = ((PyObject *)__pyx_v_annotation);
 
-static struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *__pyx_freelist_8overload_4bind___pyx_scope_struct_1_genexpr[8];
-static int __pyx_freecount_8overload_4bind___pyx_scope_struct_1_genexpr = 0;
+  /* "overload/bind.pyx":54
+ *     cdef list guards = []
+ *     matcher.annotation = <PyObject*> annotation
+ *     matcher.type = NULL             # <<<<<<<<<<<<<<
+ *     matcher.type_based = True
+ * 
+*/
+  __pyx_v_matcher.type = NULL;
 
-static PyObject *__pyx_tp_new_8overload_4bind___pyx_scope_struct_1_genexpr(PyTypeObject *t, CYTHON_UNUSED PyObject *a, CYTHON_UNUSED PyObject *k) {
-  PyObject *o;
-  if (CYTHON_COMPILING_IN_CPYTHON && likely((__pyx_freecount_8overload_4bind___pyx_scope_struct_1_genexpr > 0) & (t->tp_basicsize == sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr)))) {
-    o = (PyObject*)__pyx_freelist_8overload_4bind___pyx_scope_struct_1_genexpr[--__pyx_freecount_8overload_4bind___pyx_scope_struct_1_genexpr];
-    memset(o, 0, sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr));
-    (void) PyObject_INIT(o, t);
-    PyObject_GC_Track(o);
-  } else {
-    o = (*t->tp_alloc)(t, 0);
-    if (unlikely(!o)) return 0;
-  }
-  return o;
-}
+  /* "overload/bind.pyx":55
+ *     matcher.annotation = <PyObject*> annotation
+ *     matcher.type = NULL
+ *     matcher.type_based = True             # <<<<<<<<<<<<<<
+ * 
+ *     if typing:
+*/
+  __pyx_v_matcher.type_based = 1;
 
-static void __pyx_tp_dealloc_8overload_4bind___pyx_scope_struct_1_genexpr(PyObject *o) {
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *p = (struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)o;
-  PyObject_GC_UnTrack(o);
-  Py_CLEAR(p->__pyx_outer_scope);
-  Py_CLEAR(p->__pyx_v_x);
-  if (CYTHON_COMPILING_IN_CPYTHON && ((__pyx_freecount_8overload_4bind___pyx_scope_struct_1_genexpr < 8) & (Py_TYPE(o)->tp_basicsize == sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr)))) {
-    __pyx_freelist_8overload_4bind___pyx_scope_struct_1_genexpr[__pyx_freecount_8overload_4bind___pyx_scope_struct_1_genexpr++] = ((struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)o);
-  } else {
-    (*Py_TYPE(o)->tp_free)(o);
-  }
-}
+  /* "overload/bind.pyx":57
+ *     matcher.type_based = True
+ * 
+ *     if typing:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(annotation, matcher.program, guards, check)
+ *         matcher.type_based = isTypeBased(matcher.program)
+*/
+  if (__pyx_v_typing) {
 
-static int __pyx_tp_traverse_8overload_4bind___pyx_scope_struct_1_genexpr(PyObject *o, visitproc v, void *a) {
-  int e;
-  struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *p = (struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr *)o;
-  if (p->__pyx_outer_scope) {
-    e = (*v)(((PyObject *)p->__pyx_outer_scope), a); if (e) return e;
-  }
-  if (p->__pyx_v_x) {
-    e = (*v)(p->__pyx_v_x, a); if (e) return e;
-  }
-  return 0;
-}
+    /* "overload/bind.pyx":58
+ * 
+ *     if typing:
+ *         compileAnnotation(annotation, matcher.program, guards, check)             # <<<<<<<<<<<<<<
+ *         matcher.type_based = isTypeBased(matcher.program)
+ * 
+*/
+    __pyx_f_8overload_4bind_compileAnnotation(__pyx_v_annotation, __pyx_v_matcher.program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 58, __pyx_L1_error)
 
-static PyTypeObject __pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr = {
-  PyVarObject_HEAD_INIT(0, 0)
-  "overload.bind.__pyx_scope_struct_1_genexpr", /*tp_name*/
-  sizeof(struct __pyx_obj_8overload_4bind___pyx_scope_struct_1_genexpr), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_8overload_4bind___pyx_scope_struct_1_genexpr, /*tp_dealloc*/
-  #if PY_VERSION_HEX < 0x030800b4
-  0, /*tp_print*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b4
-  0, /*tp_vectorcall_offset*/
-  #endif
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #endif
-  #if PY_MAJOR_VERSION >= 3
-  0, /*tp_as_async*/
-  #endif
-  0, /*tp_repr*/
-  0, /*tp_as_number*/
-  0, /*tp_as_sequence*/
-  0, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  0, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_VERSION_TAG|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_HAVE_GC, /*tp_flags*/
-  0, /*tp_doc*/
-  __pyx_tp_traverse_8overload_4bind___pyx_scope_struct_1_genexpr, /*tp_traverse*/
-  0, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  0, /*tp_methods*/
-  0, /*tp_members*/
-  0, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  0, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_8overload_4bind___pyx_scope_struct_1_genexpr, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  0, /*tp_version_tag*/
-  #if PY_VERSION_HEX >= 0x030400a1
-  0, /*tp_finalize*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b1
-  0, /*tp_vectorcall*/
-  #endif
-  #if PY_VERSION_HEX >= 0x030800b4 && PY_VERSION_HEX < 0x03090000
-  0, /*tp_print*/
-  #endif
-};
+    /* "overload/bind.pyx":59
+ *     if typing:
+ *         compileAnnotation(annotation, matcher.program, guards, check)
+ *         matcher.type_based = isTypeBased(matcher.program)             # <<<<<<<<<<<<<<
+ * 
+ *         # Simple programs are run as simple matchers
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_isTypeBased(__pyx_v_matcher.program); if (unlikely(__pyx_t_2 == ((int)-1) && PyErr_Occurred())) __PYX_ERR(0, 59, __pyx_L1_error)
+    __pyx_v_matcher.type_based = __pyx_t_2;
 
-static PyMethodDef __pyx_methods[] = {
-  {0, 0, 0, 0}
-};
+    /* "overload/bind.pyx":62
+ * 
+ *         # Simple programs are run as simple matchers
+ *         if matcher.program[0].op == OP_ANY:             # <<<<<<<<<<<<<<
+ *             matcher.kind = MATCH_ANY
+ *         elif matcher.program[0].op == OP_TYPE:
+*/
+    __pyx_t_2 = ((__pyx_v_matcher.program[0]).op == __pyx_e_8overload_4bind_OP_ANY);
 
-#if PY_MAJOR_VERSION >= 3
-#if CYTHON_PEP489_MULTI_PHASE_INIT
-static PyObject* __pyx_pymod_create(PyObject *spec, PyModuleDef *def); /*proto*/
-static int __pyx_pymod_exec_bind(PyObject* module); /*proto*/
-static PyModuleDef_Slot __pyx_moduledef_slots[] = {
-  {Py_mod_create, (void*)__pyx_pymod_create},
-  {Py_mod_exec, (void*)__pyx_pymod_exec_bind},
-  {0, NULL}
-};
-#endif
+    if (__pyx_t_2) {
 
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    "bind",
-    0, /* m_doc */
-  #if CYTHON_PEP489_MULTI_PHASE_INIT
-    0, /* m_size */
-  #else
-    -1, /* m_size */
-  #endif
-    __pyx_methods /* m_methods */,
-  #if CYTHON_PEP489_MULTI_PHASE_INIT
-    __pyx_moduledef_slots, /* m_slots */
-  #else
-    NULL, /* m_reload */
-  #endif
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-#ifndef CYTHON_SMALL_CODE
-#if defined(__clang__)
-    #define CYTHON_SMALL_CODE
-#elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
-    #define CYTHON_SMALL_CODE __attribute__((cold))
-#else
-    #define CYTHON_SMALL_CODE
-#endif
-#endif
 
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_n_s_Any, __pyx_k_Any, sizeof(__pyx_k_Any), 0, 0, 1, 1},
-  {&__pyx_n_s_GenericAlias, __pyx_k_GenericAlias, sizeof(__pyx_k_GenericAlias), 0, 0, 1, 1},
-  {&__pyx_n_s_Union, __pyx_k_Union, sizeof(__pyx_k_Union), 0, 0, 1, 1},
-  {&__pyx_n_s_ann, __pyx_k_ann, sizeof(__pyx_k_ann), 0, 0, 1, 1},
-  {&__pyx_n_s_args, __pyx_k_args, sizeof(__pyx_k_args), 0, 0, 1, 1},
-  {&__pyx_n_s_args_2, __pyx_k_args_2, sizeof(__pyx_k_args_2), 0, 0, 1, 1},
-  {&__pyx_n_s_cline_in_traceback, __pyx_k_cline_in_traceback, sizeof(__pyx_k_cline_in_traceback), 0, 0, 1, 1},
-  {&__pyx_n_s_close, __pyx_k_close, sizeof(__pyx_k_close), 0, 0, 1, 1},
-  {&__pyx_n_s_genexpr, __pyx_k_genexpr, sizeof(__pyx_k_genexpr), 0, 0, 1, 1},
-  {&__pyx_n_s_import, __pyx_k_import, sizeof(__pyx_k_import), 0, 0, 1, 1},
-  {&__pyx_n_s_main, __pyx_k_main, sizeof(__pyx_k_main), 0, 0, 1, 1},
-  {&__pyx_n_s_matchesannotation, __pyx_k_matchesannotation, sizeof(__pyx_k_matchesannotation), 0, 0, 1, 1},
-  {&__pyx_n_s_matchesannotation_locals_genexpr, __pyx_k_matchesannotation_locals_genexpr, sizeof(__pyx_k_matchesannotation_locals_genexpr), 0, 0, 1, 1},
-  {&__pyx_n_s_name, __pyx_k_name, sizeof(__pyx_k_name), 0, 0, 1, 1},
-  {&__pyx_n_s_obj, __pyx_k_obj, sizeof(__pyx_k_obj), 0, 0, 1, 1},
-  {&__pyx_n_s_origin, __pyx_k_origin, sizeof(__pyx_k_origin), 0, 0, 1, 1},
-  {&__pyx_n_s_overload_bind, __pyx_k_overload_bind, sizeof(__pyx_k_overload_bind), 0, 0, 1, 1},
-  {&__pyx_kp_s_overload_bind_pyx, __pyx_k_overload_bind_pyx, sizeof(__pyx_k_overload_bind_pyx), 0, 0, 1, 0},
-  {&__pyx_n_s_print, __pyx_k_print, sizeof(__pyx_k_print), 0, 0, 1, 1},
-  {&__pyx_n_s_send, __pyx_k_send, sizeof(__pyx_k_send), 0, 0, 1, 1},
-  {&__pyx_n_s_test, __pyx_k_test, sizeof(__pyx_k_test), 0, 0, 1, 1},
-  {&__pyx_n_s_throw, __pyx_k_throw, sizeof(__pyx_k_throw), 0, 0, 1, 1},
-  {&__pyx_n_s_typing, __pyx_k_typing, sizeof(__pyx_k_typing), 0, 0, 1, 1},
-  {&__pyx_kp_u_unknown_typing_annotation, __pyx_k_unknown_typing_annotation, sizeof(__pyx_k_unknown_typing_annotation), 0, 1, 0, 0},
-  {0, 0, 0, 0, 0, 0, 0}
-};
-static CYTHON_SMALL_CODE int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_print = __Pyx_GetBuiltinName(__pyx_n_s_print); if (!__pyx_builtin_print) __PYX_ERR(0, 15, __pyx_L1_error)
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
+      /* "overload/bind.pyx":63
+ *         # Simple programs are run as simple matchers
+ *         if matcher.program[0].op == OP_ANY:
+ *             matcher.kind = MATCH_ANY             # <<<<<<<<<<<<<<
+ *         elif matcher.program[0].op == OP_TYPE:
+ *             matcher.kind = MATCH_TYPE
+*/
+      __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_ANY;
 
-static CYTHON_SMALL_CODE int __Pyx_InitCachedConstants(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_InitCachedConstants", 0);
+      /* "overload/bind.pyx":62
+ * 
+ *         # Simple programs are run as simple matchers
+ *         if matcher.program[0].op == OP_ANY:             # <<<<<<<<<<<<<<
+ *             matcher.kind = MATCH_ANY
+ *         elif matcher.program[0].op == OP_TYPE:
+*/
+      goto __pyx_L4;
+    }
 
-  /* "overload/bind.pyx":15
- *         if ann.__origin__ is Union:
- *             return any(matchesannotation(obj, x) for x in ann.__args__)
- *         print("unknown typing annotation")             # <<<<<<<<<<<<<<
- *         return False
- *     elif ann is Any:
- */
-  __pyx_tuple__2 = PyTuple_Pack(1, __pyx_kp_u_unknown_typing_annotation); if (unlikely(!__pyx_tuple__2)) __PYX_ERR(0, 15, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__2);
-  __Pyx_GIVEREF(__pyx_tuple__2);
+    /* "overload/bind.pyx":64
+ *         if matcher.program[0].op == OP_ANY:
+ *             matcher.kind = MATCH_ANY
+ *         elif matcher.program[0].op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *             matcher.kind = MATCH_TYPE
+ *             matcher.type = <PyTypeObject*> matcher.program[0].value
+*/
+    __pyx_t_2 = ((__pyx_v_matcher.program[0]).op == __pyx_e_8overload_4bind_OP_TYPE);
 
-  /* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
- * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
-  __pyx_tuple__3 = PyTuple_Pack(4, __pyx_n_s_obj, __pyx_n_s_ann, __pyx_n_s_genexpr, __pyx_n_s_genexpr); if (unlikely(!__pyx_tuple__3)) __PYX_ERR(0, 9, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_tuple__3);
-  __Pyx_GIVEREF(__pyx_tuple__3);
-  __pyx_codeobj_ = (PyObject*)__Pyx_PyCode_New(2, 0, 4, 0, CO_OPTIMIZED|CO_NEWLOCALS, __pyx_empty_bytes, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_tuple__3, __pyx_empty_tuple, __pyx_empty_tuple, __pyx_kp_s_overload_bind_pyx, __pyx_n_s_matchesannotation, 9, __pyx_empty_bytes); if (unlikely(!__pyx_codeobj_)) __PYX_ERR(0, 9, __pyx_L1_error)
-  __Pyx_RefNannyFinishContext();
-  return 0;
-  __pyx_L1_error:;
-  __Pyx_RefNannyFinishContext();
-  return -1;
-}
+    if (__pyx_t_2) {
 
-static CYTHON_SMALL_CODE int __Pyx_InitGlobals(void) {
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) __PYX_ERR(0, 1, __pyx_L1_error);
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
 
-static CYTHON_SMALL_CODE int __Pyx_modinit_global_init_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_variable_export_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_function_export_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_type_init_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_type_import_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_variable_import_code(void); /*proto*/
-static CYTHON_SMALL_CODE int __Pyx_modinit_function_import_code(void); /*proto*/
+      /* "overload/bind.pyx":65
+ *             matcher.kind = MATCH_ANY
+ *         elif matcher.program[0].op == OP_TYPE:
+ *             matcher.kind = MATCH_TYPE             # <<<<<<<<<<<<<<
+ *             matcher.type = <PyTypeObject*> matcher.program[0].value
+ *         else:
+*/
+      __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_TYPE;
 
-static int __Pyx_modinit_global_init_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_global_init_code", 0);
-  /*--- Global init code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+      /* "overload/bind.pyx":66
+ *         elif matcher.program[0].op == OP_TYPE:
+ *             matcher.kind = MATCH_TYPE
+ *             matcher.type = <PyTypeObject*> matcher.program[0].value             # <<<<<<<<<<<<<<
+ *         else:
+ *             matcher.kind = MATCH_PROGRAM
+*/
+      __pyx_v_matcher.type = ((PyTypeObject *)(__pyx_v_matcher.program[0]).value);
 
-static int __Pyx_modinit_variable_export_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_variable_export_code", 0);
-  /*--- Variable export code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+      /* "overload/bind.pyx":64
+ *         if matcher.program[0].op == OP_ANY:
+ *             matcher.kind = MATCH_ANY
+ *         elif matcher.program[0].op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *             matcher.kind = MATCH_TYPE
+ *             matcher.type = <PyTypeObject*> matcher.program[0].value
+*/
+      goto __pyx_L4;
+    }
 
-static int __Pyx_modinit_function_export_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_function_export_code", 0);
-  /*--- Function export code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+    /* "overload/bind.pyx":68
+ *             matcher.type = <PyTypeObject*> matcher.program[0].value
+ *         else:
+ *             matcher.kind = MATCH_PROGRAM             # <<<<<<<<<<<<<<
+ *     elif annotation is _empty or annotation is object:
+ *         matcher.kind = MATCH_ANY
+*/
+    /*else*/ {
+      __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_PROGRAM;
+    }
+    __pyx_L4:;
 
-static int __Pyx_modinit_type_init_code(void) {
-  __Pyx_RefNannyDeclarations
-  int __pyx_lineno = 0;
-  const char *__pyx_filename = NULL;
-  int __pyx_clineno = 0;
-  __Pyx_RefNannySetupContext("__Pyx_modinit_type_init_code", 0);
-  /*--- Type init code ---*/
-  if (PyType_Ready(&__pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation) < 0) __PYX_ERR(0, 9, __pyx_L1_error)
-  #if PY_VERSION_HEX < 0x030800B1
-  __pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation.tp_print = 0;
-  #endif
-  if ((CYTHON_USE_TYPE_SLOTS && CYTHON_USE_PYTYPE_LOOKUP) && likely(!__pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation.tp_dictoffset && __pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation.tp_getattro == PyObject_GenericGetAttr)) {
-    __pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation.tp_getattro = __Pyx_PyObject_GenericGetAttrNoDict;
-  }
-  __pyx_ptype_8overload_4bind___pyx_scope_struct__matchesannotation = &__pyx_type_8overload_4bind___pyx_scope_struct__matchesannotation;
-  if (PyType_Ready(&__pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr) < 0) __PYX_ERR(0, 14, __pyx_L1_error)
-  #if PY_VERSION_HEX < 0x030800B1
-  __pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr.tp_print = 0;
-  #endif
-  if ((CYTHON_USE_TYPE_SLOTS && CYTHON_USE_PYTYPE_LOOKUP) && likely(!__pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr.tp_dictoffset && __pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr.tp_getattro == PyObject_GenericGetAttr)) {
-    __pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr.tp_getattro = __Pyx_PyObject_GenericGetAttrNoDict;
+    /* "overload/bind.pyx":57
+ *     matcher.type_based = True
+ * 
+ *     if typing:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(annotation, matcher.program, guards, check)
+ *         matcher.type_based = isTypeBased(matcher.program)
+*/
+    goto __pyx_L3;
   }
-  __pyx_ptype_8overload_4bind___pyx_scope_struct_1_genexpr = &__pyx_type_8overload_4bind___pyx_scope_struct_1_genexpr;
-  __Pyx_RefNannyFinishContext();
-  return 0;
-  __pyx_L1_error:;
-  __Pyx_RefNannyFinishContext();
-  return -1;
-}
 
-static int __Pyx_modinit_type_import_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_type_import_code", 0);
-  /*--- Type import code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+  /* "overload/bind.pyx":69
+ *         else:
+ *             matcher.kind = MATCH_PROGRAM
+ *     elif annotation is _empty or annotation is object:             # <<<<<<<<<<<<<<
+ *         matcher.kind = MATCH_ANY
+ *     elif type(annotation) is type:
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_empty); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 69, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_3 = (__pyx_v_annotation == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_3) {
 
-static int __Pyx_modinit_variable_import_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_variable_import_code", 0);
-  /*--- Variable import code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+  } else {
 
-static int __Pyx_modinit_function_import_code(void) {
-  __Pyx_RefNannyDeclarations
-  __Pyx_RefNannySetupContext("__Pyx_modinit_function_import_code", 0);
-  /*--- Function import code ---*/
-  __Pyx_RefNannyFinishContext();
-  return 0;
-}
+    __pyx_t_2 = __pyx_t_3;
 
+    goto __pyx_L5_bool_binop_done;
+  }
+  __pyx_t_3 = (__pyx_v_annotation == __pyx_builtin_object);
 
-#ifndef CYTHON_NO_PYINIT_EXPORT
-#define __Pyx_PyMODINIT_FUNC PyMODINIT_FUNC
-#elif PY_MAJOR_VERSION < 3
-#ifdef __cplusplus
-#define __Pyx_PyMODINIT_FUNC extern "C" void
-#else
-#define __Pyx_PyMODINIT_FUNC void
-#endif
-#else
-#ifdef __cplusplus
-#define __Pyx_PyMODINIT_FUNC extern "C" PyObject *
-#else
-#define __Pyx_PyMODINIT_FUNC PyObject *
-#endif
-#endif
+  __pyx_t_2 = __pyx_t_3;
 
+  __pyx_L5_bool_binop_done:;
+  if (__pyx_t_2) {
 
-#if PY_MAJOR_VERSION < 3
-__Pyx_PyMODINIT_FUNC initbind(void) CYTHON_SMALL_CODE; /*proto*/
-__Pyx_PyMODINIT_FUNC initbind(void)
-#else
-__Pyx_PyMODINIT_FUNC PyInit_bind(void) CYTHON_SMALL_CODE; /*proto*/
-__Pyx_PyMODINIT_FUNC PyInit_bind(void)
-#if CYTHON_PEP489_MULTI_PHASE_INIT
-{
-  return PyModuleDef_Init(&__pyx_moduledef);
-}
-static CYTHON_SMALL_CODE int __Pyx_check_single_interpreter(void) {
-    #if PY_VERSION_HEX >= 0x030700A1
-    static PY_INT64_T main_interpreter_id = -1;
-    PY_INT64_T current_id = PyInterpreterState_GetID(PyThreadState_Get()->interp);
-    if (main_interpreter_id == -1) {
-        main_interpreter_id = current_id;
-        return (unlikely(current_id == -1)) ? -1 : 0;
-    } else if (unlikely(main_interpreter_id != current_id))
-    #else
-    static PyInterpreterState *main_interpreter = NULL;
-    PyInterpreterState *current_interpreter = PyThreadState_Get()->interp;
-    if (!main_interpreter) {
-        main_interpreter = current_interpreter;
-    } else if (unlikely(main_interpreter != current_interpreter))
-    #endif
-    {
-        PyErr_SetString(
-            PyExc_ImportError,
-            "Interpreter change detected - this module can only be loaded into one interpreter per process.");
-        return -1;
-    }
-    return 0;
-}
-static CYTHON_SMALL_CODE int __Pyx_copy_spec_to_module(PyObject *spec, PyObject *moddict, const char* from_name, const char* to_name, int allow_none) {
-    PyObject *value = PyObject_GetAttrString(spec, from_name);
-    int result = 0;
-    if (likely(value)) {
-        if (allow_none || value != Py_None) {
-            result = PyDict_SetItemString(moddict, to_name, value);
-        }
-        Py_DECREF(value);
-    } else if (PyErr_ExceptionMatches(PyExc_AttributeError)) {
-        PyErr_Clear();
-    } else {
-        result = -1;
-    }
-    return result;
-}
-static CYTHON_SMALL_CODE PyObject* __pyx_pymod_create(PyObject *spec, CYTHON_UNUSED PyModuleDef *def) {
-    PyObject *module = NULL, *moddict, *modname;
-    if (__Pyx_check_single_interpreter())
-        return NULL;
-    if (__pyx_m)
-        return __Pyx_NewRef(__pyx_m);
-    modname = PyObject_GetAttrString(spec, "name");
-    if (unlikely(!modname)) goto bad;
-    module = PyModule_NewObject(modname);
-    Py_DECREF(modname);
-    if (unlikely(!module)) goto bad;
-    moddict = PyModule_GetDict(module);
-    if (unlikely(!moddict)) goto bad;
-    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "loader", "__loader__", 1) < 0)) goto bad;
-    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "origin", "__file__", 1) < 0)) goto bad;
-    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "parent", "__package__", 1) < 0)) goto bad;
-    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "submodule_search_locations", "__path__", 0) < 0)) goto bad;
-    return module;
-bad:
-    Py_XDECREF(module);
-    return NULL;
-}
 
+    /* "overload/bind.pyx":70
+ *             matcher.kind = MATCH_PROGRAM
+ *     elif annotation is _empty or annotation is object:
+ *         matcher.kind = MATCH_ANY             # <<<<<<<<<<<<<<
+ *     elif type(annotation) is type:
+ *         matcher.kind = MATCH_TYPE
+*/
+    __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_ANY;
 
-static CYTHON_SMALL_CODE int __pyx_pymod_exec_bind(PyObject *__pyx_pyinit_module)
-#endif
-#endif
-{
-  __Pyx_TraceDeclarations
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  int __pyx_lineno = 0;
-  const char *__pyx_filename = NULL;
-  int __pyx_clineno = 0;
-  __Pyx_RefNannyDeclarations
-  #if CYTHON_PEP489_MULTI_PHASE_INIT
-  if (__pyx_m) {
-    if (__pyx_m == __pyx_pyinit_module) return 0;
-    PyErr_SetString(PyExc_RuntimeError, "Module 'bind' has already been imported. Re-initialisation is not supported.");
-    return -1;
+    /* "overload/bind.pyx":69
+ *         else:
+ *             matcher.kind = MATCH_PROGRAM
+ *     elif annotation is _empty or annotation is object:             # <<<<<<<<<<<<<<
+ *         matcher.kind = MATCH_ANY
+ *     elif type(annotation) is type:
+*/
+    goto __pyx_L3;
   }
-  #elif PY_MAJOR_VERSION >= 3
-  if (__pyx_m) return __Pyx_NewRef(__pyx_m);
-  #endif
-  #if CYTHON_REFNANNY
-__Pyx_RefNanny = __Pyx_RefNannyImportAPI("refnanny");
-if (!__Pyx_RefNanny) {
-  PyErr_Clear();
-  __Pyx_RefNanny = __Pyx_RefNannyImportAPI("Cython.Runtime.refnanny");
-  if (!__Pyx_RefNanny)
-      Py_FatalError("failed to import 'refnanny' module");
-}
-#endif
-  __Pyx_RefNannySetupContext("__Pyx_PyMODINIT_FUNC PyInit_bind(void)", 0);
-  if (__Pyx_check_binary_version() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #ifdef __Pxy_PyFrame_Initialize_Offsets
-  __Pxy_PyFrame_Initialize_Offsets();
-  #endif
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) __PYX_ERR(0, 1, __pyx_L1_error)
-  __pyx_empty_bytes = PyBytes_FromStringAndSize("", 0); if (unlikely(!__pyx_empty_bytes)) __PYX_ERR(0, 1, __pyx_L1_error)
-  __pyx_empty_unicode = PyUnicode_FromStringAndSize("", 0); if (unlikely(!__pyx_empty_unicode)) __PYX_ERR(0, 1, __pyx_L1_error)
-  #ifdef __Pyx_CyFunction_USED
-  if (__pyx_CyFunction_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_FusedFunction_USED
-  if (__pyx_FusedFunction_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_Coroutine_USED
-  if (__pyx_Coroutine_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_Generator_USED
-  if (__pyx_Generator_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_AsyncGen_USED
-  if (__pyx_AsyncGen_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  #ifdef __Pyx_StopAsyncIteration_USED
-  if (__pyx_StopAsyncIteration_init() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  /*--- Library function declarations ---*/
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Module creation code ---*/
-  #if CYTHON_PEP489_MULTI_PHASE_INIT
-  __pyx_m = __pyx_pyinit_module;
-  Py_INCREF(__pyx_m);
-  #else
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("bind", __pyx_methods, 0, 0, PYTHON_API_VERSION); Py_XINCREF(__pyx_m);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (unlikely(!__pyx_m)) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  __pyx_d = PyModule_GetDict(__pyx_m); if (unlikely(!__pyx_d)) __PYX_ERR(0, 1, __pyx_L1_error)
-  Py_INCREF(__pyx_d);
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_b)) __PYX_ERR(0, 1, __pyx_L1_error)
-  Py_INCREF(__pyx_b);
-  __pyx_cython_runtime = PyImport_AddModule((char *) "cython_runtime"); if (unlikely(!__pyx_cython_runtime)) __PYX_ERR(0, 1, __pyx_L1_error)
-  Py_INCREF(__pyx_cython_runtime);
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) __PYX_ERR(0, 1, __pyx_L1_error);
-  /*--- Initialize various global constants etc. ---*/
-  if (__Pyx_InitGlobals() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #if PY_MAJOR_VERSION < 3 && (__PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT)
-  if (__Pyx_init_sys_getdefaultencoding_params() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  if (__pyx_module_is_main_overload__bind) {
-    if (PyObject_SetAttr(__pyx_m, __pyx_n_s_name, __pyx_n_s_main) < 0) __PYX_ERR(0, 1, __pyx_L1_error)
+
+  /* "overload/bind.pyx":71
+ *     elif annotation is _empty or annotation is object:
+ *         matcher.kind = MATCH_ANY
+ *     elif type(annotation) is type:             # <<<<<<<<<<<<<<
+ *         matcher.kind = MATCH_TYPE
+ *         matcher.type = <PyTypeObject*> annotation
+*/
+  __pyx_t_2 = (((PyObject *)Py_TYPE(__pyx_v_annotation)) == ((PyObject *)(&PyType_Type)));
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":72
+ *         matcher.kind = MATCH_ANY
+ *     elif type(annotation) is type:
+ *         matcher.kind = MATCH_TYPE             # <<<<<<<<<<<<<<
+ *         matcher.type = <PyTypeObject*> annotation
+ *     else:
+*/
+    __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_TYPE;
+
+    /* "overload/bind.pyx":73
+ *     elif type(annotation) is type:
+ *         matcher.kind = MATCH_TYPE
+ *         matcher.type = <PyTypeObject*> annotation             # <<<<<<<<<<<<<<
+ *     else:
+ *         matcher.kind = MATCH_INSTANCE
+*/
+    __pyx_v_matcher.type = ((PyTypeObject *)__pyx_v_annotation);
+
+    /* "overload/bind.pyx":71
+ *     elif annotation is _empty or annotation is object:
+ *         matcher.kind = MATCH_ANY
+ *     elif type(annotation) is type:             # <<<<<<<<<<<<<<
+ *         matcher.kind = MATCH_TYPE
+ *         matcher.type = <PyTypeObject*> annotation
+*/
+    goto __pyx_L3;
   }
-  #if PY_MAJOR_VERSION >= 3
-  {
-    PyObject *modules = PyImport_GetModuleDict(); if (unlikely(!modules)) __PYX_ERR(0, 1, __pyx_L1_error)
-    if (!PyDict_GetItemString(modules, "overload.bind")) {
-      if (unlikely(PyDict_SetItemString(modules, "overload.bind", __pyx_m) < 0)) __PYX_ERR(0, 1, __pyx_L1_error)
+
+  /* "overload/bind.pyx":75
+ *         matcher.type = <PyTypeObject*> annotation
+ *     else:
+ *         matcher.kind = MATCH_INSTANCE             # <<<<<<<<<<<<<<
+ *         if isinstance(annotation, type):
+ *             guards.append(type(annotation))
+*/
+  /*else*/ {
+    __pyx_v_matcher.kind = __pyx_e_8overload_4bind_MATCH_INSTANCE;
+
+    /* "overload/bind.pyx":76
+ *     else:
+ *         matcher.kind = MATCH_INSTANCE
+ *         if isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *             guards.append(type(annotation))
+ *         else:
+*/
+    __pyx_t_2 = PyType_Check(__pyx_v_annotation); 
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":77
+ *         matcher.kind = MATCH_INSTANCE
+ *         if isinstance(annotation, type):
+ *             guards.append(type(annotation))             # <<<<<<<<<<<<<<
+ *         else:
+ *             matcher.type_based = False
+*/
+      __pyx_t_4 = __Pyx_PyList_Append(__pyx_v_guards, ((PyObject *)Py_TYPE(__pyx_v_annotation))); if (unlikely(__pyx_t_4 == ((int)-1))) __PYX_ERR(0, 77, __pyx_L1_error)
+
+
+      /* "overload/bind.pyx":76
+ *     else:
+ *         matcher.kind = MATCH_INSTANCE
+ *         if isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *             guards.append(type(annotation))
+ *         else:
+*/
+      goto __pyx_L7;
+    }
+
+    /* "overload/bind.pyx":79
+ *             guards.append(type(annotation))
+ *         else:
+ *             matcher.type_based = False             # <<<<<<<<<<<<<<
+ * 
+ *     guards_tuple = tuple(guards)
+*/
+    /*else*/ {
+      __pyx_v_matcher.type_based = 0;
     }
+    __pyx_L7:;
   }
-  #endif
-  /*--- Builtin init code ---*/
-  if (__Pyx_InitCachedBuiltins() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  /*--- Constants init code ---*/
-  if (__Pyx_InitCachedConstants() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  /*--- Global type/function init code ---*/
-  (void)__Pyx_modinit_global_init_code();
-  (void)__Pyx_modinit_variable_export_code();
-  (void)__Pyx_modinit_function_export_code();
-  if (unlikely(__Pyx_modinit_type_init_code() < 0)) __PYX_ERR(0, 1, __pyx_L1_error)
-  (void)__Pyx_modinit_type_import_code();
-  (void)__Pyx_modinit_variable_import_code();
-  (void)__Pyx_modinit_function_import_code();
-  /*--- Execution code ---*/
-  #if defined(__Pyx_Generator_USED) || defined(__Pyx_Coroutine_USED)
-  if (__Pyx_patch_abc() < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  #endif
-  __Pyx_TraceCall("__Pyx_PyMODINIT_FUNC PyInit_bind(void)", __pyx_f[0], 1, 0, __PYX_ERR(0, 1, __pyx_L1_error));
+  __pyx_L3:;
 
-  /* "overload/bind.pyx":7
- * #cython: wraparound=False
- * #cython: language_level = 3
- * from typing import _GenericAlias, Union, Any             # <<<<<<<<<<<<<<
+  /* "overload/bind.pyx":81
+ *             matcher.type_based = False
  * 
- * def matchesannotation(obj, ann):
- */
-  __pyx_t_1 = PyList_New(3); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_INCREF(__pyx_n_s_GenericAlias);
-  __Pyx_GIVEREF(__pyx_n_s_GenericAlias);
-  PyList_SET_ITEM(__pyx_t_1, 0, __pyx_n_s_GenericAlias);
-  __Pyx_INCREF(__pyx_n_s_Union);
-  __Pyx_GIVEREF(__pyx_n_s_Union);
-  PyList_SET_ITEM(__pyx_t_1, 1, __pyx_n_s_Union);
-  __Pyx_INCREF(__pyx_n_s_Any);
-  __Pyx_GIVEREF(__pyx_n_s_Any);
-  PyList_SET_ITEM(__pyx_t_1, 2, __pyx_n_s_Any);
-  __pyx_t_2 = __Pyx_Import(__pyx_n_s_typing, __pyx_t_1, 0); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_ImportFrom(__pyx_t_2, __pyx_n_s_GenericAlias); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_GenericAlias, __pyx_t_1) < 0) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_ImportFrom(__pyx_t_2, __pyx_n_s_Union); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_Union, __pyx_t_1) < 0) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_ImportFrom(__pyx_t_2, __pyx_n_s_Any); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 7, __pyx_L1_error)
+ *     guards_tuple = tuple(guards)             # <<<<<<<<<<<<<<
+ *     matcher.guards = <PyObject*> guards_tuple
+ *     Py_INCREF(guards_tuple)
+*/
+  __pyx_t_1 = PyList_AsTuple(__pyx_v_guards); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 81, __pyx_L1_error)
   __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_Any, __pyx_t_1) < 0) __PYX_ERR(0, 7, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+  __pyx_v_guards_tuple = ((PyObject*)__pyx_t_1);
+  __pyx_t_1 = 0;
 
-  /* "overload/bind.pyx":9
- * from typing import _GenericAlias, Union, Any
+  /* "overload/bind.pyx":82
  * 
- * def matchesannotation(obj, ann):             # <<<<<<<<<<<<<<
- *     """Return True if the object matches the annotation, including annotations from typing module."""
- *     if isinstance(ann, _GenericAlias):
- */
-  __pyx_t_2 = PyCFunction_NewEx(&__pyx_mdef_8overload_4bind_1matchesannotation, NULL, __pyx_n_s_overload_bind); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 9, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_matchesannotation, __pyx_t_2) < 0) __PYX_ERR(0, 9, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+ *     guards_tuple = tuple(guards)
+ *     matcher.guards = <PyObject*> guards_tuple             # <<<<<<<<<<<<<<
+ *     Py_INCREF(guards_tuple)
+ *     Py_INCREF(annotation)
+*/
+  __pyx_v_matcher.guards = ((PyObject *)__pyx_v_guards_tuple);
 
-  /* "overload/bind.pyx":1
- * #distutils: language = c++             # <<<<<<<<<<<<<<
- * #cython: profile=True
- * #cython: infer_types=True
- */
-  __pyx_t_2 = __Pyx_PyDict_NewPresized(0); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 1, __pyx_L1_error)
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_d, __pyx_n_s_test, __pyx_t_2) < 0) __PYX_ERR(0, 1, __pyx_L1_error)
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_TraceReturn(Py_None, 0);
+  /* "overload/bind.pyx":83
+ *     guards_tuple = tuple(guards)
+ *     matcher.guards = <PyObject*> guards_tuple
+ *     Py_INCREF(guards_tuple)             # <<<<<<<<<<<<<<
+ *     Py_INCREF(annotation)
+ *     return matcher
+*/
+  Py_INCREF(__pyx_v_guards_tuple);
 
-  /*--- Wrapped vars code ---*/
+  /* "overload/bind.pyx":84
+ *     matcher.guards = <PyObject*> guards_tuple
+ *     Py_INCREF(guards_tuple)
+ *     Py_INCREF(annotation)             # <<<<<<<<<<<<<<
+ *     return matcher
+ * 
+*/
+  Py_INCREF(__pyx_v_annotation);
 
+  /* "overload/bind.pyx":85
+ *     Py_INCREF(guards_tuple)
+ *     Py_INCREF(annotation)
+ *     return matcher             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_matcher;
+  }
+  __Pyx_TraceReturnValue(Py_None, 113, 0, __PYX_ERR(0, 85, __pyx_L1_error));
   goto __pyx_L0;
+
+  /* "overload/bind.pyx":42
+ * 
+ * 
+ * cdef Matcher createMatcher(object annotation, bint typing, ContainerCheck check) except *:             # <<<<<<<<<<<<<<
+ *     """Compile a parameter annotation into a Matcher, which decides if an argument matches the annotation.
+ *     Classes created by `type` itself are checked natively. Such checks only look at the type of the argument, and do
+*/
+
+  /* function exit code */
   __pyx_L1_error:;
   __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  if (__pyx_m) {
-    if (__pyx_d) {
-      __Pyx_AddTraceback("init overload.bind", __pyx_clineno, __pyx_lineno, __pyx_filename);
-    }
-    Py_CLEAR(__pyx_m);
-  } else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_ImportError, "init overload.bind");
-  }
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  #if CYTHON_PEP489_MULTI_PHASE_INIT
-  return (__pyx_m != NULL) ? 0 : -1;
-  #elif PY_MAJOR_VERSION >= 3
-  return __pyx_m;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
   #else
-  return;
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 42, __pyx_L1_error));
   #endif
-}
+  __Pyx_AddTraceback("overload.bind.createMatcher", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __Pyx_pretend_to_initialize(&__pyx_r);
+  __pyx_L0:;
 
-/* --- Runtime support code --- */
-/* Refnanny */
-#if CYTHON_REFNANNY
-static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname) {
-    PyObject *m = NULL, *p = NULL;
-    void *r = NULL;
-    m = PyImport_ImportModule(modname);
-    if (!m) goto end;
-    p = PyObject_GetAttrString(m, "RefNannyAPI");
-    if (!p) goto end;
-    r = PyLong_AsVoidPtr(p);
-end:
-    Py_XDECREF(p);
-    Py_XDECREF(m);
-    return (__Pyx_RefNannyAPIStruct *)r;
-}
-#endif
+  __Pyx_XDECREF(__pyx_v_guards);
+  __Pyx_XDECREF(__pyx_v_guards_tuple);
 
-/* PyObjectGetAttrStr */
-#if CYTHON_USE_TYPE_SLOTS
-static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject* attr_name) {
-    PyTypeObject* tp = Py_TYPE(obj);
-    if (likely(tp->tp_getattro))
-        return tp->tp_getattro(obj, attr_name);
-#if PY_MAJOR_VERSION < 3
-    if (likely(tp->tp_getattr))
-        return tp->tp_getattr(obj, PyString_AS_STRING(attr_name));
-#endif
-    return PyObject_GetAttr(obj, attr_name);
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
 }
-#endif
 
-/* GetBuiltinName */
-static PyObject *__Pyx_GetBuiltinName(PyObject *name) {
-    PyObject* result = __Pyx_PyObject_GetAttrStr(__pyx_b, name);
-    if (unlikely(!result)) {
-        PyErr_Format(PyExc_NameError,
-#if PY_MAJOR_VERSION >= 3
-            "name '%U' is not defined", name);
-#else
-            "name '%.200s' is not defined", PyString_AS_STRING(name));
-#endif
-    }
-    return result;
-}
+/* "overload/bind.pyx":88
+ * 
+ * 
+ * cdef void destroyMatcher(Matcher matcher):             # <<<<<<<<<<<<<<
+ *     """Destroy a Matcher object."""
+ *     Py_XDECREF(matcher.annotation)
+*/
 
-/* RaiseArgTupleInvalid */
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
+static void __pyx_f_8overload_4bind_destroyMatcher(struct __pyx_t_8overload_4bind_Matcher __pyx_v_matcher) {
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[2]))
+  __Pyx_TraceStartFunc("destroyMatcher", __pyx_f[0], 88, 0, 0, 0, __PYX_ERR(0, 88, __pyx_L1_error));
+
+  /* "overload/bind.pyx":90
+ * cdef void destroyMatcher(Matcher matcher):
+ *     """Destroy a Matcher object."""
+ *     Py_XDECREF(matcher.annotation)             # <<<<<<<<<<<<<<
+ *     Py_XDECREF(matcher.guards)
+ * 
+*/
+  Py_XDECREF(__pyx_v_matcher.annotation);
+
+  /* "overload/bind.pyx":91
+ *     """Destroy a Matcher object."""
+ *     Py_XDECREF(matcher.annotation)
+ *     Py_XDECREF(matcher.guards)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  Py_XDECREF(__pyx_v_matcher.guards);
+
+  /* "overload/bind.pyx":88
+ * 
+ * 
+ * cdef void destroyMatcher(Matcher matcher):             # <<<<<<<<<<<<<<
+ *     """Destroy a Matcher object."""
+ *     Py_XDECREF(matcher.annotation)
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 88, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 88, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.destroyMatcher", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+}
+
+/* "overload/bind.pyx":94
+ * 
+ * 
+ * cdef bint hasTypeBasedInstanceCheck(object metaclass) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `isinstance(obj, cls)` for classes created by `metaclass` only depends on `type(obj)`.
+ *     This holds for the `__instancecheck__` of `type` and of `ABCMeta`, the latter as long as the ABC cache token
+*/
+
+static int __pyx_f_8overload_4bind_hasTypeBasedInstanceCheck(PyObject *__pyx_v_metaclass) {
+  PyObject *__pyx_v_instancecheck = NULL;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  PyObject *__pyx_t_4 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[3]))
+  __Pyx_RefNannySetupContext("hasTypeBasedInstanceCheck", 0);
+  __Pyx_TraceStartFunc("hasTypeBasedInstanceCheck", __pyx_f[0], 94, 0, 0, 0, __PYX_ERR(0, 94, __pyx_L1_error));
+
+  /* "overload/bind.pyx":99
+ *     does not change.
+ *     """
+ *     instancecheck = metaclass.__instancecheck__             # <<<<<<<<<<<<<<
+ *     return instancecheck is type.__instancecheck__ or instancecheck is ABCMeta.__instancecheck__
+ * 
+*/
+  __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_metaclass, __pyx_mstate_global->__pyx_n_u_instancecheck); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 99, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_v_instancecheck = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":100
+ *     """
+ *     instancecheck = metaclass.__instancecheck__
+ *     return instancecheck is type.__instancecheck__ or instancecheck is ABCMeta.__instancecheck__             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_t_1 = __Pyx_PyObject_GetAttrStr(((PyObject *)(&PyType_Type)), __pyx_mstate_global->__pyx_n_u_instancecheck); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 100, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_3 = (__pyx_v_instancecheck == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_3) {
+
+  } else {
+
+    __pyx_t_2 = __pyx_t_3;
+
+    goto __pyx_L3_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_ABCMeta); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 100, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_4 = __Pyx_PyObject_GetAttrStr(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_instancecheck); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 100, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_4);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  __pyx_t_3 = (__pyx_v_instancecheck == __pyx_t_4);
+  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+
+  __pyx_t_2 = __pyx_t_3;
+
+  __pyx_L3_bool_binop_done:;
+  {
+    __pyx_r = __pyx_t_2;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 5, 0, __PYX_ERR(0, 100, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":94
+ * 
+ * 
+ * cdef bint hasTypeBasedInstanceCheck(object metaclass) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `isinstance(obj, cls)` for classes created by `metaclass` only depends on `type(obj)`.
+ *     This holds for the `__instancecheck__` of `type` and of `ABCMeta`, the latter as long as the ABC cache token
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_4);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 94, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.hasTypeBasedInstanceCheck", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+  __Pyx_XDECREF(__pyx_v_instancecheck);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":103
+ * 
+ * 
+ * cdef void compileAnnotation(             # <<<<<<<<<<<<<<
+ *     object annotation, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+static void __pyx_f_8overload_4bind_compileAnnotation(PyObject *__pyx_v_annotation, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, PyObject *__pyx_v_guards, struct __pyx_t_8overload_4bind_ContainerCheck __pyx_v_check) {
+  Py_ssize_t __pyx_v_start;
+  struct __pyx_t_8overload_4bind_Instruction __pyx_v_instruction;
+  PyObject *__pyx_v_origin = NULL;
+  PyObject *__pyx_v_args = NULL;
+  PyObject *__pyx_v_value = NULL;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  PyObject *__pyx_t_2 = NULL;
+  PyObject *__pyx_t_3 = NULL;
+  size_t __pyx_t_4;
+  int __pyx_t_5;
+  int __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  PyObject *(*__pyx_t_8)(PyObject *);
+  int __pyx_t_9;
+  Py_ssize_t __pyx_t_10;
+  PyObject *__pyx_t_11 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[4]))
+  __Pyx_RefNannySetupContext("compileAnnotation", 0);
+  __Pyx_TraceStartFunc("compileAnnotation", __pyx_f[0], 103, 0, 0, 0, __PYX_ERR(0, 103, __pyx_L1_error));
+
+  /* "overload/bind.pyx":114
+ *     Metaclasses of classes that need a call to `isinstance` are appended to `guards`.
+ *     """
+ *     cdef Py_ssize_t start = program.size()             # <<<<<<<<<<<<<<
+ *     cdef Instruction instruction
+ *     instruction.op = OP_ANY
+*/
+  __pyx_v_start = __pyx_v_program.size();
+
+  /* "overload/bind.pyx":116
+ *     cdef Py_ssize_t start = program.size()
+ *     cdef Instruction instruction
+ *     instruction.op = OP_ANY             # <<<<<<<<<<<<<<
+ *     instruction.size = 1
+ *     instruction.count = 0
+*/
+  __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_ANY;
+
+  /* "overload/bind.pyx":117
+ *     cdef Instruction instruction
+ *     instruction.op = OP_ANY
+ *     instruction.size = 1             # <<<<<<<<<<<<<<
+ *     instruction.count = 0
+ *     instruction.value = NULL
+*/
+  __pyx_v_instruction.size = 1;
+
+  /* "overload/bind.pyx":118
+ *     instruction.op = OP_ANY
+ *     instruction.size = 1
+ *     instruction.count = 0             # <<<<<<<<<<<<<<
+ *     instruction.value = NULL
+ * 
+*/
+  __pyx_v_instruction.count = 0;
+
+  /* "overload/bind.pyx":119
+ *     instruction.size = 1
+ *     instruction.count = 0
+ *     instruction.value = NULL             # <<<<<<<<<<<<<<
+ * 
+ *     origin = get_origin(annotation)
+*/
+  __pyx_v_instruction.value = NULL;
+
+  /* "overload/bind.pyx":121
+ *     instruction.value = NULL
+ * 
+ *     origin = get_origin(annotation)             # <<<<<<<<<<<<<<
+ *     args = get_args(annotation)
+ * 
+*/
+  __pyx_t_2 = NULL;
+  __Pyx_GetModuleGlobalName(__pyx_t_3, __pyx_mstate_global->__pyx_n_u_get_origin); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 121, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_3);
+  __pyx_t_4 = 1;
+  #if CYTHON_UNPACK_METHODS
+  if (unlikely(PyMethod_Check(__pyx_t_3))) {
+    __pyx_t_2 = PyMethod_GET_SELF(__pyx_t_3);
+    assert(__pyx_t_2);
+    PyObject* __pyx__function = PyMethod_GET_FUNCTION(__pyx_t_3);
+    __Pyx_INCREF(__pyx_t_2);
+    __Pyx_INCREF(__pyx__function);
+    __Pyx_DECREF_SET(__pyx_t_3, __pyx__function);
+    __pyx_t_4 = 0;
+  }
+  #endif
+  {
+    PyObject *__pyx_callargs[2] = {__pyx_t_2, __pyx_v_annotation};
+    __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)__pyx_t_3, __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+    __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+    if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 121, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+  }
+  __pyx_v_origin = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":122
+ * 
+ *     origin = get_origin(annotation)
+ *     args = get_args(annotation)             # <<<<<<<<<<<<<<
+ * 
+ *     if annotation is _empty or annotation is Any or annotation is object:
+*/
+  __pyx_t_3 = NULL;
+  __Pyx_GetModuleGlobalName(__pyx_t_2, __pyx_mstate_global->__pyx_n_u_get_args); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 122, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_2);
+  __pyx_t_4 = 1;
+  #if CYTHON_UNPACK_METHODS
+  if (unlikely(PyMethod_Check(__pyx_t_2))) {
+    __pyx_t_3 = PyMethod_GET_SELF(__pyx_t_2);
+    assert(__pyx_t_3);
+    PyObject* __pyx__function = PyMethod_GET_FUNCTION(__pyx_t_2);
+    __Pyx_INCREF(__pyx_t_3);
+    __Pyx_INCREF(__pyx__function);
+    __Pyx_DECREF_SET(__pyx_t_2, __pyx__function);
+    __pyx_t_4 = 0;
+  }
+  #endif
+  {
+    PyObject *__pyx_callargs[2] = {__pyx_t_3, __pyx_v_annotation};
+    __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)__pyx_t_2, __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+    __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
+    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+    if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 122, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+  }
+  __pyx_v_args = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":124
+ *     args = get_args(annotation)
+ * 
+ *     if annotation is _empty or annotation is Any or annotation is object:             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *     elif annotation is None or annotation is NoneType:
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_empty); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 124, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Any); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 124, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_builtin_object);
+
+  __pyx_t_5 = __pyx_t_6;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":125
+ * 
+ *     if annotation is _empty or annotation is Any or annotation is object:
+ *         program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *     elif annotation is None or annotation is NoneType:
+ *         instruction.op = OP_TYPE
+*/
+    try {
+      __pyx_v_program.push_back(__pyx_v_instruction);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 125, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":124
+ *     args = get_args(annotation)
+ * 
+ *     if annotation is _empty or annotation is Any or annotation is object:             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *     elif annotation is None or annotation is NoneType:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":126
+ *     if annotation is _empty or annotation is Any or annotation is object:
+ *         program.push_back(instruction)
+ *     elif annotation is None or annotation is NoneType:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_TYPE
+ *         instruction.value = <PyObject*> NoneType
+*/
+  __pyx_t_6 = (__pyx_v_annotation == Py_None);
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L7_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_NoneType); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 126, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_6;
+
+  __pyx_L7_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":127
+ *         program.push_back(instruction)
+ *     elif annotation is None or annotation is NoneType:
+ *         instruction.op = OP_TYPE             # <<<<<<<<<<<<<<
+ *         instruction.value = <PyObject*> NoneType
+ *         program.push_back(instruction)
+*/
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_TYPE;
+
+    /* "overload/bind.pyx":128
+ *     elif annotation is None or annotation is NoneType:
+ *         instruction.op = OP_TYPE
+ *         instruction.value = <PyObject*> NoneType             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *     elif origin is Union or origin is UnionType:
+*/
+    __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_NoneType); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 128, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    __pyx_v_instruction.value = ((PyObject *)__pyx_t_1);
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":129
+ *         instruction.op = OP_TYPE
+ *         instruction.value = <PyObject*> NoneType
+ *         program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *     elif origin is Union or origin is UnionType:
+ *         compileNode(OP_UNION, args, program, guards, check)
+*/
+    try {
+      __pyx_v_program.push_back(__pyx_v_instruction);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 129, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":126
+ *     if annotation is _empty or annotation is Any or annotation is object:
+ *         program.push_back(instruction)
+ *     elif annotation is None or annotation is NoneType:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_TYPE
+ *         instruction.value = <PyObject*> NoneType
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":130
+ *         instruction.value = <PyObject*> NoneType
+ *         program.push_back(instruction)
+ *     elif origin is Union or origin is UnionType:             # <<<<<<<<<<<<<<
+ *         compileNode(OP_UNION, args, program, guards, check)
+ *     elif origin is Literal:
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Union); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 130, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L9_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_UnionType); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 130, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_6;
+
+  __pyx_L9_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":131
+ *         program.push_back(instruction)
+ *     elif origin is Union or origin is UnionType:
+ *         compileNode(OP_UNION, args, program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif origin is Literal:
+ *         instruction.op = OP_UNION
+*/
+    __pyx_t_1 = __pyx_v_args;
+    __Pyx_INCREF(__pyx_t_1);
+    if (!(likely(PyTuple_CheckExact(__pyx_t_1))||((__pyx_t_1) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_1))) __PYX_ERR(0, 131, __pyx_L1_error)
+    __pyx_f_8overload_4bind_compileNode(__pyx_e_8overload_4bind_OP_UNION, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 131, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":130
+ *         instruction.value = <PyObject*> NoneType
+ *         program.push_back(instruction)
+ *     elif origin is Union or origin is UnionType:             # <<<<<<<<<<<<<<
+ *         compileNode(OP_UNION, args, program, guards, check)
+ *     elif origin is Literal:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":132
+ *     elif origin is Union or origin is UnionType:
+ *         compileNode(OP_UNION, args, program, guards, check)
+ *     elif origin is Literal:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(args)
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Literal); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 132, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_5 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":133
+ *         compileNode(OP_UNION, args, program, guards, check)
+ *     elif origin is Literal:
+ *         instruction.op = OP_UNION             # <<<<<<<<<<<<<<
+ *         instruction.count = len(args)
+ *         program.push_back(instruction)
+*/
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_UNION;
+
+    /* "overload/bind.pyx":134
+ *     elif origin is Literal:
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(args)             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *         for value in args:
+*/
+    __pyx_t_7 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1))) __PYX_ERR(0, 134, __pyx_L1_error)
+    __pyx_v_instruction.count = __pyx_t_7;
+
+    /* "overload/bind.pyx":135
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(args)
+ *         program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *         for value in args:
+ *             instruction.op = OP_LITERAL
+*/
+    try {
+      __pyx_v_program.push_back(__pyx_v_instruction);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 135, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":136
+ *         instruction.count = len(args)
+ *         program.push_back(instruction)
+ *         for value in args:             # <<<<<<<<<<<<<<
+ *             instruction.op = OP_LITERAL
+ *             instruction.count = 0
+*/
+    if (likely(PyList_CheckExact(__pyx_v_args)) || PyTuple_CheckExact(__pyx_v_args)) {
+      __pyx_t_1 = __pyx_v_args; __Pyx_INCREF(__pyx_t_1);
+      __pyx_t_7 = 0;
+      __pyx_t_8 = NULL;
+    } else {
+      __pyx_t_7 = -1; __pyx_t_1 = PyObject_GetIter(__pyx_v_args); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 136, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+      __pyx_t_8 = (CYTHON_COMPILING_IN_LIMITED_API) ? PyIter_Next : __Pyx_PyObject_GetIterNextFunc(__pyx_t_1); if (unlikely(!__pyx_t_8)) __PYX_ERR(0, 136, __pyx_L1_error)
+    }
+    for (;;) {
+      if (likely(!__pyx_t_8)) {
+        if (likely(PyList_CheckExact(__pyx_t_1))) {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyList_GET_SIZE(__pyx_t_1);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 136, __pyx_L1_error)
+            #endif
+            if (__pyx_t_7 >= __pyx_temp) break;
+          }
+          __pyx_t_2 = __Pyx_PyList_GET_ITEM_REF(__pyx_t_1, __pyx_t_7, __Pyx_ReferenceSharing_OwnStrongReference);
+          ++__pyx_t_7;
+        } else {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_1);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 136, __pyx_L1_error)
+            #endif
+            if (__pyx_t_7 >= __pyx_temp) break;
+          }
+          #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+          __pyx_t_2 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_1, __pyx_t_7));
+          #else
+          __pyx_t_2 = __Pyx_PySequence_ITEM(__pyx_t_1, __pyx_t_7);
+          #endif
+          ++__pyx_t_7;
+        }
+        if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 136, __pyx_L1_error)
+      } else {
+        __pyx_t_2 = __pyx_t_8(__pyx_t_1);
+        if (unlikely(!__pyx_t_2)) {
+          PyObject* exc_type = PyErr_Occurred();
+          if (exc_type) {
+            if (unlikely(!__Pyx_PyErr_GivenExceptionMatches(exc_type, PyExc_StopIteration))) __PYX_ERR(0, 136, __pyx_L1_error)
+            PyErr_Clear();
+          }
+          break;
+        }
+      }
+      __Pyx_GOTREF(__pyx_t_2);
+      __Pyx_XDECREF_SET(__pyx_v_value, __pyx_t_2);
+      __pyx_t_2 = 0;
+
+      /* "overload/bind.pyx":137
+ *         program.push_back(instruction)
+ *         for value in args:
+ *             instruction.op = OP_LITERAL             # <<<<<<<<<<<<<<
+ *             instruction.count = 0
+ *             instruction.value = <PyObject*> value
+*/
+      __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_LITERAL;
+
+      /* "overload/bind.pyx":138
+ *         for value in args:
+ *             instruction.op = OP_LITERAL
+ *             instruction.count = 0             # <<<<<<<<<<<<<<
+ *             instruction.value = <PyObject*> value
+ *             program.push_back(instruction)
+*/
+      __pyx_v_instruction.count = 0;
+
+      /* "overload/bind.pyx":139
+ *             instruction.op = OP_LITERAL
+ *             instruction.count = 0
+ *             instruction.value = <PyObject*> value             # <<<<<<<<<<<<<<
+ *             program.push_back(instruction)
+ *         program[start].size = program.size() - start
+*/
+      __pyx_v_instruction.value = ((PyObject *)__pyx_v_value);
+
+      /* "overload/bind.pyx":140
+ *             instruction.count = 0
+ *             instruction.value = <PyObject*> value
+ *             program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *         program[start].size = program.size() - start
+ *     elif origin is type:
+*/
+      try {
+        __pyx_v_program.push_back(__pyx_v_instruction);
+      } catch(...) {
+        __Pyx_CppExn2PyErr();
+        __PYX_ERR(0, 140, __pyx_L1_error)
+      }
+
+      /* "overload/bind.pyx":136
+ *         instruction.count = len(args)
+ *         program.push_back(instruction)
+ *         for value in args:             # <<<<<<<<<<<<<<
+ *             instruction.op = OP_LITERAL
+ *             instruction.count = 0
+*/
+    }
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":141
+ *             instruction.value = <PyObject*> value
+ *             program.push_back(instruction)
+ *         program[start].size = program.size() - start             # <<<<<<<<<<<<<<
+ *     elif origin is type:
+ *         compileSubclass(args[0] if args else Any, program, guards)
+*/
+    (__pyx_v_program[__pyx_v_start]).size = (__pyx_v_program.size() - __pyx_v_start);
+
+    /* "overload/bind.pyx":132
+ *     elif origin is Union or origin is UnionType:
+ *         compileNode(OP_UNION, args, program, guards, check)
+ *     elif origin is Literal:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(args)
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":142
+ *             program.push_back(instruction)
+ *         program[start].size = program.size() - start
+ *     elif origin is type:             # <<<<<<<<<<<<<<
+ *         compileSubclass(args[0] if args else Any, program, guards)
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():
+*/
+  __pyx_t_5 = (__pyx_v_origin == ((PyObject *)(&PyType_Type)));
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":143
+ *         program[start].size = program.size() - start
+ *     elif origin is type:
+ *         compileSubclass(args[0] if args else Any, program, guards)             # <<<<<<<<<<<<<<
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+*/
+    __pyx_t_5 = __Pyx_PyObject_IsTrue(__pyx_v_args); if (unlikely((__pyx_t_5 < 0))) __PYX_ERR(0, 143, __pyx_L1_error)
+    if (__pyx_t_5) {
+      __pyx_t_2 = __Pyx_GetItemInt(__pyx_v_args, 0, long, 1, __Pyx_PyLong_From_long, 0, 0, 1, __Pyx_ReferenceSharing_OwnStrongReference); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 143, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_2);
+      __pyx_t_1 = __pyx_t_2;
+      __pyx_t_2 = 0;
+    } else {
+      __Pyx_GetModuleGlobalName(__pyx_t_2, __pyx_mstate_global->__pyx_n_u_Any); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 143, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_2);
+      __pyx_t_1 = __pyx_t_2;
+      __pyx_t_2 = 0;
+    }
+
+    __pyx_f_8overload_4bind_compileSubclass(__pyx_t_1, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 143, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":142
+ *             program.push_back(instruction)
+ *         program[start].size = program.size() - start
+ *     elif origin is type:             # <<<<<<<<<<<<<<
+ *         compileSubclass(args[0] if args else Any, program, guards)
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":144
+ *     elif origin is type:
+ *         compileSubclass(args[0] if args else Any, program, guards)
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():             # <<<<<<<<<<<<<<
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+*/
+  __pyx_t_6 = (__pyx_v_origin == ((PyObject *)(&PyTuple_Type)));
+  if (__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L14_bool_binop_done;
+  }
+  __pyx_t_6 = __Pyx_PyObject_IsTrue(__pyx_v_args); if (unlikely((__pyx_t_6 < 0))) __PYX_ERR(0, 144, __pyx_L1_error)
+  __pyx_t_9 = (!__pyx_t_6);
+
+
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L14_bool_binop_done;
+  }
+  __pyx_t_1 = __Pyx_GetAttr3(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_args, Py_None); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 144, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_9 = __Pyx_PyObject_RichCompareBool(__pyx_t_1, __pyx_mstate_global->__pyx_empty_tuple, Py_EQ); if (unlikely((__pyx_t_9 < 0))) __PYX_ERR(0, 144, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_9;
+
+  __pyx_L14_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":146
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+ *         compileNode(OP_TUPLE, (), program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+*/
+    __pyx_f_8overload_4bind_compileNode(__pyx_e_8overload_4bind_OP_TUPLE, __pyx_mstate_global->__pyx_empty_tuple, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 146, __pyx_L1_error)
+
+    /* "overload/bind.pyx":144
+ *     elif origin is type:
+ *         compileSubclass(args[0] if args else Any, program, guards)
+ *     elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():             # <<<<<<<<<<<<<<
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":147
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:             # <<<<<<<<<<<<<<
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+ *     elif origin is Annotated:
+*/
+  __pyx_t_9 = (__pyx_v_origin == ((PyObject *)(&PyTuple_Type)));
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L17_bool_binop_done;
+  }
+  __pyx_t_9 = __Pyx_PyObject_IsTrue(__pyx_v_args); if (unlikely((__pyx_t_9 < 0))) __PYX_ERR(0, 147, __pyx_L1_error)
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L17_bool_binop_done;
+  }
+  __pyx_t_7 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1))) __PYX_ERR(0, 147, __pyx_L1_error)
+  __pyx_t_10 = (__pyx_t_7 - 1);
+
+
+  __pyx_t_1 = __Pyx_GetItemInt(__pyx_v_args, __pyx_t_10, Py_ssize_t, 1, PyLong_FromSsize_t, 0, 0, 1, __Pyx_ReferenceSharing_OwnStrongReference); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 147, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+
+  __pyx_t_9 = (__pyx_t_1 != __pyx_builtin_Ellipsis);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_9;
+
+  __pyx_L17_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":148
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif origin is Annotated:
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+*/
+    __pyx_t_5 = __Pyx_PyObject_RichCompareBool(__pyx_v_args, __pyx_mstate_global->__pyx_tuple[0], Py_NE); if (unlikely((__pyx_t_5 < 0))) __PYX_ERR(0, 148, __pyx_L1_error)
+    if (__pyx_t_5) {
+      __pyx_t_2 = __pyx_v_args;
+      __Pyx_INCREF(__pyx_t_2);
+      if (!(likely(PyTuple_CheckExact(__pyx_t_2))||((__pyx_t_2) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_2))) __PYX_ERR(0, 148, __pyx_L1_error)
+      __pyx_t_1 = __pyx_t_2;
+      __pyx_t_2 = 0;
+    } else {
+      __Pyx_INCREF(__pyx_mstate_global->__pyx_empty_tuple);
+      __pyx_t_1 = __pyx_mstate_global->__pyx_empty_tuple;
+    }
+
+    __pyx_f_8overload_4bind_compileNode(__pyx_e_8overload_4bind_OP_TUPLE, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 148, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":147
+ *         # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:             # <<<<<<<<<<<<<<
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+ *     elif origin is Annotated:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":149
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+ *     elif origin is Annotated:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Annotated); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 149, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_5 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":150
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+ *     elif origin is Annotated:
+ *         compileAnnotation(annotation.__origin__, program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif isinstance(annotation, TypeVar):
+ *         if annotation.__bound__ is not None:
+*/
+    __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_origin); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 150, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    __pyx_f_8overload_4bind_compileAnnotation(__pyx_t_1, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 150, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":149
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+ *     elif origin is Annotated:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":151
+ *     elif origin is Annotated:
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):             # <<<<<<<<<<<<<<
+ *         if annotation.__bound__ is not None:
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_TypeVar); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 151, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_5 = PyObject_IsInstance(__pyx_v_annotation, __pyx_t_1); if (unlikely(__pyx_t_5 == ((int)-1))) __PYX_ERR(0, 151, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":152
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):
+ *         if annotation.__bound__ is not None:             # <<<<<<<<<<<<<<
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+ *         elif annotation.__constraints__:
+*/
+    __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_bound); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 152, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    __pyx_t_5 = (__pyx_t_1 != Py_None);
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    if (__pyx_t_5) {
+
+
+      /* "overload/bind.pyx":153
+ *     elif isinstance(annotation, TypeVar):
+ *         if annotation.__bound__ is not None:
+ *             compileAnnotation(annotation.__bound__, program, guards, check)             # <<<<<<<<<<<<<<
+ *         elif annotation.__constraints__:
+ *             compileNode(OP_UNION, annotation.__constraints__, program, guards, check)
+*/
+      __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_bound); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 153, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+      __pyx_f_8overload_4bind_compileAnnotation(__pyx_t_1, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 153, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+      /* "overload/bind.pyx":152
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):
+ *         if annotation.__bound__ is not None:             # <<<<<<<<<<<<<<
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+ *         elif annotation.__constraints__:
+*/
+      goto __pyx_L20;
+    }
+
+    /* "overload/bind.pyx":154
+ *         if annotation.__bound__ is not None:
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+ *         elif annotation.__constraints__:             # <<<<<<<<<<<<<<
+ *             compileNode(OP_UNION, annotation.__constraints__, program, guards, check)
+ *         else:
+*/
+    __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_constraints); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 154, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    __pyx_t_5 = __Pyx_PyObject_IsTrue(__pyx_t_1); if (unlikely((__pyx_t_5 < 0))) __PYX_ERR(0, 154, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    if (__pyx_t_5) {
+
+
+      /* "overload/bind.pyx":155
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+ *         elif annotation.__constraints__:
+ *             compileNode(OP_UNION, annotation.__constraints__, program, guards, check)             # <<<<<<<<<<<<<<
+ *         else:
+ *             program.push_back(instruction)
+*/
+      __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_constraints); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 155, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+      if (!(likely(PyTuple_CheckExact(__pyx_t_1))||((__pyx_t_1) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_1))) __PYX_ERR(0, 155, __pyx_L1_error)
+      __pyx_f_8overload_4bind_compileNode(__pyx_e_8overload_4bind_OP_UNION, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 155, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+      /* "overload/bind.pyx":154
+ *         if annotation.__bound__ is not None:
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+ *         elif annotation.__constraints__:             # <<<<<<<<<<<<<<
+ *             compileNode(OP_UNION, annotation.__constraints__, program, guards, check)
+ *         else:
+*/
+      goto __pyx_L20;
+    }
+
+    /* "overload/bind.pyx":157
+ *             compileNode(OP_UNION, annotation.__constraints__, program, guards, check)
+ *         else:
+ *             program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *     elif hasattr(annotation, "__supertype__"):
+ *         # typing.NewType
+*/
+    /*else*/ {
+      try {
+        __pyx_v_program.push_back(__pyx_v_instruction);
+      } catch(...) {
+        __Pyx_CppExn2PyErr();
+        __PYX_ERR(0, 157, __pyx_L1_error)
+      }
+    }
+    __pyx_L20:;
+
+    /* "overload/bind.pyx":151
+ *     elif origin is Annotated:
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+ *     elif isinstance(annotation, TypeVar):             # <<<<<<<<<<<<<<
+ *         if annotation.__bound__ is not None:
+ *             compileAnnotation(annotation.__bound__, program, guards, check)
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":158
+ *         else:
+ *             program.push_back(instruction)
+ *     elif hasattr(annotation, "__supertype__"):             # <<<<<<<<<<<<<<
+ *         # typing.NewType
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+*/
+  __pyx_t_5 = __Pyx_HasAttr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_supertype); if (unlikely(__pyx_t_5 == ((int)-1))) __PYX_ERR(0, 158, __pyx_L1_error)
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":160
+ *     elif hasattr(annotation, "__supertype__"):
+ *         # typing.NewType
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+*/
+    __pyx_t_1 = __Pyx_PyObject_GetAttrStr(__pyx_v_annotation, __pyx_mstate_global->__pyx_n_u_supertype); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 160, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    __pyx_f_8overload_4bind_compileAnnotation(__pyx_t_1, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 160, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":158
+ *         else:
+ *             program.push_back(instruction)
+ *     elif hasattr(annotation, "__supertype__"):             # <<<<<<<<<<<<<<
+ *         # typing.NewType
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":161
+ *         # typing.NewType
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+*/
+  __pyx_t_9 = (__pyx_v_origin == ((PyObject *)(&PyTuple_Type)));
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L21_bool_binop_done;
+  }
+  __pyx_t_10 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_10 == ((Py_ssize_t)-1))) __PYX_ERR(0, 161, __pyx_L1_error)
+  __pyx_t_9 = (__pyx_t_10 == 2);
+
+
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L21_bool_binop_done;
+  }
+  __pyx_t_1 = __Pyx_GetItemInt(__pyx_v_args, 1, long, 1, __Pyx_PyLong_From_long, 0, 0, 1, __Pyx_ReferenceSharing_OwnStrongReference); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 161, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_9 = (__pyx_t_1 == __pyx_builtin_Ellipsis);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_9;
+
+  __pyx_L21_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":162
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+*/
+    __pyx_t_1 = __Pyx_PyObject_GetSlice(__pyx_v_args, 0, 1, NULL, NULL, &__pyx_mstate_global->__pyx_slice[0], 0, 1, 0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 162, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    if (!(likely(PyTuple_CheckExact(__pyx_t_1))||((__pyx_t_1) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_1))) __PYX_ERR(0, 162, __pyx_L1_error)
+    __pyx_f_8overload_4bind_compileContainer(__pyx_e_8overload_4bind_OP_COLLECTION, __pyx_v_origin, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 162, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":161
+ *         # typing.NewType
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":163
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+*/
+  __pyx_t_9 = PyType_Check(__pyx_v_origin); 
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L24_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Mapping); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 163, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_9 = PyObject_IsSubclass(__pyx_v_origin, __pyx_t_1); if (unlikely(__pyx_t_9 == ((int)-1))) __PYX_ERR(0, 163, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L24_bool_binop_done;
+  }
+  __pyx_t_10 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_10 == ((Py_ssize_t)-1))) __PYX_ERR(0, 163, __pyx_L1_error)
+  __pyx_t_9 = (__pyx_t_10 == 2);
+
+
+
+  __pyx_t_5 = __pyx_t_9;
+
+  __pyx_L24_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":164
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+*/
+    __pyx_t_1 = __pyx_v_args;
+    __Pyx_INCREF(__pyx_t_1);
+    if (!(likely(PyTuple_CheckExact(__pyx_t_1))||((__pyx_t_1) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_1))) __PYX_ERR(0, 164, __pyx_L1_error)
+    __pyx_f_8overload_4bind_compileContainer(__pyx_e_8overload_4bind_OP_MAPPING, __pyx_v_origin, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 164, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":163
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":165
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+ *     elif isinstance(origin, type):
+*/
+  __pyx_t_9 = PyType_Check(__pyx_v_origin); 
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L27_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Iterable); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 165, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_9 = PyObject_IsSubclass(__pyx_v_origin, __pyx_t_1); if (unlikely(__pyx_t_9 == ((int)-1))) __PYX_ERR(0, 165, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (__pyx_t_9) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_9;
+
+    goto __pyx_L27_bool_binop_done;
+  }
+  __pyx_t_10 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_10 == ((Py_ssize_t)-1))) __PYX_ERR(0, 165, __pyx_L1_error)
+  __pyx_t_9 = (__pyx_t_10 == 1);
+
+
+
+  __pyx_t_5 = __pyx_t_9;
+
+  __pyx_L27_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":166
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif isinstance(origin, type):
+ *         compileClass(origin, program, guards)
+*/
+    __pyx_t_1 = __pyx_v_args;
+    __Pyx_INCREF(__pyx_t_1);
+    if (!(likely(PyTuple_CheckExact(__pyx_t_1))||((__pyx_t_1) == Py_None) || __Pyx_RaiseUnexpectedTypeError("tuple", __pyx_t_1))) __PYX_ERR(0, 166, __pyx_L1_error)
+    __pyx_f_8overload_4bind_compileContainer(__pyx_e_8overload_4bind_OP_COLLECTION, __pyx_v_origin, ((PyObject*)__pyx_t_1), __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 166, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+    /* "overload/bind.pyx":165
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:             # <<<<<<<<<<<<<<
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+ *     elif isinstance(origin, type):
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":167
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+ *     elif isinstance(origin, type):             # <<<<<<<<<<<<<<
+ *         compileClass(origin, program, guards)
+ *     elif isinstance(annotation, type):
+*/
+  __pyx_t_5 = PyType_Check(__pyx_v_origin); 
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":168
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+ *     elif isinstance(origin, type):
+ *         compileClass(origin, program, guards)             # <<<<<<<<<<<<<<
+ *     elif isinstance(annotation, type):
+ *         compileClass(annotation, program, guards)
+*/
+    __pyx_f_8overload_4bind_compileClass(__pyx_v_origin, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 168, __pyx_L1_error)
+
+    /* "overload/bind.pyx":167
+ *     elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+ *         compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+ *     elif isinstance(origin, type):             # <<<<<<<<<<<<<<
+ *         compileClass(origin, program, guards)
+ *     elif isinstance(annotation, type):
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":169
+ *     elif isinstance(origin, type):
+ *         compileClass(origin, program, guards)
+ *     elif isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *         compileClass(annotation, program, guards)
+ *     else:
+*/
+  __pyx_t_5 = PyType_Check(__pyx_v_annotation); 
+  if (likely(__pyx_t_5)) {
+
+
+    /* "overload/bind.pyx":170
+ *         compileClass(origin, program, guards)
+ *     elif isinstance(annotation, type):
+ *         compileClass(annotation, program, guards)             # <<<<<<<<<<<<<<
+ *     else:
+ *         raise TypeError(f"unsupported annotation: {annotation!r}")
+*/
+    __pyx_f_8overload_4bind_compileClass(__pyx_v_annotation, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 170, __pyx_L1_error)
+
+    /* "overload/bind.pyx":169
+ *     elif isinstance(origin, type):
+ *         compileClass(origin, program, guards)
+ *     elif isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *         compileClass(annotation, program, guards)
+ *     else:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":172
+ *         compileClass(annotation, program, guards)
+ *     else:
+ *         raise TypeError(f"unsupported annotation: {annotation!r}")             # <<<<<<<<<<<<<<
+ * 
+ *     simplifyUnion(program, start)
+*/
+  /*else*/ {
+    __pyx_t_2 = NULL;
+    __pyx_t_3 = __Pyx_PyObject_FormatSimpleAndDecref(PyObject_Repr(__pyx_v_annotation), __pyx_mstate_global->__pyx_empty_unicode); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 172, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __pyx_t_11 = __Pyx_PyUnicode_Concat(__pyx_mstate_global->__pyx_kp_u_unsupported_annotation, __pyx_t_3); if (unlikely(!__pyx_t_11)) __PYX_ERR(0, 172, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_11);
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+    __pyx_t_4 = 1;
+    {
+      PyObject *__pyx_callargs[2] = {__pyx_t_2, __pyx_t_11};
+      __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)(((PyTypeObject*)PyExc_TypeError)), __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+      __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+      __Pyx_DECREF(__pyx_t_11); __pyx_t_11 = 0;
+      if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 172, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+    }
+    __Pyx_Raise(__pyx_t_1, 0, 0, 0);
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    __PYX_ERR(0, 172, __pyx_L1_error)
+  }
+  __pyx_L3:;
+
+  /* "overload/bind.pyx":174
+ *         raise TypeError(f"unsupported annotation: {annotation!r}")
+ * 
+ *     simplifyUnion(program, start)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_f_8overload_4bind_simplifyUnion(__pyx_v_program, __pyx_v_start); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 174, __pyx_L1_error)
+
+  /* "overload/bind.pyx":103
+ * 
+ * 
+ * cdef void compileAnnotation(             # <<<<<<<<<<<<<<
+ *     object annotation, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 103, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_XDECREF(__pyx_t_11);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 103, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.compileAnnotation", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+
+  __Pyx_XDECREF(__pyx_v_origin);
+  __Pyx_XDECREF(__pyx_v_args);
+  __Pyx_XDECREF(__pyx_v_value);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+}
+
+/* "overload/bind.pyx":177
+ * 
+ * 
+ * cdef void compileNode(             # <<<<<<<<<<<<<<
+ *     int op, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+static void __pyx_f_8overload_4bind_compileNode(int __pyx_v_op, PyObject *__pyx_v_children, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, PyObject *__pyx_v_guards, struct __pyx_t_8overload_4bind_ContainerCheck __pyx_v_check) {
+  Py_ssize_t __pyx_v_start;
+  struct __pyx_t_8overload_4bind_Instruction __pyx_v_instruction;
+  PyObject *__pyx_v_child = NULL;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  Py_ssize_t __pyx_t_1;
+  PyObject *__pyx_t_2 = NULL;
+  PyObject *__pyx_t_3 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[5]))
+  __Pyx_RefNannySetupContext("compileNode", 0);
+  __Pyx_TraceStartFunc("compileNode", __pyx_f[0], 177, 0, 0, 0, __PYX_ERR(0, 177, __pyx_L1_error));
+
+  /* "overload/bind.pyx":181
+ * ) except *:
+ *     """Append an instruction with opcode `op`, followed by programs for `children`."""
+ *     cdef Py_ssize_t start = program.size()             # <<<<<<<<<<<<<<
+ *     cdef Instruction instruction
+ *     instruction.op = op
+*/
+  __pyx_v_start = __pyx_v_program.size();
+
+  /* "overload/bind.pyx":183
+ *     cdef Py_ssize_t start = program.size()
+ *     cdef Instruction instruction
+ *     instruction.op = op             # <<<<<<<<<<<<<<
+ *     instruction.size = 1
+ *     instruction.count = len(children)
+*/
+  __pyx_v_instruction.op = __pyx_v_op;
+
+  /* "overload/bind.pyx":184
+ *     cdef Instruction instruction
+ *     instruction.op = op
+ *     instruction.size = 1             # <<<<<<<<<<<<<<
+ *     instruction.count = len(children)
+ *     instruction.value = NULL
+*/
+  __pyx_v_instruction.size = 1;
+
+  /* "overload/bind.pyx":185
+ *     instruction.op = op
+ *     instruction.size = 1
+ *     instruction.count = len(children)             # <<<<<<<<<<<<<<
+ *     instruction.value = NULL
+ *     program.push_back(instruction)
+*/
+  if (unlikely(__pyx_v_children == Py_None)) {
+    PyErr_SetString(PyExc_TypeError, "object of type \047NoneType\047 has no len()");
+    __PYX_ERR(0, 185, __pyx_L1_error)
+  }
+  __pyx_t_1 = __Pyx_PyTuple_GET_SIZE(__pyx_v_children); if (unlikely(__pyx_t_1 == ((Py_ssize_t)-1))) __PYX_ERR(0, 185, __pyx_L1_error)
+  __pyx_v_instruction.count = __pyx_t_1;
+
+  /* "overload/bind.pyx":186
+ *     instruction.size = 1
+ *     instruction.count = len(children)
+ *     instruction.value = NULL             # <<<<<<<<<<<<<<
+ *     program.push_back(instruction)
+ * 
+*/
+  __pyx_v_instruction.value = NULL;
+
+  /* "overload/bind.pyx":187
+ *     instruction.count = len(children)
+ *     instruction.value = NULL
+ *     program.push_back(instruction)             # <<<<<<<<<<<<<<
+ * 
+ *     for child in children:
+*/
+  try {
+    __pyx_v_program.push_back(__pyx_v_instruction);
+  } catch(...) {
+    __Pyx_CppExn2PyErr();
+    __PYX_ERR(0, 187, __pyx_L1_error)
+  }
+
+  /* "overload/bind.pyx":189
+ *     program.push_back(instruction)
+ * 
+ *     for child in children:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(child, program, guards, check)
+ * 
+*/
+  if (unlikely(__pyx_v_children == Py_None)) {
+    PyErr_SetString(PyExc_TypeError, "\047NoneType\047 object is not iterable");
+    __PYX_ERR(0, 189, __pyx_L1_error)
+  }
+  __pyx_t_2 = __pyx_v_children; __Pyx_INCREF(__pyx_t_2);
+  __pyx_t_1 = 0;
+  for (;;) {
+    {
+      Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_2);
+      #if !CYTHON_ASSUME_SAFE_SIZE
+      if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 189, __pyx_L1_error)
+      #endif
+      if (__pyx_t_1 >= __pyx_temp) break;
+    }
+    #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+    __pyx_t_3 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_2, __pyx_t_1));
+    #else
+    __pyx_t_3 = __Pyx_PySequence_ITEM(__pyx_t_2, __pyx_t_1);
+    #endif
+    ++__pyx_t_1;
+    if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 189, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_XDECREF_SET(__pyx_v_child, __pyx_t_3);
+    __pyx_t_3 = 0;
+
+    /* "overload/bind.pyx":190
+ * 
+ *     for child in children:
+ *         compileAnnotation(child, program, guards, check)             # <<<<<<<<<<<<<<
+ * 
+ *     program[start].size = program.size() - start
+*/
+    __pyx_f_8overload_4bind_compileAnnotation(__pyx_v_child, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 190, __pyx_L1_error)
+
+    /* "overload/bind.pyx":189
+ *     program.push_back(instruction)
+ * 
+ *     for child in children:             # <<<<<<<<<<<<<<
+ *         compileAnnotation(child, program, guards, check)
+ * 
+*/
+  }
+  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":192
+ *         compileAnnotation(child, program, guards, check)
+ * 
+ *     program[start].size = program.size() - start             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  (__pyx_v_program[__pyx_v_start]).size = (__pyx_v_program.size() - __pyx_v_start);
+
+  /* "overload/bind.pyx":177
+ * 
+ * 
+ * cdef void compileNode(             # <<<<<<<<<<<<<<
+ *     int op, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 177, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 177, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.compileNode", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+
+  __Pyx_XDECREF(__pyx_v_child);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+}
+
+/* "overload/bind.pyx":195
+ * 
+ * 
+ * cdef void compileContainer(             # <<<<<<<<<<<<<<
+ *     int op, object cls, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+static void __pyx_f_8overload_4bind_compileContainer(int __pyx_v_op, PyObject *__pyx_v_cls, PyObject *__pyx_v_children, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, PyObject *__pyx_v_guards, struct __pyx_t_8overload_4bind_ContainerCheck __pyx_v_check) {
+  Py_ssize_t __pyx_v_start;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction> ::size_type __pyx_v_child;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction> ::size_type __pyx_t_3;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction> ::size_type __pyx_t_4;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction> ::size_type __pyx_t_5;
+  int __pyx_t_6;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[6]))
+  __Pyx_TraceStartFunc("compileContainer", __pyx_f[0], 195, 0, 0, 0, __PYX_ERR(0, 195, __pyx_L1_error));
+
+  /* "overload/bind.pyx":201
+ *     Containers whose elements are never checked become a plain class check.
+ *     """
+ *     cdef Py_ssize_t start = program.size()             # <<<<<<<<<<<<<<
+ * 
+ *     if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):
+*/
+  __pyx_v_start = __pyx_v_program.size();
+
+  /* "overload/bind.pyx":203
+ *     cdef Py_ssize_t start = program.size()
+ * 
+ *     if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):             # <<<<<<<<<<<<<<
+ *         compileClass(cls, program, guards)
+ *         return
+*/
+  __pyx_t_2 = (__pyx_v_check.mode == __pyx_e_8overload_4bind_CHECK_SHALLOW);
+
+  if (!__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_2 = (__pyx_v_check.mode != __pyx_e_8overload_4bind_CHECK_FULL);
+
+  if (__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_2 = (__pyx_v_check.items <= 0);
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":204
+ * 
+ *     if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):
+ *         compileClass(cls, program, guards)             # <<<<<<<<<<<<<<
+ *         return
+ * 
+*/
+    __pyx_f_8overload_4bind_compileClass(__pyx_v_cls, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 204, __pyx_L1_error)
+
+    /* "overload/bind.pyx":205
+ *     if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):
+ *         compileClass(cls, program, guards)
+ *         return             # <<<<<<<<<<<<<<
+ * 
+ *     compileNode(op, children, program, guards, check)
+*/
+    {
+    }
+    __Pyx_TraceReturnValue(Py_None, 25, 0, __PYX_ERR(0, 205, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":203
+ *     cdef Py_ssize_t start = program.size()
+ * 
+ *     if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):             # <<<<<<<<<<<<<<
+ *         compileClass(cls, program, guards)
+ *         return
+*/
+  }
+
+  /* "overload/bind.pyx":207
+ *         return
+ * 
+ *     compileNode(op, children, program, guards, check)             # <<<<<<<<<<<<<<
+ *     for child in range(start + 1, program.size()):
+ *         if program[child].op != OP_ANY:
+*/
+  __pyx_f_8overload_4bind_compileNode(__pyx_v_op, __pyx_v_children, __pyx_v_program, __pyx_v_guards, __pyx_v_check); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 207, __pyx_L1_error)
+
+  /* "overload/bind.pyx":208
+ * 
+ *     compileNode(op, children, program, guards, check)
+ *     for child in range(start + 1, program.size()):             # <<<<<<<<<<<<<<
+ *         if program[child].op != OP_ANY:
+ *             break
+*/
+
+  __pyx_t_3 = __pyx_v_program.size();
+  __pyx_t_4 = __pyx_t_3;
+
+  for (__pyx_t_5 = (__pyx_v_start + 1); __pyx_t_5 < __pyx_t_4; __pyx_t_5+=1) {
+    __pyx_v_child = __pyx_t_5;
+
+    /* "overload/bind.pyx":209
+ *     compileNode(op, children, program, guards, check)
+ *     for child in range(start + 1, program.size()):
+ *         if program[child].op != OP_ANY:             # <<<<<<<<<<<<<<
+ *             break
+ *     else:
+*/
+    __pyx_t_1 = ((__pyx_v_program[__pyx_v_child]).op != __pyx_e_8overload_4bind_OP_ANY);
+
+    if (__pyx_t_1) {
+
+
+      /* "overload/bind.pyx":210
+ *     for child in range(start + 1, program.size()):
+ *         if program[child].op != OP_ANY:
+ *             break             # <<<<<<<<<<<<<<
+ *     else:
+ *         program.resize(start)
+*/
+      goto __pyx_L8_break;
+
+      /* "overload/bind.pyx":209
+ *     compileNode(op, children, program, guards, check)
+ *     for child in range(start + 1, program.size()):
+ *         if program[child].op != OP_ANY:             # <<<<<<<<<<<<<<
+ *             break
+ *     else:
+*/
+    }
+  }
+  /*else*/ {
+
+    /* "overload/bind.pyx":212
+ *             break
+ *     else:
+ *         program.resize(start)             # <<<<<<<<<<<<<<
+ *         compileClass(cls, program, guards)
+ *         return
+*/
+    try {
+      __pyx_v_program.resize(__pyx_v_start);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 212, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":213
+ *     else:
+ *         program.resize(start)
+ *         compileClass(cls, program, guards)             # <<<<<<<<<<<<<<
+ *         return
+ * 
+*/
+    __pyx_f_8overload_4bind_compileClass(__pyx_v_cls, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 213, __pyx_L1_error)
+
+    /* "overload/bind.pyx":214
+ *         program.resize(start)
+ *         compileClass(cls, program, guards)
+ *         return             # <<<<<<<<<<<<<<
+ * 
+ *     program[start].value = <PyObject*> cls
+*/
+    {
+    }
+    __Pyx_TraceReturnValue(Py_None, 60, 0, __PYX_ERR(0, 214, __pyx_L1_error));
+    goto __pyx_L0;
+  }
+  __pyx_L8_break:;
+
+
+  /* "overload/bind.pyx":216
+ *         return
+ * 
+ *     program[start].value = <PyObject*> cls             # <<<<<<<<<<<<<<
+ *     program[start].check = check
+ *     if type(cls) is not type and type(cls) not in guards:
+*/
+  (__pyx_v_program[__pyx_v_start]).value = ((PyObject *)__pyx_v_cls);
+
+  /* "overload/bind.pyx":217
+ * 
+ *     program[start].value = <PyObject*> cls
+ *     program[start].check = check             # <<<<<<<<<<<<<<
+ *     if type(cls) is not type and type(cls) not in guards:
+ *         guards.append(type(cls))
+*/
+  (__pyx_v_program[__pyx_v_start]).check = __pyx_v_check;
+
+  /* "overload/bind.pyx":218
+ *     program[start].value = <PyObject*> cls
+ *     program[start].check = check
+ *     if type(cls) is not type and type(cls) not in guards:             # <<<<<<<<<<<<<<
+ *         guards.append(type(cls))
+ * 
+*/
+  __pyx_t_2 = (((PyObject *)Py_TYPE(__pyx_v_cls)) != ((PyObject *)(&PyType_Type)));
+  if (__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L11_bool_binop_done;
+  }
+  __pyx_t_2 = (__Pyx_PySequence_ContainsTF(((PyObject *)Py_TYPE(__pyx_v_cls)), __pyx_v_guards, Py_NE)); if (unlikely((__pyx_t_2 < 0))) __PYX_ERR(0, 218, __pyx_L1_error)
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L11_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":219
+ *     program[start].check = check
+ *     if type(cls) is not type and type(cls) not in guards:
+ *         guards.append(type(cls))             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+    if (unlikely(__pyx_v_guards == Py_None)) {
+      PyErr_Format(PyExc_AttributeError, "\047NoneType\047 object has no attribute \047%.30s\047", "append");
+      __PYX_ERR(0, 219, __pyx_L1_error)
+    }
+    __pyx_t_6 = __Pyx_PyList_Append(__pyx_v_guards, ((PyObject *)Py_TYPE(__pyx_v_cls))); if (unlikely(__pyx_t_6 == ((int)-1))) __PYX_ERR(0, 219, __pyx_L1_error)
+
+
+    /* "overload/bind.pyx":218
+ *     program[start].value = <PyObject*> cls
+ *     program[start].check = check
+ *     if type(cls) is not type and type(cls) not in guards:             # <<<<<<<<<<<<<<
+ *         guards.append(type(cls))
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":195
+ * 
+ * 
+ * cdef void compileContainer(             # <<<<<<<<<<<<<<
+ *     int op, object cls, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+ * ) except *:
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 195, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 195, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.compileContainer", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+}
+
+/* "overload/bind.pyx":222
+ * 
+ * 
+ * cdef void compileClass(object cls, vector[Instruction]& program, list guards) except *:             # <<<<<<<<<<<<<<
+ *     """Append an instruction that checks if the argument is an instance of `cls`."""
+ *     cdef Instruction instruction
+*/
+
+static void __pyx_f_8overload_4bind_compileClass(PyObject *__pyx_v_cls, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, PyObject *__pyx_v_guards) {
+  struct __pyx_t_8overload_4bind_Instruction __pyx_v_instruction;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[7]))
+  __Pyx_TraceStartFunc("compileClass", __pyx_f[0], 222, 0, 0, 0, __PYX_ERR(0, 222, __pyx_L1_error));
+
+  /* "overload/bind.pyx":225
+ *     """Append an instruction that checks if the argument is an instance of `cls`."""
+ *     cdef Instruction instruction
+ *     instruction.size = 1             # <<<<<<<<<<<<<<
+ *     instruction.count = 0
+ *     instruction.value = <PyObject*> cls
+*/
+  __pyx_v_instruction.size = 1;
+
+  /* "overload/bind.pyx":226
+ *     cdef Instruction instruction
+ *     instruction.size = 1
+ *     instruction.count = 0             # <<<<<<<<<<<<<<
+ *     instruction.value = <PyObject*> cls
+ * 
+*/
+  __pyx_v_instruction.count = 0;
+
+  /* "overload/bind.pyx":227
+ *     instruction.size = 1
+ *     instruction.count = 0
+ *     instruction.value = <PyObject*> cls             # <<<<<<<<<<<<<<
+ * 
+ *     if cls is object:
+*/
+  __pyx_v_instruction.value = ((PyObject *)__pyx_v_cls);
+
+  /* "overload/bind.pyx":229
+ *     instruction.value = <PyObject*> cls
+ * 
+ *     if cls is object:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_ANY
+ *     elif type(cls) is type:
+*/
+  __pyx_t_1 = (__pyx_v_cls == __pyx_builtin_object);
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":230
+ * 
+ *     if cls is object:
+ *         instruction.op = OP_ANY             # <<<<<<<<<<<<<<
+ *     elif type(cls) is type:
+ *         instruction.op = OP_TYPE
+*/
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_ANY;
+
+    /* "overload/bind.pyx":229
+ *     instruction.value = <PyObject*> cls
+ * 
+ *     if cls is object:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_ANY
+ *     elif type(cls) is type:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":231
+ *     if cls is object:
+ *         instruction.op = OP_ANY
+ *     elif type(cls) is type:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_TYPE
+ *     else:
+*/
+  __pyx_t_1 = (((PyObject *)Py_TYPE(__pyx_v_cls)) == ((PyObject *)(&PyType_Type)));
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":232
+ *         instruction.op = OP_ANY
+ *     elif type(cls) is type:
+ *         instruction.op = OP_TYPE             # <<<<<<<<<<<<<<
+ *     else:
+ *         instruction.op = OP_INSTANCE
+*/
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_TYPE;
+
+    /* "overload/bind.pyx":231
+ *     if cls is object:
+ *         instruction.op = OP_ANY
+ *     elif type(cls) is type:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_TYPE
+ *     else:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":234
+ *         instruction.op = OP_TYPE
+ *     else:
+ *         instruction.op = OP_INSTANCE             # <<<<<<<<<<<<<<
+ *         if type(cls) not in guards:
+ *             guards.append(type(cls))
+*/
+  /*else*/ {
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_INSTANCE;
+
+    /* "overload/bind.pyx":235
+ *     else:
+ *         instruction.op = OP_INSTANCE
+ *         if type(cls) not in guards:             # <<<<<<<<<<<<<<
+ *             guards.append(type(cls))
+ * 
+*/
+    __pyx_t_1 = (__Pyx_PySequence_ContainsTF(((PyObject *)Py_TYPE(__pyx_v_cls)), __pyx_v_guards, Py_NE)); if (unlikely((__pyx_t_1 < 0))) __PYX_ERR(0, 235, __pyx_L1_error)
+    if (__pyx_t_1) {
+
+
+      /* "overload/bind.pyx":236
+ *         instruction.op = OP_INSTANCE
+ *         if type(cls) not in guards:
+ *             guards.append(type(cls))             # <<<<<<<<<<<<<<
+ * 
+ *     program.push_back(instruction)
+*/
+      if (unlikely(__pyx_v_guards == Py_None)) {
+        PyErr_Format(PyExc_AttributeError, "\047NoneType\047 object has no attribute \047%.30s\047", "append");
+        __PYX_ERR(0, 236, __pyx_L1_error)
+      }
+      __pyx_t_2 = __Pyx_PyList_Append(__pyx_v_guards, ((PyObject *)Py_TYPE(__pyx_v_cls))); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 236, __pyx_L1_error)
+
+
+      /* "overload/bind.pyx":235
+ *     else:
+ *         instruction.op = OP_INSTANCE
+ *         if type(cls) not in guards:             # <<<<<<<<<<<<<<
+ *             guards.append(type(cls))
+ * 
+*/
+    }
+  }
+  __pyx_L3:;
+
+  /* "overload/bind.pyx":238
+ *             guards.append(type(cls))
+ * 
+ *     program.push_back(instruction)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  try {
+    __pyx_v_program.push_back(__pyx_v_instruction);
+  } catch(...) {
+    __Pyx_CppExn2PyErr();
+    __PYX_ERR(0, 238, __pyx_L1_error)
+  }
+
+  /* "overload/bind.pyx":222
+ * 
+ * 
+ * cdef void compileClass(object cls, vector[Instruction]& program, list guards) except *:             # <<<<<<<<<<<<<<
+ *     """Append an instruction that checks if the argument is an instance of `cls`."""
+ *     cdef Instruction instruction
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 222, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 222, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.compileClass", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+}
+
+/* "overload/bind.pyx":241
+ * 
+ * 
+ * cdef void compileSubclass(object annotation, vector[Instruction]& program, list guards) except *:             # <<<<<<<<<<<<<<
+ *     """Append a program for `Type[annotation]`."""
+ *     cdef Instruction instruction
+*/
+
+static void __pyx_f_8overload_4bind_compileSubclass(PyObject *__pyx_v_annotation, std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, PyObject *__pyx_v_guards) {
+  struct __pyx_t_8overload_4bind_Instruction __pyx_v_instruction;
+  PyObject *__pyx_v_origin = NULL;
+  std::vector<struct __pyx_t_8overload_4bind_Instruction> ::size_type __pyx_v_start;
+  PyObject *__pyx_v_arg = NULL;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  PyObject *__pyx_t_2 = NULL;
+  PyObject *__pyx_t_3 = NULL;
+  size_t __pyx_t_4;
+  int __pyx_t_5;
+  int __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  PyObject *(*__pyx_t_8)(PyObject *);
+  PyObject *__pyx_t_9[3];
+  int __pyx_t_10;
+  PyObject *__pyx_t_11 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[8]))
+  __Pyx_RefNannySetupContext("compileSubclass", 0);
+  __Pyx_TraceStartFunc("compileSubclass", __pyx_f[0], 241, 0, 0, 0, __PYX_ERR(0, 241, __pyx_L1_error));
+
+  /* "overload/bind.pyx":244
+ *     """Append a program for `Type[annotation]`."""
+ *     cdef Instruction instruction
+ *     instruction.op = OP_SUBCLASS             # <<<<<<<<<<<<<<
+ *     instruction.size = 1
+ *     instruction.count = 0
+*/
+  __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_SUBCLASS;
+
+  /* "overload/bind.pyx":245
+ *     cdef Instruction instruction
+ *     instruction.op = OP_SUBCLASS
+ *     instruction.size = 1             # <<<<<<<<<<<<<<
+ *     instruction.count = 0
+ *     instruction.value = <PyObject*> annotation
+*/
+  __pyx_v_instruction.size = 1;
+
+  /* "overload/bind.pyx":246
+ *     instruction.op = OP_SUBCLASS
+ *     instruction.size = 1
+ *     instruction.count = 0             # <<<<<<<<<<<<<<
+ *     instruction.value = <PyObject*> annotation
+ * 
+*/
+  __pyx_v_instruction.count = 0;
+
+  /* "overload/bind.pyx":247
+ *     instruction.size = 1
+ *     instruction.count = 0
+ *     instruction.value = <PyObject*> annotation             # <<<<<<<<<<<<<<
+ * 
+ *     origin = get_origin(annotation)
+*/
+  __pyx_v_instruction.value = ((PyObject *)__pyx_v_annotation);
+
+  /* "overload/bind.pyx":249
+ *     instruction.value = <PyObject*> annotation
+ * 
+ *     origin = get_origin(annotation)             # <<<<<<<<<<<<<<
+ * 
+ *     if annotation is Any or annotation is object:
+*/
+  __pyx_t_2 = NULL;
+  __Pyx_GetModuleGlobalName(__pyx_t_3, __pyx_mstate_global->__pyx_n_u_get_origin); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 249, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_3);
+  __pyx_t_4 = 1;
+  #if CYTHON_UNPACK_METHODS
+  if (unlikely(PyMethod_Check(__pyx_t_3))) {
+    __pyx_t_2 = PyMethod_GET_SELF(__pyx_t_3);
+    assert(__pyx_t_2);
+    PyObject* __pyx__function = PyMethod_GET_FUNCTION(__pyx_t_3);
+    __Pyx_INCREF(__pyx_t_2);
+    __Pyx_INCREF(__pyx__function);
+    __Pyx_DECREF_SET(__pyx_t_3, __pyx__function);
+    __pyx_t_4 = 0;
+  }
+  #endif
+  {
+    PyObject *__pyx_callargs[2] = {__pyx_t_2, __pyx_v_annotation};
+    __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)__pyx_t_3, __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+    __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+    if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 249, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+  }
+  __pyx_v_origin = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":251
+ *     origin = get_origin(annotation)
+ * 
+ *     if annotation is Any or annotation is object:             # <<<<<<<<<<<<<<
+ *         compileClass(type, program, guards)
+ *     elif origin is Union or origin is UnionType:
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Any); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 251, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_6 = (__pyx_v_annotation == __pyx_builtin_object);
+
+  __pyx_t_5 = __pyx_t_6;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":252
+ * 
+ *     if annotation is Any or annotation is object:
+ *         compileClass(type, program, guards)             # <<<<<<<<<<<<<<
+ *     elif origin is Union or origin is UnionType:
+ *         instruction.op = OP_UNION
+*/
+    __pyx_f_8overload_4bind_compileClass(((PyObject *)(&PyType_Type)), __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 252, __pyx_L1_error)
+
+    /* "overload/bind.pyx":251
+ *     origin = get_origin(annotation)
+ * 
+ *     if annotation is Any or annotation is object:             # <<<<<<<<<<<<<<
+ *         compileClass(type, program, guards)
+ *     elif origin is Union or origin is UnionType:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":253
+ *     if annotation is Any or annotation is object:
+ *         compileClass(type, program, guards)
+ *     elif origin is Union or origin is UnionType:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(get_args(annotation))
+*/
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_Union); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 253, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  if (!__pyx_t_6) {
+
+  } else {
+
+    __pyx_t_5 = __pyx_t_6;
+
+    goto __pyx_L6_bool_binop_done;
+  }
+  __Pyx_GetModuleGlobalName(__pyx_t_1, __pyx_mstate_global->__pyx_n_u_UnionType); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 253, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_t_6 = (__pyx_v_origin == __pyx_t_1);
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  __pyx_t_5 = __pyx_t_6;
+
+  __pyx_L6_bool_binop_done:;
+  if (__pyx_t_5) {
+
+
+    /* "overload/bind.pyx":254
+ *         compileClass(type, program, guards)
+ *     elif origin is Union or origin is UnionType:
+ *         instruction.op = OP_UNION             # <<<<<<<<<<<<<<
+ *         instruction.count = len(get_args(annotation))
+ *         instruction.value = NULL
+*/
+    __pyx_v_instruction.op = __pyx_e_8overload_4bind_OP_UNION;
+
+    /* "overload/bind.pyx":255
+ *     elif origin is Union or origin is UnionType:
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(get_args(annotation))             # <<<<<<<<<<<<<<
+ *         instruction.value = NULL
+ *         start = program.size()
+*/
+    __pyx_t_3 = NULL;
+    __Pyx_GetModuleGlobalName(__pyx_t_2, __pyx_mstate_global->__pyx_n_u_get_args); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 255, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_2);
+    __pyx_t_4 = 1;
+    #if CYTHON_UNPACK_METHODS
+    if (unlikely(PyMethod_Check(__pyx_t_2))) {
+      __pyx_t_3 = PyMethod_GET_SELF(__pyx_t_2);
+      assert(__pyx_t_3);
+      PyObject* __pyx__function = PyMethod_GET_FUNCTION(__pyx_t_2);
+      __Pyx_INCREF(__pyx_t_3);
+      __Pyx_INCREF(__pyx__function);
+      __Pyx_DECREF_SET(__pyx_t_2, __pyx__function);
+      __pyx_t_4 = 0;
+    }
+    #endif
+    {
+      PyObject *__pyx_callargs[2] = {__pyx_t_3, __pyx_v_annotation};
+      __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)__pyx_t_2, __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+      __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
+      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+      if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 255, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+    }
+    __pyx_t_7 = PyObject_Length(__pyx_t_1); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1))) __PYX_ERR(0, 255, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    __pyx_v_instruction.count = __pyx_t_7;
+
+    /* "overload/bind.pyx":256
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(get_args(annotation))
+ *         instruction.value = NULL             # <<<<<<<<<<<<<<
+ *         start = program.size()
+ *         program.push_back(instruction)
+*/
+    __pyx_v_instruction.value = NULL;
+
+    /* "overload/bind.pyx":257
+ *         instruction.count = len(get_args(annotation))
+ *         instruction.value = NULL
+ *         start = program.size()             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *         for arg in get_args(annotation):
+*/
+    __pyx_v_start = __pyx_v_program.size();
+
+    /* "overload/bind.pyx":258
+ *         instruction.value = NULL
+ *         start = program.size()
+ *         program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *         for arg in get_args(annotation):
+ *             compileSubclass(arg, program, guards)
+*/
+    try {
+      __pyx_v_program.push_back(__pyx_v_instruction);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 258, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":259
+ *         start = program.size()
+ *         program.push_back(instruction)
+ *         for arg in get_args(annotation):             # <<<<<<<<<<<<<<
+ *             compileSubclass(arg, program, guards)
+ *         program[start].size = program.size() - start
+*/
+    __pyx_t_2 = NULL;
+    __Pyx_GetModuleGlobalName(__pyx_t_3, __pyx_mstate_global->__pyx_n_u_get_args); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 259, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __pyx_t_4 = 1;
+    #if CYTHON_UNPACK_METHODS
+    if (unlikely(PyMethod_Check(__pyx_t_3))) {
+      __pyx_t_2 = PyMethod_GET_SELF(__pyx_t_3);
+      assert(__pyx_t_2);
+      PyObject* __pyx__function = PyMethod_GET_FUNCTION(__pyx_t_3);
+      __Pyx_INCREF(__pyx_t_2);
+      __Pyx_INCREF(__pyx__function);
+      __Pyx_DECREF_SET(__pyx_t_3, __pyx__function);
+      __pyx_t_4 = 0;
+    }
+    #endif
+    {
+      PyObject *__pyx_callargs[2] = {__pyx_t_2, __pyx_v_annotation};
+      __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)__pyx_t_3, __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+      __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+      __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+      if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 259, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+    }
+    if (likely(PyList_CheckExact(__pyx_t_1)) || PyTuple_CheckExact(__pyx_t_1)) {
+      __pyx_t_3 = __pyx_t_1; __Pyx_INCREF(__pyx_t_3);
+      __pyx_t_7 = 0;
+      __pyx_t_8 = NULL;
+    } else {
+      __pyx_t_7 = -1; __pyx_t_3 = PyObject_GetIter(__pyx_t_1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 259, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_3);
+      __pyx_t_8 = (CYTHON_COMPILING_IN_LIMITED_API) ? PyIter_Next : __Pyx_PyObject_GetIterNextFunc(__pyx_t_3); if (unlikely(!__pyx_t_8)) __PYX_ERR(0, 259, __pyx_L1_error)
+    }
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    for (;;) {
+      if (likely(!__pyx_t_8)) {
+        if (likely(PyList_CheckExact(__pyx_t_3))) {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyList_GET_SIZE(__pyx_t_3);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 259, __pyx_L1_error)
+            #endif
+            if (__pyx_t_7 >= __pyx_temp) break;
+          }
+          __pyx_t_1 = __Pyx_PyList_GET_ITEM_REF(__pyx_t_3, __pyx_t_7, __Pyx_ReferenceSharing_OwnStrongReference);
+          ++__pyx_t_7;
+        } else {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_3);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 259, __pyx_L1_error)
+            #endif
+            if (__pyx_t_7 >= __pyx_temp) break;
+          }
+          #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+          __pyx_t_1 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_3, __pyx_t_7));
+          #else
+          __pyx_t_1 = __Pyx_PySequence_ITEM(__pyx_t_3, __pyx_t_7);
+          #endif
+          ++__pyx_t_7;
+        }
+        if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 259, __pyx_L1_error)
+      } else {
+        __pyx_t_1 = __pyx_t_8(__pyx_t_3);
+        if (unlikely(!__pyx_t_1)) {
+          PyObject* exc_type = PyErr_Occurred();
+          if (exc_type) {
+            if (unlikely(!__Pyx_PyErr_GivenExceptionMatches(exc_type, PyExc_StopIteration))) __PYX_ERR(0, 259, __pyx_L1_error)
+            PyErr_Clear();
+          }
+          break;
+        }
+      }
+      __Pyx_GOTREF(__pyx_t_1);
+      __Pyx_XDECREF_SET(__pyx_v_arg, __pyx_t_1);
+      __pyx_t_1 = 0;
+
+      /* "overload/bind.pyx":260
+ *         program.push_back(instruction)
+ *         for arg in get_args(annotation):
+ *             compileSubclass(arg, program, guards)             # <<<<<<<<<<<<<<
+ *         program[start].size = program.size() - start
+ *     elif isinstance(annotation, type):
+*/
+      __pyx_f_8overload_4bind_compileSubclass(__pyx_v_arg, __pyx_v_program, __pyx_v_guards); if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 260, __pyx_L1_error)
+
+      /* "overload/bind.pyx":259
+ *         start = program.size()
+ *         program.push_back(instruction)
+ *         for arg in get_args(annotation):             # <<<<<<<<<<<<<<
+ *             compileSubclass(arg, program, guards)
+ *         program[start].size = program.size() - start
+*/
+    }
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+
+    /* "overload/bind.pyx":261
+ *         for arg in get_args(annotation):
+ *             compileSubclass(arg, program, guards)
+ *         program[start].size = program.size() - start             # <<<<<<<<<<<<<<
+ *     elif isinstance(annotation, type):
+ *         program.push_back(instruction)
+*/
+    (__pyx_v_program[__pyx_v_start]).size = (__pyx_v_program.size() - __pyx_v_start);
+
+    /* "overload/bind.pyx":253
+ *     if annotation is Any or annotation is object:
+ *         compileClass(type, program, guards)
+ *     elif origin is Union or origin is UnionType:             # <<<<<<<<<<<<<<
+ *         instruction.op = OP_UNION
+ *         instruction.count = len(get_args(annotation))
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":262
+ *             compileSubclass(arg, program, guards)
+ *         program[start].size = program.size() - start
+ *     elif isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *     else:
+*/
+  __pyx_t_5 = PyType_Check(__pyx_v_annotation); 
+  if (likely(__pyx_t_5)) {
+
+
+    /* "overload/bind.pyx":263
+ *         program[start].size = program.size() - start
+ *     elif isinstance(annotation, type):
+ *         program.push_back(instruction)             # <<<<<<<<<<<<<<
+ *     else:
+ *         raise TypeError(f"unsupported annotation: Type[{annotation!r}]")
+*/
+    try {
+      __pyx_v_program.push_back(__pyx_v_instruction);
+    } catch(...) {
+      __Pyx_CppExn2PyErr();
+      __PYX_ERR(0, 263, __pyx_L1_error)
+    }
+
+    /* "overload/bind.pyx":262
+ *             compileSubclass(arg, program, guards)
+ *         program[start].size = program.size() - start
+ *     elif isinstance(annotation, type):             # <<<<<<<<<<<<<<
+ *         program.push_back(instruction)
+ *     else:
+*/
+    goto __pyx_L3;
+  }
+
+  /* "overload/bind.pyx":265
+ *         program.push_back(instruction)
+ *     else:
+ *         raise TypeError(f"unsupported annotation: Type[{annotation!r}]")             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  /*else*/ {
+    __pyx_t_1 = NULL;
+    __pyx_t_2 = __Pyx_PyObject_FormatSimpleAndDecref(PyObject_Repr(__pyx_v_annotation), __pyx_mstate_global->__pyx_empty_unicode); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 265, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_2);
+    __pyx_t_9[0] = __pyx_mstate_global->__pyx_kp_u_unsupported_annotation_Type;
+    __pyx_t_9[1] = __pyx_t_2;
+    __pyx_t_9[2] = __pyx_mstate_global->__pyx_kp_u__2;
+    __pyx_t_7 = 30;
+    #if __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH
+    __pyx_t_7 += __Pyx_PyUnicode_GET_LENGTH(__pyx_t_9[1]);
+    #endif
+    __pyx_t_10 = 0;
+    #if __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH
+    __pyx_t_10 |= __Pyx_PyUnicode_KIND_04(__pyx_t_9[1]);
+    #endif
+    __pyx_t_11 = __Pyx_PyUnicode_Join(__pyx_t_9, 3, __pyx_t_7, __pyx_t_10);
+    if (unlikely(!__pyx_t_11)) __PYX_ERR(0, 265, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_11);
+    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+    __pyx_t_4 = 1;
+    {
+      PyObject *__pyx_callargs[2] = {__pyx_t_1, __pyx_t_11};
+      __pyx_t_3 = __Pyx_PyObject_FastCall((PyObject*)(((PyTypeObject*)PyExc_TypeError)), __pyx_callargs+__pyx_t_4, (2-__pyx_t_4) | (__pyx_t_4*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+      __Pyx_XDECREF(__pyx_t_1); __pyx_t_1 = 0;
+      __Pyx_DECREF(__pyx_t_11); __pyx_t_11 = 0;
+      if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 265, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_3);
+    }
+    __Pyx_Raise(__pyx_t_3, 0, 0, 0);
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+    __PYX_ERR(0, 265, __pyx_L1_error)
+  }
+  __pyx_L3:;
+
+  /* "overload/bind.pyx":241
+ * 
+ * 
+ * cdef void compileSubclass(object annotation, vector[Instruction]& program, list guards) except *:             # <<<<<<<<<<<<<<
+ *     """Append a program for `Type[annotation]`."""
+ *     cdef Instruction instruction
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 241, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_XDECREF(__pyx_t_11);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 241, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.compileSubclass", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+  __Pyx_XDECREF(__pyx_v_origin);
+
+  __Pyx_XDECREF(__pyx_v_arg);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+}
+
+/* "overload/bind.pyx":268
+ * 
+ * 
+ * cdef void simplifyUnion(vector[Instruction]& program, Py_ssize_t start):             # <<<<<<<<<<<<<<
+ *     """Replace a union at `start` that has an `Any` alternative with a single `Any`."""
+ *     cdef Py_ssize_t child
+*/
+
+static void __pyx_f_8overload_4bind_simplifyUnion(std::vector<struct __pyx_t_8overload_4bind_Instruction>  &__pyx_v_program, Py_ssize_t __pyx_v_start) {
+  Py_ssize_t __pyx_v_child;
+  CYTHON_UNUSED Py_ssize_t __pyx_v__;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  Py_ssize_t __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[9]))
+  __Pyx_TraceStartFunc("simplifyUnion", __pyx_f[0], 268, 0, 0, 0, __PYX_ERR(0, 268, __pyx_L1_error));
+
+  /* "overload/bind.pyx":272
+ *     cdef Py_ssize_t child
+ * 
+ *     if program[start].op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return
+ * 
+*/
+  __pyx_t_1 = ((__pyx_v_program[__pyx_v_start]).op != __pyx_e_8overload_4bind_OP_UNION);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":273
+ * 
+ *     if program[start].op != OP_UNION:
+ *         return             # <<<<<<<<<<<<<<
+ * 
+ *     child = start + 1
+*/
+    {
+    }
+    __Pyx_TraceReturnValue(Py_None, 8, 0, __PYX_ERR(0, 273, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":272
+ *     cdef Py_ssize_t child
+ * 
+ *     if program[start].op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":275
+ *         return
+ * 
+ *     child = start + 1             # <<<<<<<<<<<<<<
+ *     for _ in range(program[start].count):
+ *         if program[child].op == OP_ANY:
+*/
+  __pyx_v_child = (__pyx_v_start + 1);
+
+  /* "overload/bind.pyx":276
+ * 
+ *     child = start + 1
+ *     for _ in range(program[start].count):             # <<<<<<<<<<<<<<
+ *         if program[child].op == OP_ANY:
+ *             program.resize(start + 1)
+*/
+
+  __pyx_t_2 = (__pyx_v_program[__pyx_v_start]).count;
+  __pyx_t_3 = __pyx_t_2;
+
+  for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_t_3; __pyx_t_4+=1) {
+    __pyx_v__ = __pyx_t_4;
+
+    /* "overload/bind.pyx":277
+ *     child = start + 1
+ *     for _ in range(program[start].count):
+ *         if program[child].op == OP_ANY:             # <<<<<<<<<<<<<<
+ *             program.resize(start + 1)
+ *             program[start].op = OP_ANY
+*/
+    __pyx_t_1 = ((__pyx_v_program[__pyx_v_child]).op == __pyx_e_8overload_4bind_OP_ANY);
+
+    if (__pyx_t_1) {
+
+
+      /* "overload/bind.pyx":278
+ *     for _ in range(program[start].count):
+ *         if program[child].op == OP_ANY:
+ *             program.resize(start + 1)             # <<<<<<<<<<<<<<
+ *             program[start].op = OP_ANY
+ *             program[start].size = 1
+*/
+      try {
+        __pyx_v_program.resize((__pyx_v_start + 1));
+      } catch(...) {
+        __Pyx_CppExn2PyErr();
+        __PYX_ERR(0, 278, __pyx_L1_error)
+      }
+
+      /* "overload/bind.pyx":279
+ *         if program[child].op == OP_ANY:
+ *             program.resize(start + 1)
+ *             program[start].op = OP_ANY             # <<<<<<<<<<<<<<
+ *             program[start].size = 1
+ *             program[start].count = 0
+*/
+      (__pyx_v_program[__pyx_v_start]).op = __pyx_e_8overload_4bind_OP_ANY;
+
+      /* "overload/bind.pyx":280
+ *             program.resize(start + 1)
+ *             program[start].op = OP_ANY
+ *             program[start].size = 1             # <<<<<<<<<<<<<<
+ *             program[start].count = 0
+ *             return
+*/
+      (__pyx_v_program[__pyx_v_start]).size = 1;
+
+      /* "overload/bind.pyx":281
+ *             program[start].op = OP_ANY
+ *             program[start].size = 1
+ *             program[start].count = 0             # <<<<<<<<<<<<<<
+ *             return
+ *         child += program[child].size
+*/
+      (__pyx_v_program[__pyx_v_start]).count = 0;
+
+      /* "overload/bind.pyx":282
+ *             program[start].size = 1
+ *             program[start].count = 0
+ *             return             # <<<<<<<<<<<<<<
+ *         child += program[child].size
+ * 
+*/
+      {
+      }
+      __Pyx_TraceReturnValue(Py_None, 49, 0, __PYX_ERR(0, 282, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":277
+ *     child = start + 1
+ *     for _ in range(program[start].count):
+ *         if program[child].op == OP_ANY:             # <<<<<<<<<<<<<<
+ *             program.resize(start + 1)
+ *             program[start].op = OP_ANY
+*/
+    }
+
+    /* "overload/bind.pyx":283
+ *             program[start].count = 0
+ *             return
+ *         child += program[child].size             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + (__pyx_v_program[__pyx_v_child]).size);
+  }
+
+
+  /* "overload/bind.pyx":268
+ * 
+ * 
+ * cdef void simplifyUnion(vector[Instruction]& program, Py_ssize_t start):             # <<<<<<<<<<<<<<
+ *     """Replace a union at `start` that has an `Any` alternative with a single `Any`."""
+ *     cdef Py_ssize_t child
+*/
+
+  /* function exit code */
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 268, __pyx_L1_error));
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 268, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.simplifyUnion", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_L0:;
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+}
+
+/* "overload/bind.pyx":286
+ * 
+ * 
+ * cdef bint isTypeBased(const vector[Instruction]& program):             # <<<<<<<<<<<<<<
+ *     """Return True if the result of `program` only depends on the type of the argument."""
+ *     cdef Py_ssize_t i
+*/
+
+static int __pyx_f_8overload_4bind_isTypeBased(std::vector<struct __pyx_t_8overload_4bind_Instruction>  const &__pyx_v_program) {
+  Py_ssize_t __pyx_v_i;
+  int __pyx_v_op;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  Py_ssize_t __pyx_t_1;
+  Py_ssize_t __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  int __pyx_t_4;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[10]))
+  __Pyx_TraceStartFunc("isTypeBased", __pyx_f[0], 286, 0, 0, 0, __PYX_ERR(0, 286, __pyx_L1_error));
+
+  /* "overload/bind.pyx":291
+ *     cdef int op
+ * 
+ *     for i in range(<Py_ssize_t> program.size()):             # <<<<<<<<<<<<<<
+ *         op = program[i].op
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:
+*/
+
+  __pyx_t_1 = ((Py_ssize_t)__pyx_v_program.size());
+  __pyx_t_2 = __pyx_t_1;
+
+  for (__pyx_t_3 = 0; __pyx_t_3 < __pyx_t_2; __pyx_t_3+=1) {
+    __pyx_v_i = __pyx_t_3;
+
+    /* "overload/bind.pyx":292
+ * 
+ *     for i in range(<Py_ssize_t> program.size()):
+ *         op = program[i].op             # <<<<<<<<<<<<<<
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:
+ *             return False
+*/
+    __pyx_t_4 = (__pyx_v_program[__pyx_v_i]).op;
+
+    __pyx_v_op = __pyx_t_4;
+
+    /* "overload/bind.pyx":293
+ *     for i in range(<Py_ssize_t> program.size()):
+ *         op = program[i].op
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *             return False
+ *     return True
+*/
+    switch (__pyx_v_op) {
+      case __pyx_e_8overload_4bind_OP_LITERAL:
+      case __pyx_e_8overload_4bind_OP_SUBCLASS:
+      case __pyx_e_8overload_4bind_OP_TUPLE:
+      case __pyx_e_8overload_4bind_OP_COLLECTION:
+      case __pyx_e_8overload_4bind_OP_MAPPING:
+
+      /* "overload/bind.pyx":294
+ *         op = program[i].op
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:
+ *             return False             # <<<<<<<<<<<<<<
+ *     return True
+ * 
+*/
+      {
+
+        __pyx_r = 0;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 35, 0, __PYX_ERR(0, 294, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":293
+ *     for i in range(<Py_ssize_t> program.size()):
+ *         op = program[i].op
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *             return False
+ *     return True
+*/
+      break;
+      default: break;
+    }
+  }
+
+
+  /* "overload/bind.pyx":295
+ *         if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:
+ *             return False
+ *     return True             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = 1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 37, 0, __PYX_ERR(0, 295, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":286
+ * 
+ * 
+ * cdef bint isTypeBased(const vector[Instruction]& program):             # <<<<<<<<<<<<<<
+ *     """Return True if the result of `program` only depends on the type of the argument."""
+ *     cdef Py_ssize_t i
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 286, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.isTypeBased", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":298
+ * 
+ * 
+ * cdef bint runProgram(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `arg` matches the program node at `instruction`."""
+ *     cdef PyTypeObject* arg_type
+*/
+
+static int __pyx_f_8overload_4bind_runProgram(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_arg) {
+  PyTypeObject *__pyx_v_arg_type;
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  Py_ssize_t __pyx_v_i;
+  int __pyx_v_op;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  PyObject *__pyx_t_4 = NULL;
+  Py_ssize_t __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[11]))
+  __Pyx_RefNannySetupContext("runProgram", 0);
+  __Pyx_TraceStartFunc("runProgram", __pyx_f[0], 298, 0, 0, 0, __PYX_ERR(0, 298, __pyx_L1_error));
+
+  /* "overload/bind.pyx":303
+ *     cdef const Instruction* child
+ *     cdef Py_ssize_t i
+ *     cdef int op = instruction.op             # <<<<<<<<<<<<<<
+ * 
+ *     if op == OP_ANY:
+*/
+  __pyx_t_1 = __pyx_v_instruction->op;
+
+  __pyx_v_op = __pyx_t_1;
+
+  /* "overload/bind.pyx":305
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return True
+ *     if op == OP_TYPE:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_ANY);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":306
+ * 
+ *     if op == OP_ANY:
+ *         return True             # <<<<<<<<<<<<<<
+ *     if op == OP_TYPE:
+ *         arg_type = Py_TYPE_PTR(arg)
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 9, 0, __PYX_ERR(0, 306, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":305
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return True
+ *     if op == OP_TYPE:
+*/
+  }
+
+  /* "overload/bind.pyx":307
+ *     if op == OP_ANY:
+ *         return True
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         arg_type = Py_TYPE_PTR(arg)
+ *         return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TYPE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":308
+ *         return True
+ *     if op == OP_TYPE:
+ *         arg_type = Py_TYPE_PTR(arg)             # <<<<<<<<<<<<<<
+ *         return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(
+ *             arg_type, <PyTypeObject*> instruction.value
+*/
+    __pyx_v_arg_type = Py_TYPE(__pyx_v_arg);
+
+    /* "overload/bind.pyx":309
+ *     if op == OP_TYPE:
+ *         arg_type = Py_TYPE_PTR(arg)
+ *         return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(             # <<<<<<<<<<<<<<
+ *             arg_type, <PyTypeObject*> instruction.value
+ *         )
+*/
+    __pyx_t_3 = (__pyx_v_arg_type == ((PyTypeObject *)__pyx_v_instruction->value));
+
+    if (!__pyx_t_3) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_3;
+
+      goto __pyx_L5_bool_binop_done;
+    }
+
+    /* "overload/bind.pyx":310
+ *         arg_type = Py_TYPE_PTR(arg)
+ *         return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(
+ *             arg_type, <PyTypeObject*> instruction.value             # <<<<<<<<<<<<<<
+ *         )
+ *     if op == OP_INSTANCE:
+*/
+    __pyx_t_3 = PyType_IsSubtype(__pyx_v_arg_type, ((PyTypeObject *)__pyx_v_instruction->value));
+
+
+    __pyx_t_2 = __pyx_t_3;
+
+    __pyx_L5_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 19, 0, __PYX_ERR(0, 309, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":307
+ *     if op == OP_ANY:
+ *         return True
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         arg_type = Py_TYPE_PTR(arg)
+ *         return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(
+*/
+  }
+
+  /* "overload/bind.pyx":312
+ *             arg_type, <PyTypeObject*> instruction.value
+ *         )
+ *     if op == OP_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_INSTANCE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":313
+ *         )
+ *     if op == OP_INSTANCE:
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)             # <<<<<<<<<<<<<<
+ *     if op == OP_LITERAL:
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(
+*/
+    __pyx_t_1 = PyObject_IsInstance(__pyx_v_arg, __pyx_v_instruction->value); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(0, 313, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 36, 0, __PYX_ERR(0, 313, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":312
+ *             arg_type, <PyTypeObject*> instruction.value
+ *         )
+ *     if op == OP_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:
+*/
+  }
+
+  /* "overload/bind.pyx":314
+ *     if op == OP_INSTANCE:
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(
+ *             <object> arg, <object> instruction.value, Py_EQ
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_LITERAL);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":315
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(             # <<<<<<<<<<<<<<
+ *             <object> arg, <object> instruction.value, Py_EQ
+ *         )
+*/
+    __pyx_t_3 = (Py_TYPE(__pyx_v_arg) == Py_TYPE(__pyx_v_instruction->value));
+
+    if (__pyx_t_3) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_3;
+
+      goto __pyx_L9_bool_binop_done;
+    }
+
+    /* "overload/bind.pyx":316
+ *     if op == OP_LITERAL:
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(
+ *             <object> arg, <object> instruction.value, Py_EQ             # <<<<<<<<<<<<<<
+ *         )
+ *     if op == OP_SUBCLASS:
+*/
+    __pyx_t_4 = ((PyObject *)__pyx_v_instruction->value);
+    __Pyx_INCREF(__pyx_t_4);
+
+    /* "overload/bind.pyx":315
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(             # <<<<<<<<<<<<<<
+ *             <object> arg, <object> instruction.value, Py_EQ
+ *         )
+*/
+    __pyx_t_3 = PyObject_RichCompareBool(((PyObject *)__pyx_v_arg), __pyx_t_4, Py_EQ); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 315, __pyx_L1_error)
+    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+
+    __pyx_t_2 = __pyx_t_3;
+
+    __pyx_L9_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 46, 0, __PYX_ERR(0, 315, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":314
+ *     if op == OP_INSTANCE:
+ *         return PyObject_IsInstance_PTR(arg, instruction.value)
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(
+ *             <object> arg, <object> instruction.value, Py_EQ
+*/
+  }
+
+  /* "overload/bind.pyx":318
+ *             <object> arg, <object> instruction.value, Py_EQ
+ *         )
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)
+ * 
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_SUBCLASS);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":319
+ *         )
+ *     if op == OP_SUBCLASS:
+ *         return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)             # <<<<<<<<<<<<<<
+ * 
+ *     if op == OP_COLLECTION:
+*/
+    __pyx_t_3 = PyType_Check(((PyObject *)__pyx_v_arg));
+
+    if (__pyx_t_3) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_3;
+
+      goto __pyx_L12_bool_binop_done;
+    }
+    __pyx_t_1 = PyObject_IsSubclass(__pyx_v_arg, __pyx_v_instruction->value); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(0, 319, __pyx_L1_error)
+    __pyx_t_3 = (__pyx_t_1 != 0);
+
+
+
+    __pyx_t_2 = __pyx_t_3;
+
+    __pyx_L12_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 68, 0, __PYX_ERR(0, 319, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":318
+ *             <object> arg, <object> instruction.value, Py_EQ
+ *         )
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":321
+ *         return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)
+ * 
+ *     if op == OP_COLLECTION:             # <<<<<<<<<<<<<<
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+ *     if op == OP_MAPPING:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_COLLECTION);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":322
+ * 
+ *     if op == OP_COLLECTION:
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)             # <<<<<<<<<<<<<<
+ *     if op == OP_MAPPING:
+ *         return isInstance(arg, instruction.value) and runMapping(instruction, arg)
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_isInstance(__pyx_v_arg, __pyx_v_instruction->value); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 322, __pyx_L1_error)
+    if (__pyx_t_3) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_3;
+
+      goto __pyx_L15_bool_binop_done;
+    }
+    __pyx_t_3 = __pyx_f_8overload_4bind_runCollection(__pyx_v_instruction, __pyx_v_arg); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 322, __pyx_L1_error)
+
+    __pyx_t_2 = __pyx_t_3;
+
+    __pyx_L15_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 83, 0, __PYX_ERR(0, 322, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":321
+ *         return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)
+ * 
+ *     if op == OP_COLLECTION:             # <<<<<<<<<<<<<<
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+ *     if op == OP_MAPPING:
+*/
+  }
+
+  /* "overload/bind.pyx":323
+ *     if op == OP_COLLECTION:
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+ *     if op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         return isInstance(arg, instruction.value) and runMapping(instruction, arg)
+ * 
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_MAPPING);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":324
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+ *     if op == OP_MAPPING:
+ *         return isInstance(arg, instruction.value) and runMapping(instruction, arg)             # <<<<<<<<<<<<<<
+ * 
+ *     child = instruction + 1
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_isInstance(__pyx_v_arg, __pyx_v_instruction->value); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 324, __pyx_L1_error)
+    if (__pyx_t_3) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_3;
+
+      goto __pyx_L18_bool_binop_done;
+    }
+    __pyx_t_3 = __pyx_f_8overload_4bind_runMapping(__pyx_v_instruction, __pyx_v_arg); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 324, __pyx_L1_error)
+
+    __pyx_t_2 = __pyx_t_3;
+
+    __pyx_L18_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 98, 0, __PYX_ERR(0, 324, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":323
+ *     if op == OP_COLLECTION:
+ *         return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+ *     if op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         return isInstance(arg, instruction.value) and runMapping(instruction, arg)
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":326
+ *         return isInstance(arg, instruction.value) and runMapping(instruction, arg)
+ * 
+ *     child = instruction + 1             # <<<<<<<<<<<<<<
+ *     if op == OP_UNION:
+ *         for i in range(instruction.count):
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":327
+ * 
+ *     child = instruction + 1
+ *     if op == OP_UNION:             # <<<<<<<<<<<<<<
+ *         for i in range(instruction.count):
+ *             if runProgram(child, arg):
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_UNION);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":328
+ *     child = instruction + 1
+ *     if op == OP_UNION:
+ *         for i in range(instruction.count):             # <<<<<<<<<<<<<<
+ *             if runProgram(child, arg):
+ *                 return True
+*/
+
+    __pyx_t_5 = __pyx_v_instruction->count;
+    __pyx_t_6 = __pyx_t_5;
+
+    for (__pyx_t_7 = 0; __pyx_t_7 < __pyx_t_6; __pyx_t_7+=1) {
+      __pyx_v_i = __pyx_t_7;
+
+      /* "overload/bind.pyx":329
+ *     if op == OP_UNION:
+ *         for i in range(instruction.count):
+ *             if runProgram(child, arg):             # <<<<<<<<<<<<<<
+ *                 return True
+ *             child += child.size
+*/
+      __pyx_t_2 = __pyx_f_8overload_4bind_runProgram(__pyx_v_child, __pyx_v_arg); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 329, __pyx_L1_error)
+      if (__pyx_t_2) {
+
+
+        /* "overload/bind.pyx":330
+ *         for i in range(instruction.count):
+ *             if runProgram(child, arg):
+ *                 return True             # <<<<<<<<<<<<<<
+ *             child += child.size
+ *         return False
+*/
+        {
+
+          __pyx_r = 1;
+        }
+        __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 128, 0, __PYX_ERR(0, 330, __pyx_L1_error));
+        goto __pyx_L0;
+
+        /* "overload/bind.pyx":329
+ *     if op == OP_UNION:
+ *         for i in range(instruction.count):
+ *             if runProgram(child, arg):             # <<<<<<<<<<<<<<
+ *                 return True
+ *             child += child.size
+*/
+      }
+
+      /* "overload/bind.pyx":331
+ *             if runProgram(child, arg):
+ *                 return True
+ *             child += child.size             # <<<<<<<<<<<<<<
+ *         return False
+ * 
+*/
+      __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+    }
+
+
+    /* "overload/bind.pyx":332
+ *                 return True
+ *             child += child.size
+ *         return False             # <<<<<<<<<<<<<<
+ * 
+ *     # OP_TUPLE
+*/
+    {
+
+      __pyx_r = 0;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 133, 0, __PYX_ERR(0, 332, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":327
+ * 
+ *     child = instruction + 1
+ *     if op == OP_UNION:             # <<<<<<<<<<<<<<
+ *         for i in range(instruction.count):
+ *             if runProgram(child, arg):
+*/
+  }
+
+  /* "overload/bind.pyx":335
+ * 
+ *     # OP_TUPLE
+ *     if not PyTuple_Check(<object> arg) or PyTuple_GET_SIZE(<object> arg) != instruction.count:             # <<<<<<<<<<<<<<
+ *         return False
+ *     for i in range(instruction.count):
+*/
+  __pyx_t_3 = (!PyTuple_Check(((PyObject *)__pyx_v_arg)));
+
+  if (!__pyx_t_3) {
+
+  } else {
+
+    __pyx_t_2 = __pyx_t_3;
+
+    goto __pyx_L25_bool_binop_done;
+  }
+  __pyx_t_3 = (PyTuple_GET_SIZE(((PyObject *)__pyx_v_arg)) != __pyx_v_instruction->count);
+
+
+  __pyx_t_2 = __pyx_t_3;
+
+  __pyx_L25_bool_binop_done:;
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":336
+ *     # OP_TUPLE
+ *     if not PyTuple_Check(<object> arg) or PyTuple_GET_SIZE(<object> arg) != instruction.count:
+ *         return False             # <<<<<<<<<<<<<<
+ *     for i in range(instruction.count):
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):
+*/
+    {
+
+      __pyx_r = 0;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 149, 0, __PYX_ERR(0, 336, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":335
+ * 
+ *     # OP_TUPLE
+ *     if not PyTuple_Check(<object> arg) or PyTuple_GET_SIZE(<object> arg) != instruction.count:             # <<<<<<<<<<<<<<
+ *         return False
+ *     for i in range(instruction.count):
+*/
+  }
+
+  /* "overload/bind.pyx":337
+ *     if not PyTuple_Check(<object> arg) or PyTuple_GET_SIZE(<object> arg) != instruction.count:
+ *         return False
+ *     for i in range(instruction.count):             # <<<<<<<<<<<<<<
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):
+ *             return False
+*/
+
+  __pyx_t_5 = __pyx_v_instruction->count;
+  __pyx_t_6 = __pyx_t_5;
+
+  for (__pyx_t_7 = 0; __pyx_t_7 < __pyx_t_6; __pyx_t_7+=1) {
+    __pyx_v_i = __pyx_t_7;
+
+    /* "overload/bind.pyx":338
+ *         return False
+ *     for i in range(instruction.count):
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):             # <<<<<<<<<<<<<<
+ *             return False
+ *         child += child.size
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_runProgram(__pyx_v_child, ((PyObject *)PyTuple_GET_ITEM(((PyObject *)__pyx_v_arg), __pyx_v_i))); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 338, __pyx_L1_error)
+    __pyx_t_3 = (!__pyx_t_2);
+
+
+    if (__pyx_t_3) {
+
+
+      /* "overload/bind.pyx":339
+ *     for i in range(instruction.count):
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):
+ *             return False             # <<<<<<<<<<<<<<
+ *         child += child.size
+ *     return True
+*/
+      {
+
+        __pyx_r = 0;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 168, 0, __PYX_ERR(0, 339, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":338
+ *         return False
+ *     for i in range(instruction.count):
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):             # <<<<<<<<<<<<<<
+ *             return False
+ *         child += child.size
+*/
+    }
+
+    /* "overload/bind.pyx":340
+ *         if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):
+ *             return False
+ *         child += child.size             # <<<<<<<<<<<<<<
+ *     return True
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+  }
+
+
+  /* "overload/bind.pyx":341
+ *             return False
+ *         child += child.size
+ *     return True             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = 1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 173, 0, __PYX_ERR(0, 341, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":298
+ * 
+ * 
+ * cdef bint runProgram(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `arg` matches the program node at `instruction`."""
+ *     cdef PyTypeObject* arg_type
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_4);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 298, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.runProgram", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":344
+ * 
+ * 
+ * cdef inline bint isInstance(PyObject* arg, PyObject* cls) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:
+*/
+
+static CYTHON_INLINE int __pyx_f_8overload_4bind_isInstance(PyObject *__pyx_v_arg, PyObject *__pyx_v_cls) {
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[12]))
+  __Pyx_TraceStartFunc("isInstance", __pyx_f[0], 344, 0, 0, 0, __PYX_ERR(0, 344, __pyx_L1_error));
+
+  /* "overload/bind.pyx":346
+ * cdef inline bint isInstance(PyObject* arg, PyObject* cls) except -1:
+ *     """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:             # <<<<<<<<<<<<<<
+ *         return Py_TYPE_PTR(arg) == <PyTypeObject*> cls or PyType_IsSubtype_PTR(Py_TYPE_PTR(arg), <PyTypeObject*> cls)
+ *     return PyObject_IsInstance_PTR(arg, cls)
+*/
+  __pyx_t_1 = (Py_TYPE(__pyx_v_cls) == (&PyType_Type));
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":347
+ *     """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:
+ *         return Py_TYPE_PTR(arg) == <PyTypeObject*> cls or PyType_IsSubtype_PTR(Py_TYPE_PTR(arg), <PyTypeObject*> cls)             # <<<<<<<<<<<<<<
+ *     return PyObject_IsInstance_PTR(arg, cls)
+ * 
+*/
+    __pyx_t_2 = (Py_TYPE(__pyx_v_arg) == ((PyTypeObject *)__pyx_v_cls));
+
+    if (!__pyx_t_2) {
+
+    } else {
+
+      __pyx_t_1 = __pyx_t_2;
+
+      goto __pyx_L4_bool_binop_done;
+    }
+    __pyx_t_2 = PyType_IsSubtype(Py_TYPE(__pyx_v_arg), ((PyTypeObject *)__pyx_v_cls));
+
+
+    __pyx_t_1 = __pyx_t_2;
+
+    __pyx_L4_bool_binop_done:;
+    {
+      __pyx_r = __pyx_t_1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 9, 0, __PYX_ERR(0, 347, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":346
+ * cdef inline bint isInstance(PyObject* arg, PyObject* cls) except -1:
+ *     """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:             # <<<<<<<<<<<<<<
+ *         return Py_TYPE_PTR(arg) == <PyTypeObject*> cls or PyType_IsSubtype_PTR(Py_TYPE_PTR(arg), <PyTypeObject*> cls)
+ *     return PyObject_IsInstance_PTR(arg, cls)
+*/
+  }
+
+  /* "overload/bind.pyx":348
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:
+ *         return Py_TYPE_PTR(arg) == <PyTypeObject*> cls or PyType_IsSubtype_PTR(Py_TYPE_PTR(arg), <PyTypeObject*> cls)
+ *     return PyObject_IsInstance_PTR(arg, cls)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_t_3 = PyObject_IsInstance(__pyx_v_arg, __pyx_v_cls); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 348, __pyx_L1_error)
+  {
+    __pyx_r = __pyx_t_3;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 24, 0, __PYX_ERR(0, 348, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":344
+ * 
+ * 
+ * cdef inline bint isInstance(PyObject* arg, PyObject* cls) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+ *     if Py_TYPE_PTR(cls) == &PyType_Type:
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 344, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.isInstance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":351
+ * 
+ * 
+ * cdef inline Py_ssize_t checkedCount(const ContainerCheck* check, Py_ssize_t size):             # <<<<<<<<<<<<<<
+ *     """Return how many of `size` elements are checked."""
+ *     if check.mode == CHECK_FULL or size <= check.items:
+*/
+
+static CYTHON_INLINE Py_ssize_t __pyx_f_8overload_4bind_checkedCount(struct __pyx_t_8overload_4bind_ContainerCheck const *__pyx_v_check, Py_ssize_t __pyx_v_size) {
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[13]))
+  __Pyx_TraceStartFunc("checkedCount", __pyx_f[0], 351, 0, 0, 0, __PYX_ERR(0, 351, __pyx_L1_error));
+
+  /* "overload/bind.pyx":353
+ * cdef inline Py_ssize_t checkedCount(const ContainerCheck* check, Py_ssize_t size):
+ *     """Return how many of `size` elements are checked."""
+ *     if check.mode == CHECK_FULL or size <= check.items:             # <<<<<<<<<<<<<<
+ *         return size
+ *     return check.items
+*/
+  __pyx_t_2 = (__pyx_v_check->mode == __pyx_e_8overload_4bind_CHECK_FULL);
+
+  if (!__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_2 = (__pyx_v_size <= __pyx_v_check->items);
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":354
+ *     """Return how many of `size` elements are checked."""
+ *     if check.mode == CHECK_FULL or size <= check.items:
+ *         return size             # <<<<<<<<<<<<<<
+ *     return check.items
+ * 
+*/
+    {
+
+      __pyx_r = __pyx_v_size;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 12, 0, __PYX_ERR(0, 354, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":353
+ * cdef inline Py_ssize_t checkedCount(const ContainerCheck* check, Py_ssize_t size):
+ *     """Return how many of `size` elements are checked."""
+ *     if check.mode == CHECK_FULL or size <= check.items:             # <<<<<<<<<<<<<<
+ *         return size
+ *     return check.items
+*/
+  }
+
+  /* "overload/bind.pyx":355
+ *     if check.mode == CHECK_FULL or size <= check.items:
+ *         return size
+ *     return check.items             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_check->items;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 14, 0, __PYX_ERR(0, 355, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":351
+ * 
+ * 
+ * cdef inline Py_ssize_t checkedCount(const ContainerCheck* check, Py_ssize_t size):             # <<<<<<<<<<<<<<
+ *     """Return how many of `size` elements are checked."""
+ *     if check.mode == CHECK_FULL or size <= check.items:
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 351, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.checkedCount", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":358
+ * 
+ * 
+ * cdef inline Py_ssize_t checkedIndex(const ContainerCheck* check, Py_ssize_t size, Py_ssize_t i):             # <<<<<<<<<<<<<<
+ *     """Return the index of the `i`-th checked element out of `size`."""
+ *     if check.mode == CHECK_SAMPLE and size > check.items:
+*/
+
+static CYTHON_INLINE Py_ssize_t __pyx_f_8overload_4bind_checkedIndex(struct __pyx_t_8overload_4bind_ContainerCheck const *__pyx_v_check, Py_ssize_t __pyx_v_size, Py_ssize_t __pyx_v_i) {
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[14]))
+  __Pyx_TraceStartFunc("checkedIndex", __pyx_f[0], 358, 0, 0, 0, __PYX_ERR(0, 358, __pyx_L1_error));
+
+  /* "overload/bind.pyx":360
+ * cdef inline Py_ssize_t checkedIndex(const ContainerCheck* check, Py_ssize_t size, Py_ssize_t i):
+ *     """Return the index of the `i`-th checked element out of `size`."""
+ *     if check.mode == CHECK_SAMPLE and size > check.items:             # <<<<<<<<<<<<<<
+ *         return i * size // <Py_ssize_t> check.items
+ *     return i
+*/
+  __pyx_t_2 = (__pyx_v_check->mode == __pyx_e_8overload_4bind_CHECK_SAMPLE);
+
+  if (__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_2 = (__pyx_v_size > __pyx_v_check->items);
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":361
+ *     """Return the index of the `i`-th checked element out of `size`."""
+ *     if check.mode == CHECK_SAMPLE and size > check.items:
+ *         return i * size // <Py_ssize_t> check.items             # <<<<<<<<<<<<<<
+ *     return i
+ * 
+*/
+    __pyx_t_3 = (__pyx_v_i * __pyx_v_size);
+
+    if (unlikely(((Py_ssize_t)__pyx_v_check->items) == 0)) {
+      PyErr_SetString(PyExc_ZeroDivisionError, "integer division or modulo by zero");
+      __PYX_ERR(0, 361, __pyx_L1_error)
+    }
+    else if (sizeof(Py_ssize_t) == sizeof(long) && (!(((Py_ssize_t)-1) > 0)) && unlikely(((Py_ssize_t)__pyx_v_check->items) == (Py_ssize_t)-1)  && unlikely(__Pyx_UNARY_NEG_WOULD_OVERFLOW(__pyx_t_3))) {
+      PyErr_SetString(PyExc_OverflowError, "value too large to perform division");
+      __PYX_ERR(0, 361, __pyx_L1_error)
+    }
+    {
+
+      __pyx_r = __Pyx_div_Py_ssize_t(__pyx_t_3, ((Py_ssize_t)__pyx_v_check->items), 0);
+    }
+
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 12, 0, __PYX_ERR(0, 361, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":360
+ * cdef inline Py_ssize_t checkedIndex(const ContainerCheck* check, Py_ssize_t size, Py_ssize_t i):
+ *     """Return the index of the `i`-th checked element out of `size`."""
+ *     if check.mode == CHECK_SAMPLE and size > check.items:             # <<<<<<<<<<<<<<
+ *         return i * size // <Py_ssize_t> check.items
+ *     return i
+*/
+  }
+
+  /* "overload/bind.pyx":362
+ *     if check.mode == CHECK_SAMPLE and size > check.items:
+ *         return i * size // <Py_ssize_t> check.items
+ *     return i             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_i;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 20, 0, __PYX_ERR(0, 362, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":358
+ * 
+ * 
+ * cdef inline Py_ssize_t checkedIndex(const ContainerCheck* check, Py_ssize_t size, Py_ssize_t i):             # <<<<<<<<<<<<<<
+ *     """Return the index of the `i`-th checked element out of `size`."""
+ *     if check.mode == CHECK_SAMPLE and size > check.items:
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 358, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.checkedIndex", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":365
+ * 
+ * 
+ * cdef bint runCollection(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Check elements of a collection that matched the class of an OP_COLLECTION instruction.
+ *     Elements are only checked in lists, tuples, sets and frozensets, iterating anything else could consume it.
+*/
+
+static int __pyx_f_8overload_4bind_runCollection(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_arg) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  struct __pyx_t_8overload_4bind_ContainerCheck const *__pyx_v_check;
+  PyTypeObject *__pyx_v_item_type;
+  PyTypeObject *__pyx_v_last_type;
+  PyObject **__pyx_v_items;
+  Py_ssize_t __pyx_v_size;
+  Py_ssize_t __pyx_v_count;
+  Py_ssize_t __pyx_v_i;
+  PyObject *__pyx_v_obj = NULL;
+  PyObject *__pyx_v_item = NULL;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  Py_ssize_t __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  PyObject *__pyx_t_8 = NULL;
+  size_t __pyx_t_9;
+  PyObject *(*__pyx_t_10)(PyObject *);
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[15]))
+  __Pyx_RefNannySetupContext("runCollection", 0);
+  __Pyx_TraceStartFunc("runCollection", __pyx_f[0], 365, 0, 0, 0, __PYX_ERR(0, 365, __pyx_L1_error));
+
+  /* "overload/bind.pyx":369
+ *     Elements are only checked in lists, tuples, sets and frozensets, iterating anything else could consume it.
+ *     """
+ *     cdef const Instruction* child = instruction + 1             # <<<<<<<<<<<<<<
+ *     cdef const ContainerCheck* check = &instruction.check
+ *     cdef PyTypeObject* item_type
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":370
+ *     """
+ *     cdef const Instruction* child = instruction + 1
+ *     cdef const ContainerCheck* check = &instruction.check             # <<<<<<<<<<<<<<
+ *     cdef PyTypeObject* item_type
+ *     cdef PyTypeObject* last_type = NULL
+*/
+  __pyx_v_check = (&__pyx_v_instruction->check);
+
+  /* "overload/bind.pyx":372
+ *     cdef const ContainerCheck* check = &instruction.check
+ *     cdef PyTypeObject* item_type
+ *     cdef PyTypeObject* last_type = NULL             # <<<<<<<<<<<<<<
+ *     cdef PyObject** items
+ *     cdef Py_ssize_t size
+*/
+  __pyx_v_last_type = NULL;
+
+  /* "overload/bind.pyx":377
+ *     cdef Py_ssize_t count
+ *     cdef Py_ssize_t i
+ *     obj = <object> arg             # <<<<<<<<<<<<<<
+ * 
+ *     if PyList_Check(obj) or PyTuple_Check(obj):
+*/
+  __pyx_t_1 = ((PyObject *)__pyx_v_arg);
+  __Pyx_INCREF(__pyx_t_1);
+  __pyx_v_obj = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":379
+ *     obj = <object> arg
+ * 
+ *     if PyList_Check(obj) or PyTuple_Check(obj):             # <<<<<<<<<<<<<<
+ *         size = len(obj)
+ *         count = checkedCount(check, size)
+*/
+  __pyx_t_3 = PyList_Check(__pyx_v_obj);
+
+  if (!__pyx_t_3) {
+
+  } else {
+
+    __pyx_t_2 = __pyx_t_3;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_3 = PyTuple_Check(__pyx_v_obj);
+
+
+  __pyx_t_2 = __pyx_t_3;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":380
+ * 
+ *     if PyList_Check(obj) or PyTuple_Check(obj):
+ *         size = len(obj)             # <<<<<<<<<<<<<<
+ *         count = checkedCount(check, size)
+ * 
+*/
+    __pyx_t_4 = PyObject_Length(__pyx_v_obj); if (unlikely(__pyx_t_4 == ((Py_ssize_t)-1))) __PYX_ERR(0, 380, __pyx_L1_error)
+    __pyx_v_size = __pyx_t_4;
+
+    /* "overload/bind.pyx":381
+ *     if PyList_Check(obj) or PyTuple_Check(obj):
+ *         size = len(obj)
+ *         count = checkedCount(check, size)             # <<<<<<<<<<<<<<
+ * 
+ *         if child.op == OP_TYPE:
+*/
+    __pyx_t_4 = __pyx_f_8overload_4bind_checkedCount(__pyx_v_check, __pyx_v_size); if (unlikely(__pyx_t_4 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 381, __pyx_L1_error)
+    __pyx_v_count = __pyx_t_4;
+
+    /* "overload/bind.pyx":383
+ *         count = checkedCount(check, size)
+ * 
+ *         if child.op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *             # Type checks never run Python code, so the list can not change while we walk its items
+ *             items = PySequence_Fast_ITEMS(obj)
+*/
+    __pyx_t_2 = (__pyx_v_child->op == __pyx_e_8overload_4bind_OP_TYPE);
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":385
+ *         if child.op == OP_TYPE:
+ *             # Type checks never run Python code, so the list can not change while we walk its items
+ *             items = PySequence_Fast_ITEMS(obj)             # <<<<<<<<<<<<<<
+ *             for i in range(count):
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+*/
+      __pyx_v_items = PySequence_Fast_ITEMS(__pyx_v_obj);
+
+      /* "overload/bind.pyx":386
+ *             # Type checks never run Python code, so the list can not change while we walk its items
+ *             items = PySequence_Fast_ITEMS(obj)
+ *             for i in range(count):             # <<<<<<<<<<<<<<
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:
+*/
+
+      __pyx_t_4 = __pyx_v_count;
+      __pyx_t_5 = __pyx_t_4;
+
+      for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_t_5; __pyx_t_6+=1) {
+        __pyx_v_i = __pyx_t_6;
+
+        /* "overload/bind.pyx":387
+ *             items = PySequence_Fast_ITEMS(obj)
+ *             for i in range(count):
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])             # <<<<<<<<<<<<<<
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:
+ *                     continue
+*/
+        __pyx_t_7 = __pyx_f_8overload_4bind_checkedIndex(__pyx_v_check, __pyx_v_size, __pyx_v_i); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 387, __pyx_L1_error)
+        __pyx_v_item_type = Py_TYPE((__pyx_v_items[__pyx_t_7]));
+
+
+        /* "overload/bind.pyx":388
+ *             for i in range(count):
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:             # <<<<<<<<<<<<<<
+ *                     continue
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+*/
+        __pyx_t_3 = (__pyx_v_item_type == __pyx_v_last_type);
+
+        if (!__pyx_t_3) {
+
+        } else {
+
+          __pyx_t_2 = __pyx_t_3;
+
+          goto __pyx_L10_bool_binop_done;
+        }
+        __pyx_t_3 = (__pyx_v_item_type == ((PyTypeObject *)__pyx_v_child->value));
+
+
+        __pyx_t_2 = __pyx_t_3;
+
+        __pyx_L10_bool_binop_done:;
+        if (__pyx_t_2) {
+
+
+          /* "overload/bind.pyx":389
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:
+ *                     continue             # <<<<<<<<<<<<<<
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+ *                     return False
+*/
+          goto __pyx_L7_continue;
+
+          /* "overload/bind.pyx":388
+ *             for i in range(count):
+ *                 item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:             # <<<<<<<<<<<<<<
+ *                     continue
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+*/
+        }
+
+        /* "overload/bind.pyx":390
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:
+ *                     continue
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):             # <<<<<<<<<<<<<<
+ *                     return False
+ *                 last_type = item_type
+*/
+        __pyx_t_2 = (!PyType_IsSubtype(__pyx_v_item_type, ((PyTypeObject *)__pyx_v_child->value)));
+
+        if (__pyx_t_2) {
+
+
+          /* "overload/bind.pyx":391
+ *                     continue
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+ *                     return False             # <<<<<<<<<<<<<<
+ *                 last_type = item_type
+ *             return True
+*/
+          {
+
+            __pyx_r = 0;
+          }
+          __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 75, 0, __PYX_ERR(0, 391, __pyx_L1_error));
+          goto __pyx_L0;
+
+          /* "overload/bind.pyx":390
+ *                 if item_type == last_type or item_type == <PyTypeObject*> child.value:
+ *                     continue
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):             # <<<<<<<<<<<<<<
+ *                     return False
+ *                 last_type = item_type
+*/
+        }
+
+        /* "overload/bind.pyx":392
+ *                 if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+ *                     return False
+ *                 last_type = item_type             # <<<<<<<<<<<<<<
+ *             return True
+ * 
+*/
+        __pyx_v_last_type = __pyx_v_item_type;
+        __pyx_L7_continue:;
+      }
+
+
+      /* "overload/bind.pyx":393
+ *                     return False
+ *                 last_type = item_type
+ *             return True             # <<<<<<<<<<<<<<
+ * 
+ *         for i in range(count):
+*/
+      {
+
+        __pyx_r = 1;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 79, 0, __PYX_ERR(0, 393, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":383
+ *         count = checkedCount(check, size)
+ * 
+ *         if child.op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *             # Type checks never run Python code, so the list can not change while we walk its items
+ *             items = PySequence_Fast_ITEMS(obj)
+*/
+    }
+
+    /* "overload/bind.pyx":395
+ *             return True
+ * 
+ *         for i in range(count):             # <<<<<<<<<<<<<<
+ *             if size != len(obj):
+ *                 raise RuntimeError("container changed size during overload resolution")
+*/
+
+    __pyx_t_4 = __pyx_v_count;
+    __pyx_t_5 = __pyx_t_4;
+
+    for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_t_5; __pyx_t_6+=1) {
+      __pyx_v_i = __pyx_t_6;
+
+      /* "overload/bind.pyx":396
+ * 
+ *         for i in range(count):
+ *             if size != len(obj):             # <<<<<<<<<<<<<<
+ *                 raise RuntimeError("container changed size during overload resolution")
+ *             item = obj[checkedIndex(check, size, i)]
+*/
+      __pyx_t_7 = PyObject_Length(__pyx_v_obj); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1))) __PYX_ERR(0, 396, __pyx_L1_error)
+      __pyx_t_2 = (__pyx_v_size != __pyx_t_7);
+
+
+      if (unlikely(__pyx_t_2)) {
+
+
+        /* "overload/bind.pyx":397
+ *         for i in range(count):
+ *             if size != len(obj):
+ *                 raise RuntimeError("container changed size during overload resolution")             # <<<<<<<<<<<<<<
+ *             item = obj[checkedIndex(check, size, i)]
+ *             if not runProgram(child, <PyObject*> item):
+*/
+        __pyx_t_8 = NULL;
+        __pyx_t_9 = 1;
+        {
+          PyObject *__pyx_callargs[2] = {__pyx_t_8, __pyx_mstate_global->__pyx_kp_u_container_changed_size_during_ov};
+          __pyx_t_1 = __Pyx_PyObject_FastCall((PyObject*)(((PyTypeObject*)PyExc_RuntimeError)), __pyx_callargs+__pyx_t_9, (2-__pyx_t_9) | (__pyx_t_9*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+          __Pyx_XDECREF(__pyx_t_8); __pyx_t_8 = 0;
+          if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 397, __pyx_L1_error)
+          __Pyx_GOTREF(__pyx_t_1);
+        }
+        __Pyx_Raise(__pyx_t_1, 0, 0, 0);
+        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+        __PYX_ERR(0, 397, __pyx_L1_error)
+
+        /* "overload/bind.pyx":396
+ * 
+ *         for i in range(count):
+ *             if size != len(obj):             # <<<<<<<<<<<<<<
+ *                 raise RuntimeError("container changed size during overload resolution")
+ *             item = obj[checkedIndex(check, size, i)]
+*/
+      }
+
+      /* "overload/bind.pyx":398
+ *             if size != len(obj):
+ *                 raise RuntimeError("container changed size during overload resolution")
+ *             item = obj[checkedIndex(check, size, i)]             # <<<<<<<<<<<<<<
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False
+*/
+      __pyx_t_7 = __pyx_f_8overload_4bind_checkedIndex(__pyx_v_check, __pyx_v_size, __pyx_v_i); if (unlikely(__pyx_t_7 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 398, __pyx_L1_error)
+      __pyx_t_1 = __Pyx_GetItemInt(__pyx_v_obj, __pyx_t_7, Py_ssize_t, 1, PyLong_FromSsize_t, 0, 0, 1, __Pyx_ReferenceSharing_OwnStrongReference); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 398, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+
+      __Pyx_XDECREF_SET(__pyx_v_item, __pyx_t_1);
+      __pyx_t_1 = 0;
+
+      /* "overload/bind.pyx":399
+ *                 raise RuntimeError("container changed size during overload resolution")
+ *             item = obj[checkedIndex(check, size, i)]
+ *             if not runProgram(child, <PyObject*> item):             # <<<<<<<<<<<<<<
+ *                 return False
+ *         return True
+*/
+      __pyx_t_2 = __pyx_f_8overload_4bind_runProgram(__pyx_v_child, ((PyObject *)__pyx_v_item)); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 399, __pyx_L1_error)
+      __pyx_t_3 = (!__pyx_t_2);
+
+
+      if (__pyx_t_3) {
+
+
+        /* "overload/bind.pyx":400
+ *             item = obj[checkedIndex(check, size, i)]
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False             # <<<<<<<<<<<<<<
+ *         return True
+ * 
+*/
+        {
+
+          __pyx_r = 0;
+        }
+        __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 111, 0, __PYX_ERR(0, 400, __pyx_L1_error));
+        goto __pyx_L0;
+
+        /* "overload/bind.pyx":399
+ *                 raise RuntimeError("container changed size during overload resolution")
+ *             item = obj[checkedIndex(check, size, i)]
+ *             if not runProgram(child, <PyObject*> item):             # <<<<<<<<<<<<<<
+ *                 return False
+ *         return True
+*/
+      }
+    }
+
+
+    /* "overload/bind.pyx":401
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False
+ *         return True             # <<<<<<<<<<<<<<
+ * 
+ *     if PyAnySet_Check(obj):
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 113, 0, __PYX_ERR(0, 401, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":379
+ *     obj = <object> arg
+ * 
+ *     if PyList_Check(obj) or PyTuple_Check(obj):             # <<<<<<<<<<<<<<
+ *         size = len(obj)
+ *         count = checkedCount(check, size)
+*/
+  }
+
+  /* "overload/bind.pyx":403
+ *         return True
+ * 
+ *     if PyAnySet_Check(obj):             # <<<<<<<<<<<<<<
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:
+*/
+  __pyx_t_3 = PyAnySet_Check(__pyx_v_obj);
+
+  if (__pyx_t_3) {
+
+
+    /* "overload/bind.pyx":404
+ * 
+ *     if PyAnySet_Check(obj):
+ *         count = checkedCount(check, len(obj))             # <<<<<<<<<<<<<<
+ *         for item in obj:
+ *             if count == 0:
+*/
+    __pyx_t_4 = PyObject_Length(__pyx_v_obj); if (unlikely(__pyx_t_4 == ((Py_ssize_t)-1))) __PYX_ERR(0, 404, __pyx_L1_error)
+    __pyx_t_5 = __pyx_f_8overload_4bind_checkedCount(__pyx_v_check, __pyx_t_4); if (unlikely(__pyx_t_5 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 404, __pyx_L1_error)
+
+    __pyx_v_count = __pyx_t_5;
+
+    /* "overload/bind.pyx":405
+ *     if PyAnySet_Check(obj):
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:             # <<<<<<<<<<<<<<
+ *             if count == 0:
+ *                 break
+*/
+    if (likely(PyList_CheckExact(__pyx_v_obj)) || PyTuple_CheckExact(__pyx_v_obj)) {
+      __pyx_t_1 = __pyx_v_obj; __Pyx_INCREF(__pyx_t_1);
+      __pyx_t_5 = 0;
+      __pyx_t_10 = NULL;
+    } else {
+      __pyx_t_5 = -1; __pyx_t_1 = PyObject_GetIter(__pyx_v_obj); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 405, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_1);
+      __pyx_t_10 = (CYTHON_COMPILING_IN_LIMITED_API) ? PyIter_Next : __Pyx_PyObject_GetIterNextFunc(__pyx_t_1); if (unlikely(!__pyx_t_10)) __PYX_ERR(0, 405, __pyx_L1_error)
+    }
+    for (;;) {
+      if (likely(!__pyx_t_10)) {
+        if (likely(PyList_CheckExact(__pyx_t_1))) {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyList_GET_SIZE(__pyx_t_1);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 405, __pyx_L1_error)
+            #endif
+            if (__pyx_t_5 >= __pyx_temp) break;
+          }
+          __pyx_t_8 = __Pyx_PyList_GET_ITEM_REF(__pyx_t_1, __pyx_t_5, __Pyx_ReferenceSharing_OwnStrongReference);
+          ++__pyx_t_5;
+        } else {
+          {
+            Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_1);
+            #if !CYTHON_ASSUME_SAFE_SIZE
+            if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 405, __pyx_L1_error)
+            #endif
+            if (__pyx_t_5 >= __pyx_temp) break;
+          }
+          #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+          __pyx_t_8 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_1, __pyx_t_5));
+          #else
+          __pyx_t_8 = __Pyx_PySequence_ITEM(__pyx_t_1, __pyx_t_5);
+          #endif
+          ++__pyx_t_5;
+        }
+        if (unlikely(!__pyx_t_8)) __PYX_ERR(0, 405, __pyx_L1_error)
+      } else {
+        __pyx_t_8 = __pyx_t_10(__pyx_t_1);
+        if (unlikely(!__pyx_t_8)) {
+          PyObject* exc_type = PyErr_Occurred();
+          if (exc_type) {
+            if (unlikely(!__Pyx_PyErr_GivenExceptionMatches(exc_type, PyExc_StopIteration))) __PYX_ERR(0, 405, __pyx_L1_error)
+            PyErr_Clear();
+          }
+          break;
+        }
+      }
+      __Pyx_GOTREF(__pyx_t_8);
+      __Pyx_XDECREF_SET(__pyx_v_item, __pyx_t_8);
+      __pyx_t_8 = 0;
+
+      /* "overload/bind.pyx":406
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:
+ *             if count == 0:             # <<<<<<<<<<<<<<
+ *                 break
+ *             if not runProgram(child, <PyObject*> item):
+*/
+      __pyx_t_3 = (__pyx_v_count == 0);
+
+      if (__pyx_t_3) {
+
+
+        /* "overload/bind.pyx":407
+ *         for item in obj:
+ *             if count == 0:
+ *                 break             # <<<<<<<<<<<<<<
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False
+*/
+        goto __pyx_L19_break;
+
+        /* "overload/bind.pyx":406
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:
+ *             if count == 0:             # <<<<<<<<<<<<<<
+ *                 break
+ *             if not runProgram(child, <PyObject*> item):
+*/
+      }
+
+      /* "overload/bind.pyx":408
+ *             if count == 0:
+ *                 break
+ *             if not runProgram(child, <PyObject*> item):             # <<<<<<<<<<<<<<
+ *                 return False
+ *             count -= 1
+*/
+      __pyx_t_3 = __pyx_f_8overload_4bind_runProgram(__pyx_v_child, ((PyObject *)__pyx_v_item)); if (unlikely(__pyx_t_3 == ((int)-1))) __PYX_ERR(0, 408, __pyx_L1_error)
+      __pyx_t_2 = (!__pyx_t_3);
+
+
+      if (__pyx_t_2) {
+
+
+        /* "overload/bind.pyx":409
+ *                 break
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False             # <<<<<<<<<<<<<<
+ *             count -= 1
+ * 
+*/
+        {
+
+          __pyx_r = 0;
+        }
+        __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 141, 0, __PYX_ERR(0, 409, __pyx_L1_error));
+        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+        goto __pyx_L0;
+
+        /* "overload/bind.pyx":408
+ *             if count == 0:
+ *                 break
+ *             if not runProgram(child, <PyObject*> item):             # <<<<<<<<<<<<<<
+ *                 return False
+ *             count -= 1
+*/
+      }
+
+      /* "overload/bind.pyx":410
+ *             if not runProgram(child, <PyObject*> item):
+ *                 return False
+ *             count -= 1             # <<<<<<<<<<<<<<
+ * 
+ *     return True
+*/
+      __pyx_v_count = (__pyx_v_count - 1);
+
+      /* "overload/bind.pyx":405
+ *     if PyAnySet_Check(obj):
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:             # <<<<<<<<<<<<<<
+ *             if count == 0:
+ *                 break
+*/
+    }
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    goto __pyx_L22_for_end;
+    __pyx_L19_break:;
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+    goto __pyx_L22_for_end;
+    __pyx_L22_for_end:;
+
+    /* "overload/bind.pyx":403
+ *         return True
+ * 
+ *     if PyAnySet_Check(obj):             # <<<<<<<<<<<<<<
+ *         count = checkedCount(check, len(obj))
+ *         for item in obj:
+*/
+  }
+
+  /* "overload/bind.pyx":412
+ *             count -= 1
+ * 
+ *     return True             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = 1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 145, 0, __PYX_ERR(0, 412, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":365
+ * 
+ * 
+ * cdef bint runCollection(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Check elements of a collection that matched the class of an OP_COLLECTION instruction.
+ *     Elements are only checked in lists, tuples, sets and frozensets, iterating anything else could consume it.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_8);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 365, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.runCollection", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+
+
+
+
+
+  __Pyx_XDECREF(__pyx_v_obj);
+  __Pyx_XDECREF(__pyx_v_item);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":415
+ * 
+ * 
+ * cdef bint runMapping(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Check keys and values of a mapping that matched the class of an OP_MAPPING instruction.
+ *     Elements are only checked in dicts, in iteration order. Sampling checks the first elements instead.
+*/
+
+static int __pyx_f_8overload_4bind_runMapping(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_arg) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_key_program;
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_value_program;
+  Py_ssize_t __pyx_v_count;
+  PyObject *__pyx_v_obj = NULL;
+  PyObject *__pyx_v_key = NULL;
+  PyObject *__pyx_v_value = NULL;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  int __pyx_t_5;
+  PyObject *__pyx_t_6 = NULL;
+  PyObject *__pyx_t_7 = NULL;
+  int __pyx_t_8;
+  int __pyx_t_9;
+  int __pyx_t_10;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[16]))
+  __Pyx_RefNannySetupContext("runMapping", 0);
+  __Pyx_TraceStartFunc("runMapping", __pyx_f[0], 415, 0, 0, 0, __PYX_ERR(0, 415, __pyx_L1_error));
+
+  /* "overload/bind.pyx":419
+ *     Elements are only checked in dicts, in iteration order. Sampling checks the first elements instead.
+ *     """
+ *     cdef const Instruction* key_program = instruction + 1             # <<<<<<<<<<<<<<
+ *     cdef const Instruction* value_program = key_program + key_program.size
+ *     cdef Py_ssize_t count
+*/
+  __pyx_v_key_program = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":420
+ *     """
+ *     cdef const Instruction* key_program = instruction + 1
+ *     cdef const Instruction* value_program = key_program + key_program.size             # <<<<<<<<<<<<<<
+ *     cdef Py_ssize_t count
+ *     obj = <object> arg
+*/
+  __pyx_v_value_program = (__pyx_v_key_program + __pyx_v_key_program->size);
+
+  /* "overload/bind.pyx":422
+ *     cdef const Instruction* value_program = key_program + key_program.size
+ *     cdef Py_ssize_t count
+ *     obj = <object> arg             # <<<<<<<<<<<<<<
+ * 
+ *     if not PyDict_Check(obj):
+*/
+  __pyx_t_1 = ((PyObject *)__pyx_v_arg);
+  __Pyx_INCREF(__pyx_t_1);
+  __pyx_v_obj = __pyx_t_1;
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":424
+ *     obj = <object> arg
+ * 
+ *     if not PyDict_Check(obj):             # <<<<<<<<<<<<<<
+ *         return True
+ * 
+*/
+  __pyx_t_2 = (!PyDict_Check(__pyx_v_obj));
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":425
+ * 
+ *     if not PyDict_Check(obj):
+ *         return True             # <<<<<<<<<<<<<<
+ * 
+ *     count = checkedCount(&instruction.check, len(obj))
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 19, 0, __PYX_ERR(0, 425, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":424
+ *     obj = <object> arg
+ * 
+ *     if not PyDict_Check(obj):             # <<<<<<<<<<<<<<
+ *         return True
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":427
+ *         return True
+ * 
+ *     count = checkedCount(&instruction.check, len(obj))             # <<<<<<<<<<<<<<
+ *     for key, value in (<dict> obj).items():
+ *         if count == 0:
+*/
+  __pyx_t_3 = PyObject_Length(__pyx_v_obj); if (unlikely(__pyx_t_3 == ((Py_ssize_t)-1))) __PYX_ERR(0, 427, __pyx_L1_error)
+  __pyx_t_4 = __pyx_f_8overload_4bind_checkedCount((&__pyx_v_instruction->check), __pyx_t_3); if (unlikely(__pyx_t_4 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 427, __pyx_L1_error)
+
+  __pyx_v_count = __pyx_t_4;
+
+  /* "overload/bind.pyx":428
+ * 
+ *     count = checkedCount(&instruction.check, len(obj))
+ *     for key, value in (<dict> obj).items():             # <<<<<<<<<<<<<<
+ *         if count == 0:
+ *             break
+*/
+  __pyx_t_4 = 0;
+  if (unlikely(__pyx_v_obj == Py_None)) {
+    PyErr_Format(PyExc_AttributeError, "\047NoneType\047 object has no attribute \047%.30s\047", "items");
+    __PYX_ERR(0, 428, __pyx_L1_error)
+  }
+  __pyx_t_6 = __Pyx_dict_iterator(((PyObject*)__pyx_v_obj), 1, __pyx_mstate_global->__pyx_n_u_items, (&__pyx_t_3), (&__pyx_t_5)); if (unlikely(!__pyx_t_6)) __PYX_ERR(0, 428, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_6);
+  __Pyx_XDECREF(__pyx_t_1);
+  __pyx_t_1 = __pyx_t_6;
+  __pyx_t_6 = 0;
+  while (1) {
+    __pyx_t_8 = __Pyx_dict_iter_next(__pyx_t_1, __pyx_t_3, &__pyx_t_4, &__pyx_t_6, &__pyx_t_7, NULL, __pyx_t_5);
+    if (unlikely(__pyx_t_8 == 0)) break;
+    if (unlikely(__pyx_t_8 == -1)) __PYX_ERR(0, 428, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_6);
+    __Pyx_GOTREF(__pyx_t_7);
+    __Pyx_XDECREF_SET(__pyx_v_key, __pyx_t_6);
+    __pyx_t_6 = 0;
+    __Pyx_XDECREF_SET(__pyx_v_value, __pyx_t_7);
+    __pyx_t_7 = 0;
+
+    /* "overload/bind.pyx":429
+ *     count = checkedCount(&instruction.check, len(obj))
+ *     for key, value in (<dict> obj).items():
+ *         if count == 0:             # <<<<<<<<<<<<<<
+ *             break
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+*/
+    __pyx_t_2 = (__pyx_v_count == 0);
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":430
+ *     for key, value in (<dict> obj).items():
+ *         if count == 0:
+ *             break             # <<<<<<<<<<<<<<
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+ *             return False
+*/
+      goto __pyx_L5_break;
+
+      /* "overload/bind.pyx":429
+ *     count = checkedCount(&instruction.check, len(obj))
+ *     for key, value in (<dict> obj).items():
+ *         if count == 0:             # <<<<<<<<<<<<<<
+ *             break
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+*/
+    }
+
+    /* "overload/bind.pyx":431
+ *         if count == 0:
+ *             break
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):             # <<<<<<<<<<<<<<
+ *             return False
+ *         count -= 1
+*/
+    __pyx_t_9 = __pyx_f_8overload_4bind_runProgram(__pyx_v_key_program, ((PyObject *)__pyx_v_key)); if (unlikely(__pyx_t_9 == ((int)-1))) __PYX_ERR(0, 431, __pyx_L1_error)
+    __pyx_t_10 = (!__pyx_t_9);
+
+
+    if (!__pyx_t_10) {
+
+    } else {
+
+      __pyx_t_2 = __pyx_t_10;
+
+      goto __pyx_L8_bool_binop_done;
+    }
+    __pyx_t_10 = __pyx_f_8overload_4bind_runProgram(__pyx_v_value_program, ((PyObject *)__pyx_v_value)); if (unlikely(__pyx_t_10 == ((int)-1))) __PYX_ERR(0, 431, __pyx_L1_error)
+    __pyx_t_9 = (!__pyx_t_10);
+
+
+
+    __pyx_t_2 = __pyx_t_9;
+
+    __pyx_L8_bool_binop_done:;
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":432
+ *             break
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+ *             return False             # <<<<<<<<<<<<<<
+ *         count -= 1
+ * 
+*/
+      {
+
+        __pyx_r = 0;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 57, 0, __PYX_ERR(0, 432, __pyx_L1_error));
+      __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":431
+ *         if count == 0:
+ *             break
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):             # <<<<<<<<<<<<<<
+ *             return False
+ *         count -= 1
+*/
+    }
+
+    /* "overload/bind.pyx":433
+ *         if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+ *             return False
+ *         count -= 1             # <<<<<<<<<<<<<<
+ * 
+ *     return True
+*/
+    __pyx_v_count = (__pyx_v_count - 1);
+  }
+  __pyx_L5_break:;
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":435
+ *         count -= 1
+ * 
+ *     return True             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = 1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 61, 0, __PYX_ERR(0, 435, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":415
+ * 
+ * 
+ * cdef bint runMapping(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Check keys and values of a mapping that matched the class of an OP_MAPPING instruction.
+ *     Elements are only checked in dicts, in iteration order. Sampling checks the first elements instead.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_6);
+  __Pyx_XDECREF(__pyx_t_7);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 415, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.runMapping", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+  __Pyx_XDECREF(__pyx_v_obj);
+  __Pyx_XDECREF(__pyx_v_key);
+  __Pyx_XDECREF(__pyx_v_value);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":438
+ * 
+ * 
+ * cdef Py_ssize_t matchDistance(const Matcher* matcher, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the annotation `matcher` was compiled from is for `arg`, which must match it.
+ *     Lower is more specific, see programDistance. Arguments that match anything have the largest
+*/
+
+static Py_ssize_t __pyx_f_8overload_4bind_matchDistance(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_matcher, PyObject *__pyx_v_arg) {
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  Py_ssize_t __pyx_t_2;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[17]))
+  __Pyx_TraceStartFunc("matchDistance", __pyx_f[0], 438, 0, 0, 0, __PYX_ERR(0, 438, __pyx_L1_error));
+
+  /* "overload/bind.pyx":443
+ *     distance, PY_SSIZE_T_MAX.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_ANY);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":444
+ *     """
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)
+*/
+    {
+
+      __pyx_r = PY_SSIZE_T_MAX;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 7, 0, __PYX_ERR(0, 444, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":443
+ *     distance, PY_SSIZE_T_MAX.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+*/
+  }
+
+  /* "overload/bind.pyx":445
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)
+ *     return programDistance(matcher.program.data(), arg)
+*/
+  switch (__pyx_v_matcher->kind) {
+    case __pyx_e_8overload_4bind_MATCH_TYPE:
+    case __pyx_e_8overload_4bind_MATCH_INSTANCE:
+
+    /* "overload/bind.pyx":446
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)             # <<<<<<<<<<<<<<
+ *     return programDistance(matcher.program.data(), arg)
+ * 
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_mroDistance(Py_TYPE(__pyx_v_arg), __pyx_v_matcher->annotation); if (unlikely(__pyx_t_2 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 446, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 19, 0, __PYX_ERR(0, 446, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":445
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)
+ *     return programDistance(matcher.program.data(), arg)
+*/
+    break;
+    default: break;
+  }
+
+  /* "overload/bind.pyx":447
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)
+ *     return programDistance(matcher.program.data(), arg)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_t_2 = __pyx_f_8overload_4bind_programDistance(__pyx_v_matcher->program.data(), __pyx_v_arg); if (unlikely(__pyx_t_2 == ((Py_ssize_t)-1L))) __PYX_ERR(0, 447, __pyx_L1_error)
+  {
+    __pyx_r = __pyx_t_2;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 27, 0, __PYX_ERR(0, 447, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":438
+ * 
+ * 
+ * cdef Py_ssize_t matchDistance(const Matcher* matcher, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the annotation `matcher` was compiled from is for `arg`, which must match it.
+ *     Lower is more specific, see programDistance. Arguments that match anything have the largest
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 438, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.matchDistance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":450
+ * 
+ * 
+ * cdef Py_ssize_t programDistance(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the program node at `instruction` is for `arg`, which must match it.
+ *     Classes are as specific as their position in the MRO of the argument type, counting from 1. Literals are the most
+*/
+
+static Py_ssize_t __pyx_f_8overload_4bind_programDistance(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_arg) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  Py_ssize_t __pyx_v_distance;
+  int __pyx_v_op;
+  CYTHON_UNUSED Py_ssize_t __pyx_v__;
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  Py_ssize_t __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  Py_ssize_t __pyx_t_8;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[18]))
+  __Pyx_TraceStartFunc("programDistance", __pyx_f[0], 450, 0, 0, 0, __PYX_ERR(0, 450, __pyx_L1_error));
+
+  /* "overload/bind.pyx":457
+ *     cdef const Instruction* child
+ *     cdef Py_ssize_t distance
+ *     cdef int op = instruction.op             # <<<<<<<<<<<<<<
+ * 
+ *     if op == OP_ANY:
+*/
+  __pyx_t_1 = __pyx_v_instruction->op;
+
+  __pyx_v_op = __pyx_t_1;
+
+  /* "overload/bind.pyx":459
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if op == OP_LITERAL:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_ANY);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":460
+ * 
+ *     if op == OP_ANY:
+ *         return PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ *     if op == OP_LITERAL:
+ *         return 0
+*/
+    {
+
+      __pyx_r = PY_SSIZE_T_MAX;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 9, 0, __PYX_ERR(0, 460, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":459
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if op == OP_LITERAL:
+*/
+  }
+
+  /* "overload/bind.pyx":461
+ *     if op == OP_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return 0
+ *     if op == OP_SUBCLASS:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_LITERAL);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":462
+ *         return PY_SSIZE_T_MAX
+ *     if op == OP_LITERAL:
+ *         return 0             # <<<<<<<<<<<<<<
+ *     if op == OP_SUBCLASS:
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+*/
+    {
+
+      __pyx_r = 0;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 15, 0, __PYX_ERR(0, 462, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":461
+ *     if op == OP_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return 0
+ *     if op == OP_SUBCLASS:
+*/
+  }
+
+  /* "overload/bind.pyx":463
+ *     if op == OP_LITERAL:
+ *         return 0
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+ *     if op == OP_TUPLE:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_SUBCLASS);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":464
+ *         return 0
+ *     if op == OP_SUBCLASS:
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)             # <<<<<<<<<<<<<<
+ *     if op == OP_TUPLE:
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_mroDistance(((PyTypeObject *)__pyx_v_arg), __pyx_v_instruction->value); if (unlikely(__pyx_t_3 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 464, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 21, 0, __PYX_ERR(0, 464, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":463
+ *     if op == OP_LITERAL:
+ *         return 0
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+ *     if op == OP_TUPLE:
+*/
+  }
+
+  /* "overload/bind.pyx":465
+ *     if op == OP_SUBCLASS:
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+ *     if op != OP_UNION:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TUPLE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":466
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+ *     if op == OP_TUPLE:
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)             # <<<<<<<<<<<<<<
+ *     if op != OP_UNION:
+ *         return mroDistance(Py_TYPE_PTR(arg), instruction.value)
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_mroDistance(Py_TYPE(__pyx_v_arg), ((PyObject *)(&PyTuple_Type))); if (unlikely(__pyx_t_3 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 466, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 32, 0, __PYX_ERR(0, 466, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":465
+ *     if op == OP_SUBCLASS:
+ *         return mroDistance(<PyTypeObject*> arg, instruction.value)
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+ *     if op != OP_UNION:
+*/
+  }
+
+  /* "overload/bind.pyx":467
+ *     if op == OP_TUPLE:
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+ *     if op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), instruction.value)
+ * 
+*/
+  __pyx_t_2 = (__pyx_v_op != __pyx_e_8overload_4bind_OP_UNION);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":468
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+ *     if op != OP_UNION:
+ *         return mroDistance(Py_TYPE_PTR(arg), instruction.value)             # <<<<<<<<<<<<<<
+ * 
+ *     distance = PY_SSIZE_T_MAX
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_mroDistance(Py_TYPE(__pyx_v_arg), __pyx_v_instruction->value); if (unlikely(__pyx_t_3 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 468, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 44, 0, __PYX_ERR(0, 468, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":467
+ *     if op == OP_TUPLE:
+ *         return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+ *     if op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return mroDistance(Py_TYPE_PTR(arg), instruction.value)
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":470
+ *         return mroDistance(Py_TYPE_PTR(arg), instruction.value)
+ * 
+ *     distance = PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+*/
+  __pyx_v_distance = PY_SSIZE_T_MAX;
+
+  /* "overload/bind.pyx":471
+ * 
+ *     distance = PY_SSIZE_T_MAX
+ *     child = instruction + 1             # <<<<<<<<<<<<<<
+ *     for _ in range(instruction.count):
+ *         if runProgram(child, arg):
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":472
+ *     distance = PY_SSIZE_T_MAX
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):             # <<<<<<<<<<<<<<
+ *         if runProgram(child, arg):
+ *             distance = min(distance, programDistance(child, arg))
+*/
+
+  __pyx_t_3 = __pyx_v_instruction->count;
+  __pyx_t_4 = __pyx_t_3;
+
+  for (__pyx_t_5 = 0; __pyx_t_5 < __pyx_t_4; __pyx_t_5+=1) {
+    __pyx_v__ = __pyx_t_5;
+
+    /* "overload/bind.pyx":473
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+ *         if runProgram(child, arg):             # <<<<<<<<<<<<<<
+ *             distance = min(distance, programDistance(child, arg))
+ *         child += child.size
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_runProgram(__pyx_v_child, __pyx_v_arg); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 473, __pyx_L1_error)
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":474
+ *     for _ in range(instruction.count):
+ *         if runProgram(child, arg):
+ *             distance = min(distance, programDistance(child, arg))             # <<<<<<<<<<<<<<
+ *         child += child.size
+ *     return distance
+*/
+      __pyx_t_6 = __pyx_f_8overload_4bind_programDistance(__pyx_v_child, __pyx_v_arg); if (unlikely(__pyx_t_6 == ((Py_ssize_t)-1L))) __PYX_ERR(0, 474, __pyx_L1_error)
+
+      __pyx_t_7 = __pyx_v_distance;
+      __pyx_t_2 = (__pyx_t_6 < __pyx_t_7);
+
+      if (__pyx_t_2) {
+
+        __pyx_t_8 = __pyx_t_6;
+      } else {
+
+        __pyx_t_8 = __pyx_t_7;
+      }
+
+
+      __pyx_v_distance = __pyx_t_8;
+
+
+      /* "overload/bind.pyx":473
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+ *         if runProgram(child, arg):             # <<<<<<<<<<<<<<
+ *             distance = min(distance, programDistance(child, arg))
+ *         child += child.size
+*/
+    }
+
+    /* "overload/bind.pyx":475
+ *         if runProgram(child, arg):
+ *             distance = min(distance, programDistance(child, arg))
+ *         child += child.size             # <<<<<<<<<<<<<<
+ *     return distance
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+  }
+
+
+  /* "overload/bind.pyx":476
+ *             distance = min(distance, programDistance(child, arg))
+ *         child += child.size
+ *     return distance             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_distance;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 79, 0, __PYX_ERR(0, 476, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":450
+ * 
+ * 
+ * cdef Py_ssize_t programDistance(const Instruction* instruction, PyObject* arg) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the program node at `instruction` is for `arg`, which must match it.
+ *     Classes are as specific as their position in the MRO of the argument type, counting from 1. Literals are the most
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 450, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.programDistance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":485
+ * 
+ * 
+ * cdef bint matchType(const Matcher* matcher, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if instances of the class `type` match the annotation `matcher` was compiled from.
+ *     Classes are compared with `issubclass`. Raise TypeError if the match depends on more than the type of an argument.
+*/
+
+static int __pyx_f_8overload_4bind_matchType(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_matcher, PyObject *__pyx_v_type) {
+  int __pyx_v_match;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
+  int __pyx_t_2;
+  PyObject *__pyx_t_3 = NULL;
+  PyObject *__pyx_t_4 = NULL;
+  PyObject *__pyx_t_5 = NULL;
+  PyObject *__pyx_t_6 = NULL;
+  PyObject *__pyx_t_7[5];
+  Py_ssize_t __pyx_t_8;
+  PyObject *__pyx_t_9 = NULL;
+  size_t __pyx_t_10;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[19]))
+  __Pyx_RefNannySetupContext("matchType", 0);
+  __Pyx_TraceStartFunc("matchType", __pyx_f[0], 485, 0, 0, 0, __PYX_ERR(0, 485, __pyx_L1_error));
+
+  /* "overload/bind.pyx":489
+ *     Classes are compared with `issubclass`. Raise TypeError if the match depends on more than the type of an argument.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return True
+ *     if matcher.kind == MATCH_TYPE:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_ANY);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":490
+ *     """
+ *     if matcher.kind == MATCH_ANY:
+ *         return True             # <<<<<<<<<<<<<<
+ *     if matcher.kind == MATCH_TYPE:
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 7, 0, __PYX_ERR(0, 490, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":489
+ *     Classes are compared with `issubclass`. Raise TypeError if the match depends on more than the type of an argument.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return True
+ *     if matcher.kind == MATCH_TYPE:
+*/
+  }
+
+  /* "overload/bind.pyx":491
+ *     if matcher.kind == MATCH_ANY:
+ *         return True
+ *     if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+ *     if matcher.kind == MATCH_INSTANCE:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_TYPE);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":492
+ *         return True
+ *     if matcher.kind == MATCH_TYPE:
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)             # <<<<<<<<<<<<<<
+ *     if matcher.kind == MATCH_INSTANCE:
+ *         return PyObject_IsSubclass_PTR(type, matcher.annotation)
+*/
+    {
+
+      __pyx_r = PyType_IsSubtype(((PyTypeObject *)__pyx_v_type), __pyx_v_matcher->type);
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 14, 0, __PYX_ERR(0, 492, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":491
+ *     if matcher.kind == MATCH_ANY:
+ *         return True
+ *     if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+ *     if matcher.kind == MATCH_INSTANCE:
+*/
+  }
+
+  /* "overload/bind.pyx":493
+ *     if matcher.kind == MATCH_TYPE:
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+ *     if matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return PyObject_IsSubclass_PTR(type, matcher.annotation)
+ * 
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_INSTANCE);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":494
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+ *     if matcher.kind == MATCH_INSTANCE:
+ *         return PyObject_IsSubclass_PTR(type, matcher.annotation)             # <<<<<<<<<<<<<<
+ * 
+ *     match = runTypeProgram(matcher.program.data(), type)
+*/
+    __pyx_t_2 = PyObject_IsSubclass(__pyx_v_type, __pyx_v_matcher->annotation); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 494, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 26, 0, __PYX_ERR(0, 494, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":493
+ *     if matcher.kind == MATCH_TYPE:
+ *         return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+ *     if matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return PyObject_IsSubclass_PTR(type, matcher.annotation)
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":496
+ *         return PyObject_IsSubclass_PTR(type, matcher.annotation)
+ * 
+ *     match = runTypeProgram(matcher.program.data(), type)             # <<<<<<<<<<<<<<
+ *     if match == TYPE_DEPENDS_ON_VALUE:
+ *         raise TypeError(
+*/
+  __pyx_t_2 = __pyx_f_8overload_4bind_runTypeProgram(__pyx_v_matcher->program.data(), __pyx_v_type); if (unlikely(__pyx_t_2 == ((int)-1))) __PYX_ERR(0, 496, __pyx_L1_error)
+  __pyx_v_match = __pyx_t_2;
+
+  /* "overload/bind.pyx":497
+ * 
+ *     match = runTypeProgram(matcher.program.data(), type)
+ *     if match == TYPE_DEPENDS_ON_VALUE:             # <<<<<<<<<<<<<<
+ *         raise TypeError(
+ *             f"annotation {<object> matcher.annotation!r} can not be matched by type for {<object> type!r}, "
+*/
+  __pyx_t_1 = (__pyx_v_match == __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE);
+
+  if (unlikely(__pyx_t_1)) {
+
+
+    /* "overload/bind.pyx":498
+ *     match = runTypeProgram(matcher.program.data(), type)
+ *     if match == TYPE_DEPENDS_ON_VALUE:
+ *         raise TypeError(             # <<<<<<<<<<<<<<
+ *             f"annotation {<object> matcher.annotation!r} can not be matched by type for {<object> type!r}, "
+ *             "use `resolve_for` with values of arguments"
+*/
+    __pyx_t_4 = NULL;
+
+    /* "overload/bind.pyx":499
+ *     if match == TYPE_DEPENDS_ON_VALUE:
+ *         raise TypeError(
+ *             f"annotation {<object> matcher.annotation!r} can not be matched by type for {<object> type!r}, "             # <<<<<<<<<<<<<<
+ *             "use `resolve_for` with values of arguments"
+ *         )
+*/
+    __pyx_t_5 = __Pyx_PyObject_FormatSimpleAndDecref(PyObject_Repr(((PyObject *)__pyx_v_matcher->annotation)), __pyx_mstate_global->__pyx_empty_unicode); if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 499, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_5);
+    __pyx_t_6 = __Pyx_PyObject_FormatSimpleAndDecref(PyObject_Repr(((PyObject *)__pyx_v_type)), __pyx_mstate_global->__pyx_empty_unicode); if (unlikely(!__pyx_t_6)) __PYX_ERR(0, 499, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_6);
+    __pyx_t_7[0] = __pyx_mstate_global->__pyx_kp_u_annotation;
+    __pyx_t_7[1] = __pyx_t_5;
+    __pyx_t_7[2] = __pyx_mstate_global->__pyx_kp_u_can_not_be_matched_by_type_for;
+    __pyx_t_7[3] = __pyx_t_6;
+    __pyx_t_7[4] = __pyx_mstate_global->__pyx_kp_u_use_resolve_for_with_values_of;
+    __pyx_t_8 = 87;
+    #if __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH
+    __pyx_t_8 += __Pyx_PyUnicode_GET_LENGTH(__pyx_t_7[1]) + __Pyx_PyUnicode_GET_LENGTH(__pyx_t_7[3]);
+    #endif
+    __pyx_t_2 = 0;
+    #if __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH
+    __pyx_t_2 |= __Pyx_PyUnicode_KIND_04(__pyx_t_7[1]) | __Pyx_PyUnicode_KIND_04(__pyx_t_7[3]);
+    #endif
+    __pyx_t_9 = __Pyx_PyUnicode_Join(__pyx_t_7, 5, __pyx_t_8, __pyx_t_2);
+    if (unlikely(!__pyx_t_9)) __PYX_ERR(0, 499, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_9);
+    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
+    __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
+    __pyx_t_10 = 1;
+    {
+      PyObject *__pyx_callargs[2] = {__pyx_t_4, __pyx_t_9};
+      __pyx_t_3 = __Pyx_PyObject_FastCall((PyObject*)(((PyTypeObject*)PyExc_TypeError)), __pyx_callargs+__pyx_t_10, (2-__pyx_t_10) | (__pyx_t_10*__Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET));
+      __Pyx_XDECREF(__pyx_t_4); __pyx_t_4 = 0;
+      __Pyx_DECREF(__pyx_t_9); __pyx_t_9 = 0;
+      if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 498, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_3);
+    }
+    __Pyx_Raise(__pyx_t_3, 0, 0, 0);
+    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
+    __PYX_ERR(0, 498, __pyx_L1_error)
+
+    /* "overload/bind.pyx":497
+ * 
+ *     match = runTypeProgram(matcher.program.data(), type)
+ *     if match == TYPE_DEPENDS_ON_VALUE:             # <<<<<<<<<<<<<<
+ *         raise TypeError(
+ *             f"annotation {<object> matcher.annotation!r} can not be matched by type for {<object> type!r}, "
+*/
+  }
+
+  /* "overload/bind.pyx":502
+ *             "use `resolve_for` with values of arguments"
+ *         )
+ *     return match == TYPE_MATCH             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = (__pyx_v_match == __pyx_e_8overload_4bind_TYPE_MATCH);
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 55, 0, __PYX_ERR(0, 502, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":485
+ * 
+ * 
+ * cdef bint matchType(const Matcher* matcher, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if instances of the class `type` match the annotation `matcher` was compiled from.
+ *     Classes are compared with `issubclass`. Raise TypeError if the match depends on more than the type of an argument.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_XDECREF(__pyx_t_4);
+  __Pyx_XDECREF(__pyx_t_5);
+  __Pyx_XDECREF(__pyx_t_6);
+  __Pyx_XDECREF(__pyx_t_9);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 485, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.matchType", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":505
+ * 
+ * 
+ * cdef int runTypeProgram(const Instruction* instruction, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return whether instances of the class `type` match the program node at `instruction`, as a TypeMatch.
+ *     Literals, tuples and the elements of containers depend on values, unless the class alone rules them out.
+*/
+
+static int __pyx_f_8overload_4bind_runTypeProgram(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_type) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  int __pyx_v_op;
+  int __pyx_v_match;
+  int __pyx_v_result;
+  CYTHON_UNUSED Py_ssize_t __pyx_v__;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  enum __pyx_t_8overload_4bind_TypeMatch __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  Py_ssize_t __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[20]))
+  __Pyx_TraceStartFunc("runTypeProgram", __pyx_f[0], 505, 0, 0, 0, __PYX_ERR(0, 505, __pyx_L1_error));
+
+  /* "overload/bind.pyx":510
+ *     """
+ *     cdef const Instruction* child
+ *     cdef int op = instruction.op             # <<<<<<<<<<<<<<
+ *     cdef int match
+ *     cdef int result
+*/
+  __pyx_t_1 = __pyx_v_instruction->op;
+
+  __pyx_v_op = __pyx_t_1;
+
+  /* "overload/bind.pyx":514
+ *     cdef int result
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_ANY);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":515
+ * 
+ *     if op == OP_ANY:
+ *         return TYPE_MATCH             # <<<<<<<<<<<<<<
+ *     if op == OP_TYPE:
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+*/
+    {
+
+      __pyx_r = __pyx_e_8overload_4bind_TYPE_MATCH;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 9, 0, __PYX_ERR(0, 515, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":514
+ *     cdef int result
+ * 
+ *     if op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:
+*/
+  }
+
+  /* "overload/bind.pyx":516
+ *     if op == OP_ANY:
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+ *             return TYPE_MATCH
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TYPE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":517
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):             # <<<<<<<<<<<<<<
+ *             return TYPE_MATCH
+ *         return TYPE_MISMATCH
+*/
+    __pyx_t_2 = PyType_IsSubtype(((PyTypeObject *)__pyx_v_type), ((PyTypeObject *)__pyx_v_instruction->value));
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":518
+ *     if op == OP_TYPE:
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+ *             return TYPE_MATCH             # <<<<<<<<<<<<<<
+ *         return TYPE_MISMATCH
+ *     if op == OP_INSTANCE:
+*/
+      {
+
+        __pyx_r = __pyx_e_8overload_4bind_TYPE_MATCH;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 23, 0, __PYX_ERR(0, 518, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":517
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):             # <<<<<<<<<<<<<<
+ *             return TYPE_MATCH
+ *         return TYPE_MISMATCH
+*/
+    }
+
+    /* "overload/bind.pyx":519
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+ *             return TYPE_MATCH
+ *         return TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *     if op == OP_INSTANCE:
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+*/
+    {
+
+      __pyx_r = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 25, 0, __PYX_ERR(0, 519, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":516
+ *     if op == OP_ANY:
+ *         return TYPE_MATCH
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+ *             return TYPE_MATCH
+*/
+  }
+
+  /* "overload/bind.pyx":520
+ *             return TYPE_MATCH
+ *         return TYPE_MISMATCH
+ *     if op == OP_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+ *     if op == OP_LITERAL:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_INSTANCE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":521
+ *         return TYPE_MISMATCH
+ *     if op == OP_INSTANCE:
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *     if op == OP_LITERAL:
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+*/
+    __pyx_t_1 = PyObject_IsSubclass(__pyx_v_type, __pyx_v_instruction->value); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(0, 521, __pyx_L1_error)
+    __pyx_t_2 = (__pyx_t_1 != 0);
+
+
+    if (__pyx_t_2) {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_MATCH;
+    } else {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+    }
+
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 31, 0, __PYX_ERR(0, 521, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":520
+ *             return TYPE_MATCH
+ *         return TYPE_MISMATCH
+ *     if op == OP_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+ *     if op == OP_LITERAL:
+*/
+  }
+
+  /* "overload/bind.pyx":522
+ *     if op == OP_INSTANCE:
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+ *     if op == OP_SUBCLASS:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_LITERAL);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":523
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+ *     if op == OP_LITERAL:
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *     if op == OP_SUBCLASS:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+*/
+    __pyx_t_2 = (((PyTypeObject *)__pyx_v_type) == Py_TYPE(__pyx_v_instruction->value));
+
+    if (__pyx_t_2) {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE;
+    } else {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+    }
+
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 43, 0, __PYX_ERR(0, 523, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":522
+ *     if op == OP_INSTANCE:
+ *         return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+ *     if op == OP_SUBCLASS:
+*/
+  }
+
+  /* "overload/bind.pyx":524
+ *     if op == OP_LITERAL:
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+ *     if op == OP_TUPLE:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_SUBCLASS);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":525
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+ *     if op == OP_SUBCLASS:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *     if op == OP_TUPLE:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH
+*/
+    __pyx_t_2 = PyType_IsSubtype(((PyTypeObject *)__pyx_v_type), (&PyType_Type));
+
+    if (__pyx_t_2) {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE;
+    } else {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+    }
+
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 57, 0, __PYX_ERR(0, 525, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":524
+ *     if op == OP_LITERAL:
+ *         return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+ *     if op == OP_TUPLE:
+*/
+  }
+
+  /* "overload/bind.pyx":526
+ *     if op == OP_SUBCLASS:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH
+ * 
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TUPLE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":527
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+ *     if op == OP_TUPLE:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ * 
+ *     child = instruction + 1
+*/
+    __pyx_t_2 = PyType_IsSubtype(((PyTypeObject *)__pyx_v_type), (&PyTuple_Type));
+
+    if (__pyx_t_2) {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE;
+    } else {
+
+      __pyx_t_3 = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+    }
+
+    {
+      __pyx_r = __pyx_t_3;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 70, 0, __PYX_ERR(0, 527, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":526
+ *     if op == OP_SUBCLASS:
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":529
+ *         return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH
+ * 
+ *     child = instruction + 1             # <<<<<<<<<<<<<<
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":530
+ * 
+ *     child = instruction + 1
+ *     if op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):
+ *             return TYPE_MISMATCH
+*/
+  switch (__pyx_v_op) {
+    case __pyx_e_8overload_4bind_OP_COLLECTION:
+    case __pyx_e_8overload_4bind_OP_MAPPING:
+
+    /* "overload/bind.pyx":531
+ *     child = instruction + 1
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):             # <<<<<<<<<<<<<<
+ *             return TYPE_MISMATCH
+ *         for _ in range(instruction.count):
+*/
+    __pyx_t_1 = PyObject_IsSubclass(__pyx_v_type, __pyx_v_instruction->value); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(0, 531, __pyx_L1_error)
+    __pyx_t_2 = (!(__pyx_t_1 != 0));
+
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":532
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):
+ *             return TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *         for _ in range(instruction.count):
+ *             if child.op != OP_ANY:
+*/
+      {
+
+        __pyx_r = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 98, 0, __PYX_ERR(0, 532, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":531
+ *     child = instruction + 1
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):             # <<<<<<<<<<<<<<
+ *             return TYPE_MISMATCH
+ *         for _ in range(instruction.count):
+*/
+    }
+
+    /* "overload/bind.pyx":533
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):
+ *             return TYPE_MISMATCH
+ *         for _ in range(instruction.count):             # <<<<<<<<<<<<<<
+ *             if child.op != OP_ANY:
+ *                 return TYPE_DEPENDS_ON_VALUE
+*/
+
+    __pyx_t_4 = __pyx_v_instruction->count;
+    __pyx_t_5 = __pyx_t_4;
+
+    for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_t_5; __pyx_t_6+=1) {
+      __pyx_v__ = __pyx_t_6;
+
+      /* "overload/bind.pyx":534
+ *             return TYPE_MISMATCH
+ *         for _ in range(instruction.count):
+ *             if child.op != OP_ANY:             # <<<<<<<<<<<<<<
+ *                 return TYPE_DEPENDS_ON_VALUE
+ *             child += child.size
+*/
+      __pyx_t_2 = (__pyx_v_child->op != __pyx_e_8overload_4bind_OP_ANY);
+
+      if (__pyx_t_2) {
+
+
+        /* "overload/bind.pyx":535
+ *         for _ in range(instruction.count):
+ *             if child.op != OP_ANY:
+ *                 return TYPE_DEPENDS_ON_VALUE             # <<<<<<<<<<<<<<
+ *             child += child.size
+ *         return TYPE_MATCH
+*/
+        {
+
+          __pyx_r = __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE;
+        }
+        __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 111, 0, __PYX_ERR(0, 535, __pyx_L1_error));
+        goto __pyx_L0;
+
+        /* "overload/bind.pyx":534
+ *             return TYPE_MISMATCH
+ *         for _ in range(instruction.count):
+ *             if child.op != OP_ANY:             # <<<<<<<<<<<<<<
+ *                 return TYPE_DEPENDS_ON_VALUE
+ *             child += child.size
+*/
+      }
+
+      /* "overload/bind.pyx":536
+ *             if child.op != OP_ANY:
+ *                 return TYPE_DEPENDS_ON_VALUE
+ *             child += child.size             # <<<<<<<<<<<<<<
+ *         return TYPE_MATCH
+ * 
+*/
+      __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+    }
+
+
+    /* "overload/bind.pyx":537
+ *                 return TYPE_DEPENDS_ON_VALUE
+ *             child += child.size
+ *         return TYPE_MATCH             # <<<<<<<<<<<<<<
+ * 
+ *     # OP_UNION
+*/
+    {
+
+      __pyx_r = __pyx_e_8overload_4bind_TYPE_MATCH;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 116, 0, __PYX_ERR(0, 537, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":530
+ * 
+ *     child = instruction + 1
+ *     if op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         if not PyObject_IsSubclass_PTR(type, instruction.value):
+ *             return TYPE_MISMATCH
+*/
+    break;
+    default: break;
+  }
+
+  /* "overload/bind.pyx":540
+ * 
+ *     # OP_UNION
+ *     result = TYPE_MISMATCH             # <<<<<<<<<<<<<<
+ *     for _ in range(instruction.count):
+ *         match = runTypeProgram(child, type)
+*/
+  __pyx_v_result = __pyx_e_8overload_4bind_TYPE_MISMATCH;
+
+  /* "overload/bind.pyx":541
+ *     # OP_UNION
+ *     result = TYPE_MISMATCH
+ *     for _ in range(instruction.count):             # <<<<<<<<<<<<<<
+ *         match = runTypeProgram(child, type)
+ *         if match == TYPE_MATCH:
+*/
+
+  __pyx_t_4 = __pyx_v_instruction->count;
+  __pyx_t_5 = __pyx_t_4;
+
+  for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_t_5; __pyx_t_6+=1) {
+    __pyx_v__ = __pyx_t_6;
+
+    /* "overload/bind.pyx":542
+ *     result = TYPE_MISMATCH
+ *     for _ in range(instruction.count):
+ *         match = runTypeProgram(child, type)             # <<<<<<<<<<<<<<
+ *         if match == TYPE_MATCH:
+ *             return TYPE_MATCH
+*/
+    __pyx_t_1 = __pyx_f_8overload_4bind_runTypeProgram(__pyx_v_child, __pyx_v_type); if (unlikely(__pyx_t_1 == ((int)-1))) __PYX_ERR(0, 542, __pyx_L1_error)
+    __pyx_v_match = __pyx_t_1;
+
+    /* "overload/bind.pyx":543
+ *     for _ in range(instruction.count):
+ *         match = runTypeProgram(child, type)
+ *         if match == TYPE_MATCH:             # <<<<<<<<<<<<<<
+ *             return TYPE_MATCH
+ *         if match == TYPE_DEPENDS_ON_VALUE:
+*/
+    __pyx_t_2 = (__pyx_v_match == __pyx_e_8overload_4bind_TYPE_MATCH);
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":544
+ *         match = runTypeProgram(child, type)
+ *         if match == TYPE_MATCH:
+ *             return TYPE_MATCH             # <<<<<<<<<<<<<<
+ *         if match == TYPE_DEPENDS_ON_VALUE:
+ *             result = TYPE_DEPENDS_ON_VALUE
+*/
+      {
+
+        __pyx_r = __pyx_e_8overload_4bind_TYPE_MATCH;
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 135, 0, __PYX_ERR(0, 544, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":543
+ *     for _ in range(instruction.count):
+ *         match = runTypeProgram(child, type)
+ *         if match == TYPE_MATCH:             # <<<<<<<<<<<<<<
+ *             return TYPE_MATCH
+ *         if match == TYPE_DEPENDS_ON_VALUE:
+*/
+    }
+
+    /* "overload/bind.pyx":545
+ *         if match == TYPE_MATCH:
+ *             return TYPE_MATCH
+ *         if match == TYPE_DEPENDS_ON_VALUE:             # <<<<<<<<<<<<<<
+ *             result = TYPE_DEPENDS_ON_VALUE
+ *         child += child.size
+*/
+    __pyx_t_2 = (__pyx_v_match == __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE);
+
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":546
+ *             return TYPE_MATCH
+ *         if match == TYPE_DEPENDS_ON_VALUE:
+ *             result = TYPE_DEPENDS_ON_VALUE             # <<<<<<<<<<<<<<
+ *         child += child.size
+ *     return result
+*/
+      __pyx_v_result = __pyx_e_8overload_4bind_TYPE_DEPENDS_ON_VALUE;
+
+      /* "overload/bind.pyx":545
+ *         if match == TYPE_MATCH:
+ *             return TYPE_MATCH
+ *         if match == TYPE_DEPENDS_ON_VALUE:             # <<<<<<<<<<<<<<
+ *             result = TYPE_DEPENDS_ON_VALUE
+ *         child += child.size
+*/
+    }
+
+    /* "overload/bind.pyx":547
+ *         if match == TYPE_DEPENDS_ON_VALUE:
+ *             result = TYPE_DEPENDS_ON_VALUE
+ *         child += child.size             # <<<<<<<<<<<<<<
+ *     return result
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+  }
+
+
+  /* "overload/bind.pyx":548
+ *             result = TYPE_DEPENDS_ON_VALUE
+ *         child += child.size
+ *     return result             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_result;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyLong_From_int, 146, 0, __PYX_ERR(0, 548, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":505
+ * 
+ * 
+ * cdef int runTypeProgram(const Instruction* instruction, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return whether instances of the class `type` match the program node at `instruction`, as a TypeMatch.
+ *     Literals, tuples and the elements of containers depend on values, unless the class alone rules them out.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 505, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.runTypeProgram", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":551
+ * 
+ * 
+ * cdef Py_ssize_t typeDistance(const Matcher* matcher, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the annotation `matcher` was compiled from is for instances of the class `type`, which
+ *     must match it, see matchDistance.
+*/
+
+static Py_ssize_t __pyx_f_8overload_4bind_typeDistance(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_matcher, PyObject *__pyx_v_type) {
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  Py_ssize_t __pyx_t_2;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[21]))
+  __Pyx_TraceStartFunc("typeDistance", __pyx_f[0], 551, 0, 0, 0, __PYX_ERR(0, 551, __pyx_L1_error));
+
+  /* "overload/bind.pyx":555
+ *     must match it, see matchDistance.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_ANY);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":556
+ *     """
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(<PyTypeObject*> type, matcher.annotation)
+*/
+    {
+
+      __pyx_r = PY_SSIZE_T_MAX;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 7, 0, __PYX_ERR(0, 556, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":555
+ *     must match it, see matchDistance.
+ *     """
+ *     if matcher.kind == MATCH_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+*/
+  }
+
+  /* "overload/bind.pyx":557
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> type, matcher.annotation)
+ *     return typeProgramDistance(matcher.program.data(), type)
+*/
+  switch (__pyx_v_matcher->kind) {
+    case __pyx_e_8overload_4bind_MATCH_TYPE:
+    case __pyx_e_8overload_4bind_MATCH_INSTANCE:
+
+    /* "overload/bind.pyx":558
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(<PyTypeObject*> type, matcher.annotation)             # <<<<<<<<<<<<<<
+ *     return typeProgramDistance(matcher.program.data(), type)
+ * 
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_mroDistance(((PyTypeObject *)__pyx_v_type), __pyx_v_matcher->annotation); if (unlikely(__pyx_t_2 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 558, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 19, 0, __PYX_ERR(0, 558, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":557
+ *     if matcher.kind == MATCH_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> type, matcher.annotation)
+ *     return typeProgramDistance(matcher.program.data(), type)
+*/
+    break;
+    default: break;
+  }
+
+  /* "overload/bind.pyx":559
+ *     if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+ *         return mroDistance(<PyTypeObject*> type, matcher.annotation)
+ *     return typeProgramDistance(matcher.program.data(), type)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_t_2 = __pyx_f_8overload_4bind_typeProgramDistance(__pyx_v_matcher->program.data(), __pyx_v_type); if (unlikely(__pyx_t_2 == ((Py_ssize_t)-1L))) __PYX_ERR(0, 559, __pyx_L1_error)
+  {
+    __pyx_r = __pyx_t_2;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 26, 0, __PYX_ERR(0, 559, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":551
+ * 
+ * 
+ * cdef Py_ssize_t typeDistance(const Matcher* matcher, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the annotation `matcher` was compiled from is for instances of the class `type`, which
+ *     must match it, see matchDistance.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 551, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.typeDistance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":562
+ * 
+ * 
+ * cdef Py_ssize_t typeProgramDistance(const Instruction* instruction, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the program node at `instruction` is for instances of the class `type`, see
+ *     programDistance. Only alternatives of unions that match by type alone are counted.
+*/
+
+static Py_ssize_t __pyx_f_8overload_4bind_typeProgramDistance(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction, PyObject *__pyx_v_type) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  Py_ssize_t __pyx_v_distance;
+  CYTHON_UNUSED Py_ssize_t __pyx_v__;
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  Py_ssize_t __pyx_t_2;
+  Py_ssize_t __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  int __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  Py_ssize_t __pyx_t_7;
+  Py_ssize_t __pyx_t_8;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[22]))
+  __Pyx_TraceStartFunc("typeProgramDistance", __pyx_f[0], 562, 0, 0, 0, __PYX_ERR(0, 562, __pyx_L1_error));
+
+  /* "overload/bind.pyx":567
+ *     """
+ *     cdef const Instruction* child
+ *     cdef Py_ssize_t distance = PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ * 
+ *     if instruction.op == OP_ANY:
+*/
+  __pyx_v_distance = PY_SSIZE_T_MAX;
+
+  /* "overload/bind.pyx":569
+ *     cdef Py_ssize_t distance = PY_SSIZE_T_MAX
+ * 
+ *     if instruction.op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if instruction.op != OP_UNION:
+*/
+  __pyx_t_1 = (__pyx_v_instruction->op == __pyx_e_8overload_4bind_OP_ANY);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":570
+ * 
+ *     if instruction.op == OP_ANY:
+ *         return PY_SSIZE_T_MAX             # <<<<<<<<<<<<<<
+ *     if instruction.op != OP_UNION:
+ *         return mroDistance(<PyTypeObject*> type, instruction.value)
+*/
+    {
+
+      __pyx_r = PY_SSIZE_T_MAX;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 9, 0, __PYX_ERR(0, 570, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":569
+ *     cdef Py_ssize_t distance = PY_SSIZE_T_MAX
+ * 
+ *     if instruction.op == OP_ANY:             # <<<<<<<<<<<<<<
+ *         return PY_SSIZE_T_MAX
+ *     if instruction.op != OP_UNION:
+*/
+  }
+
+  /* "overload/bind.pyx":571
+ *     if instruction.op == OP_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if instruction.op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> type, instruction.value)
+ * 
+*/
+  __pyx_t_1 = (__pyx_v_instruction->op != __pyx_e_8overload_4bind_OP_UNION);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":572
+ *         return PY_SSIZE_T_MAX
+ *     if instruction.op != OP_UNION:
+ *         return mroDistance(<PyTypeObject*> type, instruction.value)             # <<<<<<<<<<<<<<
+ * 
+ *     child = instruction + 1
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_mroDistance(((PyTypeObject *)__pyx_v_type), __pyx_v_instruction->value); if (unlikely(__pyx_t_2 == ((Py_ssize_t)-1L) && PyErr_Occurred())) __PYX_ERR(0, 572, __pyx_L1_error)
+    {
+      __pyx_r = __pyx_t_2;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 16, 0, __PYX_ERR(0, 572, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":571
+ *     if instruction.op == OP_ANY:
+ *         return PY_SSIZE_T_MAX
+ *     if instruction.op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return mroDistance(<PyTypeObject*> type, instruction.value)
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":574
+ *         return mroDistance(<PyTypeObject*> type, instruction.value)
+ * 
+ *     child = instruction + 1             # <<<<<<<<<<<<<<
+ *     for _ in range(instruction.count):
+ *         if runTypeProgram(child, type) == TYPE_MATCH:
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":575
+ * 
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):             # <<<<<<<<<<<<<<
+ *         if runTypeProgram(child, type) == TYPE_MATCH:
+ *             distance = min(distance, typeProgramDistance(child, type))
+*/
+
+  __pyx_t_2 = __pyx_v_instruction->count;
+  __pyx_t_3 = __pyx_t_2;
+
+  for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_t_3; __pyx_t_4+=1) {
+    __pyx_v__ = __pyx_t_4;
+
+    /* "overload/bind.pyx":576
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+ *         if runTypeProgram(child, type) == TYPE_MATCH:             # <<<<<<<<<<<<<<
+ *             distance = min(distance, typeProgramDistance(child, type))
+ *         child += child.size
+*/
+    __pyx_t_5 = __pyx_f_8overload_4bind_runTypeProgram(__pyx_v_child, __pyx_v_type); if (unlikely(__pyx_t_5 == ((int)-1))) __PYX_ERR(0, 576, __pyx_L1_error)
+    __pyx_t_1 = (__pyx_t_5 == __pyx_e_8overload_4bind_TYPE_MATCH);
+
+
+    if (__pyx_t_1) {
+
+
+      /* "overload/bind.pyx":577
+ *     for _ in range(instruction.count):
+ *         if runTypeProgram(child, type) == TYPE_MATCH:
+ *             distance = min(distance, typeProgramDistance(child, type))             # <<<<<<<<<<<<<<
+ *         child += child.size
+ *     return distance
+*/
+      __pyx_t_6 = __pyx_f_8overload_4bind_typeProgramDistance(__pyx_v_child, __pyx_v_type); if (unlikely(__pyx_t_6 == ((Py_ssize_t)-1L))) __PYX_ERR(0, 577, __pyx_L1_error)
+
+      __pyx_t_7 = __pyx_v_distance;
+      __pyx_t_1 = (__pyx_t_6 < __pyx_t_7);
+
+      if (__pyx_t_1) {
+
+        __pyx_t_8 = __pyx_t_6;
+      } else {
+
+        __pyx_t_8 = __pyx_t_7;
+      }
+
+
+      __pyx_v_distance = __pyx_t_8;
+
+
+      /* "overload/bind.pyx":576
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+ *         if runTypeProgram(child, type) == TYPE_MATCH:             # <<<<<<<<<<<<<<
+ *             distance = min(distance, typeProgramDistance(child, type))
+ *         child += child.size
+*/
+    }
+
+    /* "overload/bind.pyx":578
+ *         if runTypeProgram(child, type) == TYPE_MATCH:
+ *             distance = min(distance, typeProgramDistance(child, type))
+ *         child += child.size             # <<<<<<<<<<<<<<
+ *     return distance
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+  }
+
+
+  /* "overload/bind.pyx":579
+ *             distance = min(distance, typeProgramDistance(child, type))
+ *         child += child.size
+ *     return distance             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = __pyx_v_distance;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 50, 0, __PYX_ERR(0, 579, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":562
+ * 
+ * 
+ * cdef Py_ssize_t typeProgramDistance(const Instruction* instruction, PyObject* type) except -1:             # <<<<<<<<<<<<<<
+ *     """Return how specific the program node at `instruction` is for instances of the class `type`, see
+ *     programDistance. Only alternatives of unions that match by type alone are counted.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 562, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.typeProgramDistance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":582
+ * 
+ * 
+ * cdef Py_ssize_t mroDistance(PyTypeObject* type, PyObject* cls):             # <<<<<<<<<<<<<<
+ *     """Return the 1-based position of `cls` in the MRO of `type`.
+ *     Classes that are not in the MRO, like ABCs that `type` was registered with, are placed after all of it.
+*/
+
+static Py_ssize_t __pyx_f_8overload_4bind_mroDistance(PyTypeObject *__pyx_v_type, PyObject *__pyx_v_cls) {
+  PyObject *__pyx_v_mro = 0;
+  Py_ssize_t __pyx_v_i;
+  Py_ssize_t __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1;
+  PyObject *__pyx_t_2 = NULL;
+  Py_ssize_t __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  Py_ssize_t __pyx_t_5;
+  int __pyx_t_6;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[23]))
+  __Pyx_RefNannySetupContext("mroDistance", 0);
+  __Pyx_TraceStartFunc("mroDistance", __pyx_f[0], 582, 0, 0, 0, __PYX_ERR(0, 582, __pyx_L1_error));
+
+  /* "overload/bind.pyx":586
+ *     Classes that are not in the MRO, like ABCs that `type` was registered with, are placed after all of it.
+ *     """
+ *     cdef tuple mro = <tuple> ovl_type_mro(type)             # <<<<<<<<<<<<<<
+ *     cdef Py_ssize_t i
+ * 
+*/
+  __pyx_t_1 = ovl_type_mro(__pyx_v_type);
+
+  __pyx_t_2 = ((PyObject *)__pyx_t_1);
+  __Pyx_INCREF(__pyx_t_2);
+
+  __pyx_v_mro = ((PyObject*)__pyx_t_2);
+  __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":589
+ *     cdef Py_ssize_t i
+ * 
+ *     for i in range(PyTuple_GET_SIZE(mro)):             # <<<<<<<<<<<<<<
+ *         if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:
+ *             return i + 1
+*/
+
+  __pyx_t_3 = PyTuple_GET_SIZE(__pyx_v_mro);
+  __pyx_t_4 = __pyx_t_3;
+
+  for (__pyx_t_5 = 0; __pyx_t_5 < __pyx_t_4; __pyx_t_5+=1) {
+    __pyx_v_i = __pyx_t_5;
+
+    /* "overload/bind.pyx":590
+ * 
+ *     for i in range(PyTuple_GET_SIZE(mro)):
+ *         if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:             # <<<<<<<<<<<<<<
+ *             return i + 1
+ *     return PyTuple_GET_SIZE(mro) + 1
+*/
+    __pyx_t_6 = (((PyObject *)PyTuple_GET_ITEM(__pyx_v_mro, __pyx_v_i)) == __pyx_v_cls);
+
+    if (__pyx_t_6) {
+
+
+      /* "overload/bind.pyx":591
+ *     for i in range(PyTuple_GET_SIZE(mro)):
+ *         if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:
+ *             return i + 1             # <<<<<<<<<<<<<<
+ *     return PyTuple_GET_SIZE(mro) + 1
+ * 
+*/
+      {
+
+        __pyx_r = (__pyx_v_i + 1);
+      }
+      __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 22, 0, __PYX_ERR(0, 591, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":590
+ * 
+ *     for i in range(PyTuple_GET_SIZE(mro)):
+ *         if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:             # <<<<<<<<<<<<<<
+ *             return i + 1
+ *     return PyTuple_GET_SIZE(mro) + 1
+*/
+    }
+  }
+
+
+  /* "overload/bind.pyx":592
+ *         if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:
+ *             return i + 1
+ *     return PyTuple_GET_SIZE(mro) + 1             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = (PyTuple_GET_SIZE(__pyx_v_mro) + 1);
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, PyLong_FromSsize_t, 26, 0, __PYX_ERR(0, 592, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":582
+ * 
+ * 
+ * cdef Py_ssize_t mroDistance(PyTypeObject* type, PyObject* cls):             # <<<<<<<<<<<<<<
+ *     """Return the 1-based position of `cls` in the MRO of `type`.
+ *     Classes that are not in the MRO, like ABCs that `type` was registered with, are placed after all of it.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 582, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.mroDistance", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1L;
+  __pyx_L0:;
+  __Pyx_XDECREF(__pyx_v_mro);
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":595
+ * 
+ * 
+ * cdef bint matchersDisjoint(const Matcher* lhs, const Matcher* rhs) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if no argument can match both `lhs` and `rhs`.
+ *     This is a conservative check: False means that an argument may match both.
+*/
+
+static int __pyx_f_8overload_4bind_matchersDisjoint(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_lhs, struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_rhs) {
+  PyObject *__pyx_v_lhs_cover = NULL;
+  PyObject *__pyx_v_rhs_cover = NULL;
+  PyObject *__pyx_v_lhs_type = NULL;
+  PyObject *__pyx_v_rhs_type = NULL;
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_t_2;
+  int __pyx_t_3;
+  Py_ssize_t __pyx_t_4;
+  PyObject *__pyx_t_5 = NULL;
+  Py_ssize_t __pyx_t_6;
+  PyObject *__pyx_t_7 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[24]))
+  __Pyx_RefNannySetupContext("matchersDisjoint", 0);
+  __Pyx_TraceStartFunc("matchersDisjoint", __pyx_f[0], 595, 0, 0, 0, __PYX_ERR(0, 595, __pyx_L1_error));
+
+  /* "overload/bind.pyx":599
+ *     This is a conservative check: False means that an argument may match both.
+ *     """
+ *     lhs_cover = matcherCover(lhs)             # <<<<<<<<<<<<<<
+ *     rhs_cover = matcherCover(rhs)
+ *     if lhs_cover is None or rhs_cover is None:
+*/
+  __pyx_t_1 = __pyx_f_8overload_4bind_matcherCover(__pyx_v_lhs); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 599, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_v_lhs_cover = ((PyObject*)__pyx_t_1);
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":600
+ *     """
+ *     lhs_cover = matcherCover(lhs)
+ *     rhs_cover = matcherCover(rhs)             # <<<<<<<<<<<<<<
+ *     if lhs_cover is None or rhs_cover is None:
+ *         return False
+*/
+  __pyx_t_1 = __pyx_f_8overload_4bind_matcherCover(__pyx_v_rhs); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 600, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_v_rhs_cover = ((PyObject*)__pyx_t_1);
+  __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":601
+ *     lhs_cover = matcherCover(lhs)
+ *     rhs_cover = matcherCover(rhs)
+ *     if lhs_cover is None or rhs_cover is None:             # <<<<<<<<<<<<<<
+ *         return False
+ * 
+*/
+  __pyx_t_3 = (__pyx_v_lhs_cover == ((PyObject*)Py_None));
+  if (!__pyx_t_3) {
+
+  } else {
+
+    __pyx_t_2 = __pyx_t_3;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_3 = (__pyx_v_rhs_cover == ((PyObject*)Py_None));
+
+  __pyx_t_2 = __pyx_t_3;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":602
+ *     rhs_cover = matcherCover(rhs)
+ *     if lhs_cover is None or rhs_cover is None:
+ *         return False             # <<<<<<<<<<<<<<
+ * 
+ *     for lhs_type in lhs_cover:
+*/
+    {
+
+      __pyx_r = 0;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 18, 0, __PYX_ERR(0, 602, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":601
+ *     lhs_cover = matcherCover(lhs)
+ *     rhs_cover = matcherCover(rhs)
+ *     if lhs_cover is None or rhs_cover is None:             # <<<<<<<<<<<<<<
+ *         return False
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":604
+ *         return False
+ * 
+ *     for lhs_type in lhs_cover:             # <<<<<<<<<<<<<<
+ *         for rhs_type in rhs_cover:
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+*/
+  if (unlikely(__pyx_v_lhs_cover == Py_None)) {
+    PyErr_SetString(PyExc_TypeError, "\047NoneType\047 object is not iterable");
+    __PYX_ERR(0, 604, __pyx_L1_error)
+  }
+  __pyx_t_1 = __pyx_v_lhs_cover; __Pyx_INCREF(__pyx_t_1);
+  __pyx_t_4 = 0;
+  for (;;) {
+    {
+      Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_1);
+      #if !CYTHON_ASSUME_SAFE_SIZE
+      if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 604, __pyx_L1_error)
+      #endif
+      if (__pyx_t_4 >= __pyx_temp) break;
+    }
+    #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+    __pyx_t_5 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_1, __pyx_t_4));
+    #else
+    __pyx_t_5 = __Pyx_PySequence_ITEM(__pyx_t_1, __pyx_t_4);
+    #endif
+    ++__pyx_t_4;
+    if (unlikely(!__pyx_t_5)) __PYX_ERR(0, 604, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_5);
+    __Pyx_XDECREF_SET(__pyx_v_lhs_type, __pyx_t_5);
+    __pyx_t_5 = 0;
+
+    /* "overload/bind.pyx":605
+ * 
+ *     for lhs_type in lhs_cover:
+ *         for rhs_type in rhs_cover:             # <<<<<<<<<<<<<<
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+ *                 return False
+*/
+    if (unlikely(__pyx_v_rhs_cover == Py_None)) {
+      PyErr_SetString(PyExc_TypeError, "\047NoneType\047 object is not iterable");
+      __PYX_ERR(0, 605, __pyx_L1_error)
+    }
+    __pyx_t_5 = __pyx_v_rhs_cover; __Pyx_INCREF(__pyx_t_5);
+    __pyx_t_6 = 0;
+    for (;;) {
+      {
+        Py_ssize_t __pyx_temp = __Pyx_PyTuple_GET_SIZE(__pyx_t_5);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely((__pyx_temp < 0))) __PYX_ERR(0, 605, __pyx_L1_error)
+        #endif
+        if (__pyx_t_6 >= __pyx_temp) break;
+      }
+      #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+      __pyx_t_7 = __Pyx_NewRef(PyTuple_GET_ITEM(__pyx_t_5, __pyx_t_6));
+      #else
+      __pyx_t_7 = __Pyx_PySequence_ITEM(__pyx_t_5, __pyx_t_6);
+      #endif
+      ++__pyx_t_6;
+      if (unlikely(!__pyx_t_7)) __PYX_ERR(0, 605, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_7);
+      __Pyx_XDECREF_SET(__pyx_v_rhs_type, __pyx_t_7);
+      __pyx_t_7 = 0;
+
+      /* "overload/bind.pyx":606
+ *     for lhs_type in lhs_cover:
+ *         for rhs_type in rhs_cover:
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):             # <<<<<<<<<<<<<<
+ *                 return False
+ *     return True
+*/
+      __pyx_t_2 = __pyx_f_8overload_4bind_typesDisjoint(((PyTypeObject *)__pyx_v_lhs_type), ((PyTypeObject *)__pyx_v_rhs_type)); if (unlikely(__pyx_t_2 == ((int)-1) && PyErr_Occurred())) __PYX_ERR(0, 606, __pyx_L1_error)
+      __pyx_t_3 = (!__pyx_t_2);
+
+
+      if (__pyx_t_3) {
+
+
+        /* "overload/bind.pyx":607
+ *         for rhs_type in rhs_cover:
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+ *                 return False             # <<<<<<<<<<<<<<
+ *     return True
+ * 
+*/
+        {
+
+          __pyx_r = 0;
+        }
+        __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 34, 0, __PYX_ERR(0, 607, __pyx_L1_error));
+        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+        __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
+        goto __pyx_L0;
+
+        /* "overload/bind.pyx":606
+ *     for lhs_type in lhs_cover:
+ *         for rhs_type in rhs_cover:
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):             # <<<<<<<<<<<<<<
+ *                 return False
+ *     return True
+*/
+      }
+
+      /* "overload/bind.pyx":605
+ * 
+ *     for lhs_type in lhs_cover:
+ *         for rhs_type in rhs_cover:             # <<<<<<<<<<<<<<
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+ *                 return False
+*/
+    }
+    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
+
+    /* "overload/bind.pyx":604
+ *         return False
+ * 
+ *     for lhs_type in lhs_cover:             # <<<<<<<<<<<<<<
+ *         for rhs_type in rhs_cover:
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+*/
+  }
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+
+  /* "overload/bind.pyx":608
+ *             if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+ *                 return False
+ *     return True             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+
+    __pyx_r = 1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 36, 0, __PYX_ERR(0, 608, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":595
+ * 
+ * 
+ * cdef bint matchersDisjoint(const Matcher* lhs, const Matcher* rhs) except -1:             # <<<<<<<<<<<<<<
+ *     """Return True if no argument can match both `lhs` and `rhs`.
+ *     This is a conservative check: False means that an argument may match both.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_XDECREF(__pyx_t_5);
+  __Pyx_XDECREF(__pyx_t_7);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 595, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.matchersDisjoint", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+  __Pyx_XDECREF(__pyx_v_lhs_cover);
+  __Pyx_XDECREF(__pyx_v_rhs_cover);
+  __Pyx_XDECREF(__pyx_v_lhs_type);
+  __Pyx_XDECREF(__pyx_v_rhs_type);
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":611
+ * 
+ * 
+ * cdef tuple matcherCover(const Matcher* matcher):             # <<<<<<<<<<<<<<
+ *     """Return a tuple of plain classes, such that every argument that matches `matcher` is an instance of one of
+ *     them, or None if `matcher` can not be described like that.
+*/
+
+static PyObject *__pyx_f_8overload_4bind_matcherCover(struct __pyx_t_8overload_4bind_Matcher const *__pyx_v_matcher) {
+  PyObject *__pyx_r = NULL;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
+  PyObject *__pyx_t_2 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[25]))
+  __Pyx_RefNannySetupContext("matcherCover", 0);
+  __Pyx_TraceStartFunc("matcherCover", __pyx_f[0], 611, 0, 0, 0, __PYX_ERR(0, 611, __pyx_L1_error));
+
+  /* "overload/bind.pyx":615
+ *     them, or None if `matcher` can not be described like that.
+ *     """
+ *     if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ *         return (<object> matcher.type,)
+ *     if matcher.kind == MATCH_PROGRAM:
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_TYPE);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":616
+ *     """
+ *     if matcher.kind == MATCH_TYPE:
+ *         return (<object> matcher.type,)             # <<<<<<<<<<<<<<
+ *     if matcher.kind == MATCH_PROGRAM:
+ *         return programCover(matcher.program.data())
+*/
+    __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 616, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_2);
+    __Pyx_INCREF(((PyObject *)__pyx_v_matcher->type));
+    __Pyx_GIVEREF(((PyObject *)__pyx_v_matcher->type));
+    if (__Pyx_PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_v_matcher->type)) != (0)) __PYX_ERR(0, 616, __pyx_L1_error);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_2);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_2 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 6, 0, __PYX_ERR(0, 616, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":615
+ *     them, or None if `matcher` can not be described like that.
+ *     """
+ *     if matcher.kind == MATCH_TYPE:             # <<<<<<<<<<<<<<
+ *         return (<object> matcher.type,)
+ *     if matcher.kind == MATCH_PROGRAM:
+*/
+  }
+
+  /* "overload/bind.pyx":617
+ *     if matcher.kind == MATCH_TYPE:
+ *         return (<object> matcher.type,)
+ *     if matcher.kind == MATCH_PROGRAM:             # <<<<<<<<<<<<<<
+ *         return programCover(matcher.program.data())
+ *     return None
+*/
+  __pyx_t_1 = (__pyx_v_matcher->kind == __pyx_e_8overload_4bind_MATCH_PROGRAM);
+
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":618
+ *         return (<object> matcher.type,)
+ *     if matcher.kind == MATCH_PROGRAM:
+ *         return programCover(matcher.program.data())             # <<<<<<<<<<<<<<
+ *     return None
+ * 
+*/
+    __pyx_t_2 = __pyx_f_8overload_4bind_programCover(__pyx_v_matcher->program.data()); if (unlikely(!__pyx_t_2)) __PYX_ERR(0, 618, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_2);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_2);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_2 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 15, 0, __PYX_ERR(0, 618, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":617
+ *     if matcher.kind == MATCH_TYPE:
+ *         return (<object> matcher.type,)
+ *     if matcher.kind == MATCH_PROGRAM:             # <<<<<<<<<<<<<<
+ *         return programCover(matcher.program.data())
+ *     return None
+*/
+  }
+
+  /* "overload/bind.pyx":619
+ *     if matcher.kind == MATCH_PROGRAM:
+ *         return programCover(matcher.program.data())
+ *     return None             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+    PyObject *__pyx_temp;
+    {
+      __pyx_temp = __pyx_r;
+      __pyx_r = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
+    }
+    __Pyx_XDECREF(__pyx_temp);
+  }
+  __Pyx_TraceReturnValue(__pyx_r, 22, 0, __PYX_ERR(0, 619, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":611
+ * 
+ * 
+ * cdef tuple matcherCover(const Matcher* matcher):             # <<<<<<<<<<<<<<
+ *     """Return a tuple of plain classes, such that every argument that matches `matcher` is an instance of one of
+ *     them, or None if `matcher` can not be described like that.
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 611, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.matcherCover", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = 0;
+  __pyx_L0:;
+  __Pyx_XGIVEREF(__pyx_r);
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":622
+ * 
+ * 
+ * cdef tuple programCover(const Instruction* instruction):             # <<<<<<<<<<<<<<
+ *     """Return a tuple of plain classes that covers the program node at `instruction`, see matcherCover."""
+ *     cdef const Instruction* child
+*/
+
+static PyObject *__pyx_f_8overload_4bind_programCover(struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_instruction) {
+  struct __pyx_t_8overload_4bind_Instruction const *__pyx_v_child;
+  int __pyx_v_op;
+  PyObject *__pyx_v_result = NULL;
+  CYTHON_UNUSED Py_ssize_t __pyx_v__;
+  PyObject *__pyx_v_cover = NULL;
+  PyObject *__pyx_r = NULL;
+  __Pyx_TraceDeclarationsFunc
+  __Pyx_RefNannyDeclarations
+  int __pyx_t_1;
+  int __pyx_t_2;
+  PyObject *__pyx_t_3 = NULL;
+  Py_ssize_t __pyx_t_4;
+  Py_ssize_t __pyx_t_5;
+  Py_ssize_t __pyx_t_6;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[26]))
+  __Pyx_RefNannySetupContext("programCover", 0);
+  __Pyx_TraceStartFunc("programCover", __pyx_f[0], 622, 0, 0, 0, __PYX_ERR(0, 622, __pyx_L1_error));
+
+  /* "overload/bind.pyx":625
+ *     """Return a tuple of plain classes that covers the program node at `instruction`, see matcherCover."""
+ *     cdef const Instruction* child
+ *     cdef int op = instruction.op             # <<<<<<<<<<<<<<
+ * 
+ *     if op == OP_TYPE:
+*/
+  __pyx_t_1 = __pyx_v_instruction->op;
+
+  __pyx_v_op = __pyx_t_1;
+
+  /* "overload/bind.pyx":627
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         return (<object> instruction.value,)
+ *     if op == OP_LITERAL:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TYPE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":628
+ * 
+ *     if op == OP_TYPE:
+ *         return (<object> instruction.value,)             # <<<<<<<<<<<<<<
+ *     if op == OP_LITERAL:
+ *         return (type(<object> instruction.value),)
+*/
+    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 628, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_INCREF(((PyObject *)__pyx_v_instruction->value));
+    __Pyx_GIVEREF(((PyObject *)__pyx_v_instruction->value));
+    if (__Pyx_PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_v_instruction->value)) != (0)) __PYX_ERR(0, 628, __pyx_L1_error);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_3);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_3 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 8, 0, __PYX_ERR(0, 628, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":627
+ *     cdef int op = instruction.op
+ * 
+ *     if op == OP_TYPE:             # <<<<<<<<<<<<<<
+ *         return (<object> instruction.value,)
+ *     if op == OP_LITERAL:
+*/
+  }
+
+  /* "overload/bind.pyx":629
+ *     if op == OP_TYPE:
+ *         return (<object> instruction.value,)
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return (type(<object> instruction.value),)
+ *     if op == OP_SUBCLASS:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_LITERAL);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":630
+ *         return (<object> instruction.value,)
+ *     if op == OP_LITERAL:
+ *         return (type(<object> instruction.value),)             # <<<<<<<<<<<<<<
+ *     if op == OP_SUBCLASS:
+ *         return (type,)
+*/
+    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 630, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_INCREF(((PyObject *)Py_TYPE(((PyObject *)__pyx_v_instruction->value))));
+    __Pyx_GIVEREF(((PyObject *)Py_TYPE(((PyObject *)__pyx_v_instruction->value))));
+    if (__Pyx_PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)Py_TYPE(((PyObject *)__pyx_v_instruction->value)))) != (0)) __PYX_ERR(0, 630, __pyx_L1_error);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_3);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_3 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 16, 0, __PYX_ERR(0, 630, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":629
+ *     if op == OP_TYPE:
+ *         return (<object> instruction.value,)
+ *     if op == OP_LITERAL:             # <<<<<<<<<<<<<<
+ *         return (type(<object> instruction.value),)
+ *     if op == OP_SUBCLASS:
+*/
+  }
+
+  /* "overload/bind.pyx":631
+ *     if op == OP_LITERAL:
+ *         return (type(<object> instruction.value),)
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return (type,)
+ *     if op == OP_TUPLE:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_SUBCLASS);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":632
+ *         return (type(<object> instruction.value),)
+ *     if op == OP_SUBCLASS:
+ *         return (type,)             # <<<<<<<<<<<<<<
+ *     if op == OP_TUPLE:
+ *         return (tuple,)
+*/
+    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 632, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_INCREF((PyObject *)(&PyType_Type));
+    __Pyx_GIVEREF((PyObject *)(&PyType_Type));
+    if (__Pyx_PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)(&PyType_Type))) != (0)) __PYX_ERR(0, 632, __pyx_L1_error);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_3);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_3 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 26, 0, __PYX_ERR(0, 632, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":631
+ *     if op == OP_LITERAL:
+ *         return (type(<object> instruction.value),)
+ *     if op == OP_SUBCLASS:             # <<<<<<<<<<<<<<
+ *         return (type,)
+ *     if op == OP_TUPLE:
+*/
+  }
+
+  /* "overload/bind.pyx":633
+ *     if op == OP_SUBCLASS:
+ *         return (type,)
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+*/
+  __pyx_t_2 = (__pyx_v_op == __pyx_e_8overload_4bind_OP_TUPLE);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":634
+ *         return (type,)
+ *     if op == OP_TUPLE:
+ *         return (tuple,)             # <<<<<<<<<<<<<<
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if type(<object> instruction.value) is type:
+*/
+    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 634, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_INCREF((PyObject *)(&PyTuple_Type));
+    __Pyx_GIVEREF((PyObject *)(&PyTuple_Type));
+    if (__Pyx_PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)(&PyTuple_Type))) != (0)) __PYX_ERR(0, 634, __pyx_L1_error);
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)__pyx_t_3);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __pyx_t_3 = 0;
+    __Pyx_TraceReturnValue(__pyx_r, 32, 0, __PYX_ERR(0, 634, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":633
+ *     if op == OP_SUBCLASS:
+ *         return (type,)
+ *     if op == OP_TUPLE:             # <<<<<<<<<<<<<<
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+*/
+  }
+
+  /* "overload/bind.pyx":635
+ *     if op == OP_TUPLE:
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         if type(<object> instruction.value) is type:
+ *             return (<object> instruction.value,)
+*/
+  switch (__pyx_v_op) {
+    case __pyx_e_8overload_4bind_OP_COLLECTION:
+    case __pyx_e_8overload_4bind_OP_MAPPING:
+
+    /* "overload/bind.pyx":636
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if type(<object> instruction.value) is type:             # <<<<<<<<<<<<<<
+ *             return (<object> instruction.value,)
+ *         return None
+*/
+    __pyx_t_2 = (((PyObject *)Py_TYPE(((PyObject *)__pyx_v_instruction->value))) == ((PyObject *)(&PyType_Type)));
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":637
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if type(<object> instruction.value) is type:
+ *             return (<object> instruction.value,)             # <<<<<<<<<<<<<<
+ *         return None
+ *     if op != OP_UNION:
+*/
+      __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 637, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_3);
+      __Pyx_INCREF(((PyObject *)__pyx_v_instruction->value));
+      __Pyx_GIVEREF(((PyObject *)__pyx_v_instruction->value));
+      if (__Pyx_PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_v_instruction->value)) != (0)) __PYX_ERR(0, 637, __pyx_L1_error);
+      {
+        PyObject *__pyx_temp;
+        {
+          __pyx_temp = __pyx_r;
+          __pyx_r = ((PyObject*)__pyx_t_3);
+        }
+        __Pyx_XDECREF(__pyx_temp);
+      }
+      __pyx_t_3 = 0;
+      __Pyx_TraceReturnValue(__pyx_r, 50, 0, __PYX_ERR(0, 637, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":636
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:
+ *         if type(<object> instruction.value) is type:             # <<<<<<<<<<<<<<
+ *             return (<object> instruction.value,)
+ *         return None
+*/
+    }
+
+    /* "overload/bind.pyx":638
+ *         if type(<object> instruction.value) is type:
+ *             return (<object> instruction.value,)
+ *         return None             # <<<<<<<<<<<<<<
+ *     if op != OP_UNION:
+ *         return None
+*/
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __Pyx_TraceReturnValue(__pyx_r, 54, 0, __PYX_ERR(0, 638, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":635
+ *     if op == OP_TUPLE:
+ *         return (tuple,)
+ *     if op == OP_COLLECTION or op == OP_MAPPING:             # <<<<<<<<<<<<<<
+ *         if type(<object> instruction.value) is type:
+ *             return (<object> instruction.value,)
+*/
+    break;
+    default: break;
+  }
+
+  /* "overload/bind.pyx":639
+ *             return (<object> instruction.value,)
+ *         return None
+ *     if op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return None
+ * 
+*/
+  __pyx_t_2 = (__pyx_v_op != __pyx_e_8overload_4bind_OP_UNION);
+
+  if (__pyx_t_2) {
+
+
+    /* "overload/bind.pyx":640
+ *         return None
+ *     if op != OP_UNION:
+ *         return None             # <<<<<<<<<<<<<<
+ * 
+ *     result = ()
+*/
+    {
+      PyObject *__pyx_temp;
+      {
+        __pyx_temp = __pyx_r;
+        __pyx_r = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
+      }
+      __Pyx_XDECREF(__pyx_temp);
+    }
+    __Pyx_TraceReturnValue(__pyx_r, 60, 0, __PYX_ERR(0, 640, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":639
+ *             return (<object> instruction.value,)
+ *         return None
+ *     if op != OP_UNION:             # <<<<<<<<<<<<<<
+ *         return None
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":642
+ *         return None
+ * 
+ *     result = ()             # <<<<<<<<<<<<<<
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+*/
+  __Pyx_INCREF(__pyx_mstate_global->__pyx_empty_tuple);
+  __pyx_v_result = __pyx_mstate_global->__pyx_empty_tuple;
+
+  /* "overload/bind.pyx":643
+ * 
+ *     result = ()
+ *     child = instruction + 1             # <<<<<<<<<<<<<<
+ *     for _ in range(instruction.count):
+ *         cover = programCover(child)
+*/
+  __pyx_v_child = (__pyx_v_instruction + 1);
+
+  /* "overload/bind.pyx":644
+ *     result = ()
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):             # <<<<<<<<<<<<<<
+ *         cover = programCover(child)
+ *         if cover is None:
+*/
+
+  __pyx_t_4 = __pyx_v_instruction->count;
+  __pyx_t_5 = __pyx_t_4;
+
+  for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_t_5; __pyx_t_6+=1) {
+    __pyx_v__ = __pyx_t_6;
+
+    /* "overload/bind.pyx":645
+ *     child = instruction + 1
+ *     for _ in range(instruction.count):
+ *         cover = programCover(child)             # <<<<<<<<<<<<<<
+ *         if cover is None:
+ *             return None
+*/
+    __pyx_t_3 = __pyx_f_8overload_4bind_programCover(__pyx_v_child); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 645, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_XDECREF_SET(__pyx_v_cover, ((PyObject*)__pyx_t_3));
+    __pyx_t_3 = 0;
+
+    /* "overload/bind.pyx":646
+ *     for _ in range(instruction.count):
+ *         cover = programCover(child)
+ *         if cover is None:             # <<<<<<<<<<<<<<
+ *             return None
+ *         result += cover
+*/
+    __pyx_t_2 = (__pyx_v_cover == ((PyObject*)Py_None));
+    if (__pyx_t_2) {
+
+
+      /* "overload/bind.pyx":647
+ *         cover = programCover(child)
+ *         if cover is None:
+ *             return None             # <<<<<<<<<<<<<<
+ *         result += cover
+ *         child += child.size
+*/
+      {
+        PyObject *__pyx_temp;
+        {
+          __pyx_temp = __pyx_r;
+          __pyx_r = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
+        }
+        __Pyx_XDECREF(__pyx_temp);
+      }
+      __Pyx_TraceReturnValue(__pyx_r, 82, 0, __PYX_ERR(0, 647, __pyx_L1_error));
+      goto __pyx_L0;
+
+      /* "overload/bind.pyx":646
+ *     for _ in range(instruction.count):
+ *         cover = programCover(child)
+ *         if cover is None:             # <<<<<<<<<<<<<<
+ *             return None
+ *         result += cover
+*/
+    }
+
+    /* "overload/bind.pyx":648
+ *         if cover is None:
+ *             return None
+ *         result += cover             # <<<<<<<<<<<<<<
+ *         child += child.size
+ *     return result
+*/
+    __pyx_t_3 = PyNumber_InPlaceAdd(__pyx_v_result, __pyx_v_cover); if (unlikely(!__pyx_t_3)) __PYX_ERR(0, 648, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_3);
+    __Pyx_DECREF_SET(__pyx_v_result, ((PyObject*)__pyx_t_3));
+    __pyx_t_3 = 0;
+
+    /* "overload/bind.pyx":649
+ *             return None
+ *         result += cover
+ *         child += child.size             # <<<<<<<<<<<<<<
+ *     return result
+ * 
+*/
+    __pyx_v_child = (__pyx_v_child + __pyx_v_child->size);
+  }
+
+
+  /* "overload/bind.pyx":650
+ *         result += cover
+ *         child += child.size
+ *     return result             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  {
+    PyObject *__pyx_temp;
+    {
+      __pyx_temp = __pyx_r;
+      __Pyx_INCREF(__pyx_v_result);
+      __pyx_r = __pyx_v_result;
+    }
+    __Pyx_XDECREF(__pyx_temp);
+  }
+  __Pyx_TraceReturnValue(__pyx_r, 89, 0, __PYX_ERR(0, 650, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":622
+ * 
+ * 
+ * cdef tuple programCover(const Instruction* instruction):             # <<<<<<<<<<<<<<
+ *     """Return a tuple of plain classes that covers the program node at `instruction`, see matcherCover."""
+ *     cdef const Instruction* child
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_3);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 622, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.programCover", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = 0;
+  __pyx_L0:;
+
+
+  __Pyx_XDECREF(__pyx_v_result);
+
+  __Pyx_XDECREF(__pyx_v_cover);
+  __Pyx_XGIVEREF(__pyx_r);
+  __Pyx_PyMonitoring_ExitScope(0);
+  __Pyx_RefNannyFinishContext();
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":653
+ * 
+ * 
+ * cdef bint typesDisjoint(PyTypeObject* lhs, PyTypeObject* rhs):             # <<<<<<<<<<<<<<
+ *     """Return True if no object can be an instance of both plain classes `lhs` and `rhs`.
+ *     This holds if neither is a subclass of the other, and no class can inherit from both: either one of them does not
+*/
+
+static int __pyx_f_8overload_4bind_typesDisjoint(PyTypeObject *__pyx_v_lhs, PyTypeObject *__pyx_v_rhs) {
+  int __pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  PyTypeObject *__pyx_t_3;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[27]))
+  __Pyx_TraceStartFunc("typesDisjoint", __pyx_f[0], 653, 0, 0, 0, __PYX_ERR(0, 653, __pyx_L1_error));
+
+
+
+  /* "overload/bind.pyx":658
+ *     allow subclassing, or their instance layouts conflict, see layoutBase.
+ *     """
+ *     if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):             # <<<<<<<<<<<<<<
+ *         return False
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):
+*/
+  __pyx_t_2 = PyType_IsSubtype(__pyx_v_lhs, __pyx_v_rhs);
+
+  if (!__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L4_bool_binop_done;
+  }
+  __pyx_t_2 = PyType_IsSubtype(__pyx_v_rhs, __pyx_v_lhs);
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L4_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":659
+ *     """
+ *     if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):
+ *         return False             # <<<<<<<<<<<<<<
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):
+ *         return True
+*/
+    {
+
+      __pyx_r = 0;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 12, 0, __PYX_ERR(0, 659, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":658
+ *     allow subclassing, or their instance layouts conflict, see layoutBase.
+ *     """
+ *     if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):             # <<<<<<<<<<<<<<
+ *         return False
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):
+*/
+  }
+
+  /* "overload/bind.pyx":660
+ *     if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):
+ *         return False
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):             # <<<<<<<<<<<<<<
+ *         return True
+ * 
+*/
+  __pyx_t_2 = (!((__pyx_v_lhs->tp_flags & Py_TPFLAGS_BASETYPE) != 0));
+
+  if (!__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L7_bool_binop_done;
+  }
+  __pyx_t_2 = (!((__pyx_v_rhs->tp_flags & Py_TPFLAGS_BASETYPE) != 0));
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L7_bool_binop_done:;
+  if (__pyx_t_1) {
+
+
+    /* "overload/bind.pyx":661
+ *         return False
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):
+ *         return True             # <<<<<<<<<<<<<<
+ * 
+ *     lhs = layoutBase(lhs)
+*/
+    {
+
+      __pyx_r = 1;
+    }
+    __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 26, 0, __PYX_ERR(0, 661, __pyx_L1_error));
+    goto __pyx_L0;
+
+    /* "overload/bind.pyx":660
+ *     if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):
+ *         return False
+ *     if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):             # <<<<<<<<<<<<<<
+ *         return True
+ * 
+*/
+  }
+
+  /* "overload/bind.pyx":663
+ *         return True
+ * 
+ *     lhs = layoutBase(lhs)             # <<<<<<<<<<<<<<
+ *     rhs = layoutBase(rhs)
+ *     return not PyType_IsSubtype_PTR(lhs, rhs) and not PyType_IsSubtype_PTR(rhs, lhs)
+*/
+  __pyx_t_3 = __pyx_f_8overload_4bind_layoutBase(__pyx_v_lhs); if (unlikely(__pyx_t_3 == ((void *)NULL) && PyErr_Occurred())) __PYX_ERR(0, 663, __pyx_L1_error)
+  __pyx_v_lhs = __pyx_t_3;
+
+  /* "overload/bind.pyx":664
+ * 
+ *     lhs = layoutBase(lhs)
+ *     rhs = layoutBase(rhs)             # <<<<<<<<<<<<<<
+ *     return not PyType_IsSubtype_PTR(lhs, rhs) and not PyType_IsSubtype_PTR(rhs, lhs)
+ * 
+*/
+  __pyx_t_3 = __pyx_f_8overload_4bind_layoutBase(__pyx_v_rhs); if (unlikely(__pyx_t_3 == ((void *)NULL) && PyErr_Occurred())) __PYX_ERR(0, 664, __pyx_L1_error)
+  __pyx_v_rhs = __pyx_t_3;
+
+  /* "overload/bind.pyx":665
+ *     lhs = layoutBase(lhs)
+ *     rhs = layoutBase(rhs)
+ *     return not PyType_IsSubtype_PTR(lhs, rhs) and not PyType_IsSubtype_PTR(rhs, lhs)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  __pyx_t_2 = (!PyType_IsSubtype(__pyx_v_lhs, __pyx_v_rhs));
+
+  if (__pyx_t_2) {
+
+  } else {
+
+    __pyx_t_1 = __pyx_t_2;
+
+    goto __pyx_L9_bool_binop_done;
+  }
+  __pyx_t_2 = (!PyType_IsSubtype(__pyx_v_rhs, __pyx_v_lhs));
+
+
+  __pyx_t_1 = __pyx_t_2;
+
+  __pyx_L9_bool_binop_done:;
+  {
+    __pyx_r = __pyx_t_1;
+  }
+  __Pyx_TraceReturnCValue(__pyx_r, __Pyx_PyBool_FromLong, 36, 0, __PYX_ERR(0, 665, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":653
+ * 
+ * 
+ * cdef bint typesDisjoint(PyTypeObject* lhs, PyTypeObject* rhs):             # <<<<<<<<<<<<<<
+ *     """Return True if no object can be an instance of both plain classes `lhs` and `rhs`.
+ *     This holds if neither is a subclass of the other, and no class can inherit from both: either one of them does not
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 653, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.typesDisjoint", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = -1;
+  __pyx_L0:;
+
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+
+/* "overload/bind.pyx":668
+ * 
+ * 
+ * cdef PyTypeObject* layoutBase(PyTypeObject* type):             # <<<<<<<<<<<<<<
+ *     """Return the base of `type` that defines its instance layout, like `solid_base` in CPython.
+ *     Classes defined in Python are skipped, which only makes the layout base more general. Classes whose layout bases
+*/
+
+static PyTypeObject *__pyx_f_8overload_4bind_layoutBase(PyTypeObject *__pyx_v_type) {
+  PyTypeObject *__pyx_r;
+  __Pyx_TraceDeclarationsFunc
+  int __pyx_t_1;
+  int __pyx_t_2;
+  PyTypeObject *__pyx_t_3;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_TraceFrameInit(((PyObject *)__pyx_mstate_global->__pyx_codeobj_tab[28]))
+  __Pyx_TraceStartFunc("layoutBase", __pyx_f[0], 668, 0, 0, 0, __PYX_ERR(0, 668, __pyx_L1_error));
+
+
+  /* "overload/bind.pyx":673
+ *     are unrelated can not have a common subclass.
+ *     """
+ *     while type.tp_flags & Py_TPFLAGS_HEAPTYPE and type.tp_base != NULL:             # <<<<<<<<<<<<<<
+ *         type = type.tp_base
+ *     while type.tp_base != NULL and type.tp_basicsize == type.tp_base.tp_basicsize and (
+*/
+  while (1) {
+    __pyx_t_2 = ((__pyx_v_type->tp_flags & Py_TPFLAGS_HEAPTYPE) != 0);
+
+    if (__pyx_t_2) {
+
+    } else {
+
+      __pyx_t_1 = __pyx_t_2;
+
+      goto __pyx_L5_bool_binop_done;
+    }
+    __pyx_t_2 = (__pyx_v_type->tp_base != NULL);
+
+
+    __pyx_t_1 = __pyx_t_2;
+
+    __pyx_L5_bool_binop_done:;
+
+    if (!__pyx_t_1) break;
+
+    /* "overload/bind.pyx":674
+ *     """
+ *     while type.tp_flags & Py_TPFLAGS_HEAPTYPE and type.tp_base != NULL:
+ *         type = type.tp_base             # <<<<<<<<<<<<<<
+ *     while type.tp_base != NULL and type.tp_basicsize == type.tp_base.tp_basicsize and (
+ *         type.tp_itemsize == type.tp_base.tp_itemsize
+*/
+    __pyx_t_3 = __pyx_v_type->tp_base;
+
+    __pyx_v_type = __pyx_t_3;
+  }
+
+  /* "overload/bind.pyx":675
+ *     while type.tp_flags & Py_TPFLAGS_HEAPTYPE and type.tp_base != NULL:
+ *         type = type.tp_base
+ *     while type.tp_base != NULL and type.tp_basicsize == type.tp_base.tp_basicsize and (             # <<<<<<<<<<<<<<
+ *         type.tp_itemsize == type.tp_base.tp_itemsize
+ *     ):
+*/
+  while (1) {
+    __pyx_t_2 = (__pyx_v_type->tp_base != NULL);
+
+    if (__pyx_t_2) {
+
+    } else {
+
+      __pyx_t_1 = __pyx_t_2;
+
+      goto __pyx_L9_bool_binop_done;
+    }
+    __pyx_t_2 = (__pyx_v_type->tp_basicsize == __pyx_v_type->tp_base->tp_basicsize);
+
+    if (__pyx_t_2) {
+
+    } else {
+
+      __pyx_t_1 = __pyx_t_2;
+
+      goto __pyx_L9_bool_binop_done;
+    }
+
+    /* "overload/bind.pyx":676
+ *         type = type.tp_base
+ *     while type.tp_base != NULL and type.tp_basicsize == type.tp_base.tp_basicsize and (
+ *         type.tp_itemsize == type.tp_base.tp_itemsize             # <<<<<<<<<<<<<<
+ *     ):
+ *         type = type.tp_base
+*/
+    __pyx_t_2 = (__pyx_v_type->tp_itemsize == __pyx_v_type->tp_base->tp_itemsize);
+
+
+    __pyx_t_1 = __pyx_t_2;
+
+    __pyx_L9_bool_binop_done:;
+
+    if (!__pyx_t_1) break;
+
+    /* "overload/bind.pyx":678
+ *         type.tp_itemsize == type.tp_base.tp_itemsize
+ *     ):
+ *         type = type.tp_base             # <<<<<<<<<<<<<<
+ *     return type
+*/
+    __pyx_t_3 = __pyx_v_type->tp_base;
+
+    __pyx_v_type = __pyx_t_3;
+  }
+
+  /* "overload/bind.pyx":679
+ *     ):
+ *         type = type.tp_base
+ *     return type             # <<<<<<<<<<<<<<
+*/
+  {
+
+    __pyx_r = __pyx_v_type;
+  }
+  __Pyx_TraceReturnValue(Py_None, 37, 0, __PYX_ERR(0, 679, __pyx_L1_error));
+  goto __pyx_L0;
+
+  /* "overload/bind.pyx":668
+ * 
+ * 
+ * cdef PyTypeObject* layoutBase(PyTypeObject* type):             # <<<<<<<<<<<<<<
+ *     """Return the base of `type` that defines its instance layout, like `solid_base` in CPython.
+ *     Classes defined in Python are skipped, which only makes the layout base more general. Classes whose layout bases
+*/
+
+  /* function exit code */
+  __pyx_L1_error:;
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  #if CYTHON_USE_SYS_MONITORING
+  __Pyx_TraceExceptionUnwind(0, 0);
+  #else
+  __Pyx_TraceReturnValue(NULL, 0, 0, __PYX_ERR(0, 668, __pyx_L1_error));
+  #endif
+  __Pyx_AddTraceback("overload.bind.layoutBase", __pyx_clineno, __pyx_lineno, __pyx_filename);
+  __pyx_r = NULL;
+  __pyx_L0:;
+
+
+  __Pyx_PyMonitoring_ExitScope(0);
+  return __pyx_r;
+}
+/* #### Code section: module_exttypes ### */
+
+static PyMethodDef __pyx_methods[] = {
+  {0, 0, 0, 0}
+};
+/* #### Code section: initfunc_declarations ### */
+static CYTHON_SMALL_CODE int __Pyx_InitCachedBuiltins(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_InitCachedConstants(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_InitGlobals(void); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_InitAfterSharedUtility(void); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_InitConstants(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Global_init_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Variable_export_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Function_export_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Type_import_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Variable_import_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_modinit_Function_import_code(__pyx_mstatetype *__pyx_mstate); /*proto*/
+static CYTHON_SMALL_CODE int __Pyx_CreateCodeObjects(__pyx_mstatetype *__pyx_mstate); /*proto*/
+/* #### Code section: init_module ### */
+
+static int __Pyx_modinit_Global_init_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Global_init_code", 0);
+  /*--- Global init code ---*/
+  __Pyx_RefNannyFinishContext();
+  return 0;
+}
+
+static int __Pyx_modinit_Variable_export_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Variable_export_code", 0);
+  /*--- Variable export code ---*/
+  __Pyx_RefNannyFinishContext();
+  return 0;
+}
+
+static int __Pyx_modinit_Function_export_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Function_export_code", 0);
+  /*--- Function export code ---*/
+  {
+    __pyx_t_1 = __Pyx_ApiExport_GetApiDict(); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 1, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_t_1);
+    const char * __pyx_export_signature = __Pyx_PyBytes_AsString(__pyx_mstate_global->__pyx_kp_b_Py_ssize_t_struct___pyx_t_8overl);
+    #if !CYTHON_ASSUME_SAFE_MACROS
+    if (unlikely(!__pyx_export_signature)) __PYX_ERR(0, 1, __pyx_L1_error)
+    #endif
+    const char * __pyx_export_name = __pyx_export_signature + 475;
+    void (*const __pyx_export_pointers[])(void) = {(void (*)(void))&__pyx_f_8overload_4bind_matchDistance, (void (*)(void))&__pyx_f_8overload_4bind_typeDistance, (void (*)(void))&__pyx_f_8overload_4bind_hasTypeBasedInstanceCheck, (void (*)(void))&__pyx_f_8overload_4bind_runProgram, (void (*)(void))&__pyx_f_8overload_4bind_matchType, (void (*)(void))&__pyx_f_8overload_4bind_matchersDisjoint, (void (*)(void))&__pyx_f_8overload_4bind_createMatcher, (void (*)(void))&__pyx_f_8overload_4bind_destroyMatcher, (void (*)(void)) NULL};
+    void (*const *__pyx_export_pointer)(void) = __pyx_export_pointers;
+    const char *__pyx_export_current_signature = __pyx_export_signature;
+    while (*__pyx_export_pointer) {
+      if (__Pyx_ExportFunction(__pyx_t_1, __pyx_export_name, *__pyx_export_pointer, __pyx_export_current_signature) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+      ++__pyx_export_pointer;
+      __pyx_export_name = strchr(__pyx_export_name, '\0') + 1;
+      __pyx_export_signature = strchr(__pyx_export_signature, '\0') + 1;
+      if (*__pyx_export_signature != '\0') __pyx_export_current_signature = __pyx_export_signature;
+    }
+    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  }
+  __Pyx_RefNannyFinishContext();
+  return 0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_RefNannyFinishContext();
+  return -1;
+}
+
+static int __Pyx_modinit_Type_import_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  PyObject *__pyx_t_1 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Type_import_code", 0);
+  /*--- Type import code ---*/
+  __pyx_t_1 = PyImport_ImportModule(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_t_1)) __PYX_ERR(3, 9, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_mstate->__pyx_ptype_7cpython_4type_type = __Pyx_ImportType_3_3_0(__pyx_t_1, __Pyx_BUILTIN_MODULE_NAME, "type",
+  #if defined(PYPY_VERSION_NUM) && PYPY_VERSION_NUM < 0x050B0000
+  sizeof(PyTypeObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyTypeObject),
+  #elif CYTHON_COMPILING_IN_LIMITED_API
+  0, 0,
+  #else
+  sizeof(PyHeapTypeObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyHeapTypeObject),
+  #endif
+  __Pyx_ImportType_CheckSize_Warn_3_3_0); if (!__pyx_mstate->__pyx_ptype_7cpython_4type_type) __PYX_ERR(3, 9, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  __pyx_t_1 = PyImport_ImportModule(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_t_1)) __PYX_ERR(4, 8, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_mstate->__pyx_ptype_7cpython_4bool_bool = __Pyx_ImportType_3_3_0(__pyx_t_1, __Pyx_BUILTIN_MODULE_NAME, "bool",
+  #if defined(PYPY_VERSION_NUM) && PYPY_VERSION_NUM < 0x050B0000
+  sizeof(PyLongObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyLongObject),
+  #elif CYTHON_COMPILING_IN_LIMITED_API
+  0, 0,
+  #else
+  sizeof(PyLongObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyLongObject),
+  #endif
+  __Pyx_ImportType_CheckSize_Warn_3_3_0); if (!__pyx_mstate->__pyx_ptype_7cpython_4bool_bool) __PYX_ERR(4, 8, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  __pyx_t_1 = PyImport_ImportModule(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_t_1)) __PYX_ERR(5, 16, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_1);
+  __pyx_mstate->__pyx_ptype_7cpython_7complex_complex = __Pyx_ImportType_3_3_0(__pyx_t_1, __Pyx_BUILTIN_MODULE_NAME, "complex",
+  #if defined(PYPY_VERSION_NUM) && PYPY_VERSION_NUM < 0x050B0000
+  sizeof(PyComplexObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyComplexObject),
+  #elif CYTHON_COMPILING_IN_LIMITED_API
+  0, 0,
+  #else
+  sizeof(PyComplexObject), __PYX_GET_STRUCT_ALIGNMENT_3_3_0(PyComplexObject),
+  #endif
+  __Pyx_ImportType_CheckSize_Warn_3_3_0); if (!__pyx_mstate->__pyx_ptype_7cpython_7complex_complex) __PYX_ERR(5, 16, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
+  __Pyx_RefNannyFinishContext();
+  return 0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_1);
+  __Pyx_RefNannyFinishContext();
+  return -1;
+}
+
+static int __Pyx_modinit_Variable_import_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Variable_import_code", 0);
+  /*--- Variable import code ---*/
+  __Pyx_RefNannyFinishContext();
+  return 0;
+}
+
+static int __Pyx_modinit_Function_import_code(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_modinit_Function_import_code", 0);
+  /*--- Function import code ---*/
+  __Pyx_RefNannyFinishContext();
+  return 0;
+}
+
+#if CYTHON_PEP489_MULTI_PHASE_INIT
+static PyObject* __pyx_pymod_create(PyObject *spec, PyModuleDef *def); /*proto*/
+static int __pyx_pymod_exec_bind(PyObject* module); /*proto*/
+static PyModuleDef_Slot __pyx_moduledef_slots[] = {
+  {Py_mod_create, (void*)__pyx_pymod_create},
+  {Py_mod_exec, (void*)__pyx_pymod_exec_bind},
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+  {Py_mod_gil, __Pyx_FREETHREADING_COMPATIBLE},
+  #endif
+  #if PY_VERSION_HEX >= 0x030C0000 && CYTHON_USE_MODULE_STATE
+  {Py_mod_multiple_interpreters, Py_MOD_MULTIPLE_INTERPRETERS_NOT_SUPPORTED},
+  #endif
+  {0, NULL}
+};
+#endif
+
+#ifdef __cplusplus
+namespace {
+  struct PyModuleDef __pyx_moduledef =
+  #else
+  static struct PyModuleDef __pyx_moduledef =
+  #endif
+  {
+      PyModuleDef_HEAD_INIT,
+      "bind",
+      0, /* m_doc */
+    #if CYTHON_USE_MODULE_STATE
+      sizeof(__pyx_mstatetype), /* m_size */
+    #else
+      (CYTHON_PEP489_MULTI_PHASE_INIT) ? 0 : -1, /* m_size */
+    #endif
+      __pyx_methods /* m_methods */,
+    #if CYTHON_PEP489_MULTI_PHASE_INIT
+      __pyx_moduledef_slots, /* m_slots */
+    #else
+      NULL, /* m_reload */
+    #endif
+    #if CYTHON_USE_MODULE_STATE
+      __pyx_m_traverse, /* m_traverse */
+      __pyx_m_clear, /* m_clear */
+      NULL /* m_free */
+    #else
+      NULL, /* m_traverse */
+      NULL, /* m_clear */
+      NULL /* m_free */
+    #endif
+  };
+  #ifdef __cplusplus
+} /* anonymous namespace */
+#endif
+
+/* PyModInitFuncType */
+#ifndef CYTHON_NO_PYINIT_EXPORT
+  #define __Pyx_PyMODINIT_FUNC PyMODINIT_FUNC
+#else
+  #ifdef __cplusplus
+  #define __Pyx_PyMODINIT_FUNC extern "C" PyObject *
+  #else
+  #define __Pyx_PyMODINIT_FUNC PyObject *
+  #endif
+#endif
+
+__Pyx_PyMODINIT_FUNC PyInit_bind(void) CYTHON_SMALL_CODE; /*proto*/
+__Pyx_PyMODINIT_FUNC PyInit_bind(void)
+#if CYTHON_PEP489_MULTI_PHASE_INIT
+{
+  return PyModuleDef_Init(&__pyx_moduledef);
+}
+/* ModuleCreationPEP489 */
+#if CYTHON_COMPILING_IN_LIMITED_API && (__PYX_LIMITED_VERSION_HEX < 0x030A0000 &&\
+      (defined(_WIN32) || defined(WIN32) || defined(MS_WINDOWS)))
+static PY_INT64_T __Pyx_GetCurrentInterpreterId(void) {
+    {
+        PyObject *module = PyImport_ImportModule("_interpreters"); // 3.13+ I think
+        if (!module) {
+            if (!PyErr_ExceptionMatches(PyExc_Exception)) {
+                goto bad; // BaseException
+            }
+            PyErr_Clear(); // just try the 3.8-3.12 version
+            module = PyImport_ImportModule("_xxsubinterpreters");
+            if (!module) goto bad;
+        }
+        PyObject *current = PyObject_CallMethod(module, "get_current", NULL);
+        Py_DECREF(module);
+        if (!current) goto bad;
+        if (PyTuple_Check(current)) {
+            PyObject *new_current = PySequence_GetItem(current, 0);
+            Py_DECREF(current);
+            current = new_current;
+            if (!new_current) goto bad;
+        }
+        long long as_c_int = PyLong_AsLongLong(current);
+        Py_DECREF(current);
+        return as_c_int;
+    }
+  bad:
+    PySys_WriteStderr("__Pyx_GetCurrentInterpreterId failed. Try setting the C define CYTHON_PEP489_MULTI_PHASE_INIT=0\n");
+    return -1;
+}
+#endif
+#if !CYTHON_USE_MODULE_STATE
+static CYTHON_SMALL_CODE int __Pyx_check_single_interpreter(void) {
+    static PY_INT64_T main_interpreter_id = -1;
+#if CYTHON_COMPILING_IN_GRAAL && defined(GRAALPY_VERSION_NUM) && GRAALPY_VERSION_NUM > 0x19000000
+    PY_INT64_T current_id = GraalPyInterpreterState_GetIDFromThreadState(PyThreadState_Get());
+#elif CYTHON_COMPILING_IN_GRAAL
+    PY_INT64_T current_id = PyInterpreterState_GetIDFromThreadState(PyThreadState_Get());
+#elif CYTHON_COMPILING_IN_LIMITED_API && (__PYX_LIMITED_VERSION_HEX < 0x030A0000 &&\
+      (defined(_WIN32) || defined(WIN32) || defined(MS_WINDOWS)))
+    PY_INT64_T current_id = __Pyx_GetCurrentInterpreterId();
+#elif CYTHON_COMPILING_IN_LIMITED_API
+    PY_INT64_T current_id = PyInterpreterState_GetID(PyInterpreterState_Get());
+#else
+    PY_INT64_T current_id = PyInterpreterState_GetID(PyThreadState_Get()->interp);
+#endif
+    if (unlikely(current_id == -1)) {
+        return -1;
+    }
+    if (main_interpreter_id == -1) {
+        main_interpreter_id = current_id;
+        return 0;
+    } else if (unlikely(main_interpreter_id != current_id)) {
+        PyErr_SetString(
+            PyExc_ImportError,
+            "Interpreter change detected - this module can only be loaded into one interpreter per process.");
+        return -1;
+    }
+    return 0;
+}
+#endif
+static CYTHON_SMALL_CODE int __Pyx_copy_spec_to_module(PyObject *spec, PyObject *moddict, const char* from_name, const char* to_name, int allow_none)
+{
+    PyObject *value = PyObject_GetAttrString(spec, from_name);
+    int result = 0;
+    if (likely(value)) {
+        if (allow_none || value != Py_None) {
+            result = PyDict_SetItemString(moddict, to_name, value);
+        }
+        Py_DECREF(value);
+    } else if (PyErr_ExceptionMatches(PyExc_AttributeError)) {
+        PyErr_Clear();
+    } else {
+        result = -1;
+    }
+    return result;
+}
+static CYTHON_SMALL_CODE PyObject* __pyx_pymod_create(PyObject *spec, PyModuleDef *def) {
+    PyObject *module = NULL, *moddict, *modname;
+    CYTHON_UNUSED_VAR(def);
+    #if !CYTHON_USE_MODULE_STATE
+    if (__Pyx_check_single_interpreter())
+        return NULL;
+    #endif
+    if (__pyx_m)
+        return __Pyx_NewRef(__pyx_m);
+    modname = PyObject_GetAttrString(spec, "name");
+    if (unlikely(!modname)) goto bad;
+    module = PyModule_NewObject(modname);
+    Py_DECREF(modname);
+    if (unlikely(!module)) goto bad;
+    moddict = PyModule_GetDict(module);
+    if (unlikely(!moddict)) goto bad;
+    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "loader", "__loader__", 1) < 0)) goto bad;
+    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "origin", "__file__", 1) < 0)) goto bad;
+    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "parent", "__package__", 1) < 0)) goto bad;
+    if (unlikely(__Pyx_copy_spec_to_module(spec, moddict, "submodule_search_locations", "__path__", 0) < 0)) goto bad;
+    return module;
+bad:
+    Py_XDECREF(module);
+    return NULL;
+}
+
+
+static CYTHON_SMALL_CODE int __pyx_pymod_exec_bind(PyObject *__pyx_pyinit_module)
+#endif
 {
-    Py_ssize_t num_expected;
-    const char *more_or_less;
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
+  int stringtab_initialized = 0;
+  #if CYTHON_USE_MODULE_STATE
+  int pystate_addmodule_run = 0;
+  #endif
+  __pyx_mstatetype *__pyx_mstate = NULL;
+  __Pyx_TraceDeclarationsFunc
+  PyObject *__pyx_t_1 = NULL;
+  PyObject *__pyx_t_2 = NULL;
+  Py_ssize_t __pyx_t_3;
+  PyObject *__pyx_t_4 = NULL;
+  PyObject *__pyx_t_5 = NULL;
+  PyObject *__pyx_t_6 = NULL;
+  PyObject *__pyx_t_7 = NULL;
+  int __pyx_t_8;
+  PyObject *__pyx_t_9 = NULL;
+  PyObject *__pyx_t_10 = NULL;
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  __Pyx_RefNannyDeclarations
+  #if CYTHON_PEP489_MULTI_PHASE_INIT
+  if (__pyx_m) {
+    if (__pyx_m == __pyx_pyinit_module) return 0;
+    PyErr_SetString(PyExc_RuntimeError, "Module 'bind' has already been imported. Re-initialisation is not supported.");
+    return -1;
+  }
+  #else
+  if (__pyx_m) return __Pyx_NewRef(__pyx_m);
+  #endif
+  /*--- Module creation code ---*/
+  #if CYTHON_PEP489_MULTI_PHASE_INIT
+  __pyx_t_1 = __pyx_pyinit_module;
+  Py_INCREF(__pyx_t_1);
+  #else
+  __pyx_t_1 = PyModule_Create(&__pyx_moduledef); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 1, __pyx_L1_error)
+  #endif
+  #if CYTHON_USE_MODULE_STATE
+  {
+    int add_module_result = __Pyx_State_AddModule(__pyx_t_1, &__pyx_moduledef);
+    __pyx_t_1 = 0; /* transfer ownership from __pyx_t_1 to "bind" pseudovariable */
+    if (unlikely((add_module_result < 0))) __PYX_ERR(0, 1, __pyx_L1_error)
+    pystate_addmodule_run = 1;
+  }
+  #else
+  __pyx_m = __pyx_t_1;
+  #endif
+  #if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+  PyUnstable_Module_SetGIL(__pyx_m, Py_MOD_GIL_USED);
+  #endif
+  __pyx_mstate = __pyx_mstate_global;
+  CYTHON_UNUSED_VAR(__pyx_t_1);
+  __pyx_mstate->__pyx_d = PyModule_GetDict(__pyx_m); if (unlikely(!__pyx_mstate->__pyx_d)) __PYX_ERR(0, 1, __pyx_L1_error)
+  Py_INCREF(__pyx_mstate->__pyx_d);
+  __pyx_mstate->__pyx_b = __Pyx_PyImport_AddModuleRef(__Pyx_BUILTIN_MODULE_NAME); if (unlikely(!__pyx_mstate->__pyx_b)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __pyx_mstate->__pyx_cython_runtime = __Pyx_PyImport_AddModuleRef("cython_runtime"); if (unlikely(!__pyx_mstate->__pyx_cython_runtime)) __PYX_ERR(0, 1, __pyx_L1_error)
+  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_mstate->__pyx_b) < 0) __PYX_ERR(0, 1, __pyx_L1_error)
+  /* ImportRefnannyAPI */
+  #if CYTHON_REFNANNY
+  __Pyx_RefNanny = __Pyx_RefNannyImportAPI("refnanny");
+  if (!__Pyx_RefNanny) {
+    if (PyErr_ExceptionMatches(PyExc_Exception)) {
+      PyErr_Clear();
+      __Pyx_RefNanny = __Pyx_RefNannyImportAPI("Cython.Runtime.refnanny");
+    }
+    if (!__Pyx_RefNanny)
+        Py_FatalError("failed to import 'refnanny' module");
+  }
+  #endif
+  
+__Pyx_RefNannySetupContext("PyInit_bind", 0);
+  __Pyx_init_runtime_version();
+  if (__Pyx_check_binary_version(__PYX_LIMITED_VERSION_HEX, __Pyx_get_runtime_version(), CYTHON_COMPILING_IN_LIMITED_API) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __pyx_mstate->__pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_mstate->__pyx_empty_tuple)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __pyx_mstate->__pyx_empty_bytes = PyBytes_FromStringAndSize("", 0); if (unlikely(!__pyx_mstate->__pyx_empty_bytes)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __pyx_mstate->__pyx_empty_unicode = PyUnicode_FromStringAndSize("", 0); if (unlikely(!__pyx_mstate->__pyx_empty_unicode)) __PYX_ERR(0, 1, __pyx_L1_error)
+  /*--- Library function declarations ---*/
+  /*--- Initialize various global constants etc. ---*/
+  if (__Pyx_InitConstants(__pyx_mstate) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  stringtab_initialized = 1;
+  if (__Pyx_InitGlobals() < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  if (__pyx_module_is_main_overload__bind) {
+    if (PyObject_SetAttr(__pyx_m, __pyx_mstate_global->__pyx_n_u_name, __pyx_mstate_global->__pyx_n_u_main) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  }
+  {
+    PyObject *modules = PyImport_GetModuleDict(); if (unlikely(!modules)) __PYX_ERR(0, 1, __pyx_L1_error)
+    if (!PyDict_GetItemString(modules, "overload.bind")) {
+      if (unlikely((PyDict_SetItemString(modules, "overload.bind", __pyx_m) < 0))) __PYX_ERR(0, 1, __pyx_L1_error)
+    }
+  }
+  /*--- Builtin init code ---*/
+  if (__Pyx_InitCachedBuiltins(__pyx_mstate) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  /*--- Constants init code ---*/
+  if (__Pyx_InitCachedConstants(__pyx_mstate) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  if (__Pyx_CreateCodeObjects(__pyx_mstate) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  /*--- Global type/function init code ---*/
+  (void)__Pyx_modinit_Global_init_code(__pyx_mstate);
+  (void)__Pyx_modinit_Variable_export_code(__pyx_mstate);
+  if (unlikely((__Pyx_modinit_Function_export_code(__pyx_mstate) < 0))) __PYX_ERR(0, 1, __pyx_L1_error)
+  /*--- Type init code ---*/
+  if (unlikely((__Pyx_modinit_Type_import_code(__pyx_mstate) < 0))) __PYX_ERR(0, 1, __pyx_L1_error)
+  (void)__Pyx_modinit_Variable_import_code(__pyx_mstate);
+  (void)__Pyx_modinit_Function_import_code(__pyx_mstate);
+  if (__Pyx_InitAfterSharedUtility() < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  /*--- Execution code ---*/
+  __Pyx_TraceStartFunc("PyInit_bind", __pyx_f[0], 1, 0, 0, 0, __PYX_ERR(0, 1, __pyx_L1_error));
+
+  /* "overload/bind.pyx":7
+ * #cython: wraparound=False
+ * #cython: language_level = 3
+ * from abc import ABCMeta             # <<<<<<<<<<<<<<
+ * from inspect import _empty
+ * from collections.abc import Iterable, Mapping
+*/
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_ABCMeta};
+    __pyx_t_1 = __Pyx_Import(__pyx_mstate_global->__pyx_n_u_abc, __pyx_imported_names, 1, NULL, 0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 7, __pyx_L1_error)
+  }
+  __pyx_t_2 = __pyx_t_1;
+  __Pyx_GOTREF(__pyx_t_2);
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_ABCMeta};
+    __pyx_t_3 = 0; {
+      __pyx_t_4 = __Pyx_ImportFrom(__pyx_t_2, __pyx_imported_names[__pyx_t_3]); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 7, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_4);
+      if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_imported_names[__pyx_t_3], __pyx_t_4) < (0)) __PYX_ERR(0, 7, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+    }
+  }
+  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":8
+ * #cython: language_level = 3
+ * from abc import ABCMeta
+ * from inspect import _empty             # <<<<<<<<<<<<<<
+ * from collections.abc import Iterable, Mapping
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+*/
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_empty};
+    __pyx_t_1 = __Pyx_Import(__pyx_mstate_global->__pyx_n_u_inspect, __pyx_imported_names, 1, NULL, 0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 8, __pyx_L1_error)
+  }
+  __pyx_t_2 = __pyx_t_1;
+  __Pyx_GOTREF(__pyx_t_2);
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_empty};
+    __pyx_t_3 = 0; {
+      __pyx_t_4 = __Pyx_ImportFrom(__pyx_t_2, __pyx_imported_names[__pyx_t_3]); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 8, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_4);
+      if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_imported_names[__pyx_t_3], __pyx_t_4) < (0)) __PYX_ERR(0, 8, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+    }
+  }
+  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":9
+ * from abc import ABCMeta
+ * from inspect import _empty
+ * from collections.abc import Iterable, Mapping             # <<<<<<<<<<<<<<
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+ * try:
+*/
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_Iterable,__pyx_mstate_global->__pyx_n_u_Mapping};
+    __pyx_t_1 = __Pyx_Import(__pyx_mstate_global->__pyx_n_u_collections_abc, __pyx_imported_names, 2, NULL, 0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 9, __pyx_L1_error)
+  }
+  __pyx_t_2 = __pyx_t_1;
+  __Pyx_GOTREF(__pyx_t_2);
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_Iterable,__pyx_mstate_global->__pyx_n_u_Mapping};
+    for (__pyx_t_3=0; __pyx_t_3 < 2; __pyx_t_3++) {
+      __pyx_t_4 = __Pyx_ImportFrom(__pyx_t_2, __pyx_imported_names[__pyx_t_3]); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 9, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_4);
+      if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_imported_names[__pyx_t_3], __pyx_t_4) < (0)) __PYX_ERR(0, 9, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+    }
+  }
+  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":10
+ * from inspect import _empty
+ * from collections.abc import Iterable, Mapping
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin             # <<<<<<<<<<<<<<
+ * try:
+ *     from types import UnionType
+*/
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_Annotated,__pyx_mstate_global->__pyx_n_u_Any,__pyx_mstate_global->__pyx_n_u_Literal,__pyx_mstate_global->__pyx_n_u_TypeVar,__pyx_mstate_global->__pyx_n_u_Union,__pyx_mstate_global->__pyx_n_u_get_args,__pyx_mstate_global->__pyx_n_u_get_origin};
+    __pyx_t_1 = __Pyx_Import(__pyx_mstate_global->__pyx_n_u_typing, __pyx_imported_names, 7, NULL, 0); if (unlikely(!__pyx_t_1)) __PYX_ERR(0, 10, __pyx_L1_error)
+  }
+  __pyx_t_2 = __pyx_t_1;
+  __Pyx_GOTREF(__pyx_t_2);
+  {
+    PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_Annotated,__pyx_mstate_global->__pyx_n_u_Any,__pyx_mstate_global->__pyx_n_u_Literal,__pyx_mstate_global->__pyx_n_u_TypeVar,__pyx_mstate_global->__pyx_n_u_Union,__pyx_mstate_global->__pyx_n_u_get_args,__pyx_mstate_global->__pyx_n_u_get_origin};
+    for (__pyx_t_3=0; __pyx_t_3 < 7; __pyx_t_3++) {
+      __pyx_t_4 = __Pyx_ImportFrom(__pyx_t_2, __pyx_imported_names[__pyx_t_3]); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 10, __pyx_L1_error)
+      __Pyx_GOTREF(__pyx_t_4);
+      if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_imported_names[__pyx_t_3], __pyx_t_4) < (0)) __PYX_ERR(0, 10, __pyx_L1_error)
+      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+    }
+  }
+  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+  /* "overload/bind.pyx":11
+ * from collections.abc import Iterable, Mapping
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+ * try:             # <<<<<<<<<<<<<<
+ *     from types import UnionType
+ * except ImportError:
+*/
+  {
+    __Pyx_PyThreadState_declare
+    __Pyx_PyThreadState_assign
+    __Pyx_ExceptionSave(&__pyx_t_1, &__pyx_t_5, &__pyx_t_6);
+    __Pyx_XGOTREF(__pyx_t_1);
+    __Pyx_XGOTREF(__pyx_t_5);
+    __Pyx_XGOTREF(__pyx_t_6);
+    /*try:*/ {
+
+      /* "overload/bind.pyx":12
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+ * try:
+ *     from types import UnionType             # <<<<<<<<<<<<<<
+ * except ImportError:
+ *     # Python 3.9 has no `X | Y` annotations
+*/
+      {
+        PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_UnionType};
+        __pyx_t_7 = __Pyx_Import(__pyx_mstate_global->__pyx_n_u_types, __pyx_imported_names, 1, NULL, 0); if (unlikely(!__pyx_t_7)) __PYX_ERR(0, 12, __pyx_L2_error)
+      }
+      __pyx_t_2 = __pyx_t_7;
+      __Pyx_GOTREF(__pyx_t_2);
+      {
+        PyObject* const __pyx_imported_names[] = {__pyx_mstate_global->__pyx_n_u_UnionType};
+        __pyx_t_3 = 0; {
+          __pyx_t_4 = __Pyx_ImportFrom(__pyx_t_2, __pyx_imported_names[__pyx_t_3]); if (unlikely(!__pyx_t_4)) __PYX_ERR(0, 12, __pyx_L2_error)
+          __Pyx_GOTREF(__pyx_t_4);
+          if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_imported_names[__pyx_t_3], __pyx_t_4) < (0)) __PYX_ERR(0, 12, __pyx_L2_error)
+          __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
+        }
+      }
+      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
+
+      /* "overload/bind.pyx":11
+ * from collections.abc import Iterable, Mapping
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+ * try:             # <<<<<<<<<<<<<<
+ *     from types import UnionType
+ * except ImportError:
+*/
+    }
+    __Pyx_XDECREF(__pyx_t_1); __pyx_t_1 = 0;
+    __Pyx_XDECREF(__pyx_t_5); __pyx_t_5 = 0;
+    __Pyx_XDECREF(__pyx_t_6); __pyx_t_6 = 0;
+    goto __pyx_L7_try_end;
+    __pyx_L2_error:;
+    __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+    __Pyx_XDECREF(__pyx_t_4); __pyx_t_4 = 0;
+    __Pyx_TraceException(__pyx_lineno, 0, 0);
+
+    /* "overload/bind.pyx":13
+ * try:
+ *     from types import UnionType
+ * except ImportError:             # <<<<<<<<<<<<<<
+ *     # Python 3.9 has no `X | Y` annotations
+ *     UnionType = Union
+*/
+    __pyx_t_8 = __Pyx_PyErr_ExceptionMatches(((PyObject *)(((PyTypeObject*)PyExc_ImportError))));
+    if (__pyx_t_8) {
+      __Pyx_AddTraceback("overload.bind", __pyx_clineno, __pyx_lineno, __pyx_filename);
+      __Pyx_TraceExceptionHandled(0);
+      if (__Pyx_GetException(&__pyx_t_2, &__pyx_t_4, &__pyx_t_9) < 0) __PYX_ERR(0, 13, __pyx_L4_except_error)
+      __Pyx_XGOTREF(__pyx_t_2);
+      __Pyx_XGOTREF(__pyx_t_4);
+      __Pyx_XGOTREF(__pyx_t_9);
+      __Pyx_TraceExceptionDone();
+
+      /* "overload/bind.pyx":15
+ * except ImportError:
+ *     # Python 3.9 has no `X | Y` annotations
+ *     UnionType = Union             # <<<<<<<<<<<<<<
+ * from cpython cimport Py_INCREF, Py_XINCREF, Py_XDECREF
+ * from cpython.object cimport Py_EQ, PyObject_RichCompareBool
+*/
+      __Pyx_GetModuleGlobalName(__pyx_t_10, __pyx_mstate_global->__pyx_n_u_Union); if (unlikely(!__pyx_t_10)) __PYX_ERR(0, 15, __pyx_L4_except_error)
+      __Pyx_GOTREF(__pyx_t_10);
+      if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_mstate_global->__pyx_n_u_UnionType, __pyx_t_10) < (0)) __PYX_ERR(0, 15, __pyx_L4_except_error)
+      __Pyx_DECREF(__pyx_t_10); __pyx_t_10 = 0;
+      __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
+      __Pyx_XDECREF(__pyx_t_4); __pyx_t_4 = 0;
+      __Pyx_XDECREF(__pyx_t_9); __pyx_t_9 = 0;
+      goto __pyx_L3_exception_handled;
+    }
+    goto __pyx_L4_except_error;
+
+    /* "overload/bind.pyx":11
+ * from collections.abc import Iterable, Mapping
+ * from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+ * try:             # <<<<<<<<<<<<<<
+ *     from types import UnionType
+ * except ImportError:
+*/
+    __pyx_L4_except_error:;
+    __Pyx_XGIVEREF(__pyx_t_1);
+    __Pyx_XGIVEREF(__pyx_t_5);
+    __Pyx_XGIVEREF(__pyx_t_6);
+    __Pyx_ExceptionReset(__pyx_t_1, __pyx_t_5, __pyx_t_6);
+    goto __pyx_L1_error;
+    __pyx_L3_exception_handled:;
+    __Pyx_XGIVEREF(__pyx_t_1);
+    __Pyx_XGIVEREF(__pyx_t_5);
+    __Pyx_XGIVEREF(__pyx_t_6);
+    __Pyx_ExceptionReset(__pyx_t_1, __pyx_t_5, __pyx_t_6);
+    __pyx_L7_try_end:;
+  }
+
+  /* "overload/bind.pyx":39
+ *     PyObject* ovl_type_mro(PyTypeObject* type)
+ * 
+ * NoneType = type(None)             # <<<<<<<<<<<<<<
+ * 
+ * 
+*/
+  if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_mstate_global->__pyx_n_u_NoneType, ((PyObject *)Py_TYPE(Py_None))) < (0)) __PYX_ERR(0, 39, __pyx_L1_error)
+
+  /* "overload/bind.pyx":1
+ * #distutils: language = c++             # <<<<<<<<<<<<<<
+ * #cython: profile=True
+ * #cython: infer_types=True
+*/
+  __pyx_t_9 = __Pyx_PyDict_NewPresized(0); if (unlikely(!__pyx_t_9)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_t_9);
+  if (PyDict_SetItem(__pyx_mstate_global->__pyx_d, __pyx_mstate_global->__pyx_n_u_test, __pyx_t_9) < (0)) __PYX_ERR(0, 1, __pyx_L1_error)
+  __Pyx_DECREF(__pyx_t_9); __pyx_t_9 = 0;
+  __Pyx_TraceReturnValue(Py_None, 0, 0, __PYX_ERR(0, 1, __pyx_L1_error));
+  __Pyx_PyMonitoring_ExitScope(0);
+
+  /*--- Wrapped vars code ---*/
+
+  goto __pyx_L0;
+  __pyx_L1_error:;
+  __Pyx_XDECREF(__pyx_t_2);
+  __Pyx_XDECREF(__pyx_t_4);
+  __Pyx_XDECREF(__pyx_t_9);
+  __Pyx_XDECREF(__pyx_t_10);
+  __Pyx_TraceException(__pyx_lineno, 0, 0);
+  __Pyx_TraceExceptionUnwind(0, 0);
+  if (__pyx_m) {
+    if (__pyx_mstate->__pyx_d && stringtab_initialized) {
+      __Pyx_AddTraceback("init overload.bind", __pyx_clineno, __pyx_lineno, __pyx_filename);
+    }
+    #if !CYTHON_USE_MODULE_STATE
+    Py_CLEAR(__pyx_m);
+    #else
+    Py_DECREF(__pyx_m);
+    if (pystate_addmodule_run) {
+      PyObject *tp, *value, *tb;
+      __Pyx_PyErr_FetchException(&tp, &value, &tb);
+      __Pyx_State_RemoveModule(&__pyx_moduledef);
+      __Pyx_PyErr_RestoreException(tp, value, tb);
+    }
+    #endif
+  } else if (!PyErr_Occurred()) {
+    PyErr_SetString(PyExc_ImportError, "init overload.bind");
+  }
+  __pyx_L0:;
+  __Pyx_RefNannyFinishContext();
+  #if CYTHON_PEP489_MULTI_PHASE_INIT
+  return (__pyx_m != NULL) ? 0 : -1;
+  #else
+  return __pyx_m;
+  #endif
+}
+/* #### Code section: pystring_table ### */
+/* #### Code section: cached_builtins ### */
+
+static int __Pyx_InitCachedBuiltins(__pyx_mstatetype *__pyx_mstate) {
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __pyx_builtin_object = __Pyx_GetBuiltinName(__pyx_mstate->__pyx_n_u_object); if (!__pyx_builtin_object) __PYX_ERR(0, 69, __pyx_L1_error)
+  __pyx_builtin_Ellipsis = __Pyx_GetBuiltinName(__pyx_mstate->__pyx_n_u_Ellipsis); if (!__pyx_builtin_Ellipsis) __PYX_ERR(0, 147, __pyx_L1_error)
+  return 0;
+  __pyx_L1_error:;
+  return -1;
+}
+/* #### Code section: cached_constants ### */
+
+static int __Pyx_InitCachedConstants(__pyx_mstatetype *__pyx_mstate) {
+  __Pyx_RefNannyDeclarations
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  __Pyx_RefNannySetupContext("__Pyx_InitCachedConstants", 0);
+
+  /* "overload/bind.pyx":148
+ *         compileNode(OP_TUPLE, (), program, guards, check)
+ *     elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+ *         compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif origin is Annotated:
+ *         compileAnnotation(annotation.__origin__, program, guards, check)
+*/
+  {
+    PyObject* __pyx_temp[1] = {__pyx_mstate_global->__pyx_empty_tuple};
+    __pyx_mstate_global->__pyx_tuple[0] = __Pyx_PyTuple_FromArray(__pyx_temp, 1); if (unlikely(!__pyx_mstate_global->__pyx_tuple[0])) __PYX_ERR(0, 148, __pyx_L1_error)
+    __Pyx_GOTREF(__pyx_mstate_global->__pyx_tuple[0]);
+  }
+  __Pyx_GIVEREF(__pyx_mstate_global->__pyx_tuple[0]);
+
+  /* "overload/bind.pyx":162
+ *         compileAnnotation(annotation.__supertype__, program, guards, check)
+ *     elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+ *         compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)             # <<<<<<<<<<<<<<
+ *     elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+ *         compileContainer(OP_MAPPING, origin, args, program, guards, check)
+*/
+  __pyx_mstate_global->__pyx_slice[0] = PySlice_New(Py_None, __pyx_mstate_global->__pyx_int_1, Py_None); if (unlikely(!__pyx_mstate_global->__pyx_slice[0])) __PYX_ERR(0, 162, __pyx_L1_error)
+  __Pyx_GOTREF(__pyx_mstate_global->__pyx_slice[0]);
+  __Pyx_GIVEREF(__pyx_mstate_global->__pyx_slice[0]);
+  #if CYTHON_IMMORTAL_CONSTANTS
+  {
+    PyObject **table = __pyx_mstate->__pyx_tuple;
+    for (Py_ssize_t i=0; i<1; ++i) {
+      #if PY_VERSION_HEX >= 0x030F0000
+      PyUnstable_SetImmortal(table[i]);
+      #elif CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+      if ((PY_SSIZE_T_MAX <= _Py_IMMORTAL_REFCNT_LOCAL)) break;
+      #if PY_VERSION_HEX < 0x030E0000
+      if (_Py_IsOwnedByCurrentThread(table[i]) && Py_REFCNT(table[i]) == 1)
+      #else
+      if (PyUnstable_Object_IsUniquelyReferenced(table[i]))
+      #endif
+      {
+        Py_SET_REFCNT(table[i], ((Py_ssize_t)_Py_IMMORTAL_REFCNT_LOCAL + 1));
+      }
+      #else
+      if ((PY_SSIZE_T_MAX < _Py_IMMORTAL_INITIAL_REFCNT)) break;
+      Py_SET_REFCNT(table[i], _Py_IMMORTAL_INITIAL_REFCNT);
+      #endif
+    }
+  }
+  #endif
+  #if CYTHON_IMMORTAL_CONSTANTS
+  {
+    PyObject **table = __pyx_mstate->__pyx_slice;
+    for (Py_ssize_t i=0; i<1; ++i) {
+      #if PY_VERSION_HEX >= 0x030F0000
+      PyUnstable_SetImmortal(table[i]);
+      #elif CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+      if ((PY_SSIZE_T_MAX <= _Py_IMMORTAL_REFCNT_LOCAL)) break;
+      #if PY_VERSION_HEX < 0x030E0000
+      if (_Py_IsOwnedByCurrentThread(table[i]) && Py_REFCNT(table[i]) == 1)
+      #else
+      if (PyUnstable_Object_IsUniquelyReferenced(table[i]))
+      #endif
+      {
+        Py_SET_REFCNT(table[i], ((Py_ssize_t)_Py_IMMORTAL_REFCNT_LOCAL + 1));
+      }
+      #else
+      if ((PY_SSIZE_T_MAX < _Py_IMMORTAL_INITIAL_REFCNT)) break;
+      Py_SET_REFCNT(table[i], _Py_IMMORTAL_INITIAL_REFCNT);
+      #endif
+    }
+  }
+  #endif
+  __Pyx_RefNannyFinishContext();
+  return 0;
+  __pyx_L1_error:;
+  __Pyx_RefNannyFinishContext();
+  return -1;
+}
+/* #### Code section: init_constants ### */
+
+static int __Pyx_InitConstants(__pyx_mstatetype *__pyx_mstate) {
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  CYTHON_UNUSED_VAR(__pyx_mstate);
+  {
+    const struct { const unsigned int length: 6; } str_length_index[] = {{32},{44},{1},{1},{1},{11},{49},{17},{17},{24},{29},{7},{9},{3},{8},{8},{7},{7},{8},{14},{12},{11},{7},{5},{9},{8},{9},{15},{17},{8},{10},{8},{10},{12},{12},{13},{8},{6},{3},{10},{3},{5},{12},{12},{8},{18},{3},{15},{17},{12},{16},{11},{15},{13},{14},{8},{10},{6},{25},{1},{7},{11},{10},{11},{5},{10},{3},{13},{9},{7},{12},{16},{9},{11},{6},{2},{7},{12},{15},{3},{13},{10},{10},{10},{14},{10},{13},{4},{5},{4},{12},{19},{5},{13},{6}};
+    const struct { const unsigned int length: 10; } bytes_length_index[] = {{594},{20},{206},{103},{208},{123},{55},{93},{199},{263},{710},{90},{112},{77},{89},{38},{48},{36},{69},{141},{109},{90},{144},{400},{78},{78},{336},{360},{185},{121}};
+    #ifndef CYTHON_COMPRESS_STRINGS
+      #define CYTHON_COMPRESS_STRINGS 90
+    #endif
+    #if (CYTHON_COMPRESS_STRINGS) == 2 /* compression: bz2 (3053 bytes) */
+static const char cstring[] = "BZh91AY&SYu&+\316\000\002r\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\375@@@@@@@@@@@@@\000@\000`\013\335\323\341=B\213\263\241\321\253V\r4\223$\300\036\275\200\007\326\003\303S\"D\231\000h\000i\351\250\r\030m\023S2\236O\020\323)\342\021=M\224\362hb#C\0104\000\017S\010\320I \004\023 \020\006\224\364\321M\2226\246\215\251\351\032\000\032\000\000\000\000\000h6\243F!\232@4\320!SI\241\240\000\000\000\000\000\000\320\321\240\000\000\000\000\r\000\006\215\000H\210D&\231SL\231\246\241\344\236\246\215\014\206\232h\3654\320\315!\243L\020\032\031\003M4\310\310\321\210=A\352hh\362AQ\t\3512b0\021\201\032`L\001\030\002a\031\032i\200F\000L\001\0310\231142hh\004\212\230\210\310\236\242zj\236\247\352\237\265\031\024\364\214h\233@\206\322a\r0 \310\300\206C\010\302d0F\236\243\004\321\211\236&\002\366bc!\214#$\313\047i\223k4eu\322\017\224\354\366:S\217\032\207\326\243 \362\272\206_\342a\3760\200\037\221\372\030i\037\271xPbD\2240\346\014C\261\222K\263#b\260k\326T+\230\262a\013\"\226\214 0\300_R\252\224\356\\6\330\3306\330\233\0066\232L\033\032M\266\306\206\333\006\333\023h\0306\333\032m\014\023L\302ZR\240\242\345\"J\317\375\005\005\027\025\036\220\"[31\244\221\n\311$d \255\202m\003\030\204\323I!\261\264!\274\364\247A\222\347*#\\\351\0050++.)\260\253\250*\td\334\266\026\311\000P\206\333I\203M\214.W\225\002/\0164\205\225\203\033i+\364\254\254\323m\r\343\310\214\3237\036\002\305\343\275\2314\026<\312\025\014Y@\231I6\221d@\342\023\006&\306\2241\005R$U\343\000\320e\026\0109\311N\364\202\345\226\255\206Q|t\312\031\263tt\210W\272\370l\264\305&p\343)B\352\345\315\013,\212\364\324\010\303\222\202\22400\367:\310(\005\225\306\203<\314*\213\316\313\254\213f\375\014le\212\010\206gV8S;\246V+\027E\030^\365yK\363\307;\214/Q5\272\314\253\212\215i!\317x\273;#\247F\213\026\256d B\330\252\323m\344\316\034\030?\243\010uO\200\276l\000\341#\322{\276=\027\370a\244Q\235\376\177\264\310\236;\235\375\377\256\276\254\267\002\322\222\334t\361\363-\022\326\002\214u\202#8\244R]\304\261\315b""\216\271\321\203DB\240\253\277\337\034\307e\352\250\271:\305\213\026 \021W\315\316\231\025\224\211\030\302\365\337\215\"X\222<\0304\253\231z\367\351P\241\"K\031\230/@:\033\277v\222\345r;/\272\343\001\024(N\r*\003\265h\363\321,\003\255\256\272\232t\343\010pst\236{\033p\266\225j\271\031\211@\033%MM\266\n\335fY\254\326\246\273+W\000Tj\366*\267KZ\304\270F)\014\013\202\341\335\226\273jX@\201)77\267W5\340\013\001AM\326\370P]\326e\3542\274\252*\246c\254\230\023B\231%\030\305ED\211\242\325\300\t\223\007\313\342\372\030E\026\206\026\356\230\027\nh\235\334S|\242\047(\227\307E#\200\352\rB:\234X\204tv\037,m~\375m]\256*P]J\372\233(j\363\204H(^\202\223\216d\2106\266t$\367\302\017\224\336N\047\336\262\353\226\257\277\017%\216>We\017\203\267$,\321\226\223\014\373\025\336\334\365\256{Z\325\315\336/7\020\221\005\217.\047,\222\222\222\262\313\354|E(\212\337f\320\250C\224\364w-\273\332s-L\007\203\360\363\234h\217\335\330?\240\337rVT\272S0\365\271\252\3616\367\267\344\272\326\251\370M\265\367\323\323\014\256E8\321L\031\233\277\335a\274O\276sW\206\261d\214\273<\363/^ku\322\356\245%A\t6\266\3156\"k\023u*CN\"\367\244{\253g\217*R\237\304\346\337Ae\205\254\026,`^\277\225K1\267\265\316\260\337!\333\345\tbb\261\317\364i\024\373u\324\005E]\252\307\3633\321)Gf\342J\262R*L\236\377K\275Z\023\047\304y\236#\222f\024\302|\376\214\211\0263{\350P\211\227vQ#\212\226q\354\317F\254i#\332\304\221\244\006\324\006`b\325\355\353\t\304\215\031>\0169\017\3051K\243\260\006\177\215\320\036\340:\237\000\047\273\324\353\327oR\353y\262=XxR<.P=\177a\301\210\327\371$\215;\227H\233\322\275\225T\337(\246\223x\032\212\264T\223cly\204\342\346Wpx\t\245\272F\334[\243zp\352Y\246\355k@K\222\2236\241\343R||\316\031\1773/\366;\240y\021\212\2159\356\351M\241c\2534-4\260\004\365\374\032\370\2405\321\n\032\267\027\333\305\322\230\334\335\211\031[\244\243h\003cY\371\306z\3178#\3702\356\357]\323\310A\010`\034\203\213^yCl\366p\2255\347\231\221\322rx7\236\273q{/\333\213\224G\016\033X\316\006\324\344\346n\330\343\275\ni(y)y~\302)a\327""\021\340\356\006\205N;=\255\325;\362\215\306\206C4G8~I\016a\225\033\251\324\047\236\0044\035\333\361\205\344\274\215\353\177s\257\265.\216\033\272w\365\336\203\247\314\237\"\336\315\252\324.J1\031\253\325`\322u_\336\344\332\216\326\217\206<\031\220\036F\027\227\337\305\277\233\223Ujup\2121\355\323\217\264\"\260U\232\227\026\255xL\026Mi\304=\201\211\322\356\331\341\021\235\345\363\311b\014\030\215\002\370\244\245,$\371\240=\374\232y\342ShY\215\375\232\315O\233\366\236\013\271\022#G\304\317\244\351\327\020\3452lyos\335\022\356X^\214\343:\270v\355\222 \305D\304\3254\276)\024tDK\336=\351U\237\352\236\035\001\344\320\025\002\315\027\020\341\305\343\024\250\214\014\273\036\\\304\210\370\375\245\361K\275\345.n=\203#\000*\310rP6\367\r\275\234\346\324\272\047\347e\016\327\252\004M$\220\0316\366\\\233\021{\332\017q\001\347\034\047\035O\367y\346\003\274\247\366u\243\255\020xA\240I9*\250\320nmicb<\032E\317r\303\222\351W\r\242\355;\257M\2233J\023\032F\315\201\231\021\240=\332L\246\340\357\2647\364\253N\363>\020\267\374.A\231\213\310\004\211\271\3429\370c\305\317t\365{.\255$?\240\270kK\271y\224\202\371j\236z\251\205\312\236\\0\"\373\216\014\364Bc\201\220\3471O\221\251\316\010\020\203\214\341\013/\001\204\261c1\230\341\002\322\255\231\301\254\006\330\026C\004\200\225a\0250)\n\360A\200E\230G\227\261w\235DP\352e\247UHP,\246l\033\256\300\214\335\306n\r\310\332k\340s\363\374k\204e\321\2620\026\374\374.\317\334\261H\302\271\006G9\222\346\047)\241l\245\021B\210\323H\210\212\211\250\267m\006\335\316\222V\347\350\234v\030rM\024\264\236n\037^f\230\333\023c\014\201\026\320e\031\352\364\022/\327\004@\t\006XK\333\224\211^\204&v]\354\276\236{\017\273\236u\027U\210M\241\203M\210b\372F\206i\010]n\223la\265`\233A\323\355\250\0240%\266\215\344\254\307\n\024\002\352\007\336\372\000.\016P%\265\047\n\2470\355\016PHt\t\372\371\014m$\276\306g\r\270i\"N\024\002\237\345\232m\004w\260\323M\376\014\036\335\350s\300\345q\252\312\211\372:Z;\035\003\217\244\322\374\271\2655aA%\247\023:\341\310\356@-\323s\013""\355kUuH\\FS\024\n\252F8{\310\021x\311D8\350\234\336\300o\235\003[\310\215v\267\272\211]\276\274\222+P\243_\264B\263]_\371\373,\347\032j\377q\237\345(i\360*Pn$\215W\027\221\007\235\346\273\216{<\366\211\244\276\000\315c\014uu\337\352q\307\371\3669\300\337\tR 5!\310Z\220\343\213\023Hp2\007\321\352jW\263\211q9\240\356\365\"e\035(\277\246\342\270\034\036\232;c[\023L\220\321\031\206\347\202\001bU}\205(QQ\032\0047\010\202\306\213\256\271\254\350tnl}\302\205\332G$\274k\246\314,\345<MF+\0210\321\305\343\034\235e\3139d\252\326\260\336\010!=\205\004\305\372_\337(\276\340\360\227\3718\030N\342\362b\202\021h\030}\221\302\324\324\337\000\263y\244(\272\367\002/\312\032\241RG\022\010\022\024\217\265>1\376\037\026\267\222\207\310\0251P\177\207\274(\030*\271\357\216\0107\010\047<n\244$\030T\024\363i<A_\322\177:\220+\350t\341B\274\355G^M1\000YF\372I0\322\2617e\320tL9F\215\343\031\360\251\302x\035\311a\353f\342\r\324\242\330\267\001)(~\031\300\224\274\330q\303|<\024\026\324\307\267=\347\304\374\020\372\224\023\233\035\242\004\031hf\0236\303dS\347\247v\371a~\317\014asL\322\340\350\205k\321\010\267\276\235\206\350\361\333K\212B\304\247\t\360W-\342\316\275=\262\347\266\237\023\026\230\"3:\024\0012s\2048k\014\206I\215vKI\205\232 \242\347\025\246&\332y\240\260j=\211\2455\025\314\354\260\255\0219hiC\rM\274L\245\237;\026\001M\023%\225i\003(ye\253\206\304\300p\244\344\327\224%\025t\250x\242\246%\315\014\274\272\310\224`\224\251\231C\303\341\312\333\356e\025u\253]\303\375I\t\256\241,\327\022\027\273t\202\227\313\337\221Wd\206\017S\221W\047\047eE\007ZG\3438I\223\034\024-5\366W\332\030\272\263\3623\252T8\353\310\215\217J9\220(\326Dj\\\345\364\006[\357>55\237\004\273\366q\213\300\367\177\023\272\340\355\341\016\324\230\246\275\346\242l\025Z_\234,-g\241Y\240+\306\314\314\211\253!\246b\304\303\260\321\351\351L\345\231j\341\224\251\205+\001\214TK\021tD\341\006\021U\003kY\375\253]=\355+\361\020\204\202I\347\244\nd\000P\277\272\000p\371\004\030a\031wk\253pM\240A\032\021\3305\245\010\320\256\301F<r""\234\204\241;\221-\262\226\032q\000\353\256(-[\362\354\221\340\273s\033@9\200\213\240fr\253\025\t\333\3660*h\355\355\357I\324\211\246\327\257G\027\021\271\221L\203\353H\300/*2\227V\215U\245mV,\260E\321\223(\316\322\330\221B\356\035Y\025]LC=\014`\253\322\205R]$\220\325Z\301\2125=\313-Z,\232D\264\311\254\030\314\025iX\014d\232%r\260\314V%\001d\253\207.\214PD)$\222\021\225kR\014\321^n\232j\253\0040\013[\312\326\325s\341\252\321M\254\253k<\210,\355\n\356m@f \202a\326\365\333\027z\311!\354\314jJw\356\326\354QV\344\265\036<e\206!\nD\264\214\325\306g\224\245\213U\315\014\231\336U\335\214p*\032\312`\245\252\\\330=\355/ip0\023\221Z\001X[*\260.\356\244<&\271d\367\331\352\027rE8P\220u&+\316";
+    PyObject *data = __Pyx_DecompressString(cstring, 3053, 2);
+    #define __Pyx_DecompressString_LZSS_UNUSED
+    if (unlikely(!data)) __PYX_ERR(0, 1, __pyx_L1_error)
+    const char* const bytes = __Pyx_PyBytes_AsString(data);
+    #if !CYTHON_ASSUME_SAFE_MACROS
+    if (likely(bytes)); else { Py_DECREF(data); __PYX_ERR(0, 1, __pyx_L1_error) }
+    #endif
+    #elif (CYTHON_COMPRESS_STRINGS) == 1 /* compression: zlib (3126 bytes) */
+static const char cstring[] = "x\332\235XKW\023\331\026N$h\200\240D^*z\273\322\200<\244\355\216<\005\265oDPTlB@@\324X$E\210\206\204\244*\010\352r1\254a\rkx\2065\254a\rk\230\341\031f\230\237\340O\270{\237S\225\007\250\335}]\213\324y\356\347\267\037G!!f\205lN\021v$a_T\022{RR\3309\026\224\343\003I\330\315\025\2041\241(K\302\273\202$\3472\207R\034\226\336\t\037\323\312\236p(f\212\222,\344v\005\261\220*\356KYE\276\375\347\0331\013\264D%\235\313\n\211\\V\021\323Y\251 $\366\304l\n\350\312\351O\222\220,\026\322\331\224\220;\224\n\231\234\230\024\030\345\"\336p\227~\337Ig\223\267\017\216\222\247\026\216\217\212Y\271xp\220+(@\254\306iV\370\321\372\032h\261\035y8\277,)b\204\257K\311H\366x!\223I\037\310iyI\221\n\342NFz\236\306AfY<8\000\331^\344\262\022\336\\\331\212\307bK\257\026\342k\361\345\310\346\312\361Z\361 #\305\331\3161\376\262!\376\275\024\013\353Y`\310~\330N\034l\"\307\341\337N\256\230M\342\000\254!+\005\260\207\302\326\3230\023\263\t\t\354\235\370\200\013\373\260\305\276\271d\021\270\300\277\254\270\317\276\271B:\305\367\300\002\361\204x\220\306q\276(f\334\023\240\274TP\030\337x\\\221d\005>\322\376\201r,\356$j\346\000\221\0307\366#%\347A2\305\031/e\223\322Qb/\235I\026\244l\"\003N\003\001\343 nB\332\021\341FFN\3442\031)\201d\344\333@5\221\333?Hg\244H\225\270\2630\237\021e\331\035\273\376w\346/rI\311\031\306\212;\tv\262 \201G\226\031\354\nI\020\274\220;vf)IaF\304/\267@\252(\026\222\362\236(\243\205\037\2122\212\315\2158\217Z\244\301\244\007(\"\332\271\310D\005\007;\047\322\265K\340\352}9#\036\347\212\n\3163{2\203\375\2434?\311&x\230\007C\301\371\314#\026\235\261\014g\337\347\300\223\373\000+\246\307~!\347\336\317\355\274\007!r\007\007\205\\\252 \356;\037v\335\031\273\047\013{r\241\230\235\257\032\026&\016\000\331\210\261\202\321\n\277\005#\206<>\223%%)\355\212\305\214\"\247\367\0172\351\335c\206=\0140 ^P\020\014\370\347\362RjW\353\227d\366\343\252\003\023`\276r\034\227\221N\\\021\206\271%\005\216<%>\343\006d|\002#2\356\010)0l\013\243c\302\312\361_L}at\304\343\001\212\302p\375\n[\370\033\222K5\357}""\237\354?!\362S\271\376/\002\377\356\374\210\347\037\236\2573\317\230\000\202\375-\243jL1\310\217x\016s\351\344?\325f\304\323\000tO=><?\014+O\r\202\236jlxNG\202\247!\222=\215\241|\342\255\370.\252\242\372Q\023\313\356\340\304\373\355\274\247\271C=\324\242e\337%\365H\313\343\347X\367\362O\200D*\276v\365\225\226\327\341\362\205\223\317Z\277\266\246w\352\317\210l\204\312\376.-\242\275\324\357\222H\271\245Ck\322\246`\3471\031\047b\331\337\t\223 ~\356\352\363z\236\370\r\257\341L#e\177\207vA+\342\340\222\372I\017\352@(\240>\326f\3640\254\005\372\340\263@\256\"\371Kj^;\257\355\351)\262n\364\033\253F\276\334\322\251\205\265\347\304[\275Z\361_T\323Z\236^\2316\363\226\327\325\346\273j\\8Q\324q\265*[K\273\032U%m\\sW*\256\320m\352\0040n\3266P\234\313\332\020\360\031\320E=_\361\265\251\263Z\3245Z\247vK\217\"YY\355W\243\250U\213\336\007\246\250_\361\201\201\266\364\017\240{\375\252\367\373\263\267\372\270\236 \235@\302\021\001\351=1\346A\357@\227\266\244o\033L\357|\335m\230\241\177\300w\001\365\271~\016L\351\363\253\315\352\272\026\322\346t\021\251\007\364\210\036E\202SZ\247\006\372\200\001\313\376\313\032X7\250u#\020\332\3240\350\343\3674\373O>\002&\016\231\177A\204\226\n\320\\\324~\205KU\232\323zH\237\"\314D\3230\235\322\273\364\0308\003\210\362\235\313$\3148h\213\372M\276\216\303a\022r\207#x\240\035y\367\352^\275G\317\327X\357j\363\3405f\305^\302lR]\273\244~\001P<&3\306\244\351\255\223\370\006\254M\032\000\314Kg\360\333\304\300\344b\300\361[\005\024i\321@\374\253\340\322!\300\330\260\031B\247\206A\317aX\350&\t\343\262\201\304\003u\304/\234\024a\277_{K&H\321X4\373\315m\333g/\224z\351J\214\306\326x\024\2543\325\320h\010Z\237\366TO\223#p\034\343\010v\326\016\365U]&CF\267!\2361_{\005T\204`D]\033\211q\331F\364{$_\256N\302e\206\345\260\272\000Vl\326\327H\027\211\022\311\2306\301\251\027\325\024h\232\004o\240\032]\236\346+\032\273\371@\277N\2428\230\001\377\263y\0205\313s[\214\221\224\361\312<\262\230\255\277\"\320\214^\023A\336\022\000I\207\201\332\035`\203\310\004?B\234\226\333""\273\264\047\000\254U]a\341\356\254\342\207\366\335\002I\206\255\220u\307\212V\234\215\226.p\344G\000w\037C\263\237;\212E`F\357\327\243\356\n~h\357\020\311W\334\005\356\271\014\"\250>\022\201\356\003\002\032tj\223\200\243 \367\360k@&\006\003\304\270\373\341P\351\371)T\234\034\341\255&:\307LZ\304\315x\033\220\303>C\006Z3;\315g\226l\207j\231\213iVt\366\243\ry\357\271\341\255;w&?\206\001#\273d\311\3304\243|7|&kz\0332\344\022\310\035\350\005 \261\3171\002\007?\001\203yeV\217b\300\177\047e:\264{A5\037\370\354%\2315\326\315\021+\354\312\324\005\256\355&Ic\310\014\232cV\246t\223\343\272\342\310\230$#\306\214Ywz\235\014\300\351\2201n\210\306\241\271j\312\326\220\035t5\332\003 N\030\237\254.k\313\336+\211U\356\210\262Q\262l^\265\206\301|\2654\216~\333&\027\000\336\201\033\240\301{#`.Y\233v\264\334\016\362\242\202y\275\225\214\322\261\007V\332>*1\307sM\201\260W\273\016\t\230\223\246\003\023\316\305\252\234\020Z\244\007\352\324\257\306#\323gF\314\230\325\004J\373\257\000`~1\374\260\364\320LZ#\366L)\314\345y\242/\202f\357M\257y\305\272j\017\330\211R\320\265\005\277u\235l\032/\315\273\326\023;r\366\3065{\302\226K\241\322\024\215\256\321\265\365\032\237\363f\332:\262\363\356\215\010\017\361M}\013`P\263\003\256\275\306\252W-hw\314\220\031\256\370\202Z\020C\236z\272\265\350\267VOs\213\223\212\357\203\321\212\340z\177\273\272\001wWy\260\214\253\t\255\017\260#\223~\362\032\320:\017\336\031\261\307A\227\316\322\013\372\352\r}\363\216\276K\320D\222\027\002\214\017\352\001##e?\275\300k/\244A:r\337\212Z\222\035\256\026\234\242:\017P\274L\373\3760\233\314I0\345\254\275j\347\235\n\324\252\216\202\014\020V\325\001\0240z\251\237\204\311\002d\274\2449@\247\236\202q&\351J\224z\200\013f\357\0360\302k#h\204\260\230:j\321N\274\303\n\340=\226\010\214f#\006\014Yn\271\303\264\364\265\3216.\047T\033\352\001\324\240\360m\352\200\372^?G\257\335Fn`r\047J\025\324\262\0256\323\232\254\017B\272\232 _\001\t>p\342\013\272\032\303\270Z\206\250|\204\035J\305=\317\254\002\202\324r\3776i\202\364\321\304\352\017""\267H\233:\251yO\235z\003h\220\214;\020^\214wA\273\014\351\251I\277\017JD\035\252\017,\021\305\355\206r\036\345y\030\230Sa\334\0347\263\366\274\375\261$R\317C;\3043O\210]\017\363N\3513d\341I\322D\373\307\315\tS\246\263/Jb\3513}\265M\267E*\346i\276\300,\363+\ta\236\243\236Gv\344Teu\034Y\2333\007a\340,\262\010>\265w\223\210\344\320\3300#\330\007\274\000\346\323d\330\0304\024\223\225\237C5\006\215\013\307j9\200!8B\246\351\350&\335\334\242[;t\047\201N\r\360\246\203z\236\225\320\343\347\232O\036;m\310\271\0265X\366\372j\363vu\233%r\330\270\3122\356\"\351\247\203w\255\2405j?\206\010\255?\333B[\004\210\355n(Z\321\262\327\257\266\262\316d\230\014\022\305\010\273\314\232\203N\353\343s{ \220\372\023\020X\000\213?\205B\037t\260\353W\003@\324\217\375\023dTD\300}\342\245\241\260y\215\316\001\251rG/\257\240@\371y\211\331\364\2261f\356XP&\306\214\347\3269\353\226\035\305\010\030\321\302\274\307\274\307j\010\047\316\250\202qnA\352\210A\236\010\362^j\013j\375G\310\2547\ro]k\326\316\373>L\370\277\221/,\310&\254O\220\205~\247[\022\225v\235\346\r2B\245&O\353\331F\264\261E\354\304NPg\376\207\266\010\313\363\234\231\262b\364\277,M\005zh\317M\362\301\014\326\337\347\316/\032\317\314\306^\323\201 \231\203\314\377\031\022\371\000]|K\337\306\313\201n\326\262\314\031{\246\330 \007\266mKP\211\006\350\355\005;jK\2459\372r\243\341\004*;\010\305s\030\202v\337\016\333\3134\272Z\376\321\201\367\266\327\276Q\022+\265f\267z0\000\315\020\266Y\237\261S\340\267\206\240\035`\316c\342\361\347\004\242\322\017>\272\017^\271\n\200\221\351\350,\264*w\241\235\353,=\243\033\233\216\365\032\232h\327)C\344:\375\r\363b\332.\226\"Uo\270]4\365,\227\242?\213\271\317\220\2247X\003\351Z\023\2751e\366\"\226 v\377\003~\372H\366\014\t\002<\317\251\265\376\033j\372\234\033\262(\317\237\365!K=\177\225\362(\333 yn\236\203\364\344\303\334\332\206\005\006r\000O\240\016\200\277@I\302\030Y\306\324\214\224e\260C\330}Jl\300K\312\217\271\317\207\"U\002]\264k\204\035\014t\300\213i\035\373\316r\307ux\037b\346\216\032\0310\356\264}""\263\344-w`\341\216\221V\350J^a\372zZ\032,\345\313]\335\2701A{o\031a\343\031\235~\314,\333\325\307\251p\033W\252\316\315\243k\213\300X\346|z\2601\344O\016x\306i_\240t<\006{\006y\030c\237\220\202*\350\240\200\007\344\205\223\257\370\022\250\2513\017\222z\021?O0\004\261;\214A\364v|\237\006 )\352\304\336\n\224\262j\360q\257\1777\374\300\257\277\350y*\374a\236\247S\213\366\007\3047G\316\351\227\334Wzc\002\332\224\227\326\234\275\217=GC@\016\323\341\031\253\331\212\331m\2450\0025I\223\322\231\023\367\254\010\275\277\\z\t\267\351\332.\335M\375\374D\212\246\366\316\304R\343#\324-\003\333\226\327\221\372T\240\025\265GX\242\276\033h\027\361]z\3529z\221a\\<\375 \255\316\300\300\2151\265\001A\371\355\342\337%\271\3233\047\266&\3156+|&\205\3610ym\005\177\260\003\312\262g\334\217\036\325\374M\222\302>\374\032\\\232%qp\333\206\025i\024\3745}\375\006\001\"\350y^\315\007\264\204\036\254\212Z7\257&\202>+R\371!\317\007,\003\365\260\377x\341|\351\340\214\345\265zmo=\343\377\001\033\321u\016";
+    PyObject *data = __Pyx_DecompressString(cstring, 3126, 1);
+    #define __Pyx_DecompressString_LZSS_UNUSED
+    if (unlikely(!data)) __PYX_ERR(0, 1, __pyx_L1_error)
+    const char* const bytes = __Pyx_PyBytes_AsString(data);
+    #if !CYTHON_ASSUME_SAFE_MACROS
+    if (likely(bytes)); else { Py_DECREF(data); __PYX_ERR(0, 1, __pyx_L1_error) }
+    #endif
+    #elif (CYTHON_COMPRESS_STRINGS) > 0 && (CYTHON_COMPRESS_STRINGS) <= 90 /* compression: lzss (4173 bytes) */
+static const char cstring[] = "\377 can not\377 be matc\377hed by t\377ype for \377, use `r\177esolve_\020\000\377` with v\377alues of\377 argumen\177ts.?]anI\000\377ation co\377ntainer \337changU\000si\377ze durin\377g overlo\227ad U\002u.\001\013\005/\377bind.pxd\376\002\014yxunsup\317port\242\000`\007: \372\000\025T\303\000[ABCM\357etaA\224\003edA\377nyEllips\377isIterab\357leLi\005\001lMa{pp\231\000None6\001\377PY_SSIZE\377_T_MAXPy\277Tuple_\025\002y\370V\001\006\002_\001VarUn\350\360\000\000\002\025\002_\221 s__\177__bound\005\001\256\213 str\215 t\023\002i\177nstance\355 \313ck%\001m\250 \003\002odyuc\0009\000name?\001\277originI\001p\177yx_capiU\001\317qual\032\005\222 er\274\256An\001testw\000e\177mptyabc\207G\270\244@i\002n\002edC\227\000t\376\005\004Indexch\377ildrencl\362\262@_o\000\254\000ceba\377ckclscol\267lec\324As.S\000c\177ompileA\345F>\n\004Class\004\005\370E\336&\004Node1\004Su\373bc%\002reate\355M\362brd\266\000roy\216\007\004get\300\"\004\001\374\003g\377uardshas~\322ABasedI\276$\277Checki\320 p\214\237\001\327 ru\246\002\336@\340$i\374+\007\350@mslayo\273utA\001lhs\362\204\002D\241i\213C\377\204\002\264a\207\205\003r\000\004C\364\254\204\001\014\004s)\000joinstm\324`\303\002mro8\005\367obj\245 oppr\037ogram\000\004:\002\014\004\376b\005rhsrunC\240\320&\n\000\372d\005\002\207\206\001r\036\000P\360C\003(\000\217\204\002Q\003setd\377efaultsi?mplify\374b\335\205\001\006\325`rt\273\206\001\277\206\001\316\005\313\206\001B\004\262\007\ts\343\206\001\306\006ty\372\204\001P\367y_s\245\206\001_t (\273st\306! __\366at[_8\255\206\005_4\237\206\001_\262D\376\346\206\001st *, P\373yO\372\002 *)\000\000F\236  (\006\t\014\0024\034I\264G`A\023!!{\032\0142\333\200+)\000\222\201$\266\224(, \316`, \323<C\374\314\211\005\356\204\002)\000voidV\377\201%)\000\334\204\n\000\224i\000\276\205\026\325\000\371g\000\223\205\006\000\372\204\r\000c\372\276\206\t\000\275\206\013\200\001\340\004\016\177\210a\210w\220a\330\001\005\377\200\001\360\006\000\005\020\210\377v\220Q\330\004\017\210x\273\220q\003""\001y\230\001\001\003\014\377\240A\340\004\r\210Z\220\373q\230:\000\007\200{\220#\377\220T\230\023\230K\240s\377\250!\330\010\024\220A\220\377V\2309\240A\330\t\020\357\220\003\2206\027\000G\2403_\240a\330\010\023\n\000\021\003\001\3779\230C\230q\240\010\250\373\001\250\010\004A\330\010\020\220\357\007\220u\230\006\000\017\210z\367\230\021\230F\000\014\210G\220\2678\2301\021\000\014\033\004\000E\373\240\031[\001\017\210q\220\006\377\220h\230g\240U\250#\377\250R\250q\330\t\023\220\1771\220L\240\001\330\0104\004\377\340\010\016\210i\220q\320?\0307\260q\270\001\306\005\262\022\277\007\200t\2103\210\223\006\t\377\r\210Q\210e\2203\220\272\246\005\340\255\005\013\2104v\000\005\273\220W\213\001\022\220\047\240\000$\377\230a\230q\340\004\013\210\337:\220Q\220a\257#\023\220\377+\230Q\340\004\007\200s\357\210#\210Q\322\001\t\230\033t\210 \006\t\004\236 Y\230k\371\000\360\034\t\332 +\010\005\006^\2303\230\227c\240\023\313 \010}\003L\001H\373\250C\365\000\014\024\220I\230\003[\250\363\002\237@k\006\237 \234A\271@\337\014\210L\230\002\310 \004\010\377\210\005\210U\220!\220;\375\230\204@\020\220\014\230A\230\376\232\000\013\2106\220\023\220A{\330\014\276 \330\010\022\220\272@w\021\220\025\205a\013\2101\202`\277\010\000\005\010\200w\232`v\374\333B\242@\t\340\004\014\210F\363\220\"2\000K\0067\230!\230\2736\240\325@\013\2107`\0006\217\230\024\230S\212@R\000\024\003\022{\2401]\002\220F\230&\022\003]1\010\000(\240!\016\005)\035\001\377\r\330\010\021\220\027\230\001\357\230\026\230qq\007f\220C\274\372`\231`\t\230\027\240\235\"w\335\210\r\004\017\210|\231`G\240\1778\2505\260\001\330\004\251\006\377\035\230G\2405\250\001\340\353\004\017\257\204\016\003\310b\004\017\210\364\306\204\002\261D\340\232 \t\220\021\330\353\010\031\363`\047\341`(\260!\372\321A1\345\000(\230\047\240\025\337\240c\250\022\250\213!\014\000\335\005T\006\007\200u\205 #\220\377^\2404\240u\250F\260\377#\260[\300\004\300E\310\177\027\320PS\320ST\200\205\003\313U\230\327\001\010\262 \261\204\001\004\220\377J\230i\240x\250q""\330\374m\002\345 \220v\230R\230s\377\240\047\250\025\250a\330\010\036\260,\r\340\010\017\222\206\001\374\001\317\205\001\370C\007\232@\201@)\230<\240q\354\363\002\010\0021\330\362`t\2101\373\210E\303 \005\230T\240\024\377\240Q\240e\2507\260!\377\330\010\016\210g\220Q\220yd\245@\322A\024\000\005\030\316\206\001\177\013\210>\230\034\240Q\267!S8\220<\000\014\001\021\267\204\001q\206#\377,\240g\250Z\260x\270\356\014\000\017\210~\345a\250\027\260V\226\207\001\t\014\346@(\363@2d\000\374\226\204\001\275`8\2301\330\r\024;\220H\326`R\230t\352\206\002\017\004\356\031\001\320\033+\207\000(\270!\337\2702\270Q\340(\004\t\024\276\332@w\230c\240\033\311\204\002\010\034\343\207\003\375\205\002l\230#\234\204\001\365\207\003\025\001\277\320\027\047\240q\340\034\004\010\362\354\205\003l\276a\376\205\t\014\023\220>]\240\277\000\023\2205\305`\021\220a\317:\220\\\240\006\000\322\206\001a\330\251\004\000\004\327\204\003\026\303H\017\323\210\025\001\314\340\210\006\240$\220A\331\206\001\356\210\001W\230\377C\230{\250#\250T\260\177\023\260K\270s\300!\366\207\006\325\330\325\002u\031\004Q\353\210\nL\250\364\235\210\007\215\211\0201\241`f\240I\250\227X\260Q\270\211\0031\245\211\0165\010\010\377\014\210I\220Q\330\014\027\364\306`\002\002y\364\205\001\027\220y\240;\014\250\321\206\002:\230Q\355\206\001\240\211\020\374\226\212\001Y\000\027\220q\230\004\230\377A\230V\240:\250U\260\327)\2701\254\212\005\024\277`\025\240\377d\250\047\260\021\260,\270\307l\310&\322\204\003\213\211\001\240\001d\240\357)\2508\260#\010U\240$\376+\000!\2503\250a\250v\177\260R\260s\270\047\300\346\212\002\376\316\001h\240e\2504\250z\377\270\024\270Y\300h\310a\374\321\006\356\205\001*\240M\260\031\270\361(\274 \275\212\007\316\211\001[\240\007\240\357q\330\014\035\277\000j\250\014\377\260I\270X\300Q\330\r\374\255\000\353\001q\230\n\240*\320\377,>\270i\300x\310q\374\315a\344\003\t\020\220\001\220\034\367\230Q\340\310\206\002*\320$4\3702\004\203\214\004\225\210\002\240\026\240s\250\377\"\250D\260\004\260A\260\367S\270\003""\362\000\010\030\230\001\357\230\037\250\010\020\000B\260d\277\270)\3008\3101\321\213\003H\373\230F\327\000j\260\001\260\030\377\270\031\300$\300c\310\021\372\204%\3301\002\034\240X\250V\277\2609\270H\300A \017\032\377\3004\300s\310!\3106\177\320QT\320TU\330_\006\277\006\260i\270x\300\264\214\004H|\362\214\001\262\215\001X\230Y\240a\304\214\010\362\306\215\001\\\362\214\001\310\214\0062\260!\260\3771\340\004\021\220\021\220)\377\2301\320\000\025\220Q\360\257\n\000\005\t\330\212\004=\262 u\376\370@\010\r\210W\220A\220\375R\270\211\001\013\2103\210c\220\377\033\230C\230s\240#\240\337\\\260\023\260C\233@)\300\3753\311\000\023\310N\320Z]\377\320]`\320`c\320c\231d\203\213\003\307\211\001\320\000\227`V\001\010\373\320\007\366\215\003\025\240c\320)\177=\270Q\270e\3001\345\215\001\376\354\213\002u\210C\210z\230\022\177\320\0330\260\003\2605\310 \357:\300R\300\253\207\002q\340\004\237\n\210*\220A\276\217\001\000\006\013\377\2104\320\017#\2401\240\377E\250\025\250d\260$\320\3736J\232 5\320PQ\320\377\000\033\2301\360\010\000\005\377\026\220X\230\\\250\021\250Y!\376\217\001\320\004\320\0230\001A\236\211\001=<\204\207\002\250\005\250Sn\000\322\213\002\2752\341\002\004\013\320\013\236\217\003\022\361\240\224 \263`\223!\013\210$\210?j\230\002\320\032.j\001\360 \352\237\206\004t\353\210\001\n\032\000i\220s\377\230%\230t\2404\240~\372\207`\004\302@N\320RS\330\377\010\014\210M\230\023\230D\030\236\220\001\202\212\001+\002\013\210\355 \272\000\331\216\001\376\366\212\003[\240\003\2405\250\003\356\373\213\002\010\017\210\210\212\0025\220\001\373\320\000\031\n]\240$\240e\357\2502\250U\206\212\001\017\210r\377\220\022\2205\230\003\230=\270\302\000\367\211\002\303@>\270a\302A\025\327\220I\230\212\212\002>y\001\320 \3773\2603\260n\300C\300\377w\310a\320\000B\300!\352\364\207\003!:\0021\244\221\003{\230!\377\2305\240\003\320#3\260\3774\260s\320:N\310a\377\310{\320Z[\320[a\177\320aq\320qr\330\226!\367\"\240!\217\215\001\320\000D\300\003A\360\316\216\004\275\215\006\265\217\002\314\215\007""\234B\265\205\001\335F\275\206\002\004\007\200\020\t&\240\177a\240v\250W\260A\204\217\001\377N\230!\2307\240(\250\357%\250t\260\372\213\002v\210S\267\220\001\330\367\221\003\330\014\314\215\001)\377\2407\320*X\320XY\277\320Yb\320bc\323\223\001\014\336\357\217\003\320\000K\310\356A\002\005\373\200G\200\220\004\002\t\210\021\330;\001\004\006\007\r\210[\304\212\002\026\000\377\031\220#\220W\230F\240\377#\320%9\270\021\270*\357\300G\3101\037\n\t\320\t\377 \240\001\240\025\240g\250\377Q\330\001\010\210\n\220!\377\2207\230(\240%\240t[\2501e\005\005\021\364\220\004\004\374\220\005\377\004\007\200z\220\023\220E?\230\023\230J\240c\213\224\001\271\221\002\337\010\210\014\220A\204aL\230\377\001\330\014\017\210t\220=\377\240\001\320!1\260\032\320\335;\265\000\330\020\027\274\215\0031\320\367\000L\310\317\"+\250,\260\377b\270\001\330\004,\250L\277\270\002\270+\300Q\376\204\001);\2201\211\223\001t\210<\251\225\001\263\205\002\374\276\221\001S\000\230\021\230+\240X\277\250S\260\001\260\021\215\217\001\005\377\210Y\220a\220w\230dS\240&\316\222\001\222\222\006\r\225\217\0014\216\225\002\367-\240|\340\205\0024\270z\310\377\021\310/\320Ye\320e\235f\266\222\004\021\220\021\260\220\002\212\003\n\243\000\005\371\223\r\233\204\002\216\224\006\023\206\223\001\230\356\325\216\002y\230\003\233\216\001;\260g\357\270S\320@\242\210\002\014\026\320\277\026&\240k\260\021\276\224\010\017{\320\017\371Au\250K\260\336\223\013\376\374d\240;\250a\250{\270\377(\300$\320F^\320^\337_\330\014\025\220\374\220\001;\250\347h\260a<\t\262\222\002I\240U\377\250$\320.E\300Q\300?e\310;\320VW\025\n\374\226\001\377%\230{\250(\260$\260\377m\3001\300M\320QR\361\330\312\225\007\233\227\003\031\005j\300\001\300\307\035\310a\321#\350\224\002\364\225\006\014\210\315E\313\224\001\220{\350\223\001\321\227\003\047\240\321\021\267C\232\002\257\216\002q\351\230\001\010\200\177t\210=\230\001\230\031\256`\377s\320*:\270!\2709\377\300E\310\023\310K\320W\341X\351\210\004\270\225\n\214\227\001\244\230\001\047\240\034{\320-\224\211""\001i\300u\310\303\225\005\276\274\225\007\320\000M\310Q\330\205\031{\257\240#\240W\274\223\002Q\274\230\001{\273\230!\251\221\0016\260\027\310a\013\377\320\013\036\230a\230w\240\177h\250e\2604\260qH\0031\n\221\226\003\256\206\021<\017\230;\253\206\005\240\225\001}?\247\206\t\320\000O\310q\361\211\001\377%\240L\260\002\260!\330\277\004\047\240q\250\013\335\213\001#s\2401\273\211\003\272\204\004|\2201\237\205\002\371M\227\212\001\344\231\001s\220!\2201\374\261\232\001\307\227\001W\240A\340\010\013\357\2105\220\004\253\226\001\340\014\024\367\320\024)$\002\014\020\220\005\376\203`!\2301\330\020\034\230\375K[\000\005\250Q\250l\270\377!\2707\300&\310\001\330\377\020\023\220:\230S\240\n\357\250#\250Z\273\210\001J\310%\337\310q\330\024\025\025\0014\320\377\027+\2501\250K\3207\315G\325\"\024\033@\003\251\230\003\340\010\372\325Eq\234\206\001u\220C\220s\376\334\224\001\330\020\026\220l\240!\376\355\227\0033\220a\220|\2401?\240G\2506\260\021\301\206\003\216\221\001\217g\240\\\260\377D\263\212\001\252\232\001~T\276\232\001\305\007C\205 \001\203\213\001H\232\231\001\346\305\227\001S\230\253\000.\023\014\025\220\035Q\365\205\004P\320P\213\216\002\201\233\002\344\211\003\374\201\233\004\361\205\013\013\320\013\037\230q\377\320 0\260\006\3206F\343\300k\334\204\001\377\231\003\231\206\013\017\210~\377\320\0354\260A\260V\270\347;\300m\324\227\001\373\204\010\320\017(\377\320(8\270\005\270S\300\367\013\3101\245\204\001d\320de\375\330\022\r<\270A\320=M\377\310V\320ST\320Tf\367\320fg\004\033g\320gh\370\273\205\016\367\233\013\204\207\003v\250[\270\001|\264\233\004\332\205\014u\220D\230\003\360Ax\252\222\002\204\207\001\337\205\007\016\210Q\330\377\233\r\341\016\337\204\002\376\230\002\205\234\t\226\234\006\025\220Q\374\232\233\001\222\234\005\320\000W\320WX\343\360\016\305\210\035\274-\325\205\0045\260\013\343\2701\302\207\n\302\215\001\241\205\003\\\270\0218\003\024\352\000\317\233\001q\330\004\277\235\023\200\237\003\377g\230Q\330\014\032\230!\377\230:\240_\260A\260W{\270A\253\013""\\\320\\]\255\222\001\371 \265\237\001\266\241\001$\220c\230\021\346\307\221\006{\220\007\006\200\207\006\033\270A\245\340[\026>\257\234\002\315\224\001!q\004\320\377%8\270\001\270\027\300\001\000\246)";
+    PyObject *data = __Pyx_DecompressString_LZSS(cstring, 4173, 6216);
+    #define __Pyx_DecompressString_UNUSED
+    if (unlikely(!data)) __PYX_ERR(0, 1, __pyx_L1_error)
+    const char* const bytes = __Pyx_PyBytes_AsString(data);
+    #if !CYTHON_ASSUME_SAFE_MACROS
+    if (likely(bytes)); else { Py_DECREF(data); __PYX_ERR(0, 1, __pyx_L1_error) }
+    #endif
+    #else /* compression: none (6216 bytes) */
+static const char bytes[] = " can not be matched by type for , use `resolve_for` with values of arguments.?]annotation container changed size during overload resolutionoverload/bind.pxdoverload/bind.pyxunsupported annotation: unsupported annotation: Type[ABCMetaAnnotatedAnyEllipsisIterableLiteralMappingNoneTypePY_SSIZE_T_MAXPyTuple_TypePyType_TypeTypeVarUnionUnionType__args____bound____constraints____instancecheck____main____module____name____origin____pyx_capi____qualname____supertype____test___emptyabcannotationargcheckcheckedCountcheckedIndexchildrencline_in_tracebackclscollections.abccompileAnnotationcompileClasscompileContainercompileNodecompileSubclasscreateMatcherdestroyMatcherget_argsget_originguardshasTypeBasedInstanceCheckiinspectinstructionisInstanceisTypeBaseditemslayoutBaselhsmatchDistancematchTypematchermatcherCovermatchersDisjointmetaclassmroDistanceobjectopprogramprogramCoverprogramDistancerhsrunCollectionrunMappingrunMatcherrunProgramrunTypeProgramsetdefaultsimplifyUnionsizestarttypetypeDistancetypeProgramDistancetypestypesDisjointtypingPy_ssize_t (struct __pyx_t_8overload_4bind_Matcher const *, PyObject *)\000\000int (PyObject *)\000int (struct __pyx_t_8overload_4bind_Instruction const *, PyObject *)\000int (struct __pyx_t_8overload_4bind_Matcher const *, PyObject *)\000int (struct __pyx_t_8overload_4bind_Matcher const *, struct __pyx_t_8overload_4bind_Matcher const *)\000struct __pyx_t_8overload_4bind_Matcher (PyObject *, int, struct __pyx_t_8overload_4bind_ContainerCheck)\000void (struct __pyx_t_8overload_4bind_Matcher)\000matchDistance\000typeDistance\000hasTypeBasedInstanceCheck\000runProgram\000matchType\000matchersDisjoint\000createMatcher\000destroyMatcher\200\001\340\004\016\210a\210w\220a\330\004\016\210a\210w\220a\200\001\360\006\000\005\020\210v\220Q\330\004\017\210x\220q\330\004\017\210y\230\001\330\004\017\210y\230\014\240A\340\004\r\210Z\220q\230\001\340\004\007\200{\220#\220T\230\023\230K\240s\250!\330\010\024\220A\220V\2309\240A\330\t\020\220\003\2206\230\023""\230G\2403\240a\330\010\023\2206\230\021\330\010\023\2209\230C\230q\240\010\250\001\250\021\330\010\023\2209\230A\330\010\020\220\007\220u\230A\330\010\017\210z\230\021\230!\330\010\014\210G\2208\2301\230A\330\014\033\2301\230E\240\031\250!\330\010\017\210q\220\006\220h\230g\240U\250#\250R\250q\330\t\023\2201\220L\240\001\330\010\017\210z\230\021\230!\340\010\016\210i\220q\320\0307\260q\270\001\200\001\360\006\000\005\020\210x\220q\330\004\017\210y\230\001\330\004\017\210y\230\014\240A\340\004\007\200t\2103\210a\330\010\023\2206\230\021\330\t\r\210Q\210e\2203\220a\330\010\023\2206\230\021\340\010\023\2206\230\021\330\010\013\2104\210q\220\005\220W\230A\330\014\022\220\047\230\021\230$\230a\230q\340\004\013\210:\220Q\220a\200\001\360\006\000\005\023\220+\230Q\340\004\007\200s\210#\210Q\330\010\020\220\t\230\033\240A\330\004\007\200s\210#\210Q\330\010\020\220\004\220A\220Y\230k\250\021\330\004\007\200s\210#\210Q\330\010\020\220\001\330\004\007\200s\210#\210Q\330\010\020\220\001\330\004\007\200s\210#\210^\2303\230c\240\023\240A\330\010\013\2104\210q\220\t\230\033\240H\250C\250q\330\014\024\220I\230[\250\001\330\010\017\210q\330\004\007\200s\210#\210Q\330\010\017\210q\340\004\r\210Q\330\004\014\210L\230\002\230!\330\004\010\210\005\210U\220!\220;\230a\330\010\020\220\014\230A\230Q\330\010\013\2106\220\023\220A\330\014\023\2201\330\010\022\220!\330\010\021\220\025\220a\330\004\013\2101\200\001\360\010\000\005\010\200w\210a\210v\220T\230\023\230A\330\010\t\340\004\014\210F\220\"\220A\330\004\010\210\005\210U\220!\2207\230!\2306\240\021\330\010\013\2107\220!\2206\230\024\230S\240\001\330\014\023\2207\230!\2306\240\022\2401\330\014\023\2201\220F\230&\240\001\330\014\023\2201\220F\230(\240!\330\014\023\2201\220F\230)\2401\330\014\r\330\010\021\220\027\230\001\230\026\230q\200\001\360\010\000\005\010\200w\210f\220C\220q\330\010\020\220\t\230\027\240\001\330\004\007\200w\210f\220C\220q\330\010\017\210|\2301\230G\2408\2505\260\001\330\004\013\2101\200\001\360\010\000\005\035""\230G\2405\250\001\340\004\017\210v\220Q\330\004\017\210x\220q\330\004\017\210y\230\003\2301\230A\330\004\017\210y\230\001\330\004\013\210:\220Q\220a\340\004\010\210\t\220\021\330\010\031\230\021\230\047\240\031\250(\260!\340\004\013\2101\210F\220(\230\047\240\025\240c\250\022\2501\200\001\360\014\000\005\035\230G\2405\250\001\340\004\007\200u\210F\220#\220^\2404\240u\250F\260#\260[\300\004\300E\310\027\320PS\320ST\330\010\024\220A\220U\230)\2401\330\010\t\340\004\017\210q\220\004\220J\230i\240x\250q\330\004\010\210\t\220\025\220a\220v\230R\230s\240\047\250\025\250a\330\010\013\2107\220!\2206\230\024\230S\240\001\330\014\r\340\010\017\210w\220a\220q\330\010\024\220A\220U\230)\2401\330\010\t\340\004\013\2101\210F\220)\230<\240q\330\004\013\2101\210F\220)\2301\330\004\007\200t\2101\210E\220\027\230\005\230T\240\024\240Q\240e\2507\260!\330\010\016\210g\220Q\220d\230!\2301\200\001\360\024\000\005\030\220q\330\004\013\210>\230\034\240Q\330\004\013\2108\2201\330\004\013\210>\230\021\340\004\007\200q\330\010\031\230\021\230,\240g\250Z\260x\270q\330\010\017\210~\230[\250\001\250\027\260\001\360\006\000\t\014\2107\220(\230!\2302\230T\240\023\240A\330\014\023\2208\2301\330\r\024\220H\230A\230R\230t\2403\240a\330\014\023\2208\2301\330\014\023\2208\320\033+\2507\260(\270!\2702\270Q\340\014\023\2208\2301\330\t\024\220C\220w\230c\240\033\250C\250q\330\010\017\210x\220q\330\t\r\210Q\210l\230#\230Q\330\010\017\210x\220q\330\010\017\210x\320\027\047\240q\340\010\017\210x\220q\330\010\013\210:\220Q\220l\240!\330\014\022\220\047\230\021\230$\230a\230q\340\014\023\220>\240\021\340\004\023\2205\230\001\230\021\330\004\013\210:\220\\\240\021\330\004\r\210Q\210a\330\004\r\210Q\210a\330\004\013\2101\200\001\360\026\000\005\035\230G\2405\250\001\340\004\017\210v\220Q\330\004\017\210x\220q\330\004\017\210y\230\001\330\004\017\210y\230\001\340\004\r\210Z\220q\230\001\330\004\013\2108\2201\220A\340\004\007\200{\220#\220W\230C\230{\250#\250T\260\023\260K\270s\300!\330\010\017\210z\230\021\230!""\330\t\024\220C\220u\230C\230{\250#\250Q\330\010\023\2206\230\021\330\010\023\2209\230L\250\001\330\010\017\210z\230\021\230!\330\t\020\220\003\2206\230\023\230G\2403\240a\330\010\023\2201\220J\230f\240I\250X\260Q\330\t\020\220\003\2201\330\010\023\2206\230\021\330\010\023\2209\230C\230q\240\001\330\010\017\210z\230\021\230!\330\010\014\210I\220Q\330\014\027\220v\230Q\330\014\027\220y\240\001\330\014\027\220y\240\014\250A\330\014\023\220:\230Q\230a\330\010\017\210q\220\006\220h\230g\240U\250#\250R\250q\330\t\020\220\003\2201\330\010\027\220q\230\004\230A\230V\240:\250U\260)\2701\330\t\020\220\003\2206\230\024\230T\240\025\240d\250\047\260\021\260,\270l\310&\320PS\320ST\340\010\023\2201\220J\230d\240)\2508\2601\330\t\020\220\003\2206\230\024\230U\240$\240d\250!\2503\250a\250v\260R\260s\270\047\300\021\330\010\023\2201\220J\230h\240e\2504\250z\270\024\270Y\300h\310a\330\t\020\220\003\2201\330\010\031\230\021\230*\240M\260\031\270(\300!\330\t\023\2201\220L\240\001\330\010\013\210:\220[\240\007\240q\330\014\035\230Q\230j\250\014\260I\270X\300Q\330\r\027\220q\330\014\027\220q\230\n\240*\320,>\270i\300x\310q\340\014\023\220:\230Q\230a\330\t\020\220\001\220\034\230Q\340\010\031\230\021\230*\320$4\260I\270X\300Q\330\t\020\220\003\2206\230\024\230S\240\001\240\026\240s\250\"\250D\260\004\260A\260S\270\003\2701\330\010\030\230\001\230\037\250\010\260\004\260B\260d\270)\3008\3101\330\t\023\2201\220H\230F\240$\240j\260\001\260\030\270\031\300$\300c\310\021\310&\320PS\320ST\330\010\030\230\001\230\034\240X\250V\2609\270H\300A\330\t\023\2201\220H\230F\240$\240j\260\001\260\030\270\032\3004\300s\310!\3106\320QT\320TU\330\010\030\230\001\230\037\250\010\260\006\260i\270x\300q\330\t\023\2201\220H\230A\330\010\024\220A\220X\230Y\240a\330\t\023\2201\220L\240\001\330\010\024\220A\220\\\240\031\250!\340\010\016\210i\220q\320\0302\260!\2601\340\004\021\220\021\220)\2301\320\000\025\220Q\360\n\000\005\t\210\005\210U\220!\220=\240\007\240u\250A\330\010\r\210W\220A\220R\220q\330\010\013""\2103\210c\220\033\230C\230s\240#\240\\\260\023\260C\260s\270)\3003\300c\310\023\310N\320Z]\320]`\320`c\320cd\330\014\023\2201\330\004\013\2101\320\000\027\220q\360\n\000\005\010\320\007\033\2301\230E\240\025\240c\320)=\270Q\270e\3001\330\010\017\210q\330\004\007\200u\210C\210z\230\022\320\0330\260\003\2605\270\003\270:\300R\300q\330\010\017\210q\340\004\n\210*\220A\220Q\330\004\n\210*\220A\220Q\330\004\013\2104\320\017#\2401\240E\250\025\250d\260$\3206J\310!\3105\320PQ\320\000\033\2301\360\010\000\005\026\220X\230\\\250\021\250!\360\006\000\005\t\210\005\210U\220!\320\023#\2401\240A\330\010\013\210<\320\027\047\240q\250\005\250S\260\003\2601\330\014\023\2202\220R\220q\330\004\013\320\013\033\2301\230E\240\022\2401\320\000\035\230Q\360\n\000\005\013\210$\210j\230\002\320\032.\250d\260$\260i\270s\300!\330\010\017\210t\2201\330\004\n\210$\210i\220s\230%\230t\2404\240~\260S\270\004\270H\300N\320RS\330\010\014\210M\230\023\230D\240\010\250\001\340\010\017\210t\2201\330\004\013\2101\320\000#\2401\340\004\007\200u\210F\220#\220[\240\003\2405\250\003\2505\260\001\330\010\017\210q\330\004\013\2105\220\001\320\000#\2401\340\004\007\200u\210F\220#\220]\240$\240e\2502\250U\260!\330\010\017\210r\220\022\2205\230\003\230=\250\005\250Q\330\004\013\2101\320\000>\270a\360\n\000\005\025\220I\230Q\330\004\013\210>\230\023\230D\320 3\2603\260n\300C\300w\310a\320\000B\300!\340\004\007\200{\220!\2205\230\003\2301\230A\330\010\017\210{\230!\2305\240\003\320#3\2604\260s\320:N\310a\310{\320Z[\320[a\320aq\320qr\330\004\013\320\013\"\240!\2405\250\001\320\000D\300A\360\010\000\005\010\200w\210f\220C\220q\330\010\017\210q\330\004\007\200w\210f\220C\220q\330\010\017\320\017#\2401\320$4\260F\270\047\300\021\330\004\007\200w\210f\220C\220q\330\010\017\320\017&\240a\240v\250W\260A\340\004\014\210N\230!\2307\240(\250%\250t\2601\330\004\007\200v\210S\220\001\330\010\016\210i\220q\330\014\031\230\021\230)\2407\320*X\320XY\320Yb\320bc\360\006\000\005\014\2106\220\023\220A\320\000K\3101\360\010\000""\002\005\200G\2106\220\023\220A\330\002\t\210\021\330\001\004\200G\2106\220\023\220A\330\002\r\210[\230\001\230\021\330\002\t\210\031\220#\220W\230F\240#\320%9\270\021\270*\300G\3101\330\001\004\200G\2106\220\023\220A\330\002\t\320\t \240\001\240\025\240g\250Q\330\001\010\210\n\220!\2207\230(\240%\240t\2501\320\000K\3101\360\010\000\005\021\220\014\230A\230Q\330\004\020\220\014\230A\230Q\330\004\007\200z\220\023\220E\230\023\230J\240c\250\021\330\010\017\210q\340\004\010\210\014\220A\330\010\014\210L\230\001\330\014\017\210t\220=\240\001\320!1\260\032\320;K\3101\330\020\027\220q\330\004\013\2101\320\000L\310A\360\010\000\005+\250,\260b\270\001\330\004,\250L\270\002\270+\300Q\340\004\n\210)\2201\340\004\007\200t\210<\220q\230\001\330\010\017\210q\340\004\014\210L\230\001\230\021\230+\240X\250S\260\001\260\021\330\004\010\210\005\210Y\220a\220w\230d\240&\250\001\330\010\013\2106\220\023\220A\330\014\r\330\010\013\2104\210z\230\021\230-\240|\2605\270\003\2704\270z\310\021\310/\320Ye\320ef\330\014\023\2201\330\010\021\220\021\340\004\013\2101\320\000L\310A\360\n\000\005\023\220+\230Q\340\004\007\200s\210#\210Q\330\010\017\210q\330\004\007\200s\210#\210Q\330\010\023\220;\230a\230q\330\010\017\210y\230\003\320\033+\250;\260g\270S\320@T\320TU\330\014\026\320\026&\240k\260\021\340\004\007\200s\210#\210Q\330\010\017\320\017&\240a\240u\250K\260q\330\004\007\200s\210#\210Q\330\010\017\210{\230!\2305\240\003\240;\250a\250{\270(\300$\320F^\320^_\330\014\025\220U\230)\240;\250h\260a\340\004\007\200s\210#\210Q\330\010\017\210|\2301\230I\240U\250$\320.E\300Q\300e\310;\320VW\340\004\007\200s\210#\210Q\330\010\017\210z\230\021\230%\230{\250(\260$\260m\3001\300M\320QR\330\004\007\200s\210#\210Q\330\010\017\210z\230\021\230%\230{\250(\260$\260j\300\001\300\035\310a\340\004\014\210L\230\002\230!\330\004\007\200s\210#\210Q\330\010\014\210E\220\025\220a\220{\240!\330\014\017\210z\230\021\230\047\240\021\330\020\027\220q\330\014\025\220U\230!\330\010\017\210q\360\006\000\005\010\200t\210=""\230\001\230\031\240%\240s\320*:\270!\2709\300E\310\023\310K\320WX\330\010\017\210q\330\004\010\210\005\210U\220!\220;\230a\330\010\013\2104\210z\230\021\230\047\240\034\320-=\270Q\270i\300u\310A\330\014\023\2201\330\010\021\220\025\220a\330\004\013\2101\320\000M\310Q\360\010\000\005\010\200w\210f\220C\220q\330\010\017\210q\330\004\007\200w\210f\220C\220{\240#\240W\250F\260#\260Q\330\010\017\210{\230!\320\033+\2506\260\027\270\001\330\004\013\320\013\036\230a\230w\240h\250e\2604\260q\320\000M\310Q\360\n\000\005\010\200w\210f\220C\220q\330\010\017\210q\330\004\007\200w\210f\220C\220{\240#\240W\250F\260#\260Q\330\010\017\210{\230!\230;\240a\240v\250W\260A\330\004\013\210?\230!\2307\240(\250%\250t\2601\320\000O\310q\360\010\000\005%\240L\260\002\260!\330\004\047\240q\250\013\2601\340\004#\2401\360\n\000\005\013\210)\2201\340\004\007\200|\2201\220E\230\023\230M\250\021\250!\330\010\017\210s\220!\2201\330\010\020\220\014\230A\230W\240A\340\010\013\2105\220\004\220C\220q\340\014\024\320\024)\250\021\250!\330\014\020\220\005\220U\230!\2301\330\020\034\230K\240q\250\005\250Q\250l\270!\2707\300&\310\001\330\020\023\220:\230S\240\n\250#\250Z\260s\320:J\310%\310q\330\024\025\330\020\023\2204\320\027+\2501\250K\3207G\300u\310A\330\024\033\2301\330\020\034\230A\330\014\023\2201\340\010\014\210E\220\025\220a\220q\330\014\017\210u\220C\220s\230!\2301\330\020\026\220l\240!\2401\330\014\023\2203\220a\220|\2401\240G\2506\260\021\330\014\017\210t\220:\230Q\230g\240\\\260\021\330\020\027\220q\330\010\017\210q\340\004\007\200~\220Q\220a\330\010\020\220\014\230A\230W\240C\240q\250\001\330\010\014\210H\220A\330\014\017\210v\220S\230\001\330\020\021\330\014\017\210t\220:\230Q\230g\240\\\260\021\330\020\027\220q\330\014\025\220Q\340\004\013\2101\320\000P\320PQ\360\n\000\005\023\220+\230Q\360\010\000\005\010\200s\210#\210Q\330\010\017\210q\330\004\007\200s\210#\210Q\330\010\013\320\013\037\230q\320 0\260\006\3206F\300k\320QR\330\014\023\2201\330\010\017\210q\330\004\007\200s\210#\210Q\330""\010\017\210~\320\0354\260A\260V\270;\300m\320ST\330\004\007\200s\210#\210Q\330\010\017\320\017(\320(8\270\005\270S\300\013\3101\310K\320Wd\320de\330\004\007\200s\210#\210Q\330\010\017\320\017(\320(<\270A\320=M\310V\320ST\320Tf\320fg\330\004\007\200s\210#\210Q\330\010\017\320\017(\320(<\270A\320=M\310V\320ST\320Tg\320gh\340\004\014\210L\230\002\230!\330\004\007\200s\210#\210^\2303\230c\240\023\240A\330\010\013\2104\320\017&\240a\240v\250[\270\001\330\014\023\2201\330\010\014\210E\220\025\220a\220{\240!\330\014\017\210u\220D\230\003\2301\330\020\027\220q\330\014\025\220U\230!\330\010\017\210q\360\006\000\005\016\210Q\330\004\010\210\005\210U\220!\220;\230a\330\010\020\220\016\230a\230w\240a\330\010\013\2106\220\023\220A\330\014\023\2201\330\010\013\2106\220\023\220A\330\014\025\220Q\330\010\021\220\025\220a\330\004\013\2101\320\000W\320WX\360\016\000\005\023\220+\230Q\340\004\007\200s\210#\210Q\330\010\017\210q\330\004\007\200s\210#\210Q\330\010\017\210q\330\004\007\200s\210#\210Q\330\010\017\210{\230!\320\033+\2505\260\013\2701\330\004\007\200s\210#\210Q\330\010\017\210{\230!\230;\240a\240v\250\\\270\021\330\004\007\200s\210#\210Q\330\010\017\210{\230!\230;\240a\240v\250[\270\001\340\004\017\210q\330\004\014\210L\230\002\230!\330\004\010\210\005\210U\220!\220;\230a\330\010\013\210:\220Q\220g\230Q\330\014\032\230!\230:\240_\260A\260W\270A\330\010\021\220\025\220a\330\004\013\2101\320\000\\\320\\]\360\n\000\005 \230q\340\004\007\200{\220$\220c\230\021\330\010\017\210q\330\004\007\200{\220$\220c\230\021\330\010\017\210{\230!\320\033+\2506\260\033\270A\340\004\014\210L\230\002\230!\330\004\010\210\005\210U\220!\220;\230a\330\010\013\210>\230\021\230\047\240\026\240s\250!\330\014\032\230!\230:\320%8\270\001\270\027\300\001\330\010\021\220\025\220a\330\004\013\2101";
+    PyObject *data = NULL;
+    #define __Pyx_DecompressString_UNUSED
+    #define __Pyx_DecompressString_LZSS_UNUSED
+    #endif
+    PyObject **stringtab = __pyx_mstate->__pyx_string_tab;
+    Py_ssize_t pos = 0;
+    for (int i = 0; i < 95; i++) {
+      Py_ssize_t bytes_length = str_length_index[i].length;
+      PyObject *string = PyUnicode_DecodeUTF8(bytes + pos, bytes_length, NULL);
+      if (likely(string) && i >= 11) PyUnicode_InternInPlace(&string);
+      if (unlikely(!string)) {
+        Py_XDECREF(data);
+        __PYX_ERR(0, 1, __pyx_L1_error)
+      }
+      stringtab[i] = string;
+      pos += bytes_length;
+    }
+    for (int i = 95; i < 125; i++) {
+      Py_ssize_t bytes_length = bytes_length_index[i-95].length;
+      PyObject *string = PyBytes_FromStringAndSize(bytes + pos, bytes_length);
+      stringtab[i] = string;
+      pos += bytes_length;
+      if (unlikely(!string)) {
+        Py_XDECREF(data);
+        __PYX_ERR(0, 1, __pyx_L1_error)
+      }
+    }
+    Py_XDECREF(data);
+    for (Py_ssize_t i = 0; i < 125; i++) {
+      if (unlikely(PyObject_Hash(stringtab[i]) == -1)) {
+        __PYX_ERR(0, 1, __pyx_L1_error)
+      }
+    }
+    #if CYTHON_IMMORTAL_CONSTANTS
+    {
+      PyObject **table = stringtab + 95;
+      for (Py_ssize_t i=0; i<30; ++i) {
+        #if PY_VERSION_HEX >= 0x030F0000
+        PyUnstable_SetImmortal(table[i]);
+        #elif CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+        if ((PY_SSIZE_T_MAX <= _Py_IMMORTAL_REFCNT_LOCAL)) break;
+        #if PY_VERSION_HEX < 0x030E0000
+        if (_Py_IsOwnedByCurrentThread(table[i]) && Py_REFCNT(table[i]) == 1)
+        #else
+        if (PyUnstable_Object_IsUniquelyReferenced(table[i]))
+        #endif
+        {
+          Py_SET_REFCNT(table[i], ((Py_ssize_t)_Py_IMMORTAL_REFCNT_LOCAL + 1));
+        }
+        #else
+        if ((PY_SSIZE_T_MAX < _Py_IMMORTAL_INITIAL_REFCNT)) break;
+        Py_SET_REFCNT(table[i], _Py_IMMORTAL_INITIAL_REFCNT);
+        #endif
+      }
+    }
+    #endif
+  }
+  {
+    PyObject **numbertab = __pyx_mstate->__pyx_number_tab + 0;
+    int8_t const cint_constants_1[] = {1};
+    for (int i = 0; i < 1; i++) {
+      numbertab[i] = PyLong_FromLong(cint_constants_1[i - 0]);
+      if (unlikely(!numbertab[i])) __PYX_ERR(0, 1, __pyx_L1_error)
+    }
+  }
+  #if CYTHON_IMMORTAL_CONSTANTS
+  {
+    PyObject **table = __pyx_mstate->__pyx_number_tab;
+    for (Py_ssize_t i=0; i<1; ++i) {
+      #if PY_VERSION_HEX >= 0x030F0000
+      PyUnstable_SetImmortal(table[i]);
+      #elif CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+      if ((PY_SSIZE_T_MAX <= _Py_IMMORTAL_REFCNT_LOCAL)) break;
+      #if PY_VERSION_HEX < 0x030E0000
+      if (_Py_IsOwnedByCurrentThread(table[i]) && Py_REFCNT(table[i]) == 1)
+      #else
+      if (PyUnstable_Object_IsUniquelyReferenced(table[i]))
+      #endif
+      {
+        Py_SET_REFCNT(table[i], ((Py_ssize_t)_Py_IMMORTAL_REFCNT_LOCAL + 1));
+      }
+      #else
+      if ((PY_SSIZE_T_MAX < _Py_IMMORTAL_INITIAL_REFCNT)) break;
+      Py_SET_REFCNT(table[i], _Py_IMMORTAL_INITIAL_REFCNT);
+      #endif
+    }
+  }
+  #endif
+  return 0;
+  __pyx_L1_error:;
+  return -1;
+}
+/* #### Code section: init_codeobjects ### */
+#ifdef __cplusplus
+namespace {
+#endif
+typedef struct {
+    unsigned int argcount : 3;
+    unsigned int num_posonly_args : 1;
+    unsigned int num_kwonly_args : 1;
+    unsigned int nlocals : 4;
+    unsigned int flags : 10;
+    unsigned int first_line : 10;
+} __Pyx_PyCode_New_function_description;
+#ifdef __cplusplus
+} /* anonymous namespace */
+#endif
+/* NewCodeObj.proto */
+static PyObject* __Pyx_PyCode_New(
+        const __Pyx_PyCode_New_function_description descr,
+        PyObject * const *varnames,
+        PyObject *filename,
+        PyObject *funcname,
+        PyObject *line_table,
+        PyObject *tuple_dedup_map
+);
+
+
+static int __Pyx_CreateCodeObjects(__pyx_mstatetype *__pyx_mstate) {
+  PyObject* tuple_dedup_map = PyDict_New();
+  if (unlikely(!tuple_dedup_map)) return -1;
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 3, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 75};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX};
+    __pyx_mstate_global->__pyx_codeobj_tab[0] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pxd, __pyx_mstate->__pyx_n_u_runMatcher, __pyx_mstate->__pyx_kp_b_iso88591_K1_G6_A_G6_A_WF_9_G1_G6_A_gQ_7, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[0])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {3, 0, 0, 6, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 42};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_annotation_2, __pyx_mstate->__pyx_n_u_typing, __pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[1] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_createMatcher, __pyx_mstate->__pyx_kp_b_iso88591_q_Q_81_q_gZxq_7_2T_A_81_HARt3a, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[1])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 88};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[2] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_destroyMatcher, __pyx_mstate->__pyx_kp_b_iso88591_awa_awa, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[2])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 94};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_metaclass, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[3] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_hasTypeBasedInstanceCheck, __pyx_mstate->__pyx_kp_b_iso88591_a_IQ_D_33nCwa, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[3])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {4, 0, 0, 7, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 103};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_annotation_2, __pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_guards, __pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[4] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_compileAnnotation, __pyx_mstate->__pyx_kp_b_iso88591_G5_vQ_xq_y_y_Zq_81A_WC_T_Ks_z_C, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[4])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {5, 0, 0, 8, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 177};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_op, __pyx_mstate->__pyx_n_u_children, __pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_guards, __pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[5] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_compileNode, __pyx_mstate->__pyx_kp_b_iso88591_G5_vQ_xq_y_1A_y_Qa_1F_c_1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[5])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {6, 0, 0, 9, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 195};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_op, __pyx_mstate->__pyx_n_u_cls, __pyx_mstate->__pyx_n_u_children, __pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_guards, __pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[6] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_compileContainer, __pyx_mstate->__pyx_kp_b_iso88591_G5_uF_4uF_E_PSST_AU_1_q_Jixq_av, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[6])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {3, 0, 0, 6, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 222};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_cls, __pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_guards, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[7] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_compileClass, __pyx_mstate->__pyx_kp_b_iso88591_xq_y_y_A_t3a_6_Qe3a_6_6_4q_WA_a, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[7])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {3, 0, 0, 6, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 241};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_annotation_2, __pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_guards, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[8] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_compileSubclass, __pyx_mstate->__pyx_kp_b_iso88591_vQ_xq_y_y_A_Zq_T_Ks_AV9A_6_G3a, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[8])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 268};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_start, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[9] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_simplifyUnion, __pyx_mstate->__pyx_kp_b_iso88591_wavT_A_F_A_U_7_6_7_6_S_7_6_1_1F, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[9])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 286};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_program, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[10] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_isTypeBased, __pyx_mstate->__pyx_kp_b_iso88591_Q_U_uA_WARq_3c_Cs_Cs_3c_NZ_ccd, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[10])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 298};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[11] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_runProgram, __pyx_mstate->__pyx_kp_b_iso88591_LA_Q_s_Q_q_s_Q_aq_y_gS_TTU_k_s, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[11])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 344};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_cls, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[12] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_isInstance, __pyx_mstate->__pyx_kp_b_iso88591_B_5_1A_5_34s_Na_Z_aaqqr_5, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[12])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 351};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_size, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[13] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_checkedCount, __pyx_mstate->__pyx_kp_b_iso88591_1_uF_5_5_q_5, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[13])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {3, 0, 0, 6, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 358};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_check, __pyx_mstate->__pyx_n_u_size, __pyx_mstate->__pyx_n_u_i, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[14] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_checkedIndex, __pyx_mstate->__pyx_kp_b_iso88591_1_uF_e2U_r_5_Q_1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[14])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 365};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[15] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_runCollection, __pyx_mstate->__pyx_kp_b_iso88591_Oq_L_q_1_1_1_1E_M_s_1_AWA_5_Cq, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[15])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 415};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[16] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_runMapping, __pyx_mstate->__pyx_kp_b_iso88591_LA_b_L_Q_1_t_q_q_L_XS_Yawd_6_A, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[16])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 438};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[17] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_matchDistance, __pyx_mstate->__pyx_kp_b_iso88591_MQ_wfCq_q_wfC_WF_Q_avWA_7_t1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[17])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 450};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_arg, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[18] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_programDistance, __pyx_mstate->__pyx_kp_b_iso88591_WWX_Q_s_Q_q_s_Q_q_s_Q_5_1_s_Q_a, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[18])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 485};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[19] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_matchType, __pyx_mstate->__pyx_kp_b_iso88591_DA_wfCq_q_wfCq_1_4F_wfCq_avWA_N, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[19])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 505};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[20] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_runTypeProgram, __pyx_mstate->__pyx_kp_b_iso88591_PPQ_Q_s_Q_q_s_Q_q_0_6FkQR_1_q_s, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[20])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 551};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[21] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_typeDistance, __pyx_mstate->__pyx_kp_b_iso88591_MQ_wfCq_q_wfC_WF_Q_6_awhe4q, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[21])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 562};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[22] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_typeProgramDistance, __pyx_mstate->__pyx_kp_b_iso88591_q_c_q_c_6_A_L_U_a_s_8_a_1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[22])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 582};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_cls, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[23] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_mroDistance, __pyx_mstate->__pyx_kp_b_iso88591_1_X_U_1A_q_S_1_2Rq_1E_1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[23])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 595};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_lhs, __pyx_mstate->__pyx_n_u_rhs, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[24] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_matchersDisjoint, __pyx_mstate->__pyx_kp_b_iso88591_K1_AQ_AQ_z_E_Jc_q_A_L_t_1_K1_q, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[24])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 611};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_matcher, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[25] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_matcherCover, __pyx_mstate->__pyx_kp_b_iso88591_wfCq_wfCq_1G85_1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[25])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 622};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_instruction, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[26] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_programCover, __pyx_mstate->__pyx_kp_b_iso88591_Q_s_Q_A_s_Q_AYk_s_Q_s_Q_s_3c_A, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[26])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {2, 0, 0, 5, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 653};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_lhs, __pyx_mstate->__pyx_n_u_rhs, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[27] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_typesDisjoint, __pyx_mstate->__pyx_kp_b_iso88591_q_1E_c_Qe1_q_uCz_0_5_Rq_q_AQ_AQ, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[27])) goto bad;
+  }
+  {
+    const __Pyx_PyCode_New_function_description descr = {1, 0, 0, 4, (unsigned int)(CO_OPTIMIZED|CO_NEWLOCALS), 668};
+    PyObject* const varnames[] = {__pyx_mstate->__pyx_n_u_type, __pyx_mstate->__pyx_n_u_PY_SSIZE_T_MAX, __pyx_mstate->__pyx_n_u_PyType_Type, __pyx_mstate->__pyx_n_u_PyTuple_Type};
+    __pyx_mstate_global->__pyx_codeobj_tab[28] = __Pyx_PyCode_New(descr, varnames, __pyx_mstate->__pyx_kp_u_overload_bind_pyx, __pyx_mstate->__pyx_n_u_layoutBase, __pyx_mstate->__pyx_kp_b_iso88591_Q_j_d_is_t1_is_t4_S_HNRS_M_D_t1, tuple_dedup_map); if (unlikely(!__pyx_mstate_global->__pyx_codeobj_tab[28])) goto bad;
+  }
+  Py_DECREF(tuple_dedup_map);
+  return 0;
+  bad:
+  Py_DECREF(tuple_dedup_map);
+  return -1;
+}
+/* #### Code section: init_globals ### */
+
+static int __Pyx_InitGlobals(void) {
+  int __pyx_lineno = 0;
+  const char *__pyx_filename = NULL;
+  int __pyx_clineno = 0;
+  /* PythonCompatibility.init */
+  if (likely(__Pyx_init_co_variables() == 0 && __Pyx_init_tpflags_variables() == 0)); else
+  
+  if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 1, __pyx_L1_error)
+
+  /* PyFrozenDict.init */
+  #if CYTHON_COMPILING_IN_LIMITED_API
+  {
+      PyObject *builtins = PyEval_GetBuiltins(); // borrowed
+      if (likely(builtins)) {
+          PyObject *type_name = PyUnicode_FromStringAndSize("frozendict", sizeof("frozendict")-1);
+          if (likely(type_name)) {
+              PyObject *frozendict_type = PyObject_GetItem(builtins, type_name);
+              Py_DECREF(type_name);
+              if (!frozendict_type && PyErr_ExceptionMatches(PyExc_KeyError)) {
+                  PyErr_Clear();
+                  frozendict_type = (PyObject*) &PyDict_Type;
+                  Py_INCREF(frozendict_type);
+              }
+              __pyx_mstate_global->__Pyx_PyFrozenDictType = frozendict_type;
+          }
+      }
+  } // error handling follows
+  #endif
+  
+  if (unlikely(PyErr_Occurred())) __PYX_ERR(0, 1, __pyx_L1_error)
+
+  return 0;
+  __pyx_L1_error:;
+  return -1;
+}
+/* #### Code section: init_after_shared_utility ### */
+
+static int __Pyx_InitAfterSharedUtility(void) {
+  return 0;
+}
+/* #### Code section: cleanup_globals ### */
+/* #### Code section: cleanup_module ### */
+/* #### Code section: main_method ### */
+/* #### Code section: utility_code_pragmas ### */
+#ifdef _MSC_VER
+#pragma warning( push )
+/* Warning 4127: conditional expression is constant
+ * Cython uses constant conditional expressions to allow in inline functions to be optimized at
+ * compile-time, so this warning is not useful
+ */
+#pragma warning( disable : 4127 )
+#endif
+
+
+
+/* #### Code section: utility_code_def ### */
+
+/* --- Runtime support code --- */
+/* Refnanny */
+#if CYTHON_REFNANNY
+static __Pyx_RefNannyAPIStruct *__Pyx_RefNannyImportAPI(const char *modname) {
+    PyObject *m = NULL, *p = NULL;
+    void *r = NULL;
+    m = PyImport_ImportModule(modname);
+    if (!m) goto end;
+    p = PyObject_GetAttrString(m, "RefNannyAPI");
+    if (!p) goto end;
+    r = PyLong_AsVoidPtr(p);
+end:
+    Py_XDECREF(p);
+    Py_XDECREF(m);
+    return (__Pyx_RefNannyAPIStruct *)r;
+}
+#endif
+
+/* FastTypeChecks (used by GivenExceptionMatches) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static int __Pyx_InBases(PyTypeObject *a, PyTypeObject *b) {
+    while (a) {
+        a = __Pyx_PyType_GetSlot(a, tp_base, PyTypeObject*);
+        if (a == b)
+            return 1;
+    }
+    return b == &PyBaseObject_Type;
+}
+static CYTHON_INLINE int __Pyx_IsSubtype(PyTypeObject *a, PyTypeObject *b) {
+    PyObject *mro;
+    if (a == b) return 1;
+    mro = a->tp_mro;
+    if (likely(mro)) {
+        Py_ssize_t i, n;
+        n = PyTuple_GET_SIZE(mro);
+        for (i = 0; i < n; i++) {
+            if (PyTuple_GET_ITEM(mro, i) == (PyObject *)b)
+                return 1;
+        }
+        return 0;
+    }
+    return __Pyx_InBases(a, b);
+}
+static CYTHON_INLINE int __Pyx_IsAnySubtype2(PyTypeObject *cls, PyTypeObject *a, PyTypeObject *b) {
+    PyObject *mro;
+    if (cls == a || cls == b) return 1;
+    mro = cls->tp_mro;
+    if (likely(mro)) {
+        Py_ssize_t i, n;
+        n = PyTuple_GET_SIZE(mro);
+        for (i = 0; i < n; i++) {
+            PyObject *base = PyTuple_GET_ITEM(mro, i);
+            if (base == (PyObject *)a || base == (PyObject *)b)
+                return 1;
+        }
+        return 0;
+    }
+    return __Pyx_InBases(cls, a) || __Pyx_InBases(cls, b);
+}
+#endif
+
+/* PyErrFetchRestore (used by GivenExceptionMatches) */
+#if CYTHON_FAST_THREAD_STATE
+static CYTHON_INLINE void __Pyx_ErrRestoreInState(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb) {
+#if PY_VERSION_HEX >= 0x030C00A6
+    PyObject *tmp_value;
+    assert(type == NULL || (value != NULL && type == (PyObject*) Py_TYPE(value)));
+    if (value) {
+        #if CYTHON_COMPILING_IN_CPYTHON
+        if (unlikely(((PyBaseExceptionObject*) value)->traceback != tb))
+        #endif
+            PyException_SetTraceback(value, tb);
+    }
+    tmp_value = tstate->current_exception;
+    tstate->current_exception = value;
+    Py_XDECREF(tmp_value);
+    Py_XDECREF(type);
+    Py_XDECREF(tb);
+#else
+    PyObject *tmp_type, *tmp_value, *tmp_tb;
+    tmp_type = tstate->curexc_type;
+    tmp_value = tstate->curexc_value;
+    tmp_tb = tstate->curexc_traceback;
+    tstate->curexc_type = type;
+    tstate->curexc_value = value;
+    tstate->curexc_traceback = tb;
+    Py_XDECREF(tmp_type);
+    Py_XDECREF(tmp_value);
+    Py_XDECREF(tmp_tb);
+#endif
+}
+static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
+#if PY_VERSION_HEX >= 0x030C00A6
+    PyObject* exc_value;
+    exc_value = tstate->current_exception;
+    tstate->current_exception = 0;
+    *value = exc_value;
+    *type = NULL;
+    *tb = NULL;
+    if (exc_value) {
+        *type = (PyObject*) Py_TYPE(exc_value);
+        Py_INCREF(*type);
+        #if CYTHON_COMPILING_IN_CPYTHON
+        *tb = ((PyBaseExceptionObject*) exc_value)->traceback;
+        Py_XINCREF(*tb);
+        #else
+        *tb = PyException_GetTraceback(exc_value);
+        #endif
+    }
+#else
+    *type = tstate->curexc_type;
+    *value = tstate->curexc_value;
+    *tb = tstate->curexc_traceback;
+    tstate->curexc_type = 0;
+    tstate->curexc_value = 0;
+    tstate->curexc_traceback = 0;
+#endif
+}
+#endif
+
+/* GivenExceptionMatches (used by PyErrExceptionMatches) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE int __Pyx_inner_PyErr_GivenExceptionMatches2(PyObject *err, PyObject* exc_type1, PyObject *exc_type2) {
+    if (exc_type1) {
+        return __Pyx_IsAnySubtype2((PyTypeObject*)err, (PyTypeObject*)exc_type1, (PyTypeObject*)exc_type2);
+    } else {
+        return __Pyx_IsSubtype((PyTypeObject*)err, (PyTypeObject*)exc_type2);
+    }
+}
+static int __Pyx_PyErr_GivenExceptionMatchesTuple(PyObject *exc_type, PyObject *tuple) {
+    Py_ssize_t i, n;
+    assert(PyExceptionClass_Check(exc_type));
+    n = PyTuple_GET_SIZE(tuple);
+    for (i=0; i<n; i++) {
+        if (exc_type == PyTuple_GET_ITEM(tuple, i)) return 1;
+    }
+    for (i=0; i<n; i++) {
+        PyObject *t = PyTuple_GET_ITEM(tuple, i);
+        if (likely(PyExceptionClass_Check(t))) {
+            if (__Pyx_inner_PyErr_GivenExceptionMatches2(exc_type, NULL, t)) return 1;
+        } else {
+        }
+    }
+    return 0;
+}
+static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches(PyObject *err, PyObject* exc_type) {
+    if (likely(err == exc_type)) return 1;
+    if (likely(PyExceptionClass_Check(err))) {
+        if (likely(PyExceptionClass_Check(exc_type))) {
+            return __Pyx_inner_PyErr_GivenExceptionMatches2(err, NULL, exc_type);
+        } else if (likely(PyTuple_Check(exc_type))) {
+            return __Pyx_PyErr_GivenExceptionMatchesTuple(err, exc_type);
+        } else {
+        }
+    }
+    return PyErr_GivenExceptionMatches(err, exc_type);
+}
+static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches2(PyObject *err, PyObject *exc_type1, PyObject *exc_type2) {
+    assert(PyExceptionClass_Check(exc_type1));
+    assert(PyExceptionClass_Check(exc_type2));
+    if (likely(err == exc_type1 || err == exc_type2)) return 1;
+    if (likely(PyExceptionClass_Check(err))) {
+        return __Pyx_inner_PyErr_GivenExceptionMatches2(err, exc_type1, exc_type2);
+    }
+    return (PyErr_GivenExceptionMatches(err, exc_type1) || PyErr_GivenExceptionMatches(err, exc_type2));
+}
+#endif
+
+/* PyErrExceptionMatches (used by PyObjectGetAttrStrNoError) */
+#if CYTHON_FAST_THREAD_STATE
+static int __Pyx_PyErr_ExceptionMatchesTuple(PyObject *exc_type, PyObject *tuple) {
+    Py_ssize_t i, n;
+    n = PyTuple_GET_SIZE(tuple);
+    for (i=0; i<n; i++) {
+        if (exc_type == PyTuple_GET_ITEM(tuple, i)) return 1;
+    }
+    for (i=0; i<n; i++) {
+        if (__Pyx_PyErr_GivenExceptionMatches(exc_type, PyTuple_GET_ITEM(tuple, i))) return 1;
+    }
+    return 0;
+}
+static CYTHON_INLINE int __Pyx_PyErr_ExceptionMatchesInState(PyThreadState* tstate, PyObject* err) {
+    int result;
+    PyObject *exc_type;
+#if PY_VERSION_HEX >= 0x030C00A6
+    PyObject *current_exception = tstate->current_exception;
+    if (unlikely(!current_exception)) return 0;
+    exc_type = (PyObject*) Py_TYPE(current_exception);
+    if (exc_type == err) return 1;
+#else
+    exc_type = tstate->curexc_type;
+    if (exc_type == err) return 1;
+    if (unlikely(!exc_type)) return 0;
+#endif
+    #if CYTHON_AVOID_BORROWED_REFS
+    Py_INCREF(exc_type);
+    #endif
+    if (unlikely(PyTuple_Check(err))) {
+        result = __Pyx_PyErr_ExceptionMatchesTuple(exc_type, err);
     } else {
-        num_expected = num_max;
-        more_or_less = "at most";
+        result = __Pyx_PyErr_GivenExceptionMatches(exc_type, err);
+    }
+    #if CYTHON_AVOID_BORROWED_REFS
+    Py_DECREF(exc_type);
+    #endif
+    return result;
+}
+#endif
+
+/* PyObjectGetAttrStr (used by PyObjectGetAttrStrNoError) */
+#if CYTHON_USE_TYPE_SLOTS
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStr(PyObject* obj, PyObject* attr_name) {
+    PyTypeObject* tp = Py_TYPE(obj);
+    if (likely(tp->tp_getattro))
+        return tp->tp_getattro(obj, attr_name);
+    return PyObject_GetAttr(obj, attr_name);
+}
+#endif
+
+/* PyObjectGetAttrStrNoError (used by GetBuiltinName) */
+#if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+static void __Pyx_PyObject_GetAttrStr_ClearAttributeError(void) {
+    __Pyx_PyThreadState_declare
+    __Pyx_PyThreadState_assign
+    if (likely(__Pyx_PyErr_ExceptionMatches(PyExc_AttributeError)))
+        __Pyx_PyErr_Clear();
+}
+#endif
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetAttrStrNoError(PyObject* obj, PyObject* attr_name) {
+    PyObject *result;
+#if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+    (void) PyObject_GetOptionalAttr(obj, attr_name, &result);
+    return result;
+#else
+#if CYTHON_COMPILING_IN_CPYTHON && CYTHON_USE_TYPE_SLOTS
+    PyTypeObject* tp = Py_TYPE(obj);
+    if (likely(tp->tp_getattro == PyObject_GenericGetAttr)) {
+        return _PyObject_GenericGetAttrWithDict(obj, attr_name, NULL, 1);
     }
-    if (exact) {
-        more_or_less = "exactly";
+#endif
+    result = __Pyx_PyObject_GetAttrStr(obj, attr_name);
+    if (unlikely(!result)) {
+        __Pyx_PyObject_GetAttrStr_ClearAttributeError();
     }
-    PyErr_Format(PyExc_TypeError,
-                 "%.200s() takes %.8s %" CYTHON_FORMAT_SSIZE_T "d positional argument%.1s (%" CYTHON_FORMAT_SSIZE_T "d given)",
-                 func_name, more_or_less, num_expected,
-                 (num_expected == 1) ? "" : "s", num_found);
+    return result;
+#endif
 }
 
-/* RaiseDoubleKeywords */
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AsString(kw_name));
-        #endif
+/* GetBuiltinName */
+static PyObject *__Pyx_GetBuiltinName(PyObject *name) {
+    PyObject* result = __Pyx_PyObject_GetAttrStrNoError(__pyx_mstate_global->__pyx_b, name);
+    if (unlikely(!result) && !PyErr_Occurred()) {
+        PyErr_Format(PyExc_NameError,
+            "name '%U' is not defined", name);
+    }
+    return result;
 }
 
-/* ParseKeywords */
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-            continue;
-        }
-        name = first_kw_arg;
-        #if PY_MAJOR_VERSION < 3
-        if (likely(PyString_Check(key))) {
-            while (*name) {
-                if ((CYTHON_COMPILING_IN_PYPY || PyString_GET_SIZE(**name) == PyString_GET_SIZE(key))
-                        && _PyString_Eq(**name, key)) {
-                    values[name-argnames] = value;
-                    break;
-                }
-                name++;
-            }
-            if (*name) continue;
-            else {
-                PyObject*** argname = argnames;
-                while (argname != first_kw_arg) {
-                    if ((**argname == key) || (
-                            (CYTHON_COMPILING_IN_PYPY || PyString_GET_SIZE(**argname) == PyString_GET_SIZE(key))
-                             && _PyString_Eq(**argname, key))) {
-                        goto arg_passed_twice;
-                    }
-                    argname++;
-                }
-            }
-        } else
-        #endif
-        if (likely(PyUnicode_Check(key))) {
-            while (*name) {
-                int cmp = (**name == key) ? 0 :
-                #if !CYTHON_COMPILING_IN_PYPY && PY_MAJOR_VERSION >= 3
-                    (__Pyx_PyUnicode_GET_LENGTH(**name) != __Pyx_PyUnicode_GET_LENGTH(key)) ? 1 :
-                #endif
-                    PyUnicode_Compare(**name, key);
-                if (cmp < 0 && unlikely(PyErr_Occurred())) goto bad;
-                if (cmp == 0) {
-                    values[name-argnames] = value;
-                    break;
-                }
-                name++;
-            }
-            if (*name) continue;
-            else {
-                PyObject*** argname = argnames;
-                while (argname != first_kw_arg) {
-                    int cmp = (**argname == key) ? 0 :
-                    #if !CYTHON_COMPILING_IN_PYPY && PY_MAJOR_VERSION >= 3
-                        (__Pyx_PyUnicode_GET_LENGTH(**argname) != __Pyx_PyUnicode_GET_LENGTH(key)) ? 1 :
-                    #endif
-                        PyUnicode_Compare(**argname, key);
-                    if (cmp < 0 && unlikely(PyErr_Occurred())) goto bad;
-                    if (cmp == 0) goto arg_passed_twice;
-                    argname++;
-                }
-            }
-        } else
-            goto invalid_keyword_type;
-        if (kwds2) {
-            if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-        } else {
-            goto invalid_keyword;
-        }
+/* Profile */
+#if CYTHON_PROFILE || CYTHON_TRACE
+#if CYTHON_TRACE && !CYTHON_USE_SYS_MONITORING
+static int __Pyx_call_line_trace_func(PyThreadState *tstate, PyFrameObject *frame, int line) {
+    int ret;
+    PyObject *type, *value, *traceback;
+    __Pyx_ErrFetchInState(tstate, &type, &value, &traceback);
+    __Pyx_PyFrame_SetLineNumber(frame, line);
+    __Pyx_EnterTracing(tstate);
+    ret = tstate->c_tracefunc(tstate->c_traceobj, frame, PyTrace_LINE, NULL);
+    __Pyx_LeaveTracing(tstate);
+    if (likely(!ret)) {
+        __Pyx_ErrRestoreInState(tstate, type, value, traceback);
+    } else {
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
     }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, key);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%.200s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%.200s() got an unexpected keyword argument '%.200s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
+    return ret;
 }
-
-/* PyErrFetchRestore */
-#if CYTHON_FAST_THREAD_STATE
-static CYTHON_INLINE void __Pyx_ErrRestoreInState(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
+#endif
+CYTHON_UNUSED static PyCodeObject *__Pyx_createFrameCodeObject(const char *funcname, const char *srcfile, int firstlineno) {
+    PyCodeObject *py_code = PyCode_NewEmpty(srcfile, funcname, firstlineno);
+    if (likely(py_code)) {
+        py_code->co_flags |= CO_OPTIMIZED | CO_NEWLOCALS;
+    }
+    return py_code;
 }
-static CYTHON_INLINE void __Pyx_ErrFetchInState(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
+#if CYTHON_USE_SYS_MONITORING
+CYTHON_UNUSED static int __Pyx__TraceStartFunc(PyMonitoringState *state_array, PyObject *code_obj, int offset, int skip_event) {
+    int ret;
+    __pyx_monitoring_version_type version = 0;
+    ret = PyMonitoring_EnterScope(state_array, &version, __Pyx_MonitoringEventTypes, __Pyx_MonitoringEventTypes_CyFunc_count);
+    if (unlikely(ret == -1)) return -1;
+    return skip_event ? 0 : PyMonitoring_FirePyStartEvent(&state_array[__Pyx_Monitoring_PY_START], code_obj, offset);
+}
+CYTHON_UNUSED static int __Pyx__TraceStartGen(PyMonitoringState *state_array, __pyx_monitoring_version_type *version, PyObject *code_obj, int offset) {
+    int ret;
+    ret = PyMonitoring_EnterScope(state_array, version, __Pyx_MonitoringEventTypes, __Pyx_MonitoringEventTypes_CyGen_count);
+    if (unlikely(ret == -1)) return -1;
+    return PyMonitoring_FirePyStartEvent(&state_array[__Pyx_Monitoring_PY_START], code_obj, offset);
+}
+CYTHON_UNUSED static int __Pyx__TraceResumeGen(PyMonitoringState *state_array, __pyx_monitoring_version_type *version, PyObject *code_obj, int offset) {
+    int ret;
+    ret = PyMonitoring_EnterScope(state_array, version, __Pyx_MonitoringEventTypes, __Pyx_MonitoringEventTypes_CyGen_count);
+    if (unlikely(ret == -1)) return -1;
+    return PyMonitoring_FirePyResumeEvent(&state_array[__Pyx_Monitoring_PY_RESUME], code_obj, offset);
+}
+CYTHON_UNUSED static void __Pyx__TraceException(PyMonitoringState *monitoring_state, PyObject *code_obj, int offset, int reraised) {
+    if (reraised) {
+        (void) PyMonitoring_FireReraiseEvent(monitoring_state, code_obj, offset);
+    } else {
+        (void) PyMonitoring_FireRaiseEvent(monitoring_state, code_obj, offset);
+    }
+}
+#if CYTHON_TRACE
+CYTHON_UNUSED static int __Pyx__TraceLine(PyMonitoringState *monitoring_state, PyObject *code_obj, int line, int offset) {
+    int ret;
+    PyObject *exc = PyErr_GetRaisedException();
+    ret = PyMonitoring_FireLineEvent(monitoring_state, code_obj, offset, line);
+    if (exc) PyErr_SetRaisedException(exc);
+    return ret;
 }
 #endif
-
-/* Profile */
-#if CYTHON_PROFILE
+#else
 static int __Pyx_TraceSetupAndCall(PyCodeObject** code,
                                    PyFrameObject** frame,
                                    PyThreadState* tstate,
                                    const char *funcname,
                                    const char *srcfile,
-                                   int firstlineno) {
-    PyObject *type, *value, *traceback;
-    int retval;
+                                   int firstlineno,
+                                   int skip_event) {
     if (*frame == NULL || !CYTHON_PROFILE_REUSE_FRAME) {
-        if (*code == NULL) {
+        int needs_new_code_obj = (*code == NULL);
+        if (needs_new_code_obj) {
             *code = __Pyx_createFrameCodeObject(funcname, srcfile, firstlineno);
             if (*code == NULL) return 0;
         }
         *frame = PyFrame_New(
             tstate,                          /*PyThreadState *tstate*/
             *code,                           /*PyCodeObject *code*/
-            __pyx_d,                  /*PyObject *globals*/
+            __pyx_mstate_global->__pyx_d,    /*PyObject *globals*/
             0                                /*PyObject *locals*/
         );
+        if (needs_new_code_obj && !CYTHON_PROFILE_REUSE_CODEOBJ)
+            Py_CLEAR(*code); // otherwise the reference is owned externally
         if (*frame == NULL) return 0;
         if (CYTHON_TRACE && (*frame)->f_trace == NULL) {
             Py_INCREF(Py_None);
             (*frame)->f_trace = Py_None;
         }
-#if PY_VERSION_HEX < 0x030400B1
-    } else {
-        (*frame)->f_tstate = tstate;
-#endif
     }
-      __Pyx_PyFrame_SetLineNumber(*frame, firstlineno);
-    retval = 1;
-    tstate->tracing++;
-    tstate->use_tracing = 0;
-    __Pyx_ErrFetchInState(tstate, &type, &value, &traceback);
-    #if CYTHON_TRACE
-    if (tstate->c_tracefunc)
-        retval = tstate->c_tracefunc(tstate->c_traceobj, *frame, PyTrace_CALL, NULL) == 0;
-    if (retval && tstate->c_profilefunc)
-    #endif
-        retval = tstate->c_profilefunc(tstate->c_profileobj, *frame, PyTrace_CALL, NULL) == 0;
-    tstate->use_tracing = (tstate->c_profilefunc ||
-                           (CYTHON_TRACE && tstate->c_tracefunc));
-    tstate->tracing--;
-    if (retval) {
+    if (!skip_event) {
+        PyObject *type, *value, *traceback;
+        int retval = 1;
+        __Pyx_PyFrame_SetLineNumber(*frame, firstlineno);
+        __Pyx_EnterTracing(tstate);
+        __Pyx_ErrFetchInState(tstate, &type, &value, &traceback);
+        #if CYTHON_TRACE
+        if (tstate->c_tracefunc)
+            retval = tstate->c_tracefunc(tstate->c_traceobj, *frame, PyTrace_CALL, NULL) == 0;
+        if (retval && tstate->c_profilefunc)
+        #endif
+            retval = tstate->c_profilefunc(tstate->c_profileobj, *frame, PyTrace_CALL, NULL) == 0;
+        __Pyx_LeaveTracing(tstate);
+        if (unlikely(!retval)) {
+            Py_XDECREF(type);
+            Py_XDECREF(value);
+            Py_XDECREF(traceback);
+            return -1;
+        }
         __Pyx_ErrRestoreInState(tstate, type, value, traceback);
-        return tstate->use_tracing && retval;
-    } else {
-        Py_XDECREF(type);
-        Py_XDECREF(value);
-        Py_XDECREF(traceback);
-        return -1;
     }
+    return __Pyx_IsTracing(tstate, 0, 0);
 }
-static PyCodeObject *__Pyx_createFrameCodeObject(const char *funcname, const char *srcfile, int firstlineno) {
-    PyCodeObject *py_code = 0;
-#if PY_MAJOR_VERSION >= 3
-    py_code = PyCode_NewEmpty(srcfile, funcname, firstlineno);
-    if (likely(py_code)) {
-        py_code->co_flags |= CO_OPTIMIZED | CO_NEWLOCALS;
+#endif
+#endif
+
+/* IgnoreException (used by GetModuleGlobalName) */
+static CYTHON_INLINE int __Pyx_IgnoreGivenException(PyObject *given_exception, PyObject *ignorable_exception) {
+    if (PyErr_GivenExceptionMatches(given_exception ? given_exception : PyErr_Occurred(), ignorable_exception)) {
+        PyErr_Clear();
+        return 1;
+    }
+    return 0;
+}
+
+/* PyDictVersioning (used by GetModuleGlobalName) */
+#if CYTHON_USE_DICT_VERSIONS && CYTHON_USE_TYPE_SLOTS
+static CYTHON_INLINE PY_UINT64_T __Pyx_get_tp_dict_version(PyObject *obj) {
+    PyObject *dict = Py_TYPE(obj)->tp_dict;
+    return likely(dict) ? __PYX_GET_DICT_VERSION(dict) : 0;
+}
+static CYTHON_INLINE PY_UINT64_T __Pyx_get_object_dict_version(PyObject *obj) {
+    PyObject **dictptr = NULL;
+    Py_ssize_t offset = Py_TYPE(obj)->tp_dictoffset;
+    if (offset) {
+#if CYTHON_COMPILING_IN_CPYTHON
+        dictptr = (likely(offset > 0)) ? (PyObject **) ((char *)obj + offset) : _PyObject_GetDictPtr(obj);
+#else
+        dictptr = _PyObject_GetDictPtr(obj);
+#endif
     }
+    return (dictptr && *dictptr) ? __PYX_GET_DICT_VERSION(*dictptr) : 0;
+}
+static CYTHON_INLINE int __Pyx_object_dict_version_matches(PyObject* obj, PY_UINT64_T tp_dict_version, PY_UINT64_T obj_dict_version) {
+    PyObject *dict = Py_TYPE(obj)->tp_dict;
+    if (unlikely(!dict) || unlikely(tp_dict_version != __PYX_GET_DICT_VERSION(dict)))
+        return 0;
+    return obj_dict_version == __Pyx_get_object_dict_version(obj);
+}
+#endif
+
+/* GetModuleGlobalName */
+#if CYTHON_USE_DICT_VERSIONS
+static PyObject *__Pyx__GetModuleGlobalName(PyObject *name, PY_UINT64_T *dict_version, PyObject **dict_cached_value)
 #else
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    py_funcname = PyString_FromString(funcname);
-    if (unlikely(!py_funcname)) goto bad;
-    py_srcfile = PyString_FromString(srcfile);
-    if (unlikely(!py_srcfile)) goto bad;
-    py_code = PyCode_New(
-        0,
-        0,
-        0,
-        CO_OPTIMIZED | CO_NEWLOCALS,
-        __pyx_empty_bytes,     /*PyObject *code,*/
-        __pyx_empty_tuple,     /*PyObject *consts,*/
-        __pyx_empty_tuple,     /*PyObject *names,*/
-        __pyx_empty_tuple,     /*PyObject *varnames,*/
-        __pyx_empty_tuple,     /*PyObject *freevars,*/
-        __pyx_empty_tuple,     /*PyObject *cellvars,*/
-        py_srcfile,       /*PyObject *filename,*/
-        py_funcname,      /*PyObject *name,*/
-        firstlineno,
-        __pyx_empty_bytes      /*PyObject *lnotab*/
-    );
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
+static CYTHON_INLINE PyObject *__Pyx__GetModuleGlobalName(PyObject *name)
+#endif
+{
+    PyObject *result;
+#if CYTHON_COMPILING_IN_LIMITED_API
+    if (unlikely(!__pyx_m)) {
+        if (!PyErr_Occurred())
+            PyErr_SetNone(PyExc_NameError);
+        return NULL;
+    }
+    result = PyObject_GetAttr(__pyx_m, name);
+    if (likely(result)) {
+        return result;
+    }
+    if (!__Pyx_IgnoreException(PyExc_Exception)) {
+        return NULL; // BaseException
+    }
+#elif CYTHON_AVOID_BORROWED_REFS || CYTHON_AVOID_THREAD_UNSAFE_BORROWED_REFS
+    if (unlikely(__Pyx_PyDict_GetItemRef(__pyx_mstate_global->__pyx_d, name, &result) == -1)) {
+        if (!__Pyx_IgnoreException(PyExc_Exception)) {
+            return NULL; // BaseException
+        }
+    }
+    __PYX_UPDATE_DICT_CACHE(__pyx_mstate_global->__pyx_d, result, *dict_cached_value, *dict_version)
+    if (likely(result)) {
+        return result;
+    }
+#else
+    result = _PyDict_GetItem_KnownHash(__pyx_mstate_global->__pyx_d, name, ((PyASCIIObject *) name)->hash);
+    __PYX_UPDATE_DICT_CACHE(__pyx_mstate_global->__pyx_d, result, *dict_cached_value, *dict_version)
+    if (likely(result)) {
+        return __Pyx_NewRef(result);
+    }
+    PyObject *exc = PyErr_Occurred();
+    if (unlikely(exc) && !__Pyx_IgnoreGivenException(exc, PyExc_Exception)) {
+        return NULL; // BaseException
+    }
+#endif
+    return __Pyx_GetBuiltinName(name);
+}
+
+/* ListAppendAndDecrefInternal (used by ListAppend) */
+#if CYTHON_USE_PYLIST_INTERNALS && CYTHON_ASSUME_SAFE_MACROS && CYTHON_ASSUME_SAFE_SIZE
+static CYTHON_INLINE void __Pyx__ListComp_AppendAndDecref(PyObject* list, Py_ssize_t len, PyObject* x) {
+    PyList_SET_ITEM(list, len, x);
+    Py_SET_SIZE(list, len + 1);
+}
+#endif
+
+/* ListAppend */
+#if CYTHON_USE_PYLIST_INTERNALS && CYTHON_ASSUME_SAFE_MACROS && CYTHON_ASSUME_SAFE_SIZE
+static CYTHON_INLINE int __Pyx_PyList_Append(PyObject* list, PyObject* x) {
+    PyListObject* L = (PyListObject*) list;
+    Py_ssize_t len = Py_SIZE(list);
+    if (likely(L->allocated > len) & likely(len > (L->allocated >> 1))) {
+        Py_INCREF(x);
+        __Pyx__ListComp_AppendAndDecref(list, len, x);
+        return 0;
+    }
+    return PyList_Append(list, x);
+}
+#endif
+
+/* PyObjectCall (used by PyObjectFastCall) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE PyObject* __Pyx_PyObject_Call(PyObject *func, PyObject *arg, PyObject *kw) {
+    PyObject *result;
+    ternaryfunc call = Py_TYPE(func)->tp_call;
+    if (unlikely(!call))
+        return PyObject_Call(func, arg, kw);
+    if (unlikely(Py_EnterRecursiveCall(" while calling a Python object")))
+        return NULL;
+    result = (*call)(func, arg, kw);
+    Py_LeaveRecursiveCall();
+    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
+        PyErr_SetString(
+            PyExc_SystemError,
+            "NULL result without error in PyObject_Call");
+    }
+    return result;
+}
+#endif
+
+/* PyObjectCallMethO (used by PyObjectFastCall) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg) {
+    PyObject *self, *result;
+    PyCFunction cfunc;
+    cfunc = __Pyx_CyOrPyCFunction_GET_FUNCTION(func);
+    self = __Pyx_CyOrPyCFunction_GET_SELF(func);
+    if (unlikely(Py_EnterRecursiveCall(" while calling a Python object")))
+        return NULL;
+    result = cfunc(self, arg);
+    Py_LeaveRecursiveCall();
+    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
+        PyErr_SetString(
+            PyExc_SystemError,
+            "NULL result without error in PyObject_Call");
+    }
+    return result;
+}
+#endif
+
+/* PyObjectFastCall */
+#if CYTHON_COMPILING_IN_LIMITED_API
+static PyObject* __Pyx_PyObject_FastCall_fallback(PyObject *func, PyObject * const*args, size_t nargs, PyObject *kwargs) {
+    PyObject *argstuple;
+    PyObject *result = 0;
+    size_t i;
+    argstuple = PyTuple_New((Py_ssize_t)nargs);
+    if (unlikely(!argstuple)) return NULL;
+    for (i = 0; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        if (__Pyx_PyTuple_SET_ITEM(argstuple, (Py_ssize_t)i, args[i]) != (0)) goto bad;
+    }
+    result = __Pyx_PyObject_Call(func, argstuple, kwargs);
+  bad:
+    Py_DECREF(argstuple);
+    return result;
+}
+#endif
+#if CYTHON_VECTORCALL && !(CYTHON_COMPILING_IN_LIMITED_API || CYTHON_COMPILING_IN_PYPY)
+  #if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE vectorcallfunc __Pyx_PyVectorcall_Function(PyObject *callable) {
+    PyTypeObject *tp = Py_TYPE(callable);
+    #if defined(__Pyx_CyFunction_USED)
+    if (__Pyx_CyFunction_CheckExact(callable)) {
+        return __Pyx_CyFunction_func_vectorcall(callable);
+    }
+    #endif
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_HAVE_VECTORCALL)) {
+        return NULL;
+    }
+    assert(PyCallable_Check(callable));
+    Py_ssize_t offset = tp->tp_vectorcall_offset;
+    assert(offset > 0);
+    vectorcallfunc ptr;
+    memcpy(&ptr, (char *) callable + offset, sizeof(ptr));
+    return ptr;
+}
+  #else
+    #define __Pyx_PyVectorcall_Function(callable) PyVectorcall_Function(callable)
+  #endif
+#endif
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FastCallDict(PyObject *func, PyObject *const *args, size_t nargsf, PyObject *kwargs) {
+    Py_ssize_t nargs = __Pyx_PyVectorcall_NARGS(nargsf);
+#if CYTHON_COMPILING_IN_CPYTHON
+    if (nargs == 0 && kwargs == NULL) {
+        if (__Pyx_CyOrPyCFunction_Check(func) && likely( __Pyx_CyOrPyCFunction_GET_FLAGS(func) & METH_NOARGS))
+            return __Pyx_PyObject_CallMethO(func, NULL);
+    }
+    else if (nargs == 1 && kwargs == NULL) {
+        if (__Pyx_CyOrPyCFunction_Check(func) && likely( __Pyx_CyOrPyCFunction_GET_FLAGS(func) & METH_O))
+            return __Pyx_PyObject_CallMethO(func, args[0]);
+    }
+#endif
+    if (kwargs == NULL) {
+        #if CYTHON_VECTORCALL
+          #if CYTHON_COMPILING_IN_LIMITED_API || CYTHON_COMPILING_IN_PYPY
+            return PyObject_Vectorcall(func, args, nargsf, NULL);
+          #else
+            vectorcallfunc f = __Pyx_PyVectorcall_Function(func);
+            if (f) {
+                return f(func, args, nargsf, NULL);
+            }
+          #endif
+        #endif
+    }
+    if (nargs == 0) {
+        return __Pyx_PyObject_Call(func, __pyx_mstate_global->__pyx_empty_tuple, kwargs);
+    }
+    #if CYTHON_COMPILING_IN_LIMITED_API
+    return __Pyx_PyObject_FastCall_fallback(func, args, (size_t)nargs, kwargs);
+    #elif CYTHON_COMPILING_IN_PYPY
+    return PyObject_VectorcallDict(func, args, (size_t) nargs, kwargs);
+    #else
+    return PyObject_VectorcallDict(func, args, nargsf, kwargs);
+    #endif
+}
+
+/* FormatTypeName (used by RaiseErrorWithObjectType1) */
+#if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030d0000
+static __Pyx_TypeName
+__Pyx_PyType_GetFullyQualifiedName(PyTypeObject* tp)
+{
+    PyObject *module = NULL, *name = NULL, *result = NULL;
+    #if __PYX_LIMITED_VERSION_HEX < 0x030b0000
+    name = __Pyx_PyObject_GetAttrStr((PyObject *)tp,
+                                               __pyx_mstate_global->__pyx_n_u_qualname);
+    #else
+    name = PyType_GetQualName(tp);
+    #endif
+    if (unlikely(name == NULL) || unlikely(!PyUnicode_Check(name))) goto bad;
+    module = __Pyx_PyObject_GetAttrStr((PyObject *)tp,
+                                               __pyx_mstate_global->__pyx_n_u_module);
+    if (unlikely(module == NULL) || unlikely(!PyUnicode_Check(module))) goto bad;
+    if (PyUnicode_CompareWithASCIIString(module, "builtins") == 0) {
+        result = name;
+        name = NULL;
+        goto done;
+    }
+    result = PyUnicode_FromFormat("%U.%U", module, name);
+    if (unlikely(result == NULL)) goto bad;
+  done:
+    Py_XDECREF(name);
+    Py_XDECREF(module);
+    return result;
+  bad:
+    PyErr_Clear();
+    if (name) {
+        result = name;
+        name = NULL;
+    } else {
+        result = __Pyx_NewRef(__pyx_mstate_global->__pyx_kp_u_);
+    }
+    goto done;
+}
 #endif
-    return py_code;
+
+/* RaiseErrorWithObjectType1 (used by RaiseUnexpectedTypeError) */
+static void __Pyx_RaiseErrorWithType1(PyObject* exc_type, const char* message, const char *arg, PyTypeObject *type_obj) {
+    __Pyx_TypeName type_name = __Pyx_PyType_GetFullyQualifiedName(type_obj);
+    #if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030d0000
+    if (unlikely(!type_name)) return;
+    #endif
+    PyErr_Format(exc_type, message, arg, type_name);
+    __Pyx_DECREF_TypeName(type_name);
+}
+
+/* RaiseUnexpectedTypeError */
+static int __Pyx_RaiseUnexpectedTypeError(const char *expected, PyObject *obj) {
+    __Pyx_RaiseTypeErrorWithObjectType1(
+        "Expected %.42s, got " __Pyx_FMT_TYPENAME,
+        expected, obj);
+    return 0;
+}
+
+/* PyFrozenDict (used by GetItemInt) */
+#if CYTHON_COMPILING_IN_LIMITED_API
+static CYTHON_INLINE PyObject* __Pyx__PyFrozenDict_New(PyObject* frozendict_type, PyObject* it) {
+    return PyObject_CallFunctionObjArgs(frozendict_type, it, NULL);
 }
 #endif
 
-/* None */
-static CYTHON_INLINE void __Pyx_RaiseClosureNameError(const char *varname) {
-    PyErr_Format(PyExc_NameError, "free variable '%s' referenced before assignment in enclosing scope", varname);
+/* GettItemInt_wraparound (used by GetItemInt) */
+#if CYTHON_USE_TYPE_SLOTS && !CYTHON_COMPILING_IN_PYPY
+static int __Pyx_GetItemInt_wraparound(PyObject *o, PySequenceMethods *sm, Py_ssize_t *i) {
+    assert(*i < 0);
+    if (likely(sm->sq_length)) {
+        Py_ssize_t l = sm->sq_length(o);
+        if (likely(l >= 0)) {
+            *i += l;
+        } else {
+            if (!PyErr_ExceptionMatches(PyExc_OverflowError))
+                return -1;
+            PyErr_Clear();
+        }
+    }
+    return 0;
 }
+#endif
 
-/* PyDictVersioning */
-#if CYTHON_USE_DICT_VERSIONS && CYTHON_USE_TYPE_SLOTS
-static CYTHON_INLINE PY_UINT64_T __Pyx_get_tp_dict_version(PyObject *obj) {
-    PyObject *dict = Py_TYPE(obj)->tp_dict;
-    return likely(dict) ? __PYX_GET_DICT_VERSION(dict) : 0;
+/* GetItemInt */
+static PyObject *__Pyx_GetItemInt_Generic(PyObject *o, PyObject* j) {
+    PyObject *r;
+    if (unlikely(!j)) return NULL;
+    r = PyObject_GetItem(o, j);
+    Py_DECREF(j);
+    return r;
 }
-static CYTHON_INLINE PY_UINT64_T __Pyx_get_object_dict_version(PyObject *obj) {
-    PyObject **dictptr = NULL;
-    Py_ssize_t offset = Py_TYPE(obj)->tp_dictoffset;
-    if (offset) {
-#if CYTHON_COMPILING_IN_CPYTHON
-        dictptr = (likely(offset > 0)) ? (PyObject **) ((char *)obj + offset) : _PyObject_GetDictPtr(obj);
+static PyObject *__Pyx_GetItemInt_Generic_size(PyObject *o, Py_ssize_t i) {
+    return __Pyx_GetItemInt_Generic(o, PyLong_FromSsize_t(i));
+}
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_List_Fast(PyObject *o, Py_ssize_t i,
+                                                              int wraparound, int boundscheck, int unsafe_shared) {
+    CYTHON_MAYBE_UNUSED_VAR(unsafe_shared);
+#if CYTHON_AVOID_BORROWED_REFS
+    CYTHON_UNUSED_VAR(boundscheck);
+    Py_ssize_t wrapped_i = i;
+    if (wraparound & unlikely(i < 0)) {
+        Py_ssize_t size = __Pyx_PyList_GET_SIZE(o);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(size < 0)) return NULL;
+        #endif
+        wrapped_i += size;
+    }
+    return __Pyx_PyList_GetItemRef(o, wrapped_i);
+#elif CYTHON_ASSUME_SAFE_SIZE && CYTHON_ASSUME_SAFE_MACROS
+    Py_ssize_t wrapped_i = i;
+    Py_ssize_t size = (wraparound | boundscheck) ? PyList_GET_SIZE(o) : -1;
+    if (wraparound & unlikely(i < 0)) {
+        wrapped_i += size;
+    }
+    if ((!boundscheck) || likely(__Pyx_is_valid_index(wrapped_i, size))) {
+        return __Pyx_PyList_GET_ITEM_REF(o, wrapped_i, unsafe_shared);
+    }
+    return __Pyx_GetItemInt_Generic_size(o, i);
 #else
-        dictptr = _PyObject_GetDictPtr(obj);
+    (void)wraparound;
+    (void)boundscheck;
+    return PySequence_GetItem(o, i);
 #endif
+}
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Tuple_Fast(PyObject *o, Py_ssize_t i,
+                                                              int wraparound, int boundscheck, int unsafe_shared) {
+    CYTHON_MAYBE_UNUSED_VAR(unsafe_shared);
+#if CYTHON_AVOID_BORROWED_REFS
+    CYTHON_UNUSED_VAR(boundscheck);
+    Py_ssize_t wrapped_i = i;
+    if (wraparound & unlikely(i < 0)) {
+        Py_ssize_t size = __Pyx_PyTuple_GET_SIZE(o);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(size < 0)) return NULL;
+        #endif
+        wrapped_i += size;
     }
-    return (dictptr && *dictptr) ? __PYX_GET_DICT_VERSION(*dictptr) : 0;
+    #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_COMPILING_IN_LIMITED_API
+    return PySequence_ITEM(o, wrapped_i);
+    #else
+    if (unlikely(wrapped_i < 0)) {
+        PyErr_SetString(PyExc_IndexError, "tuple index out of range");
+        return NULL;
+    }
+    return PySequence_GetItem(o, wrapped_i);
+    #endif
+#elif CYTHON_ASSUME_SAFE_SIZE && CYTHON_ASSUME_SAFE_MACROS
+    Py_ssize_t wrapped_i = i;
+    Py_ssize_t size = (wraparound | boundscheck) ? PyTuple_GET_SIZE(o) : -1;
+    if (wraparound & unlikely(i < 0)) {
+        wrapped_i += size;
+    }
+    if ((!boundscheck) || likely(__Pyx_is_valid_index(wrapped_i, size))) {
+        return __Pyx_NewRef(__Pyx_PyTuple_GET_ITEM(o, wrapped_i));
+    }
+    return __Pyx_GetItemInt_Generic_size(o, i);
+#else
+    (void)wraparound;
+    (void)boundscheck;
+    return PySequence_GetItem(o, i);
+#endif
 }
-static CYTHON_INLINE int __Pyx_object_dict_version_matches(PyObject* obj, PY_UINT64_T tp_dict_version, PY_UINT64_T obj_dict_version) {
-    PyObject *dict = Py_TYPE(obj)->tp_dict;
-    if (unlikely(!dict) || unlikely(tp_dict_version != __PYX_GET_DICT_VERSION(dict)))
-        return 0;
-    return obj_dict_version == __Pyx_get_object_dict_version(obj);
+#if CYTHON_USE_TYPE_SLOTS && !CYTHON_COMPILING_IN_PYPY
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Fast_mapping(PyObject *o, binaryfunc getitem, Py_ssize_t i) {
+    PyObject *r, *key = PyLong_FromSsize_t(i);
+    if (unlikely(!key)) return NULL;
+    r = getitem(o, key);
+    Py_DECREF(key);
+    return r;
 }
 #endif
-
-/* GetModuleGlobalName */
-#if CYTHON_USE_DICT_VERSIONS
-static PyObject *__Pyx__GetModuleGlobalName(PyObject *name, PY_UINT64_T *dict_version, PyObject **dict_cached_value)
+static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Fast(PyObject *o, Py_ssize_t i,
+                                                     int wraparound, int boundscheck, int unsafe_shared) {
+    CYTHON_MAYBE_UNUSED_VAR(unsafe_shared);
+#if CYTHON_ASSUME_SAFE_SIZE
+    if (PyList_CheckExact(o)) {
+        return __Pyx_GetItemInt_List_Fast(o, i, wraparound, boundscheck, unsafe_shared);
+    } else
+    #if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
+    if (PyTuple_CheckExact(o)) {
+        return __Pyx_GetItemInt_Tuple_Fast(o, i, wraparound, boundscheck, unsafe_shared);
+    } else
+    #endif
 #else
-static CYTHON_INLINE PyObject *__Pyx__GetModuleGlobalName(PyObject *name)
+    if ((!wraparound || i >= 0) & PyList_CheckExact(o)) {
+        return boundscheck ? __Pyx_PyList_GetItemRef(o, i) : __Pyx_PyList_GET_ITEM_REF(o, i, unsafe_shared);
+    } else
 #endif
-{
-    PyObject *result;
-#if !CYTHON_AVOID_BORROWED_REFS
-#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030500A1
-    result = _PyDict_GetItem_KnownHash(__pyx_d, name, ((PyASCIIObject *) name)->hash);
-    __PYX_UPDATE_DICT_CACHE(__pyx_d, result, *dict_cached_value, *dict_version)
-    if (likely(result)) {
-        return __Pyx_NewRef(result);
-    } else if (unlikely(PyErr_Occurred())) {
-        return NULL;
+#if CYTHON_USE_TYPE_SLOTS && !CYTHON_COMPILING_IN_PYPY
+    if (PyDict_CheckExact(o)) {
+        return __Pyx_GetItemInt_Fast_mapping(o, PyDict_Type.tp_as_mapping->mp_subscript, i);
+    #if defined(PyFrozenDict_CheckExact)
+    } else if (PyFrozenDict_CheckExact(o)) {
+        return __Pyx_GetItemInt_Fast_mapping(o, PyFrozenDict_Type.tp_as_mapping->mp_subscript, i);
+    #endif
+    } else
+    {
+        PyTypeObject *obj_type = Py_TYPE(o);
+        int seq_or_mapping = __Pyx_PyType_GetFlags(obj_type) & (Py_TPFLAGS_SEQUENCE|Py_TPFLAGS_MAPPING);
+        if (seq_or_mapping != Py_TPFLAGS_SEQUENCE) {
+            PyMappingMethods *mm = obj_type->tp_as_mapping;
+            if (mm && mm->mp_subscript)
+                return __Pyx_GetItemInt_Fast_mapping(o, mm->mp_subscript, i);
+        }
+        PySequenceMethods *sm = obj_type->tp_as_sequence;
+        if (likely(sm && sm->sq_item)) {
+            if (wraparound && (i < 0) && unlikely(__Pyx_GetItemInt_wraparound(o, sm, &i) == -1))
+                return NULL;
+            return sm->sq_item(o, i);
+        }
+        if (seq_or_mapping == Py_TPFLAGS_SEQUENCE) {
+            PyMappingMethods *mm = obj_type->tp_as_mapping;
+            if (likely(mm && mm->mp_subscript))
+                return __Pyx_GetItemInt_Fast_mapping(o, mm->mp_subscript, i);
+        }
     }
 #else
-    result = PyDict_GetItem(__pyx_d, name);
-    __PYX_UPDATE_DICT_CACHE(__pyx_d, result, *dict_cached_value, *dict_version)
-    if (likely(result)) {
-        return __Pyx_NewRef(result);
+    if (!PyMapping_Check(o)) {
+        return PySequence_GetItem(o, i);
     }
 #endif
+    (void)wraparound;
+    (void)boundscheck;
+    return __Pyx_GetItemInt_Generic_size(o, i);
+}
+
+/* GetAttr3 */
+#if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+static PyObject *__Pyx_GetAttr3Default(PyObject *d) {
+    __Pyx_PyThreadState_declare
+    __Pyx_PyThreadState_assign
+    if (unlikely(!__Pyx_PyErr_ExceptionMatches(PyExc_AttributeError)))
+        return NULL;
+    __Pyx_PyErr_Clear();
+    Py_INCREF(d);
+    return d;
+}
+#endif
+static CYTHON_INLINE PyObject *__Pyx_GetAttr3(PyObject *o, PyObject *n, PyObject *d) {
+    PyObject *r;
+#if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+    int res = PyObject_GetOptionalAttr(o, n, &r);
+    return (res != 0) ? r : __Pyx_NewRef(d);
 #else
-    result = PyObject_GetItem(__pyx_d, name);
-    __PYX_UPDATE_DICT_CACHE(__pyx_d, result, *dict_cached_value, *dict_version)
-    if (likely(result)) {
-        return __Pyx_NewRef(result);
+  #if CYTHON_USE_TYPE_SLOTS
+    if (likely(PyUnicode_Check(n))) {
+        r = __Pyx_PyObject_GetAttrStrNoError(o, n);
+        if (unlikely(!r) && likely(!PyErr_Occurred())) {
+            r = __Pyx_NewRef(d);
+        }
+        return r;
     }
-    PyErr_Clear();
+  #endif
+    r = PyObject_GetAttr(o, n);
+    return (likely(r)) ? r : __Pyx_GetAttr3Default(d);
 #endif
-    return __Pyx_GetBuiltinName(name);
 }
 
-/* PyFunctionFastCall */
-#if CYTHON_FAST_PYCALL
-static PyObject* __Pyx_PyFunction_FastCallNoKw(PyCodeObject *co, PyObject **args, Py_ssize_t na,
-                                               PyObject *globals) {
-    PyFrameObject *f;
-    PyThreadState *tstate = __Pyx_PyThreadState_Current;
-    PyObject **fastlocals;
+/* CopyObjectArray (used by TupleOrListFromArrayImpl) */
+#if CYTHON_COMPILING_IN_CPYTHON
+static CYTHON_INLINE void __Pyx_copy_object_array(PyObject *const *CYTHON_RESTRICT src, PyObject** CYTHON_RESTRICT dest, Py_ssize_t length) {
+    PyObject *v;
     Py_ssize_t i;
-    PyObject *result;
-    assert(globals != NULL);
-    /* XXX Perhaps we should create a specialized
-       PyFrame_New() that doesn't take locals, but does
-       take builtins without sanity checking them.
-       */
-    assert(tstate != NULL);
-    f = PyFrame_New(tstate, co, globals, NULL);
-    if (f == NULL) {
-        return NULL;
-    }
-    fastlocals = __Pyx_PyFrame_GetLocalsplus(f);
-    for (i = 0; i < na; i++) {
-        Py_INCREF(*args);
-        fastlocals[i] = *args++;
+    for (i = 0; i < length; i++) {
+        v = dest[i] = src[i];
+        Py_INCREF(v);
     }
-    result = PyEval_EvalFrameEx(f,0);
-    ++tstate->recursion_depth;
-    Py_DECREF(f);
-    --tstate->recursion_depth;
-    return result;
 }
-#if 1 || PY_VERSION_HEX < 0x030600B1
-static PyObject *__Pyx_PyFunction_FastCallDict(PyObject *func, PyObject **args, Py_ssize_t nargs, PyObject *kwargs) {
-    PyCodeObject *co = (PyCodeObject *)PyFunction_GET_CODE(func);
-    PyObject *globals = PyFunction_GET_GLOBALS(func);
-    PyObject *argdefs = PyFunction_GET_DEFAULTS(func);
-    PyObject *closure;
-#if PY_MAJOR_VERSION >= 3
-    PyObject *kwdefs;
-#endif
-    PyObject *kwtuple, **k;
-    PyObject **d;
-    Py_ssize_t nd;
-    Py_ssize_t nk;
-    PyObject *result;
-    assert(kwargs == NULL || PyDict_Check(kwargs));
-    nk = kwargs ? PyDict_Size(kwargs) : 0;
-    if (Py_EnterRecursiveCall((char*)" while calling a Python object")) {
-        return NULL;
-    }
-    if (
-#if PY_MAJOR_VERSION >= 3
-            co->co_kwonlyargcount == 0 &&
 #endif
-            likely(kwargs == NULL || nk == 0) &&
-            co->co_flags == (CO_OPTIMIZED | CO_NEWLOCALS | CO_NOFREE)) {
-        if (argdefs == NULL && co->co_argcount == nargs) {
-            result = __Pyx_PyFunction_FastCallNoKw(co, args, nargs, globals);
-            goto done;
-        }
-        else if (nargs == 0 && argdefs != NULL
-                 && co->co_argcount == Py_SIZE(argdefs)) {
-            /* function called with no arguments, but all parameters have
-               a default value: use default values as arguments .*/
-            args = &PyTuple_GET_ITEM(argdefs, 0);
-            result =__Pyx_PyFunction_FastCallNoKw(co, args, Py_SIZE(argdefs), globals);
-            goto done;
-        }
+
+/* TupleOrListFromArrayImpl (used by TupleFromArray) */
+#if !(PY_VERSION_HEX >= 0x030F0000 && !CYTHON_COMPILING_IN_LIMITED_API)
+CYTHON_UNUSED static PyObject *
+__Pyx_PyTuple_FromArray(PyObject *const *src, Py_ssize_t n) {
+    if (n <= 0) {
+        return __Pyx_NewRef(__pyx_mstate_global->__pyx_empty_tuple);
     }
-    if (kwargs != NULL) {
-        Py_ssize_t pos, i;
-        kwtuple = PyTuple_New(2 * nk);
-        if (kwtuple == NULL) {
-            result = NULL;
-            goto done;
-        }
-        k = &PyTuple_GET_ITEM(kwtuple, 0);
-        pos = i = 0;
-        while (PyDict_Next(kwargs, &pos, &k[i], &k[i+1])) {
-            Py_INCREF(k[i]);
-            Py_INCREF(k[i+1]);
-            i += 2;
+    PyObject *res = PyTuple_New(n);
+    if (unlikely(res == NULL)) return NULL;
+    #if CYTHON_COMPILING_IN_CPYTHON
+    __Pyx_copy_object_array(src, ((PyTupleObject*)res)->ob_item, n);
+    #else
+    Py_ssize_t i;
+    for (i = 0; i < n; i++) {
+        Py_INCREF(src[i]);
+        if (unlikely(__Pyx_PyTuple_SET_ITEM(res, i, src[i]) < (0))) {
+            Py_DECREF(res);
+            return NULL;
         }
-        nk = i / 2;
     }
-    else {
-        kwtuple = NULL;
-        k = NULL;
-    }
-    closure = PyFunction_GET_CLOSURE(func);
-#if PY_MAJOR_VERSION >= 3
-    kwdefs = PyFunction_GET_KW_DEFAULTS(func);
+    #endif
+    return res;
+}
 #endif
-    if (argdefs != NULL) {
-        d = &PyTuple_GET_ITEM(argdefs, 0);
-        nd = Py_SIZE(argdefs);
+
+/* HasAttr */
+#if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+static CYTHON_INLINE int __Pyx_HasAttr(PyObject *o, PyObject *n) {
+    PyObject *r;
+    if (unlikely(!PyUnicode_Check(n))) {
+        PyErr_SetString(PyExc_TypeError,
+                        "hasattr(): attribute name must be string");
+        return -1;
     }
-    else {
-        d = NULL;
-        nd = 0;
+    r = __Pyx_PyObject_GetAttrStrNoError(o, n);
+    if (!r) {
+        return (unlikely(PyErr_Occurred())) ? -1 : 0;
+    } else {
+        Py_DECREF(r);
+        return 1;
     }
-#if PY_MAJOR_VERSION >= 3
-    result = PyEval_EvalCodeEx((PyObject*)co, globals, (PyObject *)NULL,
-                               args, (int)nargs,
-                               k, (int)nk,
-                               d, (int)nd, kwdefs, closure);
-#else
-    result = PyEval_EvalCodeEx(co, globals, (PyObject *)NULL,
-                               args, (int)nargs,
-                               k, (int)nk,
-                               d, (int)nd, closure);
+}
 #endif
-    Py_XDECREF(kwtuple);
-done:
-    Py_LeaveRecursiveCall();
-    return result;
+
+/* RaiseErrorWithObjectType (used by SliceObject) */
+static void __Pyx_RaiseErrorWithType(PyObject* exc_type, const char* message, PyTypeObject *type_obj) {
+    __Pyx_TypeName type_name = __Pyx_PyType_GetFullyQualifiedName(type_obj);
+    #if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030d0000
+    if (unlikely(!type_name)) return;
+    #endif
+    PyErr_Format(exc_type, message, type_name);
+    __Pyx_DECREF_TypeName(type_name);
 }
+
+/* SliceObject */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_GetSlice(PyObject* obj,
+        Py_ssize_t cstart, Py_ssize_t cstop,
+        PyObject** _py_start, PyObject** _py_stop, PyObject** _py_slice,
+        int has_cstart, int has_cstop, CYTHON_UNUSED int wraparound) {
+#if CYTHON_USE_TYPE_SLOTS
+    PyMappingMethods* mp = Py_TYPE(obj)->tp_as_mapping;
+    if (likely(mp && mp->mp_subscript))
+#else
+    if ((1))
 #endif
+    {
+        PyObject* result;
+        PyObject *py_slice, *py_start, *py_stop;
+        if (_py_slice) {
+            py_slice = *_py_slice;
+        } else {
+            PyObject* owned_start = NULL;
+            PyObject* owned_stop = NULL;
+            if (_py_start) {
+                py_start = *_py_start;
+            } else {
+                if (has_cstart) {
+                    owned_start = py_start = PyLong_FromSsize_t(cstart);
+                    if (unlikely(!py_start)) goto bad;
+                } else
+                    py_start = Py_None;
+            }
+            if (_py_stop) {
+                py_stop = *_py_stop;
+            } else {
+                if (has_cstop) {
+                    owned_stop = py_stop = PyLong_FromSsize_t(cstop);
+                    if (unlikely(!py_stop)) {
+                        Py_XDECREF(owned_start);
+                        goto bad;
+                    }
+                } else
+                    py_stop = Py_None;
+            }
+            py_slice = PySlice_New(py_start, py_stop, Py_None);
+            Py_XDECREF(owned_start);
+            Py_XDECREF(owned_stop);
+            if (unlikely(!py_slice)) goto bad;
+        }
+#if CYTHON_USE_TYPE_SLOTS
+        result = mp->mp_subscript(obj, py_slice);
+#else
+        result = PyObject_GetItem(obj, py_slice);
 #endif
-
-/* PyCFunctionFastCall */
-#if CYTHON_FAST_PYCCALL
-static CYTHON_INLINE PyObject * __Pyx_PyCFunction_FastCall(PyObject *func_obj, PyObject **args, Py_ssize_t nargs) {
-    PyCFunctionObject *func = (PyCFunctionObject*)func_obj;
-    PyCFunction meth = PyCFunction_GET_FUNCTION(func);
-    PyObject *self = PyCFunction_GET_SELF(func);
-    int flags = PyCFunction_GET_FLAGS(func);
-    assert(PyCFunction_Check(func));
-    assert(METH_FASTCALL == (flags & ~(METH_CLASS | METH_STATIC | METH_COEXIST | METH_KEYWORDS | METH_STACKLESS)));
-    assert(nargs >= 0);
-    assert(nargs == 0 || args != NULL);
-    /* _PyCFunction_FastCallDict() must not be called with an exception set,
-       because it may clear it (directly or indirectly) and so the
-       caller loses its exception */
-    assert(!PyErr_Occurred());
-    if ((PY_VERSION_HEX < 0x030700A0) || unlikely(flags & METH_KEYWORDS)) {
-        return (*((__Pyx_PyCFunctionFastWithKeywords)(void*)meth)) (self, args, nargs, NULL);
+        if (!_py_slice) {
+            Py_DECREF(py_slice);
+        }
+        return result;
     } else {
-        return (*((__Pyx_PyCFunctionFast)(void*)meth)) (self, args, nargs);
+        __Pyx_RaiseTypeErrorWithObjectType(
+            "'" __Pyx_FMT_TYPENAME "' object is unsliceable", obj);
     }
+bad:
+    return NULL;
 }
-#endif
 
-/* PyObjectCall */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_Call(PyObject *func, PyObject *arg, PyObject *kw) {
+/* PyObjectFormatAndDecref */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FormatSimpleAndDecref(PyObject* s, PyObject* f) {
+    if (unlikely(!s)) return NULL;
+    if (likely(PyUnicode_CheckExact(s))) return s;
+    return __Pyx_PyObject_FormatAndDecref(s, f);
+}
+static CYTHON_INLINE PyObject* __Pyx_PyObject_FormatAndDecref(PyObject* s, PyObject* f) {
     PyObject *result;
-    ternaryfunc call = func->ob_type->tp_call;
-    if (unlikely(!call))
-        return PyObject_Call(func, arg, kw);
-    if (unlikely(Py_EnterRecursiveCall((char*)" while calling a Python object")))
-        return NULL;
-    result = (*call)(func, arg, kw);
-    Py_LeaveRecursiveCall();
-    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
-        PyErr_SetString(
-            PyExc_SystemError,
-            "NULL result without error in PyObject_Call");
-    }
+    if (unlikely(!s)) return NULL;
+    result = PyObject_Format(s, f);
+    Py_DECREF(s);
     return result;
 }
-#endif
 
-/* PyObject_GenericGetAttrNoDict */
-#if CYTHON_USE_TYPE_SLOTS && CYTHON_USE_PYTYPE_LOOKUP && PY_VERSION_HEX < 0x03070000
-static PyObject *__Pyx_RaiseGenericGetAttributeError(PyTypeObject *tp, PyObject *attr_name) {
-    PyErr_Format(PyExc_AttributeError,
-#if PY_MAJOR_VERSION >= 3
-                 "'%.50s' object has no attribute '%U'",
-                 tp->tp_name, attr_name);
-#else
-                 "'%.50s' object has no attribute '%.400s'",
-                 tp->tp_name, PyString_AS_STRING(attr_name));
-#endif
-    return NULL;
-}
-static CYTHON_INLINE PyObject* __Pyx_PyObject_GenericGetAttrNoDict(PyObject* obj, PyObject* attr_name) {
-    PyObject *descr;
-    PyTypeObject *tp = Py_TYPE(obj);
-    if (unlikely(!PyString_Check(attr_name))) {
-        return PyObject_GenericGetAttr(obj, attr_name);
+/* RaiseException */
+static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb, PyObject *cause) {
+    PyObject* owned_instance = NULL;
+    if (tb == Py_None) {
+        tb = 0;
+    } else if (tb && !PyTraceBack_Check(tb)) {
+        PyErr_SetString(PyExc_TypeError,
+            "raise: arg 3 must be a traceback or None");
+        goto bad;
+    }
+    if (value == Py_None)
+        value = 0;
+    if (PyExceptionInstance_Check(type)) {
+        if (value) {
+            PyErr_SetString(PyExc_TypeError,
+                "instance exception may not have a separate value");
+            goto bad;
+        }
+        value = type;
+        type = (PyObject*) Py_TYPE(value);
+    } else if (PyExceptionClass_Check(type)) {
+        PyObject *instance_class = NULL;
+        if (value && PyExceptionInstance_Check(value)) {
+            instance_class = (PyObject*) Py_TYPE(value);
+            if (instance_class != type) {
+                int is_subclass = PyObject_IsSubclass(instance_class, type);
+                if (!is_subclass) {
+                    instance_class = NULL;
+                } else if (unlikely(is_subclass == -1)) {
+                    goto bad;
+                } else {
+                    type = instance_class;
+                }
+            }
+        }
+        if (!instance_class) {
+            PyObject *args;
+            if (!value)
+                args = PyTuple_New(0);
+            else if (PyTuple_Check(value)) {
+                Py_INCREF(value);
+                args = value;
+            } else
+                args = PyTuple_Pack(1, value);
+            if (!args)
+                goto bad;
+            owned_instance = PyObject_Call(type, args, NULL);
+            Py_DECREF(args);
+            if (!owned_instance)
+                goto bad;
+            value = owned_instance;
+            if (!PyExceptionInstance_Check(value)) {
+                PyErr_Format(PyExc_TypeError,
+                             "calling %R should have returned an instance of "
+                             "BaseException, not %R",
+                             type, Py_TYPE(value));
+                goto bad;
+            }
+        }
+    } else {
+        PyErr_SetString(PyExc_TypeError,
+            "raise: exception class must be a subclass of BaseException");
+        goto bad;
     }
-    assert(!tp->tp_dictoffset);
-    descr = _PyType_Lookup(tp, attr_name);
-    if (unlikely(!descr)) {
-        return __Pyx_RaiseGenericGetAttributeError(tp, attr_name);
+    if (cause) {
+        PyObject *fixed_cause;
+        if (cause == Py_None) {
+            fixed_cause = NULL;
+        } else if (PyExceptionClass_Check(cause)) {
+            fixed_cause = PyObject_CallObject(cause, NULL);
+            if (fixed_cause == NULL)
+                goto bad;
+        } else if (PyExceptionInstance_Check(cause)) {
+            fixed_cause = cause;
+            Py_INCREF(fixed_cause);
+        } else {
+            PyErr_SetString(PyExc_TypeError,
+                            "exception causes must derive from "
+                            "BaseException");
+            goto bad;
+        }
+        PyException_SetCause(value, fixed_cause);
     }
-    Py_INCREF(descr);
-    #if PY_MAJOR_VERSION < 3
-    if (likely(PyType_HasFeature(Py_TYPE(descr), Py_TPFLAGS_HAVE_CLASS)))
-    #endif
-    {
-        descrgetfunc f = Py_TYPE(descr)->tp_descr_get;
-        if (unlikely(f)) {
-            PyObject *res = f(descr, obj, (PyObject *)tp);
-            Py_DECREF(descr);
-            return res;
+    PyErr_SetObject(type, value);
+    if (tb) {
+#if PY_VERSION_HEX >= 0x030C00A6
+        PyException_SetTraceback(value, tb);
+#elif CYTHON_FAST_THREAD_STATE
+        PyThreadState *tstate = __Pyx_PyThreadState_Current;
+        PyObject* tmp_tb = tstate->curexc_traceback;
+        if (tb != tmp_tb) {
+            Py_INCREF(tb);
+            tstate->curexc_traceback = tb;
+            Py_XDECREF(tmp_tb);
         }
+#else
+        PyObject *tmp_type, *tmp_value, *tmp_tb;
+        PyErr_Fetch(&tmp_type, &tmp_value, &tmp_tb);
+        Py_INCREF(tb);
+        PyErr_Restore(tmp_type, tmp_value, tb);
+        Py_XDECREF(tmp_tb);
+#endif
     }
-    return descr;
+bad:
+    Py_XDECREF(owned_instance);
+    return;
 }
-#endif
 
-/* Import */
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list, int level) {
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    #if PY_MAJOR_VERSION < 3
-    PyObject *py_import;
-    py_import = __Pyx_PyObject_GetAttrStr(__pyx_b, __pyx_n_s_import);
-    if (!py_import)
-        goto bad;
-    #endif
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
+/* JoinPyUnicode */
+static PyObject* __Pyx_PyUnicode_Join(PyObject** values, Py_ssize_t value_count, Py_ssize_t result_ulength, int kind) {
+#if __Pyx_PyUnicode_Join_CAN_USE_KIND_AND_LENGTH && CYTHON_USE_UNICODE_INTERNALS
+    PyObject *result_uval;
+    int result_ukind, kind_shift;
+    Py_ssize_t i, char_pos;
+    void *result_udata;
+    static const Py_UCS4 max_char[5] = {0x7fU, 0xffU, 0xffffU, 0xffffU, 0x10ffffU};
+    assert (kind >= 0);
+    if (kind > PyUnicode_4BYTE_KIND) kind = PyUnicode_4BYTE_KIND;
+    result_uval = PyUnicode_New(result_ulength, max_char[kind]);
+    if (unlikely(!result_uval)) return NULL;
+    kind_shift = kind >> 1;  // 0, 1, 2
+    result_ukind = 1 << kind_shift;  // 1, 2, 4
+    result_udata = PyUnicode_DATA(result_uval);
+    assert(kind_shift == 2 || kind_shift == 1 || kind_shift == 0);
+    if (unlikely((PY_SSIZE_T_MAX >> kind_shift) - result_ulength < 0))
+        goto overflow;
+    char_pos = 0;
+    for (i=0; i < value_count; i++) {
+        int ukind;
+        Py_ssize_t ulength;
+        void *udata;
+        PyObject *uval = values[i];
+        if (__Pyx_PyUnicode_READY(uval) == (-1))
             goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    {
-        #if PY_MAJOR_VERSION >= 3
-        if (level == -1) {
-            if ((1) && (strchr(__Pyx_MODULE_NAME, '.'))) {
-                module = PyImport_ImportModuleLevelObject(
-                    name, global_dict, empty_dict, list, 1);
-                if (!module) {
-                    if (!PyErr_ExceptionMatches(PyExc_ImportError))
-                        goto bad;
-                    PyErr_Clear();
-                }
-            }
-            level = 0;
-        }
+        ulength = __Pyx_PyUnicode_GET_LENGTH(uval);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(ulength < 0)) goto bad;
         #endif
-        if (!module) {
-            #if PY_MAJOR_VERSION < 3
-            PyObject *py_level = PyInt_FromLong(level);
-            if (!py_level)
-                goto bad;
-            module = PyObject_CallFunctionObjArgs(py_import,
-                name, global_dict, empty_dict, list, py_level, (PyObject *)NULL);
-            Py_DECREF(py_level);
+        if (unlikely(!ulength))
+            continue;
+        if (unlikely((PY_SSIZE_T_MAX >> kind_shift) - ulength < char_pos))
+            goto overflow;
+        ukind = __Pyx_PyUnicode_KIND(uval);
+        udata = __Pyx_PyUnicode_DATA(uval);
+        if (ukind == result_ukind) {
+            memcpy((char *)result_udata + (char_pos << kind_shift), udata, (size_t) (ulength << kind_shift));
+        } else {
+            #if PY_VERSION_HEX >= 0x030d0000
+            if (unlikely(PyUnicode_CopyCharacters(result_uval, char_pos, uval, 0, ulength) < 0)) goto bad;
+            #elif CYTHON_COMPILING_IN_CPYTHON || defined(_PyUnicode_FastCopyCharacters)
+            _PyUnicode_FastCopyCharacters(result_uval, char_pos, uval, 0, ulength);
             #else
-            module = PyImport_ImportModuleLevelObject(
-                name, global_dict, empty_dict, list, level);
+            Py_ssize_t j;
+            for (j=0; j < ulength; j++) {
+                Py_UCS4 uchar = __Pyx_PyUnicode_READ(ukind, udata, j);
+                __Pyx_PyUnicode_WRITE(result_ukind, result_udata, char_pos+j, uchar);
+            }
             #endif
         }
+        char_pos += ulength;
     }
+    return result_uval;
+overflow:
+    PyErr_SetString(PyExc_OverflowError, "join() result is too long for a Python string");
 bad:
-    #if PY_MAJOR_VERSION < 3
-    Py_XDECREF(py_import);
-    #endif
-    Py_XDECREF(empty_list);
-    Py_XDECREF(empty_dict);
-    return module;
+    Py_DECREF(result_uval);
+    return NULL;
+#else
+    Py_ssize_t i;
+    PyObject *result = NULL;
+    PyObject *value_tuple = PyTuple_New(value_count);
+    if (unlikely(!value_tuple)) return NULL;
+    CYTHON_UNUSED_VAR(kind);
+    CYTHON_UNUSED_VAR(result_ulength);
+    for (i=0; i<value_count; i++) {
+        Py_INCREF(values[i]);
+        if (__Pyx_PyTuple_SET_ITEM(value_tuple, i, values[i]) != (0)) goto bad;
+    }
+    result = PyUnicode_Join(__pyx_mstate_global->__pyx_empty_unicode, value_tuple);
+bad:
+    Py_DECREF(value_tuple);
+    return result;
+#endif
 }
 
-/* ImportFrom */
-static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name) {
-    PyObject* value = __Pyx_PyObject_GetAttrStr(module, name);
-    if (unlikely(!value) && PyErr_ExceptionMatches(PyExc_AttributeError)) {
-        PyErr_Format(PyExc_ImportError,
-        #if PY_MAJOR_VERSION < 3
-            "cannot import name %.230s", PyString_AS_STRING(name));
-        #else
-            "cannot import name %S", name);
-        #endif
+/* DivInt[Py_ssize_t] */
+static CYTHON_INLINE Py_ssize_t __Pyx_div_Py_ssize_t(Py_ssize_t a, Py_ssize_t b, int b_is_constant) {
+    Py_ssize_t q = a / b;
+    Py_ssize_t r = a - q*b;
+    Py_ssize_t adapt_python = (b_is_constant ?
+        ((r != 0) & ((r < 0) ^ (b < 0))) :
+        ((r != 0) & ((r ^ b) < 0))
+    );
+    return q - adapt_python;
+}
+
+/* IterFinish (used by dict_iter_common) */
+static CYTHON_INLINE int __Pyx_IterFinish(void) {
+    PyObject* exc_type;
+    __Pyx_PyThreadState_declare
+    __Pyx_PyThreadState_assign
+    exc_type = __Pyx_PyErr_CurrentExceptionType();
+    if (unlikely(exc_type)) {
+        if (unlikely(!__Pyx_PyErr_GivenExceptionMatches(exc_type, PyExc_StopIteration)))
+            return -1;
+        __Pyx_PyErr_Clear();
+        return 0;
     }
-    return value;
+    return 0;
 }
 
-/* CLineInTraceback */
-#ifndef CYTHON_CLINE_IN_TRACEBACK
-static int __Pyx_CLineForTraceback(CYTHON_NCP_UNUSED PyThreadState *tstate, int c_line) {
-    PyObject *use_cline;
-    PyObject *ptype, *pvalue, *ptraceback;
-#if CYTHON_COMPILING_IN_CPYTHON
-    PyObject **cython_runtime_dict;
+/* PyObjectCallMethod0 (used by dict_iter_common) */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethod0(PyObject* obj, PyObject* method_name) {
+#if CYTHON_VECTORCALL && (__PYX_LIMITED_VERSION_HEX >= 0x030C0000 || !CYTHON_COMPILING_IN_LIMITED_API)
+    return PyObject_VectorcallMethod(method_name, &obj, 1 | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+#elif CYTHON_COMPILING_IN_LIMITED_API
+    return PyObject_CallMethodObjArgs(obj, method_name, NULL);
+#else
+    return PyObject_CallMethodNoArgs(obj, method_name);
 #endif
-    if (unlikely(!__pyx_cython_runtime)) {
-        return c_line;
+}
+
+/* RaiseNeedMoreValuesToUnpack (used by UnpackTuple2) */
+static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index) {
+    PyErr_Format(PyExc_ValueError,
+                 "need more than %" CYTHON_FORMAT_SSIZE_T "d value%.1s to unpack",
+                 index, (index == 1) ? "" : "s");
+}
+
+/* RaiseTooManyValuesToUnpack (used by UnpackItemEndCheck) */
+static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected) {
+    PyErr_Format(PyExc_ValueError,
+                 "too many values to unpack (expected %" CYTHON_FORMAT_SSIZE_T "d)", expected);
+}
+
+/* UnpackItemEndCheck (used by UnpackTuple2) */
+static int __Pyx_IternextUnpackEndCheck(PyObject *retval, Py_ssize_t expected) {
+    if (unlikely(retval)) {
+        Py_DECREF(retval);
+        __Pyx_RaiseTooManyValuesError(expected);
+        return -1;
     }
-    __Pyx_ErrFetchInState(tstate, &ptype, &pvalue, &ptraceback);
-#if CYTHON_COMPILING_IN_CPYTHON
-    cython_runtime_dict = _PyObject_GetDictPtr(__pyx_cython_runtime);
-    if (likely(cython_runtime_dict)) {
-        __PYX_PY_DICT_LOOKUP_IF_MODIFIED(
-            use_cline, *cython_runtime_dict,
-            __Pyx_PyDict_GetItemStr(*cython_runtime_dict, __pyx_n_s_cline_in_traceback))
-    } else
-#endif
-    {
-      PyObject *use_cline_obj = __Pyx_PyObject_GetAttrStr(__pyx_cython_runtime, __pyx_n_s_cline_in_traceback);
-      if (use_cline_obj) {
-        use_cline = PyObject_Not(use_cline_obj) ? Py_False : Py_True;
-        Py_DECREF(use_cline_obj);
+    return __Pyx_IterFinish();
+}
+
+/* RaiseNoneIterError (used by UnpackTupleError) */
+static CYTHON_INLINE void __Pyx_RaiseNoneNotIterableError(void) {
+    PyErr_SetString(PyExc_TypeError, "'NoneType' object is not iterable");
+}
+
+/* UnpackTupleError (used by UnpackTuple2) */
+static void __Pyx_UnpackTupleError(PyObject *t, Py_ssize_t index) {
+    if (t == Py_None) {
+      __Pyx_RaiseNoneNotIterableError();
+    } else {
+      Py_ssize_t size = __Pyx_PyTuple_GET_SIZE(t);
+ #if !CYTHON_ASSUME_SAFE_SIZE
+      if (unlikely(size < 0)) return;
+ #endif
+      if (size < index) {
+        __Pyx_RaiseNeedMoreValuesError(size);
       } else {
-        PyErr_Clear();
-        use_cline = NULL;
+        __Pyx_RaiseTooManyValuesError(index);
       }
     }
-    if (!use_cline) {
-        c_line = 0;
-        PyObject_SetAttr(__pyx_cython_runtime, __pyx_n_s_cline_in_traceback, Py_False);
-    }
-    else if (use_cline == Py_False || (use_cline != Py_True && PyObject_Not(use_cline) != 0)) {
-        c_line = 0;
-    }
-    __Pyx_ErrRestoreInState(tstate, ptype, pvalue, ptraceback);
-    return c_line;
 }
-#endif
 
-/* CodeObjectCache */
-static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line) {
-    int start = 0, mid = 0, end = count - 1;
-    if (end >= 0 && code_line > entries[end].code_line) {
-        return count;
-    }
-    while (start < end) {
-        mid = start + (end - start) / 2;
-        if (code_line < entries[mid].code_line) {
-            end = mid;
-        } else if (code_line > entries[mid].code_line) {
-             start = mid + 1;
-        } else {
-            return mid;
+/* UnpackTuple2 (used by dict_iter_common) */
+static CYTHON_INLINE int __Pyx_unpack_tuple2(
+        PyObject* tuple, PyObject** value1, PyObject** value2, int is_tuple, int has_known_size, int decref_tuple) {
+    if (likely(is_tuple || PyTuple_Check(tuple))) {
+        Py_ssize_t size;
+        if (has_known_size) {
+            return __Pyx_unpack_tuple2_exact(tuple, value1, value2, decref_tuple);
         }
-    }
-    if (code_line <= entries[mid].code_line) {
-        return mid;
+        size = __Pyx_PyTuple_GET_SIZE(tuple);
+        if (likely(size == 2)) {
+            return __Pyx_unpack_tuple2_exact(tuple, value1, value2, decref_tuple);
+        }
+        if (size >= 0) {
+            __Pyx_UnpackTupleError(tuple, 2);
+        }
+        return -1;
     } else {
-        return mid + 1;
+        return __Pyx_unpack_tuple2_generic(tuple, value1, value2, has_known_size, decref_tuple);
     }
 }
-static PyCodeObject *__pyx_find_code_object(int code_line) {
-    PyCodeObject* code_object;
-    int pos;
-    if (unlikely(!code_line) || unlikely(!__pyx_code_cache.entries)) {
-        return NULL;
+static CYTHON_INLINE int __Pyx_unpack_tuple2_exact(
+        PyObject* tuple, PyObject** pvalue1, PyObject** pvalue2, int decref_tuple) {
+    PyObject *value1 = NULL, *value2 = NULL;
+#if CYTHON_AVOID_BORROWED_REFS || !CYTHON_ASSUME_SAFE_MACROS
+    value1 = __Pyx_PySequence_ITEM(tuple, 0);  if (unlikely(!value1)) goto bad;
+    value2 = __Pyx_PySequence_ITEM(tuple, 1);  if (unlikely(!value2)) goto bad;
+#else
+    value1 = PyTuple_GET_ITEM(tuple, 0);  Py_INCREF(value1);
+    value2 = PyTuple_GET_ITEM(tuple, 1);  Py_INCREF(value2);
+#endif
+    if (decref_tuple) {
+        Py_DECREF(tuple);
     }
-    pos = __pyx_bisect_code_objects(__pyx_code_cache.entries, __pyx_code_cache.count, code_line);
-    if (unlikely(pos >= __pyx_code_cache.count) || unlikely(__pyx_code_cache.entries[pos].code_line != code_line)) {
+    *pvalue1 = value1;
+    *pvalue2 = value2;
+    return 0;
+#if CYTHON_AVOID_BORROWED_REFS || !CYTHON_ASSUME_SAFE_MACROS
+bad:
+    Py_XDECREF(value1);
+    Py_XDECREF(value2);
+    if (decref_tuple) { Py_XDECREF(tuple); }
+    return -1;
+#endif
+}
+static int __Pyx_unpack_tuple2_generic(PyObject* tuple, PyObject** pvalue1, PyObject** pvalue2,
+                                       int has_known_size, int decref_tuple) {
+    Py_ssize_t index;
+    PyObject *value1 = NULL, *value2 = NULL, *iter = NULL;
+    iternextfunc iternext;
+    iter = PyObject_GetIter(tuple);
+    if (unlikely(!iter)) goto bad;
+    if (decref_tuple) { Py_DECREF(tuple); tuple = NULL; }
+    iternext = __Pyx_PyObject_GetIterNextFunc(iter);
+    value1 = iternext(iter); if (unlikely(!value1)) { index = 0; goto unpacking_failed; }
+    value2 = iternext(iter); if (unlikely(!value2)) { index = 1; goto unpacking_failed; }
+    if (!has_known_size && unlikely(__Pyx_IternextUnpackEndCheck(iternext(iter), 2))) goto bad;
+    Py_DECREF(iter);
+    *pvalue1 = value1;
+    *pvalue2 = value2;
+    return 0;
+unpacking_failed:
+    if (!has_known_size && __Pyx_IterFinish() == 0)
+        __Pyx_RaiseNeedMoreValuesError(index);
+bad:
+    Py_XDECREF(iter);
+    Py_XDECREF(value1);
+    Py_XDECREF(value2);
+    if (decref_tuple) { Py_XDECREF(tuple); }
+    return -1;
+}
+
+/* dict_iter_common (used by dict_iter) */
+static PyObject *__Pyx_dict_call_to_get_iterable(PyObject* iterable, PyObject* method_name) {
+    PyObject* iter;
+    iterable = __Pyx_PyObject_CallMethod0(iterable, method_name);
+    if (!iterable)
         return NULL;
-    }
-    code_object = __pyx_code_cache.entries[pos].code_object;
-    Py_INCREF(code_object);
-    return code_object;
+#if !CYTHON_AVOID_BORROWED_REFS
+    if (PyTuple_CheckExact(iterable) || PyList_CheckExact(iterable))
+        return iterable;
+#endif
+    iter = PyObject_GetIter(iterable);
+    Py_DECREF(iterable);
+    return iter;
 }
-static void __pyx_insert_code_object(int code_line, PyCodeObject* code_object) {
-    int pos, i;
-    __Pyx_CodeObjectCacheEntry* entries = __pyx_code_cache.entries;
-    if (unlikely(!code_line)) {
-        return;
-    }
-    if (unlikely(!entries)) {
-        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Malloc(64*sizeof(__Pyx_CodeObjectCacheEntry));
-        if (likely(entries)) {
-            __pyx_code_cache.entries = entries;
-            __pyx_code_cache.max_count = 64;
-            __pyx_code_cache.count = 1;
-            entries[0].code_line = code_line;
-            entries[0].code_object = code_object;
-            Py_INCREF(code_object);
-        }
-        return;
+#if !CYTHON_AVOID_BORROWED_REFS
+static CYTHON_INLINE int __Pyx_dict_iter_next_source_is_dict(
+        PyObject* iter_obj, CYTHON_NCP_UNUSED Py_ssize_t orig_length, CYTHON_NCP_UNUSED Py_ssize_t* ppos,
+        PyObject** pkey, PyObject** pvalue, PyObject** pitem) {
+    PyObject *key, *value;
+    if (unlikely(orig_length != PyDict_Size(iter_obj))) {
+        PyErr_SetString(PyExc_RuntimeError, "dictionary changed size during iteration");
+        return -1;
     }
-    pos = __pyx_bisect_code_objects(__pyx_code_cache.entries, __pyx_code_cache.count, code_line);
-    if ((pos < __pyx_code_cache.count) && unlikely(__pyx_code_cache.entries[pos].code_line == code_line)) {
-        PyCodeObject* tmp = entries[pos].code_object;
-        entries[pos].code_object = code_object;
-        Py_DECREF(tmp);
-        return;
+    if (unlikely(!PyDict_Next(iter_obj, ppos, &key, &value))) {
+        return 0;
     }
-    if (__pyx_code_cache.count == __pyx_code_cache.max_count) {
-        int new_max = __pyx_code_cache.max_count + 64;
-        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Realloc(
-            __pyx_code_cache.entries, ((size_t)new_max) * sizeof(__Pyx_CodeObjectCacheEntry));
-        if (unlikely(!entries)) {
-            return;
+    if (pitem) {
+        PyObject* tuple = PyTuple_New(2);
+        if (unlikely(!tuple)) {
+            return -1;
         }
-        __pyx_code_cache.entries = entries;
-        __pyx_code_cache.max_count = new_max;
-    }
-    for (i=__pyx_code_cache.count; i>pos; i--) {
-        entries[i] = entries[i-1];
-    }
-    entries[pos].code_line = code_line;
-    entries[pos].code_object = code_object;
-    __pyx_code_cache.count++;
-    Py_INCREF(code_object);
-}
-
-/* AddTraceback */
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-static PyCodeObject* __Pyx_CreateCodeObjectForTraceback(
-            const char *funcname, int c_line,
-            int py_line, const char *filename) {
-    PyCodeObject *py_code = 0;
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(filename);
-    #else
-    py_srcfile = PyUnicode_FromString(filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (c_line) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
+        Py_INCREF(key);
+        Py_INCREF(value);
+        #if CYTHON_ASSUME_SAFE_MACROS
+        PyTuple_SET_ITEM(tuple, 0, key);
+        PyTuple_SET_ITEM(tuple, 1, value);
         #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
+        if (unlikely(PyTuple_SetItem(tuple, 0, key) < 0)) {
+            Py_DECREF(value);
+            Py_DECREF(tuple);
+            return -1;
+        }
+        if (unlikely(PyTuple_SetItem(tuple, 1, value) < 0)) {
+            Py_DECREF(tuple);
+            return -1;
+        }
         #endif
+        *pitem = tuple;
+    } else {
+        if (pkey) {
+            Py_INCREF(key);
+            *pkey = key;
+        }
+        if (pvalue) {
+            Py_INCREF(value);
+            *pvalue = value;
+        }
     }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
+    return 1;
+}
+#endif
+static CYTHON_INLINE int __Pyx_dict_iter_next(
+        PyObject* iter_obj, CYTHON_NCP_UNUSED Py_ssize_t orig_length, CYTHON_NCP_UNUSED Py_ssize_t* ppos,
+        PyObject** pkey, PyObject** pvalue, PyObject** pitem, int source_is_dict) {
+    PyObject* next_item;
+#if !CYTHON_AVOID_BORROWED_REFS
+    if (source_is_dict) {
+        int result;
+#if PY_VERSION_HEX >= 0x030d0000 && !CYTHON_COMPILING_IN_LIMITED_API
+        Py_BEGIN_CRITICAL_SECTION(iter_obj);
+#endif
+        result = __Pyx_dict_iter_next_source_is_dict(iter_obj, orig_length, ppos, pkey, pvalue, pitem);
+#if PY_VERSION_HEX >= 0x030d0000 && !CYTHON_COMPILING_IN_LIMITED_API
+        Py_END_CRITICAL_SECTION();
+#endif
+        return result;
+    } else if (PyTuple_CheckExact(iter_obj)) {
+        Py_ssize_t pos = *ppos;
+        Py_ssize_t tuple_size = __Pyx_PyTuple_GET_SIZE(iter_obj);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(tuple_size < 0)) return -1;
+        #endif
+        if (unlikely(pos >= tuple_size)) return 0;
+        *ppos = pos + 1;
+        #if CYTHON_ASSUME_SAFE_MACROS
+        next_item = PyTuple_GET_ITEM(iter_obj, pos);
         #else
-        py_funcname = PyUnicode_FromString(funcname);
+        next_item = PyTuple_GetItem(iter_obj, pos);
+        if (unlikely(!next_item)) return -1;
         #endif
+        Py_INCREF(next_item);
+    } else if (PyList_CheckExact(iter_obj)) {
+        Py_ssize_t pos = *ppos;
+        Py_ssize_t list_size = __Pyx_PyList_GET_SIZE(iter_obj);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(list_size < 0)) return -1;
+        #endif
+        if (unlikely(pos >= list_size)) return 0;
+        *ppos = pos + 1;
+        next_item = __Pyx_PyList_GET_ITEM_REF(iter_obj, pos, __Pyx_ReferenceSharing_OwnStrongReference);
+        if (unlikely(!next_item)) return -1;
+    } else
+#endif
+    {
+        next_item = PyIter_Next(iter_obj);
+        if (unlikely(!next_item)) {
+            return __Pyx_IterFinish();
+        }
     }
-    if (!py_funcname) goto bad;
-    py_code = __Pyx_PyCode_New(
-        0,
-        0,
-        0,
-        0,
-        0,
-        __pyx_empty_bytes, /*PyObject *code,*/
-        __pyx_empty_tuple, /*PyObject *consts,*/
-        __pyx_empty_tuple, /*PyObject *names,*/
-        __pyx_empty_tuple, /*PyObject *varnames,*/
-        __pyx_empty_tuple, /*PyObject *freevars,*/
-        __pyx_empty_tuple, /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        py_line,
-        __pyx_empty_bytes  /*PyObject *lnotab*/
-    );
-    Py_DECREF(py_srcfile);
-    Py_DECREF(py_funcname);
-    return py_code;
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    return NULL;
+    if (pitem) {
+        *pitem = next_item;
+    } else if (pkey && pvalue) {
+        if (__Pyx_unpack_tuple2(next_item, pkey, pvalue, source_is_dict, source_is_dict, 1))
+            return -1;
+    } else if (pkey) {
+        *pkey = next_item;
+    } else {
+        *pvalue = next_item;
+    }
+    return 1;
 }
-static void __Pyx_AddTraceback(const char *funcname, int c_line,
-                               int py_line, const char *filename) {
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-    PyThreadState *tstate = __Pyx_PyThreadState_Current;
-    if (c_line) {
-        c_line = __Pyx_CLineForTraceback(tstate, c_line);
+
+/* dict_iter */
+static CYTHON_INLINE PyObject* __Pyx_dict_iterator(PyObject* iterable, int is_dict, PyObject* method_name,
+                                                   Py_ssize_t* p_orig_length, int* p_source_is_dict) {
+    is_dict = is_dict || likely(__Pyx_PyAnyDict_CheckExact(iterable));
+    *p_source_is_dict = is_dict;
+#if !CYTHON_AVOID_BORROWED_REFS
+    if (is_dict) {
+        *p_orig_length = PyDict_Size(iterable);
+        Py_INCREF(iterable);
+        return iterable;
     }
-    py_code = __pyx_find_code_object(c_line ? -c_line : py_line);
-    if (!py_code) {
-        py_code = __Pyx_CreateCodeObjectForTraceback(
-            funcname, c_line, py_line, filename);
-        if (!py_code) goto bad;
-        __pyx_insert_code_object(c_line ? -c_line : py_line, py_code);
+#endif
+    *p_orig_length = 0;
+    if (method_name) {
+        return __Pyx_dict_call_to_get_iterable(iterable, method_name);
+    } else {
+        return PyObject_GetIter(iterable);
     }
-    py_frame = PyFrame_New(
-        tstate,            /*PyThreadState *tstate,*/
-        py_code,           /*PyCodeObject *code,*/
-        __pyx_d,    /*PyObject *globals,*/
-        0                  /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    __Pyx_PyFrame_SetLineNumber(py_frame, py_line);
-    PyTraceBack_Here(py_frame);
+}
+
+/* FunctionExport */
+static int __Pyx_ExportFunction(PyObject *api_dict, const char *name, void (*f)(void), const char *sig) {
+    PyObject *cobj;
+    union {
+        void (*fp)(void);
+        void *p;
+    } tmp;
+    tmp.fp = f;
+    cobj = PyCapsule_New(tmp.p, sig, 0);
+    if (!cobj)
+        goto bad;
+    if (PyDict_SetItemString(api_dict, name, cobj) < 0)
+        goto bad;
+    Py_DECREF(cobj);
+    return 0;
 bad:
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
+    Py_XDECREF(cobj);
+    return -1;
 }
 
-/* CIntToPy */
-static CYTHON_INLINE PyObject* __Pyx_PyInt_From_long(long value) {
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
-#endif
-    const long neg_one = (long) -1, const_zero = (long) 0;
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic pop
-#endif
-    const int is_unsigned = neg_one > const_zero;
-    if (is_unsigned) {
-        if (sizeof(long) < sizeof(long)) {
-            return PyInt_FromLong((long) value);
-        } else if (sizeof(long) <= sizeof(unsigned long)) {
-            return PyLong_FromUnsignedLong((unsigned long) value);
-#ifdef HAVE_LONG_LONG
-        } else if (sizeof(long) <= sizeof(unsigned PY_LONG_LONG)) {
-            return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG) value);
+/* GetApiDict */
+static PyObject *__Pyx_ApiExport_GetApiDict(void) {
+    PyObject *d;
+    if (__Pyx_PyDict_GetItemRef(__pyx_mstate_global->__pyx_d, __pyx_mstate_global->__pyx_n_u_pyx_capi, &d) == -1)
+        return NULL;
+    if (!d) {
+        d = PyDict_New();
+        if (!d)
+            goto bad;
+        if (PyObject_SetAttr(__pyx_m, __pyx_mstate_global->__pyx_n_u_pyx_capi, d) < 0)
+            goto bad;
+    }
+    return d;
+bad:
+    Py_XDECREF(d);
+    return NULL;
+}
+
+/* TypeImport */
+#ifndef __PYX_HAVE_RT_ImportType_3_3_0
+#define __PYX_HAVE_RT_ImportType_3_3_0
+static PyTypeObject *__Pyx_ImportType_3_3_0(PyObject *module, const char *module_name, const char *class_name,
+    size_t size, size_t alignment, enum __Pyx_ImportType_CheckSize_3_3_0 check_size)
+{
+    PyObject *result = 0;
+    Py_ssize_t basicsize;
+    Py_ssize_t itemsize;
+#if defined(Py_LIMITED_API) || (defined(CYTHON_COMPILING_IN_LIMITED_API) && CYTHON_COMPILING_IN_LIMITED_API)
+    PyObject *py_basicsize;
+    PyObject *py_itemsize;
 #endif
-        }
-    } else {
-        if (sizeof(long) <= sizeof(long)) {
-            return PyInt_FromLong((long) value);
-#ifdef HAVE_LONG_LONG
-        } else if (sizeof(long) <= sizeof(PY_LONG_LONG)) {
-            return PyLong_FromLongLong((PY_LONG_LONG) value);
+    result = PyObject_GetAttrString(module, class_name);
+    if (!result)
+        goto bad;
+    if (!PyType_Check(result)) {
+        PyErr_Format(PyExc_TypeError,
+            "%.200s.%.200s is not a type object",
+            module_name, class_name);
+        goto bad;
+    }
+#if !( defined(Py_LIMITED_API) || (defined(CYTHON_COMPILING_IN_LIMITED_API) && CYTHON_COMPILING_IN_LIMITED_API) )
+    basicsize = ((PyTypeObject *)result)->tp_basicsize;
+    itemsize = ((PyTypeObject *)result)->tp_itemsize;
+#else
+    if (size == 0) {
+        return (PyTypeObject *)result;
+    }
+    py_basicsize = PyObject_GetAttrString(result, "__basicsize__");
+    if (!py_basicsize)
+        goto bad;
+    basicsize = PyLong_AsSsize_t(py_basicsize);
+    Py_DECREF(py_basicsize);
+    py_basicsize = 0;
+    if (basicsize == (Py_ssize_t)-1 && PyErr_Occurred())
+        goto bad;
+    py_itemsize = PyObject_GetAttrString(result, "__itemsize__");
+    if (!py_itemsize)
+        goto bad;
+    itemsize = PyLong_AsSsize_t(py_itemsize);
+    Py_DECREF(py_itemsize);
+    py_itemsize = 0;
+    if (itemsize == (Py_ssize_t)-1 && PyErr_Occurred())
+        goto bad;
 #endif
+    if (itemsize) {
+        if (size % alignment) {
+            alignment = size % alignment;
         }
+        if (itemsize < (Py_ssize_t)alignment)
+            itemsize = (Py_ssize_t)alignment;
     }
-    {
-        int one = 1; int little = (int)*(unsigned char *)&one;
-        unsigned char *bytes = (unsigned char *)&value;
-        return _PyLong_FromByteArray(bytes, sizeof(long),
-                                     little, !is_unsigned);
+    if ((size_t)(basicsize + itemsize) < size) {
+        PyErr_Format(PyExc_ValueError,
+            "%.200s.%.200s size changed, may indicate binary incompatibility. "
+            "Expected %zd from C header, got %zd from PyObject",
+            module_name, class_name, size, basicsize+itemsize);
+        goto bad;
+    }
+    if (check_size == __Pyx_ImportType_CheckSize_Error_3_3_0 &&
+            ((size_t)basicsize > size || (size_t)(basicsize + itemsize) < size)) {
+        PyErr_Format(PyExc_ValueError,
+            "%.200s.%.200s size changed, may indicate binary incompatibility. "
+            "Expected %zd from C header, got %zd-%zd from PyObject",
+            module_name, class_name, size, basicsize, basicsize+itemsize);
+        goto bad;
+    }
+    else if (check_size == __Pyx_ImportType_CheckSize_Warn_3_3_0 && (size_t)basicsize > size) {
+        if (PyErr_WarnFormat(NULL, 0,
+                "%.200s.%.200s size changed, may indicate binary incompatibility. "
+                "Expected %zd from C header, got %zd from PyObject",
+                module_name, class_name, size, basicsize) < 0) {
+            goto bad;
+        }
     }
+    return (PyTypeObject *)result;
+bad:
+    Py_XDECREF(result);
+    return NULL;
 }
+#endif
 
-/* CIntFromPyVerify */
-#define __PYX_VERIFY_RETURN_INT(target_type, func_type, func_value)\
-    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 0)
-#define __PYX_VERIFY_RETURN_INT_EXC(target_type, func_type, func_value)\
-    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 1)
-#define __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, exc)\
-    {\
-        func_type value = func_value;\
-        if (sizeof(target_type) < sizeof(func_type)) {\
-            if (unlikely(value != (func_type) (target_type) value)) {\
-                func_type zero = 0;\
-                if (exc && unlikely(value == (func_type)-1 && PyErr_Occurred()))\
-                    return (target_type) -1;\
-                if (is_unsigned && unlikely(value < zero))\
-                    goto raise_neg_overflow;\
-                else\
-                    goto raise_overflow;\
-            }\
-        }\
-        return (target_type) value;\
+/* TupleOrListFromArrayImpl (used by ListFromArray) */
+CYTHON_UNUSED static PyObject *
+__Pyx_PyList_FromArray(PyObject *const *src, Py_ssize_t n) {
+    PyObject *res = PyList_New(n);
+    if (unlikely(res == NULL)) return NULL;
+    #if CYTHON_COMPILING_IN_CPYTHON
+    __Pyx_copy_object_array(src, ((PyListObject*)res)->ob_item, n);
+    #else
+    Py_ssize_t i;
+    for (i = 0; i < n; i++) {
+        Py_INCREF(src[i]);
+        if (unlikely(__Pyx_PyList_SET_ITEM(res, i, src[i]) < (0))) {
+            Py_DECREF(res);
+            return NULL;
+        }
     }
+    #endif
+    return res;
+}
 
-/* CIntFromPy */
-static CYTHON_INLINE long __Pyx_PyInt_As_long(PyObject *x) {
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
-#endif
-    const long neg_one = (long) -1, const_zero = (long) 0;
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic pop
-#endif
-    const int is_unsigned = neg_one > const_zero;
-#if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_Check(x))) {
-        if (sizeof(long) < sizeof(long)) {
-            __PYX_VERIFY_RETURN_INT(long, long, PyInt_AS_LONG(x))
-        } else {
-            long val = PyInt_AS_LONG(x);
-            if (is_unsigned && unlikely(val < 0)) {
-                goto raise_neg_overflow;
-            }
-            return (long) val;
+/* PyObjectCallOneArg (used by ImportImpl) */
+static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg) {
+    PyObject *args[2] = {NULL, arg};
+    return __Pyx_PyObject_FastCall(func, args+1, 1 | __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET);
+}
+
+/* ImportImpl (used by Import) */
+static int __Pyx__Import_GetModule(PyObject *qualname, PyObject **module) {
+    PyObject *imported_module = PyImport_GetModule(qualname);
+    if (unlikely(!imported_module)) {
+        *module = NULL;
+        if (PyErr_Occurred()) {
+            return -1;
         }
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (long) 0;
-                case  1: __PYX_VERIFY_RETURN_INT(long, digit, digits[0])
-                case 2:
-                    if (8 * sizeof(long) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 2 * PyLong_SHIFT) {
-                            return (long) (((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(long) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 3 * PyLong_SHIFT) {
-                            return (long) (((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(long) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) >= 4 * PyLong_SHIFT) {
-                            return (long) (((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
-                        }
-                    }
-                    break;
-            }
-#endif
-#if CYTHON_COMPILING_IN_CPYTHON
-            if (unlikely(Py_SIZE(x) < 0)) {
-                goto raise_neg_overflow;
-            }
+        return 0;
+    }
+    *module = imported_module;
+    return 1;
+}
+static int __Pyx__Import_Lookup(PyObject *qualname, PyObject *const *imported_names, Py_ssize_t len_imported_names, PyObject **module) {
+    PyObject *imported_module;
+    PyObject *top_level_package_name;
+    Py_ssize_t i;
+    int status, module_found;
+    Py_ssize_t dot_index;
+    module_found = __Pyx__Import_GetModule(qualname, &imported_module);
+    if (unlikely(!module_found || module_found == -1)) {
+        *module = NULL;
+        return module_found;
+    }
+    if (imported_names) {
+        for (i = 0; i < len_imported_names; i++) {
+            PyObject *imported_name = imported_names[i];
+#if __PYX_LIMITED_VERSION_HEX < 0x030d0000
+            int has_imported_attribute = PyObject_HasAttr(imported_module, imported_name);
 #else
-            {
-                int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
-                if (unlikely(result < 0))
-                    return (long) -1;
-                if (unlikely(result == 1))
-                    goto raise_neg_overflow;
-            }
+            int has_imported_attribute = PyObject_HasAttrWithError(imported_module, imported_name);
+            if (unlikely(has_imported_attribute == -1)) goto error;
 #endif
-            if (sizeof(long) <= sizeof(unsigned long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, unsigned long, PyLong_AsUnsignedLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(long) <= sizeof(unsigned PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
-#endif
-            }
-        } else {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (long) 0;
-                case -1: __PYX_VERIFY_RETURN_INT(long, sdigit, (sdigit) (-(sdigit)digits[0]))
-                case  1: __PYX_VERIFY_RETURN_INT(long,  digit, +digits[0])
-                case -2:
-                    if (8 * sizeof(long) - 1 > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 2:
-                    if (8 * sizeof(long) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                            return (long) ((((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case -3:
-                    if (8 * sizeof(long) - 1 > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(long) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                            return (long) ((((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case -4:
-                    if (8 * sizeof(long) - 1 > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, long, -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                            return (long) (((long)-1)*(((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(long) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(long) - 1 > 4 * PyLong_SHIFT) {
-                            return (long) ((((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
-                        }
-                    }
-                    break;
+            if (!has_imported_attribute) {
+                goto not_found;
             }
-#endif
-            if (sizeof(long) <= sizeof(long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, long, PyLong_AsLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(long) <= sizeof(PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(long, PY_LONG_LONG, PyLong_AsLongLong(x))
-#endif
+        }
+        *module = imported_module;
+        return 1;
+    }
+    dot_index = PyUnicode_FindChar(qualname, '.', 0, PY_SSIZE_T_MAX, 1);
+    if (dot_index == -1) {
+        *module = imported_module;
+        return 1;
+    }
+    if (unlikely(dot_index == -2)) goto error;
+    top_level_package_name = PyUnicode_Substring(qualname, 0, dot_index);
+    if (unlikely(!top_level_package_name)) goto error;
+    Py_DECREF(imported_module);
+    status = __Pyx__Import_GetModule(top_level_package_name, module);
+    Py_DECREF(top_level_package_name);
+    return status;
+error:
+    Py_DECREF(imported_module);
+    *module = NULL;
+    return -1;
+not_found:
+    Py_DECREF(imported_module);
+    *module = NULL;
+    return 0;
+}
+static PyObject *__Pyx__Import(PyObject *name, PyObject *const *imported_names, Py_ssize_t len_imported_names, PyObject *qualname, PyObject *moddict, int level) {
+    PyObject *module = 0;
+    PyObject *empty_dict = 0;
+    PyObject *from_list = 0;
+    int module_found;
+    if (!qualname) {
+        qualname = name;
+    }
+    module_found = __Pyx__Import_Lookup(qualname, imported_names, len_imported_names, &module);
+    if (likely(module_found == 1)) {
+        return module;
+    } else if (unlikely(module_found == -1)) {
+        return NULL;
+    }
+    #if !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030f00a6
+    empty_dict = PyFrozenDict_New(NULL);
+    #else
+    empty_dict = PyDict_New();
+    #endif
+    if (unlikely(!empty_dict))
+        goto bad;
+    if (imported_names) {
+        from_list = __Pyx_PyList_FromArray(imported_names, len_imported_names);
+        if (unlikely(!from_list))
+            goto bad;
+    }
+    if (level == -1) {
+        const char* package_sep = strchr(__Pyx_MODULE_NAME, '.');
+        if (package_sep != (0)) {
+            module = PyImport_ImportModuleLevelObject(
+                name, moddict, empty_dict, from_list, 1);
+            if (unlikely(!module)) {
+                if (unlikely(!PyErr_ExceptionMatches(PyExc_ImportError)))
+                    goto bad;
+                PyErr_Clear();
             }
         }
+        level = 0;
+    }
+    if (!module) {
+        module = PyImport_ImportModuleLevelObject(
+            name, moddict, empty_dict, from_list, level);
+    }
+bad:
+    Py_XDECREF(from_list);
+    Py_XDECREF(empty_dict);
+    return module;
+}
+
+/* Import */
+static PyObject *__Pyx_Import(PyObject *name, PyObject *const *imported_names, Py_ssize_t len_imported_names, PyObject *qualname, int level) {
+    return __Pyx__Import(name, imported_names, len_imported_names, qualname, __pyx_mstate_global->__pyx_d, level);
+}
+
+/* ImportFrom */
+static PyObject* __Pyx_ImportFrom(PyObject* module, PyObject* name) {
+    PyObject* value = __Pyx_PyObject_GetAttrStr(module, name);
+    if (unlikely(!value) && PyErr_ExceptionMatches(PyExc_AttributeError)) {
+        const char* module_name_str = 0;
+        PyObject* module_name = 0;
+        PyObject* module_dot = 0;
+        PyObject* full_name = 0;
+        PyErr_Clear();
+        module_name_str = PyModule_GetName(module);
+        if (unlikely(!module_name_str)) { goto modbad; }
+        module_name = PyUnicode_FromString(module_name_str);
+        if (unlikely(!module_name)) { goto modbad; }
+        module_dot = PyUnicode_Concat(module_name, __pyx_mstate_global->__pyx_kp_u__3);
+        if (unlikely(!module_dot)) { goto modbad; }
+        full_name = PyUnicode_Concat(module_dot, name);
+        if (unlikely(!full_name)) { goto modbad; }
+        #if (CYTHON_COMPILING_IN_PYPY && PYPY_VERSION_NUM  < 0x07030400) ||\
+                CYTHON_COMPILING_IN_GRAAL
         {
-#if CYTHON_COMPILING_IN_PYPY && !defined(_PyLong_AsByteArray)
-            PyErr_SetString(PyExc_RuntimeError,
-                            "_PyLong_AsByteArray() not available in PyPy, cannot convert large numbers");
-#else
-            long val;
-            PyObject *v = __Pyx_PyNumber_IntOrLong(x);
- #if PY_MAJOR_VERSION < 3
-            if (likely(v) && !PyLong_Check(v)) {
-                PyObject *tmp = v;
-                v = PyNumber_Long(tmp);
-                Py_DECREF(tmp);
-            }
- #endif
-            if (likely(v)) {
-                int one = 1; int is_little = (int)*(unsigned char *)&one;
-                unsigned char *bytes = (unsigned char *)&val;
-                int ret = _PyLong_AsByteArray((PyLongObject *)v,
-                                              bytes, sizeof(val),
-                                              is_little, !is_unsigned);
-                Py_DECREF(v);
-                if (likely(!ret))
-                    return val;
-            }
-#endif
-            return (long) -1;
+            PyObject *modules = PyImport_GetModuleDict();
+            if (unlikely(!modules))
+                goto modbad;
+            value = PyObject_GetItem(modules, full_name);
         }
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_IntOrLong(x);
-        if (!tmp) return (long) -1;
-        val = __Pyx_PyInt_As_long(tmp);
-        Py_DECREF(tmp);
-        return val;
+        #else
+        value = PyImport_GetModule(full_name);
+        #endif
+      modbad:
+        Py_XDECREF(full_name);
+        Py_XDECREF(module_dot);
+        Py_XDECREF(module_name);
     }
-raise_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "value too large to convert to long");
-    return (long) -1;
-raise_neg_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "can't convert negative value to long");
-    return (long) -1;
+    if (unlikely(!value)) {
+        PyErr_Format(PyExc_ImportError, "cannot import name %S", name);
+    }
+    return value;
 }
 
-/* CIntFromPy */
-static CYTHON_INLINE int __Pyx_PyInt_As_int(PyObject *x) {
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
+/* GetTopmostException (used by SaveResetException) */
+#if CYTHON_USE_EXC_INFO_STACK && CYTHON_FAST_THREAD_STATE
+static _PyErr_StackItem *
+__Pyx_PyErr_GetTopmostException(PyThreadState *tstate)
+{
+    _PyErr_StackItem *exc_info = tstate->exc_info;
+    while ((exc_info->exc_value == NULL || exc_info->exc_value == Py_None) &&
+           exc_info->previous_item != NULL)
+    {
+        exc_info = exc_info->previous_item;
+    }
+    return exc_info;
+}
 #endif
-    const int neg_one = (int) -1, const_zero = (int) 0;
-#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
-#pragma GCC diagnostic pop
+
+/* SaveResetException */
+#if CYTHON_FAST_THREAD_STATE
+static CYTHON_INLINE void __Pyx__ExceptionSave(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
+  #if CYTHON_USE_EXC_INFO_STACK && PY_VERSION_HEX >= 0x030B00a4
+    _PyErr_StackItem *exc_info = __Pyx_PyErr_GetTopmostException(tstate);
+    PyObject *exc_value = exc_info->exc_value;
+    if (exc_value == NULL || exc_value == Py_None) {
+        *value = NULL;
+        *type = NULL;
+        *tb = NULL;
+    } else {
+        *value = exc_value;
+        Py_INCREF(*value);
+        *type = (PyObject*) Py_TYPE(exc_value);
+        Py_INCREF(*type);
+        *tb = PyException_GetTraceback(exc_value);
+    }
+  #elif CYTHON_USE_EXC_INFO_STACK
+    _PyErr_StackItem *exc_info = __Pyx_PyErr_GetTopmostException(tstate);
+    *type = exc_info->exc_type;
+    *value = exc_info->exc_value;
+    *tb = exc_info->exc_traceback;
+    Py_XINCREF(*type);
+    Py_XINCREF(*value);
+    Py_XINCREF(*tb);
+  #else
+    *type = tstate->exc_type;
+    *value = tstate->exc_value;
+    *tb = tstate->exc_traceback;
+    Py_XINCREF(*type);
+    Py_XINCREF(*value);
+    Py_XINCREF(*tb);
+  #endif
+}
+static CYTHON_INLINE void __Pyx__ExceptionReset(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb) {
+  #if CYTHON_USE_EXC_INFO_STACK && PY_VERSION_HEX >= 0x030B00a4
+    _PyErr_StackItem *exc_info = tstate->exc_info;
+    PyObject *tmp_value = exc_info->exc_value;
+    exc_info->exc_value = value;
+    Py_XDECREF(tmp_value);
+    Py_XDECREF(type);
+    Py_XDECREF(tb);
+  #else
+    PyObject *tmp_type, *tmp_value, *tmp_tb;
+    #if CYTHON_USE_EXC_INFO_STACK
+    _PyErr_StackItem *exc_info = tstate->exc_info;
+    tmp_type = exc_info->exc_type;
+    tmp_value = exc_info->exc_value;
+    tmp_tb = exc_info->exc_traceback;
+    exc_info->exc_type = type;
+    exc_info->exc_value = value;
+    exc_info->exc_traceback = tb;
+    #else
+    tmp_type = tstate->exc_type;
+    tmp_value = tstate->exc_value;
+    tmp_tb = tstate->exc_traceback;
+    tstate->exc_type = type;
+    tstate->exc_value = value;
+    tstate->exc_traceback = tb;
+    #endif
+    Py_XDECREF(tmp_type);
+    Py_XDECREF(tmp_value);
+    Py_XDECREF(tmp_tb);
+  #endif
+}
 #endif
-    const int is_unsigned = neg_one > const_zero;
-#if PY_MAJOR_VERSION < 3
-    if (likely(PyInt_Check(x))) {
-        if (sizeof(int) < sizeof(long)) {
-            __PYX_VERIFY_RETURN_INT(int, long, PyInt_AS_LONG(x))
-        } else {
-            long val = PyInt_AS_LONG(x);
-            if (is_unsigned && unlikely(val < 0)) {
-                goto raise_neg_overflow;
-            }
-            return (int) val;
-        }
-    } else
+
+/* GetException */
+#if CYTHON_FAST_THREAD_STATE
+static int __Pyx__GetException(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb)
+#else
+static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb)
 #endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (int) 0;
-                case  1: __PYX_VERIFY_RETURN_INT(int, digit, digits[0])
-                case 2:
-                    if (8 * sizeof(int) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 2 * PyLong_SHIFT) {
-                            return (int) (((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(int) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 3 * PyLong_SHIFT) {
-                            return (int) (((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(int) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) >= 4 * PyLong_SHIFT) {
-                            return (int) (((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
-                        }
-                    }
-                    break;
-            }
+{
+    PyObject *local_type = NULL, *local_value, *local_tb = NULL;
+#if CYTHON_FAST_THREAD_STATE
+    PyObject *tmp_type, *tmp_value, *tmp_tb;
+  #if PY_VERSION_HEX >= 0x030C0000
+    local_value = tstate->current_exception;
+    tstate->current_exception = 0;
+  #else
+    local_type = tstate->curexc_type;
+    local_value = tstate->curexc_value;
+    local_tb = tstate->curexc_traceback;
+    tstate->curexc_type = 0;
+    tstate->curexc_value = 0;
+    tstate->curexc_traceback = 0;
+  #endif
+#elif __PYX_LIMITED_VERSION_HEX >= 0x030C0000
+    local_value = PyErr_GetRaisedException();
+#else
+    PyErr_Fetch(&local_type, &local_value, &local_tb);
 #endif
-#if CYTHON_COMPILING_IN_CPYTHON
-            if (unlikely(Py_SIZE(x) < 0)) {
-                goto raise_neg_overflow;
-            }
+#if __PYX_LIMITED_VERSION_HEX >= 0x030C0000
+    if (likely(local_value)) {
+        local_type = (PyObject*) Py_TYPE(local_value);
+        Py_INCREF(local_type);
+        local_tb = PyException_GetTraceback(local_value);
+    }
+#else
+    PyErr_NormalizeException(&local_type, &local_value, &local_tb);
+#if CYTHON_FAST_THREAD_STATE
+    if (unlikely(tstate->curexc_type))
 #else
-            {
-                int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
-                if (unlikely(result < 0))
-                    return (int) -1;
-                if (unlikely(result == 1))
-                    goto raise_neg_overflow;
-            }
+    if (unlikely(PyErr_Occurred()))
 #endif
-            if (sizeof(int) <= sizeof(unsigned long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, unsigned long, PyLong_AsUnsignedLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(int) <= sizeof(unsigned PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
-#endif
-            }
-        } else {
-#if CYTHON_USE_PYLONG_INTERNALS
-            const digit* digits = ((PyLongObject*)x)->ob_digit;
-            switch (Py_SIZE(x)) {
-                case  0: return (int) 0;
-                case -1: __PYX_VERIFY_RETURN_INT(int, sdigit, (sdigit) (-(sdigit)digits[0]))
-                case  1: __PYX_VERIFY_RETURN_INT(int,  digit, +digits[0])
-                case -2:
-                    if (8 * sizeof(int) - 1 > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 2:
-                    if (8 * sizeof(int) > 1 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 2 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                            return (int) ((((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case -3:
-                    if (8 * sizeof(int) - 1 > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 3:
-                    if (8 * sizeof(int) > 2 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 3 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                            return (int) ((((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case -4:
-                    if (8 * sizeof(int) - 1 > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, long, -(long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 4 * PyLong_SHIFT) {
-                            return (int) (((int)-1)*(((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-                case 4:
-                    if (8 * sizeof(int) > 3 * PyLong_SHIFT) {
-                        if (8 * sizeof(unsigned long) > 4 * PyLong_SHIFT) {
-                            __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
-                        } else if (8 * sizeof(int) - 1 > 4 * PyLong_SHIFT) {
-                            return (int) ((((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
-                        }
-                    }
-                    break;
-            }
+        goto bad;
+    if (local_tb) {
+        if (unlikely(PyException_SetTraceback(local_value, local_tb) < 0))
+            goto bad;
+    }
+#endif // __PYX_LIMITED_VERSION_HEX >= 0x030C0000
+    Py_XINCREF(local_tb);
+    Py_XINCREF(local_type);
+    Py_XINCREF(local_value);
+    *type = local_type;
+    *value = local_value;
+    *tb = local_tb;
+#if CYTHON_FAST_THREAD_STATE
+    #if CYTHON_USE_EXC_INFO_STACK
+    {
+        _PyErr_StackItem *exc_info = tstate->exc_info;
+      #if PY_VERSION_HEX >= 0x030B00a4
+        tmp_value = exc_info->exc_value;
+        exc_info->exc_value = local_value;
+        tmp_type = NULL;
+        tmp_tb = NULL;
+        Py_XDECREF(local_type);
+        Py_XDECREF(local_tb);
+      #else
+        tmp_type = exc_info->exc_type;
+        tmp_value = exc_info->exc_value;
+        tmp_tb = exc_info->exc_traceback;
+        exc_info->exc_type = local_type;
+        exc_info->exc_value = local_value;
+        exc_info->exc_traceback = local_tb;
+      #endif
+    }
+    #else
+    tmp_type = tstate->exc_type;
+    tmp_value = tstate->exc_value;
+    tmp_tb = tstate->exc_traceback;
+    tstate->exc_type = local_type;
+    tstate->exc_value = local_value;
+    tstate->exc_traceback = local_tb;
+    #endif
+    Py_XDECREF(tmp_type);
+    Py_XDECREF(tmp_value);
+    Py_XDECREF(tmp_tb);
+#elif __PYX_LIMITED_VERSION_HEX >= 0x030b0000
+    PyErr_SetHandledException(local_value);
+    Py_XDECREF(local_value);
+    Py_XDECREF(local_type);
+    Py_XDECREF(local_tb);
+#else
+    PyErr_SetExcInfo(local_type, local_value, local_tb);
 #endif
-            if (sizeof(int) <= sizeof(long)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, long, PyLong_AsLong(x))
-#ifdef HAVE_LONG_LONG
-            } else if (sizeof(int) <= sizeof(PY_LONG_LONG)) {
-                __PYX_VERIFY_RETURN_INT_EXC(int, PY_LONG_LONG, PyLong_AsLongLong(x))
+    return 0;
+#if __PYX_LIMITED_VERSION_HEX < 0x030C0000
+bad:
+    *type = 0;
+    *value = 0;
+    *tb = 0;
+    Py_XDECREF(local_type);
+    Py_XDECREF(local_value);
+    Py_XDECREF(local_tb);
+    return -1;
 #endif
-            }
-        }
-        {
-#if CYTHON_COMPILING_IN_PYPY && !defined(_PyLong_AsByteArray)
-            PyErr_SetString(PyExc_RuntimeError,
-                            "_PyLong_AsByteArray() not available in PyPy, cannot convert large numbers");
-#else
-            int val;
-            PyObject *v = __Pyx_PyNumber_IntOrLong(x);
- #if PY_MAJOR_VERSION < 3
-            if (likely(v) && !PyLong_Check(v)) {
-                PyObject *tmp = v;
-                v = PyNumber_Long(tmp);
-                Py_DECREF(tmp);
-            }
- #endif
-            if (likely(v)) {
-                int one = 1; int is_little = (int)*(unsigned char *)&one;
-                unsigned char *bytes = (unsigned char *)&val;
-                int ret = _PyLong_AsByteArray((PyLongObject *)v,
-                                              bytes, sizeof(val),
-                                              is_little, !is_unsigned);
-                Py_DECREF(v);
-                if (likely(!ret))
-                    return val;
-            }
+}
+
+/* dict_setdefault (used by CLineInTraceback) */
+static CYTHON_INLINE PyObject *__Pyx_PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *default_value) {
+    PyObject* value;
+#if __PYX_LIMITED_VERSION_HEX >= 0x030F0000 || (!CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030d00A4)
+    PyDict_SetDefaultRef(d, key, default_value, &value);
+#elif CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX >= 0x030C0000
+    PyObject *args[] = {d, key, default_value};
+    value = PyObject_VectorcallMethod(__pyx_mstate_global->__pyx_n_u_setdefault, args, 3 | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+#elif CYTHON_COMPILING_IN_LIMITED_API
+    value = PyObject_CallMethodObjArgs(d, __pyx_mstate_global->__pyx_n_u_setdefault, key, default_value, NULL);
+#else
+    value = PyDict_SetDefault(d, key, default_value);
+    if (unlikely(!value)) return NULL;
+    Py_INCREF(value);
 #endif
-            return (int) -1;
-        }
-    } else {
-        int val;
-        PyObject *tmp = __Pyx_PyNumber_IntOrLong(x);
-        if (!tmp) return (int) -1;
-        val = __Pyx_PyInt_As_int(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-raise_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "value too large to convert to int");
-    return (int) -1;
-raise_neg_overflow:
-    PyErr_SetString(PyExc_OverflowError,
-        "can't convert negative value to int");
-    return (int) -1;
+    return value;
 }
 
-/* FastTypeChecks */
-#if CYTHON_COMPILING_IN_CPYTHON
-static int __Pyx_InBases(PyTypeObject *a, PyTypeObject *b) {
-    while (a) {
-        a = a->tp_base;
-        if (a == b)
-            return 1;
-    }
-    return b == &PyBaseObject_Type;
+/* CLineInTraceback (used by AddTraceback) */
+#if CYTHON_CLINE_IN_TRACEBACK && CYTHON_CLINE_IN_TRACEBACK_RUNTIME
+#if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030A0000
+#define __Pyx_PyProbablyModule_GetDict(o) __Pyx_XNewRef(PyModule_GetDict(o))
+#elif !CYTHON_COMPILING_IN_CPYTHON || CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+#define __Pyx_PyProbablyModule_GetDict(o) PyObject_GenericGetDict(o, NULL);
+#else
+PyObject* __Pyx_PyProbablyModule_GetDict(PyObject *o) {
+    PyObject **dict_ptr = _PyObject_GetDictPtr(o);
+    return dict_ptr ? __Pyx_XNewRef(*dict_ptr) : NULL;
 }
-static CYTHON_INLINE int __Pyx_IsSubtype(PyTypeObject *a, PyTypeObject *b) {
-    PyObject *mro;
-    if (a == b) return 1;
-    mro = a->tp_mro;
-    if (likely(mro)) {
-        Py_ssize_t i, n;
-        n = PyTuple_GET_SIZE(mro);
-        for (i = 0; i < n; i++) {
-            if (PyTuple_GET_ITEM(mro, i) == (PyObject *)b)
-                return 1;
-        }
-        return 0;
+#endif
+static int __Pyx_CLineForTraceback(PyThreadState *tstate, int c_line) {
+    PyObject *use_cline = NULL;
+    PyObject *ptype, *pvalue, *ptraceback;
+    PyObject *cython_runtime_dict;
+    CYTHON_MAYBE_UNUSED_VAR(tstate);
+    if (unlikely(!__pyx_mstate_global->__pyx_cython_runtime)) {
+        return c_line;
     }
-    return __Pyx_InBases(a, b);
-}
-#if PY_MAJOR_VERSION == 2
-static int __Pyx_inner_PyErr_GivenExceptionMatches2(PyObject *err, PyObject* exc_type1, PyObject* exc_type2) {
-    PyObject *exception, *value, *tb;
-    int res;
-    __Pyx_PyThreadState_declare
-    __Pyx_PyThreadState_assign
-    __Pyx_ErrFetch(&exception, &value, &tb);
-    res = exc_type1 ? PyObject_IsSubclass(err, exc_type1) : 0;
-    if (unlikely(res == -1)) {
-        PyErr_WriteUnraisable(err);
-        res = 0;
-    }
-    if (!res) {
-        res = PyObject_IsSubclass(err, exc_type2);
-        if (unlikely(res == -1)) {
-            PyErr_WriteUnraisable(err);
-            res = 0;
-        }
+    __Pyx_ErrFetchInState(tstate, &ptype, &pvalue, &ptraceback);
+    cython_runtime_dict = __Pyx_PyProbablyModule_GetDict(__pyx_mstate_global->__pyx_cython_runtime);
+    if (likely(cython_runtime_dict)) {
+        __PYX_PY_DICT_LOOKUP_IF_MODIFIED(
+            use_cline, cython_runtime_dict,
+            __Pyx_PyDict_SetDefault(cython_runtime_dict, __pyx_mstate_global->__pyx_n_u_cline_in_traceback, Py_False))
     }
-    __Pyx_ErrRestore(exception, value, tb);
-    return res;
-}
-#else
-static CYTHON_INLINE int __Pyx_inner_PyErr_GivenExceptionMatches2(PyObject *err, PyObject* exc_type1, PyObject *exc_type2) {
-    int res = exc_type1 ? __Pyx_IsSubtype((PyTypeObject*)err, (PyTypeObject*)exc_type1) : 0;
-    if (!res) {
-        res = __Pyx_IsSubtype((PyTypeObject*)err, (PyTypeObject*)exc_type2);
+    if (use_cline == NULL || use_cline == Py_False || (use_cline != Py_True && PyObject_Not(use_cline) != 0)) {
+        c_line = 0;
     }
-    return res;
+    Py_XDECREF(use_cline);
+    Py_XDECREF(cython_runtime_dict);
+    __Pyx_ErrRestoreInState(tstate, ptype, pvalue, ptraceback);
+    return c_line;
 }
 #endif
-static int __Pyx_PyErr_GivenExceptionMatchesTuple(PyObject *exc_type, PyObject *tuple) {
-    Py_ssize_t i, n;
-    assert(PyExceptionClass_Check(exc_type));
-    n = PyTuple_GET_SIZE(tuple);
-#if PY_MAJOR_VERSION >= 3
-    for (i=0; i<n; i++) {
-        if (exc_type == PyTuple_GET_ITEM(tuple, i)) return 1;
+
+/* CodeObjectCache (used by AddTraceback) */
+static int __pyx_bisect_code_objects(__Pyx_CodeObjectCacheEntry* entries, int count, int code_line) {
+    int start = 0, mid = 0, end = count - 1;
+    if (end >= 0 && code_line > entries[end].code_line) {
+        return count;
     }
-#endif
-    for (i=0; i<n; i++) {
-        PyObject *t = PyTuple_GET_ITEM(tuple, i);
-        #if PY_MAJOR_VERSION < 3
-        if (likely(exc_type == t)) return 1;
-        #endif
-        if (likely(PyExceptionClass_Check(t))) {
-            if (__Pyx_inner_PyErr_GivenExceptionMatches2(exc_type, NULL, t)) return 1;
+    while (start < end) {
+        mid = start + (end - start) / 2;
+        if (code_line < entries[mid].code_line) {
+            end = mid;
+        } else if (code_line > entries[mid].code_line) {
+             start = mid + 1;
         } else {
+            return mid;
         }
     }
-    return 0;
-}
-static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches(PyObject *err, PyObject* exc_type) {
-    if (likely(err == exc_type)) return 1;
-    if (likely(PyExceptionClass_Check(err))) {
-        if (likely(PyExceptionClass_Check(exc_type))) {
-            return __Pyx_inner_PyErr_GivenExceptionMatches2(err, NULL, exc_type);
-        } else if (likely(PyTuple_Check(exc_type))) {
-            return __Pyx_PyErr_GivenExceptionMatchesTuple(err, exc_type);
-        } else {
-        }
+    if (code_line <= entries[mid].code_line) {
+        return mid;
+    } else {
+        return mid + 1;
     }
-    return PyErr_GivenExceptionMatches(err, exc_type);
 }
-static CYTHON_INLINE int __Pyx_PyErr_GivenExceptionMatches2(PyObject *err, PyObject *exc_type1, PyObject *exc_type2) {
-    assert(PyExceptionClass_Check(exc_type1));
-    assert(PyExceptionClass_Check(exc_type2));
-    if (likely(err == exc_type1 || err == exc_type2)) return 1;
-    if (likely(PyExceptionClass_Check(err))) {
-        return __Pyx_inner_PyErr_GivenExceptionMatches2(err, exc_type1, exc_type2);
+static __Pyx_CachedCodeObjectType *__pyx__find_code_object(struct __Pyx_CodeObjectCache *code_cache, int code_line) {
+    __Pyx_CachedCodeObjectType* code_object;
+    int pos;
+    if (unlikely(!code_line) || unlikely(!code_cache->entries)) {
+        return NULL;
     }
-    return (PyErr_GivenExceptionMatches(err, exc_type1) || PyErr_GivenExceptionMatches(err, exc_type2));
-}
-#endif
-
-/* FetchCommonType */
-static PyTypeObject* __Pyx_FetchCommonType(PyTypeObject* type) {
-    PyObject* fake_module;
-    PyTypeObject* cached_type = NULL;
-    fake_module = PyImport_AddModule((char*) "_cython_" CYTHON_ABI);
-    if (!fake_module) return NULL;
-    Py_INCREF(fake_module);
-    cached_type = (PyTypeObject*) PyObject_GetAttrString(fake_module, type->tp_name);
-    if (cached_type) {
-        if (!PyType_Check((PyObject*)cached_type)) {
-            PyErr_Format(PyExc_TypeError,
-                "Shared Cython type %.200s is not a type object",
-                type->tp_name);
-            goto bad;
-        }
-        if (cached_type->tp_basicsize != type->tp_basicsize) {
-            PyErr_Format(PyExc_TypeError,
-                "Shared Cython type %.200s has the wrong size, try recompiling",
-                type->tp_name);
-            goto bad;
-        }
-    } else {
-        if (!PyErr_ExceptionMatches(PyExc_AttributeError)) goto bad;
-        PyErr_Clear();
-        if (PyType_Ready(type) < 0) goto bad;
-        if (PyObject_SetAttrString(fake_module, type->tp_name, (PyObject*) type) < 0)
-            goto bad;
-        Py_INCREF(type);
-        cached_type = type;
+    pos = __pyx_bisect_code_objects(code_cache->entries, code_cache->count, code_line);
+    if (unlikely(pos >= code_cache->count) || unlikely(code_cache->entries[pos].code_line != code_line)) {
+        return NULL;
     }
-done:
-    Py_DECREF(fake_module);
-    return cached_type;
-bad:
-    Py_XDECREF(cached_type);
-    cached_type = NULL;
-    goto done;
+    code_object = code_cache->entries[pos].code_object;
+    Py_INCREF(code_object);
+    return code_object;
 }
-
-/* RaiseException */
-#if PY_MAJOR_VERSION < 3
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb,
-                        CYTHON_UNUSED PyObject *cause) {
-    __Pyx_PyThreadState_declare
-    Py_XINCREF(type);
-    if (!value || value == Py_None)
-        value = NULL;
-    else
-        Py_INCREF(value);
-    if (!tb || tb == Py_None)
-        tb = NULL;
-    else {
-        Py_INCREF(tb);
-        if (!PyTraceBack_Check(tb)) {
-            PyErr_SetString(PyExc_TypeError,
-                "raise: arg 3 must be a traceback or None");
-            goto raise_error;
-        }
+static __Pyx_CachedCodeObjectType *__pyx_find_code_object(int code_line) {
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && !CYTHON_ATOMICS
+    (void)__pyx__find_code_object;
+    return NULL; // Most implementation should have atomics. But otherwise, don't make it thread-safe, just miss.
+#else
+    struct __Pyx_CodeObjectCache *code_cache = &__pyx_mstate_global->__pyx_code_cache;
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_nonatomic_int_type old_count = __pyx_atomic_incr_acq_rel(&code_cache->accessor_count);
+    if (old_count < 0) {
+        __pyx_atomic_decr_acq_rel(&code_cache->accessor_count);
+        return NULL;
     }
-    if (PyType_Check(type)) {
-#if CYTHON_COMPILING_IN_PYPY
-        if (!value) {
-            Py_INCREF(Py_None);
-            value = Py_None;
-        }
 #endif
-        PyErr_NormalizeException(&type, &value, &tb);
-    } else {
-        if (value) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
+    __Pyx_CachedCodeObjectType *result = __pyx__find_code_object(code_cache, code_line);
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_atomic_decr_acq_rel(&code_cache->accessor_count);
+#endif
+    return result;
+#endif
+}
+static void __pyx__insert_code_object(struct __Pyx_CodeObjectCache *code_cache, int code_line, __Pyx_CachedCodeObjectType* code_object)
+{
+    int pos, i;
+    __Pyx_CodeObjectCacheEntry* entries = code_cache->entries;
+    if (unlikely(!code_line)) {
+        return;
+    }
+    if (unlikely(!entries)) {
+        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Malloc(64*sizeof(__Pyx_CodeObjectCacheEntry));
+        if (likely(entries)) {
+            code_cache->entries = entries;
+            code_cache->max_count = 64;
+            code_cache->count = 1;
+            entries[0].code_line = code_line;
+            entries[0].code_object = code_object;
+            Py_INCREF(code_object);
         }
-        value = type;
-        type = (PyObject*) Py_TYPE(type);
-        Py_INCREF(type);
-        if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-            PyErr_SetString(PyExc_TypeError,
-                "raise: exception class must be a subclass of BaseException");
-            goto raise_error;
+        return;
+    }
+    pos = __pyx_bisect_code_objects(code_cache->entries, code_cache->count, code_line);
+    if ((pos < code_cache->count) && unlikely(code_cache->entries[pos].code_line == code_line)) {
+        __Pyx_CachedCodeObjectType* tmp = entries[pos].code_object;
+        entries[pos].code_object = code_object;
+        Py_INCREF(code_object);
+        Py_DECREF(tmp);
+        return;
+    }
+    if (code_cache->count == code_cache->max_count) {
+        int new_max = code_cache->max_count + 64;
+        entries = (__Pyx_CodeObjectCacheEntry*)PyMem_Realloc(
+            code_cache->entries, ((size_t)new_max) * sizeof(__Pyx_CodeObjectCacheEntry));
+        if (unlikely(!entries)) {
+            return;
         }
+        code_cache->entries = entries;
+        code_cache->max_count = new_max;
     }
-    __Pyx_PyThreadState_assign
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
+    for (i=code_cache->count; i>pos; i--) {
+        entries[i] = entries[i-1];
+    }
+    entries[pos].code_line = code_line;
+    entries[pos].code_object = code_object;
+    code_cache->count++;
+    Py_INCREF(code_object);
 }
+static void __pyx_insert_code_object(int code_line, __Pyx_CachedCodeObjectType* code_object) {
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && !CYTHON_ATOMICS
+    (void)__pyx__insert_code_object;
+    return; // Most implementation should have atomics. But otherwise, don't make it thread-safe, just fail.
 #else
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb, PyObject *cause) {
-    PyObject* owned_instance = NULL;
-    if (tb == Py_None) {
-        tb = 0;
-    } else if (tb && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto bad;
+    struct __Pyx_CodeObjectCache *code_cache = &__pyx_mstate_global->__pyx_code_cache;
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_nonatomic_int_type expected = 0;
+    if (!__pyx_atomic_int_cmp_exchange(&code_cache->accessor_count, &expected, INT_MIN)) {
+        return;
     }
-    if (value == Py_None)
-        value = 0;
-    if (PyExceptionInstance_Check(type)) {
-        if (value) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto bad;
-        }
-        value = type;
-        type = (PyObject*) Py_TYPE(value);
-    } else if (PyExceptionClass_Check(type)) {
-        PyObject *instance_class = NULL;
-        if (value && PyExceptionInstance_Check(value)) {
-            instance_class = (PyObject*) Py_TYPE(value);
-            if (instance_class != type) {
-                int is_subclass = PyObject_IsSubclass(instance_class, type);
-                if (!is_subclass) {
-                    instance_class = NULL;
-                } else if (unlikely(is_subclass == -1)) {
-                    goto bad;
-                } else {
-                    type = instance_class;
-                }
-            }
+#endif
+    __pyx__insert_code_object(code_cache, code_line, code_object);
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING
+    __pyx_atomic_sub(&code_cache->accessor_count, INT_MIN);
+#endif
+#endif
+}
+
+/* AddTraceback */
+#include "compile.h"
+#include "frameobject.h"
+#include "traceback.h"
+#if PY_VERSION_HEX >= 0x030b00a6 && !CYTHON_COMPILING_IN_LIMITED_API && !defined(PYPY_VERSION)
+  #ifndef Py_BUILD_CORE
+    #define Py_BUILD_CORE 1
+  #endif
+  #include "internal/pycore_frame.h"
+#endif
+#if CYTHON_COMPILING_IN_LIMITED_API
+static PyObject *__Pyx_PyCode_Replace_For_AddTraceback(PyObject *code, PyObject *scratch_dict,
+                                                       PyObject *firstlineno, PyObject *name) {
+    PyObject *replace = NULL;
+    if (unlikely(PyDict_SetItemString(scratch_dict, "co_firstlineno", firstlineno))) return NULL;
+    if (unlikely(PyDict_SetItemString(scratch_dict, "co_name", name))) return NULL;
+    replace = PyObject_GetAttrString(code, "replace");
+    if (likely(replace)) {
+        PyObject *result = PyObject_Call(replace, __pyx_mstate_global->__pyx_empty_tuple, scratch_dict);
+        Py_DECREF(replace);
+        return result;
+    }
+    return NULL;
+}
+static void __Pyx_AddTraceback(const char *funcname, int c_line,
+                               int py_line, const char *filename) {
+    PyObject *code_object = NULL, *py_py_line = NULL, *py_funcname = NULL, *dict = NULL;
+    PyObject *replace = NULL, *getframe = NULL, *frame = NULL;
+    PyObject *exc_type, *exc_value, *exc_traceback;
+    int success = 0;
+    if (c_line) {
+        c_line = __Pyx_CLineForTraceback(__Pyx_PyThreadState_Current, c_line);
+    }
+    __Pyx_PyErr_FetchException(&exc_type, &exc_value, &exc_traceback);
+    code_object = __pyx_find_code_object(c_line ? -c_line : py_line);
+    if (!code_object) {
+        code_object = Py_CompileString("_getframe()", filename, Py_eval_input);
+        if (unlikely(!code_object)) goto bad;
+        py_py_line = PyLong_FromLong(py_line);
+        if (unlikely(!py_py_line)) goto bad;
+        if (c_line) {
+            py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
+        } else {
+            py_funcname = PyUnicode_FromString(funcname);
         }
-        if (!instance_class) {
-            PyObject *args;
-            if (!value)
-                args = PyTuple_New(0);
-            else if (PyTuple_Check(value)) {
-                Py_INCREF(value);
-                args = value;
-            } else
-                args = PyTuple_Pack(1, value);
-            if (!args)
-                goto bad;
-            owned_instance = PyObject_Call(type, args, NULL);
-            Py_DECREF(args);
-            if (!owned_instance)
-                goto bad;
-            value = owned_instance;
-            if (!PyExceptionInstance_Check(value)) {
-                PyErr_Format(PyExc_TypeError,
-                             "calling %R should have returned an instance of "
-                             "BaseException, not %R",
-                             type, Py_TYPE(value));
-                goto bad;
-            }
+        if (unlikely(!py_funcname)) goto bad;
+        dict = PyDict_New();
+        if (unlikely(!dict)) goto bad;
+        {
+            PyObject *old_code_object = code_object;
+            code_object = __Pyx_PyCode_Replace_For_AddTraceback(code_object, dict, py_py_line, py_funcname);
+            Py_DECREF(old_code_object);
         }
+        if (unlikely(!code_object)) goto bad;
+        __pyx_insert_code_object(c_line ? -c_line : py_line, code_object);
     } else {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: exception class must be a subclass of BaseException");
-        goto bad;
+        dict = PyDict_New();
     }
-    if (cause) {
-        PyObject *fixed_cause;
-        if (cause == Py_None) {
-            fixed_cause = NULL;
-        } else if (PyExceptionClass_Check(cause)) {
-            fixed_cause = PyObject_CallObject(cause, NULL);
-            if (fixed_cause == NULL)
-                goto bad;
-        } else if (PyExceptionInstance_Check(cause)) {
-            fixed_cause = cause;
-            Py_INCREF(fixed_cause);
-        } else {
-            PyErr_SetString(PyExc_TypeError,
-                            "exception causes must derive from "
-                            "BaseException");
-            goto bad;
-        }
-        PyException_SetCause(value, fixed_cause);
+    getframe = PySys_GetObject("_getframe");
+    if (unlikely(!getframe)) goto bad;
+    if (unlikely(PyDict_SetItemString(dict, "_getframe", getframe))) goto bad;
+    frame = PyEval_EvalCode(code_object, dict, dict);
+    if (unlikely(!frame) || frame == Py_None) goto bad;
+    success = 1;
+  bad:
+    __Pyx_PyErr_RestoreException(exc_type, exc_value, exc_traceback);
+    Py_XDECREF(code_object);
+    Py_XDECREF(py_py_line);
+    Py_XDECREF(py_funcname);
+    Py_XDECREF(dict);
+    Py_XDECREF(replace);
+    if (success) {
+        PyTraceBack_Here(
+            (struct _frame*)frame);
     }
-    PyErr_SetObject(type, value);
-    if (tb) {
-#if CYTHON_COMPILING_IN_PYPY
-        PyObject *tmp_type, *tmp_value, *tmp_tb;
-        PyErr_Fetch(&tmp_type, &tmp_value, &tmp_tb);
-        Py_INCREF(tb);
-        PyErr_Restore(tmp_type, tmp_value, tb);
-        Py_XDECREF(tmp_tb);
+    Py_XDECREF(frame);
+}
 #else
-        PyThreadState *tstate = __Pyx_PyThreadState_Current;
-        PyObject* tmp_tb = tstate->curexc_traceback;
-        if (tb != tmp_tb) {
-            Py_INCREF(tb);
-            tstate->curexc_traceback = tb;
-            Py_XDECREF(tmp_tb);
+static PyCodeObject* __Pyx_CreateCodeObjectForTraceback(
+            const char *funcname, int c_line,
+            int py_line, const char *filename) {
+    PyCodeObject *py_code = NULL;
+    PyObject *py_funcname = NULL;
+    if (c_line) {
+        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, c_line);
+        if (!py_funcname) goto bad;
+        funcname = PyUnicode_AsUTF8(py_funcname);
+        if (!funcname) goto bad;
+    }
+    py_code = PyCode_NewEmpty(filename, funcname, py_line);
+    Py_XDECREF(py_funcname);
+    return py_code;
+bad:
+    Py_XDECREF(py_funcname);
+    return NULL;
+}
+static void __Pyx_AddTraceback(const char *funcname, int c_line,
+                               int py_line, const char *filename) {
+    PyCodeObject *py_code = 0;
+    PyFrameObject *py_frame = 0;
+    PyThreadState *tstate = __Pyx_PyThreadState_Current;
+    PyObject *ptype, *pvalue, *ptraceback;
+    if (c_line) {
+        c_line = __Pyx_CLineForTraceback(tstate, c_line);
+    }
+    py_code = __pyx_find_code_object(c_line ? -c_line : py_line);
+    if (!py_code) {
+        __Pyx_ErrFetchInState(tstate, &ptype, &pvalue, &ptraceback);
+        py_code = __Pyx_CreateCodeObjectForTraceback(
+            funcname, c_line, py_line, filename);
+        if (!py_code) {
+            /* If the code object creation fails, then we should clear the
+               fetched exception references and propagate the new exception */
+            Py_XDECREF(ptype);
+            Py_XDECREF(pvalue);
+            Py_XDECREF(ptraceback);
+            goto bad;
         }
-#endif
+        __Pyx_ErrRestoreInState(tstate, ptype, pvalue, ptraceback);
+        __pyx_insert_code_object(c_line ? -c_line : py_line, py_code);
     }
+    py_frame = PyFrame_New(
+        tstate,            /*PyThreadState *tstate,*/
+        py_code,           /*PyCodeObject *code,*/
+        __pyx_mstate_global->__pyx_d,    /*PyObject *globals,*/
+        0                  /*PyObject *locals*/
+    );
+    if (!py_frame) goto bad;
+    __Pyx_PyFrame_SetLineNumber(py_frame, py_line);
+    PyTraceBack_Here(py_frame);
 bad:
-    Py_XDECREF(owned_instance);
-    return;
+    Py_XDECREF(py_code);
+    Py_XDECREF(py_frame);
 }
 #endif
 
-/* GetTopmostException */
-#if CYTHON_USE_EXC_INFO_STACK
-static _PyErr_StackItem *
-__Pyx_PyErr_GetTopmostException(PyThreadState *tstate)
-{
-    _PyErr_StackItem *exc_info = tstate->exc_info;
-    while ((exc_info->exc_type == NULL || exc_info->exc_type == Py_None) &&
-           exc_info->previous_item != NULL)
-    {
-        exc_info = exc_info->previous_item;
+/* CIntFromPyVerify */
+#define __PYX_VERIFY_RETURN_INT(target_type, func_type, func_value)\
+    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 0)
+#define __PYX_VERIFY_RETURN_INT_EXC(target_type, func_type, func_value)\
+    __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, 1)
+#define __PYX__VERIFY_RETURN_INT(target_type, func_type, func_value, exc)\
+    {\
+        func_type value = func_value;\
+        if (sizeof(target_type) < sizeof(func_type)) {\
+            if (unlikely(value != (func_type) (target_type) value)) {\
+                func_type zero = 0;\
+                if (exc && unlikely(value == (func_type)-1 && PyErr_Occurred()))\
+                    return (target_type) -1;\
+                if (is_unsigned && unlikely(value < zero))\
+                    goto raise_neg_overflow;\
+                else\
+                    goto raise_overflow;\
+            }\
+        }\
+        return (target_type) value;\
     }
-    return exc_info;
-}
-#endif
 
-/* SaveResetException */
-#if CYTHON_FAST_THREAD_STATE
-static CYTHON_INLINE void __Pyx__ExceptionSave(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
-    #if CYTHON_USE_EXC_INFO_STACK
-    _PyErr_StackItem *exc_info = __Pyx_PyErr_GetTopmostException(tstate);
-    *type = exc_info->exc_type;
-    *value = exc_info->exc_value;
-    *tb = exc_info->exc_traceback;
-    #else
-    *type = tstate->exc_type;
-    *value = tstate->exc_value;
-    *tb = tstate->exc_traceback;
-    #endif
-    Py_XINCREF(*type);
-    Py_XINCREF(*value);
-    Py_XINCREF(*tb);
-}
-static CYTHON_INLINE void __Pyx__ExceptionReset(PyThreadState *tstate, PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    #if CYTHON_USE_EXC_INFO_STACK
-    _PyErr_StackItem *exc_info = tstate->exc_info;
-    tmp_type = exc_info->exc_type;
-    tmp_value = exc_info->exc_value;
-    tmp_tb = exc_info->exc_traceback;
-    exc_info->exc_type = type;
-    exc_info->exc_value = value;
-    exc_info->exc_traceback = tb;
-    #else
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = type;
-    tstate->exc_value = value;
-    tstate->exc_traceback = tb;
-    #endif
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
+/* PyObjectVectorcallKwds (used by PyObjectVectorcallMethodKwds) */
+#if CYTHON_VECTORCALL
+CYTHON_UNUSED static int __Pyx_CheckVectorcallKwarg(PyObject *kwnames, Py_ssize_t i) {
+    PyObject *key = __Pyx_PyTuple_GET_ITEM(kwnames, i);
+#if !CYTHON_ASSUME_SAFE_MACROS
+    if (unlikely(!key)) return -1;
 #endif
-
-/* SwapException */
-#if CYTHON_FAST_THREAD_STATE
-static CYTHON_INLINE void __Pyx__ExceptionSwap(PyThreadState *tstate, PyObject **type, PyObject **value, PyObject **tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    #if CYTHON_USE_EXC_INFO_STACK
-    _PyErr_StackItem *exc_info = tstate->exc_info;
-    tmp_type = exc_info->exc_type;
-    tmp_value = exc_info->exc_value;
-    tmp_tb = exc_info->exc_traceback;
-    exc_info->exc_type = *type;
-    exc_info->exc_value = *value;
-    exc_info->exc_traceback = *tb;
-    #else
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = *type;
-    tstate->exc_value = *value;
-    tstate->exc_traceback = *tb;
-    #endif
-    *type = tmp_type;
-    *value = tmp_value;
-    *tb = tmp_tb;
+    if (unlikely(!PyUnicode_Check(key))) {
+        PyErr_SetString(PyExc_TypeError, "keywords must be strings");
+        return -1;
+    }
+    return 0;
 }
 #else
-static CYTHON_INLINE void __Pyx_ExceptionSwap(PyObject **type, PyObject **value, PyObject **tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyErr_GetExcInfo(&tmp_type, &tmp_value, &tmp_tb);
-    PyErr_SetExcInfo(*type, *value, *tb);
-    *type = tmp_type;
-    *value = tmp_value;
-    *tb = tmp_tb;
+CYTHON_UNUSED static PyObject *__Pyx_MakeKwargDict(PyObject **keys, PyObject **values, Py_ssize_t n) {
+    PyObject *out = PyDict_New();
+    if (unlikely(!out)) return NULL;
+    for (Py_ssize_t i=0; i<n; ++i) {
+        if (unlikely(PyDict_SetItem(out, keys[i], values[i]) < 0)) {
+            Py_DECREF(out);
+            return NULL;
+        }
+    }
+    return out;
+}
+CYTHON_UNUSED static int __Pyx_CheckVectorcallKwarg(PyObject **kwnames, Py_ssize_t i) {
+    PyObject *key = kwnames[i];
+    if (unlikely(!PyUnicode_Check(key))) {
+        PyErr_SetString(PyExc_TypeError, "keywords must be strings");
+        return -1;
+    }
+    return 0;
 }
 #endif
 
-/* PyObjectCall2Args */
-static CYTHON_UNUSED PyObject* __Pyx_PyObject_Call2Args(PyObject* function, PyObject* arg1, PyObject* arg2) {
-    PyObject *args, *result = NULL;
-    #if CYTHON_FAST_PYCALL
-    if (PyFunction_Check(function)) {
-        PyObject *args[2] = {arg1, arg2};
-        return __Pyx_PyFunction_FastCall(function, args, 2);
-    }
-    #endif
-    #if CYTHON_FAST_PYCCALL
-    if (__Pyx_PyFastCFunction_Check(function)) {
-        PyObject *args[2] = {arg1, arg2};
-        return __Pyx_PyCFunction_FastCall(function, args, 2);
-    }
-    #endif
-    args = PyTuple_New(2);
-    if (unlikely(!args)) goto done;
-    Py_INCREF(arg1);
-    PyTuple_SET_ITEM(args, 0, arg1);
-    Py_INCREF(arg2);
-    PyTuple_SET_ITEM(args, 1, arg2);
-    Py_INCREF(function);
-    result = __Pyx_PyObject_Call(function, args, NULL);
-    Py_DECREF(args);
-    Py_DECREF(function);
-done:
+/* PyObjectVectorcallMethodKwds (used by CIntToPy) */
+#if !CYTHON_VECTORCALL
+static PyObject *__Pyx_Object_VectorcallMethodKwds(PyObject *name, PyObject *const *args, size_t nargsf, PyObject *kwnames) {
+    PyObject *result;
+    PyObject *obj = PyObject_GetAttr(args[0], name);
+    if (unlikely(!obj))
+        return NULL;
+    result = __Pyx_Object_VectorcallKwds(obj, args+1, nargsf-1, kwnames);
+    Py_DECREF(obj);
     return result;
 }
+#endif
 
-/* PyObjectCallMethO */
-#if CYTHON_COMPILING_IN_CPYTHON
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallMethO(PyObject *func, PyObject *arg) {
-    PyObject *self, *result;
-    PyCFunction cfunc;
-    cfunc = PyCFunction_GET_FUNCTION(func);
-    self = PyCFunction_GET_SELF(func);
-    if (unlikely(Py_EnterRecursiveCall((char*)" while calling a Python object")))
-        return NULL;
-    result = cfunc(self, arg);
-    Py_LeaveRecursiveCall();
-    if (unlikely(!result) && unlikely(!PyErr_Occurred())) {
-        PyErr_SetString(
-            PyExc_SystemError,
-            "NULL result without error in PyObject_Call");
+/* CIntToPy */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_long(long value) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+    const long neg_one = (long) -1, const_zero = (long) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        if (sizeof(long) < sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(long) <= sizeof(unsigned long)) {
+            return PyLong_FromUnsignedLong((unsigned long) value);
+#if !CYTHON_COMPILING_IN_PYPY
+        } else if (sizeof(long) <= sizeof(unsigned PY_LONG_LONG)) {
+            return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG) value);
+#endif
+        }
+    } else {
+        if (sizeof(long) <= sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(long) <= sizeof(PY_LONG_LONG)) {
+            return PyLong_FromLongLong((PY_LONG_LONG) value);
+        }
+    }
+    {
+        unsigned char *bytes = (unsigned char *)&value;
+#if !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030d00A4
+        if (is_unsigned) {
+            return PyLong_FromUnsignedNativeBytes(bytes, sizeof(value), -1);
+        } else {
+            return PyLong_FromNativeBytes(bytes, sizeof(value), -1);
+        }
+#elif !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX < 0x030d0000
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        return _PyLong_FromByteArray(bytes, sizeof(long),
+                                     little, !is_unsigned);
+#else
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        PyObject *result = NULL, *kwds = NULL;
+        PyObject *py_bytes = NULL, *order_str = NULL, *from_bytes_str = NULL;;
+        py_bytes = PyBytes_FromStringAndSize((char*)bytes, sizeof(long));
+        if (!py_bytes) goto limited_bad;
+        from_bytes_str = PyUnicode_FromStringAndSize("from_bytes", 10);
+        if (!from_bytes_str) goto limited_bad;
+        order_str = PyUnicode_FromString(little ? "little" : "big");
+        if (!order_str) goto limited_bad;
+        {
+            PyObject *args[] = { (PyObject*)&PyLong_Type, py_bytes, order_str, Py_True };
+            if (!is_unsigned) {
+                PyObject *signed_str = PyUnicode_FromStringAndSize("signed", 6);
+                if (!signed_str) goto limited_bad;
+#if CYTHON_VECTORCALL
+                kwds = PyTuple_Pack(1, signed_str);
+#else
+                {
+                    PyObject *keys[] = {signed_str};
+                    PyObject *values[] = {Py_True};
+                    kwds = __Pyx_MakeKwargDict(keys, values, 1);
+                }
+#endif
+                Py_DECREF(signed_str);
+                if (unlikely(!kwds)) goto limited_bad;
+            }
+            result = __Pyx_Object_VectorcallMethodKwds(from_bytes_str, args, 3 | __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET, kwds);
+        }
+        limited_bad:
+        Py_XDECREF(kwds);
+        Py_XDECREF(order_str);
+        Py_XDECREF(py_bytes);
+        Py_XDECREF(from_bytes_str);
+        return result;
+#endif
     }
-    return result;
 }
-#endif
 
-/* PyObjectCallOneArg */
-#if CYTHON_COMPILING_IN_CPYTHON
-static PyObject* __Pyx__PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-    PyObject *result;
-    PyObject *args = PyTuple_New(1);
-    if (unlikely(!args)) return NULL;
-    Py_INCREF(arg);
-    PyTuple_SET_ITEM(args, 0, arg);
-    result = __Pyx_PyObject_Call(func, args, NULL);
-    Py_DECREF(args);
-    return result;
+/* CIntFromPy */
+static size_t __Pyx_LargePyLong___Pyx_PyLong_As_size_t(PyObject *x);
+static size_t __Pyx_raise_neg_overflow___Pyx_PyLong_As_size_t(void) {
+    const char* type_name = "size_t";
+    PyErr_Format(PyExc_OverflowError,
+        "can't convert negative value to %.200s", type_name);
+    return (size_t) -1;
 }
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-#if CYTHON_FAST_PYCALL
-    if (PyFunction_Check(func)) {
-        return __Pyx_PyFunction_FastCall(func, &arg, 1);
+static size_t __Pyx_raise_overflow___Pyx_PyLong_As_size_t(void) {
+    const char* type_name = "size_t";
+    PyErr_Format(PyExc_OverflowError,
+        "value too large to convert to %.200s", type_name);
+    return (size_t) -1;
+}
+static CYTHON_INLINE size_t __Pyx_PyULong___Pyx_PyLong_As_size_t(PyObject *x) {
+    const int is_unsigned = 1;
+#if CYTHON_USE_PYLONG_INTERNALS
+    {
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        if (size == 2 && (8 * sizeof(size_t) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) >= 2 * PyLong_SHIFT)) {
+                return (size_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(size_t) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) >= 3 * PyLong_SHIFT)) {
+                return (size_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(size_t) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) >= 4 * PyLong_SHIFT)) {
+                return (size_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        {}
     }
-#endif
-    if (likely(PyCFunction_Check(func))) {
-        if (likely(PyCFunction_GET_FLAGS(func) & METH_O)) {
-            return __Pyx_PyObject_CallMethO(func, arg);
-#if CYTHON_FAST_PYCCALL
-        } else if (__Pyx_PyFastCFunction_Check(func)) {
-            return __Pyx_PyCFunction_FastCall(func, &arg, 1);
-#endif
-        }
+#elif CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX < 0x030C00A7
+    if (unlikely(Py_SIZE(x) < 0)) {
+        goto raise_neg_overflow;
     }
-    return __Pyx__PyObject_CallOneArg(func, arg);
-}
 #else
-static CYTHON_INLINE PyObject* __Pyx_PyObject_CallOneArg(PyObject *func, PyObject *arg) {
-    PyObject *result;
-    PyObject *args = PyTuple_Pack(1, arg);
-    if (unlikely(!args)) return NULL;
-    result = __Pyx_PyObject_Call(func, args, NULL);
-    Py_DECREF(args);
-    return result;
+    {
+        int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
+        if (unlikely(result < 0))
+            return (size_t) -1;
+        if (unlikely(result == 1))
+            goto raise_neg_overflow;
+    }
+#endif
+    if ((sizeof(size_t) <= sizeof(unsigned long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(size_t, unsigned long, PyLong_AsUnsignedLong(x))
+    } else if ((sizeof(size_t) <= sizeof(unsigned PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(size_t, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
+    }
+    return __Pyx_LargePyLong___Pyx_PyLong_As_size_t(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_size_t();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_size_t();
 }
+static CYTHON_INLINE size_t __Pyx_PySLong___Pyx_PyLong_As_size_t(PyObject *x) {
+    const int is_unsigned = 0;
+#if CYTHON_USE_PYLONG_INTERNALS
+    if (__Pyx_PyLong_IsNeg(x)) {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(size_t) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                long ival = - (long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(size_t, long, ival)
+            } else if ((8 * sizeof(size_t) - 1 > 2 * PyLong_SHIFT)) {
+                return (size_t) (((size_t) -1) * (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0])));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(size_t) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(size_t, long, ival)
+            } else if ((8 * sizeof(size_t) - 1 > 3 * PyLong_SHIFT)) {
+                return (size_t) (((size_t) -1) * (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0])));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(size_t) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(size_t, long, ival)
+            } else if ((8 * sizeof(size_t) - 1 > 4 * PyLong_SHIFT)) {
+                return (size_t) (((size_t) -1) * (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0])));
+            }
+        } else
+        {}
+    } else {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(size_t) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) - 1 > 2 * PyLong_SHIFT)) {
+                return (size_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(size_t) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) - 1 > 3 * PyLong_SHIFT)) {
+                return (size_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(size_t) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(size_t, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(size_t) - 1 > 4 * PyLong_SHIFT)) {
+                return (size_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+            }
+        } else
+        {}
+    }
 #endif
-
-/* PyObjectGetMethod */
-static int __Pyx_PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method) {
-    PyObject *attr;
-#if CYTHON_UNPACK_METHODS && CYTHON_COMPILING_IN_CPYTHON && CYTHON_USE_PYTYPE_LOOKUP
-    PyTypeObject *tp = Py_TYPE(obj);
-    PyObject *descr;
-    descrgetfunc f = NULL;
-    PyObject **dictptr, *dict;
-    int meth_found = 0;
-    assert (*method == NULL);
-    if (unlikely(tp->tp_getattro != PyObject_GenericGetAttr)) {
-        attr = __Pyx_PyObject_GetAttrStr(obj, name);
-        goto try_unpack;
+    #if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+    if ((sizeof(size_t) <= sizeof(int)) && (sizeof(int) < sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(size_t, int, PyLong_AsInt(x))
+    } else
+    #endif
+    if ((sizeof(size_t) <= sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(size_t, long, PyLong_AsLong(x))
+    } else if ((sizeof(size_t) <= sizeof(PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(size_t, PY_LONG_LONG, PyLong_AsLongLong(x))
     }
-    if (unlikely(tp->tp_dict == NULL) && unlikely(PyType_Ready(tp) < 0)) {
-        return 0;
+    return __Pyx_LargePyLong___Pyx_PyLong_As_size_t(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_size_t();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_size_t();
+}
+static size_t __Pyx_LargePyLong___Pyx_PyLong_As_size_t(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+    const size_t neg_one = (size_t) -1, const_zero = (size_t) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    size_t val;
+    int ret = -1;
+#if PY_VERSION_HEX >= 0x030d00A6 && !CYTHON_COMPILING_IN_LIMITED_API
+    Py_ssize_t bytes_copied = PyLong_AsNativeBytes(
+        x, &val, sizeof(val), Py_ASNATIVEBYTES_NATIVE_ENDIAN | (is_unsigned ? Py_ASNATIVEBYTES_UNSIGNED_BUFFER | Py_ASNATIVEBYTES_REJECT_NEGATIVE : 0));
+    if (unlikely(bytes_copied == -1)) {
+    } else if (unlikely(bytes_copied > (Py_ssize_t) sizeof(val))) {
+        goto raise_overflow;
+    } else {
+        ret = 0;
     }
-    descr = _PyType_Lookup(tp, name);
-    if (likely(descr != NULL)) {
-        Py_INCREF(descr);
-#if PY_MAJOR_VERSION >= 3
-        #ifdef __Pyx_CyFunction_USED
-        if (likely(PyFunction_Check(descr) || (Py_TYPE(descr) == &PyMethodDescr_Type) || __Pyx_CyFunction_Check(descr)))
-        #else
-        if (likely(PyFunction_Check(descr) || (Py_TYPE(descr) == &PyMethodDescr_Type)))
-        #endif
+#elif PY_VERSION_HEX < 0x030d0000 && !(CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_LIMITED_API) || defined(_PyLong_AsByteArray)
+    int one = 1; int is_little = (int)*(unsigned char *)&one;
+    unsigned char *bytes = (unsigned char *)&val;
+    ret = _PyLong_AsByteArray((PyLongObject *)x,
+                                bytes, sizeof(val),
+                                is_little, !is_unsigned);
+    if ((0)) goto raise_overflow;
 #else
-        #ifdef __Pyx_CyFunction_USED
-        if (likely(PyFunction_Check(descr) || __Pyx_CyFunction_Check(descr)))
-        #else
-        if (likely(PyFunction_Check(descr)))
-        #endif
-#endif
-        {
-            meth_found = 1;
-        } else {
-            f = Py_TYPE(descr)->tp_descr_get;
-            if (f != NULL && PyDescr_IsData(descr)) {
-                attr = f(descr, obj, (PyObject *)Py_TYPE(obj));
-                Py_DECREF(descr);
-                goto try_unpack;
-            }
-        }
+    PyObject *v;
+    PyObject *stepval = NULL, *mask = NULL, *shift = NULL;
+    int bits, remaining_bits, is_negative = 0;
+    int chunk_size = (sizeof(long) < 8) ? 30 : 62;
+    if (likely(PyLong_CheckExact(x))) {
+        v = __Pyx_NewRef(x);
+    } else {
+        v = PyNumber_Long(x);
+        if (unlikely(!v)) return (size_t) -1;
+        assert(PyLong_CheckExact(v));
     }
-    dictptr = _PyObject_GetDictPtr(obj);
-    if (dictptr != NULL && (dict = *dictptr) != NULL) {
-        Py_INCREF(dict);
-        attr = __Pyx_PyDict_GetItemStr(dict, name);
-        if (attr != NULL) {
-            Py_INCREF(attr);
-            Py_DECREF(dict);
-            Py_XDECREF(descr);
-            goto try_unpack;
+    {
+        int result = PyObject_RichCompareBool(v, Py_False, Py_LT);
+        if (unlikely(result < 0)) {
+            Py_DECREF(v);
+            return (size_t) -1;
         }
-        Py_DECREF(dict);
+        is_negative = result == 1;
     }
-    if (meth_found) {
-        *method = descr;
-        return 1;
+    if (is_unsigned && unlikely(is_negative)) {
+        Py_DECREF(v);
+        PyErr_SetString(PyExc_OverflowError,
+            "can't convert negative value to size_t");
+        return (size_t) -1;
+    } else if (is_negative) {
+        stepval = PyNumber_Invert(v);
+        Py_DECREF(v);
+        if (unlikely(!stepval))
+            return (size_t) -1;
+    } else {
+        stepval = v;
     }
-    if (f != NULL) {
-        attr = f(descr, obj, (PyObject *)Py_TYPE(obj));
-        Py_DECREF(descr);
-        goto try_unpack;
+    v = NULL;
+    val = (size_t) 0;
+    mask = PyLong_FromLong((1L << chunk_size) - 1); if (unlikely(!mask)) goto done;
+    shift = PyLong_FromLong(chunk_size); if (unlikely(!shift)) goto done;
+    for (bits = 0; bits < (int) sizeof(size_t) * 8 - chunk_size; bits += chunk_size) {
+        PyObject *tmp, *digit;
+        long idigit;
+        digit = PyNumber_And(stepval, mask);
+        if (unlikely(!digit)) goto done;
+        idigit = PyLong_AsLong(digit);
+        Py_DECREF(digit);
+        if (unlikely(idigit < 0)) goto done;
+        val |= ((size_t) idigit) << bits;
+        tmp = PyNumber_Rshift(stepval, shift);
+        if (unlikely(!tmp)) goto done;
+        Py_DECREF(stepval); stepval = tmp;
     }
-    if (descr != NULL) {
-        *method = descr;
-        return 0;
+    Py_DECREF(shift); shift = NULL;
+    Py_DECREF(mask); mask = NULL;
+    {
+        long idigit = PyLong_AsLong(stepval);
+        if (unlikely(idigit < 0)) goto done;
+        remaining_bits = ((int) sizeof(size_t) * 8) - bits - (is_unsigned ? 0 : 1);
+        if (unlikely(idigit >= (1L << remaining_bits)))
+            goto raise_overflow;
+        val |= ((size_t) idigit) << bits;
     }
-    PyErr_Format(PyExc_AttributeError,
-#if PY_MAJOR_VERSION >= 3
-                 "'%.50s' object has no attribute '%U'",
-                 tp->tp_name, name);
-#else
-                 "'%.50s' object has no attribute '%.400s'",
-                 tp->tp_name, PyString_AS_STRING(name));
+    if (!is_unsigned) {
+        if (unlikely(val & (((size_t) 1) << (sizeof(size_t) * 8 - 1))))
+            goto raise_overflow;
+        if (is_negative)
+            val = ~val;
+    }
+    ret = 0;
+done:
+    Py_XDECREF(shift);
+    Py_XDECREF(mask);
+    Py_XDECREF(stepval);
 #endif
-    return 0;
-#else
-    attr = __Pyx_PyObject_GetAttrStr(obj, name);
-    goto try_unpack;
+    if (unlikely(ret))
+        return (size_t) -1;
+    return val;
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_size_t();
+}
+static CYTHON_INLINE size_t __Pyx_PyLong___Pyx_PyLong_As_size_t(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
 #endif
-try_unpack:
-#if CYTHON_UNPACK_METHODS
-    if (likely(attr) && PyMethod_Check(attr) && likely(PyMethod_GET_SELF(attr) == obj)) {
-        PyObject *function = PyMethod_GET_FUNCTION(attr);
-        Py_INCREF(function);
-        Py_DECREF(attr);
-        *method = function;
-        return 1;
+    const size_t neg_one = (size_t) -1, const_zero = (size_t) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (unlikely(__Pyx_PyLong_IsNeg(x))) {
+            goto raise_neg_overflow;
+        } else if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(size_t, __Pyx_compact_upylong, __Pyx_PyLong_CompactValueUnsigned(x))
+        } else
+        #endif
+        {
+            return __Pyx_PyULong___Pyx_PyLong_As_size_t(x);
+        }
+    } else {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(size_t, __Pyx_compact_pylong, __Pyx_PyLong_CompactValue(x))
+        } else
+        #endif
+        {
+            return __Pyx_PySLong___Pyx_PyLong_As_size_t(x);
+        }
     }
+#if CYTHON_USE_PYLONG_INTERNALS
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_size_t();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_size_t();
 #endif
-    *method = attr;
-    return 0;
 }
-
-/* PyObjectCallMethod1 */
-static PyObject* __Pyx__PyObject_CallMethod1(PyObject* method, PyObject* arg) {
-    PyObject *result = __Pyx_PyObject_CallOneArg(method, arg);
-    Py_DECREF(method);
-    return result;
+static size_t __Pyx_NonPyLong___Pyx_PyLong_As_size_t(PyObject *x) {
+    size_t val;
+    PyObject *tmp = __Pyx_PyNumber_Long(x);
+    if (!tmp) return (size_t) -1;
+    val = __Pyx_PyLong_As_size_t(tmp);
+    Py_DECREF(tmp);
+    return val;
 }
-static PyObject* __Pyx_PyObject_CallMethod1(PyObject* obj, PyObject* method_name, PyObject* arg) {
-    PyObject *method = NULL, *result;
-    int is_method = __Pyx_PyObject_GetMethod(obj, method_name, &method);
-    if (likely(is_method)) {
-        result = __Pyx_PyObject_Call2Args(method, obj, arg);
-        Py_DECREF(method);
-        return result;
-    }
-    if (unlikely(!method)) return NULL;
-    return __Pyx__PyObject_CallMethod1(method, arg);
-}
-
-/* CoroutineBase */
-#include <structmember.h>
-#include <frameobject.h>
-#define __Pyx_Coroutine_Undelegate(gen) Py_CLEAR((gen)->yieldfrom)
-static int __Pyx_PyGen__FetchStopIterationValue(CYTHON_UNUSED PyThreadState *__pyx_tstate, PyObject **pvalue) {
-    PyObject *et, *ev, *tb;
-    PyObject *value = NULL;
-    __Pyx_ErrFetch(&et, &ev, &tb);
-    if (!et) {
-        Py_XDECREF(tb);
-        Py_XDECREF(ev);
-        Py_INCREF(Py_None);
-        *pvalue = Py_None;
-        return 0;
+static CYTHON_INLINE size_t __Pyx_PyLong_As_size_t(PyObject *x) {
+    if (likely(PyLong_Check(x))) {
+        return __Pyx_PyLong___Pyx_PyLong_As_size_t(x);
+    } else {
+        return __Pyx_NonPyLong___Pyx_PyLong_As_size_t(x);
     }
-    if (likely(et == PyExc_StopIteration)) {
-        if (!ev) {
-            Py_INCREF(Py_None);
-            value = Py_None;
+}
+
+/* CIntToPy */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_int(int value) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+    const int neg_one = (int) -1, const_zero = (int) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        if (sizeof(int) < sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(int) <= sizeof(unsigned long)) {
+            return PyLong_FromUnsignedLong((unsigned long) value);
+#if !CYTHON_COMPILING_IN_PYPY
+        } else if (sizeof(int) <= sizeof(unsigned PY_LONG_LONG)) {
+            return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG) value);
+#endif
         }
-#if PY_VERSION_HEX >= 0x030300A0
-        else if (Py_TYPE(ev) == (PyTypeObject*)PyExc_StopIteration) {
-            value = ((PyStopIterationObject *)ev)->value;
-            Py_INCREF(value);
-            Py_DECREF(ev);
+    } else {
+        if (sizeof(int) <= sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(int) <= sizeof(PY_LONG_LONG)) {
+            return PyLong_FromLongLong((PY_LONG_LONG) value);
         }
-#endif
-        else if (unlikely(PyTuple_Check(ev))) {
-            if (PyTuple_GET_SIZE(ev) >= 1) {
-#if CYTHON_ASSUME_SAFE_MACROS && !CYTHON_AVOID_BORROWED_REFS
-                value = PyTuple_GET_ITEM(ev, 0);
-                Py_INCREF(value);
+    }
+    {
+        unsigned char *bytes = (unsigned char *)&value;
+#if !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030d00A4
+        if (is_unsigned) {
+            return PyLong_FromUnsignedNativeBytes(bytes, sizeof(value), -1);
+        } else {
+            return PyLong_FromNativeBytes(bytes, sizeof(value), -1);
+        }
+#elif !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX < 0x030d0000
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        return _PyLong_FromByteArray(bytes, sizeof(int),
+                                     little, !is_unsigned);
 #else
-                value = PySequence_ITEM(ev, 0);
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        PyObject *result = NULL, *kwds = NULL;
+        PyObject *py_bytes = NULL, *order_str = NULL, *from_bytes_str = NULL;;
+        py_bytes = PyBytes_FromStringAndSize((char*)bytes, sizeof(int));
+        if (!py_bytes) goto limited_bad;
+        from_bytes_str = PyUnicode_FromStringAndSize("from_bytes", 10);
+        if (!from_bytes_str) goto limited_bad;
+        order_str = PyUnicode_FromString(little ? "little" : "big");
+        if (!order_str) goto limited_bad;
+        {
+            PyObject *args[] = { (PyObject*)&PyLong_Type, py_bytes, order_str, Py_True };
+            if (!is_unsigned) {
+                PyObject *signed_str = PyUnicode_FromStringAndSize("signed", 6);
+                if (!signed_str) goto limited_bad;
+#if CYTHON_VECTORCALL
+                kwds = PyTuple_Pack(1, signed_str);
+#else
+                {
+                    PyObject *keys[] = {signed_str};
+                    PyObject *values[] = {Py_True};
+                    kwds = __Pyx_MakeKwargDict(keys, values, 1);
+                }
 #endif
-            } else {
-                Py_INCREF(Py_None);
-                value = Py_None;
+                Py_DECREF(signed_str);
+                if (unlikely(!kwds)) goto limited_bad;
             }
-            Py_DECREF(ev);
+            result = __Pyx_Object_VectorcallMethodKwds(from_bytes_str, args, 3 | __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET, kwds);
         }
-        else if (!__Pyx_TypeCheck(ev, (PyTypeObject*)PyExc_StopIteration)) {
-            value = ev;
+        limited_bad:
+        Py_XDECREF(kwds);
+        Py_XDECREF(order_str);
+        Py_XDECREF(py_bytes);
+        Py_XDECREF(from_bytes_str);
+        return result;
+#endif
+    }
+}
+
+/* CIntToPy */
+static CYTHON_INLINE PyObject* __Pyx_PyLong_From_unsigned_long(unsigned long value) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+    const unsigned long neg_one = (unsigned long) -1, const_zero = (unsigned long) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        if (sizeof(unsigned long) < sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(unsigned long) <= sizeof(unsigned long)) {
+            return PyLong_FromUnsignedLong((unsigned long) value);
+#if !CYTHON_COMPILING_IN_PYPY
+        } else if (sizeof(unsigned long) <= sizeof(unsigned PY_LONG_LONG)) {
+            return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG) value);
+#endif
         }
-        if (likely(value)) {
-            Py_XDECREF(tb);
-            Py_DECREF(et);
-            *pvalue = value;
-            return 0;
+    } else {
+        if (sizeof(unsigned long) <= sizeof(long)) {
+            return PyLong_FromLong((long) value);
+        } else if (sizeof(unsigned long) <= sizeof(PY_LONG_LONG)) {
+            return PyLong_FromLongLong((PY_LONG_LONG) value);
         }
-    } else if (!__Pyx_PyErr_GivenExceptionMatches(et, PyExc_StopIteration)) {
-        __Pyx_ErrRestore(et, ev, tb);
-        return -1;
     }
-    PyErr_NormalizeException(&et, &ev, &tb);
-    if (unlikely(!PyObject_TypeCheck(ev, (PyTypeObject*)PyExc_StopIteration))) {
-        __Pyx_ErrRestore(et, ev, tb);
-        return -1;
-    }
-    Py_XDECREF(tb);
-    Py_DECREF(et);
-#if PY_VERSION_HEX >= 0x030300A0
-    value = ((PyStopIterationObject *)ev)->value;
-    Py_INCREF(value);
-    Py_DECREF(ev);
-#else
     {
-        PyObject* args = __Pyx_PyObject_GetAttrStr(ev, __pyx_n_s_args_2);
-        Py_DECREF(ev);
-        if (likely(args)) {
-            value = PySequence_GetItem(args, 0);
-            Py_DECREF(args);
+        unsigned char *bytes = (unsigned char *)&value;
+#if !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030d00A4
+        if (is_unsigned) {
+            return PyLong_FromUnsignedNativeBytes(bytes, sizeof(value), -1);
+        } else {
+            return PyLong_FromNativeBytes(bytes, sizeof(value), -1);
         }
-        if (unlikely(!value)) {
-            __Pyx_ErrRestore(NULL, NULL, NULL);
-            Py_INCREF(Py_None);
-            value = Py_None;
+#elif !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX < 0x030d0000
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        return _PyLong_FromByteArray(bytes, sizeof(unsigned long),
+                                     little, !is_unsigned);
+#else
+        int one = 1; int little = (int)*(unsigned char *)&one;
+        PyObject *result = NULL, *kwds = NULL;
+        PyObject *py_bytes = NULL, *order_str = NULL, *from_bytes_str = NULL;;
+        py_bytes = PyBytes_FromStringAndSize((char*)bytes, sizeof(unsigned long));
+        if (!py_bytes) goto limited_bad;
+        from_bytes_str = PyUnicode_FromStringAndSize("from_bytes", 10);
+        if (!from_bytes_str) goto limited_bad;
+        order_str = PyUnicode_FromString(little ? "little" : "big");
+        if (!order_str) goto limited_bad;
+        {
+            PyObject *args[] = { (PyObject*)&PyLong_Type, py_bytes, order_str, Py_True };
+            if (!is_unsigned) {
+                PyObject *signed_str = PyUnicode_FromStringAndSize("signed", 6);
+                if (!signed_str) goto limited_bad;
+#if CYTHON_VECTORCALL
+                kwds = PyTuple_Pack(1, signed_str);
+#else
+                {
+                    PyObject *keys[] = {signed_str};
+                    PyObject *values[] = {Py_True};
+                    kwds = __Pyx_MakeKwargDict(keys, values, 1);
+                }
+#endif
+                Py_DECREF(signed_str);
+                if (unlikely(!kwds)) goto limited_bad;
+            }
+            result = __Pyx_Object_VectorcallMethodKwds(from_bytes_str, args, 3 | __Pyx_PY_VECTORCALL_ARGUMENTS_OFFSET, kwds);
         }
-    }
+        limited_bad:
+        Py_XDECREF(kwds);
+        Py_XDECREF(order_str);
+        Py_XDECREF(py_bytes);
+        Py_XDECREF(from_bytes_str);
+        return result;
 #endif
-    *pvalue = value;
-    return 0;
+    }
 }
-static CYTHON_INLINE
-void __Pyx_Coroutine_ExceptionClear(__Pyx_ExcInfoStruct *exc_state) {
-    PyObject *t, *v, *tb;
-    t = exc_state->exc_type;
-    v = exc_state->exc_value;
-    tb = exc_state->exc_traceback;
-    exc_state->exc_type = NULL;
-    exc_state->exc_value = NULL;
-    exc_state->exc_traceback = NULL;
-    Py_XDECREF(t);
-    Py_XDECREF(v);
-    Py_XDECREF(tb);
+
+/* CIntFromPy */
+static long __Pyx_LargePyLong___Pyx_PyLong_As_long(PyObject *x);
+static long __Pyx_raise_neg_overflow___Pyx_PyLong_As_long(void) {
+    const char* type_name = "long";
+    PyErr_Format(PyExc_OverflowError,
+        "can't convert negative value to %.200s", type_name);
+    return (long) -1;
 }
-#define __Pyx_Coroutine_AlreadyRunningError(gen)  (__Pyx__Coroutine_AlreadyRunningError(gen), (PyObject*)NULL)
-static void __Pyx__Coroutine_AlreadyRunningError(CYTHON_UNUSED __pyx_CoroutineObject *gen) {
-    const char *msg;
-    if ((0)) {
-    #ifdef __Pyx_Coroutine_USED
-    } else if (__Pyx_Coroutine_Check((PyObject*)gen)) {
-        msg = "coroutine already executing";
-    #endif
-    #ifdef __Pyx_AsyncGen_USED
-    } else if (__Pyx_AsyncGen_CheckExact((PyObject*)gen)) {
-        msg = "async generator already executing";
-    #endif
-    } else {
-        msg = "generator already executing";
+static long __Pyx_raise_overflow___Pyx_PyLong_As_long(void) {
+    const char* type_name = "long";
+    PyErr_Format(PyExc_OverflowError,
+        "value too large to convert to %.200s", type_name);
+    return (long) -1;
+}
+static CYTHON_INLINE long __Pyx_PyULong___Pyx_PyLong_As_long(PyObject *x) {
+    const int is_unsigned = 1;
+#if CYTHON_USE_PYLONG_INTERNALS
+    {
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        if (size == 2 && (8 * sizeof(long) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) >= 2 * PyLong_SHIFT)) {
+                return (long) (((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) >= 3 * PyLong_SHIFT)) {
+                return (long) (((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) >= 4 * PyLong_SHIFT)) {
+                return (long) (((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        {}
     }
-    PyErr_SetString(PyExc_ValueError, msg);
+#elif CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX < 0x030C00A7
+    if (unlikely(Py_SIZE(x) < 0)) {
+        goto raise_neg_overflow;
+    }
+#else
+    {
+        int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
+        if (unlikely(result < 0))
+            return (long) -1;
+        if (unlikely(result == 1))
+            goto raise_neg_overflow;
+    }
+#endif
+    if ((sizeof(long) <= sizeof(unsigned long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(long, unsigned long, PyLong_AsUnsignedLong(x))
+    } else if ((sizeof(long) <= sizeof(unsigned PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(long, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
+    }
+    return __Pyx_LargePyLong___Pyx_PyLong_As_long(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_long();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_long();
 }
-#define __Pyx_Coroutine_NotStartedError(gen)  (__Pyx__Coroutine_NotStartedError(gen), (PyObject*)NULL)
-static void __Pyx__Coroutine_NotStartedError(CYTHON_UNUSED PyObject *gen) {
-    const char *msg;
-    if ((0)) {
-    #ifdef __Pyx_Coroutine_USED
-    } else if (__Pyx_Coroutine_Check(gen)) {
-        msg = "can't send non-None value to a just-started coroutine";
-    #endif
-    #ifdef __Pyx_AsyncGen_USED
-    } else if (__Pyx_AsyncGen_CheckExact(gen)) {
-        msg = "can't send non-None value to a just-started async generator";
+static CYTHON_INLINE long __Pyx_PySLong___Pyx_PyLong_As_long(PyObject *x) {
+    const int is_unsigned = 0;
+#if CYTHON_USE_PYLONG_INTERNALS
+    if (__Pyx_PyLong_IsNeg(x)) {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(long) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                long ival = - (long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(long, long, ival)
+            } else if ((8 * sizeof(long) - 1 > 2 * PyLong_SHIFT)) {
+                return (long) (((long) -1) * (((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(long, long, ival)
+            } else if ((8 * sizeof(long) - 1 > 3 * PyLong_SHIFT)) {
+                return (long) (((long) -1) * (((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(long, long, ival)
+            } else if ((8 * sizeof(long) - 1 > 4 * PyLong_SHIFT)) {
+                return (long) (((long) -1) * (((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0])));
+            }
+        } else
+        {}
+    } else {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(long) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) - 1 > 2 * PyLong_SHIFT)) {
+                return (long) (((((long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) - 1 > 3 * PyLong_SHIFT)) {
+                return (long) (((((((long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(long, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(long) - 1 > 4 * PyLong_SHIFT)) {
+                return (long) (((((((((long)digits[3]) << PyLong_SHIFT) | (long)digits[2]) << PyLong_SHIFT) | (long)digits[1]) << PyLong_SHIFT) | (long)digits[0]));
+            }
+        } else
+        {}
+    }
+#endif
+    #if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+    if ((sizeof(long) <= sizeof(int)) && (sizeof(int) < sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(long, int, PyLong_AsInt(x))
+    } else
     #endif
+    if ((sizeof(long) <= sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(long, long, PyLong_AsLong(x))
+    } else if ((sizeof(long) <= sizeof(PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(long, PY_LONG_LONG, PyLong_AsLongLong(x))
+    }
+    return __Pyx_LargePyLong___Pyx_PyLong_As_long(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_long();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_long();
+}
+static long __Pyx_LargePyLong___Pyx_PyLong_As_long(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+    const long neg_one = (long) -1, const_zero = (long) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    long val;
+    int ret = -1;
+#if PY_VERSION_HEX >= 0x030d00A6 && !CYTHON_COMPILING_IN_LIMITED_API
+    Py_ssize_t bytes_copied = PyLong_AsNativeBytes(
+        x, &val, sizeof(val), Py_ASNATIVEBYTES_NATIVE_ENDIAN | (is_unsigned ? Py_ASNATIVEBYTES_UNSIGNED_BUFFER | Py_ASNATIVEBYTES_REJECT_NEGATIVE : 0));
+    if (unlikely(bytes_copied == -1)) {
+    } else if (unlikely(bytes_copied > (Py_ssize_t) sizeof(val))) {
+        goto raise_overflow;
     } else {
-        msg = "can't send non-None value to a just-started generator";
+        ret = 0;
     }
-    PyErr_SetString(PyExc_TypeError, msg);
-}
-#define __Pyx_Coroutine_AlreadyTerminatedError(gen, value, closing)  (__Pyx__Coroutine_AlreadyTerminatedError(gen, value, closing), (PyObject*)NULL)
-static void __Pyx__Coroutine_AlreadyTerminatedError(CYTHON_UNUSED PyObject *gen, PyObject *value, CYTHON_UNUSED int closing) {
-    #ifdef __Pyx_Coroutine_USED
-    if (!closing && __Pyx_Coroutine_Check(gen)) {
-        PyErr_SetString(PyExc_RuntimeError, "cannot reuse already awaited coroutine");
-    } else
-    #endif
-    if (value) {
-        #ifdef __Pyx_AsyncGen_USED
-        if (__Pyx_AsyncGen_CheckExact(gen))
-            PyErr_SetNone(__Pyx_PyExc_StopAsyncIteration);
-        else
-        #endif
-        PyErr_SetNone(PyExc_StopIteration);
-    }
-}
-static
-PyObject *__Pyx_Coroutine_SendEx(__pyx_CoroutineObject *self, PyObject *value, int closing) {
-    __Pyx_PyThreadState_declare
-    PyThreadState *tstate;
-    __Pyx_ExcInfoStruct *exc_state;
-    PyObject *retval;
-    assert(!self->is_running);
-    if (unlikely(self->resume_label == 0)) {
-        if (unlikely(value && value != Py_None)) {
-            return __Pyx_Coroutine_NotStartedError((PyObject*)self);
-        }
-    }
-    if (unlikely(self->resume_label == -1)) {
-        return __Pyx_Coroutine_AlreadyTerminatedError((PyObject*)self, value, closing);
-    }
-#if CYTHON_FAST_THREAD_STATE
-    __Pyx_PyThreadState_assign
-    tstate = __pyx_tstate;
+#elif PY_VERSION_HEX < 0x030d0000 && !(CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_LIMITED_API) || defined(_PyLong_AsByteArray)
+    int one = 1; int is_little = (int)*(unsigned char *)&one;
+    unsigned char *bytes = (unsigned char *)&val;
+    ret = _PyLong_AsByteArray((PyLongObject *)x,
+                                bytes, sizeof(val),
+                                is_little, !is_unsigned);
+    if ((0)) goto raise_overflow;
 #else
-    tstate = __Pyx_PyThreadState_Current;
-#endif
-    exc_state = &self->gi_exc_state;
-    if (exc_state->exc_type) {
-        #if CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_PYSTON
-        #else
-        if (exc_state->exc_traceback) {
-            PyTracebackObject *tb = (PyTracebackObject *) exc_state->exc_traceback;
-            PyFrameObject *f = tb->tb_frame;
-            Py_XINCREF(tstate->frame);
-            assert(f->f_back == NULL);
-            f->f_back = tstate->frame;
+    PyObject *v;
+    PyObject *stepval = NULL, *mask = NULL, *shift = NULL;
+    int bits, remaining_bits, is_negative = 0;
+    int chunk_size = (sizeof(long) < 8) ? 30 : 62;
+    if (likely(PyLong_CheckExact(x))) {
+        v = __Pyx_NewRef(x);
+    } else {
+        v = PyNumber_Long(x);
+        if (unlikely(!v)) return (long) -1;
+        assert(PyLong_CheckExact(v));
+    }
+    {
+        int result = PyObject_RichCompareBool(v, Py_False, Py_LT);
+        if (unlikely(result < 0)) {
+            Py_DECREF(v);
+            return (long) -1;
         }
-        #endif
+        is_negative = result == 1;
     }
-#if CYTHON_USE_EXC_INFO_STACK
-    exc_state->previous_item = tstate->exc_info;
-    tstate->exc_info = exc_state;
-#else
-    if (exc_state->exc_type) {
-        __Pyx_ExceptionSwap(&exc_state->exc_type, &exc_state->exc_value, &exc_state->exc_traceback);
+    if (is_unsigned && unlikely(is_negative)) {
+        Py_DECREF(v);
+        PyErr_SetString(PyExc_OverflowError,
+            "can't convert negative value to long");
+        return (long) -1;
+    } else if (is_negative) {
+        stepval = PyNumber_Invert(v);
+        Py_DECREF(v);
+        if (unlikely(!stepval))
+            return (long) -1;
     } else {
-        __Pyx_Coroutine_ExceptionClear(exc_state);
-        __Pyx_ExceptionSave(&exc_state->exc_type, &exc_state->exc_value, &exc_state->exc_traceback);
+        stepval = v;
     }
-#endif
-    self->is_running = 1;
-    retval = self->body((PyObject *) self, tstate, value);
-    self->is_running = 0;
-#if CYTHON_USE_EXC_INFO_STACK
-    exc_state = &self->gi_exc_state;
-    tstate->exc_info = exc_state->previous_item;
-    exc_state->previous_item = NULL;
-    __Pyx_Coroutine_ResetFrameBackpointer(exc_state);
-#endif
-    return retval;
-}
-static CYTHON_INLINE void __Pyx_Coroutine_ResetFrameBackpointer(__Pyx_ExcInfoStruct *exc_state) {
-    PyObject *exc_tb = exc_state->exc_traceback;
-    if (likely(exc_tb)) {
-#if CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_PYSTON
-#else
-        PyTracebackObject *tb = (PyTracebackObject *) exc_tb;
-        PyFrameObject *f = tb->tb_frame;
-        Py_CLEAR(f->f_back);
-#endif
+    v = NULL;
+    val = (long) 0;
+    mask = PyLong_FromLong((1L << chunk_size) - 1); if (unlikely(!mask)) goto done;
+    shift = PyLong_FromLong(chunk_size); if (unlikely(!shift)) goto done;
+    for (bits = 0; bits < (int) sizeof(long) * 8 - chunk_size; bits += chunk_size) {
+        PyObject *tmp, *digit;
+        long idigit;
+        digit = PyNumber_And(stepval, mask);
+        if (unlikely(!digit)) goto done;
+        idigit = PyLong_AsLong(digit);
+        Py_DECREF(digit);
+        if (unlikely(idigit < 0)) goto done;
+        val |= ((long) idigit) << bits;
+        tmp = PyNumber_Rshift(stepval, shift);
+        if (unlikely(!tmp)) goto done;
+        Py_DECREF(stepval); stepval = tmp;
     }
-}
-static CYTHON_INLINE
-PyObject *__Pyx_Coroutine_MethodReturn(CYTHON_UNUSED PyObject* gen, PyObject *retval) {
-    if (unlikely(!retval)) {
-        __Pyx_PyThreadState_declare
-        __Pyx_PyThreadState_assign
-        if (!__Pyx_PyErr_Occurred()) {
-            PyObject *exc = PyExc_StopIteration;
-            #ifdef __Pyx_AsyncGen_USED
-            if (__Pyx_AsyncGen_CheckExact(gen))
-                exc = __Pyx_PyExc_StopAsyncIteration;
-            #endif
-            __Pyx_PyErr_SetNone(exc);
-        }
+    Py_DECREF(shift); shift = NULL;
+    Py_DECREF(mask); mask = NULL;
+    {
+        long idigit = PyLong_AsLong(stepval);
+        if (unlikely(idigit < 0)) goto done;
+        remaining_bits = ((int) sizeof(long) * 8) - bits - (is_unsigned ? 0 : 1);
+        if (unlikely(idigit >= (1L << remaining_bits)))
+            goto raise_overflow;
+        val |= ((long) idigit) << bits;
     }
-    return retval;
-}
-#if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x03030000 && (defined(__linux__) || PY_VERSION_HEX >= 0x030600B3)
-static CYTHON_INLINE
-PyObject *__Pyx_PyGen_Send(PyGenObject *gen, PyObject *arg) {
-#if PY_VERSION_HEX <= 0x030A00A1
-    return _PyGen_Send(gen, arg);
-#else
-    PyObject *result;
-    if (PyIter_Send((PyObject*)gen, arg ? arg : Py_None, &result) == PYGEN_RETURN) {
-        if (PyAsyncGen_CheckExact(gen)) {
-            assert(result == Py_None);
-            PyErr_SetNone(PyExc_StopAsyncIteration);
-        }
-        else if (result == Py_None) {
-            PyErr_SetNone(PyExc_StopIteration);
-        }
-        else {
-            _PyGen_SetStopIterationValue(result);
-        }
-        Py_CLEAR(result);
+    if (!is_unsigned) {
+        if (unlikely(val & (((long) 1) << (sizeof(long) * 8 - 1))))
+            goto raise_overflow;
+        if (is_negative)
+            val = ~val;
     }
-    return result;
+    ret = 0;
+done:
+    Py_XDECREF(shift);
+    Py_XDECREF(mask);
+    Py_XDECREF(stepval);
 #endif
+    if (unlikely(ret))
+        return (long) -1;
+    return val;
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_long();
 }
+static CYTHON_INLINE long __Pyx_PyLong___Pyx_PyLong_As_long(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
 #endif
-static CYTHON_INLINE
-PyObject *__Pyx_Coroutine_FinishDelegation(__pyx_CoroutineObject *gen) {
-    PyObject *ret;
-    PyObject *val = NULL;
-    __Pyx_Coroutine_Undelegate(gen);
-    __Pyx_PyGen__FetchStopIterationValue(__Pyx_PyThreadState_Current, &val);
-    ret = __Pyx_Coroutine_SendEx(gen, val, 0);
-    Py_XDECREF(val);
-    return ret;
-}
-static PyObject *__Pyx_Coroutine_Send(PyObject *self, PyObject *value) {
-    PyObject *retval;
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject*) self;
-    PyObject *yf = gen->yieldfrom;
-    if (unlikely(gen->is_running))
-        return __Pyx_Coroutine_AlreadyRunningError(gen);
-    if (yf) {
-        PyObject *ret;
-        gen->is_running = 1;
-        #ifdef __Pyx_Generator_USED
-        if (__Pyx_Generator_CheckExact(yf)) {
-            ret = __Pyx_Coroutine_Send(yf, value);
-        } else
-        #endif
-        #ifdef __Pyx_Coroutine_USED
-        if (__Pyx_Coroutine_Check(yf)) {
-            ret = __Pyx_Coroutine_Send(yf, value);
-        } else
-        #endif
-        #ifdef __Pyx_AsyncGen_USED
-        if (__pyx_PyAsyncGenASend_CheckExact(yf)) {
-            ret = __Pyx_async_gen_asend_send(yf, value);
-        } else
-        #endif
-        #if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x03030000 && (defined(__linux__) || PY_VERSION_HEX >= 0x030600B3)
-        if (PyGen_CheckExact(yf)) {
-            ret = __Pyx_PyGen_Send((PyGenObject*)yf, value == Py_None ? NULL : value);
+    const long neg_one = (long) -1, const_zero = (long) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (unlikely(__Pyx_PyLong_IsNeg(x))) {
+            goto raise_neg_overflow;
+        } else if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(long, __Pyx_compact_upylong, __Pyx_PyLong_CompactValueUnsigned(x))
         } else
         #endif
-        #if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x03050000 && defined(PyCoro_CheckExact) && (defined(__linux__) || PY_VERSION_HEX >= 0x030600B3)
-        if (PyCoro_CheckExact(yf)) {
-            ret = __Pyx_PyGen_Send((PyGenObject*)yf, value == Py_None ? NULL : value);
+        {
+            return __Pyx_PyULong___Pyx_PyLong_As_long(x);
+        }
+    } else {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(long, __Pyx_compact_pylong, __Pyx_PyLong_CompactValue(x))
         } else
         #endif
         {
-            if (value == Py_None)
-                ret = Py_TYPE(yf)->tp_iternext(yf);
-            else
-                ret = __Pyx_PyObject_CallMethod1(yf, __pyx_n_s_send, value);
+            return __Pyx_PySLong___Pyx_PyLong_As_long(x);
         }
-        gen->is_running = 0;
-        if (likely(ret)) {
-            return ret;
-        }
-        retval = __Pyx_Coroutine_FinishDelegation(gen);
+    }
+#if CYTHON_USE_PYLONG_INTERNALS
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_long();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_long();
+#endif
+}
+static long __Pyx_NonPyLong___Pyx_PyLong_As_long(PyObject *x) {
+    long val;
+    PyObject *tmp = __Pyx_PyNumber_Long(x);
+    if (!tmp) return (long) -1;
+    val = __Pyx_PyLong_As_long(tmp);
+    Py_DECREF(tmp);
+    return val;
+}
+static CYTHON_INLINE long __Pyx_PyLong_As_long(PyObject *x) {
+    if (likely(PyLong_Check(x))) {
+        return __Pyx_PyLong___Pyx_PyLong_As_long(x);
     } else {
-        retval = __Pyx_Coroutine_SendEx(gen, value, 0);
+        return __Pyx_NonPyLong___Pyx_PyLong_As_long(x);
     }
-    return __Pyx_Coroutine_MethodReturn(self, retval);
 }
-static int __Pyx_Coroutine_CloseIter(__pyx_CoroutineObject *gen, PyObject *yf) {
-    PyObject *retval = NULL;
-    int err = 0;
-    #ifdef __Pyx_Generator_USED
-    if (__Pyx_Generator_CheckExact(yf)) {
-        retval = __Pyx_Coroutine_Close(yf);
-        if (!retval)
-            return -1;
-    } else
-    #endif
-    #ifdef __Pyx_Coroutine_USED
-    if (__Pyx_Coroutine_Check(yf)) {
-        retval = __Pyx_Coroutine_Close(yf);
-        if (!retval)
-            return -1;
-    } else
-    if (__Pyx_CoroutineAwait_CheckExact(yf)) {
-        retval = __Pyx_CoroutineAwait_Close((__pyx_CoroutineAwaitObject*)yf, NULL);
-        if (!retval)
-            return -1;
-    } else
-    #endif
-    #ifdef __Pyx_AsyncGen_USED
-    if (__pyx_PyAsyncGenASend_CheckExact(yf)) {
-        retval = __Pyx_async_gen_asend_close(yf, NULL);
-    } else
-    if (__pyx_PyAsyncGenAThrow_CheckExact(yf)) {
-        retval = __Pyx_async_gen_athrow_close(yf, NULL);
-    } else
-    #endif
+
+/* CIntFromPy */
+static int __Pyx_LargePyLong___Pyx_PyLong_As_int(PyObject *x);
+static int __Pyx_raise_neg_overflow___Pyx_PyLong_As_int(void) {
+    const char* type_name = "int";
+    PyErr_Format(PyExc_OverflowError,
+        "can't convert negative value to %.200s", type_name);
+    return (int) -1;
+}
+static int __Pyx_raise_overflow___Pyx_PyLong_As_int(void) {
+    const char* type_name = "int";
+    PyErr_Format(PyExc_OverflowError,
+        "value too large to convert to %.200s", type_name);
+    return (int) -1;
+}
+static CYTHON_INLINE int __Pyx_PyULong___Pyx_PyLong_As_int(PyObject *x) {
+    const int is_unsigned = 1;
+#if CYTHON_USE_PYLONG_INTERNALS
     {
-        PyObject *meth;
-        gen->is_running = 1;
-        meth = __Pyx_PyObject_GetAttrStr(yf, __pyx_n_s_close);
-        if (unlikely(!meth)) {
-            if (!PyErr_ExceptionMatches(PyExc_AttributeError)) {
-                PyErr_WriteUnraisable(yf);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        if (size == 2 && (8 * sizeof(int) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) >= 2 * PyLong_SHIFT)) {
+                return (int) (((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
             }
-            PyErr_Clear();
-        } else {
-            retval = PyObject_CallFunction(meth, NULL);
-            Py_DECREF(meth);
-            if (!retval)
-                err = -1;
-        }
-        gen->is_running = 0;
-    }
-    Py_XDECREF(retval);
-    return err;
-}
-static PyObject *__Pyx_Generator_Next(PyObject *self) {
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject*) self;
-    PyObject *yf = gen->yieldfrom;
-    if (unlikely(gen->is_running))
-        return __Pyx_Coroutine_AlreadyRunningError(gen);
-    if (yf) {
-        PyObject *ret;
-        gen->is_running = 1;
-        #ifdef __Pyx_Generator_USED
-        if (__Pyx_Generator_CheckExact(yf)) {
-            ret = __Pyx_Generator_Next(yf);
         } else
-        #endif
-        #if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x03030000 && (defined(__linux__) || PY_VERSION_HEX >= 0x030600B3)
-        if (PyGen_CheckExact(yf)) {
-            ret = __Pyx_PyGen_Send((PyGenObject*)yf, NULL);
+        if (size == 3 && (8 * sizeof(int) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) >= 3 * PyLong_SHIFT)) {
+                return (int) (((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
+            }
         } else
-        #endif
-        #ifdef __Pyx_Coroutine_USED
-        if (__Pyx_Coroutine_Check(yf)) {
-            ret = __Pyx_Coroutine_Send(yf, Py_None);
+        if (size == 4 && (8 * sizeof(int) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(unsigned long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) >= 4 * PyLong_SHIFT)) {
+                return (int) (((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
+            }
         } else
-        #endif
-            ret = Py_TYPE(yf)->tp_iternext(yf);
-        gen->is_running = 0;
-        if (likely(ret)) {
-            return ret;
-        }
-        return __Pyx_Coroutine_FinishDelegation(gen);
-    }
-    return __Pyx_Coroutine_SendEx(gen, Py_None, 0);
-}
-static PyObject *__Pyx_Coroutine_Close_Method(PyObject *self, CYTHON_UNUSED PyObject *arg) {
-    return __Pyx_Coroutine_Close(self);
-}
-static PyObject *__Pyx_Coroutine_Close(PyObject *self) {
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject *) self;
-    PyObject *retval, *raised_exception;
-    PyObject *yf = gen->yieldfrom;
-    int err = 0;
-    if (unlikely(gen->is_running))
-        return __Pyx_Coroutine_AlreadyRunningError(gen);
-    if (yf) {
-        Py_INCREF(yf);
-        err = __Pyx_Coroutine_CloseIter(gen, yf);
-        __Pyx_Coroutine_Undelegate(gen);
-        Py_DECREF(yf);
-    }
-    if (err == 0)
-        PyErr_SetNone(PyExc_GeneratorExit);
-    retval = __Pyx_Coroutine_SendEx(gen, NULL, 1);
-    if (unlikely(retval)) {
-        const char *msg;
-        Py_DECREF(retval);
-        if ((0)) {
-        #ifdef __Pyx_Coroutine_USED
-        } else if (__Pyx_Coroutine_Check(self)) {
-            msg = "coroutine ignored GeneratorExit";
-        #endif
-        #ifdef __Pyx_AsyncGen_USED
-        } else if (__Pyx_AsyncGen_CheckExact(self)) {
-#if PY_VERSION_HEX < 0x03060000
-            msg = "async generator ignored GeneratorExit - might require Python 3.6+ finalisation (PEP 525)";
+        {}
+    }
+#elif CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX < 0x030C00A7
+    if (unlikely(Py_SIZE(x) < 0)) {
+        goto raise_neg_overflow;
+    }
 #else
-            msg = "async generator ignored GeneratorExit";
-#endif
-        #endif
-        } else {
-            msg = "generator ignored GeneratorExit";
-        }
-        PyErr_SetString(PyExc_RuntimeError, msg);
-        return NULL;
+    {
+        int result = PyObject_RichCompareBool(x, Py_False, Py_LT);
+        if (unlikely(result < 0))
+            return (int) -1;
+        if (unlikely(result == 1))
+            goto raise_neg_overflow;
     }
-    raised_exception = PyErr_Occurred();
-    if (likely(!raised_exception || __Pyx_PyErr_GivenExceptionMatches2(raised_exception, PyExc_GeneratorExit, PyExc_StopIteration))) {
-        if (raised_exception) PyErr_Clear();
-        Py_INCREF(Py_None);
-        return Py_None;
+#endif
+    if ((sizeof(int) <= sizeof(unsigned long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(int, unsigned long, PyLong_AsUnsignedLong(x))
+    } else if ((sizeof(int) <= sizeof(unsigned PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(int, unsigned PY_LONG_LONG, PyLong_AsUnsignedLongLong(x))
     }
-    return NULL;
+    return __Pyx_LargePyLong___Pyx_PyLong_As_int(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_int();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_int();
 }
-static PyObject *__Pyx__Coroutine_Throw(PyObject *self, PyObject *typ, PyObject *val, PyObject *tb,
-                                        PyObject *args, int close_on_genexit) {
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject *) self;
-    PyObject *yf = gen->yieldfrom;
-    if (unlikely(gen->is_running))
-        return __Pyx_Coroutine_AlreadyRunningError(gen);
-    if (yf) {
-        PyObject *ret;
-        Py_INCREF(yf);
-        if (__Pyx_PyErr_GivenExceptionMatches(typ, PyExc_GeneratorExit) && close_on_genexit) {
-            int err = __Pyx_Coroutine_CloseIter(gen, yf);
-            Py_DECREF(yf);
-            __Pyx_Coroutine_Undelegate(gen);
-            if (err < 0)
-                return __Pyx_Coroutine_MethodReturn(self, __Pyx_Coroutine_SendEx(gen, NULL, 0));
-            goto throw_here;
-        }
-        gen->is_running = 1;
-        if (0
-        #ifdef __Pyx_Generator_USED
-            || __Pyx_Generator_CheckExact(yf)
-        #endif
-        #ifdef __Pyx_Coroutine_USED
-            || __Pyx_Coroutine_Check(yf)
-        #endif
-            ) {
-            ret = __Pyx__Coroutine_Throw(yf, typ, val, tb, args, close_on_genexit);
-        #ifdef __Pyx_Coroutine_USED
-        } else if (__Pyx_CoroutineAwait_CheckExact(yf)) {
-            ret = __Pyx__Coroutine_Throw(((__pyx_CoroutineAwaitObject*)yf)->coroutine, typ, val, tb, args, close_on_genexit);
-        #endif
-        } else {
-            PyObject *meth = __Pyx_PyObject_GetAttrStr(yf, __pyx_n_s_throw);
-            if (unlikely(!meth)) {
-                Py_DECREF(yf);
-                if (!PyErr_ExceptionMatches(PyExc_AttributeError)) {
-                    gen->is_running = 0;
-                    return NULL;
-                }
-                PyErr_Clear();
-                __Pyx_Coroutine_Undelegate(gen);
-                gen->is_running = 0;
-                goto throw_here;
+static CYTHON_INLINE int __Pyx_PySLong___Pyx_PyLong_As_int(PyObject *x) {
+    const int is_unsigned = 0;
+#if CYTHON_USE_PYLONG_INTERNALS
+    if (__Pyx_PyLong_IsNeg(x)) {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(int) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                long ival = - (long) (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(int, long, ival)
+            } else if ((8 * sizeof(int) - 1 > 2 * PyLong_SHIFT)) {
+                return (int) (((int) -1) * (((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
             }
-            if (likely(args)) {
-                ret = PyObject_CallObject(meth, args);
-            } else {
-                ret = PyObject_CallFunctionObjArgs(meth, typ, val, tb, NULL);
+        } else
+        if (size == 3 && (8 * sizeof(int) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(int, long, ival)
+            } else if ((8 * sizeof(int) - 1 > 3 * PyLong_SHIFT)) {
+                return (int) (((int) -1) * (((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
             }
-            Py_DECREF(meth);
-        }
-        gen->is_running = 0;
-        Py_DECREF(yf);
-        if (!ret) {
-            ret = __Pyx_Coroutine_FinishDelegation(gen);
-        }
-        return __Pyx_Coroutine_MethodReturn(self, ret);
+        } else
+        if (size == 4 && (8 * sizeof(int) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                long ival = - (long) (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0]));
+                __PYX_VERIFY_RETURN_INT(int, long, ival)
+            } else if ((8 * sizeof(int) - 1 > 4 * PyLong_SHIFT)) {
+                return (int) (((int) -1) * (((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0])));
+            }
+        } else
+        {}
+    } else {
+        const Py_ssize_t size = __Pyx_PyLong_DigitCount(x);
+        const digit* digits = __Pyx_PyLong_Digits(x);
+        if (size == 2 && (8 * sizeof(int) > 1 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 2 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) - 1 > 2 * PyLong_SHIFT)) {
+                return (int) (((((int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
+            }
+        } else
+        if (size == 3 && (8 * sizeof(int) > 2 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 3 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) - 1 > 3 * PyLong_SHIFT)) {
+                return (int) (((((((int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
+            }
+        } else
+        if (size == 4 && (8 * sizeof(int) > 3 * PyLong_SHIFT)) {
+            if ((8 * sizeof(long) > 4 * PyLong_SHIFT)) {
+                __PYX_VERIFY_RETURN_INT(int, unsigned long, (((((((((unsigned long)digits[3]) << PyLong_SHIFT) | (unsigned long)digits[2]) << PyLong_SHIFT) | (unsigned long)digits[1]) << PyLong_SHIFT) | (unsigned long)digits[0])))
+            } else if ((8 * sizeof(int) - 1 > 4 * PyLong_SHIFT)) {
+                return (int) (((((((((int)digits[3]) << PyLong_SHIFT) | (int)digits[2]) << PyLong_SHIFT) | (int)digits[1]) << PyLong_SHIFT) | (int)digits[0]));
+            }
+        } else
+        {}
     }
-throw_here:
-    __Pyx_Raise(typ, val, tb, NULL);
-    return __Pyx_Coroutine_MethodReturn(self, __Pyx_Coroutine_SendEx(gen, NULL, 0));
-}
-static PyObject *__Pyx_Coroutine_Throw(PyObject *self, PyObject *args) {
-    PyObject *typ;
-    PyObject *val = NULL;
-    PyObject *tb = NULL;
-    if (!PyArg_UnpackTuple(args, (char *)"throw", 1, 3, &typ, &val, &tb))
-        return NULL;
-    return __Pyx__Coroutine_Throw(self, typ, val, tb, args, 1);
-}
-static CYTHON_INLINE int __Pyx_Coroutine_traverse_excstate(__Pyx_ExcInfoStruct *exc_state, visitproc visit, void *arg) {
-    Py_VISIT(exc_state->exc_type);
-    Py_VISIT(exc_state->exc_value);
-    Py_VISIT(exc_state->exc_traceback);
-    return 0;
-}
-static int __Pyx_Coroutine_traverse(__pyx_CoroutineObject *gen, visitproc visit, void *arg) {
-    Py_VISIT(gen->closure);
-    Py_VISIT(gen->classobj);
-    Py_VISIT(gen->yieldfrom);
-    return __Pyx_Coroutine_traverse_excstate(&gen->gi_exc_state, visit, arg);
-}
-static int __Pyx_Coroutine_clear(PyObject *self) {
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject *) self;
-    Py_CLEAR(gen->closure);
-    Py_CLEAR(gen->classobj);
-    Py_CLEAR(gen->yieldfrom);
-    __Pyx_Coroutine_ExceptionClear(&gen->gi_exc_state);
-#ifdef __Pyx_AsyncGen_USED
-    if (__Pyx_AsyncGen_CheckExact(self)) {
-        Py_CLEAR(((__pyx_PyAsyncGenObject*)gen)->ag_finalizer);
-    }
-#endif
-    Py_CLEAR(gen->gi_code);
-    Py_CLEAR(gen->gi_name);
-    Py_CLEAR(gen->gi_qualname);
-    Py_CLEAR(gen->gi_modulename);
-    return 0;
-}
-static void __Pyx_Coroutine_dealloc(PyObject *self) {
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject *) self;
-    PyObject_GC_UnTrack(gen);
-    if (gen->gi_weakreflist != NULL)
-        PyObject_ClearWeakRefs(self);
-    if (gen->resume_label >= 0) {
-        PyObject_GC_Track(self);
-#if PY_VERSION_HEX >= 0x030400a1 && CYTHON_USE_TP_FINALIZE
-        if (PyObject_CallFinalizerFromDealloc(self))
-#else
-        Py_TYPE(gen)->tp_del(self);
-        if (self->ob_refcnt > 0)
 #endif
-        {
-            return;
-        }
-        PyObject_GC_UnTrack(self);
-    }
-#ifdef __Pyx_AsyncGen_USED
-    if (__Pyx_AsyncGen_CheckExact(self)) {
-        /* We have to handle this case for asynchronous generators
-           right here, because this code has to be between UNTRACK
-           and GC_Del. */
-        Py_CLEAR(((__pyx_PyAsyncGenObject*)self)->ag_finalizer);
+    #if __PYX_LIMITED_VERSION_HEX >= 0x030d0000
+    if ((sizeof(int) <= sizeof(int)) && (sizeof(int) < sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(int, int, PyLong_AsInt(x))
+    } else
+    #endif
+    if ((sizeof(int) <= sizeof(long))) {
+        __PYX_VERIFY_RETURN_INT_EXC(int, long, PyLong_AsLong(x))
+    } else if ((sizeof(int) <= sizeof(PY_LONG_LONG))) {
+        __PYX_VERIFY_RETURN_INT_EXC(int, PY_LONG_LONG, PyLong_AsLongLong(x))
     }
-#endif
-    __Pyx_Coroutine_clear(self);
-    PyObject_GC_Del(gen);
+    return __Pyx_LargePyLong___Pyx_PyLong_As_int(x);
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_int();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_int();
 }
-static void __Pyx_Coroutine_del(PyObject *self) {
-    PyObject *error_type, *error_value, *error_traceback;
-    __pyx_CoroutineObject *gen = (__pyx_CoroutineObject *) self;
-    __Pyx_PyThreadState_declare
-    if (gen->resume_label < 0) {
-        return;
-    }
-#if !CYTHON_USE_TP_FINALIZE
-    assert(self->ob_refcnt == 0);
-    __Pyx_SET_REFCNT(self, 1);
-#endif
-    __Pyx_PyThreadState_assign
-    __Pyx_ErrFetch(&error_type, &error_value, &error_traceback);
-#ifdef __Pyx_AsyncGen_USED
-    if (__Pyx_AsyncGen_CheckExact(self)) {
-        __pyx_PyAsyncGenObject *agen = (__pyx_PyAsyncGenObject*)self;
-        PyObject *finalizer = agen->ag_finalizer;
-        if (finalizer && !agen->ag_closed) {
-            PyObject *res = __Pyx_PyObject_CallOneArg(finalizer, self);
-            if (unlikely(!res)) {
-                PyErr_WriteUnraisable(self);
-            } else {
-                Py_DECREF(res);
-            }
-            __Pyx_ErrRestore(error_type, error_value, error_traceback);
-            return;
-        }
-    }
-#endif
-    if (unlikely(gen->resume_label == 0 && !error_value)) {
-#ifdef __Pyx_Coroutine_USED
-#ifdef __Pyx_Generator_USED
-    if (!__Pyx_Generator_CheckExact(self))
-#endif
-        {
-        PyObject_GC_UnTrack(self);
-#if PY_MAJOR_VERSION >= 3  || defined(PyErr_WarnFormat)
-        if (unlikely(PyErr_WarnFormat(PyExc_RuntimeWarning, 1, "coroutine '%.50S' was never awaited", gen->gi_qualname) < 0))
-            PyErr_WriteUnraisable(self);
-#else
-        {PyObject *msg;
-        char *cmsg;
-        #if CYTHON_COMPILING_IN_PYPY
-        msg = NULL;
-        cmsg = (char*) "coroutine was never awaited";
-        #else
-        char *cname;
-        PyObject *qualname;
-        qualname = gen->gi_qualname;
-        cname = PyString_AS_STRING(qualname);
-        msg = PyString_FromFormat("coroutine '%.50s' was never awaited", cname);
-        if (unlikely(!msg)) {
-            PyErr_Clear();
-            cmsg = (char*) "coroutine was never awaited";
-        } else {
-            cmsg = PyString_AS_STRING(msg);
-        }
-        #endif
-        if (unlikely(PyErr_WarnEx(PyExc_RuntimeWarning, cmsg, 1) < 0))
-            PyErr_WriteUnraisable(self);
-        Py_XDECREF(msg);}
+static int __Pyx_LargePyLong___Pyx_PyLong_As_int(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
 #endif
-        PyObject_GC_Track(self);
-        }
+    const int neg_one = (int) -1, const_zero = (int) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
 #endif
+    const int is_unsigned = neg_one > const_zero;
+    int val;
+    int ret = -1;
+#if PY_VERSION_HEX >= 0x030d00A6 && !CYTHON_COMPILING_IN_LIMITED_API
+    Py_ssize_t bytes_copied = PyLong_AsNativeBytes(
+        x, &val, sizeof(val), Py_ASNATIVEBYTES_NATIVE_ENDIAN | (is_unsigned ? Py_ASNATIVEBYTES_UNSIGNED_BUFFER | Py_ASNATIVEBYTES_REJECT_NEGATIVE : 0));
+    if (unlikely(bytes_copied == -1)) {
+    } else if (unlikely(bytes_copied > (Py_ssize_t) sizeof(val))) {
+        goto raise_overflow;
     } else {
-        PyObject *res = __Pyx_Coroutine_Close(self);
-        if (unlikely(!res)) {
-            if (PyErr_Occurred())
-                PyErr_WriteUnraisable(self);
-        } else {
-            Py_DECREF(res);
+        ret = 0;
+    }
+#elif PY_VERSION_HEX < 0x030d0000 && !(CYTHON_COMPILING_IN_PYPY || CYTHON_COMPILING_IN_LIMITED_API) || defined(_PyLong_AsByteArray)
+    int one = 1; int is_little = (int)*(unsigned char *)&one;
+    unsigned char *bytes = (unsigned char *)&val;
+    ret = _PyLong_AsByteArray((PyLongObject *)x,
+                                bytes, sizeof(val),
+                                is_little, !is_unsigned);
+    if ((0)) goto raise_overflow;
+#else
+    PyObject *v;
+    PyObject *stepval = NULL, *mask = NULL, *shift = NULL;
+    int bits, remaining_bits, is_negative = 0;
+    int chunk_size = (sizeof(long) < 8) ? 30 : 62;
+    if (likely(PyLong_CheckExact(x))) {
+        v = __Pyx_NewRef(x);
+    } else {
+        v = PyNumber_Long(x);
+        if (unlikely(!v)) return (int) -1;
+        assert(PyLong_CheckExact(v));
+    }
+    {
+        int result = PyObject_RichCompareBool(v, Py_False, Py_LT);
+        if (unlikely(result < 0)) {
+            Py_DECREF(v);
+            return (int) -1;
         }
+        is_negative = result == 1;
     }
-    __Pyx_ErrRestore(error_type, error_value, error_traceback);
-#if !CYTHON_USE_TP_FINALIZE
-    assert(self->ob_refcnt > 0);
-    if (--self->ob_refcnt == 0) {
-        return;
+    if (is_unsigned && unlikely(is_negative)) {
+        Py_DECREF(v);
+        PyErr_SetString(PyExc_OverflowError,
+            "can't convert negative value to int");
+        return (int) -1;
+    } else if (is_negative) {
+        stepval = PyNumber_Invert(v);
+        Py_DECREF(v);
+        if (unlikely(!stepval))
+            return (int) -1;
+    } else {
+        stepval = v;
     }
+    v = NULL;
+    val = (int) 0;
+    mask = PyLong_FromLong((1L << chunk_size) - 1); if (unlikely(!mask)) goto done;
+    shift = PyLong_FromLong(chunk_size); if (unlikely(!shift)) goto done;
+    for (bits = 0; bits < (int) sizeof(int) * 8 - chunk_size; bits += chunk_size) {
+        PyObject *tmp, *digit;
+        long idigit;
+        digit = PyNumber_And(stepval, mask);
+        if (unlikely(!digit)) goto done;
+        idigit = PyLong_AsLong(digit);
+        Py_DECREF(digit);
+        if (unlikely(idigit < 0)) goto done;
+        val |= ((int) idigit) << bits;
+        tmp = PyNumber_Rshift(stepval, shift);
+        if (unlikely(!tmp)) goto done;
+        Py_DECREF(stepval); stepval = tmp;
+    }
+    Py_DECREF(shift); shift = NULL;
+    Py_DECREF(mask); mask = NULL;
     {
-        Py_ssize_t refcnt = self->ob_refcnt;
-        _Py_NewReference(self);
-        __Pyx_SET_REFCNT(self, refcnt);
+        long idigit = PyLong_AsLong(stepval);
+        if (unlikely(idigit < 0)) goto done;
+        remaining_bits = ((int) sizeof(int) * 8) - bits - (is_unsigned ? 0 : 1);
+        if (unlikely(idigit >= (1L << remaining_bits)))
+            goto raise_overflow;
+        val |= ((int) idigit) << bits;
     }
-#if CYTHON_COMPILING_IN_CPYTHON
-    assert(PyType_IS_GC(self->ob_type) &&
-           _Py_AS_GC(self)->gc.gc_refs != _PyGC_REFS_UNTRACKED);
-    _Py_DEC_REFTOTAL;
-#endif
-#ifdef COUNT_ALLOCS
-    --Py_TYPE(self)->tp_frees;
-    --Py_TYPE(self)->tp_allocs;
-#endif
+    if (!is_unsigned) {
+        if (unlikely(val & (((int) 1) << (sizeof(int) * 8 - 1))))
+            goto raise_overflow;
+        if (is_negative)
+            val = ~val;
+    }
+    ret = 0;
+done:
+    Py_XDECREF(shift);
+    Py_XDECREF(mask);
+    Py_XDECREF(stepval);
 #endif
+    if (unlikely(ret))
+        return (int) -1;
+    return val;
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_int();
 }
-static PyObject *
-__Pyx_Coroutine_get_name(__pyx_CoroutineObject *self, CYTHON_UNUSED void *context)
-{
-    PyObject *name = self->gi_name;
-    if (unlikely(!name)) name = Py_None;
-    Py_INCREF(name);
-    return name;
-}
-static int
-__Pyx_Coroutine_set_name(__pyx_CoroutineObject *self, PyObject *value, CYTHON_UNUSED void *context)
-{
-    PyObject *tmp;
-#if PY_MAJOR_VERSION >= 3
-    if (unlikely(value == NULL || !PyUnicode_Check(value)))
-#else
-    if (unlikely(value == NULL || !PyString_Check(value)))
+static CYTHON_INLINE int __Pyx_PyLong___Pyx_PyLong_As_int(PyObject *x) {
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
 #endif
-    {
-        PyErr_SetString(PyExc_TypeError,
-                        "__name__ must be set to a string object");
-        return -1;
-    }
-    tmp = self->gi_name;
-    Py_INCREF(value);
-    self->gi_name = value;
-    Py_XDECREF(tmp);
-    return 0;
-}
-static PyObject *
-__Pyx_Coroutine_get_qualname(__pyx_CoroutineObject *self, CYTHON_UNUSED void *context)
-{
-    PyObject *name = self->gi_qualname;
-    if (unlikely(!name)) name = Py_None;
-    Py_INCREF(name);
-    return name;
-}
-static int
-__Pyx_Coroutine_set_qualname(__pyx_CoroutineObject *self, PyObject *value, CYTHON_UNUSED void *context)
-{
-    PyObject *tmp;
-#if PY_MAJOR_VERSION >= 3
-    if (unlikely(value == NULL || !PyUnicode_Check(value)))
-#else
-    if (unlikely(value == NULL || !PyString_Check(value)))
+    const int neg_one = (int) -1, const_zero = (int) 0;
+#ifdef __Pyx_HAS_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
 #endif
-    {
-        PyErr_SetString(PyExc_TypeError,
-                        "__qualname__ must be set to a string object");
-        return -1;
-    }
-    tmp = self->gi_qualname;
-    Py_INCREF(value);
-    self->gi_qualname = value;
-    Py_XDECREF(tmp);
-    return 0;
-}
-static __pyx_CoroutineObject *__Pyx__Coroutine_New(
-            PyTypeObject* type, __pyx_coroutine_body_t body, PyObject *code, PyObject *closure,
-            PyObject *name, PyObject *qualname, PyObject *module_name) {
-    __pyx_CoroutineObject *gen = PyObject_GC_New(__pyx_CoroutineObject, type);
-    if (unlikely(!gen))
-        return NULL;
-    return __Pyx__Coroutine_NewInit(gen, body, code, closure, name, qualname, module_name);
-}
-static __pyx_CoroutineObject *__Pyx__Coroutine_NewInit(
-            __pyx_CoroutineObject *gen, __pyx_coroutine_body_t body, PyObject *code, PyObject *closure,
-            PyObject *name, PyObject *qualname, PyObject *module_name) {
-    gen->body = body;
-    gen->closure = closure;
-    Py_XINCREF(closure);
-    gen->is_running = 0;
-    gen->resume_label = 0;
-    gen->classobj = NULL;
-    gen->yieldfrom = NULL;
-    gen->gi_exc_state.exc_type = NULL;
-    gen->gi_exc_state.exc_value = NULL;
-    gen->gi_exc_state.exc_traceback = NULL;
-#if CYTHON_USE_EXC_INFO_STACK
-    gen->gi_exc_state.previous_item = NULL;
-#endif
-    gen->gi_weakreflist = NULL;
-    Py_XINCREF(qualname);
-    gen->gi_qualname = qualname;
-    Py_XINCREF(name);
-    gen->gi_name = name;
-    Py_XINCREF(module_name);
-    gen->gi_modulename = module_name;
-    Py_XINCREF(code);
-    gen->gi_code = code;
-    PyObject_GC_Track(gen);
-    return gen;
-}
-
-/* PatchModuleWithCoroutine */
-static PyObject* __Pyx_Coroutine_patch_module(PyObject* module, const char* py_code) {
-#if defined(__Pyx_Generator_USED) || defined(__Pyx_Coroutine_USED)
-    int result;
-    PyObject *globals, *result_obj;
-    globals = PyDict_New();  if (unlikely(!globals)) goto ignore;
-    result = PyDict_SetItemString(globals, "_cython_coroutine_type",
-    #ifdef __Pyx_Coroutine_USED
-        (PyObject*)__pyx_CoroutineType);
-    #else
-        Py_None);
-    #endif
-    if (unlikely(result < 0)) goto ignore;
-    result = PyDict_SetItemString(globals, "_cython_generator_type",
-    #ifdef __Pyx_Generator_USED
-        (PyObject*)__pyx_GeneratorType);
-    #else
-        Py_None);
-    #endif
-    if (unlikely(result < 0)) goto ignore;
-    if (unlikely(PyDict_SetItemString(globals, "_module", module) < 0)) goto ignore;
-    if (unlikely(PyDict_SetItemString(globals, "__builtins__", __pyx_b) < 0)) goto ignore;
-    result_obj = PyRun_String(py_code, Py_file_input, globals, globals);
-    if (unlikely(!result_obj)) goto ignore;
-    Py_DECREF(result_obj);
-    Py_DECREF(globals);
-    return module;
-ignore:
-    Py_XDECREF(globals);
-    PyErr_WriteUnraisable(module);
-    if (unlikely(PyErr_WarnEx(PyExc_RuntimeWarning, "Cython module failed to patch module with custom type", 1) < 0)) {
-        Py_DECREF(module);
-        module = NULL;
+    const int is_unsigned = neg_one > const_zero;
+    if (is_unsigned) {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (unlikely(__Pyx_PyLong_IsNeg(x))) {
+            goto raise_neg_overflow;
+        } else if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(int, __Pyx_compact_upylong, __Pyx_PyLong_CompactValueUnsigned(x))
+        } else
+        #endif
+        {
+            return __Pyx_PyULong___Pyx_PyLong_As_int(x);
+        }
+    } else {
+        #if CYTHON_USE_PYLONG_INTERNALS
+        if (__Pyx_PyLong_IsCompact(x)) {
+            __PYX_VERIFY_RETURN_INT(int, __Pyx_compact_pylong, __Pyx_PyLong_CompactValue(x))
+        } else
+        #endif
+        {
+            return __Pyx_PySLong___Pyx_PyLong_As_int(x);
+        }
     }
-#else
-    py_code++;
+#if CYTHON_USE_PYLONG_INTERNALS
+raise_neg_overflow:
+    return __Pyx_raise_neg_overflow___Pyx_PyLong_As_int();
+raise_overflow:
+    return __Pyx_raise_overflow___Pyx_PyLong_As_int();
 #endif
-    return module;
 }
-
-/* PatchGeneratorABC */
-#ifndef CYTHON_REGISTER_ABCS
-#define CYTHON_REGISTER_ABCS 1
-#endif
-#if defined(__Pyx_Generator_USED) || defined(__Pyx_Coroutine_USED)
-static PyObject* __Pyx_patch_abc_module(PyObject *module);
-static PyObject* __Pyx_patch_abc_module(PyObject *module) {
-    module = __Pyx_Coroutine_patch_module(
-        module, ""
-"if _cython_generator_type is not None:\n"
-"    try: Generator = _module.Generator\n"
-"    except AttributeError: pass\n"
-"    else: Generator.register(_cython_generator_type)\n"
-"if _cython_coroutine_type is not None:\n"
-"    try: Coroutine = _module.Coroutine\n"
-"    except AttributeError: pass\n"
-"    else: Coroutine.register(_cython_coroutine_type)\n"
-    );
-    return module;
+static int __Pyx_NonPyLong___Pyx_PyLong_As_int(PyObject *x) {
+    int val;
+    PyObject *tmp = __Pyx_PyNumber_Long(x);
+    if (!tmp) return (int) -1;
+    val = __Pyx_PyLong_As_int(tmp);
+    Py_DECREF(tmp);
+    return val;
+}
+static CYTHON_INLINE int __Pyx_PyLong_As_int(PyObject *x) {
+    if (likely(PyLong_Check(x))) {
+        return __Pyx_PyLong___Pyx_PyLong_As_int(x);
+    } else {
+        return __Pyx_NonPyLong___Pyx_PyLong_As_int(x);
+    }
 }
-#endif
-static int __Pyx_patch_abc(void) {
-#if defined(__Pyx_Generator_USED) || defined(__Pyx_Coroutine_USED)
-    static int abc_patched = 0;
-    if (CYTHON_REGISTER_ABCS && !abc_patched) {
-        PyObject *module;
-        module = PyImport_ImportModule((PY_MAJOR_VERSION >= 3) ? "collections.abc" : "collections");
-        if (!module) {
-            PyErr_WriteUnraisable(NULL);
-            if (unlikely(PyErr_WarnEx(PyExc_RuntimeWarning,
-                    ((PY_MAJOR_VERSION >= 3) ?
-                        "Cython module failed to register with collections.abc module" :
-                        "Cython module failed to register with collections module"), 1) < 0)) {
-                return -1;
+
+/* GetRuntimeVersion */
+#if __PYX_LIMITED_VERSION_HEX < 0x030b0000
+void __Pyx_init_runtime_version(void) {
+    if (__Pyx_cached_runtime_version == 0) {
+        const char* rt_version = Py_GetVersion();
+        unsigned long version = 0;
+        unsigned long factor = 0x01000000UL;
+        unsigned int digit = 0;
+        int i = 0;
+        while (factor) {
+            while ('0' <= rt_version[i] && rt_version[i] <= '9') {
+                digit = digit * 10 + (unsigned int) (rt_version[i] - '0');
+                ++i;
             }
-        } else {
-            module = __Pyx_patch_abc_module(module);
-            abc_patched = 1;
-            if (unlikely(!module))
-                return -1;
-            Py_DECREF(module);
-        }
-        module = PyImport_ImportModule("backports_abc");
-        if (module) {
-            module = __Pyx_patch_abc_module(module);
-            Py_XDECREF(module);
-        }
-        if (!module) {
-            PyErr_Clear();
+            version += factor * digit;
+            if (rt_version[i] != '.')
+                break;
+            digit = 0;
+            factor >>= 8;
+            ++i;
         }
+        __Pyx_cached_runtime_version = version;
     }
+}
+#endif
+static unsigned long __Pyx_get_runtime_version(void) {
+#if __PYX_LIMITED_VERSION_HEX >= 0x030b0000
+    return Py_Version & ~0xFFUL;
 #else
-    if ((0)) __Pyx_Coroutine_patch_module(NULL, NULL);
+    return __Pyx_cached_runtime_version;
 #endif
-    return 0;
 }
 
-/* Generator */
-static PyMethodDef __pyx_Generator_methods[] = {
-    {"send", (PyCFunction) __Pyx_Coroutine_Send, METH_O,
-     (char*) PyDoc_STR("send(arg) -> send 'arg' into generator,\nreturn next yielded value or raise StopIteration.")},
-    {"throw", (PyCFunction) __Pyx_Coroutine_Throw, METH_VARARGS,
-     (char*) PyDoc_STR("throw(typ[,val[,tb]]) -> raise exception in generator,\nreturn next yielded value or raise StopIteration.")},
-    {"close", (PyCFunction) __Pyx_Coroutine_Close_Method, METH_NOARGS,
-     (char*) PyDoc_STR("close() -> raise GeneratorExit inside generator.")},
-    {0, 0, 0, 0}
-};
-static PyMemberDef __pyx_Generator_memberlist[] = {
-    {(char *) "gi_running", T_BOOL, offsetof(__pyx_CoroutineObject, is_running), READONLY, NULL},
-    {(char*) "gi_yieldfrom", T_OBJECT, offsetof(__pyx_CoroutineObject, yieldfrom), READONLY,
-     (char*) PyDoc_STR("object being iterated by 'yield from', or None")},
-    {(char*) "gi_code", T_OBJECT, offsetof(__pyx_CoroutineObject, gi_code), READONLY, NULL},
-    {0, 0, 0, 0, 0}
-};
-static PyGetSetDef __pyx_Generator_getsets[] = {
-    {(char *) "__name__", (getter)__Pyx_Coroutine_get_name, (setter)__Pyx_Coroutine_set_name,
-     (char*) PyDoc_STR("name of the generator"), 0},
-    {(char *) "__qualname__", (getter)__Pyx_Coroutine_get_qualname, (setter)__Pyx_Coroutine_set_qualname,
-     (char*) PyDoc_STR("qualified name of the generator"), 0},
-    {0, 0, 0, 0, 0}
-};
-static PyTypeObject __pyx_GeneratorType_type = {
-    PyVarObject_HEAD_INIT(0, 0)
-    "generator",
-    sizeof(__pyx_CoroutineObject),
-    0,
-    (destructor) __Pyx_Coroutine_dealloc,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_HAVE_FINALIZE,
-    0,
-    (traverseproc) __Pyx_Coroutine_traverse,
-    0,
-    0,
-    offsetof(__pyx_CoroutineObject, gi_weakreflist),
-    0,
-    (iternextfunc) __Pyx_Generator_Next,
-    __pyx_Generator_methods,
-    __pyx_Generator_memberlist,
-    __pyx_Generator_getsets,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-#if CYTHON_USE_TP_FINALIZE
-    0,
-#else
-    __Pyx_Coroutine_del,
-#endif
-    0,
-#if CYTHON_USE_TP_FINALIZE
-    __Pyx_Coroutine_del,
-#elif PY_VERSION_HEX >= 0x030400a1
-    0,
-#endif
-#if PY_VERSION_HEX >= 0x030800b1
-    0,
-#endif
-#if PY_VERSION_HEX >= 0x030800b4 && PY_VERSION_HEX < 0x03090000
-    0,
+/* AddModuleRef */
+#if CYTHON_COMPILING_IN_CPYTHON_FREETHREADING && PY_VERSION_HEX < 0x030F00a3
+  static PyObject *__Pyx_PyImport_AddModuleObjectRef(PyObject *name) {
+      PyObject *module_dict = PyImport_GetModuleDict();
+      PyObject *m;
+      if (PyMapping_GetOptionalItem(module_dict, name, &m) < 0) {
+          return NULL;
+      }
+      if (m != NULL && PyModule_Check(m)) {
+          return m;
+      }
+      Py_XDECREF(m);
+      m = PyModule_NewObject(name);
+      if (m == NULL)
+          return NULL;
+      if (PyDict_CheckExact(module_dict)) {
+          PyObject *new_m;
+          (void)PyDict_SetDefaultRef(module_dict, name, m, &new_m);
+          Py_DECREF(m);
+          return new_m;
+      } else {
+           if (PyObject_SetItem(module_dict, name, m) != 0) {
+                Py_DECREF(m);
+                return NULL;
+            }
+            return m;
+      }
+  }
+  static PyObject *__Pyx_PyImport_AddModuleRef(const char *name) {
+      if ((PY_VERSION_HEX >= 0x030E0000) &&  Py_Version >= 0x030E0100) {
+          return PyImport_AddModuleRef(name);
+      }
+      PyObject *py_name = PyUnicode_FromString(name);
+      if (!py_name) return NULL;
+      PyObject *module = __Pyx_PyImport_AddModuleObjectRef(py_name);
+      Py_DECREF(py_name);
+      return module;
+  }
+#elif __PYX_LIMITED_VERSION_HEX < 0x030d0000
+  static PyObject *__Pyx_PyImport_AddModuleRef(const char *name) {
+      PyObject *module = PyImport_AddModule(name);
+      Py_XINCREF(module);
+      return module;
+  }
 #endif
-};
-static int __pyx_Generator_init(void) {
-    __pyx_GeneratorType_type.tp_getattro = __Pyx_PyObject_GenericGetAttrNoDict;
-    __pyx_GeneratorType_type.tp_iter = PyObject_SelfIter;
-    __pyx_GeneratorType = __Pyx_FetchCommonType(&__pyx_GeneratorType_type);
-    if (unlikely(!__pyx_GeneratorType)) {
-        return -1;
-    }
-    return 0;
-}
 
 /* CheckBinaryVersion */
-static int __Pyx_check_binary_version(void) {
-    char ctversion[4], rtversion[4];
-    PyOS_snprintf(ctversion, 4, "%d.%d", PY_MAJOR_VERSION, PY_MINOR_VERSION);
-    PyOS_snprintf(rtversion, 4, "%s", Py_GetVersion());
-    if (ctversion[0] != rtversion[0] || ctversion[2] != rtversion[2]) {
+static int __Pyx_check_binary_version(unsigned long ct_version, unsigned long rt_version, int allow_newer) {
+    const unsigned long MAJOR_MINOR = 0xFFFF0000UL;
+    if ((rt_version & MAJOR_MINOR) == (ct_version & MAJOR_MINOR))
+        return 0;
+    if (likely(allow_newer && (rt_version & MAJOR_MINOR) > (ct_version & MAJOR_MINOR)))
+        return 1;
+    {
         char message[200];
         PyOS_snprintf(message, sizeof(message),
-                      "compiletime version %s of module '%.100s' "
-                      "does not match runtime version %s",
-                      ctversion, __Pyx_MODULE_NAME, rtversion);
+                      "compile time Python version %d.%d "
+                      "of module '%.100s' "
+                      "%s "
+                      "runtime version %d.%d",
+                       (int) (ct_version >> 24), (int) ((ct_version >> 16) & 0xFF),
+                       __Pyx_MODULE_NAME,
+                       (allow_newer) ? "was newer than" : "does not match",
+                       (int) (rt_version >> 24), (int) ((rt_version >> 16) & 0xFF)
+       );
         return PyErr_WarnEx(NULL, message, 1);
     }
-    return 0;
 }
 
-/* InitStrings */
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
+/* NewCodeObj */
+#if CYTHON_COMPILING_IN_LIMITED_API
+    static PyObject* __Pyx__PyCode_New(int a, int p, int k, int l, int s, int f,
+                                       PyObject *code, PyObject *c, PyObject* n, PyObject *v,
+                                       PyObject *fv, PyObject *cell, PyObject* fn,
+                                       PyObject *name, int fline, PyObject *lnos) {
+        PyObject *exception_table = NULL;
+        PyObject *types_module=NULL, *code_type=NULL, *result=NULL;
+        #if __PYX_LIMITED_VERSION_HEX < 0x030b0000
+        PyObject *version_info;
+        PyObject *py_minor_version = NULL;
+        #endif
+        long minor_version = 0;
+        #if __PYX_LIMITED_VERSION_HEX >= 0x030b0000
+        minor_version = 11;
+        #else
+        if (!(version_info = PySys_GetObject("version_info"))) goto end;
+        if (!(py_minor_version = PySequence_GetItem(version_info, 1))) goto end;
+        minor_version = PyLong_AsLong(py_minor_version);
+        Py_DECREF(py_minor_version);
+        if (minor_version == -1 && PyErr_Occurred()) goto end;
+        #endif
+        if (!(types_module = PyImport_ImportModule("types"))) goto end;
+        if (!(code_type = PyObject_GetAttrString(types_module, "CodeType"))) goto end;
+        if (minor_version <= 10) {
+            result = PyObject_CallFunction(code_type, "iiiiiiOOOOOOiOOO", a,p, k, l, s, f, code,
+                          c, n, v, fn, name, fline, lnos, fv, cell);
         } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
+            if (!(exception_table = PyBytes_FromStringAndSize(NULL, 0))) goto end;
+            result = PyObject_CallFunction(code_type, "iiiiiiOOOOOOOiOOOO", a,p, k, l, s, f, code,
+                          c, n, v, fn, name, name, fline, lnos, exception_table, fv, cell);
         }
+    end:
+        Py_XDECREF(code_type);
+        Py_XDECREF(exception_table);
+        Py_XDECREF(types_module);
+        if (!result) {
+            PyObject *exc_type, *exc_value, *exc_tb;
+            PyErr_Fetch(&exc_type, &exc_value, &exc_tb);
+            if (PyErr_WarnFormat(
+                    PyExc_RuntimeWarning, 1,
+                    "Code object creation failed in Cython module: %S\nTry recompiling with a more recent version of Cython.",
+                    exc_value ? exc_value : exc_type) == 0) {
+                result = Py_None;
+                Py_INCREF(result);
+            }
+            Py_DECREF(exc_type);
+            Py_XDECREF(exc_value);
+            Py_XDECREF(exc_tb);
+        }
+        return result;
+    }
+#elif PY_VERSION_HEX >= 0x030B0000
+  static PyCodeObject* __Pyx__PyCode_New(int a, int p, int k, int l, int s, int f,
+                                         PyObject *code, PyObject *c, PyObject* n, PyObject *v,
+                                         PyObject *fv, PyObject *cell, PyObject* fn,
+                                         PyObject *name, int fline, PyObject *lnos) {
+    PyCodeObject *result;
+    result =
+      #if PY_VERSION_HEX >= 0x030C0000
+        PyUnstable_Code_NewWithPosOnlyArgs
+      #else
+        PyCode_NewWithPosOnlyArgs
+      #endif
+        (a, p, k, l, s, f, code, c, n, v, fv, cell, fn, name, name, fline, lnos, __pyx_mstate_global->__pyx_empty_bytes);
+    #if CYTHON_COMPILING_IN_CPYTHON && PY_VERSION_HEX >= 0x030c00A1
+    if (likely(result))
+        result->_co_firsttraceable = 0;
+    #endif
+    return result;
+  }
+#elif !CYTHON_COMPILING_IN_PYPY
+  #define __Pyx__PyCode_New(a, p, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
+          PyCode_NewWithPosOnlyArgs(a, p, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
+#else
+  #define __Pyx__PyCode_New(a, p, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)\
+          PyCode_New(a, k, l, s, f, code, c, n, v, fv, cell, fn, name, fline, lnos)
+#endif
+static PyObject* __Pyx_PyCode_New(
+        const __Pyx_PyCode_New_function_description descr,
+        PyObject * const *varnames,
+        PyObject *filename,
+        PyObject *funcname,
+        PyObject *line_table,
+        PyObject *tuple_dedup_map
+) {
+    PyObject *code_obj = NULL, *varnames_tuple_dedup = NULL, *code_bytes = NULL;
+    Py_ssize_t var_count = (Py_ssize_t) descr.nlocals;
+    PyObject *varnames_tuple = PyTuple_New(var_count);
+    if (unlikely(!varnames_tuple)) return NULL;
+    for (Py_ssize_t i=0; i < var_count; i++) {
+        Py_INCREF(varnames[i]);
+        if (__Pyx_PyTuple_SET_ITEM(varnames_tuple, i, varnames[i]) != (0)) goto done;
+    }
+    #if CYTHON_COMPILING_IN_LIMITED_API
+    varnames_tuple_dedup = PyDict_GetItem(tuple_dedup_map, varnames_tuple);
+    if (!varnames_tuple_dedup) {
+        if (unlikely(PyDict_SetItem(tuple_dedup_map, varnames_tuple, varnames_tuple) < 0)) goto done;
+        varnames_tuple_dedup = varnames_tuple;
+    }
+    #else
+    varnames_tuple_dedup = PyDict_SetDefault(tuple_dedup_map, varnames_tuple, varnames_tuple);
+    if (unlikely(!varnames_tuple_dedup)) goto done;
+    #endif
+    #if CYTHON_AVOID_BORROWED_REFS
+    Py_INCREF(varnames_tuple_dedup);
+    #endif
+    if (__PYX_LIMITED_VERSION_HEX >= (0x030b0000) && line_table != NULL && !CYTHON_COMPILING_IN_GRAAL) {
+        Py_ssize_t line_table_length = __Pyx_PyBytes_GET_SIZE(line_table);
+        #if !CYTHON_ASSUME_SAFE_SIZE
+        if (unlikely(line_table_length == -1)) goto done;
+        #endif
+        Py_ssize_t code_len = (line_table_length * 2 + 4) & ~3LL;
+        code_bytes = PyBytes_FromStringAndSize(NULL, code_len);
+        if (unlikely(!code_bytes)) goto done;
+        char* c_code_bytes = PyBytes_AsString(code_bytes);
+        if (unlikely(!c_code_bytes)) goto done;
+        memset(c_code_bytes, 0, (size_t) code_len);
+    }
+    code_obj = (PyObject*) __Pyx__PyCode_New(
+        (int) descr.argcount,
+        (int) descr.num_posonly_args,
+        (int) descr.num_kwonly_args,
+        (int) descr.nlocals,
+        0,
+        (int) descr.flags,
+        code_bytes ? code_bytes : __pyx_mstate_global->__pyx_empty_bytes,
+        __pyx_mstate_global->__pyx_empty_tuple,
+        __pyx_mstate_global->__pyx_empty_tuple,
+        varnames_tuple_dedup,
+        __pyx_mstate_global->__pyx_empty_tuple,
+        __pyx_mstate_global->__pyx_empty_tuple,
+        filename,
+        funcname,
+        (int) descr.first_line,
+        (__PYX_LIMITED_VERSION_HEX >= (0x030b0000) && line_table) ? line_table : __pyx_mstate_global->__pyx_empty_bytes
+    );
+done:
+    Py_XDECREF(code_bytes);
+    #if CYTHON_AVOID_BORROWED_REFS
+    Py_XDECREF(varnames_tuple_dedup);
+    #endif
+    Py_DECREF(varnames_tuple);
+    return code_obj;
+}
+
+/* DecompressString */
+CYTHON_UNUSED
+static CYTHON_SMALL_CODE PyObject *__Pyx_DecompressString(const char *s, Py_ssize_t length, int algo) {
+#ifdef __Pyx_DecompressString_UNUSED
+    CYTHON_UNUSED_VAR(s);
+    CYTHON_UNUSED_VAR(length);
+    CYTHON_UNUSED_VAR(algo);
+    return NULL;
+#else
+    PyObject *module = NULL, *decompress, *compressed_bytes, *decompressed;
+    const char* module_name = algo == 3 ? "compression.zstd" : algo == 2 ? "bz2" : "zlib";
+    PyObject *methodname = PyUnicode_FromString("decompress");
+    if (unlikely(!methodname)) return NULL;
+    #if __PYX_LIMITED_VERSION_HEX >= 0x030e0000
+    if (algo == 3) {
+        PyObject *fromlist = Py_BuildValue("[O]", methodname);
+        if (unlikely(!fromlist)) goto bad;
+        module = PyImport_ImportModuleLevel("compression.zstd", NULL, NULL, fromlist, 0);
+        Py_DECREF(fromlist);
+    } else
+    #endif
+        module = PyImport_ImportModule(module_name);
+    if (unlikely(!module)) goto import_failed;
+    decompress = PyObject_GetAttr(module, methodname);
+    if (unlikely(!decompress)) goto import_failed;
+    {
+        #ifdef __cplusplus
+            char *memview_bytes = const_cast<char*>(s);
         #else
-        if (t->is_unicode | t->is_str) {
-            if (t->intern) {
-                *t->p = PyUnicode_InternFromString(t->s);
-            } else if (t->encoding) {
-                *t->p = PyUnicode_Decode(t->s, t->n - 1, t->encoding, NULL);
+            #if defined(__clang__)
+              #pragma clang diagnostic push
+              #pragma clang diagnostic ignored "-Wcast-qual"
+            #elif !defined(__INTEL_COMPILER) && defined(__GNUC__)
+              #pragma GCC diagnostic push
+              #pragma GCC diagnostic ignored "-Wcast-qual"
+            #endif
+            char *memview_bytes = (char*) s;
+            #if defined(__clang__)
+              #pragma clang diagnostic pop
+            #elif !defined(__INTEL_COMPILER) && defined(__GNUC__)
+              #pragma GCC diagnostic pop
+            #endif
+        #endif
+        #if CYTHON_COMPILING_IN_LIMITED_API && !defined(PyBUF_READ)
+        int memview_flags = 0x100;
+        #else
+        int memview_flags = PyBUF_READ;
+        #endif
+        compressed_bytes = PyMemoryView_FromMemory(memview_bytes, length, memview_flags);
+    }
+    if (unlikely(!compressed_bytes)) {
+        Py_DECREF(decompress);
+        goto bad;
+    }
+    decompressed = PyObject_CallFunctionObjArgs(decompress, compressed_bytes, NULL);
+    Py_DECREF(compressed_bytes);
+    Py_DECREF(decompress);
+    Py_DECREF(module);
+    Py_DECREF(methodname);
+    return decompressed;
+import_failed:
+    PyErr_Format(PyExc_ImportError,
+        "Failed to import '%.20s.decompress' - cannot initialise module strings. "
+        "String compression was configured with the C macro 'CYTHON_COMPRESS_STRINGS=%d'.",
+        module_name, algo);
+bad:
+    Py_XDECREF(module);
+    Py_DECREF(methodname);
+    return NULL;
+#endif
+}
+
+/* DecompressString_LZSS */
+#ifndef __Pyx_DecompressString_LZSS_UNUSED
+CYTHON_UNUSED
+static CYTHON_SMALL_CODE size_t __pyx_lzss_decompress(const uint8_t* src, uint8_t* dst, size_t dst_len) {
+    size_t pos = 0, out_pos = 0;
+    while (1) {
+        uint32_t flags = src[pos++] | 0xFF00;
+        while (flags & 0x100) {
+            if (flags & 1) {
+                dst[out_pos++] = src[pos++];
             } else {
-                *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
+                uint32_t lo = src[pos++], hi = src[pos++];
+                uint32_t end_offset_of_last_occurrence, match_length;
+                if (!(lo & 0x80)) {
+                    end_offset_of_last_occurrence = lo;
+                    match_length = hi;
+                } else if (!(hi & 0x80)) {
+                    end_offset_of_last_occurrence = 0x80 + (((hi << 2) & 0x180) | (lo & 0x7F));
+                    match_length = hi & 0x1F;
+                } else {
+                    end_offset_of_last_occurrence = 0x80 + ((hi & 0x7F) << 7 | (lo & 0x7F));
+                    match_length = src[pos++];
+                }
+                match_length += 3;
+                size_t ref_pos = out_pos - end_offset_of_last_occurrence - match_length;
+                memcpy(dst + out_pos, dst + ref_pos, match_length);
+                out_pos += match_length;
             }
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
+            if (out_pos >= dst_len) return pos;
+            flags >>= 1;
         }
-        #endif
-        if (!*t->p)
-            return -1;
-        if (PyObject_Hash(*t->p) == -1)
-            return -1;
-        ++t;
     }
-    return 0;
+}
+#endif
+static CYTHON_SMALL_CODE PyObject *__Pyx_DecompressString_LZSS(const char *s, size_t compressed_length, size_t uncompressed_length) {
+#ifdef __Pyx_DecompressString_LZSS_UNUSED
+    CYTHON_UNUSED_VAR(s);
+    CYTHON_UNUSED_VAR(compressed_length);
+    CYTHON_UNUSED_VAR(uncompressed_length);
+    return NULL;
+#else
+    PyObject *result;
+    unsigned char *result_data;
+    size_t src_length;
+    result = PyBytes_FromStringAndSize(NULL, (Py_ssize_t) uncompressed_length);
+    if (unlikely(!result)) return NULL;
+    result_data = __Pyx_PyBytes_AsWritableUString(result);
+    if (unlikely(!result_data)) goto bad;
+    src_length = __pyx_lzss_decompress((const uint8_t*) s, result_data, uncompressed_length);
+    if (unlikely(src_length != compressed_length)) goto decompression_failed;
+    return result;
+decompression_failed:
+    PyErr_SetString(PyExc_RuntimeError, "LZSS string data decompression failed");
+bad:
+    Py_DECREF(result);
+    return NULL;
+#endif
 }
 
+#include <string.h>
+static CYTHON_INLINE Py_ssize_t __Pyx_ssize_strlen(const char *s) {
+    size_t len = strlen(s);
+    if (unlikely(len > (size_t) PY_SSIZE_T_MAX)) {
+        PyErr_SetString(PyExc_OverflowError, "byte string is too long");
+        return -1;
+    }
+    return (Py_ssize_t) len;
+}
 static CYTHON_INLINE PyObject* __Pyx_PyUnicode_FromString(const char* c_str) {
-    return __Pyx_PyUnicode_FromStringAndSize(c_str, (Py_ssize_t)strlen(c_str));
+    Py_ssize_t len = __Pyx_ssize_strlen(c_str);
+    if (unlikely(len < 0)) return NULL;
+    return __Pyx_PyUnicode_FromStringAndSize(c_str, len);
+}
+static CYTHON_INLINE PyObject* __Pyx_PyByteArray_FromString(const char* c_str) {
+    Py_ssize_t len = __Pyx_ssize_strlen(c_str);
+    if (unlikely(len < 0)) return NULL;
+    return PyByteArray_FromStringAndSize(c_str, len);
 }
 static CYTHON_INLINE const char* __Pyx_PyObject_AsString(PyObject* o) {
     Py_ssize_t ignore;
     return __Pyx_PyObject_AsStringAndSize(o, &ignore);
 }
-#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT
-#if !CYTHON_PEP393_ENABLED
-static const char* __Pyx_PyUnicode_AsStringAndSize(PyObject* o, Py_ssize_t *length) {
-    char* defenc_c;
-    PyObject* defenc = _PyUnicode_AsDefaultEncodedString(o, NULL);
-    if (!defenc) return NULL;
-    defenc_c = PyBytes_AS_STRING(defenc);
-#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
+#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_UTF8
+static CYTHON_INLINE const char* __Pyx_PyUnicode_AsStringAndSize(PyObject* o, Py_ssize_t *length) {
+    if (unlikely(__Pyx_PyUnicode_READY(o) == -1)) return NULL;
+#if CYTHON_COMPILING_IN_LIMITED_API
     {
-        char* end = defenc_c + PyBytes_GET_SIZE(defenc);
-        char* c;
-        for (c = defenc_c; c < end; c++) {
-            if ((unsigned char) (*c) >= 128) {
-                PyUnicode_AsASCIIString(o);
-                return NULL;
-            }
+        const char* result;
+        Py_ssize_t unicode_length;
+        CYTHON_MAYBE_UNUSED_VAR(unicode_length); // only for __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
+        #if __PYX_LIMITED_VERSION_HEX < 0x030A0000
+        if (unlikely(PyArg_Parse(o, "s#", &result, length) < 0)) return NULL;
+        #else
+        result = PyUnicode_AsUTF8AndSize(o, length);
+        #endif
+        #if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
+        unicode_length = PyUnicode_GetLength(o);
+        if (unlikely(unicode_length < 0)) return NULL;
+        if (unlikely(unicode_length != *length)) {
+            PyUnicode_AsASCIIString(o);
+            return NULL;
         }
+        #endif
+        return result;
     }
-#endif
-    *length = PyBytes_GET_SIZE(defenc);
-    return defenc_c;
-}
 #else
-static CYTHON_INLINE const char* __Pyx_PyUnicode_AsStringAndSize(PyObject* o, Py_ssize_t *length) {
-    if (unlikely(__Pyx_PyUnicode_READY(o) == -1)) return NULL;
 #if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
     if (likely(PyUnicode_IS_ASCII(o))) {
         *length = PyUnicode_GET_LENGTH(o);
@@ -5718,25 +17321,25 @@ static CYTHON_INLINE const char* __Pyx_PyUnicode_AsStringAndSize(PyObject* o, Py
 #else
     return PyUnicode_AsUTF8AndSize(o, length);
 #endif
-}
 #endif
+}
 #endif
 static CYTHON_INLINE const char* __Pyx_PyObject_AsStringAndSize(PyObject* o, Py_ssize_t *length) {
-#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_DEFAULT
-    if (
-#if PY_MAJOR_VERSION < 3 && __PYX_DEFAULT_STRING_ENCODING_IS_ASCII
-            __Pyx_sys_getdefaultencoding_not_ascii &&
-#endif
-            PyUnicode_Check(o)) {
+#if __PYX_DEFAULT_STRING_ENCODING_IS_ASCII || __PYX_DEFAULT_STRING_ENCODING_IS_UTF8
+    if (PyUnicode_Check(o)) {
         return __Pyx_PyUnicode_AsStringAndSize(o, length);
     } else
 #endif
-#if (!CYTHON_COMPILING_IN_PYPY) || (defined(PyByteArray_AS_STRING) && defined(PyByteArray_GET_SIZE))
     if (PyByteArray_Check(o)) {
+#if (CYTHON_ASSUME_SAFE_SIZE && CYTHON_ASSUME_SAFE_MACROS) || (CYTHON_COMPILING_IN_PYPY && (defined(PyByteArray_AS_STRING) && defined(PyByteArray_GET_SIZE)))
         *length = PyByteArray_GET_SIZE(o);
         return PyByteArray_AS_STRING(o);
-    } else
+#else
+        *length = PyByteArray_Size(o);
+        if (*length == -1) return NULL;
+        return PyByteArray_AsString(o);
 #endif
+    } else
     {
         char* result;
         int r = PyBytes_AsStringAndSize(o, &result, length);
@@ -5759,143 +17362,450 @@ static CYTHON_INLINE int __Pyx_PyObject_IsTrueAndDecref(PyObject* x) {
     Py_DECREF(x);
     return retval;
 }
-static PyObject* __Pyx_PyNumber_IntOrLongWrongResultType(PyObject* result, const char* type_name) {
-#if PY_MAJOR_VERSION >= 3
+static PyObject* __Pyx_PyNumber_LongWrongResultType(PyObject* result) {
+    __Pyx_TypeName result_type_name = __Pyx_PyType_GetFullyQualifiedName(Py_TYPE(result));
+    #if CYTHON_COMPILING_IN_LIMITED_API && __PYX_LIMITED_VERSION_HEX < 0x030d0000
+    if (unlikely(!result_type_name)) goto bad;
+    #endif
     if (PyLong_Check(result)) {
         if (PyErr_WarnFormat(PyExc_DeprecationWarning, 1,
-                "__int__ returned non-int (type %.200s).  "
-                "The ability to return an instance of a strict subclass of int "
-                "is deprecated, and may be removed in a future version of Python.",
-                Py_TYPE(result)->tp_name)) {
-            Py_DECREF(result);
-            return NULL;
+                "__int__ returned non-int (type " __Pyx_FMT_TYPENAME ").  "
+                "The ability to return an instance of a strict subclass of int is deprecated, "
+                "and may be removed in a future version of Python.",
+                result_type_name)) {
+            __Pyx_DECREF_TypeName(result_type_name);
+            goto bad;
         }
+        __Pyx_DECREF_TypeName(result_type_name);
         return result;
     }
-#endif
     PyErr_Format(PyExc_TypeError,
-                 "__%.4s__ returned non-%.4s (type %.200s)",
-                 type_name, type_name, Py_TYPE(result)->tp_name);
+                 "__int__ returned non-int (type " __Pyx_FMT_TYPENAME ")",
+                 result_type_name);
+    __Pyx_DECREF_TypeName(result_type_name);
+bad:
     Py_DECREF(result);
     return NULL;
 }
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_IntOrLong(PyObject* x) {
+static CYTHON_INLINE PyObject* __Pyx_PyNumber_Long(PyObject* x) {
 #if CYTHON_USE_TYPE_SLOTS
   PyNumberMethods *m;
 #endif
-  const char *name = NULL;
   PyObject *res = NULL;
-#if PY_MAJOR_VERSION < 3
-  if (likely(PyInt_Check(x) || PyLong_Check(x)))
-#else
   if (likely(PyLong_Check(x)))
-#endif
-    return __Pyx_NewRef(x);
+      return __Pyx_NewRef(x);
 #if CYTHON_USE_TYPE_SLOTS
   m = Py_TYPE(x)->tp_as_number;
-  #if PY_MAJOR_VERSION < 3
-  if (m && m->nb_int) {
-    name = "int";
-    res = m->nb_int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = m->nb_long(x);
-  }
-  #else
   if (likely(m && m->nb_int)) {
-    name = "int";
-    res = m->nb_int(x);
+      res = m->nb_int(x);
   }
-  #endif
 #else
   if (!PyBytes_CheckExact(x) && !PyUnicode_CheckExact(x)) {
-    res = PyNumber_Int(x);
+      res = PyNumber_Long(x);
   }
 #endif
   if (likely(res)) {
-#if PY_MAJOR_VERSION < 3
-    if (unlikely(!PyInt_Check(res) && !PyLong_Check(res))) {
-#else
-    if (unlikely(!PyLong_CheckExact(res))) {
-#endif
-        return __Pyx_PyNumber_IntOrLongWrongResultType(res, name);
-    }
+      if (unlikely(!PyLong_CheckExact(res))) {
+          return __Pyx_PyNumber_LongWrongResultType(res);
+      }
   }
   else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
+      PyErr_SetString(PyExc_TypeError,
+                      "an integer is required");
   }
   return res;
 }
-static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject *x;
-#if PY_MAJOR_VERSION < 3
-  if (likely(PyInt_CheckExact(b))) {
-    if (sizeof(Py_ssize_t) >= sizeof(long))
-        return PyInt_AS_LONG(b);
-    else
-        return PyInt_AsSsize_t(b);
-  }
-#endif
-  if (likely(PyLong_CheckExact(b))) {
+static CYTHON_INLINE Py_ssize_t __Pyx_PyLong_AsSsize_t(PyObject* b) {
     #if CYTHON_USE_PYLONG_INTERNALS
-    const digit* digits = ((PyLongObject*)b)->ob_digit;
-    const Py_ssize_t size = Py_SIZE(b);
-    if (likely(__Pyx_sst_abs(size) <= 1)) {
-        ival = likely(size) ? digits[0] : 0;
-        if (size == -1) ival = -ival;
-        return ival;
-    } else {
-      switch (size) {
-         case 2:
-           if (8 * sizeof(Py_ssize_t) > 2 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -2:
-           if (8 * sizeof(Py_ssize_t) > 2 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case 3:
-           if (8 * sizeof(Py_ssize_t) > 3 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -3:
-           if (8 * sizeof(Py_ssize_t) > 3 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case 4:
-           if (8 * sizeof(Py_ssize_t) > 4 * PyLong_SHIFT) {
-             return (Py_ssize_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-         case -4:
-           if (8 * sizeof(Py_ssize_t) > 4 * PyLong_SHIFT) {
-             return -(Py_ssize_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
-           }
-           break;
-      }
-    }
+    Py_ssize_t ival;
+    const Py_ssize_t size = __Pyx_PyLong_DigitCount(b);
+    const int is_neg = __Pyx_PyLong_IsNeg(b);
+    const digit* digits = __Pyx_PyLong_Digits(b);
+    if (size == 0) return 0;
+    #if SIZEOF_SIZE_T * 8 > 1 * PyLong_SHIFT
+    if (size == 1) {
+        ival = (Py_ssize_t) (((size_t)digits[0]));
+    } else
     #endif
+    #if SIZEOF_SIZE_T * 8 > 2 * PyLong_SHIFT
+    if (size == 2) {
+        ival = (Py_ssize_t) (((((size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+    } else
+    #endif
+    #if SIZEOF_SIZE_T * 8 > 3 * PyLong_SHIFT
+    if (size == 3) {
+        ival = (Py_ssize_t) (((((((size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+    } else
+    #endif
+    #if SIZEOF_SIZE_T * 8 > 4 * PyLong_SHIFT
+    if (size == 4) {
+        ival = (Py_ssize_t) (((((((((size_t)digits[3]) << PyLong_SHIFT) | (size_t)digits[2]) << PyLong_SHIFT) | (size_t)digits[1]) << PyLong_SHIFT) | (size_t)digits[0]));
+    } else
+    #endif
+        return PyLong_AsSsize_t(b);
+    return is_neg ? -ival : ival;
+    #else
     return PyLong_AsSsize_t(b);
+    #endif
+}
+static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
+    if (likely(PyLong_Check(b))) {
+        return __Pyx_PyLong_AsSsize_t(b);
+    } else {
+        Py_ssize_t ival;
+        PyObject *x = PyNumber_Index(b);
+        if (unlikely(!x)) return -1;
+        ival = __Pyx_PyLong_AsSsize_t(x);
+        Py_DECREF(x);
+        return ival;
+    }
+}
+static CYTHON_INLINE Py_hash_t __Pyx_PyIndex_AsHash_t(PyObject* o) {
+  if (sizeof(Py_hash_t) == sizeof(Py_ssize_t)) {
+    return (Py_hash_t) __Pyx_PyIndex_AsSsize_t(o);
+  } else {
+    Py_ssize_t ival;
+    PyObject *x;
+    x = PyNumber_Index(o);
+    if (!x) return -1;
+    ival = PyLong_AsLong(x);
+    Py_DECREF(x);
+    return ival;
   }
-  x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
+}
+static CYTHON_INLINE PyObject *__Pyx_Owned_Py_None(int b) {
+    CYTHON_UNUSED_VAR(b);
+    return __Pyx_NewRef(Py_None);
 }
 static CYTHON_INLINE PyObject * __Pyx_PyBool_FromLong(long b) {
-  return b ? __Pyx_NewRef(Py_True) : __Pyx_NewRef(Py_False);
+  return __Pyx_NewRef(b ? Py_True: Py_False);
+}
+static CYTHON_INLINE PyObject * __Pyx_PyLong_FromSize_t(size_t ival) {
+    return PyLong_FromSize_t(ival);
+}
+
+
+/* MultiPhaseInitModuleState */
+#if CYTHON_PEP489_MULTI_PHASE_INIT && CYTHON_USE_MODULE_STATE
+#ifndef CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+#if (CYTHON_COMPILING_IN_LIMITED_API || PY_VERSION_HEX >= 0x030C0000)
+  #define CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE 1
+#else
+  #define CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE 0
+#endif
+#endif
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE && !CYTHON_ATOMICS
+#error "Module state with PEP489 requires atomics. Currently that's one of\
+ C11, C++11, gcc atomic intrinsics or MSVC atomic intrinsics"
+#endif
+#if !CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+#define __Pyx_ModuleStateLookup_Lock()
+#define __Pyx_ModuleStateLookup_Unlock()
+#elif !CYTHON_COMPILING_IN_LIMITED_API && PY_VERSION_HEX >= 0x030d0000
+static PyMutex __Pyx_ModuleStateLookup_mutex = {0};
+#define __Pyx_ModuleStateLookup_Lock() PyMutex_Lock(&__Pyx_ModuleStateLookup_mutex)
+#define __Pyx_ModuleStateLookup_Unlock() PyMutex_Unlock(&__Pyx_ModuleStateLookup_mutex)
+#elif defined(__cplusplus) && __cplusplus >= 201103L
+#include <mutex>
+static std::mutex __Pyx_ModuleStateLookup_mutex;
+#define __Pyx_ModuleStateLookup_Lock() __Pyx_ModuleStateLookup_mutex.lock()
+#define __Pyx_ModuleStateLookup_Unlock() __Pyx_ModuleStateLookup_mutex.unlock()
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ > 201112L) && !defined(__STDC_NO_THREADS__)
+#include <threads.h>
+static mtx_t __Pyx_ModuleStateLookup_mutex;
+static once_flag __Pyx_ModuleStateLookup_mutex_once_flag = ONCE_FLAG_INIT;
+static void __Pyx_ModuleStateLookup_initialize_mutex(void) {
+    mtx_init(&__Pyx_ModuleStateLookup_mutex, mtx_plain);
+}
+#define __Pyx_ModuleStateLookup_Lock()\
+  call_once(&__Pyx_ModuleStateLookup_mutex_once_flag, __Pyx_ModuleStateLookup_initialize_mutex);\
+  mtx_lock(&__Pyx_ModuleStateLookup_mutex)
+#define __Pyx_ModuleStateLookup_Unlock() mtx_unlock(&__Pyx_ModuleStateLookup_mutex)
+#elif defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+static pthread_mutex_t __Pyx_ModuleStateLookup_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define __Pyx_ModuleStateLookup_Lock() pthread_mutex_lock(&__Pyx_ModuleStateLookup_mutex)
+#define __Pyx_ModuleStateLookup_Unlock() pthread_mutex_unlock(&__Pyx_ModuleStateLookup_mutex)
+#elif defined(_WIN32)
+#include <Windows.h>  // synchapi.h on its own doesn't work
+static SRWLOCK __Pyx_ModuleStateLookup_mutex = SRWLOCK_INIT;
+#define __Pyx_ModuleStateLookup_Lock() AcquireSRWLockExclusive(&__Pyx_ModuleStateLookup_mutex)
+#define __Pyx_ModuleStateLookup_Unlock() ReleaseSRWLockExclusive(&__Pyx_ModuleStateLookup_mutex)
+#else
+#error "No suitable lock available for CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE.\
+ Requires C standard >= C11, or C++ standard >= C++11,\
+ or pthreads, or the Windows 32 API, or Python >= 3.13."
+#endif
+typedef struct {
+    int64_t id;
+    PyObject *module;
+} __Pyx_InterpreterIdAndModule;
+typedef struct {
+    char interpreter_id_as_index;
+    Py_ssize_t count;
+    Py_ssize_t allocated;
+    __Pyx_InterpreterIdAndModule table[1];
+} __Pyx_ModuleStateLookupData;
+#define __PYX_MODULE_STATE_LOOKUP_SMALL_SIZE 32
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+static __pyx_atomic_int_type __Pyx_ModuleStateLookup_read_counter = 0;
+#endif
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+static __pyx_atomic_ptr_type __Pyx_ModuleStateLookup_data = 0;
+#else
+static __Pyx_ModuleStateLookupData* __Pyx_ModuleStateLookup_data = NULL;
+#endif
+static __Pyx_InterpreterIdAndModule* __Pyx_State_FindModuleStateLookupTableLowerBound(
+        __Pyx_InterpreterIdAndModule* table,
+        Py_ssize_t count,
+        int64_t interpreterId) {
+    __Pyx_InterpreterIdAndModule* begin = table;
+    __Pyx_InterpreterIdAndModule* end = begin + count;
+    if (begin->id == interpreterId) {
+        return begin;
+    }
+    while ((end - begin) > __PYX_MODULE_STATE_LOOKUP_SMALL_SIZE) {
+        __Pyx_InterpreterIdAndModule* halfway = begin + (end - begin)/2;
+        if (halfway->id == interpreterId) {
+            return halfway;
+        }
+        if (halfway->id < interpreterId) {
+            begin = halfway;
+        } else {
+            end = halfway;
+        }
+    }
+    for (; begin < end; ++begin) {
+        if (begin->id >= interpreterId) return begin;
+    }
+    return begin;
+}
+static PyObject *__Pyx_State_FindModule(CYTHON_UNUSED void* dummy) {
+    int64_t interpreter_id = PyInterpreterState_GetID(PyInterpreterState_Get());
+    if (interpreter_id == -1) return NULL;
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+    __Pyx_ModuleStateLookupData* data = (__Pyx_ModuleStateLookupData*)__pyx_atomic_pointer_load_relaxed(&__Pyx_ModuleStateLookup_data);
+    {
+        __pyx_atomic_incr_acq_rel(&__Pyx_ModuleStateLookup_read_counter);
+        if (likely(data)) {
+            __Pyx_ModuleStateLookupData* new_data = (__Pyx_ModuleStateLookupData*)__pyx_atomic_pointer_load_acquire(&__Pyx_ModuleStateLookup_data);
+            if (likely(data == new_data)) {
+                goto read_finished;
+            }
+        }
+        __pyx_atomic_decr_acq_rel(&__Pyx_ModuleStateLookup_read_counter);
+        __Pyx_ModuleStateLookup_Lock();
+        __pyx_atomic_incr_relaxed(&__Pyx_ModuleStateLookup_read_counter);
+        data = (__Pyx_ModuleStateLookupData*)__pyx_atomic_pointer_load_relaxed(&__Pyx_ModuleStateLookup_data);
+        __Pyx_ModuleStateLookup_Unlock();
+    }
+  read_finished:;
+#else
+    __Pyx_ModuleStateLookupData* data = __Pyx_ModuleStateLookup_data;
+#endif
+    __Pyx_InterpreterIdAndModule* found = NULL;
+    if (unlikely(!data)) goto end;
+    if (data->interpreter_id_as_index) {
+        if (interpreter_id < data->count) {
+            found = data->table+interpreter_id;
+        }
+    } else {
+        found = __Pyx_State_FindModuleStateLookupTableLowerBound(
+            data->table, data->count, interpreter_id);
+    }
+  end:
+    {
+        PyObject *result=NULL;
+        if (found && found->id == interpreter_id) {
+            result = found->module;
+        }
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+        __pyx_atomic_decr_acq_rel(&__Pyx_ModuleStateLookup_read_counter);
+#endif
+        return result;
+    }
+}
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+static void __Pyx_ModuleStateLookup_wait_until_no_readers(void) {
+    while (__pyx_atomic_load(&__Pyx_ModuleStateLookup_read_counter) != 0);
+}
+#else
+#define __Pyx_ModuleStateLookup_wait_until_no_readers()
+#endif
+static int __Pyx_State_AddModuleInterpIdAsIndex(__Pyx_ModuleStateLookupData **old_data, PyObject* module, int64_t interpreter_id) {
+    Py_ssize_t to_allocate = (*old_data)->allocated;
+    while (to_allocate <= interpreter_id) {
+        if (to_allocate == 0) to_allocate = 1;
+        else to_allocate *= 2;
+    }
+    __Pyx_ModuleStateLookupData *new_data = *old_data;
+    if (to_allocate != (*old_data)->allocated) {
+         new_data = (__Pyx_ModuleStateLookupData *)realloc(
+            *old_data,
+            sizeof(__Pyx_ModuleStateLookupData)+(to_allocate-1)*sizeof(__Pyx_InterpreterIdAndModule));
+        if (!new_data) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        for (Py_ssize_t i = new_data->allocated; i < to_allocate; ++i) {
+            new_data->table[i].id = i;
+            new_data->table[i].module = NULL;
+        }
+        new_data->allocated = to_allocate;
+    }
+    new_data->table[interpreter_id].module = module;
+    if (new_data->count < interpreter_id+1) {
+        new_data->count = interpreter_id+1;
+    }
+    *old_data = new_data;
+    return 0;
+}
+static void __Pyx_State_ConvertFromInterpIdAsIndex(__Pyx_ModuleStateLookupData *data) {
+    __Pyx_InterpreterIdAndModule *read = data->table;
+    __Pyx_InterpreterIdAndModule *write = data->table;
+    __Pyx_InterpreterIdAndModule *end = read + data->count;
+    for (; read<end; ++read) {
+        if (read->module) {
+            write->id = read->id;
+            write->module = read->module;
+            ++write;
+        }
+    }
+    data->count = write - data->table;
+    for (; write<end; ++write) {
+        write->id = 0;
+        write->module = NULL;
+    }
+    data->interpreter_id_as_index = 0;
+}
+static int __Pyx_State_AddModule(PyObject* module, CYTHON_UNUSED void* dummy) {
+    int64_t interpreter_id = PyInterpreterState_GetID(PyInterpreterState_Get());
+    if (interpreter_id == -1) return -1;
+    int result = 0;
+    __Pyx_ModuleStateLookup_Lock();
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+    __Pyx_ModuleStateLookupData *old_data = (__Pyx_ModuleStateLookupData *)
+            __pyx_atomic_pointer_exchange(&__Pyx_ModuleStateLookup_data, 0);
+#else
+    __Pyx_ModuleStateLookupData *old_data = __Pyx_ModuleStateLookup_data;
+#endif
+    __Pyx_ModuleStateLookupData *new_data = old_data;
+    if (!new_data) {
+        new_data = (__Pyx_ModuleStateLookupData *)calloc(1, sizeof(__Pyx_ModuleStateLookupData));
+        if (!new_data) {
+            result = -1;
+            PyErr_NoMemory();
+            goto end;
+        }
+        new_data->allocated = 1;
+        new_data->interpreter_id_as_index = 1;
+    }
+    __Pyx_ModuleStateLookup_wait_until_no_readers();
+    if (new_data->interpreter_id_as_index) {
+        if (interpreter_id < __PYX_MODULE_STATE_LOOKUP_SMALL_SIZE) {
+            result = __Pyx_State_AddModuleInterpIdAsIndex(&new_data, module, interpreter_id);
+            goto end;
+        }
+        __Pyx_State_ConvertFromInterpIdAsIndex(new_data);
+    }
+    {
+        Py_ssize_t insert_at = 0;
+        {
+            __Pyx_InterpreterIdAndModule* lower_bound = __Pyx_State_FindModuleStateLookupTableLowerBound(
+                new_data->table, new_data->count, interpreter_id);
+            assert(lower_bound);
+            insert_at = lower_bound - new_data->table;
+            if (unlikely(insert_at < new_data->count && lower_bound->id == interpreter_id)) {
+                lower_bound->module = module;
+                goto end;  // already in table, nothing more to do
+            }
+        }
+        if (new_data->count+1 >= new_data->allocated) {
+            Py_ssize_t to_allocate = (new_data->count+1)*2;
+            new_data =
+                (__Pyx_ModuleStateLookupData*)realloc(
+                    new_data,
+                    sizeof(__Pyx_ModuleStateLookupData) +
+                    (to_allocate-1)*sizeof(__Pyx_InterpreterIdAndModule));
+            if (!new_data) {
+                result = -1;
+                new_data = old_data;
+                PyErr_NoMemory();
+                goto end;
+            }
+            new_data->allocated = to_allocate;
+        }
+        ++new_data->count;
+        int64_t last_id = interpreter_id;
+        PyObject *last_module = module;
+        for (Py_ssize_t i=insert_at; i<new_data->count; ++i) {
+            int64_t current_id = new_data->table[i].id;
+            new_data->table[i].id = last_id;
+            last_id = current_id;
+            PyObject *current_module = new_data->table[i].module;
+            new_data->table[i].module = last_module;
+            last_module = current_module;
+        }
+    }
+  end:
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+    __pyx_atomic_pointer_exchange(&__Pyx_ModuleStateLookup_data, new_data);
+#else
+    __Pyx_ModuleStateLookup_data = new_data;
+#endif
+    __Pyx_ModuleStateLookup_Unlock();
+    return result;
 }
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-    return PyInt_FromSize_t(ival);
+static int __Pyx_State_RemoveModule(CYTHON_UNUSED void* dummy) {
+    int64_t interpreter_id = PyInterpreterState_GetID(PyInterpreterState_Get());
+    if (interpreter_id == -1) return -1;
+    __Pyx_ModuleStateLookup_Lock();
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+    __Pyx_ModuleStateLookupData *data = (__Pyx_ModuleStateLookupData *)
+            __pyx_atomic_pointer_exchange(&__Pyx_ModuleStateLookup_data, 0);
+#else
+    __Pyx_ModuleStateLookupData *data = __Pyx_ModuleStateLookup_data;
+#endif
+    if (data->interpreter_id_as_index) {
+        if (interpreter_id < data->count) {
+            data->table[interpreter_id].module = NULL;
+        }
+        goto done;
+    }
+    {
+        __Pyx_ModuleStateLookup_wait_until_no_readers();
+        __Pyx_InterpreterIdAndModule* lower_bound = __Pyx_State_FindModuleStateLookupTableLowerBound(
+            data->table, data->count, interpreter_id);
+        if (!lower_bound) goto done;
+        if (lower_bound->id != interpreter_id) goto done;
+        __Pyx_InterpreterIdAndModule *end = data->table+data->count;
+        for (;lower_bound<end-1; ++lower_bound) {
+            lower_bound->id = (lower_bound+1)->id;
+            lower_bound->module = (lower_bound+1)->module;
+        }
+    }
+    --data->count;
+    if (data->count == 0) {
+        free(data);
+        data = NULL;
+    }
+  done:
+#if CYTHON_MODULE_STATE_LOOKUP_THREAD_SAFE
+    __pyx_atomic_pointer_exchange(&__Pyx_ModuleStateLookup_data, data);
+#else
+    __Pyx_ModuleStateLookup_data = data;
+#endif
+    __Pyx_ModuleStateLookup_Unlock();
+    return 0;
 }
+#endif
+
+/* #### Code section: utility_code_pragmas_end ### */
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif
+
 
 
+/* #### Code section: end ### */
 #endif /* Py_PYTHON_H */
@@ -0,0 +1,86 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject, PyTypeObject
+from libcpp.vector cimport vector
+
+cdef extern from "Python.h":
+	Py_ssize_t PY_SSIZE_T_MAX
+	PyTypeObject* Py_TYPE_PTR "Py_TYPE" (PyObject* o)
+	bint PyType_IsSubtype_PTR "PyType_IsSubtype" (PyTypeObject* a, PyTypeObject* b)
+	int PyObject_IsInstance_PTR "PyObject_IsInstance" (PyObject* inst, PyObject* cls) except -1
+
+
+cdef enum MatcherKind:
+	MATCH_ANY  # Unannotated or `object`: every argument matches
+	MATCH_TYPE  # Plain class: compare the type pointer, then walk the MRO
+	MATCH_INSTANCE  # Class with a custom metaclass: `isinstance(argument, annotation)`
+	MATCH_PROGRAM  # Annotation from the typing module: run a compiled predicate program
+
+
+cdef enum ContainerCheckMode:
+	CHECK_SHALLOW  # Only check the type of the container
+	CHECK_FIRST  # Check the first `items` elements
+	CHECK_SAMPLE  # Check `items` elements at evenly spaced positions
+	CHECK_FULL  # Check all elements
+
+
+cdef struct ContainerCheck:
+	int mode
+	Py_ssize_t items
+
+
+cdef enum Opcode:
+	OP_ANY
+	OP_TYPE  # Argument is an instance of a plain class
+	OP_INSTANCE  # isinstance(argument, value)
+	OP_LITERAL  # Argument has the same type as value and is equal to it
+	OP_SUBCLASS  # Argument is a class, and a subclass of value
+	OP_UNION  # Argument matches any of the children
+	OP_TUPLE  # Argument is a tuple with one item per child, each matching its child
+	OP_COLLECTION  # Argument is an instance of value, and its elements match the child
+	OP_MAPPING  # Argument is an instance of value, and its keys and values match the two children
+
+
+cdef struct Instruction:
+	int op
+	Py_ssize_t size  # Number of instructions in this node, including all of its children
+	Py_ssize_t count  # Number of children, which directly follow this instruction
+	PyObject* value  # Borrowed from the annotation
+	ContainerCheck check  # For OP_COLLECTION and OP_MAPPING
+
+
+cdef struct Matcher:
+	int kind
+	PyObject* annotation
+	PyTypeObject* type  # For MATCH_TYPE
+	vector[Instruction] program  # For MATCH_PROGRAM
+	bint type_based  # The result only depends on the type of the argument, while metaclasses in `guards` are unchanged
+	PyObject* guards  # Tuple of metaclasses of annotations that are checked through `isinstance`
+
+
+cdef Matcher createMatcher(object annotation, bint typing, ContainerCheck check) except *
+cdef void destroyMatcher(Matcher matcher)
+cdef bint hasTypeBasedInstanceCheck(object metaclass) except -1
+cdef bint runProgram(const Instruction* instruction, PyObject* arg) except -1
+cdef Py_ssize_t matchDistance(const Matcher* matcher, PyObject* arg) except -1
+cdef bint matchType(const Matcher* matcher, PyObject* type) except -1
+cdef Py_ssize_t typeDistance(const Matcher* matcher, PyObject* type) except -1
+cdef bint matchersDisjoint(const Matcher* lhs, const Matcher* rhs) except -1
+
+
+cdef inline bint runMatcher(const Matcher* matcher, PyObject* arg) except -1:
+	"""Return True if `arg` matches the annotation `matcher` was compiled from."""
+	cdef PyTypeObject* arg_type
+
+	if matcher.kind == MATCH_ANY:
+		return True
+	if matcher.kind == MATCH_TYPE:
+		arg_type = Py_TYPE_PTR(arg)
+		return arg_type == matcher.type or PyType_IsSubtype_PTR(arg_type, matcher.type)
+	if matcher.kind == MATCH_INSTANCE:
+		return PyObject_IsInstance_PTR(arg, matcher.annotation)
+	return runProgram(matcher.program.data(), arg)
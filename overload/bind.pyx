@@ -4,17 +4,676 @@
 #cython: boundscheck=False
 #cython: wraparound=False
 #cython: language_level = 3
-from typing import _GenericAlias, Union, Any
-
-def matchesannotation(obj, ann):
-    """Return True if the object matches the annotation, including annotations from typing module."""
-    if isinstance(ann, _GenericAlias):
-        # typing annotations
-        if ann.__origin__ is Union:
-            return any(matchesannotation(obj, x) for x in ann.__args__)
-        print("unknown typing annotation")
+from abc import ABCMeta
+from inspect import _empty
+from collections.abc import Iterable, Mapping
+from typing import Annotated, Any, Literal, TypeVar, Union, get_args, get_origin
+try:
+    from types import UnionType
+except ImportError:
+    # Python 3.9 has no `X | Y` annotations
+    UnionType = Union
+from cpython cimport Py_INCREF, Py_XINCREF, Py_XDECREF
+from cpython.object cimport Py_EQ, PyObject_RichCompareBool
+from cpython.dict cimport PyDict_Check
+from cpython.list cimport PyList_Check
+from cpython.sequence cimport PySequence_Fast_ITEMS
+from cpython.set cimport PyAnySet_Check
+from cpython.tuple cimport PyTuple_Check, PyTuple_GET_SIZE, PyTuple_GET_ITEM
+from cpython.object cimport Py_TPFLAGS_BASETYPE, Py_TPFLAGS_HEAPTYPE
+from cpython.type cimport PyType_Check
+
+cdef extern from "Python.h":
+    int PyObject_IsSubclass_PTR "PyObject_IsSubclass" (PyObject* derived, PyObject* cls) except -1
+    PyTypeObject PyType_Type
+    PyTypeObject PyTuple_Type
+
+cdef extern from *:
+    """
+    static PyObject* ovl_type_mro(PyTypeObject *type) {
+        return type->tp_mro;
+    }
+    """
+    PyObject* ovl_type_mro(PyTypeObject* type)
+
+NoneType = type(None)
+
+
+cdef Matcher createMatcher(object annotation, bint typing, ContainerCheck check) except *:
+    """Compile a parameter annotation into a Matcher, which decides if an argument matches the annotation.
+    Classes created by `type` itself are checked natively. Such checks only look at the type of the argument, and do
+    not consult a `__class__` that differs from it. Classes with other metaclasses go through `isinstance`, and are
+    type-based as long as their metaclass keeps a standard `__instancecheck__`.
+    If `typing` is True, annotations from the typing module are compiled into predicate programs, see
+    compileAnnotation, and elements of containers are checked according to `check`. Otherwise, annotations are
+    matched with `isinstance`, like classes.
+    """
+    cdef Matcher matcher
+    cdef list guards = []
+    matcher.annotation = <PyObject*> annotation
+    matcher.type = NULL
+    matcher.type_based = True
+
+    if typing:
+        compileAnnotation(annotation, matcher.program, guards, check)
+        matcher.type_based = isTypeBased(matcher.program)
+
+        # Simple programs are run as simple matchers
+        if matcher.program[0].op == OP_ANY:
+            matcher.kind = MATCH_ANY
+        elif matcher.program[0].op == OP_TYPE:
+            matcher.kind = MATCH_TYPE
+            matcher.type = <PyTypeObject*> matcher.program[0].value
+        else:
+            matcher.kind = MATCH_PROGRAM
+    elif annotation is _empty or annotation is object:
+        matcher.kind = MATCH_ANY
+    elif type(annotation) is type:
+        matcher.kind = MATCH_TYPE
+        matcher.type = <PyTypeObject*> annotation
+    else:
+        matcher.kind = MATCH_INSTANCE
+        if isinstance(annotation, type):
+            guards.append(type(annotation))
+        else:
+            matcher.type_based = False
+    
+    guards_tuple = tuple(guards)
+    matcher.guards = <PyObject*> guards_tuple
+    Py_INCREF(guards_tuple)
+    Py_INCREF(annotation)
+    return matcher
+
+
+cdef void destroyMatcher(Matcher matcher):
+    """Destroy a Matcher object."""
+    Py_XDECREF(matcher.annotation)
+    Py_XDECREF(matcher.guards)
+
+
+cdef bint hasTypeBasedInstanceCheck(object metaclass) except -1:
+    """Return True if `isinstance(obj, cls)` for classes created by `metaclass` only depends on `type(obj)`.
+    This holds for the `__instancecheck__` of `type` and of `ABCMeta`, the latter as long as the ABC cache token
+    does not change.
+    """
+    instancecheck = metaclass.__instancecheck__
+    return instancecheck is type.__instancecheck__ or instancecheck is ABCMeta.__instancecheck__
+
+
+cdef void compileAnnotation(
+    object annotation, vector[Instruction]& program, list guards, ContainerCheck check
+) except *:
+    """Append a predicate program for `annotation` to `program`.
+    A program is a tree of instructions stored in preorder: every instruction is directly followed by its children.
+    Supported are classes, None, `Any`, `Union`, `Optional`, `X | Y`, `Literal`, `Type[T]`, fixed-size `Tuple[...]`,
+    `Annotated`, `NewType` and `TypeVar`. Parameterized collections (`List[int]`, `Tuple[int, ...]`,
+    `Sequence[str]`) and mappings (`Dict[str, float]`) check their elements according to `check`. Other generic
+    aliases only check their origin class.
+    Metaclasses of classes that need a call to `isinstance` are appended to `guards`.
+    """
+    cdef Py_ssize_t start = program.size()
+    cdef Instruction instruction
+    instruction.op = OP_ANY
+    instruction.size = 1
+    instruction.count = 0
+    instruction.value = NULL
+
+    origin = get_origin(annotation)
+    args = get_args(annotation)
+
+    if annotation is _empty or annotation is Any or annotation is object:
+        program.push_back(instruction)
+    elif annotation is None or annotation is NoneType:
+        instruction.op = OP_TYPE
+        instruction.value = <PyObject*> NoneType
+        program.push_back(instruction)
+    elif origin is Union or origin is UnionType:
+        compileNode(OP_UNION, args, program, guards, check)
+    elif origin is Literal:
+        instruction.op = OP_UNION
+        instruction.count = len(args)
+        program.push_back(instruction)
+        for value in args:
+            instruction.op = OP_LITERAL
+            instruction.count = 0
+            instruction.value = <PyObject*> value
+            program.push_back(instruction)
+        program[start].size = program.size() - start
+    elif origin is type:
+        compileSubclass(args[0] if args else Any, program, guards)
+    elif origin is tuple and not args and getattr(annotation, "__args__", None) == ():
+        # `Tuple[()]` and `tuple[()]` have no arguments, unlike the bare `Tuple` they have empty `__args__`
+        compileNode(OP_TUPLE, (), program, guards, check)
+    elif origin is tuple and args and args[len(args) - 1] is not Ellipsis:
+        compileNode(OP_TUPLE, args if args != ((),) else (), program, guards, check)
+    elif origin is Annotated:
+        compileAnnotation(annotation.__origin__, program, guards, check)
+    elif isinstance(annotation, TypeVar):
+        if annotation.__bound__ is not None:
+            compileAnnotation(annotation.__bound__, program, guards, check)
+        elif annotation.__constraints__:
+            compileNode(OP_UNION, annotation.__constraints__, program, guards, check)
+        else:
+            program.push_back(instruction)
+    elif hasattr(annotation, "__supertype__"):
+        # typing.NewType
+        compileAnnotation(annotation.__supertype__, program, guards, check)
+    elif origin is tuple and len(args) == 2 and args[1] is Ellipsis:
+        compileContainer(OP_COLLECTION, origin, args[:1], program, guards, check)
+    elif isinstance(origin, type) and issubclass(origin, Mapping) and len(args) == 2:
+        compileContainer(OP_MAPPING, origin, args, program, guards, check)
+    elif isinstance(origin, type) and issubclass(origin, Iterable) and len(args) == 1:
+        compileContainer(OP_COLLECTION, origin, args, program, guards, check)
+    elif isinstance(origin, type):
+        compileClass(origin, program, guards)
+    elif isinstance(annotation, type):
+        compileClass(annotation, program, guards)
+    else:
+        raise TypeError(f"unsupported annotation: {annotation!r}")
+    
+    simplifyUnion(program, start)
+
+
+cdef void compileNode(
+    int op, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+) except *:
+    """Append an instruction with opcode `op`, followed by programs for `children`."""
+    cdef Py_ssize_t start = program.size()
+    cdef Instruction instruction
+    instruction.op = op
+    instruction.size = 1
+    instruction.count = len(children)
+    instruction.value = NULL
+    program.push_back(instruction)
+
+    for child in children:
+        compileAnnotation(child, program, guards, check)
+    
+    program[start].size = program.size() - start
+
+
+cdef void compileContainer(
+    int op, object cls, tuple children, vector[Instruction]& program, list guards, ContainerCheck check
+) except *:
+    """Append a container instruction for instances of `cls` with element programs for `children`.
+    Containers whose elements are never checked become a plain class check.
+    """
+    cdef Py_ssize_t start = program.size()
+
+    if check.mode == CHECK_SHALLOW or (check.mode != CHECK_FULL and check.items <= 0):
+        compileClass(cls, program, guards)
+        return
+
+    compileNode(op, children, program, guards, check)
+    for child in range(start + 1, program.size()):
+        if program[child].op != OP_ANY:
+            break
+    else:
+        program.resize(start)
+        compileClass(cls, program, guards)
+        return
+
+    program[start].value = <PyObject*> cls
+    program[start].check = check
+    if type(cls) is not type and type(cls) not in guards:
+        guards.append(type(cls))
+
+
+cdef void compileClass(object cls, vector[Instruction]& program, list guards) except *:
+    """Append an instruction that checks if the argument is an instance of `cls`."""
+    cdef Instruction instruction
+    instruction.size = 1
+    instruction.count = 0
+    instruction.value = <PyObject*> cls
+
+    if cls is object:
+        instruction.op = OP_ANY
+    elif type(cls) is type:
+        instruction.op = OP_TYPE
+    else:
+        instruction.op = OP_INSTANCE
+        if type(cls) not in guards:
+            guards.append(type(cls))
+    
+    program.push_back(instruction)
+
+
+cdef void compileSubclass(object annotation, vector[Instruction]& program, list guards) except *:
+    """Append a program for `Type[annotation]`."""
+    cdef Instruction instruction
+    instruction.op = OP_SUBCLASS
+    instruction.size = 1
+    instruction.count = 0
+    instruction.value = <PyObject*> annotation
+
+    origin = get_origin(annotation)
+
+    if annotation is Any or annotation is object:
+        compileClass(type, program, guards)
+    elif origin is Union or origin is UnionType:
+        instruction.op = OP_UNION
+        instruction.count = len(get_args(annotation))
+        instruction.value = NULL
+        start = program.size()
+        program.push_back(instruction)
+        for arg in get_args(annotation):
+            compileSubclass(arg, program, guards)
+        program[start].size = program.size() - start
+    elif isinstance(annotation, type):
+        program.push_back(instruction)
+    else:
+        raise TypeError(f"unsupported annotation: Type[{annotation!r}]")
+
+
+cdef void simplifyUnion(vector[Instruction]& program, Py_ssize_t start):
+    """Replace a union at `start` that has an `Any` alternative with a single `Any`."""
+    cdef Py_ssize_t child
+
+    if program[start].op != OP_UNION:
+        return
+
+    child = start + 1
+    for _ in range(program[start].count):
+        if program[child].op == OP_ANY:
+            program.resize(start + 1)
+            program[start].op = OP_ANY
+            program[start].size = 1
+            program[start].count = 0
+            return
+        child += program[child].size
+
+
+cdef bint isTypeBased(const vector[Instruction]& program):
+    """Return True if the result of `program` only depends on the type of the argument."""
+    cdef Py_ssize_t i
+    cdef int op
+
+    for i in range(<Py_ssize_t> program.size()):
+        op = program[i].op
+        if op == OP_LITERAL or op == OP_SUBCLASS or op == OP_TUPLE or op == OP_COLLECTION or op == OP_MAPPING:
+            return False
+    return True
+
+
+cdef bint runProgram(const Instruction* instruction, PyObject* arg) except -1:
+    """Return True if `arg` matches the program node at `instruction`."""
+    cdef PyTypeObject* arg_type
+    cdef const Instruction* child
+    cdef Py_ssize_t i
+    cdef int op = instruction.op
+
+    if op == OP_ANY:
+        return True
+    if op == OP_TYPE:
+        arg_type = Py_TYPE_PTR(arg)
+        return arg_type == <PyTypeObject*> instruction.value or PyType_IsSubtype_PTR(
+            arg_type, <PyTypeObject*> instruction.value
+        )
+    if op == OP_INSTANCE:
+        return PyObject_IsInstance_PTR(arg, instruction.value)
+    if op == OP_LITERAL:
+        return Py_TYPE_PTR(arg) == Py_TYPE_PTR(instruction.value) and PyObject_RichCompareBool(
+            <object> arg, <object> instruction.value, Py_EQ
+        )
+    if op == OP_SUBCLASS:
+        return PyType_Check(<object> arg) and PyObject_IsSubclass_PTR(arg, instruction.value)
+
+    if op == OP_COLLECTION:
+        return isInstance(arg, instruction.value) and runCollection(instruction, arg)
+    if op == OP_MAPPING:
+        return isInstance(arg, instruction.value) and runMapping(instruction, arg)
+
+    child = instruction + 1
+    if op == OP_UNION:
+        for i in range(instruction.count):
+            if runProgram(child, arg):
+                return True
+            child += child.size
+        return False
+
+    # OP_TUPLE
+    if not PyTuple_Check(<object> arg) or PyTuple_GET_SIZE(<object> arg) != instruction.count:
+        return False
+    for i in range(instruction.count):
+        if not runProgram(child, <PyObject*> PyTuple_GET_ITEM(<object> arg, i)):
+            return False
+        child += child.size
+    return True
+
+
+cdef inline bint isInstance(PyObject* arg, PyObject* cls) except -1:
+    """Return True if `arg` is an instance of `cls`, without calling `isinstance` for plain classes."""
+    if Py_TYPE_PTR(cls) == &PyType_Type:
+        return Py_TYPE_PTR(arg) == <PyTypeObject*> cls or PyType_IsSubtype_PTR(Py_TYPE_PTR(arg), <PyTypeObject*> cls)
+    return PyObject_IsInstance_PTR(arg, cls)
+
+
+cdef inline Py_ssize_t checkedCount(const ContainerCheck* check, Py_ssize_t size):
+    """Return how many of `size` elements are checked."""
+    if check.mode == CHECK_FULL or size <= check.items:
+        return size
+    return check.items
+
+
+cdef inline Py_ssize_t checkedIndex(const ContainerCheck* check, Py_ssize_t size, Py_ssize_t i):
+    """Return the index of the `i`-th checked element out of `size`."""
+    if check.mode == CHECK_SAMPLE and size > check.items:
+        return i * size // <Py_ssize_t> check.items
+    return i
+
+
+cdef bint runCollection(const Instruction* instruction, PyObject* arg) except -1:
+    """Check elements of a collection that matched the class of an OP_COLLECTION instruction.
+    Elements are only checked in lists, tuples, sets and frozensets, iterating anything else could consume it.
+    """
+    cdef const Instruction* child = instruction + 1
+    cdef const ContainerCheck* check = &instruction.check
+    cdef PyTypeObject* item_type
+    cdef PyTypeObject* last_type = NULL
+    cdef PyObject** items
+    cdef Py_ssize_t size
+    cdef Py_ssize_t count
+    cdef Py_ssize_t i
+    obj = <object> arg
+
+    if PyList_Check(obj) or PyTuple_Check(obj):
+        size = len(obj)
+        count = checkedCount(check, size)
+
+        if child.op == OP_TYPE:
+            # Type checks never run Python code, so the list can not change while we walk its items
+            items = PySequence_Fast_ITEMS(obj)
+            for i in range(count):
+                item_type = Py_TYPE_PTR(items[checkedIndex(check, size, i)])
+                if item_type == last_type or item_type == <PyTypeObject*> child.value:
+                    continue
+                if not PyType_IsSubtype_PTR(item_type, <PyTypeObject*> child.value):
+                    return False
+                last_type = item_type
+            return True
+        
+        for i in range(count):
+            if size != len(obj):
+                raise RuntimeError("container changed size during overload resolution")
+            item = obj[checkedIndex(check, size, i)]
+            if not runProgram(child, <PyObject*> item):
+                return False
+        return True
+    
+    if PyAnySet_Check(obj):
+        count = checkedCount(check, len(obj))
+        for item in obj:
+            if count == 0:
+                break
+            if not runProgram(child, <PyObject*> item):
+                return False
+            count -= 1
+    
+    return True
+
+
+cdef bint runMapping(const Instruction* instruction, PyObject* arg) except -1:
+    """Check keys and values of a mapping that matched the class of an OP_MAPPING instruction.
+    Elements are only checked in dicts, in iteration order. Sampling checks the first elements instead.
+    """
+    cdef const Instruction* key_program = instruction + 1
+    cdef const Instruction* value_program = key_program + key_program.size
+    cdef Py_ssize_t count
+    obj = <object> arg
+
+    if not PyDict_Check(obj):
+        return True
+
+    count = checkedCount(&instruction.check, len(obj))
+    for key, value in (<dict> obj).items():
+        if count == 0:
+            break
+        if not runProgram(key_program, <PyObject*> key) or not runProgram(value_program, <PyObject*> value):
+            return False
+        count -= 1
+    
+    return True
+
+
+cdef Py_ssize_t matchDistance(const Matcher* matcher, PyObject* arg) except -1:
+    """Return how specific the annotation `matcher` was compiled from is for `arg`, which must match it.
+    Lower is more specific, see programDistance. Arguments that match anything have the largest
+    distance, PY_SSIZE_T_MAX.
+    """
+    if matcher.kind == MATCH_ANY:
+        return PY_SSIZE_T_MAX
+    if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+        return mroDistance(Py_TYPE_PTR(arg), matcher.annotation)
+    return programDistance(matcher.program.data(), arg)
+
+
+cdef Py_ssize_t programDistance(const Instruction* instruction, PyObject* arg) except -1:
+    """Return how specific the program node at `instruction` is for `arg`, which must match it.
+    Classes are as specific as their position in the MRO of the argument type, counting from 1. Literals are the most
+    specific with 0, and unions are as specific as their most specific matching alternative.
+    """
+    cdef const Instruction* child
+    cdef Py_ssize_t distance
+    cdef int op = instruction.op
+
+    if op == OP_ANY:
+        return PY_SSIZE_T_MAX
+    if op == OP_LITERAL:
+        return 0
+    if op == OP_SUBCLASS:
+        return mroDistance(<PyTypeObject*> arg, instruction.value)
+    if op == OP_TUPLE:
+        return mroDistance(Py_TYPE_PTR(arg), <PyObject*> tuple)
+    if op != OP_UNION:
+        return mroDistance(Py_TYPE_PTR(arg), instruction.value)
+
+    distance = PY_SSIZE_T_MAX
+    child = instruction + 1
+    for _ in range(instruction.count):
+        if runProgram(child, arg):
+            distance = min(distance, programDistance(child, arg))
+        child += child.size
+    return distance
+
+
+cdef enum TypeMatch:
+    TYPE_MISMATCH
+    TYPE_MATCH
+    TYPE_DEPENDS_ON_VALUE  # Some instances of the class match and some do not
+
+
+cdef bint matchType(const Matcher* matcher, PyObject* type) except -1:
+    """Return True if instances of the class `type` match the annotation `matcher` was compiled from.
+    Classes are compared with `issubclass`. Raise TypeError if the match depends on more than the type of an argument.
+    """
+    if matcher.kind == MATCH_ANY:
+        return True
+    if matcher.kind == MATCH_TYPE:
+        return PyType_IsSubtype_PTR(<PyTypeObject*> type, matcher.type)
+    if matcher.kind == MATCH_INSTANCE:
+        return PyObject_IsSubclass_PTR(type, matcher.annotation)
+    
+    match = runTypeProgram(matcher.program.data(), type)
+    if match == TYPE_DEPENDS_ON_VALUE:
+        raise TypeError(
+            f"annotation {<object> matcher.annotation!r} can not be matched by type for {<object> type!r}, "
+            "use `resolve_for` with values of arguments"
+        )
+    return match == TYPE_MATCH
+
+
+cdef int runTypeProgram(const Instruction* instruction, PyObject* type) except -1:
+    """Return whether instances of the class `type` match the program node at `instruction`, as a TypeMatch.
+    Literals, tuples and the elements of containers depend on values, unless the class alone rules them out.
+    """
+    cdef const Instruction* child
+    cdef int op = instruction.op
+    cdef int match
+    cdef int result
+
+    if op == OP_ANY:
+        return TYPE_MATCH
+    if op == OP_TYPE:
+        if PyType_IsSubtype_PTR(<PyTypeObject*> type, <PyTypeObject*> instruction.value):
+            return TYPE_MATCH
+        return TYPE_MISMATCH
+    if op == OP_INSTANCE:
+        return TYPE_MATCH if PyObject_IsSubclass_PTR(type, instruction.value) else TYPE_MISMATCH
+    if op == OP_LITERAL:
+        return TYPE_DEPENDS_ON_VALUE if <PyTypeObject*> type == Py_TYPE_PTR(instruction.value) else TYPE_MISMATCH
+    if op == OP_SUBCLASS:
+        return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyType_Type) else TYPE_MISMATCH
+    if op == OP_TUPLE:
+        return TYPE_DEPENDS_ON_VALUE if PyType_IsSubtype_PTR(<PyTypeObject*> type, &PyTuple_Type) else TYPE_MISMATCH
+    
+    child = instruction + 1
+    if op == OP_COLLECTION or op == OP_MAPPING:
+        if not PyObject_IsSubclass_PTR(type, instruction.value):
+            return TYPE_MISMATCH
+        for _ in range(instruction.count):
+            if child.op != OP_ANY:
+                return TYPE_DEPENDS_ON_VALUE
+            child += child.size
+        return TYPE_MATCH
+    
+    # OP_UNION
+    result = TYPE_MISMATCH
+    for _ in range(instruction.count):
+        match = runTypeProgram(child, type)
+        if match == TYPE_MATCH:
+            return TYPE_MATCH
+        if match == TYPE_DEPENDS_ON_VALUE:
+            result = TYPE_DEPENDS_ON_VALUE
+        child += child.size
+    return result
+
+
+cdef Py_ssize_t typeDistance(const Matcher* matcher, PyObject* type) except -1:
+    """Return how specific the annotation `matcher` was compiled from is for instances of the class `type`, which
+    must match it, see matchDistance.
+    """
+    if matcher.kind == MATCH_ANY:
+        return PY_SSIZE_T_MAX
+    if matcher.kind == MATCH_TYPE or matcher.kind == MATCH_INSTANCE:
+        return mroDistance(<PyTypeObject*> type, matcher.annotation)
+    return typeProgramDistance(matcher.program.data(), type)
+
+
+cdef Py_ssize_t typeProgramDistance(const Instruction* instruction, PyObject* type) except -1:
+    """Return how specific the program node at `instruction` is for instances of the class `type`, see
+    programDistance. Only alternatives of unions that match by type alone are counted.
+    """
+    cdef const Instruction* child
+    cdef Py_ssize_t distance = PY_SSIZE_T_MAX
+
+    if instruction.op == OP_ANY:
+        return PY_SSIZE_T_MAX
+    if instruction.op != OP_UNION:
+        return mroDistance(<PyTypeObject*> type, instruction.value)
+    
+    child = instruction + 1
+    for _ in range(instruction.count):
+        if runTypeProgram(child, type) == TYPE_MATCH:
+            distance = min(distance, typeProgramDistance(child, type))
+        child += child.size
+    return distance
+
+
+cdef Py_ssize_t mroDistance(PyTypeObject* type, PyObject* cls):
+    """Return the 1-based position of `cls` in the MRO of `type`.
+    Classes that are not in the MRO, like ABCs that `type` was registered with, are placed after all of it.
+    """
+    cdef tuple mro = <tuple> ovl_type_mro(type)
+    cdef Py_ssize_t i
+
+    for i in range(PyTuple_GET_SIZE(mro)):
+        if <PyObject*> PyTuple_GET_ITEM(mro, i) == cls:
+            return i + 1
+    return PyTuple_GET_SIZE(mro) + 1
+
+
+cdef bint matchersDisjoint(const Matcher* lhs, const Matcher* rhs) except -1:
+    """Return True if no argument can match both `lhs` and `rhs`.
+    This is a conservative check: False means that an argument may match both.
+    """
+    lhs_cover = matcherCover(lhs)
+    rhs_cover = matcherCover(rhs)
+    if lhs_cover is None or rhs_cover is None:
+        return False
+    
+    for lhs_type in lhs_cover:
+        for rhs_type in rhs_cover:
+            if not typesDisjoint(<PyTypeObject*> lhs_type, <PyTypeObject*> rhs_type):
+                return False
+    return True
+
+
+cdef tuple matcherCover(const Matcher* matcher):
+    """Return a tuple of plain classes, such that every argument that matches `matcher` is an instance of one of
+    them, or None if `matcher` can not be described like that.
+    """
+    if matcher.kind == MATCH_TYPE:
+        return (<object> matcher.type,)
+    if matcher.kind == MATCH_PROGRAM:
+        return programCover(matcher.program.data())
+    return None
+
+
+cdef tuple programCover(const Instruction* instruction):
+    """Return a tuple of plain classes that covers the program node at `instruction`, see matcherCover."""
+    cdef const Instruction* child
+    cdef int op = instruction.op
+
+    if op == OP_TYPE:
+        return (<object> instruction.value,)
+    if op == OP_LITERAL:
+        return (type(<object> instruction.value),)
+    if op == OP_SUBCLASS:
+        return (type,)
+    if op == OP_TUPLE:
+        return (tuple,)
+    if op == OP_COLLECTION or op == OP_MAPPING:
+        if type(<object> instruction.value) is type:
+            return (<object> instruction.value,)
+        return None
+    if op != OP_UNION:
+        return None
+    
+    result = ()
+    child = instruction + 1
+    for _ in range(instruction.count):
+        cover = programCover(child)
+        if cover is None:
+            return None
+        result += cover
+        child += child.size
+    return result
+
+
+cdef bint typesDisjoint(PyTypeObject* lhs, PyTypeObject* rhs):
+    """Return True if no object can be an instance of both plain classes `lhs` and `rhs`.
+    This holds if neither is a subclass of the other, and no class can inherit from both: either one of them does not
+    allow subclassing, or their instance layouts conflict, see layoutBase.
+    """
+    if PyType_IsSubtype_PTR(lhs, rhs) or PyType_IsSubtype_PTR(rhs, lhs):
         return False
-    elif ann is Any:
+    if not (lhs.tp_flags & Py_TPFLAGS_BASETYPE) or not (rhs.tp_flags & Py_TPFLAGS_BASETYPE):
         return True
-    else:
-        return isinstance(obj, ann)
+    
+    lhs = layoutBase(lhs)
+    rhs = layoutBase(rhs)
+    return not PyType_IsSubtype_PTR(lhs, rhs) and not PyType_IsSubtype_PTR(rhs, lhs)
+
+
+cdef PyTypeObject* layoutBase(PyTypeObject* type):
+    """Return the base of `type` that defines its instance layout, like `solid_base` in CPython.
+    Classes defined in Python are skipped, which only makes the layout base more general. Classes whose layout bases
+    are unrelated can not have a common subclass.
+    """
+    while type.tp_flags & Py_TPFLAGS_HEAPTYPE and type.tp_base != NULL:
+        type = type.tp_base
+    while type.tp_base != NULL and type.tp_basicsize == type.tp_base.tp_basicsize and (
+        type.tp_itemsize == type.tp_base.tp_itemsize
+    ):
+        type = type.tp_base
+    return type
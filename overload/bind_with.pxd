@@ -4,6 +4,33 @@
 #cython: boundscheck=False
 #cython: wraparound=False
 #cython: language_level = 3
+from cpython cimport PyObject
+from libcpp.vector cimport vector
 from .signature cimport Signature
 
-cdef bind_with(Signature sig, object bind_func, tuple args, dict kwargs)
\ No newline at end of file
+cdef enum BindStatus:
+	BIND_OK = 0
+	BIND_TOO_MANY_POSITIONAL
+	BIND_MULTIPLE_VALUES
+	BIND_POSITIONAL_ONLY
+	BIND_MISSING_ARGUMENT
+	BIND_UNEXPECTED_TYPE
+	BIND_UNEXPECTED_KEYWORD
+
+
+cdef int bind_with(Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position) except -1
+cdef int bind_keywords(
+	Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position
+) except -1
+cdef int bind_slots(
+	Signature sig, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* slots, Py_ssize_t* position
+) except -1
+cdef int bind_types(
+	Signature sig, PyObject** types, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position
+) except -1
+cdef int bind_distances(
+	Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, vector[Py_ssize_t]& distances, bint types=*
+) except -1
+cdef bind_failure_reason(
+	Signature sig, int status, Py_ssize_t position, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint types=*
+)
@@ -4,10 +4,15 @@
 #cython: boundscheck=False
 #cython: wraparound=False
 #cython: language_level = 3
-from inspect import _POSITIONAL_ONLY, _VAR_POSITIONAL, _KEYWORD_ONLY, _VAR_KEYWORD, _empty
-import itertools
+from inspect import _POSITIONAL_ONLY, _VAR_POSITIONAL, _KEYWORD_ONLY, _VAR_KEYWORD
+from cpython cimport PyObject
 from libcpp cimport bool
-from .signature cimport Signature
+from libcpp.vector cimport vector
+from .bind cimport matchDistance, matchType, runMatcher, typeDistance
+from .signature cimport Parameter, Signature, cacheKeywordSlots, keywordSlot
+
+cdef extern from "Python.h":
+	Py_ssize_t PY_SSIZE_T_MAX
 
 cdef int _c_positional_only = _POSITIONAL_ONLY
 cdef int _c_var_positional = _VAR_POSITIONAL
@@ -15,112 +20,229 @@ cdef int _c_keyword_only = _KEYWORD_ONLY
 cdef int _c_var_keyword = _VAR_KEYWORD
 
 
-cdef bind_with(Signature sig, object bind_func, tuple args, dict kwargs):
-	cdef dict kwargs_ = kwargs.copy()
-	cdef int args_i = 0
-	cdef int parameters_i = 0
-
-	while True:
-		# Let's iterate through the positional arguments and corresponding
-		# parameters
-		if args_i < len(args):
-			arg_val = args[args_i]
-			args_i += 1
-
-			# We have a positional argument to process
-			if parameters_i < sig.parameters.size():
-				param = sig.parameters[parameters_i]
-				parameters_i += 1
-				annotation = <object> param.annotation
-				if annotation is _empty:
-					annotation = object
-				
-				if param.kind == _c_var_keyword or param.kind == _c_keyword_only:
-					# Looks like we have no parameter for this positional
-					# argument
-					return TypeError('too many positional arguments')
-
-				if param.kind == _c_var_positional:
-					break
-
-				if <object> param.name in kwargs_ and param.kind != _c_positional_only:
-					return TypeError(f'multiple values for argument {<object> param.name!r}')
-
-				if not bind_func(arg_val, annotation):
-					return TypeError(
-						f"argument '{<object> param.name!r}' has unexpected type '{type(arg_val).__qualname__}'"
-					)
-			else:
-				return TypeError('too many positional arguments')
-		else:
-			# No more positional arguments
-			if parameters_i < sig.parameters.size():
-				param = sig.parameters[parameters_i]
-				parameters_i += 1
-				annotation = <object> param.annotation
-				if annotation is _empty:
-					annotation = object
-				
-				if param.kind == _c_var_positional:
-					# That's OK, just empty *args.  Let's start parsing
-					# kwargs
-					break
-				elif <object> param.name in kwargs_:
-					if param.kind == _c_positional_only:
-						return TypeError(
-							f'{<object> param.name!r} parameter is positional only, but was passed as a keyword'
-						)
-					parameters_i -= 1
-					break
-				elif (param.kind == _c_var_keyword or param.has_default):
-					# That's fine too - we have a default value for this
-					# parameter.  So, lets start parsing `kwargs`, starting
-					# with the current parameter
-					parameters_i -= 1
-					break
-				else:
-					# No default, not VAR_KEYWORD, not VAR_POSITIONAL,
-					# not in `kwargs`
-					return TypeError(f'missing a required argument: {<object> param.name!r}')
-			else:
-				# No more parameters. That's it. Just need to check that
-				# we have no `kwargs` after this while loop
-				break
-
-	# Now, we iterate through the remaining parameters to process
-	# keyword arguments
-	cdef bool kwargs_param = False
-	while parameters_i < sig.parameters.size():
-		param = sig.parameters[parameters_i]
-		parameters_i += 1
-		if param.kind == _c_var_keyword:
-			# Memorize that we have a '**kwargs'-like parameter
-			kwargs_param = True
-			continue
-
-		if param.kind == _c_var_positional:
-			# Named arguments don't refer to '*args'-like parameters.
-			# We only arrive here if the positional arguments ended
-			# before reaching the last parameter before *args.
-			continue
-
-		arg_val = kwargs_.pop(<object> param.name, None)
-		if arg_val is None:
-			# We have no value for this parameter.  It's fine though,
-			# if it has a default value, or it is an '*args'-like
-			# parameter, left alone by the processing of positional
-			# arguments.
-			if (param.kind != _c_var_positional and not param.has_default):
-				return TypeError(f'missing a required argument: {<object> param.name!r}')
-		else:
-			if param.kind == _c_positional_only:
-				# This should never happen in case of a properly built
-				# Signature object (but let's have this check here
-				# to ensure correct behaviour just in case)
-				return TypeError(f'{<object> param.name!r} parameter is positional only, but was passed as a keyword')
-
-			if not bind_func(arg_val, annotation):
-				return TypeError(f"argument '{<object> param.name!r}' has unexpected type '{type(arg_val).__qualname__}'")
-
-	if kwargs_ and not kwargs_param:
-		return TypeError(f'got an unexpected keyword argument {next(iter(kwargs_))!r}')
+cdef int bind_with(Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position) except -1:
+	"""Try to bind arguments of a vectorcall to `sig`, checking argument types with matchers of its parameters.
+	Positional arguments are `args[:nargs]`, values of keyword arguments named `kwnames` follow them in `args`.
+	Return BIND_OK on success, or a BindStatus that describes the failure. For failures that concern a single
+	parameter, its index is written to `position` (for BIND_UNEXPECTED_KEYWORD, the index of the keyword). Use
+	`bind_failure_reason` to turn a failure into a TypeError.
+	"""
+	cdef Py_ssize_t i
+
+	if nargs > sig.positional_count and sig.max_positional != PY_SSIZE_T_MAX:
+		return BIND_TOO_MANY_POSITIONAL
+
+	# Positional arguments fill named parameters from the left. The rest, if any, go to '*args' unchecked
+	for i in range(min(nargs, sig.positional_count)):
+		if not runMatcher(&sig.parameters[i].matcher, args[i]):
+			position[0] = i
+			return BIND_UNEXPECTED_TYPE
+
+	return bind_keywords(sig, args, nargs, kwnames, position)
+
+
+cdef int bind_keywords(
+	Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position
+) except -1:
+	"""Finish binding arguments of a vectorcall to `sig`, after positional arguments were bound and checked.
+	Binds keyword arguments and checks that no required parameter is missing, see `bind_with`.
+	"""
+	cdef Py_ssize_t nkwargs = len(kwnames)
+	cdef Py_ssize_t npositional = min(nargs, sig.positional_count)
+	cdef bool kwargs_param = sig.max_keywords == PY_SSIZE_T_MAX
+	cdef Py_ssize_t required_keywords = 0
+	cdef Py_ssize_t i
+	cdef Py_ssize_t slot
+	cdef Parameter* param
+
+	# Keyword arguments are looked up by name, once per tuple of keywords. Every keyword refers to a different
+	# parameter, so required parameters are all bound if enough keywords landed on them
+	cacheKeywordSlots(sig, kwnames)
+	for i in range(nkwargs):
+		slot = keywordSlot(sig, kwnames, i)
+		if slot == -1:
+			if kwargs_param:
+				continue
+			position[0] = i
+			return BIND_UNEXPECTED_KEYWORD
+
+		param = &sig.parameters[slot]
+		if param.kind == _c_positional_only:
+			if kwargs_param:
+				# Python 3.8+ passes this keyword into '**kwargs'
+				continue
+			position[0] = slot
+			return BIND_POSITIONAL_ONLY
+
+		if slot < npositional:
+			position[0] = slot
+			return BIND_MULTIPLE_VALUES
+
+		if not runMatcher(&param.matcher, args[nargs + i]):
+			position[0] = slot
+			return BIND_UNEXPECTED_TYPE
+
+		if not param.has_default:
+			required_keywords += 1
+
+	if required_keywords < sig.required_from[npositional]:
+		for i in range(npositional, <Py_ssize_t> sig.parameters.size()):
+			param = &sig.parameters[i]
+			if param.kind == _c_var_positional or param.kind == _c_var_keyword or param.has_default:
+				continue
+			if param.kind == _c_positional_only or <object> param.name not in kwnames:
+				position[0] = i
+				return BIND_MISSING_ARGUMENT
+
+	return BIND_OK
+
+
+cdef int bind_slots(
+	Signature sig, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* slots, Py_ssize_t* position
+) except -1:
+	"""Bind the shape of a vectorcall to `sig`, like `bind_with` does, without looking at the arguments.
+	On success, write to `slots` the index of the parameter that each argument binds to, in the order of arguments,
+	or -1 for arguments that go into '*args' or '**kwargs' unchecked. Return BIND_OK, or a BindStatus other than
+	BIND_UNEXPECTED_TYPE that describes the failure.
+	"""
+	cdef Py_ssize_t nkwargs = len(kwnames)
+	cdef Py_ssize_t npositional = min(nargs, sig.positional_count)
+	cdef bool kwargs_param = sig.max_keywords == PY_SSIZE_T_MAX
+	cdef Py_ssize_t required_keywords = 0
+	cdef Py_ssize_t i
+	cdef Py_ssize_t slot
+	cdef Parameter* param
+
+	if nargs > sig.positional_count and sig.max_positional != PY_SSIZE_T_MAX:
+		return BIND_TOO_MANY_POSITIONAL
+
+	for i in range(nargs):
+		slots[i] = i if i < npositional else -1
+
+	cacheKeywordSlots(sig, kwnames)
+	for i in range(nkwargs):
+		slots[nargs + i] = -1
+		slot = keywordSlot(sig, kwnames, i)
+		if slot == -1:
+			if kwargs_param:
+				continue
+			position[0] = i
+			return BIND_UNEXPECTED_KEYWORD
+
+		param = &sig.parameters[slot]
+		if param.kind == _c_positional_only:
+			if kwargs_param:
+				continue
+			position[0] = slot
+			return BIND_POSITIONAL_ONLY
+
+		if slot < npositional:
+			position[0] = slot
+			return BIND_MULTIPLE_VALUES
+
+		slots[nargs + i] = slot
+		if not param.has_default:
+			required_keywords += 1
+
+	if required_keywords < sig.required_from[npositional]:
+		for i in range(npositional, <Py_ssize_t> sig.parameters.size()):
+			param = &sig.parameters[i]
+			if param.kind == _c_var_positional or param.kind == _c_var_keyword or param.has_default:
+				continue
+			if param.kind == _c_positional_only or <object> param.name not in kwnames:
+				position[0] = i
+				return BIND_MISSING_ARGUMENT
+
+	return BIND_OK
+
+
+cdef int bind_types(
+	Signature sig, PyObject** types, Py_ssize_t nargs, tuple kwnames, Py_ssize_t* position
+) except -1:
+	"""Try to bind a vectorcall with arguments that are instances of `types` to `sig`, like `bind_with` does.
+	Annotations are matched by type, see matchType.
+	"""
+	cdef vector[Py_ssize_t] slots
+	cdef Py_ssize_t slot
+	cdef Py_ssize_t i
+	cdef int status
+
+	slots.resize(nargs + len(kwnames))
+	status = bind_slots(sig, nargs, kwnames, slots.data(), position)
+	if status != BIND_OK:
+		return status
+	
+	for i in range(<Py_ssize_t> slots.size()):
+		slot = slots[i]
+		if slot != -1 and not matchType(&sig.parameters[slot].matcher, types[i]):
+			position[0] = slot
+			return BIND_UNEXPECTED_TYPE
+	
+	return BIND_OK
+
+
+cdef int bind_distances(
+	Signature sig, PyObject** args, Py_ssize_t nargs, tuple kwnames, vector[Py_ssize_t]& distances, bint types=False
+) except -1:
+	"""Write to `distances` how specific the parameters of `sig` are for each argument of a vectorcall, which must
+	bind to `sig`. Distances follow the order of arguments in `args`, see matchDistance. If `types` is True, `args`
+	are types of arguments instead, see bind_types.
+	Arguments that go into '*args' or '**kwargs' are unchecked, and are as unspecific as unannotated parameters.
+	"""
+	cdef Py_ssize_t nkwargs = len(kwnames)
+	cdef Py_ssize_t i
+	cdef Py_ssize_t slot
+
+	distances.assign(nargs + nkwargs, PY_SSIZE_T_MAX)
+
+	for i in range(min(nargs, sig.positional_count)):
+		distances[i] = argumentDistance(&sig.parameters[i], args[i], types)
+	
+	cacheKeywordSlots(sig, kwnames)
+	for i in range(nkwargs):
+		slot = keywordSlot(sig, kwnames, i)
+		if slot != -1 and sig.parameters[slot].kind != _c_positional_only:
+			distances[nargs + i] = argumentDistance(&sig.parameters[slot], args[nargs + i], types)
+	
+	return 0
+
+
+cdef inline Py_ssize_t argumentDistance(Parameter* param, PyObject* arg, bint types) except -1:
+	"""Return how specific `param` is for `arg`, or for instances of `arg` if `types` is True."""
+	if types:
+		return typeDistance(&param.matcher, arg)
+	return matchDistance(&param.matcher, arg)
+
+
+cdef bind_failure_reason(
+	Signature sig, int status, Py_ssize_t position, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint types=False
+):
+	"""Return a TypeError that explains a failure `status` returned by `bind_with` for the same arguments, or by
+	`bind_types` if `types` is True.
+	This is only done when the failure is reported, so that binding itself does not have to format any messages.
+	"""
+	if status == BIND_OK:
+		# Matchers that depend on state, like '__instancecheck__' hooks, may accept the arguments on another bind
+		return TypeError('accepts the arguments now (they changed after the call)')
+	if status == BIND_TOO_MANY_POSITIONAL:
+		return TypeError('too many positional arguments')
+	if status == BIND_UNEXPECTED_KEYWORD:
+		return TypeError(f'got an unexpected keyword argument {kwnames[position]!r}')
+
+	param = sig.parameters[position]
+	name = <object> param.name
+
+	if status == BIND_MULTIPLE_VALUES:
+		return TypeError(f'multiple values for argument {name!r}')
+	if status == BIND_POSITIONAL_ONLY:
+		return TypeError(f'{name!r} parameter is positional only, but was passed as a keyword')
+	if status == BIND_MISSING_ARGUMENT:
+		return TypeError(f'missing a required argument: {name!r}')
+
+	if position < min(nargs, sig.positional_count):
+		arg_val = <object> args[position]
+	else:
+		arg_val = <object> args[nargs + kwnames.index(name)]
+	arg_type = arg_val if types else type(arg_val)
+	return TypeError(f"argument {name!r} has unexpected type '{arg_type.__qualname__}'")
+
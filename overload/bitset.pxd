@@ -0,0 +1,26 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject
+from libc.stdint cimport uint64_t
+from libcpp.vector cimport vector
+from .engine cimport Engine
+
+
+cdef class BitsetShape:
+	cdef Py_ssize_t arguments
+	cdef vector[Py_ssize_t] slots
+	cdef vector[uint64_t] masks
+	cdef list positions
+
+
+cdef class BitsetTable(Engine):
+	cdef Py_ssize_t count
+	cdef Py_ssize_t words
+	cdef dict shapes
+
+	cdef BitsetShape shape(self, Py_ssize_t nargs, tuple kwnames)
+	cdef Py_ssize_t mask(self, BitsetShape shape, Py_ssize_t argument, PyObject* arg) except -1
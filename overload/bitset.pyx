@@ -0,0 +1,242 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject, Py_TYPE
+from libc.stdint cimport uint64_t
+from libcpp.vector cimport vector
+from .bind cimport MATCH_ANY, runMatcher
+from .bind_with cimport BIND_OK, bind_slots
+from .guard cimport type_version
+from .signature cimport Signature
+
+cdef extern from *:
+	"""
+	#include <stdint.h>
+	#if defined(_MSC_VER)
+	#include <intrin.h>
+	#endif
+
+	static int ovl_popcount(uint64_t word) {
+	#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(word);
+	#elif defined(_MSC_VER) && defined(_M_X64)
+		return (int) __popcnt64(word);
+	#else
+		int count = 0;
+		for (; word != 0; word &= word - 1) {
+			count++;
+		}
+		return count;
+	#endif
+	}
+
+	/* Return the index of the lowest set bit of a nonzero word */
+	static int ovl_lowest_bit(uint64_t word) {
+	#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(word);
+	#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return (int) index;
+	#else
+		int index = 0;
+		for (; (word & 1) == 0; word >>= 1) {
+			index++;
+		}
+		return index;
+	#endif
+	}
+	"""
+	int ovl_popcount(uint64_t word)
+	int ovl_lowest_bit(uint64_t word)
+
+
+cdef class BitsetShape:
+	"""Masks of a BitsetTable for calls with one shape (number of positional arguments and keyword names).
+	Masks are stored one after another in `masks`, the first one has a bit for every overload that binds the shape.
+	`slots` has the parameter index of each of the `arguments` for every overload, see bind_slots. `positions` has a
+	dict per argument from version tags of argument types to the index of their mask, or None if no overload checks
+	the argument.
+	"""
+	pass
+
+
+cdef class BitsetTable(Engine):
+	"""Resolves calls by intersecting bitsets of overloads, with one bit per overload.
+	For every argument of a call, the type of the argument maps to a mask of overloads that accept it at the parameter
+	it binds to. The overloads that bind the call are the intersection of these masks with the mask of overloads that
+	accept the shape of the call. Masks are computed on first use for each shape and argument type, after that a call
+	costs one lookup and one AND of `words` 64-bit words per argument. Masks of any width are handled by the same
+	loops over words, which compilers vectorize.
+	"""
+	def __cinit__(self, list functions):
+		self.count = len(functions)
+		self.words = (self.count + 63) // 64
+		self.shapes = {}
+
+	cdef list candidates(self, PyObject** args, Py_ssize_t nargs, tuple kwnames):
+		"""Return the overloads that bind the arguments of a vectorcall, or None if some argument type has no version
+		tag.
+		"""
+		cdef BitsetShape shape = self.shapes.get((nargs, kwnames))
+		cdef vector[uint64_t] result
+		cdef const uint64_t* mask
+		cdef uint64_t word
+		cdef unsigned int version
+		cdef Py_ssize_t count
+		cdef Py_ssize_t index
+		cdef Py_ssize_t i
+		cdef Py_ssize_t w
+
+		if shape is None:
+			shape = self.shape(nargs, kwnames)
+			self.shapes[(nargs, kwnames)] = shape
+		
+		result.assign(shape.masks.begin(), shape.masks.begin() + self.words)
+
+		for i in range(shape.arguments):
+			masks = shape.positions[i]
+			if masks is None:
+				continue
+			version = type_version(Py_TYPE(<object> args[i]))
+			if version == 0:
+				return None
+			
+			found = (<dict> masks).get(version)
+			if found is None:
+				index = self.mask(shape, i, args[i])
+				masks[version] = index
+				self.entries += 1
+			else:
+				index = found
+			
+			mask = shape.masks.data() + index * self.words
+			for w in range(self.words):
+				result[w] &= mask[w]
+		
+		count = 0
+		for w in range(self.words):
+			count += ovl_popcount(result[w])
+		
+		candidates = [None] * count
+		count = 0
+		for w in range(self.words):
+			word = result[w]
+			while word != 0:
+				candidates[count] = self.functions[w * 64 + ovl_lowest_bit(word)]
+				count += 1
+				word &= word - 1
+		return candidates
+
+	cdef bint extend(self, list functions) except -1:
+		"""Add bits for overloads `functions` to the masks of every shape. Masks of arguments that the new overloads
+		check are dropped, to be computed again on use, and the overloads are set in all other masks of shapes that
+		they bind.
+		"""
+		cdef Py_ssize_t first = self.count
+		cdef Py_ssize_t words
+		cdef vector[Py_ssize_t] binding
+		cdef vector[uint64_t] masks
+		cdef BitsetShape shape
+		cdef Signature sig
+		cdef Py_ssize_t nargs
+		cdef tuple kwnames
+		cdef Py_ssize_t position = -1
+		cdef Py_ssize_t slot
+		cdef Py_ssize_t i
+		cdef Py_ssize_t k
+		cdef Py_ssize_t m
+		cdef Py_ssize_t w
+
+		Engine.extend(self, functions)
+		self.count = len(self.signatures)
+		words = (self.count + 63) // 64
+
+		for (nargs, kwnames), shape in self.shapes.items():
+			shape.slots.resize(self.count * shape.arguments, -1)
+			binding.clear()
+			for k in range(first, self.count):
+				sig = self.signatures[k]
+				if bind_slots(sig, nargs, kwnames, shape.slots.data() + k * shape.arguments, &position) != BIND_OK:
+					continue
+				binding.push_back(k)
+				for i in range(shape.arguments):
+					slot = shape.slots[k * shape.arguments + i]
+					if slot != -1 and sig.parameters[slot].matcher.kind != MATCH_ANY:
+						if shape.positions[i] is not None:
+							self.entries -= len(shape.positions[i])
+						shape.positions[i] = {}
+			
+			# Copy the masks that are still used, widened to the new number of words
+			masks.assign(words, 0)
+			for w in range(self.words):
+				masks[w] = shape.masks[w]
+			for found in shape.positions:
+				if found is None:
+					continue
+				for version, index in (<dict> found).items():
+					found[version] = masks.size() // words
+					masks.resize(masks.size() + words, 0)
+					for w in range(self.words):
+						masks[masks.size() - words + w] = shape.masks[<Py_ssize_t> index * self.words + w]
+			shape.masks.swap(masks)
+
+			for k in binding:
+				for m in range(<Py_ssize_t> shape.masks.size() // words):
+					shape.masks[m * words + k // 64] |= (<uint64_t> 1) << (k % 64)
+		
+		self.words = words
+		return True
+
+	cdef BitsetShape shape(self, Py_ssize_t nargs, tuple kwnames):
+		"""Return the masks for calls with `nargs` positional arguments and keywords `kwnames`."""
+		cdef BitsetShape shape = BitsetShape()
+		cdef Signature sig
+		cdef Py_ssize_t position = -1
+		cdef Py_ssize_t slot
+		cdef Py_ssize_t i
+		cdef Py_ssize_t k
+
+		shape.arguments = nargs + len(kwnames)
+		shape.slots.assign(self.count * shape.arguments, -1)
+		shape.masks.assign(self.words, 0)
+		shape.positions = [None] * shape.arguments
+
+		for k in range(self.count):
+			sig = self.signatures[k]
+			if bind_slots(sig, nargs, kwnames, shape.slots.data() + k * shape.arguments, &position) != BIND_OK:
+				continue
+			shape.masks[k // 64] |= (<uint64_t> 1) << (k % 64)
+
+			for i in range(shape.arguments):
+				slot = shape.slots[k * shape.arguments + i]
+				if slot != -1 and sig.parameters[slot].matcher.kind != MATCH_ANY and shape.positions[i] is None:
+					shape.positions[i] = {}
+		
+		return shape
+
+	cdef Py_ssize_t mask(self, BitsetShape shape, Py_ssize_t argument, PyObject* arg) except -1:
+		"""Append the mask of overloads that accept `arg` as the argument at index `argument` to the masks of
+		`shape`, and return its index.
+		"""
+		cdef Py_ssize_t index = shape.masks.size() // self.words
+		cdef Signature sig
+		cdef Py_ssize_t slot
+		cdef Py_ssize_t k
+
+		shape.masks.resize(shape.masks.size() + self.words, 0)
+
+		for k in range(self.count):
+			if not shape.masks[k // 64] & ((<uint64_t> 1) << (k % 64)):
+				continue
+			slot = shape.slots[k * shape.arguments + argument]
+			if slot != -1:
+				sig = self.signatures[k]
+				if not runMatcher(&sig.parameters[slot].matcher, arg):
+					continue
+			shape.masks[index * self.words + k // 64] |= (<uint64_t> 1) << (k % 64)
+		
+		return index
@@ -0,0 +1,23 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from libcpp cimport bool
+from libcpp.vector cimport vector
+
+
+cdef class DispatchCache:
+	cdef dict slots
+	cdef list keys
+	cdef list values
+	cdef vector[bool] referenced
+	cdef Py_ssize_t hand
+	cdef readonly Py_ssize_t capacity
+
+	cdef object get(self, object key)
+	cdef void put(self, object key, object value) except *
+	cdef void discard(self, list keys) except *
+	cdef void clear(self)
+	cdef void resize(self, Py_ssize_t capacity)
@@ -0,0 +1,102 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+
+
+cdef class DispatchCache:
+	"""A mapping with at most `capacity` entries, which evicts entries with the CLOCK policy.
+	Entries are kept in a ring of slots, each with a bit that is set when the entry is used. When the cache is full, a
+	hand sweeps the ring, clearing set bits, and evicts the first entry whose bit is already clear. This approximates
+	evicting the least recently used entry, without reordering anything on hits.
+	Keys should not reference argument types, so that the cache does not keep them alive (see dispatch_key).
+	"""
+	def __cinit__(self, Py_ssize_t capacity):
+		self.slots = {}
+		self.keys = []
+		self.values = []
+		self.hand = 0
+		self.capacity = capacity
+
+	def __len__(self):
+		return len(self.keys)
+
+	cdef object get(self, object key):
+		"""Return the value for `key`, or None."""
+		slot = self.slots.get(key)
+		if slot is None:
+			return None
+		self.referenced[<Py_ssize_t> slot] = True
+		return self.values[<Py_ssize_t> slot]
+
+	cdef void put(self, object key, object value) except *:
+		"""Insert `value` for `key`, evicting an entry if the cache is full.
+		A resolution can reenter the overloaded function and cache the same key before it returns, in that case the
+		value of the entry is replaced.
+		"""
+		cdef Py_ssize_t slot
+
+		if self.capacity == 0:
+			return
+		
+		found = self.slots.get(key)
+		if found is not None:
+			self.values[<Py_ssize_t> found] = value
+			self.referenced[<Py_ssize_t> found] = True
+			return
+		
+		if len(self.keys) < self.capacity:
+			self.slots[key] = len(self.keys)
+			self.keys.append(key)
+			self.values.append(value)
+			self.referenced.push_back(False)
+			return
+		
+		while self.referenced[self.hand]:
+			self.referenced[self.hand] = False
+			self.hand = (self.hand + 1) % self.capacity
+		
+		slot = self.hand
+		self.hand = (self.hand + 1) % self.capacity
+		del self.slots[self.keys[slot]]
+		self.slots[key] = slot
+		self.keys[slot] = key
+		self.values[slot] = value
+
+	cdef void discard(self, list keys) except *:
+		"""Remove the entries for `keys` that are in the cache, keeping the order of the others in the ring."""
+		cdef Py_ssize_t kept = 0
+		cdef Py_ssize_t slot
+
+		for key in keys:
+			self.slots.pop(key, None)
+		
+		for slot in range(len(self.keys)):
+			key = self.keys[slot]
+			if key not in self.slots:
+				continue
+			self.slots[key] = kept
+			self.keys[kept] = key
+			self.values[kept] = self.values[slot]
+			self.referenced[kept] = self.referenced[slot]
+			kept += 1
+		
+		del self.keys[kept:]
+		del self.values[kept:]
+		self.referenced.resize(kept)
+		self.hand = 0
+
+	cdef void clear(self):
+		"""Remove all entries."""
+		self.slots.clear()
+		self.keys.clear()
+		self.values.clear()
+		self.referenced.clear()
+		self.hand = 0
+
+	cdef void resize(self, Py_ssize_t capacity):
+		"""Change the capacity of the cache, removing all entries."""
+		self.clear()
+		self.capacity = capacity
@@ -0,0 +1,18 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject
+
+
+cdef class Engine:
+	cdef list functions
+	cdef list signatures
+	cdef readonly bint type_based
+	cdef Py_ssize_t entries
+
+	cdef bint usable(self, bint type_based)
+	cdef bint extend(self, list functions) except -1
+	cdef list candidates(self, PyObject** args, Py_ssize_t nargs, tuple kwnames)
@@ -0,0 +1,52 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from .signature import signature_cache
+from .signature cimport Signature
+
+
+cdef class Engine:
+	"""Base class of dispatch engines, which find the overloads that bind the arguments of a call without binding
+	each overload in turn.
+	Engines precompute tables from the signatures of `functions`. When overloads are added to the set, engines that
+	can update their tables are extended, and others are replaced.
+	`type_based` tells if all overloads are type-based, see Signature.type_based. `entries` counts entries that were
+	added to tables for argument types, so that the overload set can bound them.
+	"""
+	def __cinit__(self, list functions):
+		cdef Signature sig
+		self.functions = list(functions)
+		self.signatures = [signature_cache[func] for func in functions]
+		self.type_based = True
+		self.entries = 0
+
+		for sig in self.signatures:
+			self.type_based = self.type_based and sig.type_based
+
+	cdef bint usable(self, bint type_based):
+		"""Return True if the engine can resolve calls while the TypeGuard of the overload set reports `type_based`.
+		By default, engines map types of arguments to results, so all matches must only depend on types.
+		"""
+		return self.type_based and type_based
+
+	cdef bint extend(self, list functions) except -1:
+		"""Add overloads `functions` after the others. Return False if the engine must be replaced instead.
+		Subclasses that update their tables call this first.
+		"""
+		cdef Signature sig
+
+		for func in functions:
+			sig = signature_cache[func]
+			self.functions.append(func)
+			self.signatures.append(sig)
+			self.type_based = self.type_based and sig.type_based
+		return True
+
+	cdef list candidates(self, PyObject** args, Py_ssize_t nargs, tuple kwnames):
+		"""Return the overloads that bind the arguments of a vectorcall, in the order of `functions`, or None if the
+		engine can not resolve this call.
+		"""
+		return None
@@ -0,0 +1,56 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject, PyTypeObject
+from libcpp.vector cimport vector
+
+cdef extern from *:
+	"""
+	static PyObject *ovl_version_lookup_name = NULL;
+
+	/* Return the version tag of a type, assigning one if needed, or 0 if the type has no valid version tag.
+	 * CPython changes the tag of a type whenever the type or any of its bases is modified.
+	 */
+	static unsigned int ovl_type_version(PyTypeObject *type) {
+	#if PY_VERSION_HEX >= 0x030C0000
+		/* Modifications reset the tag to 0, so a nonzero tag is valid */
+		if (type->tp_version_tag != 0) {
+			return type->tp_version_tag;
+		}
+		if (!PyUnstable_Type_AssignVersionTag(type)) {
+			return 0;
+		}
+	#else
+		if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+			if (ovl_version_lookup_name == NULL) {
+				ovl_version_lookup_name = PyUnicode_InternFromString("__class__");
+				if (ovl_version_lookup_name == NULL) {
+					PyErr_Clear();
+					return 0;
+				}
+			}
+			/* Looking up a cacheable name assigns a version tag as a side effect */
+			_PyType_Lookup(type, ovl_version_lookup_name);
+			if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+				return 0;
+			}
+		}
+	#endif
+		return type->tp_version_tag;
+	}
+	"""
+	unsigned int type_version "ovl_type_version" (PyTypeObject* type)
+
+
+cdef class TypeGuard:
+	cdef list metaclasses
+	cdef vector[unsigned int] versions
+	cdef bint abc
+	cdef object abc_token
+	cdef readonly bint type_based
+
+	cdef void add(self, PyTypeObject* metaclass) except *
+	cdef bint check(self) except -1
@@ -0,0 +1,56 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from abc import ABCMeta, get_cache_token
+from .bind cimport hasTypeBasedInstanceCheck
+
+
+cdef class TypeGuard:
+	"""Watches metaclasses of annotations that are matched by calling `isinstance`.
+	Results of such matches only depend on the type of the argument until one of these metaclasses is modified (for
+	example, by assigning a new `__instancecheck__`), or a class is registered with an ABC. TypeGuard detects both
+	through version tags of the metaclasses and the ABC cache token.
+	"""
+	def __cinit__(self):
+		self.metaclasses = []
+		self.abc = False
+		self.abc_token = None
+		self.type_based = True
+
+	cdef void add(self, PyTypeObject* metaclass) except *:
+		"""Start watching `metaclass`. The next check will report a change."""
+		if <object> metaclass in self.metaclasses:
+			return
+
+		self.metaclasses.append(<object> metaclass)
+		self.versions.push_back(0)
+		if issubclass(<object> metaclass, ABCMeta):
+			self.abc = True
+
+	cdef bint check(self) except -1:
+		"""Return True if nothing changed since the last check. Otherwise, remember the current state and return
+		False. After a change, `type_based` tells if matches through watched metaclasses still only depend on types.
+		"""
+		cdef bint unchanged = True
+		cdef unsigned int version
+		cdef Py_ssize_t i
+
+		for i in range(len(self.metaclasses)):
+			version = type_version(<PyTypeObject*> self.metaclasses[i])
+			if version == 0 or version != self.versions[i]:
+				self.versions[i] = version
+				unchanged = False
+		
+		if self.abc:
+			token = get_cache_token()
+			if token is not self.abc_token and token != self.abc_token:
+				self.abc_token = token
+				unchanged = False
+		
+		if not unchanged:
+			self.type_based = all(hasTypeBasedInstanceCheck(metaclass) for metaclass in self.metaclasses)
+		
+		return unchanged
@@ -4,14 +4,81 @@
 #cython: boundscheck=False
 #cython: wraparound=False
 #cython: language_level = 3
-from inspect import signature
-from itertools import count
-from cpython cimport PyObject
-from libcpp.vector cimport vector
+from inspect import _POSITIONAL_ONLY
+import inspect
+from functools import partial
+from cpython cimport PyObject, PyTypeObject, Py_INCREF, Py_XINCREF, Py_XDECREF, Py_TYPE
+from cpython.tuple cimport PyTuple_New, PyTuple_SET_ITEM, PyTuple_GET_SIZE, PyTuple_GET_ITEM
+from cpython.sequence cimport PySequence_Fast_ITEMS
 import overload as ovl_module
-from .bind_with cimport bind_with
+from libcpp.vector cimport vector
+from .bind_with cimport BIND_OK, bind_with, bind_slots, bind_types, bind_distances, bind_failure_reason
 from .signature import signature_cache
-from .signature cimport createSignature
+from .signature cimport Signature, createSignature, keywordSlot, acceptsShape, signaturesDisjoint
+from .bind cimport CHECK_SHALLOW, CHECK_FIRST, CHECK_SAMPLE, CHECK_FULL, ContainerCheck
+from .guard cimport TypeGuard, type_version
+from .cache cimport DispatchCache
+from .engine cimport Engine
+from .tree cimport DecisionTree
+from .bitset cimport BitsetTable
+from .trie cimport ParameterTrie
+
+cdef extern from "Python.h":
+    Py_ssize_t PY_SSIZE_T_MAX
+    ctypedef PyObject* (*vectorcallfunc)(PyObject* callable, PyObject** args, size_t nargsf, PyObject* kwnames)
+    Py_ssize_t PyVectorcall_NARGS(size_t nargsf)
+    object PyObject_Vectorcall(object callable, PyObject** args, size_t nargsf, PyObject* kwnames)
+    size_t PY_VECTORCALL_ARGUMENTS_OFFSET
+    PyObject* PyFunction_GET_DEFAULTS(object func)
+    object PyMethod_New(object func, object self)
+
+cdef extern from *:
+    """
+    static void ovl_enable_vectorcall(PyTypeObject *type, Py_ssize_t offset) {
+        type->tp_vectorcall_offset = offset;
+        type->tp_call = PyVectorcall_Call;
+        type->tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+    }
+    """
+    void ovl_enable_vectorcall(PyTypeObject* type, Py_ssize_t offset)
+
+cdef int _c_positional_only = _POSITIONAL_ONLY
+
+
+cdef enum Resolution:
+    RESOLVE_UNIQUE  # Exactly one overload must match the arguments
+    RESOLVE_BEST  # The most specific of matching overloads is picked
+
+
+cdef enum EngineKind:
+    ENGINE_LINEAR  # Bind each overload in turn, see bind_candidates
+    ENGINE_TREE  # Walk a decision tree over argument types, see DecisionTree
+    ENGINE_BITSET  # Intersect bitsets of overloads that accept each argument, see BitsetTable
+    ENGINE_TRIE  # Bind all overloads at once along a trie of their parameters, see ParameterTrie
+    ENGINE_ADAPTIVE  # Pick one of the above from counters of calls, see adapt
+
+
+cdef enum:
+    ADAPT_WINDOW = 1024  # Number of calls after which an adaptive set picks its engine again
+    ADAPT_MISS_RATIO = 8  # Calls of a window are mostly cached if less than one in this many misses the caches
+    ADAPT_OVERLOADS = 8  # Sets with fewer overloads always use "linear"
+
+
+cdef enum:
+    INLINE_ENTRIES = 4  # Entries of the inline cache, the first one is the monomorphic slot
+    INLINE_ARGUMENTS = 4  # Calls with more arguments skip the inline cache
+
+
+cdef struct InlineEntry:
+    PyObject* func  # Owned, NULL in empty entries
+    PyObject* kwnames  # Owned, NULL for calls without keyword arguments
+    Py_ssize_t nargs
+    unsigned int versions[INLINE_ARGUMENTS]  # Version tags of argument types
+    # Arguments that calls are forwarded with in positional form, 0 to forward calls as they are, see inline_plan
+    Py_ssize_t forward_count
+    # Index of the argument for each positional parameter, or a negative index from the end of defaults
+    Py_ssize_t forward[INLINE_ARGUMENTS]
+
 
 _registry = {}
 """A registry of all overloaded functions.  
@@ -19,82 +86,1072 @@ This is how decorated functions communicate with each other to merge several fun
 Not for manual editing.
 """
 
-cdef perform_overload_resolution(tuple args, dict kwargs, list functions, str module, str qualname):
-    cdef list candidates = []
-    cdef list fail_reasons = []
 
-    for func in functions:
-        error = bind_with(signature_cache[func], isinstance, args, kwargs)
-        if error is not None:
-            fail_reasons.append(error)
+cdef class OverloadedFunction:
+    """A function with several definitions, one of which is picked on each call depending on the arguments.
+    Objects of this type are created by the `overload` decorators and should not be created manually.
+    Overloads are only recorded on registration, and compiled on the first call after it, see compile_overloads.
+    Once the set is frozen, `functions` is a tuple, and registering more overloads raises RuntimeError.
+    """
+    cdef vectorcallfunc vectorcall
+    cdef InlineEntry inline_cache[INLINE_ENTRIES]
+    cdef dict __dict__
+    cdef readonly object functions  # A list, or a tuple once the set is frozen
+    cdef readonly bint frozen
+    cdef list pending  # Overloads that were registered since the set was last compiled, with their typing flag
+    cdef bint stale_typing  # Compiled signatures with typing support must be compiled again for new options
+    cdef bint overloads_disjoint
+    cdef DispatchCache dispatch_cache
+    cdef TypeGuard guard
+    cdef dict arity_buckets
+    cdef ContainerCheck container_check
+    cdef int resolution
+    cdef int engine
+    cdef int current_engine
+    cdef Engine dispatcher
+    cdef Py_ssize_t window_calls
+    cdef Py_ssize_t window_misses
+    cdef Py_ssize_t window_rebuilds
+    cdef bint tables_overflow
+    cdef Py_ssize_t generation
+    cdef str module
+    cdef str qualname
+
+    def __cinit__(self, str module, str qualname):
+        self.vectorcall = <vectorcallfunc> overloaded_function_vectorcall
+        for i in range(INLINE_ENTRIES):
+            self.inline_cache[i].func = NULL
+            self.inline_cache[i].kwnames = NULL
+        self.functions = []
+        self.frozen = False
+        self.pending = []
+        self.stale_typing = False
+        self.overloads_disjoint = True
+        self.dispatch_cache = DispatchCache(1024)
+        self.guard = TypeGuard()
+        self.arity_buckets = {}
+        self.container_check.mode = CHECK_SHALLOW
+        self.container_check.items = 8
+        self.resolution = RESOLVE_UNIQUE
+        self.engine = ENGINE_ADAPTIVE
+        self.current_engine = ENGINE_LINEAR
+        self.dispatcher = None
+        self.window_calls = 0
+        self.window_misses = 0
+        self.window_rebuilds = 0
+        self.tables_overflow = False
+        self.generation = 0
+        self.module = module
+        self.qualname = qualname
+
+        self.__module__ = module
+        self.__qualname__ = qualname
+        self.__name__ = qualname[qualname.rfind(".")+1:]
+
+    def __dealloc__(self):
+        inline_clear(self)
+
+    def __get__(self, instance, owner):
+        if instance is None:
+            return self
+        return PyMethod_New(self, instance)
+
+    def __repr__(self):
+        return f"<overloaded function {self.module}.{self.qualname}>"
+
+    def resolve(self, *types, **kwtypes):
+        """Return the overload that a call with arguments of `types` and keyword arguments of `kwtypes` would pick,
+        raising the same errors as the call.
+        The returned function can be called directly in place of this one, as long as arguments have these types.
+        Annotations are matched with `issubclass`. Annotations that only some instances of a type match (like
+        `Literal` values of that type) raise TypeError, use `resolve_for` for them.
+        """
+        return resolve_types(self, types, kwtypes)
+
+    def resolve_for(self, *args, **kwargs):
+        """Return the overload that a call with `args` and `kwargs` would pick, raising the same errors as the call."""
+        return resolve_values(self, args, kwargs)
+
+    def freeze(self):
+        """Seal the overload set: compile it, pick its final dispatch engine, and make further registrations raise
+        RuntimeError. Adaptive sets pick their engine from the overloads alone, and stop adapting. Returns self.
+        """
+        freeze_overloads(self)
+        return self
+
+    def specialize(self, *types):
+        """Return a callable that calls the overload picked for positional arguments of exactly `types` directly.
+        Calls with arguments of other types (including subclasses) or with keyword arguments go through full
+        dispatch. The specialization follows changes to the overload set and to `types`.
+        """
+        return create_specialization(self, types)
+
+    @property
+    def disjoint(self):
+        """True if it was proven when compiling the set that no call can match more than one of `functions`."""
+        compile_overloads(self)
+        return self.overloads_disjoint
+
+    @property
+    def __signature__(self):
+        """A signature that accepts any arguments, as overloads differ in theirs."""
+        return inspect.Signature([
+            inspect.Parameter("args", inspect.Parameter.VAR_POSITIONAL),
+            inspect.Parameter("kwargs", inspect.Parameter.VAR_KEYWORD),
+        ])
+
+    @property
+    def active_engine(self):
+        """The name of the engine that resolves calls that are not cached, see the `engine` option of `overload`."""
+        for name, engine in _engines.items():
+            if engine == dispatch_engine(self):
+                return name
+
+
+cdef Py_ssize_t vectorcall_offset(OverloadedFunction ovl):
+    """Return the offset of the vectorcall pointer inside of OverloadedFunction objects."""
+    return <char*> &ovl.vectorcall - <char*> <PyObject*> ovl
+
+
+ovl_enable_vectorcall(<PyTypeObject*> OverloadedFunction, vectorcall_offset(OverloadedFunction("", "")))
+
+
+cdef class Specialization:
+    """An overloaded function specialized for positional arguments of exact types, see OverloadedFunction.specialize.
+    Calls check the type of each argument with a pointer comparison, and go directly to the overload that was
+    resolved for these types. The overload is resolved again when the overload set or one of the types changes.
+    """
+    cdef vectorcallfunc vectorcall
+    cdef readonly OverloadedFunction overloaded_function
+    cdef readonly tuple types
+    cdef Py_ssize_t count  # Number of types
+    cdef vector[unsigned int] versions  # Version tags of types at the last resolution
+    cdef Py_ssize_t generation  # Generation of the overload set at the last resolution
+    cdef object func  # None if the types resolve to no single overload
+
+    def __cinit__(self):
+        self.vectorcall = <vectorcallfunc> specialization_vectorcall
+        self.types = ()
+        self.count = 0
+        self.generation = -1
+        self.func = None
+
+    def __init__(self, *args, **kwargs):
+        raise TypeError("specializations can only be created with OverloadedFunction.specialize")
+
+    def __repr__(self):
+        if self.overloaded_function is None:
+            return "<uninitialized overloaded function specialization>"
+        names = ", ".join(cls.__qualname__ for cls in self.types)
+        return f"<overloaded function {self.overloaded_function.module}.{self.overloaded_function.qualname}[{names}]>"
+
+
+cdef Specialization create_specialization(OverloadedFunction overloaded_function, tuple types):
+    """Return a specialization of `overloaded_function` for positional arguments of exactly `types`."""
+    cdef Specialization self = Specialization.__new__(Specialization)
+
+    for cls in types:
+        if not isinstance(cls, type):
+            raise TypeError(f"expected a type, got {cls!r}")
+    
+    self.overloaded_function = overloaded_function
+    self.types = types
+    self.count = len(types)
+    self.versions.assign(self.count, 0)
+
+    # Resolve now, so that errors surface when specializing. Types that the overloads can not be matched by are
+    # accepted, their calls go through full dispatch
+    if not refresh_specialization(self):
+        try:
+            resolve_types(overloaded_function, types, {})
+        except ovl_module.OverloadError:
+            raise
+        except TypeError:
+            pass
+    return self
+
+
+cdef bint refresh_specialization(Specialization self) except -1:
+    """Resolve the overload of `self` again if its overload set or one of its types changed since the last
+    resolution. Return False if the types of `self` resolve to no single overload, or if the overloads can not be
+    matched by type alone (see OverloadedFunction.resolve), in which case calls go through full dispatch.
+    """
+    cdef OverloadedFunction ovl = self.overloaded_function
+    cdef vector[unsigned int] versions
+    cdef bint unchanged = True
+    cdef Py_ssize_t i
+
+    compile_overloads(ovl)
+    if not ovl.guard.check():
+        clear_caches(ovl)
+    
+    versions.resize(self.count)
+    for i in range(self.count):
+        versions[i] = type_version(<PyTypeObject*> PyTuple_GET_ITEM(self.types, i))
+        if versions[i] == 0 or versions[i] != self.versions[i]:
+            unchanged = False
+    
+    if unchanged and self.generation == ovl.generation:
+        return self.func is not None
+    
+    # The resolution is only recorded once it is complete, so that errors do not leave a stale overload current
+    self.func = None
+    try:
+        func = resolve_types(ovl, self.types, {})
+    except (ovl_module.OverloadError, TypeError):
+        func = None
+    
+    self.func = func
+    self.versions.swap(versions)
+    self.generation = ovl.generation
+    return self.func is not None
+
+
+cdef object specialization_vectorcall(
+    Specialization self, PyObject** args, size_t nargsf, PyObject* kwnames
+):
+    """Vectorcall entry point of specializations.
+    Calls that do not match the types of the specialization are forwarded to the overloaded function. Calls that do
+    check the version tags of their types and the state of the overload set inline, like the inline cache of
+    overloaded_function_vectorcall does, and only resolve again after a change, see refresh_specialization.
+    """
+    cdef OverloadedFunction ovl = self.overloaded_function
+    cdef Py_ssize_t nargs = PyVectorcall_NARGS(nargsf)
+    cdef PyTypeObject* arg_type
+    cdef unsigned int version
+    cdef bint current = True
+    cdef Py_ssize_t i
+
+    if ovl is None:
+        raise TypeError("specializations can only be created with OverloadedFunction.specialize")
+    if kwnames is NULL and nargs == self.count:
+        for i in range(nargs):
+            arg_type = Py_TYPE(<object> args[i])
+            if arg_type != <PyTypeObject*> PyTuple_GET_ITEM(self.types, i):
+                break
+            version = type_version(arg_type)
+            if version == 0 or version != self.versions[i]:
+                current = False
         else:
-            candidates.append(func)
+            if not current or self.generation != ovl.generation or len(ovl.pending) != 0 or ovl.stale_typing:
+                refresh_specialization(self)
+            elif len(ovl.guard.metaclasses) != 0 and not ovl.guard.check():
+                clear_caches(ovl)
+                refresh_specialization(self)
+            if self.func is not None:
+                return PyObject_Vectorcall(self.func, args, nargsf, NULL)
+    
+    return PyObject_Vectorcall(ovl, args, nargsf, kwnames)
+
+
+cdef Py_ssize_t specialization_vectorcall_offset(Specialization spec):
+    """Return the offset of the vectorcall pointer inside of Specialization objects."""
+    return <char*> &spec.vectorcall - <char*> <PyObject*> spec
+
+
+ovl_enable_vectorcall(<PyTypeObject*> Specialization, specialization_vectorcall_offset(Specialization.__new__(Specialization)))
+
+
+cdef tuple pack_args(PyObject** args, Py_ssize_t nargs):
+    """Pack positional arguments of a vectorcall into a tuple."""
+    cdef tuple result = PyTuple_New(nargs)
+    cdef Py_ssize_t i
+
+    for i in range(nargs):
+        Py_INCREF(<object> args[i])
+        PyTuple_SET_ITEM(result, i, <object> args[i])
+    
+    return result
+
+
+cdef dict pack_kwargs(PyObject** args, Py_ssize_t nargs, tuple kwnames):
+    """Pack keyword arguments of a vectorcall into a dict."""
+    cdef dict result = {}
+    cdef Py_ssize_t i
+
+    for i in range(len(kwnames)):
+        result[kwnames[i]] = <object> args[nargs + i]
+    
+    return result
+
+
+cdef tuple dispatch_key(PyObject** args, Py_ssize_t nargs, tuple kwnames):
+    """Return a key that identifies a call by its shape and the exact types of its arguments, or None if some type
+    has no version tag.
+    Types are represented by their version tags, which CPython changes whenever a type or its bases are modified.
+    Two calls with equal keys bind to the same overload as long as all matchers are type-based.
+    """
+    cdef Py_ssize_t nkwargs = len(kwnames)
+    cdef tuple key = PyTuple_New(2 + nargs + nkwargs)
+    cdef unsigned int version
+    cdef object item
+    cdef Py_ssize_t i
+
+    item = nargs
+    Py_INCREF(item)
+    PyTuple_SET_ITEM(key, 0, item)
+    Py_INCREF(kwnames)
+    PyTuple_SET_ITEM(key, 1, kwnames)
+
+    for i in range(nargs + nkwargs):
+        version = type_version(Py_TYPE(<object> args[i]))
+        if version == 0:
+            return None
+        item = version
+        Py_INCREF(item)
+        PyTuple_SET_ITEM(key, 2 + i, item)
+    
+    return key
+
+
+cdef list arity_bucket(OverloadedFunction ovl, Py_ssize_t nargs):
+    """Return the overloads from `ovl` that accept `nargs` positional arguments.
+    Buckets are built on first use for each number of arguments, and dropped when a new overload is registered.
+    """
+    cdef Signature sig
+    cdef list bucket = ovl.arity_buckets.get(nargs)
+
+    if bucket is None:
+        bucket = []
+        for func in ovl.functions:
+            sig = signature_cache[func]
+            if sig.min_positional <= nargs <= sig.max_positional:
+                bucket.append(func)
+        ovl.arity_buckets[nargs] = bucket
+    
+    return bucket
+
+
+cdef inline object inline_lookup(OverloadedFunction ovl, PyObject** args, Py_ssize_t nargs, PyObject* kwnames):
+    """Return the function that the inline cache of `ovl` holds for the arguments of a vectorcall, or None.
+    Entries match calls with the same number of positional arguments, the same keyword names tuple (compared by
+    identity), and the same version tags of argument types. A hit moves the entry into the monomorphic slot.
+    """
+    cdef Py_ssize_t nkwargs = 0 if kwnames is NULL else PyTuple_GET_SIZE(<object> kwnames)
+    cdef Py_ssize_t count = nargs + nkwargs
+    cdef unsigned int versions[INLINE_ARGUMENTS]
+    cdef InlineEntry* entry
+    cdef InlineEntry hit
+    cdef Py_ssize_t i
+    cdef Py_ssize_t e
+
+    if count > INLINE_ARGUMENTS or ovl.inline_cache[0].func is NULL:
+        return None
+    if nkwargs == 0:
+        kwnames = NULL
+    
+    for i in range(count):
+        versions[i] = type_version(Py_TYPE(<object> args[i]))
+        if versions[i] == 0:
+            return None
+    
+    for e in range(INLINE_ENTRIES):
+        entry = &ovl.inline_cache[e]
+        if entry.func is NULL:
+            break
+        if entry.nargs != nargs or entry.kwnames != kwnames:
+            continue
+        for i in range(count):
+            if entry.versions[i] != versions[i]:
+                break
+        else:
+            if e != 0:
+                hit = entry[0]
+                entry[0] = ovl.inline_cache[0]
+                ovl.inline_cache[0] = hit
+            return <object> ovl.inline_cache[0].func
     
+    return None
+
+
+cdef void inline_insert(OverloadedFunction ovl, PyObject** args, Py_ssize_t nargs, tuple kwnames, object func):
+    """Put `func` for the arguments of a vectorcall into the monomorphic slot of the inline cache of `ovl`, moving
+    other entries back and dropping the oldest one. Only results that may be cached by type are inserted.
+    """
+    cdef Py_ssize_t count = nargs + len(kwnames)
+    cdef InlineEntry* entry
+    cdef Py_ssize_t i
+
+    if count > INLINE_ARGUMENTS or ovl.dispatch_cache.capacity == 0:
+        return
+    
+    entry = &ovl.inline_cache[INLINE_ENTRIES - 1]
+    Py_XDECREF(entry.func)
+    Py_XDECREF(entry.kwnames)
+    for i in reversed(range(1, INLINE_ENTRIES)):
+        ovl.inline_cache[i] = ovl.inline_cache[i - 1]
+    
+    entry = &ovl.inline_cache[0]
+    entry.func = <PyObject*> func
+    entry.kwnames = <PyObject*> kwnames if len(kwnames) != 0 else NULL
+    entry.nargs = nargs
+    for i in range(count):
+        entry.versions[i] = type_version(Py_TYPE(<object> args[i]))
+    inline_plan(entry, signature_cache[func], nargs, kwnames)
+    Py_XINCREF(entry.func)
+    Py_XINCREF(entry.kwnames)
+
+
+cdef void inline_plan(InlineEntry* entry, Signature sig, Py_ssize_t nargs, tuple kwnames):
+    """Plan how calls that hit `entry` pass keyword arguments to positional parameters of the function positionally,
+    if it accepts that, see Signature.positional_form. The arguments were bound to `sig` already, so the function
+    does not have to match keywords to parameters again. Parameters that are skipped in between get their default.
+    """
+    cdef Py_ssize_t count = nargs
+    cdef Py_ssize_t slot
+    cdef Py_ssize_t i
+
+    entry.forward_count = 0
+    if len(kwnames) == 0 or not sig.positional_form:
+        return
+    
+    for i in range(INLINE_ARGUMENTS):
+        entry.forward[i] = i if i < nargs else PY_SSIZE_T_MAX
+    
+    for i in range(len(kwnames)):
+        slot = keywordSlot(sig, kwnames, i)
+        # Keywords that go into '**kwargs' or to keyword-only parameters can't be passed positionally
+        if slot == -1 or slot >= sig.positional_count or sig.parameters[slot].kind == _c_positional_only:
+            return
+        if slot >= INLINE_ARGUMENTS:
+            return
+        entry.forward[slot] = nargs + i
+        count = max(count, slot + 1)
+    
+    for i in range(nargs, count):
+        if entry.forward[i] == PY_SSIZE_T_MAX:
+            if not sig.parameters[i].has_default:
+                return
+            entry.forward[i] = i - sig.positional_count
+    
+    entry.forward_count = count
+
+
+cdef object inline_forward(InlineEntry* entry, object func, PyObject** args, size_t nargsf, PyObject* kwnames):
+    """Call `func` with the arguments of a vectorcall in positional form, as planned by inline_plan for `entry`."""
+    cdef PyObject* stack[INLINE_ARGUMENTS + 1]
+    cdef PyObject* defaults = PyFunction_GET_DEFAULTS(func)
+    cdef Py_ssize_t count = entry.forward_count
+    cdef Py_ssize_t source
+    cdef Py_ssize_t i
+
+    for i in range(count):
+        source = entry.forward[i]
+        if source >= 0:
+            stack[i + 1] = args[source]
+        elif defaults is not NULL and PyTuple_GET_SIZE(<object> defaults) + source >= 0:
+            stack[i + 1] = PySequence_Fast_ITEMS(<object> defaults)[PyTuple_GET_SIZE(<object> defaults) + source]
+        else:
+            # Defaults were replaced since the plan was made
+            return PyObject_Vectorcall(func, args, nargsf, kwnames)
+    
+    return PyObject_Vectorcall(func, stack + 1, count | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL)
+
+
+cdef void inline_clear(OverloadedFunction ovl):
+    """Empty the inline cache of `ovl`."""
+    cdef Py_ssize_t i
+
+    for i in range(INLINE_ENTRIES):
+        Py_XDECREF(ovl.inline_cache[i].func)
+        Py_XDECREF(ovl.inline_cache[i].kwnames)
+        ovl.inline_cache[i].func = NULL
+        ovl.inline_cache[i].kwnames = NULL
+
+
+cdef void clear_caches(OverloadedFunction ovl):
+    """Drop all resolutions that `ovl` has cached, and its dispatch engine. Specializations of `ovl` notice this
+    through its generation.
+    """
+    ovl.generation += 1
+    inline_clear(ovl)
+    ovl.dispatch_cache.clear()
+    ovl.dispatcher = None
+
+
+cdef perform_overload_resolution(OverloadedFunction ovl, PyObject** args, Py_ssize_t nargs, tuple kwnames):
+    """Return the function from the overload set `ovl` that matches the arguments of a vectorcall.
+    Caches of `ovl` must be up to date with its TypeGuard, see overloaded_function_vectorcall.
+    """
+    cdef tuple key = None
+    cdef list candidates = None
+    cdef bint cacheable = True
+
+    if ovl.guard.type_based:
+        key = dispatch_key(args, nargs, kwnames)
+    if key is not None:
+        func = ovl.dispatch_cache.get(key)
+        if func is not None:
+            inline_insert(ovl, args, nargs, kwnames, func)
+            return func
+
+    ovl.window_misses += 1
+    if dispatch_engine(ovl) != ENGINE_LINEAR:
+        if ovl.dispatcher is None:
+            ovl.dispatcher = create_engine(ovl.current_engine, list(ovl.functions))
+        if ovl.dispatcher.usable(ovl.guard.type_based):
+            candidates = ovl.dispatcher.candidates(args, nargs, kwnames)
+            cacheable = ovl.dispatcher.type_based
+            if ovl.dispatcher.entries > ovl.dispatch_cache.capacity:
+                # Tables of engines are bounded like the dispatch cache, they are rebuilt from scratch when full
+                ovl.dispatcher = None
+                ovl.window_rebuilds += 1
+    if candidates is None:
+        candidates = bind_candidates(ovl, args, nargs, kwnames, &cacheable)
+    
+    func = pick_candidate(ovl, candidates, args, nargs, kwnames, False)
+    if key is not None and cacheable:
+        ovl.dispatch_cache.put(key, func)
+        inline_insert(ovl, args, nargs, kwnames, func)
+    return func
+
+
+cdef object pick_candidate(
+    OverloadedFunction ovl, list candidates, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint types
+):
+    """Return the overload that a vectorcall resolves to, given the `candidates` that bind its arguments, or raise an
+    OverloadError. If `types` is True, `args` are types of arguments instead, see bind_types.
+    """
     if len(candidates) == 0:
+        args_ = pack_args(args, nargs)
+        kwargs_ = pack_kwargs(args, nargs, kwnames)
+        functions = list(ovl.functions)
+        failures = bind_failures(functions, args, nargs, kwnames, types)
         raise ovl_module.NoMatchingOverloadError(
-            module, qualname, (args, kwargs), functions, fail_reasons
+            ovl.module, ovl.qualname, (args_, kwargs_), functions,
+            partial(explain_failures, functions, failures, args_, kwargs_, types)
         )
+    if len(candidates) > 1 and ovl.resolution == RESOLVE_BEST:
+        candidates = best_candidates(candidates, args, nargs, kwnames, types)
     if len(candidates) > 1:
-        raise ovl_module.AmbiguousOverloadError(module, qualname, (args, kwargs), candidates)
+        args_ = pack_args(args, nargs)
+        kwargs_ = pack_kwargs(args, nargs, kwnames)
+        raise ovl_module.AmbiguousOverloadError(ovl.module, ovl.qualname, (args_, kwargs_), list(candidates))
+
+    return candidates[0]
+
+
+cdef object resolve_types(OverloadedFunction ovl, tuple types, dict kwtypes):
+    """Return the overload from `ovl` that a call with instances of `types` and keyword arguments that are instances
+    of `kwtypes` resolves to, see OverloadedFunction.resolve.
+    """
+    cdef tuple values = types + tuple(kwtypes.values())
+    cdef tuple kwnames = tuple(kwtypes)
+    cdef PyObject** values_ptr = PySequence_Fast_ITEMS(values)
+    cdef Py_ssize_t nargs = len(types)
+    cdef list candidates = []
+    cdef Signature sig
+    cdef Py_ssize_t position = -1
+
+    for value in values:
+        if not isinstance(value, type):
+            raise TypeError(f"expected a type, got {value!r}")
+
+    compile_overloads(ovl)
+    for func in ovl.functions:
+        sig = signature_cache[func]
+        if acceptsShape(sig, nargs, kwnames) and bind_types(sig, values_ptr, nargs, kwnames, &position) == BIND_OK:
+            candidates.append(func)
+    
+    return pick_candidate(ovl, candidates, values_ptr, nargs, kwnames, True)
+
+
+cdef object resolve_values(OverloadedFunction ovl, tuple args, dict kwargs):
+    """Return the overload from `ovl` that a call with `args` and `kwargs` resolves to, like a call does."""
+    cdef tuple values = args + tuple(kwargs.values())
+    cdef tuple kwnames = tuple(kwargs)
+    cdef PyObject** values_ptr = PySequence_Fast_ITEMS(values)
+    cdef Py_ssize_t nargs = len(args)
+
+    compile_overloads(ovl)
+    if not ovl.guard.check():
+        clear_caches(ovl)
+    
+    func = inline_lookup(ovl, values_ptr, nargs, <PyObject*> kwnames)
+    if func is None:
+        func = perform_overload_resolution(ovl, values_ptr, nargs, kwnames)
+    return func
+
+
+cdef void adapt(OverloadedFunction ovl) except *:
+    """Pick the engine of an adaptive overload set from counters of the last window of calls, and reset them.
+    Sets whose calls are mostly served by caches keep their engine. Otherwise, sets with few overloads use "linear",
+    and larger sets use "bitset". Sets whose tables overflowed the cache size once, or with annotations that are not
+    type-based, use "trie" instead, which has no tables.
+    """
+    cdef int engine = ovl.current_engine
+
+    if ovl.window_rebuilds > 0:
+        ovl.tables_overflow = True
+    
+    if ovl.window_misses * ADAPT_MISS_RATIO >= ovl.window_calls:
+        engine = fitting_engine(ovl)
+    
+    if engine != ovl.current_engine:
+        ovl.current_engine = engine
+        ovl.dispatcher = None
+
+    ovl.window_calls = 0
+    ovl.window_misses = 0
+    ovl.window_rebuilds = 0
+
+
+cdef int fitting_engine(OverloadedFunction ovl) except -1:
+    """Return the engine that fits the overloads of `ovl` best for calls that miss the caches, see adapt."""
+    cdef Signature sig
+
+    if len(ovl.functions) < ADAPT_OVERLOADS:
+        return ENGINE_LINEAR
+    if ovl.tables_overflow or ovl.dispatch_cache.capacity == 0:
+        return ENGINE_TRIE
+    for func in ovl.functions:
+        sig = signature_cache[func]
+        if not sig.type_based:
+            return ENGINE_TRIE
+    return ENGINE_BITSET
+
+
+cdef inline int dispatch_engine(OverloadedFunction ovl):
+    """Return the engine that `ovl` dispatches uncached calls with. The tables of "tree" and "bitset" are bounded by
+    the cache size, so these engines fall back to "linear" when caching is disabled.
+    """
+    if ovl.dispatch_cache.capacity == 0 and (ovl.current_engine == ENGINE_TREE or ovl.current_engine == ENGINE_BITSET):
+        return ENGINE_LINEAR
+    return ovl.current_engine
+
+
+cdef Engine create_engine(int engine, list functions):
+    """Return a dispatch engine of kind `engine` for the overloads `functions`."""
+    if engine == ENGINE_TREE:
+        return DecisionTree(functions)
+    if engine == ENGINE_TRIE:
+        return ParameterTrie(functions)
+    return BitsetTable(functions)
+
+
+cdef list bind_candidates(
+    OverloadedFunction ovl, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint* cacheable
+):
+    """Return the overloads from `ovl` that bind the arguments of a vectorcall, trying each of them in turn.
+    This is the reference for other engines. `cacheable` is set to False if the result depends on more than the
+    types of the arguments.
+    """
+    cdef list candidates = []
+    cdef Signature sig
+    cdef Py_ssize_t position = -1
+
+    for func in arity_bucket(ovl, nargs):
+        sig = signature_cache[func]
+        if not acceptsShape(sig, nargs, kwnames):
+            continue
+        if not sig.type_based:
+            cacheable[0] = False
+        if bind_with(sig, args, nargs, kwnames, &position) == BIND_OK:
+            candidates.append(func)
+            if ovl.overloads_disjoint:
+                # No other overload can match
+                break
+    
+    return candidates
+
+
+cdef list best_candidates(list candidates, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint types=False):
+    """Return the candidates that bind the arguments of a vectorcall, and that no other candidate is more specific
+    than. Like with overloads in C++, a candidate is more specific than another if its parameters are at least as
+    specific for every argument, and more specific for at least one, see bind_distances. If `types` is True, `args`
+    are types of arguments instead.
+    """
+    cdef Py_ssize_t count = len(candidates)
+    cdef vector[vector[Py_ssize_t]] distances
+    cdef list result = []
+    cdef Py_ssize_t i
+    cdef Py_ssize_t j
+
+    distances.resize(count)
+    for i in range(count):
+        bind_distances(signature_cache[candidates[i]], args, nargs, kwnames, distances[i], types)
+    
+    for i in range(count):
+        for j in range(count):
+            if j != i and more_specific(distances[j], distances[i]):
+                break
+        else:
+            result.append(candidates[i])
+    
+    return result
+
+
+cdef bint more_specific(const vector[Py_ssize_t]& lhs, const vector[Py_ssize_t]& rhs):
+    """Return True if distances `lhs` are all at most `rhs`, and at least one is less."""
+    cdef bint less = False
+    cdef size_t i
+
+    for i in range(lhs.size()):
+        if lhs[i] > rhs[i]:
+            return False
+        if lhs[i] < rhs[i]:
+            less = True
+    return less
+
+
+cdef list bind_failures(list functions, PyObject** args, Py_ssize_t nargs, tuple kwnames, bint types):
+    """Return the status and position of binding the arguments of a vectorcall to each of `functions`, or arguments
+    of these types if `types` is True, see bind_with. This is done when the call fails, so that failures are reported
+    for the arguments as they were, and only turned into messages if they are read, see explain_failures.
+    """
+    cdef Signature sig
+    cdef Py_ssize_t position
+    cdef int status
+    cdef list failures = []
+
+    for func in functions:
+        sig = signature_cache[func]
+        position = -1
+        if types:
+            status = bind_types(sig, args, nargs, kwnames, &position)
+        else:
+            status = bind_with(sig, args, nargs, kwnames, &position)
+        failures.append((status, position))
+    
+    return failures
+
+
+def explain_failures(list functions, list failures, tuple args, dict kwargs, bint types=False):
+    """Return a list of reasons (TypeErrors) why each of `functions` did not accept `args` and `kwargs`, or arguments
+    of these types if `types` is True, from the `failures` that bind_failures recorded for them.
+    """
+    cdef tuple values = args + tuple(kwargs.values())
+    cdef tuple kwnames = tuple(kwargs)
+    cdef PyObject** values_ptr = PySequence_Fast_ITEMS(values)
+    cdef Py_ssize_t nargs = len(args)
+    cdef list reasons = []
+
+    for func, (status, position) in zip(functions, failures):
+        sig = signature_cache[func]
+        reasons.append(bind_failure_reason(sig, status, position, values_ptr, nargs, kwnames, types))
+    
+    return reasons
+
+
+cdef object overloaded_function_vectorcall(
+    OverloadedFunction self, PyObject** args, size_t nargsf, PyObject* kwnames
+):
+    """Vectorcall entry point of overloaded functions.
+    Resolutions are looked up in the inline cache first, then in the dispatch cache, and only then computed.
+    Arguments are forwarded to the picked overload as they are, without packing them into a tuple and a dict.
+    """
+    cdef Py_ssize_t nargs = PyVectorcall_NARGS(nargsf)
+
+    if len(self.pending) != 0 or self.stale_typing:
+        compile_overloads(self)
+    if not self.guard.check():
+        clear_caches(self)
+    
+    if self.engine == ENGINE_ADAPTIVE:
+        self.window_calls += 1
+        if self.window_calls == ADAPT_WINDOW:
+            adapt(self)
+    
+    func = inline_lookup(self, args, nargs, kwnames)
+    if func is None:
+        func = perform_overload_resolution(self, args, nargs, <tuple> kwnames if kwnames is not NULL else ())
+    elif self.inline_cache[0].forward_count != 0:
+        return inline_forward(&self.inline_cache[0], func, args, nargsf, kwnames)
+
+    return PyObject_Vectorcall(func, args, nargsf, kwnames)
+
+
+_resolutions = {
+    "unique": RESOLVE_UNIQUE,
+    "best": RESOLVE_BEST,
+}
+
+
+_engines = {
+    "linear": ENGINE_LINEAR,
+    "tree": ENGINE_TREE,
+    "bitset": ENGINE_BITSET,
+    "trie": ENGINE_TRIE,
+    "adaptive": ENGINE_ADAPTIVE,
+}
+
+
+_container_check_modes = {
+    "shallow": CHECK_SHALLOW,
+    "first": CHECK_FIRST,
+    "sample": CHECK_SAMPLE,
+    "full": CHECK_FULL,
+}
+
+
+cdef bint configure(OverloadedFunction ovl, dict options) except -1:
+    """Apply decorator options to the overload set `ovl`.
+    Return True if signatures that were already compiled for the set must be compiled again.
+    """
+    cdef ContainerCheck check = ovl.container_check
+    cdef int resolution = ovl.resolution
+    cdef int engine = ovl.engine
+    cdef Py_ssize_t cache_size = ovl.dispatch_cache.capacity
+
+    for name, value in options.items():
+        if name == "container_check":
+            if value not in _container_check_modes:
+                raise ValueError(f"unknown container check {value!r}, expected one of {list(_container_check_modes)}")
+            check.mode = _container_check_modes[value]
+        elif name == "container_items":
+            if value < 0:
+                raise ValueError("container_items must not be negative")
+            check.items = value
+        elif name == "resolution":
+            if value not in _resolutions:
+                raise ValueError(f"unknown resolution {value!r}, expected one of {list(_resolutions)}")
+            resolution = _resolutions[value]
+        elif name == "cache_size":
+            if value < 0:
+                raise ValueError("cache_size must not be negative")
+            cache_size = value
+        elif name == "engine":
+            if value not in _engines:
+                raise ValueError(f"unknown engine {value!r}, expected one of {list(_engines)}")
+            engine = _engines[value]
+        else:
+            raise TypeError(f"unknown overload option {name!r}")
+    
+    if resolution != ovl.resolution:
+        ovl.resolution = resolution
+        clear_caches(ovl)
+    if engine != ovl.engine:
+        ovl.engine = engine
+        ovl.current_engine = engine if engine != ENGINE_ADAPTIVE else ENGINE_LINEAR
+        ovl.dispatcher = None
+    if cache_size != ovl.dispatch_cache.capacity:
+        ovl.dispatch_cache.resize(cache_size)
+        if cache_size == 0:
+            clear_caches(ovl)
+    if check.mode == ovl.container_check.mode and check.items == ovl.container_check.items:
+        return False
+    
+    ovl.container_check = check
+    return True
 
-    func = candidates[0]
-    return func(*args, **kwargs)
+
+cdef int compile_overloads(OverloadedFunction ovl) except -1:
+    """Compile the signatures of overloads that were registered to `ovl` since it was last compiled, compare them
+    with the other overloads, and update the caches and tables of `ovl` for them, see add_overloads. Nothing is done
+    if the set is compiled already.
+    """
+    cdef Py_ssize_t compiled = len(ovl.functions) - len(ovl.pending)
+    cdef list added = []
+    cdef Signature sig
+
+    if len(ovl.pending) == 0 and not ovl.stale_typing:
+        return 0
+    
+    if ovl.stale_typing:
+        for other in ovl.functions[:compiled]:
+            if (<Signature> signature_cache[other]).typing:
+                signature_cache[other] = sig = createSignature(other, True, ovl.container_check)
+                add_guards(ovl, sig)
+        ovl.stale_typing = False
+        # Matchers of compiled overloads changed, so any resolution may change
+        clear_caches(ovl)
+    
+    try:
+        for func, typing in ovl.pending:
+            sig = createSignature(func, typing, ovl.container_check)
+            signature_cache[func] = sig
+
+            # Calls stop at the first matching overload if no call can match two of them
+            if ovl.overloads_disjoint:
+                for other in ovl.functions[:compiled + len(added)]:
+                    if not signaturesDisjoint(sig, signature_cache[other]):
+                        ovl.overloads_disjoint = False
+                        break
+            
+            add_guards(ovl, sig)
+            added.append(func)
+    finally:
+        del ovl.pending[:len(added)]
+        if len(added) != 0:
+            add_overloads(ovl, added)
+    
+    return 0
+
+
+cdef int add_overloads(OverloadedFunction ovl, list functions) except -1:
+    """Update the caches and tables of `ovl` for compiled overloads `functions`, which were added after the others.
+    New overloads can only change the resolution of calls that they bind, so cached resolutions are only dropped for
+    shapes of calls that one of `functions` binds. Arity buckets and the dispatch engine are extended in place.
+    Specializations of `ovl` notice the change through its generation.
+    """
+    cdef list signatures = [signature_cache[func] for func in functions]
+    cdef dict shapes = {}
+    cdef list keys = []
+    cdef InlineEntry* entry
+    cdef Py_ssize_t kept = 0
+    cdef Signature sig
+    cdef Py_ssize_t e
+
+    for key in ovl.dispatch_cache.keys:
+        shape = (<tuple> key)[:2]
+        binds = shapes.get(shape)
+        if binds is None:
+            binds = shapes[shape] = binds_shape(signatures, (<tuple> key)[0], (<tuple> key)[1])
+        if binds:
+            keys.append(key)
+    ovl.dispatch_cache.discard(keys)
+
+    for e in range(INLINE_ENTRIES):
+        entry = &ovl.inline_cache[e]
+        if entry.func is NULL:
+            break
+        kwnames = <tuple> entry.kwnames if entry.kwnames is not NULL else ()
+        if binds_shape(signatures, entry.nargs, kwnames):
+            Py_XDECREF(entry.func)
+            Py_XDECREF(entry.kwnames)
+        else:
+            ovl.inline_cache[kept] = entry[0]
+            kept += 1
+    for e in range(kept, INLINE_ENTRIES):
+        if ovl.inline_cache[e].func is NULL:
+            break
+        ovl.inline_cache[e].func = NULL
+        ovl.inline_cache[e].kwnames = NULL
+
+    for nargs, bucket in ovl.arity_buckets.items():
+        for func, sig in zip(functions, signatures):
+            if sig.min_positional <= nargs <= sig.max_positional:
+                (<list> bucket).append(func)
+    
+    if ovl.dispatcher is not None and not ovl.dispatcher.extend(functions):
+        ovl.dispatcher = None
+    ovl.generation += 1
+    return 0
 
 
-cdef make_overloaded(func):
+cdef bint binds_shape(list signatures, Py_ssize_t nargs, tuple kwnames) except -1:
+    """Return True if a call with `nargs` positional arguments and keywords `kwnames` binds to one of `signatures`,
+    for some arguments.
+    """
+    cdef vector[Py_ssize_t] slots
+    cdef Signature sig
+    cdef Py_ssize_t position = -1
+
+    slots.resize(nargs + len(kwnames))
+    for sig in signatures:
+        if acceptsShape(sig, nargs, kwnames) and bind_slots(sig, nargs, kwnames, slots.data(), &position) == BIND_OK:
+            return True
+    return False
+
+
+cdef int freeze_overloads(OverloadedFunction ovl) except -1:
+    """Compile the overload set `ovl` for the last time and seal it, see OverloadedFunction.freeze."""
+    if ovl.frozen:
+        return 0
+    
+    compile_overloads(ovl)
+    if ovl.engine == ENGINE_ADAPTIVE:
+        ovl.engine = ovl.current_engine = fitting_engine(ovl)
+    if dispatch_engine(ovl) != ENGINE_LINEAR and ovl.dispatcher is None:
+        ovl.dispatcher = create_engine(ovl.current_engine, list(ovl.functions))
+    
+    ovl.functions = tuple(ovl.functions)
+    ovl.frozen = True
+    return 0
+
+
+cdef void add_guards(OverloadedFunction ovl, Signature sig) except *:
+    """Make the TypeGuard of `ovl` watch the metaclasses that matchers of `sig` depend on."""
+    for param in sig.parameters:
+        for metaclass in <tuple> param.matcher.guards:
+            ovl.guard.add(<PyTypeObject*> metaclass)
+
+
+cdef make_overloaded(func, bint typing, dict options):
     """Make a function `func` overloaded.
     
     Add this to all functions with the same name in one scope. When calling a function with 
     this name, an appropriate overload will be picked based on the arguments you provide.
-    Argument checking is performed by calling `bind_func(argument, annotation)`. If this call returns true, this
-    argument is considered matching.
-    """
-    cdef str __module__ = func.__module__
-    cdef str __qualname__ = func.__qualname__
-    cdef list functions = []
-
-    if (func.__module__, func.__qualname__) not in _registry:
-        def overloaded_function(*args, **kwargs):
-            return perform_overload_resolution(
-                args, kwargs, 
-                functions, 
-                __module__, __qualname__
-            )
-        
-        overloaded_function.__module__ = __module__
-        overloaded_function.__qualname__ = __qualname__
-        overloaded_function.functions = functions
-
-        _registry[func.__module__, func.__qualname__] = overloaded_function
+    Argument checking is performed by matchers compiled into the signature of `func`, see createMatcher. If `typing`
+    is True, annotations from the typing module are supported. `options` configure the whole overload set.
+    Registration only records `func`, its signature is compiled on the first call, see compile_overloads.
+    Overloads are compared with each other when compiled. If no call can bind to more than one of them, calls stop
+    at the first matching overload. If several overloads match, the call is ambiguous, unless the set picks the
+    most specific of them with the "best" resolution option. Successful resolutions are cached per overload set by
+    the shape of the call and the exact types of the arguments, so repeated calls with the same argument types skip
+    binding and ranking altogether. Cached resolutions are invalidated by modifications of argument types and of
+    metaclasses of annotations, and by registrations with ABCs. The cache is bounded, and does not keep argument
+    types alive.
+    """
+    cdef OverloadedFunction overloaded_function
+    cdef bint freeze = options.pop("freeze", False)
+    key = (func.__module__, func.__qualname__)
+
+    if key not in _registry:
+        overloaded_function = OverloadedFunction(func.__module__, func.__qualname__)
+        overloaded_function.__doc__ = func.__doc__
     else:
-        overloaded_function = _registry[func.__module__, func.__qualname__]
+        overloaded_function = _registry[key]
+
+    if overloaded_function.frozen:
+        raise RuntimeError(f"can not register overloads to frozen overloaded function {key[0]}.{key[1]}")
+    if configure(overloaded_function, options):
+        overloaded_function.stale_typing = True
 
+    _registry[key] = overloaded_function
     overloaded_function.functions.append(func)
+    overloaded_function.pending.append((func, typing))
 
+    if freeze:
+        freeze_overloads(overloaded_function)
     return overloaded_function
 
 
-def overload(func):
+def overload(func=None, **options):
     """Decorator that makes a function with this name overloaded.
 
     To create an overload set, create several functions with the same name in one scope and mark them with this
     decorator. This decorator supports annotations from the `typing` module.
+    The decorator can be called with options, which apply to the whole overload set:
+    - `resolution`: what happens when several overloads match the arguments. With "unique" (the default), the call
+      raises AmbiguousOverloadError. With "best", the overload that is the most specific for the arguments is
+      picked: for every argument, a class is more specific than its bases, and any class is more specific than
+      `Any` or a missing annotation. The call is only ambiguous if no overload is at least as specific as all others
+      for every argument.
+    - `engine`: how overloads are matched to arguments when a call is not cached. "adaptive" (the default) starts
+      with "linear", and switches between engines as it counts calls, cache hits and overloads. "linear" binds each
+      overload in turn. "tree" resolves calls without keyword arguments with a decision tree over the types of
+      positional arguments, which is built as calls come in, and costs one lookup per argument once built. It
+      requires annotations that only depend on the type of the argument, like classes and unions of classes, and
+      falls back to "linear" otherwise. "bitset" has the same requirements, and resolves all calls by intersecting
+      precomputed bitsets of overloads that accept each argument, which suits sets with many overloads. "trie"
+      works with any annotations, and binds all overloads in one pass over positional arguments, checking leading
+      parameters that overloads have in common (like `self`) once.
+    - `cache_size`: the maximum number of resolutions that are cached for the set, 1024 by default. When the cache
+      is full, rarely used resolutions are evicted. Tables of the "tree" and "bitset" engines are bounded by the same
+      number of entries. 0 disables caching, including the small inline cache, and makes "tree" and "bitset" fall
+      back to "linear".
+    - `container_check`: how elements of parameterized containers like `List[int]` or `Dict[str, float]` are
+      checked. "shallow" (the default) only checks the type of the container, "first" checks the first
+      `container_items` elements, "sample" checks `container_items` elements at evenly spaced positions, and "full"
+      checks all elements. Elements are only checked in lists, tuples, sets, frozensets and dicts.
+    - `container_items`: the number of elements for "first" and "sample" checks, 8 by default.
+    - `freeze`: if True, the set is frozen after this overload is added, see OverloadedFunction.freeze.
     """
-    # Cache function signature (this will be used during overload resolution)
-    signature_cache[func] = createSignature(signature(func))
+    if func is None:
+        return partial(overload, **options)
 
-    return None
-    #return make_overloaded(func, bind_annotated)
+    return make_overloaded(func, True, options)
 
 
-def overload_strict(func):
+def overload_strict(func=None, **options):
     """Decorator that makes a function with this name overloaded.
     
     To create an overload set, create several functions with the same name in one scope and mark them with this
     decorator. This decorator uses `isinstance` to match arguments to annotations, and does not support the `typing`
-    module.
+    module. It accepts the same options as `overload`.
     """
-    # Cache function signature (this will be used during overload resolution)
-    signature_cache[func] = createSignature(signature(func))
+    if func is None:
+        return partial(overload_strict, **options)
 
-    return make_overloaded(func)
\ No newline at end of file
+    return make_overloaded(func, False, options)
@@ -7,6 +7,7 @@
 from cpython cimport PyObject
 from libcpp cimport bool
 from libcpp.vector cimport vector
+from .bind cimport ContainerCheck, Matcher
 
 
 cdef struct Parameter:
@@ -14,14 +15,48 @@ cdef struct Parameter:
 	PyObject* annotation
 	PyObject* name
 	bool has_default
+	Matcher matcher
 
 
 cdef class Signature:
 	cdef vector[Parameter] parameters
 
+	# Shape of calls that can bind to this signature, computed once in createSignature
+	cdef Py_ssize_t min_positional  # Required positional-only parameters
+	cdef Py_ssize_t max_positional  # Parameters that accept positional arguments (unbounded with *args)
+	cdef Py_ssize_t min_arguments  # Required parameters
+	cdef Py_ssize_t max_arguments  # Named parameters (unbounded with *args or **kwargs)
+	cdef Py_ssize_t max_keywords  # Parameters that accept keyword arguments (unbounded with **kwargs)
+	cdef tuple required_keywords  # Names of required keyword-only parameters
 
-cdef Parameter createParameter(object py_param)
+	# Binding tables, computed once in createSignature
+	cdef Py_ssize_t positional_count  # Named parameters that accept positional arguments
+	cdef dict keyword_slots  # Parameter name -> index, for named parameters
+	cdef vector[Py_ssize_t] required_from  # Number of required named parameters starting from each index
+	cdef bool type_based  # Binding only depends on types of arguments, see Matcher.type_based
+	cdef bool typing  # Annotations were compiled with support for the typing module
+	cdef bool positional_form  # Parameters were read from the code of the function, which accepts them by position
+
+	# Slots of the keywords of the last keyword call, see cacheKeywordSlots
+	cdef tuple call_kwnames
+	cdef vector[Py_ssize_t] call_slots
+
+
+cdef Parameter createParameter(str name, int kind, object annotation, bint has_default, bint typing, ContainerCheck check)
 cdef void destroyParameter(Parameter param)
 
-cdef Signature createSignature(object py_sig)
-cdef void destroySignature(Signature sig)
\ No newline at end of file
+cdef Signature createSignature(object func, bint typing, ContainerCheck check)
+cdef Py_ssize_t findSlot(Signature sig, PyObject* name)
+cdef int cacheKeywordSlots(Signature sig, tuple kwnames) except -1
+cdef bool acceptsShape(Signature sig, Py_ssize_t nargs, tuple kwnames)
+cdef bint signaturesDisjoint(Signature lhs, Signature rhs) except -1
+cdef void destroySignature(Signature sig)
+
+
+cdef inline Py_ssize_t keywordSlot(Signature sig, tuple kwnames, Py_ssize_t i):
+	"""Return the index of the parameter named `kwnames[i]`, like findSlot does, from the slots cached for `kwnames`
+	by cacheKeywordSlots if possible.
+	"""
+	if kwnames is sig.call_kwnames:
+		return sig.call_slots[i]
+	return findSlot(sig, <PyObject*> kwnames[i])
@@ -4,25 +4,51 @@
 #cython: boundscheck=False
 #cython: wraparound=False
 #cython: language_level = 3
-from inspect import _empty
+from inspect import _POSITIONAL_ONLY, _POSITIONAL_OR_KEYWORD, _VAR_POSITIONAL, _KEYWORD_ONLY, _VAR_KEYWORD, _empty
+from inspect import signature
+from sys import intern
+from types import FunctionType
 from cpython cimport PyObject, Py_INCREF, Py_DECREF
 from libcpp.vector cimport vector
+from .bind cimport ContainerCheck, createMatcher, destroyMatcher, matchersDisjoint
 
+cdef extern from "Python.h":
+	Py_ssize_t PY_SSIZE_T_MAX
+	int CO_VARARGS
+	int CO_VARKEYWORDS
+
+cdef int _c_positional_only = _POSITIONAL_ONLY
+cdef int _c_positional_or_keyword = _POSITIONAL_OR_KEYWORD
+cdef int _c_var_positional = _VAR_POSITIONAL
+cdef int _c_keyword_only = _KEYWORD_ONLY
+cdef int _c_var_keyword = _VAR_KEYWORD
 
 signature_cache = {}
 
 
-cdef Parameter createParameter(object py_param):
-	"""Create a Parameter object from a python parameter from the inspect module"""
+cdef class Signature:
+	def __dealloc__(self):
+		destroySignature(self)
+
+
+cdef Parameter createParameter(str name, int kind, object annotation, bint has_default, bint typing, ContainerCheck check):
+	"""Create a Parameter object for a parameter `name` of kind `kind` from the inspect module. `annotation` is
+	`inspect.Parameter.empty` for parameters without annotation.
+	If `typing` is True, annotations from the typing module are supported, and elements of containers are checked
+	according to `check`, see createMatcher.
+	"""
 	cdef Parameter param
+	# Names are interned so that keywords from call sites can be matched to parameters by pointer
+	name = intern(name)
 
-	param.name = <PyObject*> py_param.name
-	param.kind = py_param.kind
-	param.annotation = <PyObject*> py_param.annotation
-	param.has_default = py_param.default is not _empty
+	param.name = <PyObject*> name
+	param.kind = kind
+	param.annotation = <PyObject*> annotation
+	param.has_default = has_default
+	param.matcher = createMatcher(annotation, typing, check)
 
-	Py_INCREF(py_param.name)
-	Py_INCREF(py_param.annotation)
+	Py_INCREF(name)
+	Py_INCREF(annotation)
 
 	return param
 
@@ -31,18 +57,271 @@ cdef void destroyParameter(Parameter param):
 	"""Destroy a Parameter object."""
 	Py_DECREF(<object> param.name)
 	Py_DECREF(<object> param.annotation)
+	destroyMatcher(param.matcher)
 
 
-cdef Signature createSignature(object py_sig):
+cdef Signature createSignature(object func, bint typing, ContainerCheck check):
+	"""Create the Signature of a callable `func`, see createParameter.
+	Parameters of plain functions are read from their code object, other callables go through `inspect.signature`.
+	"""
 	cdef Signature sig = Signature()
-	sig.parameters.reserve(len(py_sig.parameters))
 
-	for py_param in py_sig.parameters.values():
-		sig.parameters.push_back(createParameter(py_param))
+	# Attributes like '__wrapped__' or '__signature__' make inspect report other parameters than those of the code
+	if type(func) is FunctionType and not func.__dict__:
+		addCodeParameters(sig, func, typing, check)
+		sig.positional_form = True
+	else:
+		for py_param in signature(func).parameters.values():
+			sig.parameters.push_back(createParameter(
+				py_param.name, py_param.kind, py_param.annotation, py_param.default is not _empty, typing, check
+			))
 	
+	computeShape(sig)
+	computeSlots(sig)
+
+	sig.typing = typing
+
+	sig.type_based = True
+	for param in sig.parameters:
+		sig.type_based = sig.type_based and param.matcher.type_based
+
 	return sig
 
 
+cdef void addCodeParameters(Signature sig, object func, bint typing, ContainerCheck check) except *:
+	"""Add parameters of a plain function `func` to `sig` in the order of `inspect.signature`, reading them from the
+	code object, defaults and annotations of `func`.
+	"""
+	cdef object code = func.__code__
+	cdef Py_ssize_t positional = code.co_argcount
+	cdef Py_ssize_t positional_only = code.co_posonlyargcount
+	cdef Py_ssize_t keyword_only = code.co_kwonlyargcount
+	cdef Py_ssize_t first_default
+	cdef int flags = code.co_flags
+	cdef tuple names = code.co_varnames
+	cdef tuple defaults = func.__defaults__ or ()
+	cdef dict kwdefaults = func.__kwdefaults__ or {}
+	cdef dict annotations = func.__annotations__
+	cdef Py_ssize_t variadic = positional + keyword_only
+	cdef Py_ssize_t i
+
+	sig.parameters.reserve(variadic + 2)
+	first_default = positional - len(defaults)
+
+	for i in range(positional):
+		name = names[i]
+		sig.parameters.push_back(createParameter(
+			name, _c_positional_only if i < positional_only else _c_positional_or_keyword,
+			annotations.get(name, _empty), i >= first_default, typing, check
+		))
+	
+	# Names of '*args' and '**kwargs' follow names of keyword-only parameters
+	if flags & CO_VARARGS:
+		name = names[variadic]
+		sig.parameters.push_back(createParameter(
+			name, _c_var_positional, annotations.get(name, _empty), False, typing, check
+		))
+		variadic += 1
+	
+	for i in range(positional, positional + keyword_only):
+		name = names[i]
+		sig.parameters.push_back(createParameter(
+			name, _c_keyword_only, annotations.get(name, _empty), name in kwdefaults, typing, check
+		))
+	
+	if flags & CO_VARKEYWORDS:
+		name = names[variadic]
+		sig.parameters.push_back(createParameter(
+			name, _c_var_keyword, annotations.get(name, _empty), False, typing, check
+		))
+
+
+cdef void computeShape(Signature sig):
+	"""Compute the bounds on the number of arguments that can bind to a signature."""
+	cdef Parameter param
+	cdef list required_keywords = []
+
+	sig.min_positional = 0
+	sig.max_positional = 0
+	sig.min_arguments = 0
+	sig.max_arguments = 0
+	sig.max_keywords = 0
+
+	for param in sig.parameters:
+		if param.kind == _c_var_positional:
+			sig.max_positional = PY_SSIZE_T_MAX
+			sig.max_arguments = PY_SSIZE_T_MAX
+			continue
+		if param.kind == _c_var_keyword:
+			sig.max_keywords = PY_SSIZE_T_MAX
+			sig.max_arguments = PY_SSIZE_T_MAX
+			continue
+		
+		if sig.max_arguments != PY_SSIZE_T_MAX:
+			sig.max_arguments += 1
+		if param.kind != _c_keyword_only and sig.max_positional != PY_SSIZE_T_MAX:
+			sig.max_positional += 1
+		if param.kind != _c_positional_only and sig.max_keywords != PY_SSIZE_T_MAX:
+			sig.max_keywords += 1
+		
+		if not param.has_default:
+			sig.min_arguments += 1
+			if param.kind == _c_positional_only:
+				sig.min_positional += 1
+			elif param.kind == _c_keyword_only:
+				required_keywords.append(<object> param.name)
+	
+	sig.required_keywords = tuple(required_keywords)
+
+
+cdef void computeSlots(Signature sig):
+	"""Compute the tables that are used to bind arguments to parameters without looking at parameter kinds."""
+	cdef Parameter param
+	cdef Py_ssize_t i
+	cdef Py_ssize_t required = 0
+
+	sig.positional_count = 0
+	sig.keyword_slots = {}
+	sig.required_from.assign(sig.parameters.size() + 1, 0)
+
+	for i in reversed(range(sig.parameters.size())):
+		param = sig.parameters[i]
+		if param.kind != _c_var_positional and param.kind != _c_var_keyword and not param.has_default:
+			required += 1
+		sig.required_from[i] = required
+
+	for i in range(<Py_ssize_t> sig.parameters.size()):
+		param = sig.parameters[i]
+		if param.kind == _c_var_positional or param.kind == _c_var_keyword:
+			continue
+		if param.kind != _c_keyword_only:
+			sig.positional_count += 1
+		sig.keyword_slots[<object> param.name] = i
+
+
+cdef Py_ssize_t findSlot(Signature sig, PyObject* name):
+	"""Return the index of the parameter named `name`, or -1 if it does not exist or is a variadic parameter.
+	Names are compared by pointer first, which succeeds for interned keywords passed by most call sites.
+	"""
+	cdef Py_ssize_t i
+	cdef Parameter param
+
+	for i in range(<Py_ssize_t> sig.parameters.size()):
+		param = sig.parameters[i]
+		if param.name == name:
+			if param.kind == _c_var_positional or param.kind == _c_var_keyword:
+				return -1
+			return i
+	
+	slot = sig.keyword_slots.get(<object> name)
+	if slot is None:
+		return -1
+	return slot
+
+
+cdef int cacheKeywordSlots(Signature sig, tuple kwnames) except -1:
+	"""Cache the slot of each keyword of `kwnames` in `sig`, to be read with keywordSlot.
+	Call sites pass the same constant tuple of keywords on every call, so the tuple is remembered by identity, and
+	repeated keyword calls skip the lookup of names.
+	"""
+	cdef Py_ssize_t i
+
+	if kwnames is sig.call_kwnames or len(kwnames) == 0:
+		return 0
+	
+	# Lookups of names can't run Python code, so nothing sees the slots before they are complete
+	sig.call_slots.resize(len(kwnames))
+	for i in range(len(kwnames)):
+		sig.call_slots[i] = findSlot(sig, <PyObject*> kwnames[i])
+	sig.call_kwnames = kwnames
+	return 0
+
+
+cdef bool acceptsShape(Signature sig, Py_ssize_t nargs, tuple kwnames):
+	"""Return False if a call with `nargs` positional arguments and keywords `kwnames` can never bind to `sig`.
+	This is a quick check on the number of arguments only, a True result still requires a full bind.
+	"""
+	cdef Py_ssize_t nkwargs = len(kwnames)
+
+	if nargs < sig.min_positional or nargs > sig.max_positional:
+		return False
+	if nkwargs > sig.max_keywords or nargs + nkwargs < sig.min_arguments:
+		return False
+	if sig.max_arguments != PY_SSIZE_T_MAX and nargs + nkwargs > sig.max_arguments:
+		return False
+	
+	for name in sig.required_keywords:
+		if name not in kwnames:
+			return False
+	
+	return True
+
+
+cdef bint signaturesDisjoint(Signature lhs, Signature rhs) except -1:
+	"""Return True if no call can bind to both `lhs` and `rhs`.
+	Signatures are disjoint if their shapes exclude each other, or if some argument of every call reaches a required
+	parameter in both signatures, and no argument can match both of these parameters. This is a conservative check:
+	False means that a call may bind to both.
+	"""
+	cdef Parameter* param
+	cdef Parameter* other
+	cdef Py_ssize_t i
+
+	if shapesDisjoint(lhs, rhs) or shapesDisjoint(rhs, lhs):
+		return True
+	
+	# A positional argument at index i reaches parameter i in both signatures. A required positional-only
+	# parameter forces it to be passed positionally, and otherwise both parameters must bind the same keyword
+	for i in range(<Py_ssize_t> min(lhs.parameters.size(), rhs.parameters.size())):
+		param = &lhs.parameters[i]
+		other = &rhs.parameters[i]
+		if not isPositional(param) or not isPositional(other) or param.has_default or other.has_default:
+			break
+		if param.kind != _c_positional_only and other.kind != _c_positional_only and param.name != other.name:
+			continue
+		if matchersDisjoint(&param.matcher, &other.matcher):
+			return True
+	
+	# Required keyword-only parameters with the same name always bind the same keyword
+	for i in range(<Py_ssize_t> lhs.parameters.size()):
+		param = &lhs.parameters[i]
+		if param.kind != _c_keyword_only or param.has_default:
+			continue
+		slot = rhs.keyword_slots.get(<object> param.name)
+		if slot is None:
+			continue
+		other = &rhs.parameters[<Py_ssize_t> slot]
+		if other.kind == _c_keyword_only and not other.has_default and matchersDisjoint(&param.matcher, &other.matcher):
+			return True
+	
+	return False
+
+
+cdef bint shapesDisjoint(Signature lhs, Signature rhs):
+	"""Return True if no call that binds to `lhs` has a shape that `rhs` accepts, see acceptsShape."""
+	cdef Parameter* other
+
+	if lhs.min_arguments > rhs.max_arguments or lhs.min_positional > rhs.max_positional:
+		return True
+	if rhs.max_keywords == PY_SSIZE_T_MAX:
+		return False
+	
+	for name in lhs.required_keywords:
+		slot = rhs.keyword_slots.get(name)
+		if slot is None:
+			return True
+		other = &rhs.parameters[<Py_ssize_t> slot]
+		if other.kind == _c_positional_only:
+			return True
+	
+	return False
+
+
+cdef inline bint isPositional(const Parameter* param):
+	"""Return True if `param` is a named parameter that accepts positional arguments."""
+	return param.kind == _c_positional_only or param.kind == _c_positional_or_keyword
+
+
 cdef void destroySignature(Signature sig):
 	cdef Parameter param
 	for param in sig.parameters:
@@ -0,0 +1,24 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject
+from .engine cimport Engine
+
+
+cdef class DecisionNode:
+	cdef list candidates
+	cdef tuple indices
+	cdef tuple positions
+	cdef Py_ssize_t position
+	cdef dict children
+
+
+cdef class DecisionTree(Engine):
+	cdef dict roots
+	cdef dict nodes
+
+	cdef DecisionNode node(self, tuple indices, tuple positions)
+	cdef DecisionNode split(self, DecisionNode node, PyObject* arg)
@@ -0,0 +1,127 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject, PyTypeObject, Py_TYPE
+from .bind cimport MATCH_ANY, runMatcher
+from .guard cimport type_version
+from .signature cimport Signature, acceptsShape
+
+
+cdef class DecisionNode:
+	"""A node of a DecisionTree.
+	`candidates` are the overloads that accept all arguments tested on the way to this node, `indices` are their
+	indices in the tree. Inner nodes test the type of the argument at `position`, and lead to `children` by the version
+	tag of that type. Leaves have a position of -1, and all of their candidates bind the call.
+	"""
+	pass
+
+
+cdef class DecisionTree(Engine):
+	"""Resolves calls without keyword arguments by the types of positional arguments, testing one argument position
+	at a time for all remaining overloads at once.
+	There is one root per number of positional arguments. Every node tests the position where the remaining overloads
+	have the most distinct annotations, and moves to the child for the type of the argument. Children are created on
+	first use and shared between nodes that have the same candidates left, so the tree is a DAG that only contains the
+	paths that calls took. After it is built, a call costs one lookup per tested position, regardless of the number of
+	overloads.
+	"""
+	def __cinit__(self, list functions):
+		self.roots = {}
+		self.nodes = {}
+
+	cdef bint extend(self, list functions) except -1:
+		"""Drop the roots for numbers of positional arguments that overloads `functions` accept. Nodes are kept, they
+		only depend on the overloads they were created for, and new roots reuse them where candidates are the same.
+		"""
+		cdef Py_ssize_t first = len(self.signatures)
+		cdef Signature sig
+
+		Engine.extend(self, functions)
+		for sig in self.signatures[first:]:
+			for nargs in list(self.roots):
+				if acceptsShape(sig, nargs, ()):
+					del self.roots[nargs]
+		return True
+
+	cdef list candidates(self, PyObject** args, Py_ssize_t nargs, tuple kwnames):
+		"""Return the overloads that bind a vectorcall with `nargs` positional arguments, or None if there are keyword
+		arguments or some argument type has no version tag.
+		"""
+		cdef DecisionNode node = self.roots.get(nargs)
+		cdef DecisionNode child
+		cdef unsigned int version
+		cdef Signature sig
+
+		if len(kwnames) != 0:
+			return None
+		
+		if node is None:
+			indices = []
+			for i in range(len(self.signatures)):
+				sig = self.signatures[i]
+				if acceptsShape(sig, nargs, ()):
+					indices.append(i)
+			node = self.node(tuple(indices), tuple(range(nargs)))
+			self.roots[nargs] = node
+		
+		while node.position != -1:
+			version = type_version(Py_TYPE(<object> args[node.position]))
+			if version == 0:
+				return None
+			child = node.children.get(version)
+			if child is None:
+				child = self.split(node, args[node.position])
+				node.children[version] = child
+				self.entries += 1
+			node = child
+		
+		return node.candidates
+
+	cdef DecisionNode node(self, tuple indices, tuple positions):
+		"""Return the node for overloads at `indices` in the tree, when arguments at `positions` are not tested yet.
+		The position to test is the one where the overloads have the most distinct annotations that are not `Any`.
+		"""
+		cdef DecisionNode node = self.nodes.get((indices, positions))
+		cdef Signature sig
+		cdef Py_ssize_t best_count = 0
+		cdef Py_ssize_t position
+		cdef Py_ssize_t i
+
+		if node is not None:
+			return node
+		
+		node = DecisionNode()
+		node.candidates = [self.functions[i] for i in indices]
+		node.indices = indices
+		node.position = -1
+		node.children = {}
+
+		for position in positions:
+			annotations = set()
+			for i in indices:
+				sig = self.signatures[i]
+				# Arguments after named parameters go to '*args' unchecked
+				if position < sig.positional_count and sig.parameters[position].matcher.kind != MATCH_ANY:
+					annotations.add(<object> sig.parameters[position].matcher.annotation)
+			if len(annotations) > best_count:
+				best_count = len(annotations)
+				node.position = position
+		
+		node.positions = tuple([position for position in positions if position != node.position])
+		self.nodes[(indices, positions)] = node
+		return node
+
+	cdef DecisionNode split(self, DecisionNode node, PyObject* arg):
+		"""Return the child of `node` for arguments of the same type as `arg`."""
+		cdef Signature sig
+		cdef list indices = []
+
+		for i in node.indices:
+			sig = self.signatures[i]
+			if node.position >= sig.positional_count or runMatcher(&sig.parameters[node.position].matcher, arg):
+				indices.append(i)
+		
+		return self.node(tuple(indices), node.positions)
@@ -0,0 +1,22 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from libcpp.vector cimport vector
+from .bind cimport Matcher
+from .engine cimport Engine
+
+
+cdef class TrieNode:
+	cdef const Matcher* matcher
+	cdef dict children
+	cdef vector[Py_ssize_t] overloads
+	cdef vector[Py_ssize_t] ends
+
+
+cdef class ParameterTrie(Engine):
+	cdef TrieNode root
+
+	cdef void insert(self, Py_ssize_t k) except *
@@ -0,0 +1,119 @@
+#distutils: language = c++
+#cython: profile=True
+#cython: infer_types=True
+#cython: boundscheck=False
+#cython: wraparound=False
+#cython: language_level = 3
+from cpython cimport PyObject
+from libcpp.algorithm cimport sort
+from libcpp.vector cimport vector
+from .bind cimport runMatcher
+from .bind_with cimport BIND_OK, bind_keywords
+from .signature cimport Parameter, Signature, acceptsShape
+
+cdef extern from "Python.h":
+	Py_ssize_t PY_SSIZE_T_MAX
+
+
+cdef class TrieNode:
+	"""A node of a ParameterTrie, which stands for a parameter at the depth of the node.
+	`matcher` belongs to the parameter, `children` are the nodes for the next parameter by its key, see
+	ParameterTrie.__cinit__. `overloads` are the indices of all overloads that pass through the node, `ends` are those
+	that have no further parameters that accept positional arguments.
+	"""
+	def __cinit__(self):
+		self.matcher = NULL
+		self.children = {}
+
+
+cdef class ParameterTrie(Engine):
+	"""Binds all overloads at once, walking positional arguments of a call a single time.
+	Parameters that accept positional arguments form a trie, where overloads that start with the same parameters share
+	a path. Parameters are the same if they have the same name, kind, default presence and annotation object, and were
+	compiled the same way. Every positional argument is checked once per trie node at its depth, and a failed check
+	drops all overloads below the node. Keyword arguments are then bound to the remaining overloads one by one.
+	Matchers run on every call, so the trie works with any annotations.
+	"""
+	def __cinit__(self, list functions):
+		cdef Py_ssize_t k
+
+		self.root = TrieNode()
+		for k in range(len(self.signatures)):
+			self.insert(k)
+
+	cdef void insert(self, Py_ssize_t k) except *:
+		"""Add the path of the overload at index `k` to the trie."""
+		cdef Signature sig = self.signatures[k]
+		cdef TrieNode node = self.root
+		cdef TrieNode child
+		cdef Parameter* param
+		cdef Py_ssize_t i
+
+		node.overloads.push_back(k)
+		for i in range(sig.positional_count):
+			param = &sig.parameters[i]
+			key = (<object> param.name, param.kind, param.has_default, id(<object> param.annotation), sig.typing)
+			child = node.children.get(key)
+			if child is None:
+				child = TrieNode()
+				child.matcher = &param.matcher
+				node.children[key] = child
+			node = child
+			node.overloads.push_back(k)
+		
+		node.ends.push_back(k)
+
+	cdef bint extend(self, list functions) except -1:
+		"""Add the paths of overloads `functions` to the trie."""
+		cdef Py_ssize_t first = len(self.signatures)
+		cdef Py_ssize_t k
+
+		Engine.extend(self, functions)
+		for k in range(first, len(self.signatures)):
+			self.insert(k)
+		return True
+
+	cdef bint usable(self, bint type_based):
+		"""Return True, the trie runs matchers on every call."""
+		return True
+
+	cdef list candidates(self, PyObject** args, Py_ssize_t nargs, tuple kwnames):
+		"""Return the overloads that bind the arguments of a vectorcall."""
+		cdef vector[Py_ssize_t] survivors
+		cdef list frontier = [self.root]
+		cdef list following
+		cdef TrieNode node
+		cdef Signature sig
+		cdef Py_ssize_t position = -1
+		cdef Py_ssize_t depth
+		cdef Py_ssize_t k
+
+		for depth in range(nargs + 1):
+			following = []
+			for node in frontier:
+				if depth == nargs:
+					# The remaining parameters can only be bound by keywords
+					survivors.insert(survivors.end(), node.overloads.begin(), node.overloads.end())
+					continue
+
+				# Overloads that end here take the remaining positional arguments into '*args', if they have it
+				for k in node.ends:
+					if (<Signature> self.signatures[k]).max_positional == PY_SSIZE_T_MAX:
+						survivors.push_back(k)
+				
+				for child in node.children.values():
+					if runMatcher((<TrieNode> child).matcher, args[depth]):
+						following.append(child)
+			
+			frontier = following
+			if len(frontier) == 0:
+				break
+		
+		sort(survivors.begin(), survivors.end())
+
+		candidates = []
+		for k in survivors:
+			sig = self.signatures[k]
+			if acceptsShape(sig, nargs, kwnames) and bind_keywords(sig, args, nargs, kwnames, &position) == BIND_OK:
+				candidates.append(self.functions[k])
+		return candidates
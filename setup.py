@@ -7,11 +7,18 @@ setup(
     author="Andrey Zhukov",
     author_email="andres.zhukov@gmail.com",
     license="MIT",
+    python_requires=">=3.9",
     packages=["overload"],
     ext_modules=[
         Extension("overload.bind_with", ["overload/bind_with.cpp"]),
         Extension("overload.bind", ["overload/bind.cpp"]),
+        Extension("overload.bitset", ["overload/bitset.cpp"]),
+        Extension("overload.cache", ["overload/cache.cpp"]),
+        Extension("overload.engine", ["overload/engine.cpp"]),
+        Extension("overload.guard", ["overload/guard.cpp"]),
         Extension("overload.signature", ["overload/signature.cpp"]),
+        Extension("overload.tree", ["overload/tree.cpp"]),
+        Extension("overload.trie", ["overload/trie.cpp"]),
         Extension("overload.overload", ["overload/overload.cpp"]),
     ]
 )
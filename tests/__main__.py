@@ -1,6 +1,14 @@
 import unittest
+from functools import wraps
+from types import FunctionType
+from inspect import signature
 from unittest import TestCase
+from abc import ABC
+from collections.abc import Sequence
+from typing import Any, Dict, List, Literal, Optional, Sequence as SequenceOf, Tuple, Type, Union
 from overload import overload_strict, AmbiguousOverloadError, NoMatchingOverloadError
+from overload import overload as overload_typing
+from overload.signature import signature_cache
 
 overload = overload_strict
 
@@ -39,7 +47,70 @@ class TestBaseEncoder(TestCase):
             return 1
 
         self.assertRaises(NoMatchingOverloadError, foo, [])
+
+    def test_nomatching_reasons(self):
+        @overload
+        def foo(x: int):
+            return 0
+        
+        @overload
+        def foo(x, y):
+            return 1
+
+        with self.assertRaises(NoMatchingOverloadError) as context:
+            foo("apple", z=1)
+        
+        reasons = [str(reason) for reason in context.exception.fail_reasons]
+        self.assertEqual(reasons, [
+            "argument 'x' has unexpected type 'str'",
+            "got an unexpected keyword argument 'z'",
+        ])
+        self.assertIn("foo(x: int): argument 'x' has unexpected type 'str'", str(context.exception))
+
+    def test_nomatching_reasons_recorded(self):
+        class Toggle(type):
+            accepting = False
+
+            def __instancecheck__(cls, instance):
+                return Toggle.accepting
+
+        class Ripe(metaclass=Toggle):
+            pass
+
+        @overload
+        def foo(x: Ripe):
+            return 0
+
+        # Reasons are recorded when the call fails, not when they are read
+        with self.assertRaises(NoMatchingOverloadError) as context:
+            foo(1)
+        Toggle.accepting = True
+        self.assertEqual(str(context.exception.fail_reasons[0]), "argument 'x' has unexpected type 'int'")
     
+    def test_subclass(self):
+        class Base:
+            pass
+        
+        class Derived(Base):
+            pass
+
+        @overload
+        def foo(x: Base):
+            return 0
+        
+        @overload
+        def foo(x: Sequence):
+            return 1
+        
+        @overload
+        def foo(x: object, y):
+            return 2
+
+        self.assertEqual(foo(Derived()), 0)
+        self.assertEqual(foo([]), 1)
+        self.assertEqual(foo(None, 1), 2)
+        self.assertRaises(NoMatchingOverloadError, foo, 1)
+
     def test_positional(self):
         @overload
         def foo(x):
@@ -63,6 +134,979 @@ class TestBaseEncoder(TestCase):
 
         self.assertEqual(foo(x=1), 0)
         self.assertEqual(foo(y=1), 1)
+        self.assertEqual(foo(y=None), 1)
+
+    def test_keyword_slots(self):
+        class Reentrant(type):
+            def __instancecheck__(cls, obj):
+                # Binds the same signatures with other keywords while keywords of the outer call are bound
+                return foo(a="apple", c=1) == 1
+
+        class Checked(metaclass=Reentrant):
+            pass
+
+        @overload
+        def foo(a: int, b: Checked = None):
+            return 0
+
+        @overload
+        def foo(a: str, *, c: int):
+            return 1
+
+        for _ in range(3):
+            self.assertEqual(foo(a=1), 0)
+            self.assertEqual(foo(a=1, b=None), 0)
+            self.assertEqual(foo(b=None, a=1), 0)
+            self.assertEqual(foo(**{"a": 1}), 0)
+            self.assertEqual(foo(a="apple", c=1), 1)
+            self.assertRaises(NoMatchingOverloadError, foo, c=1, a=1)
+
+    def test_keyword_forwarding(self):
+        def logged(func):
+            @wraps(func)
+            def wrapper(*args, **kwargs):
+                return func.__name__, args, kwargs
+            return wrapper
+
+        @overload
+        def foo(x: int, y=0, z=1):
+            return x, y, z
+
+        @overload
+        @logged
+        def foo(x: str, y=0):
+            pass
+
+        @overload
+        def foo(x: float, /, y=0, **kwargs):
+            return x, y, kwargs
+
+        for _ in range(3):
+            self.assertEqual(foo(x=1, z=3), (1, 0, 3))
+            self.assertEqual(foo(z=3, y=2, x=1), (1, 2, 3))
+            self.assertEqual(foo(1, z=3), (1, 0, 3))
+            self.assertEqual(foo(x="a", y=1), ("foo", (), {"x": "a", "y": 1}))
+            self.assertEqual(foo(1.0, x=2), (1.0, 0, {"x": 2}))
+            self.assertEqual(foo(1.0, y=2), (1.0, 2, {}))
+
+        foo.functions[0].__defaults__ = (5, 6)
+        self.assertEqual(foo(x=1, z=3), (1, 5, 3))
+        foo.functions[0].__defaults__ = None
+        self.assertRaises(TypeError, foo, x=1, z=3)
+
+    def test_signature_sources(self):
+        def make(inspected):
+            def foo_a(x: int, /, y: str = "", *args: int, z: float, w=None, **kwargs):
+                return 0
+
+            def foo_b(x: str, y, *, z: float = 0.0):
+                return 1
+
+            def foo_c(*args, key: str):
+                return 2
+
+            for func in (foo_a, foo_b, foo_c):
+                func.__qualname__ = f"foo_{inspected}"
+                if inspected:
+                    # Functions with attributes are read through inspect.signature
+                    func.attribute = None
+                foo = overload(func)
+            return foo
+
+        code, inspected = make(False), make(True)
+        values = [1, "a", 1.0, None]
+        calls = [((x,), {"z": z}) for x in values for z in values] + [((x, y), {}) for x in values for y in values]
+        calls += [((1, "a", 2, 3), {"z": 1.0, "w": 1, "v": 2}), ((1,), {"y": "a", "z": 1.0}), ((), {"key": "a"})]
+        calls += [(("a",), {"y": 1}), ((), {"x": "a", "y": 1}), ((), {"x": 1, "z": 1.0}), ((1, 2), {"key": "a"})]
+
+        for args, kwargs in calls:
+            try:
+                expected = inspected(*args, **kwargs)
+            except (AmbiguousOverloadError, NoMatchingOverloadError) as error:
+                self.assertRaises(type(error), code, *args, **kwargs)
+            else:
+                self.assertEqual(code(*args, **kwargs), expected)
+
+    def test_arity(self):
+        @overload
+        def foo(x, /):
+            return 0
+        
+        @overload
+        def foo(x, y=0, *, z):
+            return 1
+        
+        @overload
+        def foo(x, y, z, w, *args):
+            return 2
+        
+        @overload
+        def foo(**kwargs):
+            return 3
+
+        self.assertEqual(foo(1), 0)
+        self.assertEqual(foo(1, z=2), 1)
+        self.assertEqual(foo(1, 2, z=3), 1)
+        self.assertEqual(foo(1, 2, 3, 4), 2)
+        self.assertEqual(foo(1, 2, 3, w=4), 2)
+        self.assertEqual(foo(1, 2, 3, 4, 5), 2)
+        self.assertEqual(foo(), 3)
+        self.assertEqual(foo(a=1, b=2), 3)
+        self.assertRaises(AmbiguousOverloadError, foo, x=1, z=2)
+        self.assertRaises(NoMatchingOverloadError, foo, 1, 2)
+
+    def test_disjoint(self):
+        class Base:
+            pass
+
+        @overload
+        def foo(x: int, y=None):
+            return 0
+        
+        @overload
+        def foo(x: str, y: int = 0):
+            return 1
+        
+        @overload
+        def foo(x: tuple):
+            return 2
+        
+        @overload
+        def foo(x, y, z, /):
+            return 3
+        
+        @overload
+        def foo(*, key: Base):
+            return 4
+
+        self.assertTrue(foo.disjoint)
+        self.assertEqual(foo(1), 0)
+        self.assertEqual(foo(x="apple"), 1)
+        self.assertEqual(foo(()), 2)
+        self.assertEqual(foo(1, 2, 3), 3)
+        self.assertEqual(foo(key=Base()), 4)
+
+        @overload
+        def foo(y: int, x: str):
+            return 5
+        
+        self.assertFalse(foo.disjoint)
+        self.assertRaises(AmbiguousOverloadError, foo, y=1, x="apple")
+
+        @overload
+        def bar(x: list):
+            return 0
+        
+        @overload
+        def bar(x: Base):
+            return 1
+        
+        self.assertFalse(bar.disjoint)
+
+    def test_engines(self):
+        class Base:
+            pass
+        
+        class Derived(Base):
+            pass
+
+        def make(engine):
+            def foo_int_str(x: int, y: str):
+                return 0
+            
+            def foo_int_int(x: int, y: int):
+                return 1
+            
+            def foo_base(x: Base, y: str = ""):
+                return 2
+            
+            def foo_derived(x: Derived, y, *args):
+                return 3
+            
+            def foo_bool(x: bool, y: Sequence):
+                return 4
+            
+            # Both engines need their own overload set
+            for func in (foo_int_str, foo_int_int, foo_base, foo_derived, foo_bool):
+                func.__qualname__ = f"foo_{engine}"
+                foo = overload(func, engine=engine)
+            return foo
+
+        linear = make("linear")
+        values = [1, True, "a", [], Base(), Derived(), None]
+        calls = [((x,), {}) for x in values] + [((x, y), {}) for x in values for y in values]
+        calls += [((x,), {"y": y}) for x in values for y in values] + [((Derived(), 1, 2), {}), ((1, 2, 3), {})]
+
+        for engine in ("tree", "bitset", "trie"):
+            foo = make(engine)
+            for args, kwargs in calls * 2:
+                try:
+                    expected = linear(*args, **kwargs)
+                except (AmbiguousOverloadError, NoMatchingOverloadError) as error:
+                    self.assertRaises(type(error), foo, *args, **kwargs)
+                else:
+                    self.assertEqual(foo(*args, **kwargs), expected)
+            self.assertEqual(foo(1, y="a"), 0)
+
+    def test_bitset_engine_wide(self):
+        classes = [type(f"Class{i}", (), {}) for i in range(150)]
+
+        for i, cls in enumerate(classes):
+            def foo(x: cls, y: int = 0, *, i=i):
+                return i
+            foo = overload(foo, engine="bitset")
+        
+        for i in (0, 63, 64, 127, 128, 149):
+            self.assertEqual(foo(classes[i]()), i)
+            self.assertEqual(foo(classes[i](), y=1), i)
+        self.assertRaises(NoMatchingOverloadError, foo, classes[0](), y="a")
+
+    def test_adaptive_engine(self):
+        classes = [type(f"Class{i}", (), {}) for i in range(10)]
+        
+        for i, cls in enumerate(classes):
+            def foo(x: cls, *, i=i):
+                return i
+            foo = overload(foo)
+        
+            def bar(x: cls, *, i=i):
+                return i
+            bar = overload(bar, cache_size=4)
+        
+            def baz(x: cls, *, i=i):
+                return i
+            baz = overload(baz, cache_size=0)
+        
+            def qux(x: cls, *, i=i):
+                return i
+            qux = overload(qux, engine="bitset", cache_size=0)
+        
+        self.assertEqual(foo.active_engine, "linear")
+        self.assertEqual(qux.active_engine, "linear")
+        for j in range(2048):
+            derived = type("Derived", (classes[j % 10],), {})
+            self.assertEqual(foo(derived()), j % 10)
+            self.assertEqual(bar(derived()), j % 10)
+            self.assertEqual(baz(derived()), j % 10)
+            self.assertEqual(qux(derived()), j % 10)
+        self.assertEqual(foo.active_engine, "bitset")
+        self.assertEqual(bar.active_engine, "trie")
+        self.assertEqual(baz.active_engine, "trie")
+        self.assertEqual(qux.active_engine, "linear")
+
+        for j in range(2048):
+            self.assertEqual(foo(classes[1]()), 1)
+        self.assertEqual(foo.active_engine, "bitset")
+
+    def test_incremental_registration(self):
+        classes = [type(f"Class{i}", (), {}) for i in range(70)]
+        derived = [type(f"Derived{i}", (cls,), {}) for i, cls in enumerate(classes)]
+        values = [cls() for cls in classes[::7] + derived[::5]] + [1, "a", None]
+        references = []
+
+        def reference(functions):
+            # A new set of copies of the overloads without caches or tables, compiled from scratch
+            for func in functions:
+                copy = FunctionType(func.__code__, func.__globals__, "foo", func.__defaults__, func.__closure__)
+                copy.__kwdefaults__ = func.__kwdefaults__
+                copy.__annotations__ = func.__annotations__
+                copy.__qualname__ = f"reference_{len(references)}"
+                foo = overload(copy, engine="linear", cache_size=0)
+            references.append(foo)
+            return foo
+
+        for engine in ("linear", "tree", "bitset", "trie"):
+            functions = []
+            for i, cls in enumerate(classes):
+                def foo(x: cls, y: int = 0, *, i=i):
+                    return i
+                if i % 3 == 0:
+                    def foo(x, y: cls, *, i=i):
+                        return i
+                functions.append(foo)
+                foo.__qualname__ = f"incremental_{engine}"
+                foo = overload(foo, engine=engine)
+                if i % 4 != 0 and i < 66:
+                    continue
+
+                expected = reference(functions)
+                for x in values:
+                    for args, kwargs in (((x,), {}), ((x, x), {}), ((x,), {"y": x}), ((1, x), {})):
+                        try:
+                            result = expected(*args, **kwargs)
+                        except (AmbiguousOverloadError, NoMatchingOverloadError) as error:
+                            self.assertRaises(type(error), foo, *args, **kwargs)
+                        else:
+                            self.assertEqual(foo(*args, **kwargs), result)
+
+    def test_freeze(self):
+        classes = [type(f"Class{i}", (), {}) for i in range(10)]
+
+        for i, cls in enumerate(classes):
+            def foo(x: cls, *, i=i):
+                return i
+            foo = overload(foo, freeze=i == 9)
+
+        @overload
+        def bar(x: int):
+            return 0
+
+        self.assertTrue(foo.frozen)
+        self.assertEqual(foo.functions, tuple(foo.functions))
+        self.assertEqual(foo.active_engine, "bitset")
+        self.assertEqual(foo(classes[3]()), 3)
+        self.assertFalse(bar.frozen)
+        self.assertIs(bar.freeze(), bar)
+        self.assertEqual(bar.active_engine, "linear")
+        self.assertEqual(bar(1), 0)
+
+        with self.assertRaises(RuntimeError):
+            @overload
+            def bar(x: str):
+                return 1
+        self.assertEqual(len(bar.functions), 1)
+        self.assertRaises(NoMatchingOverloadError, bar, "apple")
+
+    def test_resolve(self):
+        class Base:
+            pass
+        
+        class Derived(Base):
+            pass
+
+        @overload
+        def foo(x: int, y: Base = None):
+            return 0
+        
+        @overload
+        def foo(x: str, *, y: Derived):
+            return 1
+        
+        @overload
+        def foo(x: bool):
+            return 2
+
+        self.assertEqual(foo.resolve(int)(1), 0)
+        self.assertEqual(foo.resolve(int, Derived)(1, Derived()), 0)
+        self.assertEqual(foo.resolve(str, y=Derived)("a", y=Derived()), 1)
+        self.assertEqual(foo.resolve_for("a", y=Derived())("a", y=Derived()), 1)
+        self.assertEqual(foo.resolve_for(1)(1), 0)
+        self.assertRaises(AmbiguousOverloadError, foo.resolve, bool)
+        self.assertRaises(AmbiguousOverloadError, foo.resolve_for, True)
+        self.assertRaises(TypeError, foo.resolve, 1)
+
+        with self.assertRaises(NoMatchingOverloadError) as context:
+            foo.resolve(str, y=Base)
+        self.assertEqual([str(reason) for reason in context.exception.fail_reasons], [
+            "argument 'x' has unexpected type 'str'",
+            f"argument 'y' has unexpected type '{Base.__qualname__}'",
+            "got an unexpected keyword argument 'y'",
+        ])
+
+    def test_specialize(self):
+        class Base:
+            pass
+
+        class Derived(Base):
+            pass
+
+        class Other:
+            pass
+
+        @overload(resolution="best")
+        def foo(x: int, y: Base):
+            return 0
+
+        @overload
+        def foo(x: str, y: Base):
+            return 1
+
+        bar = foo.specialize(int, Base)
+        self.assertEqual(bar(1, Base()), 0)
+        self.assertEqual(bar(1, Derived()), 0)
+        self.assertEqual(bar("a", Base()), 1)
+        self.assertEqual(bar(1, y=Base()), 0)
+        self.assertRaises(NoMatchingOverloadError, bar, 1.0, Base())
+
+        @overload
+        def foo(x: int, y: Derived):
+            return 2
+
+        self.assertEqual(bar(1, Base()), 0)
+        self.assertEqual(bar(1, Derived()), 2)
+
+        baz = foo.specialize(str, Derived)
+        self.assertEqual(baz("a", Derived()), 1)
+        Derived.__bases__ = (Other,)
+        self.assertRaises(NoMatchingOverloadError, baz, "a", Derived())
+
+        self.assertRaises(NoMatchingOverloadError, foo.specialize, float, Base)
+        self.assertRaises(TypeError, foo.specialize, 1)
+        self.assertRaises(TypeError, type(bar), None, ())
+        self.assertRaises(TypeError, type(bar).__new__(type(bar)))
+
+    def test_repeated_calls(self):
+        @overload
+        def foo(x: int):
+            return 0
+        
+        @overload
+        def foo(x: str):
+            return 1
+
+        for _ in range(3):
+            self.assertEqual(foo(1), 0)
+            self.assertEqual(foo("apple"), 1)
+            self.assertEqual(foo(x=1), 0)
+        
+        @overload
+        def foo(x: bool):
+            return 2
+
+        self.assertEqual(foo("apple"), 1)
+        self.assertRaises(AmbiguousOverloadError, foo, True)
+
+    def test_polymorphic_calls(self):
+        classes = [type(f"Class{i}", (), {}) for i in range(6)]
+
+        @overload
+        def foo(x: int, y=None):
+            return 0
+        
+        @overload
+        def foo(x: str, y=None):
+            return 1
+        
+        @overload
+        def foo(x: object, y: int):
+            return 2
+
+        for _ in range(3):
+            for cls in classes:
+                self.assertRaises(NoMatchingOverloadError, foo, cls())
+                self.assertEqual(foo(cls(), 1), 2)
+                self.assertEqual(foo(cls(), y=1), 2)
+            self.assertEqual(foo(1), 0)
+            self.assertEqual(foo("apple", y="a"), 1)
+            self.assertEqual(foo(x="apple"), 1)
+            self.assertRaises(AmbiguousOverloadError, foo, 1, 1)
+
+    def test_bounded_cache(self):
+        import gc
+        import weakref
+
+        @overload(cache_size=16, resolution="best")
+        def foo(x: int):
+            return 0
+        
+        @overload
+        def foo(x: object, *, y=None):
+            return 1
+        
+        refs = []
+        for i in range(100):
+            cls = type(f"Class{i}", (), {})
+            refs.append(weakref.ref(cls))
+            self.assertEqual(foo(cls()), 1)
+            self.assertEqual(foo(i), 0)
+        
+        del cls
+        gc.collect()
+        self.assertTrue(all(ref() is None for ref in refs))
+        self.assertRaises(ValueError, overload, foo, cache_size=-1)
+
+    def test_reentrant_cache(self):
+        checking = []
+
+        class A(ABC):
+            @classmethod
+            def __subclasshook__(cls, subclass):
+                # Resolves the same call, which caches its key before the outer call does
+                if not checking:
+                    checking.append(subclass)
+                    foo(subclass())
+                    checking.pop()
+                return NotImplemented
+
+        @overload(cache_size=3, resolution="best")
+        def foo(x: A):
+            return 0
+
+        @overload
+        def foo(x: object):
+            return 1
+
+        for i in range(12):
+            self.assertEqual(foo(type(f"Class{i}", (), {})()), 1)
+            self.assertEqual(foo(i), 1)
+
+    def test_class_mutation(self):
+        class A:
+            pass
+        
+        class B:
+            pass
+        
+        class C(A):
+            pass
+
+        @overload
+        def foo(x: A):
+            return 0
+        
+        @overload
+        def foo(x: B):
+            return 1
+        
+        self.assertEqual(foo(C()), 0)
+        C.__bases__ = (B,)
+        self.assertEqual(foo(C()), 1)
+
+    def test_abc_registration(self):
+        class Abstract(ABC):
+            pass
+        
+        class Concrete:
+            pass
+
+        @overload
+        def foo(x: Abstract):
+            return 0
+        
+        @overload
+        def foo(x: int):
+            return 1
+        
+        self.assertRaises(NoMatchingOverloadError, foo, Concrete())
+        Abstract.register(Concrete)
+        self.assertEqual(foo(Concrete()), 0)
+
+    def test_instancecheck_patching(self):
+        class Meta(type):
+            pass
+        
+        class Even(metaclass=Meta):
+            pass
+
+        @overload
+        def foo(x: Even):
+            return 0
+        
+        @overload
+        def foo(x: int):
+            return 1
+        
+        self.assertEqual(foo(2), 1)
+        Meta.__instancecheck__ = lambda cls, obj: isinstance(obj, int) and obj % 2 == 0
+        self.assertRaises(AmbiguousOverloadError, foo, 2)
+        self.assertEqual(foo(3), 1)
+        self.assertRaises(AmbiguousOverloadError, foo, 4)
+
+    def test_method(self):
+        class Foo:
+            @overload
+            def bar(self, x: int):
+                return 0
+            
+            @overload
+            def bar(self, x: str):
+                return 1
+        
+        foo = Foo()
+        self.assertEqual(foo.bar(1), 0)
+        self.assertEqual(foo.bar(x="apple"), 1)
+        self.assertEqual(Foo.bar(foo, "apple"), 1)
+        self.assertEqual(Foo.bar.__name__, "bar")
+
+    def test_introspection(self):
+        @overload
+        def foo(x: int):
+            """Do foo."""
+            return 0
+        
+        @overload
+        def foo(x: str):
+            """Do foo with a string."""
+            return 1
+        
+        self.assertEqual(foo.__doc__, "Do foo.")
+        self.assertEqual(str(signature(foo)), "(*args, **kwargs)")
+
+    def test_best_resolution(self):
+        class Base:
+            pass
+        
+        class Derived(Base):
+            pass
+
+        @overload(resolution="best")
+        def foo(x: int):
+            return 0
+        
+        @overload
+        def foo(x: bool):
+            return 1
+        
+        @overload
+        def foo(x: Base, y=None):
+            return 2
+        
+        @overload
+        def foo(x: Derived, y: object = None):
+            return 3
+        
+        @overload
+        def foo(x, y: str):
+            return 4
+
+        for _ in range(2):
+            self.assertEqual(foo(1), 0)
+            self.assertEqual(foo(True), 1)
+            self.assertEqual(foo(Base()), 2)
+            self.assertEqual(foo(Derived()), 3)
+            self.assertEqual(foo(Derived(), 1), 3)
+            self.assertEqual(foo(1, "apple"), 4)
+        self.assertRaises(AmbiguousOverloadError, foo, Derived(), "apple")
+
+    def test_best_resolution_ambiguous(self):
+        @overload(resolution="best")
+        def foo(x: int, y):
+            return 0
+        
+        @overload
+        def foo(x, y: int):
+            return 1
+
+        self.assertEqual(foo(1, "apple"), 0)
+        with self.assertRaises(AmbiguousOverloadError) as context:
+            foo(1, 2)
+        self.assertEqual(len(context.exception.candidates), 2)
+        self.assertRaises(ValueError, overload, foo, resolution="first")
+
+
+class TestTyping(TestCase):
+    def test_union(self):
+        @overload_typing
+        def foo(x: Union[int, str]):
+            return 0
+        
+        @overload_typing
+        def foo(x: Optional[list]):
+            return 1
+        
+        @overload_typing
+        def foo(x: float | bytes):
+            return 2
+
+        self.assertEqual(foo(1), 0)
+        self.assertEqual(foo("apple"), 0)
+        self.assertEqual(foo(None), 1)
+        self.assertEqual(foo([]), 1)
+        self.assertEqual(foo(1.0), 2)
+        self.assertRaises(NoMatchingOverloadError, foo, {})
+
+    def test_any(self):
+        @overload_typing
+        def foo(x: Any, y: Union[int, Any]):
+            return 0
+
+        self.assertEqual(foo(None, "apple"), 0)
+
+    def test_literal(self):
+        @overload_typing
+        def foo(mode: Literal["r", "w"]):
+            return 0
+        
+        @overload_typing
+        def foo(mode: Literal[1]):
+            return 1
+
+        self.assertEqual(foo("r"), 0)
+        self.assertEqual(foo("w"), 0)
+        self.assertEqual(foo(1), 1)
+        self.assertRaises(NoMatchingOverloadError, foo, "x")
+        self.assertRaises(NoMatchingOverloadError, foo, True)
+
+    def test_type(self):
+        @overload_typing
+        def foo(cls: Type[int]):
+            return 0
+        
+        @overload_typing
+        def foo(cls: Type[Union[str, bytes]]):
+            return 1
+        
+        @overload_typing
+        def foo(cls: int):
+            return 2
+
+        self.assertEqual(foo(bool), 0)
+        self.assertEqual(foo(bytes), 1)
+        self.assertEqual(foo(1), 2)
+        self.assertRaises(NoMatchingOverloadError, foo, list)
+
+    def test_tuple(self):
+        @overload_typing
+        def foo(t: Tuple[int, int]):
+            return 0
+        
+        @overload_typing
+        def foo(t: Tuple[int, str, Optional[int]]):
+            return 1
+
+        self.assertEqual(foo((1, 2)), 0)
+        self.assertEqual(foo((1, "a", None)), 1)
+        self.assertRaises(NoMatchingOverloadError, foo, (1, "a"))
+        self.assertRaises(NoMatchingOverloadError, foo, [1, 2])
+
+        @overload_typing
+        def foo(t: Tuple[()]):
+            return 2
+
+        @overload_typing
+        def bar(t: tuple[()]):
+            return 0
+
+        self.assertEqual(foo(()), 2)
+        self.assertEqual(bar(()), 0)
+        self.assertRaises(NoMatchingOverloadError, foo, (1,))
+        self.assertRaises(NoMatchingOverloadError, bar, (1,))
+
+    def test_containers_shallow(self):
+        @overload_typing
+        def foo(x: List[int]):
+            return 0
+        
+        @overload_typing
+        def foo(x: Dict[str, int]):
+            return 1
+
+        self.assertEqual(foo(["apple"]), 0)
+        self.assertEqual(foo({1: 2}), 1)
+
+    def test_containers_full(self):
+        @overload_typing(container_check="full")
+        def foo(x: List[int]):
+            return 0
+        
+        @overload_typing
+        def foo(x: list[str]):
+            return 1
+        
+        @overload_typing
+        def foo(x: Tuple[float, ...]):
+            return 2
+        
+        @overload_typing
+        def foo(x: Dict[str, List[int]]):
+            return 3
+
+        self.assertEqual(foo(list(range(1000))), 0)
+        self.assertEqual(foo(["a", "b"]), 1)
+        self.assertEqual(foo((1.0, 2.0)), 2)
+        self.assertEqual(foo({"a": [1]}), 3)
+        self.assertRaises(AmbiguousOverloadError, foo, [])
+        self.assertRaises(NoMatchingOverloadError, foo, [1, "a"])
+        self.assertRaises(NoMatchingOverloadError, foo, (1.0, "a"))
+        self.assertRaises(NoMatchingOverloadError, foo, {"a": ["b"]})
+
+    def test_containers_bounded(self):
+        @overload_typing(container_check="first", container_items=2)
+        def foo(x: SequenceOf[int]):
+            return 0
+        
+        @overload_typing
+        def foo(x: SequenceOf[str]):
+            return 1
+
+        self.assertEqual(foo([1, 2, "a"]), 0)
+        self.assertEqual(foo(("a", "b", 3)), 1)
+
+        @overload_typing(container_check="sample", container_items=2)
+        def bar(x: List[int]):
+            return 0
+
+        self.assertEqual(bar([1, "a", 2, "b"]), 0)
+        self.assertRaises(NoMatchingOverloadError, bar, [1, 2, "a", "b"])
+
+    def test_disjoint(self):
+        @overload_typing
+        def foo(x: Union[int, str]):
+            return 0
+        
+        @overload_typing
+        def foo(x: Optional[List[int]]):
+            return 1
+        
+        @overload_typing
+        def foo(x: Literal[1.0], y: Type[int] = int):
+            return 2
+
+        self.assertTrue(foo.disjoint)
+
+        @overload_typing
+        def foo(x: SequenceOf[int]):
+            return 3
+
+        self.assertFalse(foo.disjoint)
+
+    def test_resolve(self):
+        @overload_typing(resolution="best")
+        def foo(x: Union[int, str]):
+            return 0
+        
+        @overload_typing
+        def foo(x: Optional[bool]):
+            return 1
+        
+        @overload_typing
+        def foo(x: Literal["r"], y):
+            return 2
+
+        self.assertEqual(foo.resolve(str), foo.resolve_for("a"))
+        self.assertEqual(foo.resolve(bool)(True), 1)
+        self.assertEqual(foo.resolve(type(None))(None), 1)
+        self.assertEqual(foo.resolve_for("r", 1)("r", 1), 2)
+        self.assertRaises(TypeError, foo.resolve, str, int)
+
+    def test_specialize_values(self):
+        @overload_typing
+        def foo(x: int):
+            return 0
+
+        bar = foo.specialize(int)
+        self.assertEqual(bar(5), 0)
+
+        # Overloads that depend on values of arguments make calls go through full dispatch
+        @overload_typing
+        def foo(x: Literal[1]):
+            return 1
+
+        self.assertEqual(bar(5), 0)
+        self.assertRaises(AmbiguousOverloadError, bar, 1)
+
+        @overload_typing(resolution="best")
+        def baz(x: Literal[1]):
+            return 1
+
+        @overload_typing
+        def baz(x: int):
+            return 0
+
+        qux = baz.specialize(int)
+        self.assertEqual(qux(1), 1)
+        self.assertEqual(qux(5), 0)
+
+    def test_resolve_values(self):
+        @overload_typing
+        def foo(x: Literal["a", "b"]):
+            return 0
+        
+        @overload_typing
+        def foo(x: int):
+            return 1
+        
+        @overload_typing
+        def foo(x: float):
+            return 2
+        
+        @overload_typing
+        def foo(x: Tuple[int, int], y: List[int]):
+            return 3
+        
+        @overload_typing
+        def foo(x: Type[int], y: Dict[str, Any]):
+            return 4
+
+        self.assertEqual(foo.resolve(int)(1), 1)
+        self.assertEqual(foo.resolve(float)(1.0), 2)
+        self.assertRaises(NoMatchingOverloadError, foo.resolve, list, list)
+        self.assertRaises(NoMatchingOverloadError, foo.resolve, int, dict)
+        with self.assertRaisesRegex(TypeError, "resolve_for"):
+            foo.resolve(str)
+        self.assertRaises(TypeError, foo.resolve, tuple, list)
+        self.assertRaises(TypeError, foo.resolve, type, dict)
+
+    def test_trie_engine(self):
+        class Context:
+            pass
+
+        @overload_typing(engine="trie")
+        def foo(context: Context, mode: Literal["r", "w"], size: int = 0):
+            return 0
+        
+        @overload_typing
+        def foo(context: Context, mode: Literal["a"], *args: int):
+            return 1
+        
+        @overload_typing
+        def foo(context: Context, data: Dict[str, int]):
+            return 2
+        
+        @overload_typing
+        def foo(context: None, /, **kwargs):
+            return 3
+
+        context = Context()
+        self.assertEqual(foo(context, "r"), 0)
+        self.assertEqual(foo(context, mode="w", size=1), 0)
+        self.assertEqual(foo(context, "a", 1, 2), 1)
+        self.assertEqual(foo(context, {}), 2)
+        self.assertEqual(foo(context, data={}), 2)
+        self.assertEqual(foo(None, mode="r"), 3)
+        self.assertRaises(NoMatchingOverloadError, foo, context, "x")
+        self.assertRaises(NoMatchingOverloadError, foo, context, "r", "big")
+
+    def test_best_resolution(self):
+        @overload_typing(resolution="best")
+        def foo(x: Union[int, str]):
+            return 0
+        
+        @overload_typing
+        def foo(x: Optional[bool]):
+            return 1
+        
+        @overload_typing
+        def foo(x: Literal[0]):
+            return 2
+        
+        @overload_typing
+        def foo(x: Any):
+            return 3
+
+        self.assertEqual(foo(1), 0)
+        self.assertEqual(foo("apple"), 0)
+        self.assertEqual(foo(True), 1)
+        self.assertEqual(foo(None), 1)
+        self.assertEqual(foo(0), 2)
+        self.assertEqual(foo([]), 3)
+
+    def test_lazy_compilation(self):
+        @overload_typing
+        def foo(x: List[int]):
+            return 0
+
+        self.assertNotIn(foo.functions[0], signature_cache)
+        self.assertEqual(foo([1]), 0)
+        self.assertIn(foo.functions[0], signature_cache)
+
+        @overload_typing(container_check="full")
+        def foo(x: List[str]):
+            return 1
+
+        # Options of the set apply to overloads that were compiled before
+        self.assertNotIn(foo.functions[1], signature_cache)
+        self.assertEqual(foo(["a"]), 1)
+        self.assertEqual(foo([1]), 0)
+
+    def test_unsupported(self):
+        @overload_typing
+        def foo(x: "int"):
+            pass
+
+        # Annotations are compiled on the first call
+        self.assertRaises(TypeError, foo, 1)
+        self.assertRaises(TypeError, foo.resolve, int)
 
 
 if __name__ == "__main__":